@@ -24,6 +24,10 @@ include(${bsl_SOURCE_DIR}/cmake/function/bf_add_config.cmake)
 option(MICROV_BUILD_HYPERCALL "Turns on/off building the hypercall library" ON)
 option(MICROV_BUILD_SHIM "Turns on/off building the shim" ON)
 option(MICROV_BUILD_VMM "Turns on/off building the vmm" ON)
+option(MICROV_LAZY_FPU "Turns on/off lazy loading of a guest VS's extended (FPU) state" ON)
+option(MICROV_EMULATED_UART "Turns on/off emulating a guest VM's COM1 UART and 0xE9 port in MicroV" ON)
+option(MICROV_EMULATED_PIT "Turns on/off emulating a guest VM's PIT (8254) in MicroV" ON)
+option(MICROV_EMULATED_IRQCHIP "Turns on/off emulating a guest VM's PIC (8259) and IOAPIC in MicroV" ON)
 
 bf_add_config(
     CONFIG_NAME MICROV_MAX_PP_MAPS
@@ -72,3 +76,11 @@ bf_add_config(
     DESCRIPTION "Defines the size of a VS interrupt queue"
     SKIP_VALIDATION
 )
+
+bf_add_config(
+    CONFIG_NAME MICROV_HALT_POLL_NS
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "200000"
+    DESCRIPTION "Defines the max time in nanoseconds MicroV polls a halted VS for interrupts (0 disables polling)"
+    SKIP_VALIDATION
+)
@@ -98,6 +98,31 @@ macro(microv_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   MICROV_HALT_POLL_NS            ${BF_COLOR_CYN}${MICROV_HALT_POLL_NS}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   MICROV_LAZY_FPU                ${BF_COLOR_CYN}${MICROV_LAZY_FPU}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   MICROV_EMULATED_UART           ${BF_COLOR_CYN}${MICROV_EMULATED_UART}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   MICROV_EMULATED_PIT            ${BF_COLOR_CYN}${MICROV_EMULATED_PIT}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   MICROV_EMULATED_IRQCHIP        ${BF_COLOR_CYN}${MICROV_EMULATED_IRQCHIP}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo " "
         VERBATIM
@@ -54,6 +54,7 @@ macro(microv_add_vmm_integration NAME HEADERS)
         MICROV_MAX_GPA_SIZE=${MICROV_MAX_GPA_SIZE}_umx
         MICROV_MAX_SLOTS=${MICROV_MAX_SLOTS}_umx
         MICROV_INTERRUPT_QUEUE_SIZE=${MICROV_INTERRUPT_QUEUE_SIZE}_umx
+        MICROV_HALT_POLL_NS=${MICROV_HALT_POLL_NS}_umx
     )
 
     target_compile_options(integration_${NAME} PRIVATE -Wframe-larger-than=4294967295)
@@ -129,6 +130,7 @@ macro(microv_add_shim_integration NAME HEADERS)
         MICROV_MAX_GPA_SIZE=${MICROV_MAX_GPA_SIZE}_umx
         MICROV_MAX_SLOTS=${MICROV_MAX_SLOTS}_umx
         MICROV_INTERRUPT_QUEUE_SIZE=${MICROV_INTERRUPT_QUEUE_SIZE}_umx
+        MICROV_HALT_POLL_NS=${MICROV_HALT_POLL_NS}_umx
     )
 
     target_compile_options(integration_${NAME} PRIVATE -Wframe-larger-than=4294967295)
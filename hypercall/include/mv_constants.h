@@ -147,6 +147,67 @@ NODISCARD static inline int
 /** @brief Indicates the map is mapped as WP */
 #define MV_MAP_FLAG_WRITE_PROTECTED ((uint64_t)0x8000000000000000)
 
+/* -------------------------------------------------------------------------- */
+/* IO Permission Types                                                        */
+/* -------------------------------------------------------------------------- */
+
+/** @brief Indicates accesses to the ports are returned to the root VM */
+#define MV_IO_PERM_EXIT ((uint64_t)0x0000000000000000)
+/** @brief Indicates accesses to the ports are given to the hardware */
+#define MV_IO_PERM_PASSTHROUGH ((uint64_t)0x0000000000000001)
+/** @brief Indicates accesses to the ports are handled by MicroV */
+#define MV_IO_PERM_EMULATE ((uint64_t)0x0000000000000002)
+/** @brief Defines where the number of ports is stored in REG2 */
+#define MV_IO_PERM_NUM_PORTS_SHIFT ((uint64_t)32)
+
+/* -------------------------------------------------------------------------- */
+/* Pause Exiting                                                              */
+/* -------------------------------------------------------------------------- */
+
+/** @brief Defines the default max number of cycles between PAUSEs of a loop */
+#define MV_PAUSE_EXITING_DEFAULT_GAP ((uint64_t)0x0000000000000080)
+/** @brief Defines the default number of cycles a VS can spin before yielding */
+#define MV_PAUSE_EXITING_DEFAULT_WINDOW ((uint64_t)0x0000000000001000)
+/** @brief Defines the largest gap/window supported by mv_vm_op_pause_exiting */
+#define MV_PAUSE_EXITING_MAX ((uint64_t)0x00000000FFFFFFFF)
+
+/* -------------------------------------------------------------------------- */
+/* Statistics                                                                 */
+/* -------------------------------------------------------------------------- */
+
+/** @brief Defines the VMExit statistics of a VS (see mv_debug_op_stats_get) */
+#define MV_STATS_TYPE_VS_EXITS ((uint64_t)0x0000000000000000)
+/** @brief Defines the hypercall statistics of a VS (see mv_debug_op_stats_get) */
+#define MV_STATS_TYPE_VS_HYPERCALLS ((uint64_t)0x0000000000000001)
+/** @brief Defines the VMExit statistics of a PP (see mv_debug_op_stats_get) */
+#define MV_STATS_TYPE_PP_EXITS ((uint64_t)0x0000000000000002)
+/** @brief Defines the hypercall statistics of a PP (see mv_debug_op_stats_get) */
+#define MV_STATS_TYPE_PP_HYPERCALLS ((uint64_t)0x0000000000000003)
+/** @brief Defines the halt-polling statistics of a VS (see mv_debug_op_stats_get) */
+#define MV_STATS_TYPE_VS_HALT_POLLS ((uint64_t)0x0000000000000004)
+/** @brief Defines the extended state statistics of a VS (see mv_debug_op_stats_get) */
+#define MV_STATS_TYPE_VS_FPU ((uint64_t)0x0000000000000005)
+/** @brief Defines the first exit reason that is not stored at slot == reason */
+#define MV_STATS_EXIT_HIGH_REASON ((uint64_t)0x0000000000000400)
+/** @brief Defines the slot MV_STATS_EXIT_HIGH_REASON is stored at */
+#define MV_STATS_EXIT_HIGH_SLOT ((uint64_t)0x0000000000000100)
+/** @brief Defines where the opcode is stored in a MicroV hypercall's slot */
+#define MV_STATS_HYPERCALL_OPCODE_SHIFT ((uint64_t)6)
+/** @brief Defines the slot of a HLT that was woken up while polling */
+#define MV_STATS_HALT_POLL_SLOT_HIT ((uint64_t)0x0000000000000000)
+/** @brief Defines the slot of a HLT that was handed to the root VM */
+#define MV_STATS_HALT_POLL_SLOT_MISS ((uint64_t)0x0000000000000001)
+/** @brief Defines the slot that counts the times the poll window grew */
+#define MV_STATS_HALT_POLL_SLOT_GROW ((uint64_t)0x0000000000000002)
+/** @brief Defines the slot that counts the times the poll window shrank */
+#define MV_STATS_HALT_POLL_SLOT_SHRINK ((uint64_t)0x0000000000000003)
+/** @brief Defines the slot of a save of the extended state */
+#define MV_STATS_FPU_SLOT_SAVE ((uint64_t)0x0000000000000000)
+/** @brief Defines the slot of a restore of the extended state */
+#define MV_STATS_FPU_SLOT_RESTORE ((uint64_t)0x0000000000000001)
+/** @brief Defines the slot that counts the times the VS was set active */
+#define MV_STATS_FPU_SLOT_SWITCH ((uint64_t)0x0000000000000002)
+
 /* -------------------------------------------------------------------------- */
 /* Special IDs                                                                */
 /* -------------------------------------------------------------------------- */
@@ -414,6 +475,8 @@ NODISCARD static inline int
 
 /** @brief Defines the index for mv_debug_op_out */
 #define MV_DEBUG_OP_OUT_IDX_VAL ((uint64_t)0x0000000000000000)
+/** @brief Defines the index for mv_debug_op_stats_get */
+#define MV_DEBUG_OP_STATS_GET_IDX_VAL ((uint64_t)0x0000000000000001)
 
 /** @brief Defines the index for mv_pp_op_ppid */
 #define MV_PP_OP_PPID_IDX_VAL ((uint64_t)0x0000000000000000)
@@ -463,6 +526,10 @@ NODISCARD static inline int
 #define MV_PP_OP_TSC_GET_KHZ_IDX_VAL ((uint64_t)0x0000000000000016)
 /** @brief Defines the index for mv_pp_op_tsc_set_khz */
 #define MV_PP_OP_TSC_SET_KHZ_IDX_VAL ((uint64_t)0x0000000000000017)
+/** @brief Defines the index for mv_pp_op_clr_trace_gpa */
+#define MV_PP_OP_CLR_TRACE_GPA_IDX_VAL ((uint64_t)0x0000000000000018)
+/** @brief Defines the index for mv_pp_op_set_trace_gpa */
+#define MV_PP_OP_SET_TRACE_GPA_IDX_VAL ((uint64_t)0x0000000000000019)
 
 /** @brief Defines the index for mv_vm_op_create_vm */
 #define MV_VM_OP_CREATE_VM_IDX_VAL ((uint64_t)0x0000000000000000)
@@ -475,6 +542,23 @@ NODISCARD static inline int
 /** @brief Defines the index for mv_vm_op_mmio_unmap */
 #define MV_VM_OP_MMIO_UNMAP_IDX_VAL ((uint64_t)0x0000000000000004)
 
+/** @brief Defines the index for mv_vm_op_irqchip_create */
+#define MV_VM_OP_IRQCHIP_CREATE_IDX_VAL ((uint64_t)0x0000000000000005)
+
+/** @brief Defines the index for mv_vm_op_irq_line */
+#define MV_VM_OP_IRQ_LINE_IDX_VAL ((uint64_t)0x0000000000000006)
+
+/** @brief Defines the index for mv_vm_op_io_permission */
+#define MV_VM_OP_IO_PERMISSION_IDX_VAL ((uint64_t)0x0000000000000007)
+/** @brief Defines the index for mv_vm_op_pause_exiting */
+#define MV_VM_OP_PAUSE_EXITING_IDX_VAL ((uint64_t)0x0000000000000008)
+/** @brief Defines the index for mv_vm_op_clock_get */
+#define MV_VM_OP_CLOCK_GET_IDX_VAL ((uint64_t)0x0000000000000009)
+/** @brief Defines the index for mv_vm_op_clock_set */
+#define MV_VM_OP_CLOCK_SET_IDX_VAL ((uint64_t)0x000000000000000A)
+/** @brief Defines the index for mv_vm_op_irq_resample */
+#define MV_VM_OP_IRQ_RESAMPLE_IDX_VAL ((uint64_t)0x000000000000000B)
+
 /** @brief Defines the index for mv_vp_op_create_vp */
 #define MV_VP_OP_CREATE_VP_IDX_VAL ((uint64_t)0x0000000000000000)
 /** @brief Defines the index for mv_vp_op_destroy_vp */
@@ -554,6 +638,24 @@ NODISCARD static inline int
 #define MV_VS_OP_TSC_GET_KHZ_IDX_VAL ((uint64_t)0x0000000000000027)
 /** @brief Defines the index for mv_vs_op_tsc_set_khz */
 #define MV_VS_OP_TSC_SET_KHZ_IDX_VAL ((uint64_t)0x0000000000000028)
+/** @brief Defines the index for mv_vs_op_lapic_get_all */
+#define MV_VS_OP_LAPIC_GET_ALL_IDX_VAL ((uint64_t)0x0000000000000029)
+/** @brief Defines the index for mv_vs_op_lapic_set_all */
+#define MV_VS_OP_LAPIC_SET_ALL_IDX_VAL ((uint64_t)0x000000000000002A)
+/** @brief Defines the index for mv_vs_op_tsc_get_offset */
+#define MV_VS_OP_TSC_GET_OFFSET_IDX_VAL ((uint64_t)0x000000000000002B)
+/** @brief Defines the index for mv_vs_op_tsc_set_offset */
+#define MV_VS_OP_TSC_SET_OFFSET_IDX_VAL ((uint64_t)0x000000000000002C)
+/** @brief Defines the index for mv_vs_op_kvmclock_ctrl */
+#define MV_VS_OP_KVMCLOCK_CTRL_IDX_VAL ((uint64_t)0x000000000000002D)
+/** @brief Defines the index for mv_vs_op_clr_exit_page_gpa */
+#define MV_VS_OP_CLR_EXIT_PAGE_GPA_IDX_VAL ((uint64_t)0x000000000000002E)
+/** @brief Defines the index for mv_vs_op_set_exit_page_gpa */
+#define MV_VS_OP_SET_EXIT_PAGE_GPA_IDX_VAL ((uint64_t)0x000000000000002F)
+/** @brief Defines the index for mv_vs_op_state_get_all */
+#define MV_VS_OP_STATE_GET_ALL_IDX_VAL ((uint64_t)0x0000000000000030)
+/** @brief Defines the index for mv_vs_op_state_set_all */
+#define MV_VS_OP_STATE_SET_ALL_IDX_VAL ((uint64_t)0x0000000000000031)
 
 #ifdef __cplusplus
 }
@@ -138,6 +138,67 @@ namespace hypercall
     /// @brief Indicates the map is mapped as WP
     constexpr auto MV_MAP_FLAG_WRITE_PROTECTED{0x8000000000000000_u64};
 
+    // -------------------------------------------------------------------------
+    // IO Permission Types
+    // -------------------------------------------------------------------------
+
+    /// @brief Indicates accesses to the ports are returned to the root VM
+    constexpr auto MV_IO_PERM_EXIT{0x0000000000000000_u64};
+    /// @brief Indicates accesses to the ports are given to the hardware
+    constexpr auto MV_IO_PERM_PASSTHROUGH{0x0000000000000001_u64};
+    /// @brief Indicates accesses to the ports are handled by MicroV
+    constexpr auto MV_IO_PERM_EMULATE{0x0000000000000002_u64};
+    /// @brief Defines where the number of ports is stored in REG2
+    constexpr auto MV_IO_PERM_NUM_PORTS_SHIFT{32_u64};
+
+    // -------------------------------------------------------------------------
+    // Pause Exiting
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the default max number of cycles between PAUSEs of a loop
+    constexpr auto MV_PAUSE_EXITING_DEFAULT_GAP{0x0000000000000080_u64};
+    /// @brief Defines the default number of cycles a VS can spin before yielding
+    constexpr auto MV_PAUSE_EXITING_DEFAULT_WINDOW{0x0000000000001000_u64};
+    /// @brief Defines the largest gap/window supported by mv_vm_op_pause_exiting
+    constexpr auto MV_PAUSE_EXITING_MAX{0x00000000FFFFFFFF_u64};
+
+    // -------------------------------------------------------------------------
+    // Statistics
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the VMExit statistics of a VS (see mv_debug_op_stats_get)
+    constexpr auto MV_STATS_TYPE_VS_EXITS{0x0000000000000000_u64};
+    /// @brief Defines the hypercall statistics of a VS (see mv_debug_op_stats_get)
+    constexpr auto MV_STATS_TYPE_VS_HYPERCALLS{0x0000000000000001_u64};
+    /// @brief Defines the VMExit statistics of a PP (see mv_debug_op_stats_get)
+    constexpr auto MV_STATS_TYPE_PP_EXITS{0x0000000000000002_u64};
+    /// @brief Defines the hypercall statistics of a PP (see mv_debug_op_stats_get)
+    constexpr auto MV_STATS_TYPE_PP_HYPERCALLS{0x0000000000000003_u64};
+    /// @brief Defines the halt-polling statistics of a VS (see mv_debug_op_stats_get)
+    constexpr auto MV_STATS_TYPE_VS_HALT_POLLS{0x0000000000000004_u64};
+    /// @brief Defines the extended state statistics of a VS (see mv_debug_op_stats_get)
+    constexpr auto MV_STATS_TYPE_VS_FPU{0x0000000000000005_u64};
+    /// @brief Defines the first exit reason that is not stored at slot == reason
+    constexpr auto MV_STATS_EXIT_HIGH_REASON{0x0000000000000400_u64};
+    /// @brief Defines the slot MV_STATS_EXIT_HIGH_REASON is stored at
+    constexpr auto MV_STATS_EXIT_HIGH_SLOT{0x0000000000000100_u64};
+    /// @brief Defines where the opcode is stored in a MicroV hypercall's slot
+    constexpr auto MV_STATS_HYPERCALL_OPCODE_SHIFT{6_u64};
+    /// @brief Defines the slot of a HLT that was woken up while polling
+    constexpr auto MV_STATS_HALT_POLL_SLOT_HIT{0x0000000000000000_u64};
+    /// @brief Defines the slot of a HLT that was handed to the root VM
+    constexpr auto MV_STATS_HALT_POLL_SLOT_MISS{0x0000000000000001_u64};
+    /// @brief Defines the slot that counts the times the poll window grew
+    constexpr auto MV_STATS_HALT_POLL_SLOT_GROW{0x0000000000000002_u64};
+    /// @brief Defines the slot that counts the times the poll window shrank
+    constexpr auto MV_STATS_HALT_POLL_SLOT_SHRINK{0x0000000000000003_u64};
+    /// @brief Defines the slot of a save of the extended state
+    constexpr auto MV_STATS_FPU_SLOT_SAVE{0x0000000000000000_u64};
+    /// @brief Defines the slot of a restore of the extended state
+    constexpr auto MV_STATS_FPU_SLOT_RESTORE{0x0000000000000001_u64};
+    /// @brief Defines the slot that counts the times the VS was set active
+    constexpr auto MV_STATS_FPU_SLOT_SWITCH{0x0000000000000002_u64};
+
     // -------------------------------------------------------------------------
     // Special IDs
     // -------------------------------------------------------------------------
@@ -401,6 +462,8 @@ namespace hypercall
 
     /// @brief Defines the index for mv_debug_op_out
     constexpr auto MV_DEBUG_OP_OUT_IDX_VAL{0x0000000000000000_u64};
+    /// @brief Defines the index for mv_debug_op_stats_get
+    constexpr auto MV_DEBUG_OP_STATS_GET_IDX_VAL{0x0000000000000001_u64};
 
     /// @brief Defines the index for mv_pp_op_ppid
     constexpr auto MV_PP_OP_PPID_IDX_VAL{0x0000000000000000_u64};
@@ -450,6 +513,10 @@ namespace hypercall
     constexpr auto MV_PP_OP_TSC_GET_KHZ_IDX_VAL{0x0000000000000016_u64};
     /// @brief Defines the index for mv_pp_op_tsc_set_khz
     constexpr auto MV_PP_OP_TSC_SET_KHZ_IDX_VAL{0x0000000000000017_u64};
+    /// @brief Defines the index for mv_pp_op_clr_trace_gpa
+    constexpr auto MV_PP_OP_CLR_TRACE_GPA_IDX_VAL{0x0000000000000018_u64};
+    /// @brief Defines the index for mv_pp_op_set_trace_gpa
+    constexpr auto MV_PP_OP_SET_TRACE_GPA_IDX_VAL{0x0000000000000019_u64};
 
     /// @brief Defines the index for mv_vm_op_create_vm
     constexpr auto MV_VM_OP_CREATE_VM_IDX_VAL{0x0000000000000000_u64};
@@ -461,6 +528,20 @@ namespace hypercall
     constexpr auto MV_VM_OP_MMIO_MAP_IDX_VAL{0x0000000000000003_u64};
     /// @brief Defines the index for mv_vm_op_mmio_unmap
     constexpr auto MV_VM_OP_MMIO_UNMAP_IDX_VAL{0x0000000000000004_u64};
+    /// @brief Defines the index for mv_vm_op_irqchip_create
+    constexpr auto MV_VM_OP_IRQCHIP_CREATE_IDX_VAL{0x0000000000000005_u64};
+    /// @brief Defines the index for mv_vm_op_irq_line
+    constexpr auto MV_VM_OP_IRQ_LINE_IDX_VAL{0x0000000000000006_u64};
+    /// @brief Defines the index for mv_vm_op_io_permission
+    constexpr auto MV_VM_OP_IO_PERMISSION_IDX_VAL{0x0000000000000007_u64};
+    /// @brief Defines the index for mv_vm_op_pause_exiting
+    constexpr auto MV_VM_OP_PAUSE_EXITING_IDX_VAL{0x0000000000000008_u64};
+    /// @brief Defines the index for mv_vm_op_clock_get
+    constexpr auto MV_VM_OP_CLOCK_GET_IDX_VAL{0x0000000000000009_u64};
+    /// @brief Defines the index for mv_vm_op_clock_set
+    constexpr auto MV_VM_OP_CLOCK_SET_IDX_VAL{0x000000000000000A_u64};
+    /// @brief Defines the index for mv_vm_op_irq_resample
+    constexpr auto MV_VM_OP_IRQ_RESAMPLE_IDX_VAL{0x000000000000000B_u64};
 
     /// @brief Defines the index for mv_vp_op_create_vp
     constexpr auto MV_VP_OP_CREATE_VP_IDX_VAL{0x0000000000000000_u64};
@@ -541,6 +622,24 @@ namespace hypercall
     constexpr auto MV_VS_OP_TSC_GET_KHZ_IDX_VAL{0x0000000000000027_u64};
     /// @brief Defines the index for mv_vs_op_tsc_set_khz
     constexpr auto MV_VS_OP_TSC_SET_KHZ_IDX_VAL{0x0000000000000028_u64};
+    /// @brief Defines the index for mv_vs_op_lapic_get_all
+    constexpr auto MV_VS_OP_LAPIC_GET_ALL_IDX_VAL{0x0000000000000029_u64};
+    /// @brief Defines the index for mv_vs_op_lapic_set_all
+    constexpr auto MV_VS_OP_LAPIC_SET_ALL_IDX_VAL{0x000000000000002A_u64};
+    /// @brief Defines the index for mv_vs_op_tsc_get_offset
+    constexpr auto MV_VS_OP_TSC_GET_OFFSET_IDX_VAL{0x000000000000002B_u64};
+    /// @brief Defines the index for mv_vs_op_tsc_set_offset
+    constexpr auto MV_VS_OP_TSC_SET_OFFSET_IDX_VAL{0x000000000000002C_u64};
+    /// @brief Defines the index for mv_vs_op_kvmclock_ctrl
+    constexpr auto MV_VS_OP_KVMCLOCK_CTRL_IDX_VAL{0x000000000000002D_u64};
+    /// @brief Defines the index for mv_vs_op_clr_exit_page_gpa
+    constexpr auto MV_VS_OP_CLR_EXIT_PAGE_GPA_IDX_VAL{0x000000000000002E_u64};
+    /// @brief Defines the index for mv_vs_op_set_exit_page_gpa
+    constexpr auto MV_VS_OP_SET_EXIT_PAGE_GPA_IDX_VAL{0x000000000000002F_u64};
+    /// @brief Defines the index for mv_vs_op_state_get_all
+    constexpr auto MV_VS_OP_STATE_GET_ALL_IDX_VAL{0x0000000000000030_u64};
+    /// @brief Defines the index for mv_vs_op_state_set_all
+    constexpr auto MV_VS_OP_STATE_SET_ALL_IDX_VAL{0x0000000000000031_u64};
 }
 
 #endif
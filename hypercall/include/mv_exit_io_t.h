@@ -42,6 +42,11 @@ extern "C"
 /** @brief The mv_exit_io_t defines an output access */
 #define MV_EXIT_IO_OUT ((uint64_t)0x0000000000000001)
 
+/** @brief defines the size of the reserved field in mv_exit_io_t */
+#define MV_EXIT_IO_RESERVED_SIZE ((uint64_t)7)
+/** @brief defines the max number of bytes a string access can transfer */
+#define MV_EXIT_IO_MAX_BUF_SIZE ((uint64_t)3544)
+
     /**
      * <!-- description -->
      *   @brief See mv_vs_op_run for more details
@@ -52,12 +57,16 @@ extern "C"
         uint64_t addr;
         /** @brief stores the data to read/write */
         uint64_t data;
-        /** @brief stores the number of repetitions to make */
+        /** @brief stores the number of string elements in buf (0 if not a string access) */
         uint64_t reps;
         /** @brief stores MV_EXIT_IO flags */
         uint64_t type;
         /** @brief stores defines the bit size of the dst */
         enum mv_bit_size_t size;
+        /** @brief REVI */
+        uint8_t reserved[MV_EXIT_IO_RESERVED_SIZE];
+        /** @brief stores the elements of a string access (INS/OUTS) */
+        uint8_t buf[MV_EXIT_IO_MAX_BUF_SIZE];
     };
 
 #pragma pack(pop)
@@ -27,6 +27,7 @@
 
 #include <mv_bit_size_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/safe_integral.hpp>
 
@@ -39,6 +40,11 @@ namespace hypercall
     /// @brief The mv_exit_io_t defines an output access
     constexpr auto MV_EXIT_IO_OUT{0x0000000000000001_u64};
 
+    /// @brief defines the size of the reserved field in mv_exit_io_t
+    constexpr auto MV_EXIT_IO_RESERVED_SIZE{7_u64};
+    /// @brief defines the max number of bytes a string access can transfer
+    constexpr auto MV_EXIT_IO_MAX_BUF_SIZE{3544_u64};
+
     /// <!-- description -->
     ///   @brief See mv_vs_op_run for more details
     ///
@@ -48,12 +54,16 @@ namespace hypercall
         bsl::uint64 addr;
         /// @brief stores the data to read/write
         bsl::uint64 data;
-        /// @brief stores the number of repetitions to make
+        /// @brief stores the number of string elements in buf (0 if not a string access)
         bsl::uint64 reps;
         /// @brief stores MV_EXIT_IO flags
         bsl::uint64 type;
         /// @brief stores defines the bit size of the dst
         mv_bit_size_t size;
+        /// @brief REVI
+        bsl::array<bsl::uint8, MV_EXIT_IO_RESERVED_SIZE.get()> reserved;
+        /// @brief stores the elements of a string access (INS/OUTS)
+        bsl::array<bsl::uint8, MV_EXIT_IO_MAX_BUF_SIZE.get()> buf;
     };
 }
 
@@ -27,6 +27,7 @@
 #ifndef MV_EXIT_MMIO_T_HPP
 #define MV_EXIT_MMIO_T_HPP
 
+#include <mv_bit_size_t.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -53,6 +54,10 @@ extern "C"
         uint64_t gpa;
         /** @brief stores the MV_EXIT_MMIO flags */
         uint64_t flags;
+        /** @brief stores the data to read/write */
+        uint64_t data;
+        /** @brief stores defines the bit size of the access */
+        enum mv_bit_size_t size;
     };
 
 #pragma pack(pop)
@@ -25,6 +25,8 @@
 #ifndef MV_EXIT_MMIO_T_HPP
 #define MV_EXIT_MMIO_T_HPP
 
+#include <mv_bit_size_t.hpp>
+
 #include <bsl/convert.hpp>
 #include <bsl/safe_integral.hpp>
 
@@ -48,6 +50,10 @@ namespace hypercall
         bsl::uint64 gpa;
         /// @brief stores the MV_EXIT_MMIO flags
         bsl::uint64 flags;
+        /// @brief stores the data to read/write
+        bsl::uint64 data;
+        /// @brief stores defines the bit size of the access
+        mv_bit_size_t size;
     };
 }
 
@@ -0,0 +1,97 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MV_EXIT_PAGE_IO_T_H
+#define MV_EXIT_PAGE_IO_T_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief mv_exit_page_io_t.exit_reason for an IO access (KVM_EXIT_IO) */
+#define MV_EXIT_PAGE_REASON_IO ((uint32_t)0x00000002)
+/** @brief mv_exit_page_io_t.direction for an IN access */
+#define MV_EXIT_PAGE_IO_IN ((uint8_t)0x00)
+/** @brief mv_exit_page_io_t.direction for an OUT access */
+#define MV_EXIT_PAGE_IO_OUT ((uint8_t)0x01)
+/** @brief the offset of mv_exit_page_io_t.data8 in the exit page */
+#define MV_EXIT_PAGE_IO_DATA8_OFFSET ((uint64_t)0x30)
+/** @brief the offset of mv_exit_page_io_t.data16 in the exit page */
+#define MV_EXIT_PAGE_IO_DATA16_OFFSET ((uint64_t)0x31)
+/** @brief the offset of mv_exit_page_io_t.data32 in the exit page */
+#define MV_EXIT_PAGE_IO_DATA32_OFFSET ((uint64_t)0x33)
+
+    /**
+     * <!-- description -->
+     *   @brief See mv_vs_op_set_exit_page_gpa for more details. Describes
+     *     an IO access written to a VS's exit page. The layout matches
+     *     the start of the shim's kvm_run, and the reserved fields belong
+     *     to software and are never written by MicroV.
+     */
+    struct mv_exit_page_io_t
+    {
+        /** @brief reserved (kvm_run.request_interrupt_window and friends) */
+        uint64_t reserved0;
+        /** @brief stores MV_EXIT_PAGE_REASON_IO */
+        uint32_t exit_reason;
+        /** @brief reserved (kvm_run.ready_for_interrupt_injection and friends) */
+        uint32_t reserved1;
+        /** @brief reserved (kvm_run.cr8) */
+        uint64_t reserved2;
+        /** @brief reserved (kvm_run.apic_base) */
+        uint64_t reserved3;
+
+        /** @brief stores MV_EXIT_PAGE_IO_IN or MV_EXIT_PAGE_IO_OUT */
+        uint8_t direction;
+        /** @brief stores the size of the access in bytes */
+        uint8_t size;
+        /** @brief stores the port of the access */
+        uint16_t port;
+        /** @brief stores the number of elements (always 1) */
+        uint32_t count;
+        /** @brief stores the offset of data8, data16 or data32 */
+        uint64_t data_offset;
+
+        /** @brief stores the data when the size is 1 byte */
+        uint8_t data8;
+        /** @brief stores the data when the size is 2 bytes */
+        uint16_t data16;
+        /** @brief stores the data when the size is 4 bytes */
+        uint32_t data32;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MV_EXIT_PAGE_IO_T_HPP
+#define MV_EXIT_PAGE_IO_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace hypercall
+{
+    /// @brief mv_exit_page_io_t.exit_reason for an IO access (KVM_EXIT_IO)
+    constexpr auto MV_EXIT_PAGE_REASON_IO{0x00000002_u32};
+    /// @brief mv_exit_page_io_t.direction for an IN access
+    constexpr auto MV_EXIT_PAGE_IO_IN{0x00_u8};
+    /// @brief mv_exit_page_io_t.direction for an OUT access
+    constexpr auto MV_EXIT_PAGE_IO_OUT{0x01_u8};
+    /// @brief the offset of mv_exit_page_io_t.data8 in the exit page
+    constexpr auto MV_EXIT_PAGE_IO_DATA8_OFFSET{0x30_u64};
+    /// @brief the offset of mv_exit_page_io_t.data16 in the exit page
+    constexpr auto MV_EXIT_PAGE_IO_DATA16_OFFSET{0x31_u64};
+    /// @brief the offset of mv_exit_page_io_t.data32 in the exit page
+    constexpr auto MV_EXIT_PAGE_IO_DATA32_OFFSET{0x33_u64};
+
+    /// <!-- description -->
+    ///   @brief See mv_vs_op_set_exit_page_gpa for more details. Describes
+    ///     an IO access written to a VS's exit page. The layout matches
+    ///     the start of the shim's kvm_run, and the reserved fields belong
+    ///     to software and are never written by MicroV.
+    ///
+    struct mv_exit_page_io_t final
+    {
+        /// @brief reserved (kvm_run.request_interrupt_window and friends)
+        bsl::uint64 reserved0;
+        /// @brief stores MV_EXIT_PAGE_REASON_IO
+        bsl::uint32 exit_reason;
+        /// @brief reserved (kvm_run.ready_for_interrupt_injection and friends)
+        bsl::uint32 reserved1;
+        /// @brief reserved (kvm_run.cr8)
+        bsl::uint64 reserved2;
+        /// @brief reserved (kvm_run.apic_base)
+        bsl::uint64 reserved3;
+
+        /// @brief stores MV_EXIT_PAGE_IO_IN or MV_EXIT_PAGE_IO_OUT
+        bsl::uint8 direction;
+        /// @brief stores the size of the access in bytes
+        bsl::uint8 size;
+        /// @brief stores the port of the access
+        bsl::uint16 port;
+        /// @brief stores the number of elements (always 1)
+        bsl::uint32 count;
+        /// @brief stores the offset of data8, data16 or data32
+        bsl::uint64 data_offset;
+
+        /// @brief stores the data when the size is 1 byte
+        bsl::uint8 data8;
+        /// @brief stores the data when the size is 2 bytes
+        bsl::uint16 data16;
+        /// @brief stores the data when the size is 4 bytes
+        bsl::uint32 data32;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
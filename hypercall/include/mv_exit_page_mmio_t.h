@@ -0,0 +1,78 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MV_EXIT_PAGE_MMIO_T_H
+#define MV_EXIT_PAGE_MMIO_T_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief mv_exit_page_mmio_t.exit_reason for an MMIO access (KVM_EXIT_MMIO) */
+#define MV_EXIT_PAGE_REASON_MMIO ((uint32_t)0x00000006)
+
+    /**
+     * <!-- description -->
+     *   @brief See mv_vs_op_set_exit_page_gpa for more details. Describes
+     *     an MMIO access written to a VS's exit page. The layout matches
+     *     the start of the shim's kvm_run, and the reserved fields belong
+     *     to software and are never written by MicroV.
+     */
+    struct mv_exit_page_mmio_t
+    {
+        /** @brief reserved (kvm_run.request_interrupt_window and friends) */
+        uint64_t reserved0;
+        /** @brief stores MV_EXIT_PAGE_REASON_MMIO */
+        uint32_t exit_reason;
+        /** @brief reserved (kvm_run.ready_for_interrupt_injection and friends) */
+        uint32_t reserved1;
+        /** @brief reserved (kvm_run.cr8) */
+        uint64_t reserved2;
+        /** @brief reserved (kvm_run.apic_base) */
+        uint64_t reserved3;
+
+        /** @brief stores the GPA of the MMIO access */
+        uint64_t phys_addr;
+        /** @brief stores the data to read/write (zero extended) */
+        uint64_t data;
+        /** @brief stores the size of the access in bytes */
+        uint32_t len;
+        /** @brief stores 1 for a write and 0 for a read */
+        uint8_t is_write;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -62,6 +62,10 @@ enum mv_exit_reason_t
         mv_exit_reason_t_interrupt = 6,
         /** @brief an nmi event has occurred */
         mv_exit_reason_t_nmi = 7,
+        /** @brief the VS was spinning and should yield to a sibling VS */
+        mv_exit_reason_t_yield = 8,
+        /** @brief an IO/MMIO exit was written to the VS's exit page */
+        mv_exit_reason_t_exit_page = 9,
     };
 
     /**
@@ -136,6 +140,10 @@ enum mv_exit_reason_t
 #define EXIT_REASON_INTERRUPT ((int32_t)mv_exit_reason_t_interrupt)
 /** @brief integer version of mv_exit_reason_t_nmi */
 #define EXIT_REASON_NMI ((int32_t)mv_exit_reason_t_nmi)
+/** @brief integer version of mv_exit_reason_t_yield */
+#define EXIT_REASON_YIELD ((int32_t)mv_exit_reason_t_yield)
+/** @brief integer version of mv_exit_reason_t_exit_page */
+#define EXIT_REASON_EXIT_PAGE ((int32_t)mv_exit_reason_t_exit_page)
 
 #ifdef __cplusplus
 }
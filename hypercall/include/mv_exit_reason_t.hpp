@@ -51,6 +51,10 @@ namespace hypercall
         mv_exit_reason_t_interrupt = 6,
         /// @brief an nmi event has occurred
         mv_exit_reason_t_nmi = 7,
+        /// @brief the VS was spinning and should yield to a sibling VS
+        mv_exit_reason_t_yield = 8,
+        /// @brief an IO/MMIO exit was written to the VS's exit page
+        mv_exit_reason_t_exit_page = 9,
     };
 
     /// <!-- description -->
@@ -121,6 +125,10 @@ namespace hypercall
     constexpr auto EXIT_REASON_INTERRUPT{to_i32(mv_exit_reason_t::mv_exit_reason_t_interrupt)};
     /// @brief integer version of mv_exit_reason_t_nmi
     constexpr auto EXIT_REASON_NMI{to_i32(mv_exit_reason_t::mv_exit_reason_t_nmi)};
+    /// @brief integer version of mv_exit_reason_t_yield
+    constexpr auto EXIT_REASON_YIELD{to_i32(mv_exit_reason_t::mv_exit_reason_t_yield)};
+    /// @brief integer version of mv_exit_reason_t_exit_page
+    constexpr auto EXIT_REASON_EXIT_PAGE{to_i32(mv_exit_reason_t::mv_exit_reason_t_exit_page)};
 }
 
 #endif
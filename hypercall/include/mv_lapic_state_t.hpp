@@ -0,0 +1,54 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MV_LAPIC_STATE_T_HPP
+#define MV_LAPIC_STATE_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace hypercall
+{
+    /// @brief defines the number of 32bit words in the LAPIC's register page
+    constexpr auto MV_LAPIC_NUM_REGS{256_u64};
+
+    /// <!-- description -->
+    ///   @brief See mv_vs_op_lapic_get_all for more details. Stores the
+    ///     first 1k of the xAPIC's MMIO page, which is where all of the
+    ///     architectural registers live. The register at offset "o" is
+    ///     stored in regs[o / 4].
+    ///
+    struct mv_lapic_state_t final
+    {
+        /// @brief stores the LAPIC's registers
+        bsl::array<bsl::uint32, MV_LAPIC_NUM_REGS.get()> regs;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
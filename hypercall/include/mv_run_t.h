@@ -27,6 +27,7 @@
 #ifndef MV_RUN_T
 #define MV_RUN_T
 
+#include <mv_sync_regs_t.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -36,17 +37,32 @@ extern "C"
 
 #pragma pack(push, 1)
 
-/** @brief defines the max number of entires in the MDL */
-#define MV_RUN_MAX_RESERVED ((uint64_t)0x1000)
+/** @brief defines the size of the exit field in mv_run_t */
+#define MV_RUN_EXIT_SIZE ((uint64_t)0xE00)
+/** @brief defines the size of the reserved field in mv_run_t */
+#define MV_RUN_RESERVED_SIZE ((uint64_t)0x118)
+/** @brief defines the mv_run_t.hlt_timeout_ns of a HLT that has no timeout */
+#define MV_RUN_HLT_NO_TIMEOUT ((uint64_t)0xFFFFFFFFFFFFFFFF)
 
     /**
      * <!-- description -->
-     *   @brief TODO
+     *   @brief See mv_vs_op_run for more details. Describes the layout of
+     *     the shared page while a VS is run.
      */
     struct mv_run_t
     {
-        /** @brief reserved */
-        uint8_t reserved[MV_RUN_MAX_RESERVED];
+        /** @brief stores the exit specific structure (e.g., mv_exit_io_t) */
+        uint8_t exit[MV_RUN_EXIT_SIZE];
+        /** @brief stores the registers exchanged with each mv_vs_op_run */
+        struct mv_sync_regs_t sync_regs;
+        /** @brief stores the GSIs resampled since the last mv_vs_op_run */
+        uint64_t resampled;
+        /** @brief stores the time in ns until a halted VS has to be run again */
+        uint64_t hlt_timeout_ns;
+        /** @brief stores whether a halted VS of the VM has to be run again */
+        uint64_t wakeup;
+        /** @brief REVI */
+        uint8_t reserved[MV_RUN_RESERVED_SIZE];
     };
 
 #pragma pack(pop)
@@ -25,6 +25,8 @@
 #ifndef MV_RUN_T_HPP
 #define MV_RUN_T_HPP
 
+#include <mv_sync_regs_t.hpp>
+
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/safe_integral.hpp>
@@ -33,16 +35,31 @@
 
 namespace hypercall
 {
-    /// @brief defines the max number of entires in the MDL
-    constexpr auto MV_RUN_MAX_RESERVED{0x1000_u64};
+    /// @brief defines the size of the exit field in mv_run_t
+    constexpr auto MV_RUN_EXIT_SIZE{0xE00_u64};
+    /// @brief defines the size of the reserved field in mv_run_t
+    constexpr auto MV_RUN_RESERVED_SIZE{0x118_u64};
+    /// @brief defines the mv_run_t.hlt_timeout_ns of a HLT that has no timeout
+    constexpr auto MV_RUN_HLT_NO_TIMEOUT{0xFFFFFFFFFFFFFFFF_u64};
 
     /// <!-- description -->
-    ///   @brief TODO
+    ///   @brief See mv_vs_op_run for more details. Describes the layout
+    ///     of the shared page while a VS is run.
     ///
     struct mv_run_t final
     {
-        /// @brief reserved
-        bsl::array<bsl::uint8, MV_RUN_MAX_RESERVED.get()> reserved;
+        /// @brief stores the exit specific structure (e.g., mv_exit_io_t)
+        bsl::array<bsl::uint8, MV_RUN_EXIT_SIZE.get()> exit;
+        /// @brief stores the registers exchanged with each mv_vs_op_run
+        mv_sync_regs_t sync_regs;
+        /// @brief stores the GSIs resampled since the last mv_vs_op_run
+        bsl::uint64 resampled;
+        /// @brief stores the time in ns until a halted VS has to be run again
+        bsl::uint64 hlt_timeout_ns;
+        /// @brief stores whether a halted VS of the VM has to be run again
+        bsl::uint64 wakeup;
+        /// @brief REVI
+        bsl::array<bsl::uint8, MV_RUN_RESERVED_SIZE.get()> reserved;
     };
 }
 
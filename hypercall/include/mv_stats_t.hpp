@@ -0,0 +1,65 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MV_STATS_T_HPP
+#define MV_STATS_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace hypercall
+{
+    /// @brief defines the number of log2 buckets in an mv_stats_t histogram
+    constexpr auto MV_STATS_NUM_BUCKETS{62_u64};
+    /// @brief defines the number of slots in an mv_stats_t
+    constexpr auto MV_STATS_NUM_SLOTS{448_u64};
+
+    /// <!-- description -->
+    ///   @brief See mv_debug_op_stats_get for more details. Stores the
+    ///     statistics of one type of event (VMExits or hypercalls) for a
+    ///     VS or a PP. Every event is counted in "count", adds the TSC
+    ///     cycles MicroV spent handling it to "cycles", and is counted in
+    ///     hist[log2(cycles)] (the last bucket also counts everything
+    ///     longer than that). If the event has a slot (see
+    ///     mv_debug_op_stats_get), it is also counted in slots[slot].
+    ///
+    struct mv_stats_t final
+    {
+        /// @brief stores the total number of events
+        bsl::uint64 count;
+        /// @brief stores the total number of cycles spent handling events
+        bsl::uint64 cycles;
+        /// @brief stores the log2 histogram of cycles spent per event
+        bsl::array<bsl::uint64, MV_STATS_NUM_BUCKETS.get()> hist;
+        /// @brief stores the number of events per slot
+        bsl::array<bsl::uint64, MV_STATS_NUM_SLOTS.get()> slots;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
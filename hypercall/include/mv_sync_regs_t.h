@@ -0,0 +1,119 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MV_SYNC_REGS_T_H
+#define MV_SYNC_REGS_T_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines the general purpose registers, RIP and RFLAGS */
+#define MV_SYNC_REGS_GPRS ((uint64_t)0x0000000000000001)
+/** @brief defines the control registers and EFER */
+#define MV_SYNC_REGS_CRS ((uint64_t)0x0000000000000002)
+/** @brief defines all of the register groups an mv_sync_regs_t supports */
+#define MV_SYNC_REGS_ALL ((uint64_t)0x0000000000000003)
+
+    /**
+     * <!-- description -->
+     *   @brief See mv_vs_op_run for more details. Stores the registers
+     *     of a VS that are exchanged with every mv_vs_op_run. Each
+     *     MV_SYNC_REGS_ group in "valid" is filled in by MicroV when
+     *     mv_vs_op_run returns, and each group in "dirty" is written to
+     *     the VS by MicroV before it runs, after which MicroV clears
+     *     "dirty".
+     */
+    struct mv_sync_regs_t
+    {
+        /** @brief stores the MV_SYNC_REGS_ groups to fill in on exit */
+        uint64_t valid;
+        /** @brief stores the MV_SYNC_REGS_ groups to write on entry */
+        uint64_t dirty;
+
+        /** @brief stores the value of rax (MV_SYNC_REGS_GPRS) */
+        uint64_t rax;
+        /** @brief stores the value of rbx (MV_SYNC_REGS_GPRS) */
+        uint64_t rbx;
+        /** @brief stores the value of rcx (MV_SYNC_REGS_GPRS) */
+        uint64_t rcx;
+        /** @brief stores the value of rdx (MV_SYNC_REGS_GPRS) */
+        uint64_t rdx;
+        /** @brief stores the value of rsi (MV_SYNC_REGS_GPRS) */
+        uint64_t rsi;
+        /** @brief stores the value of rdi (MV_SYNC_REGS_GPRS) */
+        uint64_t rdi;
+        /** @brief stores the value of rsp (MV_SYNC_REGS_GPRS) */
+        uint64_t rsp;
+        /** @brief stores the value of rbp (MV_SYNC_REGS_GPRS) */
+        uint64_t rbp;
+        /** @brief stores the value of r8 (MV_SYNC_REGS_GPRS) */
+        uint64_t r8;
+        /** @brief stores the value of r9 (MV_SYNC_REGS_GPRS) */
+        uint64_t r9;
+        /** @brief stores the value of r10 (MV_SYNC_REGS_GPRS) */
+        uint64_t r10;
+        /** @brief stores the value of r11 (MV_SYNC_REGS_GPRS) */
+        uint64_t r11;
+        /** @brief stores the value of r12 (MV_SYNC_REGS_GPRS) */
+        uint64_t r12;
+        /** @brief stores the value of r13 (MV_SYNC_REGS_GPRS) */
+        uint64_t r13;
+        /** @brief stores the value of r14 (MV_SYNC_REGS_GPRS) */
+        uint64_t r14;
+        /** @brief stores the value of r15 (MV_SYNC_REGS_GPRS) */
+        uint64_t r15;
+        /** @brief stores the value of rip (MV_SYNC_REGS_GPRS) */
+        uint64_t rip;
+        /** @brief stores the value of rflags (MV_SYNC_REGS_GPRS) */
+        uint64_t rflags;
+
+        /** @brief stores the value of cr0 (MV_SYNC_REGS_CRS) */
+        uint64_t cr0;
+        /** @brief stores the value of cr2 (MV_SYNC_REGS_CRS) */
+        uint64_t cr2;
+        /** @brief stores the value of cr3 (MV_SYNC_REGS_CRS) */
+        uint64_t cr3;
+        /** @brief stores the value of cr4 (MV_SYNC_REGS_CRS) */
+        uint64_t cr4;
+        /** @brief stores the value of cr8 (MV_SYNC_REGS_CRS) */
+        uint64_t cr8;
+        /** @brief stores the value of the EFER MSR (MV_SYNC_REGS_CRS) */
+        uint64_t efer;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
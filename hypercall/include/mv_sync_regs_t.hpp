@@ -0,0 +1,111 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MV_SYNC_REGS_T_HPP
+#define MV_SYNC_REGS_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace hypercall
+{
+    /// @brief defines the general purpose registers, RIP and RFLAGS
+    constexpr auto MV_SYNC_REGS_GPRS{0x0000000000000001_u64};
+    /// @brief defines the control registers and EFER
+    constexpr auto MV_SYNC_REGS_CRS{0x0000000000000002_u64};
+    /// @brief defines all of the register groups an mv_sync_regs_t supports
+    constexpr auto MV_SYNC_REGS_ALL{0x0000000000000003_u64};
+
+    /// <!-- description -->
+    ///   @brief See mv_vs_op_run for more details. Stores the registers
+    ///     of a VS that are exchanged with every mv_vs_op_run. Each
+    ///     MV_SYNC_REGS_ group in "valid" is filled in by MicroV when
+    ///     mv_vs_op_run returns, and each group in "dirty" is written to
+    ///     the VS by MicroV before it runs, after which MicroV clears
+    ///     "dirty".
+    ///
+    struct mv_sync_regs_t final
+    {
+        /// @brief stores the MV_SYNC_REGS_ groups to fill in on exit
+        bsl::uint64 valid;
+        /// @brief stores the MV_SYNC_REGS_ groups to write on entry
+        bsl::uint64 dirty;
+
+        /// @brief stores the value of rax (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rax;
+        /// @brief stores the value of rbx (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rbx;
+        /// @brief stores the value of rcx (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rcx;
+        /// @brief stores the value of rdx (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rdx;
+        /// @brief stores the value of rsi (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rsi;
+        /// @brief stores the value of rdi (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rdi;
+        /// @brief stores the value of rsp (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rsp;
+        /// @brief stores the value of rbp (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rbp;
+        /// @brief stores the value of r8 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r8;
+        /// @brief stores the value of r9 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r9;
+        /// @brief stores the value of r10 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r10;
+        /// @brief stores the value of r11 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r11;
+        /// @brief stores the value of r12 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r12;
+        /// @brief stores the value of r13 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r13;
+        /// @brief stores the value of r14 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r14;
+        /// @brief stores the value of r15 (MV_SYNC_REGS_GPRS)
+        bsl::uint64 r15;
+        /// @brief stores the value of rip (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rip;
+        /// @brief stores the value of rflags (MV_SYNC_REGS_GPRS)
+        bsl::uint64 rflags;
+
+        /// @brief stores the value of cr0 (MV_SYNC_REGS_CRS)
+        bsl::uint64 cr0;
+        /// @brief stores the value of cr2 (MV_SYNC_REGS_CRS)
+        bsl::uint64 cr2;
+        /// @brief stores the value of cr3 (MV_SYNC_REGS_CRS)
+        bsl::uint64 cr3;
+        /// @brief stores the value of cr4 (MV_SYNC_REGS_CRS)
+        bsl::uint64 cr4;
+        /// @brief stores the value of cr8 (MV_SYNC_REGS_CRS)
+        bsl::uint64 cr8;
+        /// @brief stores the value of the EFER MSR (MV_SYNC_REGS_CRS)
+        bsl::uint64 efer;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
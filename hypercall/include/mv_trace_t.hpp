@@ -0,0 +1,94 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MV_TRACE_T_HPP
+#define MV_TRACE_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace hypercall
+{
+    /// @brief defines the number of entries in an mv_trace_t
+    constexpr auto MV_TRACE_NUM_ENTRIES{127_u64};
+
+    /// @brief defines a VMExit entry (reason is the exit reason)
+    constexpr auto MV_TRACE_TYPE_EXIT{0x0000_u16};
+    /// @brief defines a hypercall entry (info is the hypercall's RAX)
+    constexpr auto MV_TRACE_TYPE_HYPERCALL{0x0001_u16};
+    /// @brief defines an event injection entry (info is the injected event)
+    constexpr auto MV_TRACE_TYPE_INJECT{0x0002_u16};
+
+    /// <!-- description -->
+    ///   @brief See mv_pp_op_set_trace_gpa for more details. Stores a
+    ///     single trace event.
+    ///
+    struct mv_trace_entry_t final
+    {
+        /// @brief stores the TSC of the PP when the event occurred
+        bsl::uint64 tsc;
+        /// @brief stores the RIP of the VS when the event occurred
+        bsl::uint64 rip;
+        /// @brief stores the exit qualification, RAX or injected event
+        bsl::uint64 info;
+        /// @brief stores the MV_TRACE_TYPE_ of the event
+        bsl::uint16 type;
+        /// @brief stores the ID of the VS the event occurred on
+        bsl::uint16 vsid;
+        /// @brief stores the ID of the PP the event occurred on
+        bsl::uint16 ppid;
+        /// @brief stores the (truncated) exit reason of the event
+        bsl::uint16 reason;
+    };
+
+    /// <!-- description -->
+    ///   @brief See mv_pp_op_set_trace_gpa for more details. Stores the
+    ///     single-producer, single-consumer trace ring of a PP. MicroV
+    ///     is the only producer and only writes "head" and "lost", while
+    ///     the root VM is the only consumer and only writes "tail" and
+    ///     "lost_seen". head and tail are free running, which means the
+    ///     ring holds head - tail entries and entry N is stored at
+    ///     entries[N % MV_TRACE_NUM_ENTRIES].
+    ///
+    struct mv_trace_t final
+    {
+        /// @brief stores the number of entries MicroV has written
+        bsl::uint64 head;
+        /// @brief stores the number of entries the root VM has read
+        bsl::uint64 tail;
+        /// @brief stores the number of entries dropped on a full ring
+        bsl::uint64 lost;
+        /// @brief stores the value of "lost" the root VM last reported
+        bsl::uint64 lost_seen;
+        /// @brief stores the ring itself
+        bsl::array<mv_trace_entry_t, MV_TRACE_NUM_ENTRIES.get()> entries;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
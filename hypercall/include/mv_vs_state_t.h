@@ -0,0 +1,102 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MV_VS_STATE_T_H
+#define MV_VS_STATE_T_H
+
+#include <mv_rdl_entry_t.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines the version of the state mv_vs_op_state_get_all returns */
+#define MV_VS_STATE_VERSION ((uint32_t)1)
+
+/** @brief defines the chunk that stores an mv_vs_state_t */
+#define MV_VS_STATE_CHUNK_CPU ((uint64_t)0)
+/** @brief defines the chunk that stores an mv_fpu_state_t */
+#define MV_VS_STATE_CHUNK_FPU ((uint64_t)1)
+/** @brief defines the chunk that stores an mv_lapic_state_t */
+#define MV_VS_STATE_CHUNK_LAPIC ((uint64_t)2)
+/** @brief defines the total number of chunks in a VS's state */
+#define MV_VS_STATE_NUM_CHUNKS ((uint64_t)3)
+
+/** @brief defines the max number of registers an mv_vs_state_t can store */
+#define MV_VS_STATE_MAX_REGS ((uint64_t)80)
+/** @brief defines the max number of MSRs an mv_vs_state_t can store */
+#define MV_VS_STATE_MAX_MSRS ((uint64_t)32)
+
+    /**
+     * <!-- description -->
+     *   @brief See mv_vs_op_state_get_all for more details. Stores
+     *     MV_VS_STATE_CHUNK_CPU, which is everything in a VS's state
+     *     that is not its FPU or its LAPIC. The registers and MSRs are
+     *     stored as {reg, val} pairs so that a newer MicroV can restore
+     *     state saved by an older one.
+     */
+    struct mv_vs_state_t
+    {
+        /** @brief stores MV_VS_STATE_VERSION */
+        uint32_t version;
+        /** @brief stores MV_VS_STATE_NUM_CHUNKS */
+        uint32_t num_chunks;
+
+        /** @brief stores the VS's mv_mp_state_t */
+        uint64_t mp_state;
+        /** @brief stores the VS's TSC offset */
+        uint64_t tsc_offset;
+        /** @brief stores the event injected on the next VMEntry */
+        uint64_t event;
+        /** @brief stores the error code of "event" (Intel only) */
+        uint64_t event_error_code;
+        /** @brief stores 1 if an ExtINT is pending, 0 otherwise */
+        uint64_t extint_pending;
+        /** @brief stores the vector of the pending ExtINT */
+        uint64_t extint_vector;
+
+        /** @brief stores the number of entries in regs */
+        uint64_t num_regs;
+        /** @brief stores the number of entries in msrs */
+        uint64_t num_msrs;
+
+        /** @brief stores the VS's registers (reg is an mv_reg_t) */
+        struct mv_rdl_entry_t regs[MV_VS_STATE_MAX_REGS];
+        /** @brief stores the VS's MSRs (reg is the MSR's index) */
+        struct mv_rdl_entry_t msrs[MV_VS_STATE_MAX_MSRS];
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
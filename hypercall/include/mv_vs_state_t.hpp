@@ -0,0 +1,96 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MV_VS_STATE_T_HPP
+#define MV_VS_STATE_T_HPP
+
+#include <mv_rdl_entry_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace hypercall
+{
+    /// @brief defines the version of the state mv_vs_op_state_get_all returns
+    constexpr auto MV_VS_STATE_VERSION{1_u32};
+
+    /// @brief defines the chunk that stores an mv_vs_state_t
+    constexpr auto MV_VS_STATE_CHUNK_CPU{0_u64};
+    /// @brief defines the chunk that stores an mv_fpu_state_t
+    constexpr auto MV_VS_STATE_CHUNK_FPU{1_u64};
+    /// @brief defines the chunk that stores an mv_lapic_state_t
+    constexpr auto MV_VS_STATE_CHUNK_LAPIC{2_u64};
+    /// @brief defines the total number of chunks in a VS's state
+    constexpr auto MV_VS_STATE_NUM_CHUNKS{3_u64};
+
+    /// @brief defines the max number of registers an mv_vs_state_t can store
+    constexpr auto MV_VS_STATE_MAX_REGS{80_u64};
+    /// @brief defines the max number of MSRs an mv_vs_state_t can store
+    constexpr auto MV_VS_STATE_MAX_MSRS{32_u64};
+
+    /// <!-- description -->
+    ///   @brief See mv_vs_op_state_get_all for more details. Stores
+    ///     MV_VS_STATE_CHUNK_CPU, which is everything in a VS's state
+    ///     that is not its FPU or its LAPIC. The registers and MSRs are
+    ///     stored as {reg, val} pairs so that a newer MicroV can restore
+    ///     state saved by an older one.
+    ///
+    struct mv_vs_state_t final
+    {
+        /// @brief stores MV_VS_STATE_VERSION
+        bsl::uint32 version;
+        /// @brief stores MV_VS_STATE_NUM_CHUNKS
+        bsl::uint32 num_chunks;
+
+        /// @brief stores the VS's mv_mp_state_t
+        bsl::uint64 mp_state;
+        /// @brief stores the VS's TSC offset
+        bsl::uint64 tsc_offset;
+        /// @brief stores the event injected on the next VMEntry
+        bsl::uint64 event;
+        /// @brief stores the error code of "event" (Intel only)
+        bsl::uint64 event_error_code;
+        /// @brief stores 1 if an ExtINT is pending, 0 otherwise
+        bsl::uint64 extint_pending;
+        /// @brief stores the vector of the pending ExtINT
+        bsl::uint64 extint_vector;
+
+        /// @brief stores the number of entries in regs
+        bsl::uint64 num_regs;
+        /// @brief stores the number of entries in msrs
+        bsl::uint64 num_msrs;
+
+        /// @brief stores the VS's registers (reg is an mv_reg_t)
+        bsl::array<mv_rdl_entry_t, MV_VS_STATE_MAX_REGS.get()> regs;
+        /// @brief stores the VS's MSRs (reg is the MSR's index)
+        bsl::array<mv_rdl_entry_t, MV_VS_STATE_MAX_MSRS.get()> msrs;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -81,8 +81,14 @@ list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_mmio_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_msr_t.h
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_msr_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_page_io_t.h
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_page_io_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_page_mmio_t.h
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_page_mmio_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_reason_t.h
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_exit_reason_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_lapic_state_t.h
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_lapic_state_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_mdl_entry_t.h
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_mdl_entry_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_mdl_t.h
@@ -95,6 +101,12 @@ list(APPEND HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_rdl_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_run_t.h
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_run_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_stats_t.h
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_stats_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_sync_regs_t.h
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_sync_regs_t.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_trace_t.h
+    ${CMAKE_CURRENT_LIST_DIR}/include/mv_trace_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_translation_t.h
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_translation_t.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/mv_types.h
@@ -115,13 +127,16 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD")
         if(WIN32)
             microv_target_source(hypercall src/windows/x64/amd/mv_debug_op_out_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_debug_op_stats_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_handle_op_close_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_handle_op_open_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_id_op_version_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_clr_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_clr_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_cpuid_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_ppid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_set_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_set_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_msr_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_tsc_get_khz_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_tsc_set_khz_impl.S ${HEADERS})
@@ -129,41 +144,61 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
             microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_destroy_vm_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_mmio_map_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_mmio_unmap_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_irqchip_create_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_irq_line_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_io_permission_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_pause_exiting_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_clock_get_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_clock_set_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_irq_resample_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vm_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vp_op_create_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vp_op_destroy_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vp_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vp_op_vpid_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_clr_exit_page_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_create_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_destroy_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_fpu_get_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_fpu_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_gla_to_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_kvmclock_ctrl_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_lapic_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_lapic_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_mp_state_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_mp_state_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_msr_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_msr_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_msr_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_msr_set_list_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_queue_interrupt_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_reg_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_reg_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_reg_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_reg_set_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_run_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_set_exit_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_state_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_state_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_tsc_get_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_tsc_get_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_tsc_set_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_tsc_set_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_vpid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_vs_op_vsid_impl.S ${HEADERS})
         else()
             microv_target_source(hypercall src/linux/x64/amd/mv_debug_op_out_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_debug_op_stats_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_handle_op_close_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_handle_op_open_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_id_op_version_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_clr_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_clr_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_cpuid_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_ppid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_set_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_set_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_msr_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_tsc_get_khz_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_pp_op_tsc_set_khz_impl.S ${HEADERS})
@@ -171,29 +206,46 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
             microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_destroy_vm_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_mmio_map_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_mmio_unmap_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_irqchip_create_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_irq_line_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_io_permission_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_pause_exiting_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_clock_get_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_clock_set_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_irq_resample_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vm_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vp_op_create_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vp_op_destroy_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vp_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vp_op_vpid_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_clr_exit_page_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_create_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_destroy_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_fpu_get_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_fpu_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_gla_to_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_kvmclock_ctrl_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_lapic_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_lapic_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_mp_state_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_mp_state_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_msr_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_msr_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_msr_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_msr_set_list_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_queue_interrupt_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_reg_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_reg_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_reg_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_reg_set_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_run_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_set_exit_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_state_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_state_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_tsc_get_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_tsc_get_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_tsc_set_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_tsc_set_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_vpid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/amd/mv_vs_op_vsid_impl.S ${HEADERS})
@@ -203,13 +255,16 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     if(HYPERVISOR_TARGET_ARCH STREQUAL "GenuineIntel")
         if(WIN32)
             microv_target_source(hypercall src/windows/x64/intel/mv_debug_op_out_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_debug_op_stats_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_handle_op_close_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_handle_op_open_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_id_op_version_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_clr_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_clr_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/amd/mv_pp_op_cpuid_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_ppid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_set_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_set_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_msr_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_tsc_get_khz_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_pp_op_tsc_set_khz_impl.S ${HEADERS})
@@ -217,41 +272,61 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
             microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_destroy_vm_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_mmio_map_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_mmio_unmap_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_irqchip_create_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_irq_line_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_io_permission_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_pause_exiting_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_clock_get_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_clock_set_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_irq_resample_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vm_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vp_op_create_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vp_op_destroy_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vp_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vp_op_vpid_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_clr_exit_page_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_create_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_destroy_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_fpu_get_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_fpu_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_gla_to_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_kvmclock_ctrl_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_lapic_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_lapic_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_mp_state_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_mp_state_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_msr_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_msr_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_msr_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_msr_set_list_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_queue_interrupt_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_reg_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_reg_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_reg_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_reg_set_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_run_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_set_exit_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_state_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_state_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_tsc_get_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_tsc_get_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_tsc_set_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_tsc_set_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_vpid_impl.S ${HEADERS})
             microv_target_source(hypercall src/windows/x64/intel/mv_vs_op_vsid_impl.S ${HEADERS})
         else()
             microv_target_source(hypercall src/linux/x64/intel/mv_debug_op_out_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_debug_op_stats_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_handle_op_close_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_handle_op_open_handle_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_id_op_version_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_clr_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_clr_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_cpuid_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_ppid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_set_shared_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_set_trace_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_msr_get_supported_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_tsc_get_khz_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_pp_op_tsc_set_khz_impl.S ${HEADERS})
@@ -259,29 +334,46 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
             microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_destroy_vm_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_mmio_map_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_mmio_unmap_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_irqchip_create_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_irq_line_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_io_permission_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_pause_exiting_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_clock_get_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_clock_set_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_irq_resample_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vm_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vp_op_create_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vp_op_destroy_vp_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vp_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vp_op_vpid_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_clr_exit_page_gpa_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_create_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_destroy_vs_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_fpu_get_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_fpu_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_gla_to_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_kvmclock_ctrl_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_lapic_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_lapic_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_mp_state_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_mp_state_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_msr_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_msr_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_msr_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_msr_set_list_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_queue_interrupt_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_reg_get_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_reg_get_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_reg_set_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_reg_set_list_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_run_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_set_exit_page_gpa_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_state_get_all_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_state_set_all_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_tsc_get_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_tsc_get_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_tsc_set_khz_impl.S ${HEADERS})
+            microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_tsc_set_offset_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_vmid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_vpid_impl.S ${HEADERS})
             microv_target_source(hypercall src/linux/x64/intel/mv_vs_op_vsid_impl.S ${HEADERS})
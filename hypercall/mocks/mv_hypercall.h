@@ -30,12 +30,14 @@
 #include <mv_cdl_t.h>
 #include <mv_constants.h>
 #include <mv_exit_io_t.h>
+#include <mv_exit_mmio_t.h>
 #include <mv_exit_reason_t.h>
 #include <mv_mp_state_t.h>
 #include <mv_rdl_t.h>
 #include <mv_reg_t.h>
 #include <mv_translation_t.h>
 #include <mv_types.h>
+#include <mv_vs_state_t.h>
 
 #ifdef __cplusplus
 #include <bsl/expects.hpp>
@@ -141,6 +143,43 @@ extern "C"
         return g_mut_mv_handle_op_close_handle;
     }
 
+    /* ---------------------------------------------------------------------- */
+    /* mv_debug_ops                                                           */
+    /* ---------------------------------------------------------------------- */
+
+    /** @brief stores the return value for mv_debug_op_stats_get */
+    extern mv_status_t g_mut_mv_debug_op_stats_get;
+
+    /**
+     * <!-- description -->
+     *   @brief Copies the statistics MicroV keeps for a VS or a PP into an
+     *     mv_stats_t in the shared page.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param id The ID of the VS or PP to query
+     *   @param type One of MV_STATS_TYPE_xxx
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_debug_op_stats_get(uint64_t const hndl, uint16_t const id, uint64_t const type) NOEXCEPT
+    {
+        (void)type;
+
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)id);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)id);
+#endif
+
+        return g_mut_mv_debug_op_stats_get;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* mv_pp_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -159,6 +198,10 @@ extern "C"
     extern mv_status_t g_mut_mv_pp_op_tsc_get_khz;
     /** @brief stores the return value for mv_pp_op_tsc_get_khz */
     extern mv_status_t g_mut_mv_pp_op_tsc_set_khz;
+    /** @brief stores the return value for mv_pp_op_clr_trace_gpa */
+    extern mv_status_t g_mut_mv_pp_op_clr_trace_gpa;
+    /** @brief stores the return value for mv_pp_op_set_trace_gpa */
+    extern mv_status_t g_mut_mv_pp_op_set_trace_gpa;
 
     /**
      * <!-- description -->
@@ -426,6 +469,58 @@ extern "C"
         return g_mut_mv_pp_op_tsc_set_khz;
     }
 
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to clear the GPA of the
+     *     current PP's trace ring, which stops tracing on the current PP.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_pp_op_clr_trace_gpa(uint64_t const hndl) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+#endif
+
+        return g_mut_mv_pp_op_clr_trace_gpa;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the GPA of the current
+     *     PP's trace ring (an mv_trace_t), which starts tracing on the
+     *     current PP.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param gpa The GPA to set the current PP's trace ring to
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_pp_op_set_trace_gpa(uint64_t const hndl, uint64_t const gpa) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects(gpa > ((uint64_t)0));
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects(gpa > ((uint64_t)0));
+#endif
+
+        return g_mut_mv_pp_op_set_trace_gpa;
+    }
+
     /* -------------------------------------------------------------------------- */
     /* mv_vm_ops                                                                  */
     /* -------------------------------------------------------------------------- */
@@ -440,6 +535,20 @@ extern "C"
     extern mv_status_t g_mut_mv_vm_op_mmio_map;
     /** @brief stores the return value for mv_vm_op_mmio_unmap */
     extern mv_status_t g_mut_mv_vm_op_mmio_unmap;
+    /** @brief stores the return value for mv_vm_op_irqchip_create */
+    extern mv_status_t g_mut_mv_vm_op_irqchip_create;
+    /** @brief stores the return value for mv_vm_op_irq_line */
+    extern mv_status_t g_mut_mv_vm_op_irq_line;
+    /** @brief stores the return value for mv_vm_op_io_permission */
+    extern mv_status_t g_mut_mv_vm_op_io_permission;
+    /** @brief stores the return value for mv_vm_op_pause_exiting */
+    extern mv_status_t g_mut_mv_vm_op_pause_exiting;
+    /** @brief stores the return value for mv_vm_op_clock_get */
+    extern mv_status_t g_mut_mv_vm_op_clock_get;
+    /** @brief stores the return value for mv_vm_op_clock_set */
+    extern mv_status_t g_mut_mv_vm_op_clock_set;
+    /** @brief stores the return value for mv_vm_op_irq_resample */
+    extern mv_status_t g_mut_mv_vm_op_irq_resample;
 
     /**
      * <!-- description -->
@@ -625,32 +734,19 @@ extern "C"
         return MV_STATUS_SUCCESS;
     }
 
-    /* -------------------------------------------------------------------------- */
-    /* mv_vp_ops                                                                  */
-    /* -------------------------------------------------------------------------- */
-
-    /** @brief stores the return value for mv_vp_op_create_vp */
-    extern uint16_t g_mut_mv_vp_op_create_vp;
-    /** @brief stores the return value for mv_vp_op_destroy_vp */
-    extern mv_status_t g_mut_mv_vp_op_destroy_vp;
-    /** @brief stores the return value for mv_vp_op_vmid */
-    extern uint16_t g_mut_mv_vp_op_vmid;
-    /** @brief stores the return value for mv_vp_op_vpid */
-    extern uint16_t g_mut_mv_vp_op_vpid;
-
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to create a VP given the ID of
-     *     the VM the VP will be assigned to. Upon success, this hypercall
-     *     returns the ID of the newly created VP.
+     *   @brief This hypercall tells MicroV to emulate the PIC, IOAPIC and
+     *     PIT of a VM instead of returning accesses to them to the root VM.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vmid The ID of the VM to assign the newly created VP to
-     *   @return Returns the resulting VPID of the newly created VP
+     *   @param vmid The VMID of the VM to create the irqchip for
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
      */
-    NODISCARD static inline uint16_t
-    mv_vp_op_create_vp(uint64_t const hndl, uint16_t const vmid) NOEXCEPT
+    NODISCARD static inline mv_status_t
+    mv_vm_op_irqchip_create(uint64_t const hndl, uint16_t const vmid) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
@@ -662,221 +758,538 @@ extern "C"
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #endif
 
-        return g_mut_mv_vp_op_create_vp;
+        if (g_mut_mv_vm_op_irqchip_create > ((uint64_t)0)) {
+            --g_mut_mv_vm_op_irqchip_create;
+            if (((uint64_t)0) == g_mut_mv_vm_op_irqchip_create) {
+                return MV_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return MV_STATUS_SUCCESS;
+        }
+
+        return MV_STATUS_SUCCESS;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to destroy a VP given an ID.
+     *   @brief This hypercall sets the level of one of a VM's GSIs.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vpid The ID of the VP to destroy
+     *   @param vmid The VMID of the VM whose GSI is being set
+     *   @param gsi The GSI to set
+     *   @param level The new level of the GSI (0 or 1)
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vp_op_destroy_vp(uint64_t const hndl, uint16_t const vpid) NOEXCEPT
+    mv_vm_op_irq_line(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint64_t const gsi,
+        uint64_t const level) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
-        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
-        bsl::expects(((uint64_t)vpid) < HYPERVISOR_MAX_VPS);
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
-    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
-    platform_expects(((uint64_t)vpid) < HYPERVISOR_MAX_VPS);
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #endif
 
-        return g_mut_mv_vp_op_destroy_vp;
+        (void)gsi;
+        (void)level;
+
+        if (g_mut_mv_vm_op_irq_line > ((uint64_t)0)) {
+            --g_mut_mv_vm_op_irq_line;
+            if (((uint64_t)0) == g_mut_mv_vm_op_irq_line) {
+                return MV_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return MV_STATUS_SUCCESS;
+        }
+
+        return MV_STATUS_SUCCESS;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall returns the ID of the VM the requested VP is
-     *     assigned to.
+     *   @brief This hypercall sets how a VM's accesses to a range of IO
+     *     ports are handled.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vpid The ID of the VP to query
-     *   @return Returns the ID of the VP the requested VP is assigned to.
+     *   @param vmid The ID of the VM whose IO permissions are being set
+     *   @param port The first port in the range
+     *   @param num The number of ports in the range
+     *   @param type MV_IO_PERM_EXIT, MV_IO_PERM_PASSTHROUGH or
+     *     MV_IO_PERM_EMULATE
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
      */
-    NODISCARD static inline uint16_t
-    mv_vp_op_vmid(uint64_t const hndl, uint16_t const vpid) NOEXCEPT
+    NODISCARD static inline mv_status_t
+    mv_vm_op_io_permission(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint16_t const port,
+        uint32_t const num,
+        uint64_t const type) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
-        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
-    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #endif
 
-        return g_mut_mv_vp_op_vmid;
+        (void)port;
+        (void)num;
+        (void)type;
+
+        if (g_mut_mv_vm_op_io_permission > ((uint64_t)0)) {
+            --g_mut_mv_vm_op_io_permission;
+            if (((uint64_t)0) == g_mut_mv_vm_op_io_permission) {
+                return MV_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return MV_STATUS_SUCCESS;
+        }
+
+        return MV_STATUS_SUCCESS;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall returns the ID of the VP that executed this
-     *     hypercall.
+     *   @brief This hypercall sets a VM's PAUSE-loop exiting thresholds.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @return Returns the ID of the VP that executed this hypercall.
+     *   @param vmid The ID of the VM whose thresholds are being set
+     *   @param gap The max number of cycles between two PAUSEs of a loop
+     *   @param window The number of cycles a VS can spin before yielding
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
      */
-    NODISCARD static inline uint16_t
-    mv_vp_op_vpid(uint64_t const hndl) NOEXCEPT
+    NODISCARD static inline mv_status_t
+    mv_vm_op_pause_exiting(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint32_t const gap,
+        uint32_t const window) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #endif
 
-        return g_mut_mv_vp_op_vpid;
-    }
+        (void)gap;
+        (void)window;
 
-    /* -------------------------------------------------------------------------- */
-    /* mv_vs_ops                                                                  */
-    /* -------------------------------------------------------------------------- */
+        if (g_mut_mv_vm_op_pause_exiting > ((uint64_t)0)) {
+            --g_mut_mv_vm_op_pause_exiting;
+            if (((uint64_t)0) == g_mut_mv_vm_op_pause_exiting) {
+                return MV_STATUS_FAILURE_UNKNOWN;
+            }
 
-    /** @brief stores the return value for mv_vs_op_create_vs */
-    extern uint16_t g_mut_mv_vs_op_create_vs;
-    /** @brief stores the return value for mv_vs_op_destroy_vs */
-    extern mv_status_t g_mut_mv_vs_op_destroy_vs;
-    /** @brief stores the return value for mv_vs_op_vmid */
-    extern uint16_t g_mut_mv_vs_op_vmid;
-    /** @brief stores the return value for mv_vs_op_vpid */
-    extern uint16_t g_mut_mv_vs_op_vpid;
-    /** @brief stores the return value for mv_vs_op_vsid */
-    extern uint16_t g_mut_mv_vs_op_vsid;
-    /** @brief stores the return value for mv_vs_op_gla_to_gpa */
-    extern struct mv_translation_t g_mut_mv_vs_op_gla_to_gpa;
-    /** @brief stores the return value for mv_vs_op_run */
-    extern enum mv_exit_reason_t g_mut_mv_vs_op_run;
-    /** @brief stores the return value for mv_vs_op_run */
-    extern struct mv_exit_io_t g_mut_mv_vs_op_run_io;
-    /** @brief stores the return value for mv_vs_op_reg_get */
-    extern mv_status_t g_mut_mv_vs_op_reg_get;
-    /** @brief stores the return value for mv_vs_op_reg_set */
-    extern mv_status_t g_mut_mv_vs_op_reg_set;
-    /** @brief stores the return value for mv_vs_op_reg_get_list */
-    extern mv_status_t g_mut_mv_vs_op_reg_get_list;
-    /** @brief stores the return value for mv_vs_op_reg_set_list */
-    extern mv_status_t g_mut_mv_vs_op_reg_set_list;
-    /** @brief stores the return value for mv_vs_op_msr_get */
-    extern mv_status_t g_mut_mv_vs_op_msr_get;
-    /** @brief stores the return value for mv_vs_op_msr_set */
-    extern mv_status_t g_mut_mv_vs_op_msr_set;
-    /** @brief stores the return value for mv_vs_op_msr_get_list */
-    extern mv_status_t g_mut_mv_vs_op_msr_get_list;
-    /** @brief stores the return value for mv_vs_op_msr_set_list */
-    extern mv_status_t g_mut_mv_vs_op_msr_set_list;
-    /** @brief stores the return value for mv_vs_op_fpu_get_all */
-    extern mv_status_t g_mut_mv_vs_op_fpu_get_all;
-    /** @brief stores the return value for mv_vs_op_fpu_set_all */
-    extern mv_status_t g_mut_mv_vs_op_fpu_set_all;
-    /** @brief stores the return value for mv_vs_op_mp_state_get */
-    extern mv_status_t g_mut_mv_vs_op_mp_state_get;
-    /** @brief stores the return value for mv_vs_op_mp_state_set */
-    extern mv_status_t g_mut_mv_vs_op_mp_state_set;
-    /** @brief stores the return value for mv_vs_op_tsc_get_khz */
-    extern mv_status_t g_mut_mv_vs_op_tsc_get_khz;
+            return MV_STATUS_SUCCESS;
+        }
+
+        return MV_STATUS_SUCCESS;
+    }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to create a VS given the ID of
-     *     the VP the VS will be assigned to. Upon success, this hypercall
-     *     returns the ID of the newly created VS.
+     *   @brief Returns the current value of a VM's kvmclock in
+     *     nanoseconds.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vpid The ID of the VP to assign the newly created VS to
-     *   @return Returns the resulting VSID of the newly created VS
+     *   @param vmid The ID of the VM to query
+     *   @param pmut_ns Where to return the kvmclock in nanoseconds
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
      */
-    NODISCARD static inline uint16_t
-    mv_vs_op_create_vs(uint64_t const hndl, uint16_t const vpid) NOEXCEPT
+    NODISCARD static inline mv_status_t
+    mv_vm_op_clock_get(uint64_t const hndl, uint16_t const vmid, uint64_t *const pmut_ns) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
-        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+        bsl::expects(NULLPTR != pmut_ns);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
-    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+    platform_expects(NULLPTR != pmut_ns);
 #endif
 
-        return g_mut_mv_vs_op_create_vs;
+        *pmut_ns = g_mut_val;
+        return g_mut_mv_vm_op_clock_get;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to destroy a VS given an ID.
+     *   @brief Sets a VM's kvmclock to "ns" nanoseconds, and its wall
+     *     clock using "realtime" if it is not 0.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to destroy
+     *   @param vmid The ID of the VM to set
+     *   @param ns The new value of the kvmclock in nanoseconds
+     *   @param realtime The wall clock time in nanoseconds, or 0
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_destroy_vs(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    mv_vm_op_clock_set(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint64_t const ns,
+        uint64_t const realtime) NOEXCEPT
     {
+        (void)ns;
+        (void)realtime;
+
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
-        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects(((uint64_t)vsid) < HYPERVISOR_MAX_VPS);
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
-    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects(((uint64_t)vsid) < HYPERVISOR_MAX_VPS);
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #endif
 
-        return g_mut_mv_vs_op_destroy_vs;
+        return g_mut_mv_vm_op_clock_set;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall returns the ID of the VM the requested VS is
-     *     assigned to.
+     *   @brief Turns resampling of one of a VM's level triggered GSIs on
+     *     or off.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to query
-     *   @return Returns the ID of the VM the requested VS is assigned to.
+     *   @param vmid The ID of the VM whose GSI is being resampled
+     *   @param gsi The GSI to resample
+     *   @param enable 1 to turn resampling on, 0 to turn it off
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
      */
-    NODISCARD static inline uint16_t
-    mv_vs_op_vmid(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    NODISCARD static inline mv_status_t
+    mv_vm_op_irq_resample(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint64_t const gsi,
+        uint64_t const enable) NOEXCEPT
     {
+        (void)gsi;
+        (void)enable;
+
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
-        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
-    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
 #endif
 
-        return g_mut_mv_vs_op_vmid;
+        return g_mut_mv_vm_op_irq_resample;
     }
 
-    /**
-     * <!-- description -->
-     *   @brief This hypercall returns the ID of the VP the requested VS is
-     *     assigned to.
-     *
-     * <!-- inputs/outputs -->
-     *   @param hndl Set to the result of mv_handle_op_open_handle
+    /* -------------------------------------------------------------------------- */
+    /* mv_vp_ops                                                                  */
+    /* -------------------------------------------------------------------------- */
+
+    /** @brief stores the return value for mv_vp_op_create_vp */
+    extern uint16_t g_mut_mv_vp_op_create_vp;
+    /** @brief stores the return value for mv_vp_op_destroy_vp */
+    extern mv_status_t g_mut_mv_vp_op_destroy_vp;
+    /** @brief stores the return value for mv_vp_op_vmid */
+    extern uint16_t g_mut_mv_vp_op_vmid;
+    /** @brief stores the return value for mv_vp_op_vpid */
+    extern uint16_t g_mut_mv_vp_op_vpid;
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to create a VP given the ID of
+     *     the VM the VP will be assigned to. Upon success, this hypercall
+     *     returns the ID of the newly created VP.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM to assign the newly created VP to
+     *   @return Returns the resulting VPID of the newly created VP
+     */
+    NODISCARD static inline uint16_t
+    mv_vp_op_create_vp(uint64_t const hndl, uint16_t const vmid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+#endif
+
+        return g_mut_mv_vp_op_create_vp;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to destroy a VP given an ID.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vpid The ID of the VP to destroy
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vp_op_destroy_vp(uint64_t const hndl, uint16_t const vpid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+        bsl::expects(((uint64_t)vpid) < HYPERVISOR_MAX_VPS);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+    platform_expects(((uint64_t)vpid) < HYPERVISOR_MAX_VPS);
+#endif
+
+        return g_mut_mv_vp_op_destroy_vp;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall returns the ID of the VM the requested VP is
+     *     assigned to.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vpid The ID of the VP to query
+     *   @return Returns the ID of the VP the requested VP is assigned to.
+     */
+    NODISCARD static inline uint16_t
+    mv_vp_op_vmid(uint64_t const hndl, uint16_t const vpid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+#endif
+
+        return g_mut_mv_vp_op_vmid;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall returns the ID of the VP that executed this
+     *     hypercall.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @return Returns the ID of the VP that executed this hypercall.
+     */
+    NODISCARD static inline uint16_t
+    mv_vp_op_vpid(uint64_t const hndl) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+#endif
+
+        return g_mut_mv_vp_op_vpid;
+    }
+
+    /* -------------------------------------------------------------------------- */
+    /* mv_vs_ops                                                                  */
+    /* -------------------------------------------------------------------------- */
+
+    /** @brief stores the return value for mv_vs_op_create_vs */
+    extern uint16_t g_mut_mv_vs_op_create_vs;
+    /** @brief stores the return value for mv_vs_op_destroy_vs */
+    extern mv_status_t g_mut_mv_vs_op_destroy_vs;
+    /** @brief stores the return value for mv_vs_op_vmid */
+    extern uint16_t g_mut_mv_vs_op_vmid;
+    /** @brief stores the return value for mv_vs_op_vpid */
+    extern uint16_t g_mut_mv_vs_op_vpid;
+    /** @brief stores the return value for mv_vs_op_vsid */
+    extern uint16_t g_mut_mv_vs_op_vsid;
+    /** @brief stores the return value for mv_vs_op_gla_to_gpa */
+    extern struct mv_translation_t g_mut_mv_vs_op_gla_to_gpa;
+    /** @brief stores the return value for mv_vs_op_run */
+    extern enum mv_exit_reason_t g_mut_mv_vs_op_run;
+    /** @brief stores the return value for mv_vs_op_run */
+    extern struct mv_exit_io_t g_mut_mv_vs_op_run_io;
+    /** @brief stores the IO data provided to mv_vs_op_run */
+    extern struct mv_exit_io_t g_mut_mv_vs_op_run_io_in;
+    /** @brief stores the return value for mv_vs_op_run */
+    extern struct mv_exit_mmio_t g_mut_mv_vs_op_run_mmio;
+    /** @brief stores the MMIO data provided to mv_vs_op_run */
+    extern uint64_t g_mut_mv_vs_op_run_mmio_data;
+    /** @brief stores the return value for mv_vs_op_reg_get */
+    extern mv_status_t g_mut_mv_vs_op_reg_get;
+    /** @brief stores the return value for mv_vs_op_reg_set */
+    extern mv_status_t g_mut_mv_vs_op_reg_set;
+    /** @brief stores the return value for mv_vs_op_reg_get_list */
+    extern mv_status_t g_mut_mv_vs_op_reg_get_list;
+    /** @brief stores the return value for mv_vs_op_reg_set_list */
+    extern mv_status_t g_mut_mv_vs_op_reg_set_list;
+    /** @brief stores the return value for mv_vs_op_msr_get */
+    extern mv_status_t g_mut_mv_vs_op_msr_get;
+    /** @brief stores the return value for mv_vs_op_msr_set */
+    extern mv_status_t g_mut_mv_vs_op_msr_set;
+    /** @brief stores the return value for mv_vs_op_msr_get_list */
+    extern mv_status_t g_mut_mv_vs_op_msr_get_list;
+    /** @brief stores the return value for mv_vs_op_msr_set_list */
+    extern mv_status_t g_mut_mv_vs_op_msr_set_list;
+    /** @brief stores the return value for mv_vs_op_fpu_get_all */
+    extern mv_status_t g_mut_mv_vs_op_fpu_get_all;
+    /** @brief stores the return value for mv_vs_op_fpu_set_all */
+    extern mv_status_t g_mut_mv_vs_op_fpu_set_all;
+    /** @brief stores the return value for mv_vs_op_mp_state_get */
+    extern mv_status_t g_mut_mv_vs_op_mp_state_get;
+    /** @brief stores the return value for mv_vs_op_mp_state_set */
+    extern mv_status_t g_mut_mv_vs_op_mp_state_set;
+    /** @brief stores the return value for mv_vs_op_tsc_get_khz */
+    extern mv_status_t g_mut_mv_vs_op_tsc_get_khz;
+    /** @brief stores the return value for mv_vs_op_tsc_set_khz */
+    extern mv_status_t g_mut_mv_vs_op_tsc_set_khz;
+    /** @brief stores the return value for mv_vs_op_queue_interrupt */
+    extern mv_status_t g_mut_mv_vs_op_queue_interrupt;
+    /** @brief stores the return value for mv_vs_op_lapic_get_all */
+    extern mv_status_t g_mut_mv_vs_op_lapic_get_all;
+    /** @brief stores the return value for mv_vs_op_lapic_set_all */
+    extern mv_status_t g_mut_mv_vs_op_lapic_set_all;
+    /** @brief stores the return value for mv_vs_op_tsc_get_offset */
+    extern mv_status_t g_mut_mv_vs_op_tsc_get_offset;
+    /** @brief stores the return value for mv_vs_op_tsc_set_offset */
+    extern mv_status_t g_mut_mv_vs_op_tsc_set_offset;
+    /** @brief stores the return value for mv_vs_op_kvmclock_ctrl */
+    extern mv_status_t g_mut_mv_vs_op_kvmclock_ctrl;
+    /** @brief stores the return value for mv_vs_op_clr_exit_page_gpa */
+    extern mv_status_t g_mut_mv_vs_op_clr_exit_page_gpa;
+    /** @brief stores the return value for mv_vs_op_set_exit_page_gpa */
+    extern mv_status_t g_mut_mv_vs_op_set_exit_page_gpa;
+    /** @brief stores the return value for mv_vs_op_state_get_all */
+    extern mv_status_t g_mut_mv_vs_op_state_get_all;
+    /** @brief stores the return value for mv_vs_op_state_set_all */
+    extern mv_status_t g_mut_mv_vs_op_state_set_all;
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to create a VS given the ID of
+     *     the VP the VS will be assigned to. Upon success, this hypercall
+     *     returns the ID of the newly created VS.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vpid The ID of the VP to assign the newly created VS to
+     *   @return Returns the resulting VSID of the newly created VS
+     */
+    NODISCARD static inline uint16_t
+    mv_vs_op_create_vs(uint64_t const hndl, uint16_t const vpid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vpid);
+#endif
+
+        return g_mut_mv_vs_op_create_vs;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to destroy a VS given an ID.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to destroy
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_destroy_vs(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects(((uint64_t)vsid) < HYPERVISOR_MAX_VPS);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects(((uint64_t)vsid) < HYPERVISOR_MAX_VPS);
+#endif
+
+        return g_mut_mv_vs_op_destroy_vs;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall returns the ID of the VM the requested VS is
+     *     assigned to.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @return Returns the ID of the VM the requested VS is assigned to.
+     */
+    NODISCARD static inline uint16_t
+    mv_vs_op_vmid(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        return g_mut_mv_vs_op_vmid;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall returns the ID of the VP the requested VS is
+     *     assigned to.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
      *   @param vsid The ID of the VS to query
      *   @return Returns the ID of the VP the requested VS is assigned to.
      */
@@ -1005,10 +1418,19 @@ extern "C"
         switch ((int32_t)g_mut_mv_vs_op_run) {
             case mv_exit_reason_t_io: {
                 struct mv_exit_io_t *const pmut_out = (struct mv_exit_io_t *)g_mut_shared_pages[0];
+                g_mut_mv_vs_op_run_io_in = *pmut_out;
                 *pmut_out = g_mut_mv_vs_op_run_io;
                 break;
             }
 
+            case mv_exit_reason_t_mmio: {
+                struct mv_exit_mmio_t *const pmut_out =
+                    (struct mv_exit_mmio_t *)g_mut_shared_pages[0];
+                g_mut_mv_vs_op_run_mmio_data = pmut_out->data;
+                *pmut_out = g_mut_mv_vs_op_run_mmio;
+                break;
+            }
+
             case mv_exit_reason_t_interrupt: {
                 g_mut_mv_vs_op_run = (enum mv_exit_reason_t)mv_exit_reason_t_failure;
                 return (enum mv_exit_reason_t)mv_exit_reason_t_interrupt;
@@ -1019,245 +1441,583 @@ extern "C"
                 return (enum mv_exit_reason_t)mv_exit_reason_t_nmi;
             }
 
+            case mv_exit_reason_t_yield: {
+                g_mut_mv_vs_op_run = (enum mv_exit_reason_t)mv_exit_reason_t_failure;
+                return (enum mv_exit_reason_t)mv_exit_reason_t_yield;
+            }
+
             default: {
                 break;
             }
         }
 
-        return g_mut_mv_vs_op_run;
+        return g_mut_mv_vs_op_run;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to return the value of a requested
+     *     register. Not all registers values require 64 bits. Any unused bits
+     *     are REVI.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @param reg The register to get
+     *   @param pmut_val The value read from the requested register
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_reg_get(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        enum mv_reg_t const reg,
+        uint64_t *const pmut_val) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
+        bsl::expects(NULLPTR != pmut_val);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
+    platform_expects(NULLPTR != pmut_val);
+#endif
+
+        *pmut_val = g_mut_val;
+        return g_mut_mv_vs_op_reg_get;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the value of a requested
+     *     register. Not all registers values require 64 bits. Any unused bits
+     *     are REVI.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @param reg The register to set
+     *   @param val The value to write to the requested register
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_reg_set(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        enum mv_reg_t const reg,
+        uint64_t const val) NOEXCEPT
+    {
+        (void)val;
+
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
+#endif
+
+        return g_mut_mv_vs_op_reg_set;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to return the values of multiple
+     *     requested registers using a Register Descriptor List (RDL) in the
+     *     shared page. For this ABI, the reg field of each mv_rdl_entry_t
+     *     refers to an mv_reg_t. The val field refers to the returned value
+     *     of the requested register in that entry. Not all registers values
+     *     require 64 bits. Any unused bits are REVI. This ABI does not use
+     *     any of the reg 0-7 fields in the mv_rdl_t.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_reg_get_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+        uint64_t mut_i;
+
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        struct mv_rdl_t *const pmut_rdl = (struct mv_rdl_t *)g_mut_shared_pages[0];
+
+#ifdef __cplusplus
+        bsl::expects(nullptr != pmut_rdl);
+        bsl::expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
+#else
+    platform_expects(NULL != pmut_rdl);
+    platform_expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
+#endif
+        for (mut_i = ((uint64_t)0); mut_i < pmut_rdl->num_entries; ++mut_i) {
+            pmut_rdl->entries[mut_i].val = g_mut_val;
+        }
+
+        if (MV_STATUS_FAILURE_INC_NUM_ENTRIES == g_mut_mv_vs_op_reg_get_list) {
+            pmut_rdl->entries[pmut_rdl->num_entries].reg = ((uint64_t)0);
+            ++pmut_rdl->num_entries;
+            return MV_STATUS_SUCCESS;
+        }
+
+        if (MV_STATUS_FAILURE_ADD_UNKNOWN == g_mut_mv_vs_op_reg_get_list) {
+            pmut_rdl->entries[pmut_rdl->num_entries].reg = GARBAGE;
+            ++pmut_rdl->num_entries;
+            return MV_STATUS_SUCCESS;
+        }
+
+        if (MV_STATUS_FAILURE_CORRUPT_NUM_ENTRIES == g_mut_mv_vs_op_reg_get_list) {
+            pmut_rdl->num_entries = GARBAGE;
+            return MV_STATUS_SUCCESS;
+        }
+
+        return g_mut_mv_vs_op_reg_get_list;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the values of multiple
+     *     requested registers using a Register Descriptor List (RDL) in the
+     *     shared page. For this ABI, the reg field of each mv_rdl_entry_t
+     *     refers to an mv_reg_t. The val field refers to the value to set the
+     *     requested register in that entry to. Not all registers values
+     *     require 64 bits. Any unused bits are REVI. This ABI does not use any
+     *     of the reg 0-7 fields in the mv_rdl_t.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_reg_set_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        return g_mut_mv_vs_op_reg_set_list;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to return the value of a
+     *     requested MSR.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @param msr The index of the MSR to get
+     *   @param pmut_val The value read from the MSR
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_msr_get(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        uint32_t const msr,
+        uint64_t *const pmut_val) NOEXCEPT
+    {
+        (void)msr;
+
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects(NULLPTR != pmut_val);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects(NULLPTR != pmut_val);
+#endif
+
+        *pmut_val = g_mut_val;
+        return g_mut_mv_vs_op_msr_get;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the value of a
+     *     requested MSR.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @param msr The index of the MSR to set
+     *   @param val The value to write to the requested MSR
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_msr_set(
+        uint64_t const hndl, uint16_t const vsid, uint32_t const msr, uint64_t const val) NOEXCEPT
+    {
+        (void)msr;
+        (void)val;
+
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        return g_mut_mv_vs_op_msr_set;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to return the values of multiple
+     *     requested MSRs using a Register Descriptor List (RDL) in the shared
+     *     page. For this ABI, the reg field of each mv_rdl_entry_t refers to
+     *     the index of the MSR. The val field refers to the returned value of
+     *     the requested MSR in that entry. This ABI does not use any of the
+     *     reg 0-7 fields in the mv_rdl_t.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_msr_get_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+        uint64_t mut_i;
+
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        struct mv_rdl_t *const pmut_rdl = (struct mv_rdl_t *)g_mut_shared_pages[0];
+
+#ifdef __cplusplus
+        bsl::expects(nullptr != pmut_rdl);
+        bsl::expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
+#else
+    platform_expects(NULL != pmut_rdl);
+    platform_expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
+#endif
+        for (mut_i = ((uint64_t)0); mut_i < pmut_rdl->num_entries; ++mut_i) {
+            pmut_rdl->entries[mut_i].val = g_mut_val;
+        }
+
+        if (MV_STATUS_FAILURE_INC_NUM_ENTRIES == g_mut_mv_vs_op_msr_get_list) {
+            pmut_rdl->entries[pmut_rdl->num_entries].reg = ((uint64_t)0);
+            ++pmut_rdl->num_entries;
+            return MV_STATUS_SUCCESS;
+        }
+
+        if (MV_STATUS_FAILURE_ADD_UNKNOWN == g_mut_mv_vs_op_msr_get_list) {
+            pmut_rdl->entries[pmut_rdl->num_entries].reg = GARBAGE;
+            ++pmut_rdl->num_entries;
+            return MV_STATUS_SUCCESS;
+        }
+
+        if (MV_STATUS_FAILURE_CORRUPT_NUM_ENTRIES == g_mut_mv_vs_op_msr_get_list) {
+            pmut_rdl->num_entries = GARBAGE;
+            return MV_STATUS_SUCCESS;
+        }
+
+        return g_mut_mv_vs_op_msr_get_list;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the values of multiple
+     *     requested MSRs using a Register Descriptor List (RDL) in the shared
+     *     page. For this ABI, the reg field of each mv_rdl_entry_t refers to
+     *     the index of the MSR. The val field refers to the value to set the
+     *     requested MSR in that entry to. This ABI does not use any of the
+     *     reg 0-7 fields in the mv_rdl_t.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_msr_set_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        return g_mut_mv_vs_op_msr_set_list;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Returns FPU state as seen by the VS in the shared page.
+     *     The format of the FPU state depends on which mode the VS is
+     *     currently in.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_fpu_get_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        return g_mut_mv_vs_op_fpu_get_all;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Sets the FPU state as seen by the VS in the shared page.
+     *     The format of the FPU state depends on which mode the VS is
+     *     currently in.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_fpu_set_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+#ifdef __cplusplus
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#else
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+#endif
+
+        return g_mut_mv_vs_op_fpu_set_all;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to return the value of a requested
-     *     register. Not all registers values require 64 bits. Any unused bits
-     *     are REVI.
+     *   @brief Returns the mv_mp_state_t of the VS.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to query
-     *   @param reg The register to get
-     *   @param pmut_val The value read from the requested register
+     *   @param vsid The ID of the VS to set
+     *   @param pmut_state Where to store the new MP state
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_reg_get(
-        uint64_t const hndl,
-        uint16_t const vsid,
-        enum mv_reg_t const reg,
-        uint64_t *const pmut_val) NOEXCEPT
+    mv_vs_op_mp_state_get(
+        uint64_t const hndl, uint16_t const vsid, enum mv_mp_state_t *const pmut_state) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
-        bsl::expects(NULLPTR != pmut_val);
+        bsl::expects(NULLPTR != pmut_state);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
-    platform_expects(NULLPTR != pmut_val);
+    platform_expects(NULLPTR != pmut_state);
 #endif
 
-        *pmut_val = g_mut_val;
-        return g_mut_mv_vs_op_reg_get;
+        *pmut_state = (enum mv_mp_state_t)g_mut_val;
+        return g_mut_mv_vs_op_mp_state_get;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to set the value of a requested
-     *     register. Not all registers values require 64 bits. Any unused bits
-     *     are REVI.
+     *   @brief Sets the mv_mp_state_t of the VS.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to set
-     *   @param reg The register to set
-     *   @param val The value to write to the requested register
+     *   @param vsid the ID of the VS to set
+     *   @param state The new MP state
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_reg_set(
-        uint64_t const hndl,
-        uint16_t const vsid,
-        enum mv_reg_t const reg,
-        uint64_t const val) NOEXCEPT
+    mv_vs_op_mp_state_set(
+        uint64_t const hndl, uint16_t const vsid, enum mv_mp_state_t const state) NOEXCEPT
     {
-        (void)val;
+        (void)state;
 
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
+        bsl::expects((int32_t)state < (int32_t)mv_mp_state_t_invalid);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects((int32_t)reg < (int32_t)mv_reg_t_invalid);
+    platform_expects((int32_t)state < (int32_t)mv_mp_state_t_invalid);
 #endif
 
-        return g_mut_mv_vs_op_reg_set;
+        return g_mut_mv_vs_op_mp_state_set;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to return the values of multiple
-     *     requested registers using a Register Descriptor List (RDL) in the
-     *     shared page. For this ABI, the reg field of each mv_rdl_entry_t
-     *     refers to an mv_reg_t. The val field refers to the returned value
-     *     of the requested register in that entry. Not all registers values
-     *     require 64 bits. Any unused bits are REVI. This ABI does not use
-     *     any of the reg 0-7 fields in the mv_rdl_t.
+     *   @brief Returns the frequency of the VS.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to query
+     *   @param vsid The ID of the VS to get
+     *   @param pmut_freq Where to return the frequency in KHz
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_reg_get_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    mv_vs_op_tsc_get_khz(
+        uint64_t const hndl, uint16_t const vsid, uint64_t *const pmut_freq) NOEXCEPT
     {
-        uint64_t mut_i;
-
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects(NULLPTR != pmut_freq);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects(NULLPTR != pmut_freq);
 #endif
 
-        struct mv_rdl_t *const pmut_rdl = (struct mv_rdl_t *)g_mut_shared_pages[0];
-
-#ifdef __cplusplus
-        bsl::expects(nullptr != pmut_rdl);
-        bsl::expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
-#else
-    platform_expects(NULL != pmut_rdl);
-    platform_expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
-#endif
-        for (mut_i = ((uint64_t)0); mut_i < pmut_rdl->num_entries; ++mut_i) {
-            pmut_rdl->entries[mut_i].val = g_mut_val;
-        }
-
-        if (MV_STATUS_FAILURE_INC_NUM_ENTRIES == g_mut_mv_vs_op_reg_get_list) {
-            pmut_rdl->entries[pmut_rdl->num_entries].reg = ((uint64_t)0);
-            ++pmut_rdl->num_entries;
-            return MV_STATUS_SUCCESS;
-        }
-
-        if (MV_STATUS_FAILURE_ADD_UNKNOWN == g_mut_mv_vs_op_reg_get_list) {
-            pmut_rdl->entries[pmut_rdl->num_entries].reg = GARBAGE;
-            ++pmut_rdl->num_entries;
-            return MV_STATUS_SUCCESS;
-        }
-
-        if (MV_STATUS_FAILURE_CORRUPT_NUM_ENTRIES == g_mut_mv_vs_op_reg_get_list) {
-            pmut_rdl->num_entries = GARBAGE;
-            return MV_STATUS_SUCCESS;
-        }
-
-        return g_mut_mv_vs_op_reg_get_list;
+        *pmut_freq = g_mut_val;
+        return g_mut_mv_vs_op_tsc_get_khz;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to set the values of multiple
-     *     requested registers using a Register Descriptor List (RDL) in the
-     *     shared page. For this ABI, the reg field of each mv_rdl_entry_t
-     *     refers to an mv_reg_t. The val field refers to the value to set the
-     *     requested register in that entry to. Not all registers values
-     *     require 64 bits. Any unused bits are REVI. This ABI does not use any
-     *     of the reg 0-7 fields in the mv_rdl_t.
+     *   @brief Sets the frequency of the VS. If the CPU does not support
+     *     TSC scaling, the frequency must match the frequency of the PP.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
      *   @param vsid The ID of the VS to set
+     *   @param freq The frequency in KHz
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_reg_set_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    mv_vs_op_tsc_set_khz(uint64_t const hndl, uint16_t const vsid, uint64_t const freq) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects(freq > ((uint64_t)0));
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects(freq > ((uint64_t)0));
 #endif
 
-        return g_mut_mv_vs_op_reg_set_list;
+        return g_mut_mv_vs_op_tsc_set_khz;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to return the value of a
-     *     requested MSR.
+     *   @brief Queues an interrupt in the VS for injection. The
+     *     interrupt bypasses the VS's emulated LAPIC (i.e., it is
+     *     delivered like an ExtINT) and only one can be queued at a time.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to query
-     *   @param msr The index of the MSR to get
-     *   @param pmut_val The value read from the MSR
+     *   @param vsid The ID of the VS to queue the interrupt into
+     *   @param vector The vector to queue
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_msr_get(
-        uint64_t const hndl,
-        uint16_t const vsid,
-        uint32_t const msr,
-        uint64_t *const pmut_val) NOEXCEPT
+    mv_vs_op_queue_interrupt(
+        uint64_t const hndl, uint16_t const vsid, uint64_t const vector) NOEXCEPT
     {
-        (void)msr;
+        (void)vector;
 
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects(NULLPTR != pmut_val);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects(NULLPTR != pmut_val);
 #endif
 
-        *pmut_val = g_mut_val;
-        return g_mut_mv_vs_op_msr_get;
+        return g_mut_mv_vs_op_queue_interrupt;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to set the value of a
-     *     requested MSR.
+     *   @brief Returns the state of the VS's emulated LAPIC in the shared
+     *     page using a mv_lapic_state_t.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to set
-     *   @param msr The index of the MSR to set
-     *   @param val The value to write to the requested MSR
+     *   @param vsid The ID of the VS to query
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_msr_set(
-        uint64_t const hndl, uint16_t const vsid, uint32_t const msr, uint64_t const val) NOEXCEPT
+    mv_vs_op_lapic_get_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
     {
-        (void)msr;
-        (void)val;
-
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
@@ -1268,29 +2028,23 @@ extern "C"
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
 #endif
 
-        return g_mut_mv_vs_op_msr_set;
+        return g_mut_mv_vs_op_lapic_get_all;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to return the values of multiple
-     *     requested MSRs using a Register Descriptor List (RDL) in the shared
-     *     page. For this ABI, the reg field of each mv_rdl_entry_t refers to
-     *     the index of the MSR. The val field refers to the returned value of
-     *     the requested MSR in that entry. This ABI does not use any of the
-     *     reg 0-7 fields in the mv_rdl_t.
+     *   @brief Sets the state of the VS's emulated LAPIC using the
+     *     mv_lapic_state_t in the shared page.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to query
+     *   @param vsid The ID of the VS to set
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_msr_get_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    mv_vs_op_lapic_set_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
     {
-        uint64_t mut_i;
-
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
@@ -1301,57 +2055,57 @@ extern "C"
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
 #endif
 
-        struct mv_rdl_t *const pmut_rdl = (struct mv_rdl_t *)g_mut_shared_pages[0];
+        return g_mut_mv_vs_op_lapic_set_all;
+    }
 
+    /**
+     * <!-- description -->
+     *   @brief Returns the TSC offset of the VS. The guest's TSC is the
+     *     PP's TSC, scaled to the frequency of the VS, plus this offset.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @param pmut_offset Where to return the TSC offset
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t mv_vs_op_tsc_get_offset(
+        uint64_t const hndl, uint16_t const vsid, uint64_t *const pmut_offset) NOEXCEPT
+    {
 #ifdef __cplusplus
-        bsl::expects(nullptr != pmut_rdl);
-        bsl::expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
+        bsl::expects(MV_INVALID_HANDLE != hndl);
+        bsl::expects(hndl > ((uint64_t)0));
+        bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        bsl::expects(NULLPTR != pmut_offset);
 #else
-    platform_expects(NULL != pmut_rdl);
-    platform_expects(pmut_rdl->num_entries < MV_RDL_MAX_ENTRIES);
+    platform_expects(MV_INVALID_HANDLE != hndl);
+    platform_expects(hndl > ((uint64_t)0));
+    platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+    platform_expects(NULLPTR != pmut_offset);
 #endif
-        for (mut_i = ((uint64_t)0); mut_i < pmut_rdl->num_entries; ++mut_i) {
-            pmut_rdl->entries[mut_i].val = g_mut_val;
-        }
-
-        if (MV_STATUS_FAILURE_INC_NUM_ENTRIES == g_mut_mv_vs_op_msr_get_list) {
-            pmut_rdl->entries[pmut_rdl->num_entries].reg = ((uint64_t)0);
-            ++pmut_rdl->num_entries;
-            return MV_STATUS_SUCCESS;
-        }
-
-        if (MV_STATUS_FAILURE_ADD_UNKNOWN == g_mut_mv_vs_op_msr_get_list) {
-            pmut_rdl->entries[pmut_rdl->num_entries].reg = GARBAGE;
-            ++pmut_rdl->num_entries;
-            return MV_STATUS_SUCCESS;
-        }
-
-        if (MV_STATUS_FAILURE_CORRUPT_NUM_ENTRIES == g_mut_mv_vs_op_msr_get_list) {
-            pmut_rdl->num_entries = GARBAGE;
-            return MV_STATUS_SUCCESS;
-        }
 
-        return g_mut_mv_vs_op_msr_get_list;
+        *pmut_offset = g_mut_val;
+        return g_mut_mv_vs_op_tsc_get_offset;
     }
 
     /**
      * <!-- description -->
-     *   @brief This hypercall tells MicroV to set the values of multiple
-     *     requested MSRs using a Register Descriptor List (RDL) in the shared
-     *     page. For this ABI, the reg field of each mv_rdl_entry_t refers to
-     *     the index of the MSR. The val field refers to the value to set the
-     *     requested MSR in that entry to. This ABI does not use any of the
-     *     reg 0-7 fields in the mv_rdl_t.
+     *   @brief Sets the TSC offset of the VS. The guest's TSC is the
+     *     PP's TSC, scaled to the frequency of the VS, plus this offset.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
      *   @param vsid The ID of the VS to set
+     *   @param offset The TSC offset to set
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
-    NODISCARD static inline mv_status_t
-    mv_vs_op_msr_set_list(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    NODISCARD static inline mv_status_t mv_vs_op_tsc_set_offset(
+        uint64_t const hndl, uint16_t const vsid, uint64_t const offset) NOEXCEPT
     {
+        (void)offset;
+
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
@@ -1362,23 +2116,23 @@ extern "C"
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
 #endif
 
-        return g_mut_mv_vs_op_msr_set_list;
+        return g_mut_mv_vs_op_tsc_set_offset;
     }
 
     /**
      * <!-- description -->
-     *   @brief Returns FPU state as seen by the VS in the shared page.
-     *     The format of the FPU state depends on which mode the VS is
-     *     currently in.
+     *   @brief Tells MicroV that the VS was paused by software, so that
+     *     the next time its pvclock page is written, PVCLOCK_GUEST_STOPPED
+     *     is set.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to query
+     *   @param vsid The ID of the VS that was paused
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_fpu_get_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    mv_vs_op_kvmclock_ctrl(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
@@ -1390,23 +2144,23 @@ extern "C"
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
 #endif
 
-        return g_mut_mv_vs_op_fpu_get_all;
+        return g_mut_mv_vs_op_kvmclock_ctrl;
     }
 
     /**
      * <!-- description -->
-     *   @brief Sets the FPU state as seen by the VS in the shared page.
-     *     The format of the FPU state depends on which mode the VS is
-     *     currently in.
+     *   @brief This hypercall tells MicroV to clear the GPA of the VS's
+     *     exit page. IO and MMIO exits are then returned using the shared
+     *     page again.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to set
+     *   @param vsid The ID of the VS to clear the exit page of
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_fpu_set_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    mv_vs_op_clr_exit_page_gpa(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
@@ -1418,101 +2172,116 @@ extern "C"
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
 #endif
 
-        return g_mut_mv_vs_op_fpu_set_all;
+        return g_mut_mv_vs_op_clr_exit_page_gpa;
     }
 
     /**
      * <!-- description -->
-     *   @brief Returns the mv_mp_state_t of the VS.
+     *   @brief This hypercall tells MicroV to set the GPA of the VS's
+     *     exit page. While a VS has an exit page, MicroV writes IN/OUT
+     *     and MMIO exits directly into it (see mv_exit_page_io_t and
+     *     mv_exit_page_mmio_t) and mv_vs_op_run returns
+     *     mv_exit_reason_t_exit_page.
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to set
-     *   @param pmut_state Where to store the new MP state
+     *   @param vsid The ID of the VS to set the exit page of
+     *   @param gpa The GPA to set the VS's exit page to
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
-    NODISCARD static inline mv_status_t
-    mv_vs_op_mp_state_get(
-        uint64_t const hndl, uint16_t const vsid, enum mv_mp_state_t *const pmut_state) NOEXCEPT
+    NODISCARD static inline mv_status_t mv_vs_op_set_exit_page_gpa(
+        uint64_t const hndl, uint16_t const vsid, uint64_t const gpa) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects(NULLPTR != pmut_state);
+        bsl::expects(gpa > ((uint64_t)0));
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects(NULLPTR != pmut_state);
+    platform_expects(gpa > ((uint64_t)0));
 #endif
 
-        *pmut_state = (enum mv_mp_state_t)g_mut_val;
-        return g_mut_mv_vs_op_mp_state_get;
+        return g_mut_mv_vs_op_set_exit_page_gpa;
     }
 
     /**
      * <!-- description -->
-     *   @brief Sets the mv_mp_state_t of the VS.
+     *   @brief This hypercall tells MicroV to copy one chunk of a VS's
+     *     state into the shared page (see mv_vs_state_t).
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid the ID of the VS to set
-     *   @param state The new MP state
+     *   @param vsid The ID of the VS to query
+     *   @param chunk The chunk of the VS's state to get
+     *   @param pmut_next Returns the next chunk to get
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_mp_state_set(
-        uint64_t const hndl, uint16_t const vsid, enum mv_mp_state_t const state) NOEXCEPT
+    mv_vs_op_state_get_all(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        uint64_t const chunk,
+        uint64_t *const pmut_next) NOEXCEPT
     {
-        (void)state;
-
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects((int32_t)state < (int32_t)mv_mp_state_t_invalid);
+        bsl::expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+        bsl::expects(NULLPTR != pmut_next);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects((int32_t)state < (int32_t)mv_mp_state_t_invalid);
+    platform_expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+    platform_expects(NULLPTR != pmut_next);
 #endif
 
-        return g_mut_mv_vs_op_mp_state_set;
+        *pmut_next = g_mut_val;
+        return g_mut_mv_vs_op_state_get_all;
     }
 
     /**
      * <!-- description -->
-     *   @brief Returns the frequency of the VS.
+     *   @brief This hypercall tells MicroV to restore one chunk of a
+     *     VS's state from the shared page (see mv_vs_state_t).
      *
      * <!-- inputs/outputs -->
      *   @param hndl Set to the result of mv_handle_op_open_handle
-     *   @param vsid The ID of the VS to get
-     *   @param pmut_freq Where to return the frequency in KHz
+     *   @param vsid The ID of the VS to set
+     *   @param chunk The chunk of the VS's state to set
+     *   @param pmut_next Returns the next chunk to set
      *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
      *     and friends on failure.
      */
     NODISCARD static inline mv_status_t
-    mv_vs_op_tsc_get_khz(
-        uint64_t const hndl, uint16_t const vsid, uint64_t *const pmut_freq) NOEXCEPT
+    mv_vs_op_state_set_all(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        uint64_t const chunk,
+        uint64_t *const pmut_next) NOEXCEPT
     {
 #ifdef __cplusplus
         bsl::expects(MV_INVALID_HANDLE != hndl);
         bsl::expects(hndl > ((uint64_t)0));
         bsl::expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-        bsl::expects(NULLPTR != pmut_freq);
+        bsl::expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+        bsl::expects(NULLPTR != pmut_next);
 #else
     platform_expects(MV_INVALID_HANDLE != hndl);
     platform_expects(hndl > ((uint64_t)0));
     platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
-    platform_expects(NULLPTR != pmut_freq);
+    platform_expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+    platform_expects(NULLPTR != pmut_next);
 #endif
 
-        *pmut_freq = g_mut_val;
-        return g_mut_mv_vs_op_tsc_get_khz;
+        *pmut_next = g_mut_val;
+        return g_mut_mv_vs_op_state_set_all;
     }
 
 #ifdef __cplusplus
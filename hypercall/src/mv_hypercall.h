@@ -34,6 +34,7 @@
 #include <mv_reg_t.h>
 #include <mv_translation_t.h>
 #include <mv_types.h>
+#include <mv_vs_state_t.h>
 #include <platform.h>
 
 #ifdef __cplusplus
@@ -107,6 +108,43 @@ extern "C"
         return mv_handle_op_close_handle_impl(hndl);
     }
 
+    /* ---------------------------------------------------------------------- */
+    /* mv_debug_ops                                                           */
+    /* ---------------------------------------------------------------------- */
+
+    /**
+     * <!-- description -->
+     *   @brief Copies the statistics MicroV keeps for a VS or a PP into an
+     *     mv_stats_t in the shared page. "type" selects the VMExit or the
+     *     hypercall statistics of the VS or PP whose ID is "id" (see
+     *     MV_STATS_TYPE_xxx). The statistics are cumulative from the time
+     *     the VS was created (or the PP was started).
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param id The ID of the VS or PP to query
+     *   @param type One of MV_STATS_TYPE_xxx
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_debug_op_stats_get(uint64_t const hndl, uint16_t const id, uint64_t const type) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)id);
+
+        mut_ret = mv_debug_op_stats_get_impl(hndl, id, type);
+        if (mut_ret) {
+            bferror("mv_debug_op_stats_get failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* mv_pp_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -331,6 +369,65 @@ extern "C"
         return mut_ret;
     }
 
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to clear the GPA of the
+     *     current PP's trace ring, which stops tracing on the current PP.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_pp_op_clr_trace_gpa(uint64_t const hndl) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+
+        mut_ret = mv_pp_op_clr_trace_gpa_impl(hndl);
+        if (mut_ret) {
+            bferror("mv_pp_op_clr_trace_gpa failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the GPA of the current
+     *     PP's trace ring (an mv_trace_t), which starts tracing on the
+     *     current PP.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param gpa The GPA to set the current PP's trace ring to
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_pp_op_set_trace_gpa(uint64_t const hndl, uint64_t const gpa) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects(gpa > ((uint64_t)0));
+        platform_expects(gpa < MICROV_MAX_GPA_SIZE);
+        platform_expects(mv_is_page_aligned(gpa));
+
+        mut_ret = mv_pp_op_set_trace_gpa_impl(hndl, gpa);
+        if (mut_ret) {
+            bferror("mv_pp_op_set_trace_gpa failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* mv_vm_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -529,6 +626,277 @@ extern "C"
         return mut_ret;
     }
 
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to emulate the PIC, IOAPIC and
+     *     PIT of a VM instead of returning accesses to them to the root VM.
+     *     Once created, the VM's interrupt lines are driven using
+     *     mv_vm_op_irq_line. This hypercall can only be made once per VM.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM to create the irqchip for
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_irqchip_create(uint64_t const hndl, uint16_t const vmid) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+
+        mut_ret = mv_vm_op_irqchip_create_impl(hndl, vmid);
+        if (mut_ret) {
+            bferror("mv_vm_op_irqchip_create failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall sets the level of one of a VM's GSIs. GSI
+     *     0-15 are the ISA IRQs and are routed to both the PIC and the
+     *     IOAPIC (GSI 0 is routed to IOAPIC pin 2), while GSI 16-23 are
+     *     only routed to the IOAPIC. Edge triggered interrupts are
+     *     generated by setting the level to 1 and then back to 0. The
+     *     VM's irqchip must have been created using
+     *     mv_vm_op_irqchip_create.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM whose GSI is being set
+     *   @param gsi The GSI to set
+     *   @param level The new level of the GSI (0 or 1)
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_irq_line(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint64_t const gsi,
+        uint64_t const level) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+
+        mut_ret = mv_vm_op_irq_line_impl(hndl, vmid, gsi, level);
+        if (mut_ret) {
+            bferror("mv_vm_op_irq_line failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall sets how a VM's accesses to a range of IO
+     *     ports are handled. MV_IO_PERM_EXIT returns accesses to the root
+     *     VM (the default for every port), MV_IO_PERM_PASSTHROUGH gives
+     *     the VM direct access to the ports and MV_IO_PERM_EMULATE has
+     *     MicroV handle accesses to ports that nobody emulates (reads
+     *     return all ones and writes are dropped). Ports that MicroV
+     *     already emulates for the VM are not affected by this hypercall.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM whose IO permissions are being set
+     *   @param port The first port in the range
+     *   @param num The number of ports in the range
+     *   @param type MV_IO_PERM_EXIT, MV_IO_PERM_PASSTHROUGH or
+     *     MV_IO_PERM_EMULATE
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_io_permission(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint16_t const port,
+        uint32_t const num,
+        uint64_t const type) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+        uint64_t mut_reg2;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+
+        mut_reg2 = (((uint64_t)num) << MV_IO_PERM_NUM_PORTS_SHIFT) | ((uint64_t)port);
+
+        mut_ret = mv_vm_op_io_permission_impl(hndl, vmid, mut_reg2, type);
+        if (mut_ret) {
+            bferror("mv_vm_op_io_permission failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall sets a VM's PAUSE-loop exiting thresholds.
+     *     When one of the VM's VSs executes PAUSE in a loop (i.e. the
+     *     PAUSEs are no more than "gap" cycles apart) for more than
+     *     "window" cycles, mv_vs_op_run returns with
+     *     mv_exit_reason_t_yield, so that software can run a sibling VS
+     *     that is likely holding the lock the VS is spinning on. A gap or
+     *     window of 0 disables PAUSE-loop exiting for the VM.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM whose thresholds are being set
+     *   @param gap The max number of cycles between two PAUSEs of a loop
+     *   @param window The number of cycles a VS can spin before yielding
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_pause_exiting(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint32_t const gap,
+        uint32_t const window) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+
+        mut_ret = mv_vm_op_pause_exiting_impl(hndl, vmid, (uint64_t)gap, (uint64_t)window);
+        if (mut_ret) {
+            bferror("mv_vm_op_pause_exiting failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Returns the current value of a VM's kvmclock in
+     *     nanoseconds. The kvmclock is shared by all of the VM's VSs and
+     *     is what the VM sees through the pvclock pages it registers
+     *     using MSR_KVM_SYSTEM_TIME_NEW.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM to query
+     *   @param pmut_ns Where to return the kvmclock in nanoseconds
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_clock_get(uint64_t const hndl, uint16_t const vmid, uint64_t *const pmut_ns) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+        platform_expects(NULLPTR != pmut_ns);
+
+        mut_ret = mv_vm_op_clock_get_impl(hndl, vmid, pmut_ns);
+        if (mut_ret) {
+            bferror("mv_vm_op_clock_get failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Sets a VM's kvmclock to "ns" nanoseconds. If "realtime"
+     *     is not 0, it is the wall clock time in nanoseconds since the
+     *     epoch at the time of the call, and the wall clock the VM reads
+     *     using MSR_KVM_WALL_CLOCK_NEW is set so that the VM's idea of
+     *     the time of day matches. The VM's VSs pick up the new clock
+     *     the next time they are run.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM to set
+     *   @param ns The new value of the kvmclock in nanoseconds
+     *   @param realtime The wall clock time in nanoseconds, or 0
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_clock_set(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint64_t const ns,
+        uint64_t const realtime) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+
+        mut_ret = mv_vm_op_clock_set_impl(hndl, vmid, ns, realtime);
+        if (mut_ret) {
+            bferror("mv_vm_op_clock_set failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Turns resampling of one of a VM's level triggered GSIs on
+     *     (enable is not 0) or off. While resampling is on, an EOI of the
+     *     GSI's IOAPIC pin lowers the GSI and records it in the
+     *     "resampled" field of the mv_run_t returned by the next
+     *     mv_vs_op_run of any of the VM's VSs, which lets the root VM
+     *     check whether the device behind the GSI still needs service
+     *     and raise it again if it does (see KVM's KVM_IRQFD_FLAG_RESAMPLE).
+     *     GSI 0 and 2 cannot be resampled. The VM's irqchip must have
+     *     been created using mv_vm_op_irqchip_create.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vmid The ID of the VM whose GSI is being resampled
+     *   @param gsi The GSI to resample
+     *   @param enable 1 to turn resampling on, 0 to turn it off
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vm_op_irq_resample(
+        uint64_t const hndl,
+        uint16_t const vmid,
+        uint64_t const gsi,
+        uint64_t const enable) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vmid);
+
+        mut_ret = mv_vm_op_irq_resample_impl(hndl, vmid, gsi, enable);
+        if (mut_ret) {
+            bferror("mv_vm_op_irq_resample failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
     /* ---------------------------------------------------------------------- */
     /* mv_vp_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -1397,6 +1765,363 @@ extern "C"
         return mut_ret;
     }
 
+    /**
+     * <!-- description -->
+     *   @brief Sets the frequency of the VS. If the CPU does not support
+     *     TSC scaling, the frequency must match the frequency of the PP.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @param freq The frequency in KHz
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_tsc_set_khz(uint64_t const hndl, uint16_t const vsid, uint64_t const freq) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        platform_expects(freq > ((uint64_t)0));
+
+        mut_ret = mv_vs_op_tsc_set_khz_impl(hndl, vsid, freq);
+        if (mut_ret) {
+            bferror("mv_vs_op_tsc_set_khz failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Queues an interrupt in the VS for injection. The
+     *     interrupt bypasses the VS's emulated LAPIC (i.e., it is
+     *     delivered like an ExtINT) and only one can be queued at a time.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to queue the interrupt into
+     *   @param vector The vector to queue
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_queue_interrupt(
+        uint64_t const hndl, uint16_t const vsid, uint64_t const vector) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+
+        mut_ret = mv_vs_op_queue_interrupt_impl(hndl, vsid, vector);
+        if (mut_ret) {
+            bferror("mv_vs_op_queue_interrupt failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Returns the state of the VS's emulated LAPIC in the shared
+     *     page using a mv_lapic_state_t.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_lapic_get_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+
+        mut_ret = mv_vs_op_lapic_get_all_impl(hndl, vsid);
+        if (mut_ret) {
+            bferror("mv_vs_op_lapic_get_all failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Sets the state of the VS's emulated LAPIC using the
+     *     mv_lapic_state_t in the shared page.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_lapic_set_all(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+
+        mut_ret = mv_vs_op_lapic_set_all_impl(hndl, vsid);
+        if (mut_ret) {
+            bferror("mv_vs_op_lapic_set_all failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Returns the TSC offset of the VS. The guest's TSC is the
+     *     PP's TSC, scaled to the frequency of the VS, plus this offset.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @param pmut_offset Where to return the TSC offset
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t mv_vs_op_tsc_get_offset(
+        uint64_t const hndl, uint16_t const vsid, uint64_t *const pmut_offset) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        platform_expects(NULLPTR != pmut_offset);
+
+        mut_ret = mv_vs_op_tsc_get_offset_impl(hndl, vsid, pmut_offset);
+        if (mut_ret) {
+            bferror("mv_vs_op_tsc_get_offset failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Sets the TSC offset of the VS. The guest's TSC is the
+     *     PP's TSC, scaled to the frequency of the VS, plus this offset.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @param offset The TSC offset to set
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t mv_vs_op_tsc_set_offset(
+        uint64_t const hndl, uint16_t const vsid, uint64_t const offset) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+
+        mut_ret = mv_vs_op_tsc_set_offset_impl(hndl, vsid, offset);
+        if (mut_ret) {
+            bferror("mv_vs_op_tsc_set_offset failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief Tells MicroV that the VS was paused by software, so that
+     *     the next time its pvclock page is written, PVCLOCK_GUEST_STOPPED
+     *     is set. This keeps the guest's soft lockup watchdog from firing
+     *     because of time that passed while the VS could not run.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS that was paused
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_kvmclock_ctrl(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+
+        mut_ret = mv_vs_op_kvmclock_ctrl_impl(hndl, vsid);
+        if (mut_ret) {
+            bferror("mv_vs_op_kvmclock_ctrl failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to clear the GPA of the VS's
+     *     exit page. IO and MMIO exits are then returned using the shared
+     *     page again.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to clear the exit page of
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_clr_exit_page_gpa(uint64_t const hndl, uint16_t const vsid) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+
+        mut_ret = mv_vs_op_clr_exit_page_gpa_impl(hndl, vsid);
+        if (mut_ret) {
+            bferror("mv_vs_op_clr_exit_page_gpa failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to set the GPA of the VS's
+     *     exit page. While a VS has an exit page, MicroV writes IN/OUT
+     *     and MMIO exits directly into it (see mv_exit_page_io_t and
+     *     mv_exit_page_mmio_t) and mv_vs_op_run returns
+     *     mv_exit_reason_t_exit_page.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set the exit page of
+     *   @param gpa The GPA to set the VS's exit page to
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t mv_vs_op_set_exit_page_gpa(
+        uint64_t const hndl, uint16_t const vsid, uint64_t const gpa) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        platform_expects(gpa > ((uint64_t)0));
+        platform_expects(gpa < MICROV_MAX_GPA_SIZE);
+        platform_expects(mv_is_page_aligned(gpa));
+
+        mut_ret = mv_vs_op_set_exit_page_gpa_impl(hndl, vsid, gpa);
+        if (mut_ret) {
+            bferror("mv_vs_op_set_exit_page_gpa failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to copy one chunk of a VS's
+     *     state into the shared page (see mv_vs_state_t). Saving a VS
+     *     starts with MV_VS_STATE_CHUNK_CPU and calls this hypercall with
+     *     the chunk it returns until MV_VS_STATE_NUM_CHUNKS is returned.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to query
+     *   @param chunk The chunk of the VS's state to get
+     *   @param pmut_next Returns the next chunk to get
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_state_get_all(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        uint64_t const chunk,
+        uint64_t *const pmut_next) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        platform_expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+        platform_expects(NULLPTR != pmut_next);
+
+        mut_ret = mv_vs_op_state_get_all_impl(hndl, vsid, chunk, pmut_next);
+        if (mut_ret) {
+            bferror("mv_vs_op_state_get_all failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
+    /**
+     * <!-- description -->
+     *   @brief This hypercall tells MicroV to restore one chunk of a
+     *     VS's state from the shared page (see mv_vs_state_t). The
+     *     chunks must be given back in the order mv_vs_op_state_get_all
+     *     returned them.
+     *
+     * <!-- inputs/outputs -->
+     *   @param hndl Set to the result of mv_handle_op_open_handle
+     *   @param vsid The ID of the VS to set
+     *   @param chunk The chunk of the VS's state to set
+     *   @param pmut_next Returns the next chunk to set
+     *   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+     *     and friends on failure.
+     */
+    NODISCARD static inline mv_status_t
+    mv_vs_op_state_set_all(
+        uint64_t const hndl,
+        uint16_t const vsid,
+        uint64_t const chunk,
+        uint64_t *const pmut_next) NOEXCEPT
+    {
+        mv_status_t mut_ret;
+
+        platform_expects(MV_INVALID_HANDLE != hndl);
+        platform_expects(hndl > ((uint64_t)0));
+        platform_expects((int32_t)MV_INVALID_ID != (int32_t)vsid);
+        platform_expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+        platform_expects(NULLPTR != pmut_next);
+
+        mut_ret = mv_vs_op_state_set_all_impl(hndl, vsid, chunk, pmut_next);
+        if (mut_ret) {
+            bferror("mv_vs_op_state_set_all failed");
+            return mut_ret;
+        }
+
+        return mut_ret;
+    }
+
 #ifdef __cplusplus
 }
 #endif
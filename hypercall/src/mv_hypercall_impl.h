@@ -91,6 +91,19 @@ extern "C"
      */
     void mv_debug_op_out_impl(uint64_t const reg0_in, uint64_t const reg1_in) NOEXCEPT;
 
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_debug_op_stats_get.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_debug_op_stats_get_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t const reg2_in) NOEXCEPT;
+
     /* ---------------------------------------------------------------------- */
     /* mv_pp_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -173,6 +186,28 @@ extern "C"
     NODISCARD mv_status_t
     mv_pp_op_tsc_set_khz_impl(uint64_t const reg0_in, uint64_t const reg1_in) NOEXCEPT;
 
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_pp_op_clr_trace_gpa.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_pp_op_clr_trace_gpa_impl(uint64_t const reg0_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_pp_op_set_trace_gpa.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t
+    mv_pp_op_set_trace_gpa_impl(uint64_t const reg0_in, uint64_t const reg1_in) NOEXCEPT;
+
     /* ---------------------------------------------------------------------- */
     /* mv_vm_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -238,6 +273,116 @@ extern "C"
     NODISCARD mv_status_t
     mv_vm_op_mmio_unmap_impl(uint64_t const reg0_in, uint16_t const reg1_in) NOEXCEPT;
 
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_irqchip_create.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t
+    mv_vm_op_irqchip_create_impl(uint64_t const reg0_in, uint16_t const reg1_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_irq_line.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param reg3_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vm_op_irq_line_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t const reg3_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_io_permission.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param reg3_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vm_op_io_permission_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t const reg3_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_pause_exiting.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param reg3_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vm_op_pause_exiting_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t const reg3_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_clock_get.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param pmut_reg0_out n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vm_op_clock_get_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t *const pmut_reg0_out) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_clock_set.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param reg3_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vm_op_clock_set_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t const reg3_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vm_op_irq_resample.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param reg3_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vm_op_irq_resample_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t const reg3_in) NOEXCEPT;
+
     /* ---------------------------------------------------------------------- */
     /* mv_vp_ops                                                              */
     /* ---------------------------------------------------------------------- */
@@ -572,6 +717,153 @@ extern "C"
     NODISCARD mv_status_t mv_vs_op_tsc_get_khz_impl(
         uint64_t const reg0_in, uint16_t const reg1_in, uint64_t *const pmut_reg0_out) NOEXCEPT;
 
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_tsc_set_khz.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_tsc_set_khz_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t const reg2_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_queue_interrupt.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_queue_interrupt_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t const reg2_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_lapic_get_all.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t
+    mv_vs_op_lapic_get_all_impl(uint64_t const reg0_in, uint16_t const reg1_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_lapic_set_all.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t
+    mv_vs_op_lapic_set_all_impl(uint64_t const reg0_in, uint16_t const reg1_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_tsc_get_offset.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param pmut_reg0_out n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_tsc_get_offset_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t *const pmut_reg0_out) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_tsc_set_offset.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_tsc_set_offset_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t const reg2_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_kvmclock_ctrl.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t
+    mv_vs_op_kvmclock_ctrl_impl(uint64_t const reg0_in, uint16_t const reg1_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_clr_exit_page_gpa.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t
+    mv_vs_op_clr_exit_page_gpa_impl(uint64_t const reg0_in, uint16_t const reg1_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_set_exit_page_gpa.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_set_exit_page_gpa_impl(
+        uint64_t const reg0_in, uint16_t const reg1_in, uint64_t const reg2_in) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_state_get_all.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param pmut_reg0_out n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_state_get_all_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t *const pmut_reg0_out) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Implements the ABI for mv_vs_op_state_set_all.
+     *
+     * <!-- inputs/outputs -->
+     *   @param reg0_in n/a
+     *   @param reg1_in n/a
+     *   @param reg2_in n/a
+     *   @param pmut_reg0_out n/a
+     *   @return n/a
+     */
+    NODISCARD mv_status_t mv_vs_op_state_set_all_impl(
+        uint64_t const reg0_in,
+        uint16_t const reg1_in,
+        uint64_t const reg2_in,
+        uint64_t *const pmut_reg0_out) NOEXCEPT;
+
 #ifdef __cplusplus
 }
 #endif
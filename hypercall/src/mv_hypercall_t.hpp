@@ -32,6 +32,7 @@
 #include <mv_reg_t.hpp>
 #include <mv_translation_t.hpp>
 #include <mv_types.hpp>
+#include <mv_vs_state_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
@@ -128,6 +129,43 @@ namespace hypercall
             return m_hndl;
         }
 
+        // ---------------------------------------------------------------------
+        // mv_debug_ops
+        // ---------------------------------------------------------------------
+
+        /// <!-- description -->
+        ///   @brief Copies the statistics MicroV keeps for a VS or a PP
+        ///     into an mv_stats_t in the shared page. "type" selects the
+        ///     VMExit or the hypercall statistics of the VS or PP whose ID
+        ///     is "id" (see MV_STATS_TYPE_xxx).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id The ID of the VS or PP to query
+        ///   @param type One of MV_STATS_TYPE_xxx
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_debug_op_stats_get(bsl::safe_u16 const &id, bsl::safe_u64 const &type) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(id.is_valid_and_checked());
+            bsl::expects(id != MV_INVALID_ID);
+            bsl::expects(type.is_valid_and_checked());
+
+            mv_status_t const ret{mv_debug_op_stats_get_impl(m_hndl.get(), id.get(), type.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_debug_op_stats_get failed with status "    // --
+                             << bsl::hex(ret)                                  // --
+                             << bsl::endl                                      // --
+                             << bsl::here();                                   // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // mv_pp_ops
         // ---------------------------------------------------------------------
@@ -349,6 +387,61 @@ namespace hypercall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief This hypercall tells MicroV to clear the GPA of the
+        ///     current PP's trace ring, which stops tracing on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_pp_op_clr_trace_gpa() noexcept -> bsl::errc_type
+        {
+            mv_status_t const ret{mv_pp_op_clr_trace_gpa_impl(m_hndl.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_pp_op_clr_trace_gpa failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief This hypercall tells MicroV to set the GPA of the current
+        ///     PP's trace ring (an mv_trace_t), which starts tracing on the
+        ///     current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa The GPA to set the current PP's trace ring to
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_pp_op_set_trace_gpa(bsl::safe_u64 const &gpa) noexcept -> bsl::errc_type
+        {
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(gpa.is_pos());
+            bsl::expects(gpa < MICROV_MAX_GPA_SIZE);
+            bsl::expects(mv_is_page_aligned(gpa));
+
+            mv_status_t const ret{mv_pp_op_set_trace_gpa_impl(m_hndl.get(), gpa.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_pp_op_set_trace_gpa failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // mv_vm_ops
         // ---------------------------------------------------------------------
@@ -568,6 +661,267 @@ namespace hypercall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief This hypercall tells MicroV to emulate the PIC, IOAPIC
+        ///     and PIT of a VM instead of returning accesses to them to the
+        ///     root VM. Once created, the VM's interrupt lines are driven
+        ///     using mv_vm_op_irq_line. This hypercall can only be made once
+        ///     per VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM to create the irqchip for
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_irqchip_create(bsl::safe_u16 const &vmid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+
+            mv_status_t const ret{mv_vm_op_irqchip_create_impl(m_hndl.get(), vmid.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_irqchip_create failed with status "    // --
+                             << bsl::hex(ret)                                    // --
+                             << bsl::endl                                        // --
+                             << bsl::here();                                     // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief This hypercall sets the level of one of a VM's GSIs.
+        ///     GSI 0-15 are the ISA IRQs and are routed to both the PIC and
+        ///     the IOAPIC (GSI 0 is routed to IOAPIC pin 2), while GSI 16-23
+        ///     are only routed to the IOAPIC. The VM's irqchip must have
+        ///     been created using mv_vm_op_irqchip_create.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM whose GSI is being set
+        ///   @param gsi The GSI to set
+        ///   @param level The new level of the GSI (0 or 1)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_irq_line(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &gsi,
+            bsl::safe_u64 const &level) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+            bsl::expects(gsi.is_valid_and_checked());
+            bsl::expects(level.is_valid_and_checked());
+
+            mv_status_t const ret{
+                mv_vm_op_irq_line_impl(m_hndl.get(), vmid.get(), gsi.get(), level.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_irq_line failed with status "    // --
+                             << bsl::hex(ret)                              // --
+                             << bsl::endl                                  // --
+                             << bsl::here();                               // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief This hypercall sets how a VM's accesses to a range of
+        ///     IO ports are handled. MV_IO_PERM_EXIT returns accesses to
+        ///     the root VM, MV_IO_PERM_PASSTHROUGH gives the VM direct
+        ///     access to the ports and MV_IO_PERM_EMULATE has MicroV
+        ///     handle accesses to ports that nobody emulates.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM whose IO permissions are being set
+        ///   @param port The first port in the range
+        ///   @param num The number of ports in the range
+        ///   @param type MV_IO_PERM_EXIT, MV_IO_PERM_PASSTHROUGH or
+        ///     MV_IO_PERM_EMULATE
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_io_permission(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u16 const &port,
+            bsl::safe_u32 const &num,
+            bsl::safe_u64 const &type) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+            bsl::expects(port.is_valid_and_checked());
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(type.is_valid_and_checked());
+
+            auto const reg2{
+                (bsl::to_u64(num) << MV_IO_PERM_NUM_PORTS_SHIFT) | bsl::to_u64(port)};
+
+            mv_status_t const ret{mv_vm_op_io_permission_impl(
+                m_hndl.get(), vmid.get(), reg2.checked().get(), type.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_io_permission failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief This hypercall sets a VM's PAUSE-loop exiting
+        ///     thresholds. When one of the VM's VSs executes PAUSE in a
+        ///     loop (i.e. the PAUSEs are no more than "gap" cycles apart)
+        ///     for more than "window" cycles, mv_vs_op_run returns with
+        ///     mv_exit_reason_t_yield. A gap or window of 0 disables
+        ///     PAUSE-loop exiting for the VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM whose thresholds are being set
+        ///   @param gap The max number of cycles between two PAUSEs of a loop
+        ///   @param window The number of cycles a VS can spin before yielding
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_pause_exiting(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u32 const &gap,
+            bsl::safe_u32 const &window) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+            bsl::expects(gap.is_valid_and_checked());
+            bsl::expects(window.is_valid_and_checked());
+
+            mv_status_t const ret{mv_vm_op_pause_exiting_impl(
+                m_hndl.get(), vmid.get(), bsl::to_u64(gap).get(), bsl::to_u64(window).get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_pause_exiting failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the current value of a VM's kvmclock in
+        ///     nanoseconds. The kvmclock is shared by all of the VM's VSs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM to query
+        ///   @return Returns the current value of the VM's kvmclock in
+        ///     nanoseconds, or bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_clock_get(bsl::safe_u16 const &vmid) noexcept -> bsl::safe_u64
+        {
+            bsl::safe_u64 mut_ns;
+
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+
+            mv_status_t const ret{mv_vm_op_clock_get_impl(m_hndl.get(), vmid.get(), mut_ns.data())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_clock_get failed with status "    // --
+                             << bsl::hex(ret)                               // --
+                             << bsl::endl                                   // --
+                             << bsl::here();                                // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            return mut_ns;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets a VM's kvmclock to "ns" nanoseconds. If "realtime"
+        ///     is not 0, it is the wall clock time in nanoseconds since the
+        ///     epoch, and the VM's wall clock is set to match.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM to set
+        ///   @param ns The new value of the kvmclock in nanoseconds
+        ///   @param realtime The wall clock time in nanoseconds, or 0
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_clock_set(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &ns,
+            bsl::safe_u64 const &realtime) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+            bsl::expects(ns.is_valid_and_checked());
+            bsl::expects(realtime.is_valid_and_checked());
+
+            mv_status_t const ret{
+                mv_vm_op_clock_set_impl(m_hndl.get(), vmid.get(), ns.get(), realtime.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_clock_set failed with status "    // --
+                             << bsl::hex(ret)                               // --
+                             << bsl::endl                                   // --
+                             << bsl::here();                                // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Turns resampling of one of a VM's level triggered GSIs
+        ///     on or off. While resampling is on, an EOI of the GSI lowers
+        ///     it and records it in the "resampled" field of the mv_run_t
+        ///     returned by the next mv_vs_op_run of any of the VM's VSs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid The ID of the VM whose GSI is being resampled
+        ///   @param gsi The GSI to resample
+        ///   @param enable 1 to turn resampling on, 0 to turn it off
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vm_op_irq_resample(
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &gsi,
+            bsl::safe_u64 const &enable) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vmid.is_valid_and_checked());
+            bsl::expects(vmid != MV_INVALID_ID);
+            bsl::expects(gsi.is_valid_and_checked());
+            bsl::expects(enable.is_valid_and_checked());
+
+            mv_status_t const ret{
+                mv_vm_op_irq_resample_impl(m_hndl.get(), vmid.get(), gsi.get(), enable.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vm_op_irq_resample failed with status "    // --
+                             << bsl::hex(ret)                                  // --
+                             << bsl::endl                                      // --
+                             << bsl::here();                                   // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // mv_vp_ops
         // ---------------------------------------------------------------------
@@ -1519,6 +1873,361 @@ namespace hypercall
 
             return mut_freq;
         }
+
+        /// <!-- description -->
+        ///   @brief Sets the frequency of the VS. If the CPU does not
+        ///     support TSC scaling, the frequency must match the
+        ///     frequency of the PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to set
+        ///   @param freq The frequency in KHz
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_tsc_set_khz(bsl::safe_u16 const &vsid, bsl::safe_u64 const &freq) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+            bsl::expects(freq.is_valid_and_checked());
+            bsl::expects(freq.is_pos());
+
+            mv_status_t const ret{mv_vs_op_tsc_set_khz_impl(m_hndl.get(), vsid.get(), freq.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_tsc_set_khz failed with status "    // --
+                             << bsl::hex(ret)                                 // --
+                             << bsl::endl                                     // --
+                             << bsl::here();                                  // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues an interrupt in the VS for injection. The
+        ///     interrupt bypasses the VS's emulated LAPIC (i.e., it is
+        ///     delivered like an ExtINT) and only one can be queued at a
+        ///     time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to queue the interrupt into
+        ///   @param vector The vector to queue
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_queue_interrupt(bsl::safe_u16 const &vsid, bsl::safe_u64 const &vector) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+            bsl::expects(vector.is_valid_and_checked());
+
+            mv_status_t const ret{
+                mv_vs_op_queue_interrupt_impl(m_hndl.get(), vsid.get(), vector.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_queue_interrupt failed with status "    // --
+                             << bsl::hex(ret)                                     // --
+                             << bsl::endl                                         // --
+                             << bsl::here();                                      // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the state of the VS's emulated LAPIC in the
+        ///     shared page using a mv_lapic_state_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to query
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_lapic_get_all(bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+
+            mv_status_t const ret{mv_vs_op_lapic_get_all_impl(m_hndl.get(), vsid.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_lapic_get_all failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the state of the VS's emulated LAPIC using the
+        ///     mv_lapic_state_t in the shared page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to set
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_lapic_set_all(bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+
+            mv_status_t const ret{mv_vs_op_lapic_set_all_impl(m_hndl.get(), vsid.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_lapic_set_all failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TSC offset of the VS. The guest's TSC is
+        ///     the PP's TSC, scaled to the frequency of the VS, plus this
+        ///     offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to query
+        ///   @return Returns the TSC offset of the VS.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_tsc_get_offset(bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
+        {
+            bsl::safe_u64 mut_offset;
+
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+
+            mv_status_t const ret{
+                mv_vs_op_tsc_get_offset_impl(m_hndl.get(), vsid.get(), mut_offset.data())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_tsc_get_offset failed with status "    // --
+                             << bsl::hex(ret)                                    // --
+                             << bsl::endl                                        // --
+                             << bsl::here();                                     // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            return mut_offset;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the TSC offset of the VS. The guest's TSC is the
+        ///     PP's TSC, scaled to the frequency of the VS, plus this
+        ///     offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to set
+        ///   @param offset The TSC offset to set
+        ///   @return Returns MV_STATUS_SUCCESS on success, MV_STATUS_FAILURE_UNKNOWN
+        ///     and friends on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_tsc_set_offset(bsl::safe_u16 const &vsid, bsl::safe_u64 const &offset) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+            bsl::expects(offset.is_valid_and_checked());
+
+            mv_status_t const ret{
+                mv_vs_op_tsc_set_offset_impl(m_hndl.get(), vsid.get(), offset.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_tsc_set_offset failed with status "    // --
+                             << bsl::hex(ret)                                    // --
+                             << bsl::endl                                        // --
+                             << bsl::here();                                     // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells MicroV that the VS was paused by software, so
+        ///     that PVCLOCK_GUEST_STOPPED is set the next time its pvclock
+        ///     page is written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS that was paused
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_kvmclock_ctrl(bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+
+            mv_status_t const ret{mv_vs_op_kvmclock_ctrl_impl(m_hndl.get(), vsid.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_kvmclock_ctrl failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief This hypercall tells MicroV to clear the GPA of the VS's
+        ///     exit page. IO and MMIO exits are then returned using the
+        ///     shared page again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to clear the exit page of
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_clr_exit_page_gpa(bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+
+            mv_status_t const ret{mv_vs_op_clr_exit_page_gpa_impl(m_hndl.get(), vsid.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_clr_exit_page_gpa failed with status "    // --
+                             << bsl::hex(ret)                                       // --
+                             << bsl::endl                                           // --
+                             << bsl::here();                                        // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief This hypercall tells MicroV to set the GPA of the VS's
+        ///     exit page. While a VS has an exit page, MicroV writes IN/OUT
+        ///     and MMIO exits directly into it and mv_vs_op_run returns
+        ///     mv_exit_reason_t_exit_page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to set the exit page of
+        ///   @param gpa The GPA to set the VS's exit page to
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_set_exit_page_gpa(bsl::safe_u16 const &vsid, bsl::safe_u64 const &gpa) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+            bsl::expects(gpa.is_valid_and_checked());
+            bsl::expects(gpa.is_pos());
+            bsl::expects(gpa < MICROV_MAX_GPA_SIZE);
+            bsl::expects(mv_is_page_aligned(gpa));
+
+            mv_status_t const ret{
+                mv_vs_op_set_exit_page_gpa_impl(m_hndl.get(), vsid.get(), gpa.get())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_set_exit_page_gpa failed with status "    // --
+                             << bsl::hex(ret)                                       // --
+                             << bsl::endl                                           // --
+                             << bsl::here();                                        // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies one chunk of the VS's state into the shared page
+        ///     (see mv_vs_state_t). Saving a VS starts with
+        ///     MV_VS_STATE_CHUNK_CPU and keeps going with the returned chunk
+        ///     until MV_VS_STATE_NUM_CHUNKS is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to query
+        ///   @param chunk The chunk of the VS's state to get
+        ///   @return Returns the next chunk to get on success, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_state_get_all(bsl::safe_u16 const &vsid, bsl::safe_u64 const &chunk) noexcept
+            -> bsl::safe_u64
+        {
+            bsl::safe_u64 mut_next;
+
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+            bsl::expects(chunk.is_valid_and_checked());
+            bsl::expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+
+            mv_status_t const ret{mv_vs_op_state_get_all_impl(
+                m_hndl.get(), vsid.get(), chunk.get(), mut_next.data())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_state_get_all failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            return mut_next;
+        }
+
+        /// <!-- description -->
+        ///   @brief Restores one chunk of the VS's state from the shared
+        ///     page (see mv_vs_state_t). The chunks must be given back in
+        ///     the order mv_vs_op_state_get_all returned them.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to set
+        ///   @param chunk The chunk of the VS's state to set
+        ///   @return Returns the next chunk to set on success, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mv_vs_op_state_set_all(bsl::safe_u16 const &vsid, bsl::safe_u64 const &chunk) noexcept
+            -> bsl::safe_u64
+        {
+            bsl::safe_u64 mut_next;
+
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != MV_INVALID_ID);
+            bsl::expects(chunk.is_valid_and_checked());
+            bsl::expects(chunk < MV_VS_STATE_NUM_CHUNKS);
+
+            mv_status_t const ret{mv_vs_op_state_set_all_impl(
+                m_hndl.get(), vsid.get(), chunk.get(), mut_next.data())};
+            if (bsl::unlikely(ret != MV_STATUS_SUCCESS)) {
+                bsl::error() << "mv_vs_op_state_set_all failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();                                    // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            return mut_next;
+        }
     };
 }
 
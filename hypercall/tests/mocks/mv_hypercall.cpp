@@ -27,6 +27,7 @@
 #include <mv_cdl_t.h>
 #include <mv_constants.h>
 #include <mv_exit_io_t.h>
+#include <mv_exit_mmio_t.h>
 #include <mv_exit_reason_t.h>
 #include <mv_rdl_t.h>
 #include <mv_reg_t.h>
@@ -49,6 +50,8 @@ namespace shim
         constinit bsl::uint64 g_mut_mv_handle_op_open_handle{};
         constinit mv_status_t g_mut_mv_handle_op_close_handle{};
 
+        constinit mv_status_t g_mut_mv_debug_op_stats_get{};
+
         constinit bsl::uint16 g_mut_mv_pp_op_ppid{};
         constinit mv_status_t g_mut_mv_pp_op_clr_shared_page_gpa{};
         constinit mv_status_t g_mut_mv_pp_op_set_shared_page_gpa{};
@@ -56,12 +59,21 @@ namespace shim
         constinit mv_status_t g_mut_mv_pp_op_msr_get_supported_list{};
         constinit mv_status_t g_mut_mv_pp_op_tsc_get_khz{};
         constinit mv_status_t g_mut_mv_pp_op_tsc_set_khz{};
+        constinit mv_status_t g_mut_mv_pp_op_clr_trace_gpa{};
+        constinit mv_status_t g_mut_mv_pp_op_set_trace_gpa{};
 
         constinit bsl::uint16 g_mut_mv_vm_op_create_vm{};
         constinit mv_status_t g_mut_mv_vm_op_destroy_vm{};
         constinit bsl::uint16 g_mut_mv_vm_op_vmid{};
         constinit mv_status_t g_mut_mv_vm_op_mmio_map{};
         constinit mv_status_t g_mut_mv_vm_op_mmio_unmap{};
+        constinit mv_status_t g_mut_mv_vm_op_irqchip_create{};
+        constinit mv_status_t g_mut_mv_vm_op_irq_line{};
+        constinit mv_status_t g_mut_mv_vm_op_io_permission{};
+        constinit mv_status_t g_mut_mv_vm_op_pause_exiting{};
+        constinit mv_status_t g_mut_mv_vm_op_clock_get{};
+        constinit mv_status_t g_mut_mv_vm_op_clock_set{};
+        constinit mv_status_t g_mut_mv_vm_op_irq_resample{};
 
         constinit bsl::uint16 g_mut_mv_vp_op_create_vp{};
         constinit mv_status_t g_mut_mv_vp_op_destroy_vp{};
@@ -76,6 +88,9 @@ namespace shim
         constinit mv_translation_t g_mut_mv_vs_op_gla_to_gpa{};
         constinit mv_exit_reason_t g_mut_mv_vs_op_run{};
         constinit mv_exit_io_t g_mut_mv_vs_op_run_io{};
+        constinit mv_exit_io_t g_mut_mv_vs_op_run_io_in{};
+        constinit mv_exit_mmio_t g_mut_mv_vs_op_run_mmio{};
+        constinit bsl::uint64 g_mut_mv_vs_op_run_mmio_data{};
         constinit mv_status_t g_mut_mv_vs_op_reg_get{};
         constinit mv_status_t g_mut_mv_vs_op_reg_set{};
         constinit mv_status_t g_mut_mv_vs_op_reg_get_list{};
@@ -89,6 +104,17 @@ namespace shim
         constinit mv_status_t g_mut_mv_vs_op_mp_state_get{};
         constinit mv_status_t g_mut_mv_vs_op_mp_state_set{};
         constinit mv_status_t g_mut_mv_vs_op_tsc_get_khz{};
+        constinit mv_status_t g_mut_mv_vs_op_tsc_set_khz{};
+        constinit mv_status_t g_mut_mv_vs_op_queue_interrupt{};
+        constinit mv_status_t g_mut_mv_vs_op_lapic_get_all{};
+        constinit mv_status_t g_mut_mv_vs_op_lapic_set_all{};
+        constinit mv_status_t g_mut_mv_vs_op_tsc_get_offset{};
+        constinit mv_status_t g_mut_mv_vs_op_tsc_set_offset{};
+        constinit mv_status_t g_mut_mv_vs_op_kvmclock_ctrl{};
+        constinit mv_status_t g_mut_mv_vs_op_clr_exit_page_gpa{};
+        constinit mv_status_t g_mut_mv_vs_op_set_exit_page_gpa{};
+        constinit mv_status_t g_mut_mv_vs_op_state_get_all{};
+        constinit mv_status_t g_mut_mv_vs_op_state_set_all{};
 
         extern bool g_mut_hypervisor_detected;
         extern bool g_mut_platform_alloc_fails;
@@ -152,6 +178,19 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"mv_debug_op_stats_get"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_debug_op_stats_get};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_debug_op_stats_get = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"mv_pp_op_ppid"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 constexpr auto hypercall{&mv_pp_op_ppid};
@@ -223,6 +262,32 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"mv_pp_op_clr_trace_gpa"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_pp_op_clr_trace_gpa};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_pp_op_clr_trace_gpa = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_pp_op_set_trace_gpa"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_pp_op_set_trace_gpa};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_pp_op_set_trace_gpa = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, gpa));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"mv_vm_op_create_vm"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 constexpr auto hypercall{&mv_vm_op_create_vm};
@@ -292,6 +357,108 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"mv_vm_op_irqchip_create"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_irqchip_create};
+                constexpr auto success_attempts{2_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_irqchip_create = success_attempts.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() != hypercall(hndl, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_irq_line"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_irq_line};
+                constexpr auto success_attempts{2_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_irq_line = success_attempts.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}, {}, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() != hypercall(hndl, {}, {}, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_io_permission"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_io_permission};
+                constexpr auto success_attempts{2_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_io_permission = success_attempts.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}, {}, {}, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() != hypercall(hndl, {}, {}, {}, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_pause_exiting"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_pause_exiting};
+                constexpr auto success_attempts{2_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_pause_exiting = success_attempts.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}, {}, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() != hypercall(hndl, {}, {}, {}));
+                        bsl::ut_check(bsl::safe_u64::magic_0() == hypercall(hndl, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_clock_get"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_clock_get};
+                constexpr auto expected{42_u64};
+                bsl::safe_u64 mut_val{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = expected.get();
+                    g_mut_mv_vm_op_clock_get = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, mut_val.data()));
+                        bsl::ut_check(expected == mut_val);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_clock_set"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_clock_set};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_clock_set = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_irq_resample"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vm_op_irq_resample};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_irq_resample = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"mv_vp_op_create_vp"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 constexpr auto hypercall{&mv_vp_op_create_vp};
@@ -487,7 +654,9 @@ namespace shim
             bsl::ut_given{} = [&]() noexcept {
                 constexpr auto hypercall{&mv_vs_op_run};
                 constexpr mv_exit_reason_t expected{mv_exit_reason_t_mmio};
+                mv_exit_mmio_t mut_exit_mmio{};
                 bsl::ut_when{} = [&]() noexcept {
+                    g_mut_shared_pages[0] = &mut_exit_mmio;
                     g_mut_mv_vs_op_run = expected;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(expected == hypercall(hndl, {}));
@@ -648,6 +817,158 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"mv_vs_op_queue_interrupt"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_queue_interrupt};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_queue_interrupt = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_lapic_get_all"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_lapic_get_all};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_lapic_get_all = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_lapic_set_all"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_lapic_set_all};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_lapic_set_all = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_tsc_set_khz"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_tsc_set_khz};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_tsc_set_khz = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, expected.get()));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_tsc_get_offset"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_tsc_get_offset};
+                constexpr auto expected{42_u64};
+                bsl::safe_u64 mut_val{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = expected.get();
+                    g_mut_mv_vs_op_tsc_get_offset = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, mut_val.data()));
+                        bsl::ut_check(expected == mut_val);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_tsc_set_offset"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_tsc_set_offset};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_tsc_set_offset = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_kvmclock_ctrl"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_kvmclock_ctrl};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_kvmclock_ctrl = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_clr_exit_page_gpa"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_clr_exit_page_gpa};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_clr_exit_page_gpa = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_set_exit_page_gpa"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_set_exit_page_gpa};
+                constexpr auto expected{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_set_exit_page_gpa = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, gpa));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_state_get_all"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_state_get_all};
+                constexpr auto expected{42_u64};
+                bsl::safe_u64 mut_val{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = expected.get();
+                    g_mut_mv_vs_op_state_get_all = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}, mut_val.data()));
+                        bsl::ut_check(expected == mut_val);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_state_set_all"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto hypercall{&mv_vs_op_state_set_all};
+                constexpr auto expected{42_u64};
+                bsl::safe_u64 mut_val{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = expected.get();
+                    g_mut_mv_vs_op_state_set_all = expected.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(expected == hypercall(hndl, {}, {}, mut_val.data()));
+                        bsl::ut_check(expected == mut_val);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
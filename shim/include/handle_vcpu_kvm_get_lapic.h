@@ -29,6 +29,7 @@
 
 #include <kvm_lapic_state.h>
 #include <mv_types.h>
+#include <shim_vcpu_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -40,11 +41,13 @@ extern "C"
      *   @brief Handles the execution of kvm_get_lapic.
      *
      * <!-- inputs/outputs -->
+     *   @param vcpu to get vsid to pass to hypercall
      *   @param pmut_ioctl_args the arguments provided by userspace
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t
-    handle_vcpu_kvm_get_lapic(struct kvm_lapic_state *const pmut_ioctl_args) NOEXCEPT;
+    NODISCARD int64_t handle_vcpu_kvm_get_lapic(
+        struct shim_vcpu_t const *const vcpu,
+        struct kvm_lapic_state *const pmut_ioctl_args) NOEXCEPT;
 
 #ifdef __cplusplus
 }
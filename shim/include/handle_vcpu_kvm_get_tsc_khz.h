@@ -28,6 +28,7 @@
 #define HANDLE_VCPU_KVM_GET_TSC_KHZ_H
 
 #include <mv_types.h>
+#include <shim_vcpu_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -39,10 +40,12 @@ extern "C"
      *   @brief Handles the execution of kvm_get_tsc_khz.
      *
      * <!-- inputs/outputs -->
+     *   @param vcpu to pass the vsid to hypercall
      *   @param pmut_tsc_khz returns the virtual tsc khz
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t handle_vcpu_kvm_get_tsc_khz(uint64_t *const pmut_tsc_khz) NOEXCEPT;
+    NODISCARD int64_t handle_vcpu_kvm_get_tsc_khz(
+        struct shim_vcpu_t const *const vcpu, uint64_t *const pmut_tsc_khz) NOEXCEPT;
 
 #ifdef __cplusplus
 }
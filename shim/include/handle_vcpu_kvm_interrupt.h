@@ -29,6 +29,7 @@
 
 #include <kvm_interrupt.h>
 #include <mv_types.h>
+#include <shim_vcpu_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -40,11 +41,12 @@ extern "C"
      *   @brief Handles the execution of kvm_interrupt.
      *
      * <!-- inputs/outputs -->
-     *   @param pmut_ioctl_args the arguments provided by userspace
+     *   @param vcpu to get vsid to pass to hypercall
+     *   @param args the arguments provided by userspace
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t
-    handle_vcpu_kvm_interrupt(struct kvm_interrupt *const pmut_ioctl_args) NOEXCEPT;
+    NODISCARD int64_t handle_vcpu_kvm_interrupt(
+        struct shim_vcpu_t const *const vcpu, struct kvm_interrupt const *const args) NOEXCEPT;
 
 #ifdef __cplusplus
 }
@@ -28,6 +28,7 @@
 #define HANDLE_VCPU_KVM_KVMCLOCK_CTRL_H
 
 #include <mv_types.h>
+#include <shim_vcpu_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -39,9 +40,10 @@ extern "C"
      *   @brief Handles the execution of kvm_kvmclock_ctrl.
      *
      * <!-- inputs/outputs -->
+     *   @param vcpu the vCPU that was paused
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t handle_vcpu_kvm_kvmclock_ctrl(void) NOEXCEPT;
+    NODISCARD int64_t handle_vcpu_kvm_kvmclock_ctrl(struct shim_vcpu_t const *const vcpu) NOEXCEPT;
 
 #ifdef __cplusplus
 }
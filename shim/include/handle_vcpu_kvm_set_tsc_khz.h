@@ -28,6 +28,7 @@
 #define HANDLE_VCPU_KVM_SET_TSC_KHZ_H
 
 #include <mv_types.h>
+#include <shim_vcpu_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -39,9 +40,12 @@ extern "C"
      *   @brief Handles the execution of kvm_set_tsc_khz.
      *
      * <!-- inputs/outputs -->
+     *   @param vcpu to pass the vsid to hypercall
+     *   @param tsc_khz the virtual tsc khz provided by userspace
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t handle_vcpu_kvm_set_tsc_khz(void) NOEXCEPT;
+    NODISCARD int64_t handle_vcpu_kvm_set_tsc_khz(
+        struct shim_vcpu_t const *const vcpu, uint64_t const tsc_khz) NOEXCEPT;
 
 #ifdef __cplusplus
 }
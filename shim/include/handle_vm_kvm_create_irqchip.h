@@ -28,6 +28,7 @@
 #define HANDLE_VM_KVM_CREATE_IRQCHIP_H
 
 #include <mv_types.h>
+#include <shim_vm_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -39,9 +40,10 @@ extern "C"
      *   @brief Handles the execution of kvm_create_irqchip.
      *
      * <!-- inputs/outputs -->
+     *   @param pmut_vm the VM to create the irqchip for
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t handle_vm_kvm_create_irqchip(void) NOEXCEPT;
+    NODISCARD int64_t handle_vm_kvm_create_irqchip(struct shim_vm_t *const pmut_vm) NOEXCEPT;
 
 #ifdef __cplusplus
 }
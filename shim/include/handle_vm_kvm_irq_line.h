@@ -29,6 +29,7 @@
 
 #include <kvm_irq_level.h>
 #include <mv_types.h>
+#include <shim_vm_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -40,10 +41,12 @@ extern "C"
      *   @brief Handles the execution of kvm_irq_line.
      *
      * <!-- inputs/outputs -->
-     *   @param pmut_ioctl_args the arguments provided by userspace
+     *   @param pmut_vm the VM whose interrupt line is being set
+     *   @param args the arguments provided by userspace
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t handle_vm_kvm_irq_line(struct kvm_irq_level *const pmut_ioctl_args) NOEXCEPT;
+    NODISCARD int64_t handle_vm_kvm_irq_line(
+        struct shim_vm_t *const pmut_vm, struct kvm_irq_level const *const args) NOEXCEPT;
 
 #ifdef __cplusplus
 }
@@ -29,6 +29,7 @@
 
 #include <kvm_irqfd.h>
 #include <mv_types.h>
+#include <shim_vm_t.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -40,10 +41,12 @@ extern "C"
      *   @brief Handles the execution of kvm_irqfd.
      *
      * <!-- inputs/outputs -->
-     *   @param pmut_ioctl_args the arguments provided by userspace
+     *   @param pmut_vm the VM to add the irqfd to, or remove it from
+     *   @param args the arguments provided by userspace
      *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
      */
-    NODISCARD int64_t handle_vm_kvm_irqfd(struct kvm_irqfd *const pmut_ioctl_args) NOEXCEPT;
+    NODISCARD int64_t handle_vm_kvm_irqfd(
+        struct shim_vm_t *const pmut_vm, struct kvm_irqfd const *const args) NOEXCEPT;
 
 #ifdef __cplusplus
 }
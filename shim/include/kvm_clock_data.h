@@ -44,8 +44,18 @@ extern "C"
      */
     struct kvm_clock_data
     {
-        /** @brief replace me with contents from KVM API */
-        int32_t dummy;
+        /** @brief the kvmclock in nanoseconds */
+        uint64_t clock;
+        /** @brief the KVM_CLOCK_ flags describing the other fields */
+        uint32_t flags;
+        /** @brief padding */
+        uint32_t pad0;
+        /** @brief the wall clock time in nanoseconds at "clock" */
+        uint64_t realtime;
+        /** @brief the host TSC at "clock" */
+        uint64_t host_tsc;
+        /** @brief padding */
+        uint32_t pad[4];
     };
 
 #pragma pack(pop)
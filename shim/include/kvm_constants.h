@@ -52,18 +52,30 @@ extern "C"
 #define KVM_CAP_DESTROY_MEMORY_REGION_WORKS 21
 /** @brief defines KVM_CAP_JOIN_MEMORY_REGIONS_WORKS for check extension */
 #define KVM_CAP_JOIN_MEMORY_REGIONS_WORKS 30
+/** @brief defines KVM_CAP_ADJUST_CLOCK for check extension */
+#define KVM_CAP_ADJUST_CLOCK 39
 /** @brief defines KVM_CAP_MCE for check extension */
 #define KVM_CAP_MCE 31
+/** @brief defines KVM_CAP_IRQFD for check extension */
+#define KVM_CAP_IRQFD 32
 /** @brief defines KVM_CAP_GET_TSC_KHZ for check extension */
 #define KVM_CAP_GET_TSC_KHZ 61
 /** @brief defines KVM_CAP_MAX_VCPUS for check extension */
 #define KVM_CAP_MAX_VCPUS 66
 /** @brief defines KVM_CAP_TSC_DEADLINE_TIMER for check extension */
 #define KVM_CAP_TSC_DEADLINE_TIMER 72
+/** @brief defines KVM_CAP_SYNC_REGS for check extension */
+#define KVM_CAP_SYNC_REGS 74
+/** @brief defines KVM_CAP_KVMCLOCK_CTRL for check extension */
+#define KVM_CAP_KVMCLOCK_CTRL 76
+/** @brief defines KVM_CAP_IRQFD_RESAMPLE for check extension */
+#define KVM_CAP_IRQFD_RESAMPLE 82
 /** @brief defines KVM_CAP_MAX_VCPU_ID for check extension */
 #define KVM_CAP_MAX_VCPU_ID 128
 /** @brief defines KVM_CAP_IMMEDIATE_EXIT for check extension */
 #define KVM_CAP_IMMEDIATE_EXIT 136
+/** @brief defines KVM_CAP_BINARY_STATS_FD for check extension */
+#define KVM_CAP_BINARY_STATS_FD 203
 /** @brief defines MICROV_MAX_MCE_BANKS  */
 #define MICROV_MAX_MCE_BANKS 32
 /** @brief defines KVM_MP_STATE_RUNNABLE for mp state */
@@ -76,6 +88,26 @@ extern "C"
 #define KVM_MP_STATE_HALTED 3
 /** @brief defines KVM_MP_STATE_SIPI_RECEIVED for mp state */
 #define KVM_MP_STATE_SIPI_RECEIVED 4
+/** @brief defines KVM_CLOCK_TSC_STABLE for kvm_clock_data */
+#define KVM_CLOCK_TSC_STABLE 2
+/** @brief defines KVM_CLOCK_REALTIME for kvm_clock_data */
+#define KVM_CLOCK_REALTIME 4
+/** @brief defines the size of the names in the binary stats (id and descriptors) */
+#define KVM_STATS_NAME_SIZE 48
+/** @brief defines KVM_STATS_TYPE_CUMULATIVE for kvm_stats_desc */
+#define KVM_STATS_TYPE_CUMULATIVE (0x0U << 0U)
+/** @brief defines KVM_STATS_TYPE_LINEAR_HIST for kvm_stats_desc */
+#define KVM_STATS_TYPE_LINEAR_HIST (0x3U << 0U)
+/** @brief defines KVM_STATS_TYPE_LOG_HIST for kvm_stats_desc */
+#define KVM_STATS_TYPE_LOG_HIST (0x4U << 0U)
+/** @brief defines KVM_STATS_UNIT_NONE for kvm_stats_desc */
+#define KVM_STATS_UNIT_NONE (0x0U << 4U)
+/** @brief defines KVM_STATS_UNIT_CYCLES for kvm_stats_desc */
+#define KVM_STATS_UNIT_CYCLES (0x3U << 4U)
+/** @brief defines KVM_STATS_BASE_POW10 for kvm_stats_desc */
+#define KVM_STATS_BASE_POW10 (0x0U << 8U)
+/** @brief defines KVM_STATS_BASE_POW2 for kvm_stats_desc */
+#define KVM_STATS_BASE_POW2 (0x1U << 8U)
 
 #pragma pack(pop)
 
@@ -51,12 +51,18 @@ namespace shim
     constexpr auto KVM_CAP_JOIN_MEMORY_REGIONS_WORKS{1_i64};
     /// @brief defines the size of the KVM_CAP_MCE
     constexpr auto KVM_CAP_MCE{32_i64};
+    /// @brief defines the size of the KVM_CAP_IRQFD
+    constexpr auto KVM_CAP_IRQFD{1_i64};
     /// @brief defines the size of the KVM_CAP_GET_TSC_KHZ
     constexpr auto KVM_CAP_GET_TSC_KHZ{1_i64};
     /// @brief defines the size of the KVM_CAP_MAX_VCPUS
     constexpr auto KVM_CAP_MAX_VCPUS{128_i64};
     /// @brief defines the size of the KVM_CAP_TSC_DEADLINE_TIMER
     constexpr auto KVM_CAP_TSC_DEADLINE_TIMER{1_i64};
+    /// @brief defines the size of the KVM_CAP_SYNC_REGS
+    constexpr auto KVM_CAP_SYNC_REGS{1_i64};
+    /// @brief defines the size of the KVM_CAP_IRQFD_RESAMPLE
+    constexpr auto KVM_CAP_IRQFD_RESAMPLE{1_i64};
     /// @brief defines the size of the KVM_CAP_MAX_VCPU_ID
     constexpr auto KVM_CAP_MAX_VCPU_ID{32767_i64};
     /// @brief defines the size of the KVM_CAP_UNSUPPORTED
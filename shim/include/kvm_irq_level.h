@@ -44,8 +44,10 @@ extern "C"
      */
     struct kvm_irq_level
     {
-        /** @brief replace me with contents from KVM API */
-        int32_t dummy;
+        /** @brief the GSI to set (shares storage with status in KVM) */
+        uint32_t irq;
+        /** @brief the new level of the GSI */
+        uint32_t level;
     };
 
 #pragma pack(pop)
@@ -36,6 +36,14 @@ extern "C"
 
 #pragma pack(push, 1)
 
+/** @brief defines the size of the pad field in kvm_irqfd */
+#define KVM_IRQFD_PAD_SIZE ((uint64_t)16)
+
+/** @brief removes the irqfd instead of adding it */
+#define KVM_IRQFD_FLAG_DEASSIGN ((uint32_t)0x00000001)
+/** @brief signals resamplefd when the GSI is EOI'd (level triggered GSIs) */
+#define KVM_IRQFD_FLAG_RESAMPLE ((uint32_t)0x00000002)
+
     /**
      * @struct kvm_irqfd
      *
@@ -44,8 +52,16 @@ extern "C"
      */
     struct kvm_irqfd
     {
-        /** @brief replace me with contents from KVM API */
-        int32_t dummy;
+        /** @brief stores the eventfd that injects gsi when signaled */
+        uint32_t fd;
+        /** @brief stores the GSI to inject */
+        uint32_t gsi;
+        /** @brief stores the KVM_IRQFD_FLAG_ flags */
+        uint32_t flags;
+        /** @brief stores the eventfd signaled on EOI (KVM_IRQFD_FLAG_RESAMPLE) */
+        uint32_t resamplefd;
+        /** @brief reserved */
+        uint8_t pad[KVM_IRQFD_PAD_SIZE];
     };
 
 #pragma pack(pop)
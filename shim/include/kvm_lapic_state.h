@@ -29,6 +29,10 @@
 
 #include <stdint.h>
 
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -36,6 +40,9 @@ extern "C"
 
 #pragma pack(push, 1)
 
+/** @brief defines the size of the LAPIC's register page stored by KVM */
+#define KVM_APIC_REG_SIZE ((uint64_t)0x400)
+
     /**
      * @struct kvm_lapic_state
      *
@@ -44,8 +51,8 @@ extern "C"
      */
     struct kvm_lapic_state
     {
-        /** @brief replace me with contents from KVM API */
-        int32_t dummy;
+        /** @brief stores the first 1k of the LAPIC's xAPIC MMIO page */
+        char regs[KVM_APIC_REG_SIZE];
     };
 
 #pragma pack(pop)
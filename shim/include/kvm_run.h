@@ -34,6 +34,7 @@
 #include <kvm_run_mmio.h>
 #include <kvm_run_system_event.h>
 #include <kvm_run_tpr_access.h>
+#include <kvm_sync_regs.h>
 #include <mv_types.h>
 #include <stdint.h>
 
@@ -50,6 +51,10 @@ extern "C"
 #define KVM_RUN_PADDING2_SIZE ((uint64_t)256)
 /** @brief defines the size of the padding3 field */
 #define KVM_RUN_PADDING3_SIZE ((uint64_t)2048)
+/** @brief defines the size of the padding4 field (pads pio_data to 0x1000) */
+#define KVM_RUN_PADDING4_SIZE ((uint64_t)1744)
+/** @brief defines the size of the pio_data field */
+#define KVM_RUN_PIO_DATA_SIZE ((uint64_t)4096)
 
 /** @brief defines KVM_EXIT_UNKNOWN kvm_run.exit_reason */
 #define KVM_EXIT_UNKNOWN 0U
@@ -121,13 +126,24 @@ extern "C"
             char padding2[KVM_RUN_PADDING2_SIZE];
         };
 
-        /** @brief TODO */
+        /** @brief stores the KVM_SYNC_X86_ groups to fill in on exit */
         uint64_t kvm_valid_regs;
-        /** @brief TODO */
+        /** @brief stores the KVM_SYNC_X86_ groups to write on entry */
         uint64_t kvm_dirty_regs;
 
-        /** @brief TODO */
-        char padding3[KVM_RUN_PADDING3_SIZE];
+        /** @brief stores the registers shared with userspace (KVM_CAP_SYNC_REGS) */
+        union
+        {
+            /** @brief stores the registers selected by kvm_valid_regs/kvm_dirty_regs */
+            struct kvm_sync_regs regs;
+            /** @brief TODO */
+            char padding3[KVM_RUN_PADDING3_SIZE];
+        } s;
+
+        /** @brief pads pio_data so that it starts on the second page */
+        char padding4[KVM_RUN_PADDING4_SIZE];
+        /** @brief stores the elements of a string IO (KVM_PIO_PAGE_OFFSET) */
+        uint8_t pio_data[KVM_RUN_PIO_DATA_SIZE];
     };
 
 #pragma pack(pop)
@@ -32,6 +32,7 @@
 #include <kvm_run_mmio.hpp>
 #include <kvm_run_system_event.hpp>
 #include <kvm_run_tpr_access.hpp>
+#include <kvm_sync_regs.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -47,6 +48,10 @@ namespace shim
     constexpr auto KVM_RUN_PADDING2_SIZE{256_umx};
     /// @brief defines the size of the padding3 field
     constexpr auto KVM_RUN_PADDING3_SIZE{2048_umx};
+    /// @brief defines the size of the padding4 field (pads pio_data to 0x1000)
+    constexpr auto KVM_RUN_PADDING4_SIZE{1744_umx};
+    /// @brief defines the size of the pio_data field
+    constexpr auto KVM_RUN_PIO_DATA_SIZE{4096_umx};
 
     /// @brief defines KVM_EXIT_UNKNOWN kvm_run.exit_reason
     constexpr auto KVM_EXIT_UNKNOWN{0_u32};
@@ -116,13 +121,24 @@ namespace shim
             bsl::array<bsl::uint8, KVM_RUN_PADDING2_SIZE.get()> padding2;
         };
 
-        /// @brief TODO
+        /// @brief stores the KVM_SYNC_X86_ groups to fill in on exit
         bsl::uint64 kvm_valid_regs;
-        /// @brief TODO
+        /// @brief stores the KVM_SYNC_X86_ groups to write on entry
         bsl::uint64 kvm_dirty_regs;
 
-        /// @brief TODO
-        bsl::array<bsl::uint8, KVM_RUN_PADDING3_SIZE.get()> padding3;
+        /// @brief stores the registers shared with userspace (KVM_CAP_SYNC_REGS)
+        union
+        {
+            /// @brief stores the registers selected by kvm_valid_regs/kvm_dirty_regs
+            kvm_sync_regs regs;
+            /// @brief TODO
+            bsl::array<bsl::uint8, KVM_RUN_PADDING3_SIZE.get()> padding3;
+        } s;
+
+        /// @brief pads pio_data so that it starts on the second page
+        bsl::array<bsl::uint8, KVM_RUN_PADDING4_SIZE.get()> padding4;
+        /// @brief stores the elements of a string IO (KVM_PIO_PAGE_OFFSET)
+        bsl::array<bsl::uint8, KVM_RUN_PIO_DATA_SIZE.get()> pio_data;
     };
 }
 
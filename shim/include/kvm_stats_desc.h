@@ -0,0 +1,70 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef KVM_STATS_DESC_H
+#define KVM_STATS_DESC_H
+
+#include <kvm_constants.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+    /**
+     * @struct kvm_stats_desc
+     *
+     * <!-- description -->
+     *   @brief see /include/uapi/linux/kvm.h in Linux for more details.
+     *     Unlike Linux, the name is always KVM_STATS_NAME_SIZE bytes,
+     *     which is the name_size the shim reports.
+     */
+    struct kvm_stats_desc
+    {
+        /** @brief the KVM_STATS_TYPE/UNIT/BASE_ flags of the stat */
+        uint32_t flags;
+        /** @brief the exponent of the stat's unit */
+        int16_t exponent;
+        /** @brief the number of uint64_t values in the stat */
+        uint16_t size;
+        /** @brief the offset of the stat from the start of the data */
+        uint32_t offset;
+        /** @brief the bucket size of a linear histogram */
+        uint32_t bucket_size;
+        /** @brief the name of the stat */
+        char name[KVM_STATS_NAME_SIZE];
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
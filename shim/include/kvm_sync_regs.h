@@ -0,0 +1,73 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef KVM_SYNC_REGS_H
+#define KVM_SYNC_REGS_H
+
+#include <kvm_regs.h>
+#include <kvm_sregs.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines KVM_SYNC_X86_REGS for kvm_run.kvm_valid_regs/kvm_dirty_regs */
+#define KVM_SYNC_X86_REGS ((uint64_t)0x0000000000000001)
+/** @brief defines KVM_SYNC_X86_SREGS for kvm_run.kvm_valid_regs/kvm_dirty_regs */
+#define KVM_SYNC_X86_SREGS ((uint64_t)0x0000000000000002)
+/** @brief defines KVM_SYNC_X86_EVENTS for kvm_run.kvm_valid_regs/kvm_dirty_regs */
+#define KVM_SYNC_X86_EVENTS ((uint64_t)0x0000000000000004)
+/** @brief defines the KVM_SYNC_X86_ groups the shim supports */
+#define KVM_SYNC_X86_VALID_FIELDS KVM_SYNC_X86_REGS
+
+    /**
+     * @struct kvm_sync_regs
+     *
+     * <!-- description -->
+     *   @brief see /include/uapi/linux/kvm.h in Linux for more details.
+     *     Only "regs" is supported (see KVM_SYNC_X86_VALID_FIELDS). The
+     *     vcpu events that follow "sregs" in KVM are not part of this
+     *     structure, and are left in kvm_run's padding.
+     */
+    struct kvm_sync_regs
+    {
+        /** @brief stores the registers of KVM_SYNC_X86_REGS */
+        struct kvm_regs regs;
+        /** @brief stores the registers of KVM_SYNC_X86_SREGS */
+        struct kvm_sregs sregs;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
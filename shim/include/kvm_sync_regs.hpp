@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef KVM_SYNC_REGS_HPP
+#define KVM_SYNC_REGS_HPP
+
+#include <kvm_regs.hpp>
+#include <kvm_sregs.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace shim
+{
+    /// @brief defines KVM_SYNC_X86_REGS for kvm_run.kvm_valid_regs/kvm_dirty_regs
+    constexpr auto KVM_SYNC_X86_REGS{0x0000000000000001_u64};
+    /// @brief defines KVM_SYNC_X86_SREGS for kvm_run.kvm_valid_regs/kvm_dirty_regs
+    constexpr auto KVM_SYNC_X86_SREGS{0x0000000000000002_u64};
+    /// @brief defines KVM_SYNC_X86_EVENTS for kvm_run.kvm_valid_regs/kvm_dirty_regs
+    constexpr auto KVM_SYNC_X86_EVENTS{0x0000000000000004_u64};
+
+    /// @struct kvm_sync_regs
+    ///
+    /// <!-- description -->
+    ///   @brief see /include/uapi/linux/kvm.h in Linux for more details.
+    ///     Only "regs" is supported by the shim.
+    ///
+    struct kvm_sync_regs final
+    {
+        /// @brief stores the registers of KVM_SYNC_X86_REGS
+        kvm_regs regs;
+        /// @brief stores the registers of KVM_SYNC_X86_SREGS
+        kvm_sregs sregs;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -32,11 +32,15 @@
 #if defined(WINDOWS_KERNEL)
 #include <wdm.h>
 typedef FAST_MUTEX platform_mutex;
+typedef KEVENT platform_waitq;
 #elif defined(LINUX_KERNEL)
 #include <linux/mutex.h>
+#include <linux/wait.h>
 typedef struct mutex platform_mutex;
+typedef wait_queue_head_t platform_waitq;
 #else
 typedef uint64_t platform_mutex;
+typedef uint64_t platform_waitq;
 #endif
 
 #ifdef __cplusplus
@@ -50,6 +54,8 @@ namespace shim
 #define PLATFORM_FORWARD ((uint32_t)0U)
 /** @brief execute each CPU in reverse order (i.e., decrementing) */
 #define PLATFORM_REVERSE ((uint32_t)1U)
+/** @brief tells platform_waitq_wait to wait without a timeout */
+#define PLATFORM_WAIT_FOREVER ((uint64_t)0xFFFFFFFFFFFFFFFFU)
 
         /**
          * <!-- description -->
@@ -318,6 +324,197 @@ namespace shim
          */
         NODISCARD uint64_t platform_tsc_khz(void) NOEXCEPT;
 
+        /**
+         * <!-- description -->
+         *   @brief Returns the current wall clock time in nanoseconds
+         *     since the epoch.
+         *
+         * <!-- inputs/outputs -->
+         *   @return Returns the current wall clock time in nanoseconds
+         *     since the epoch.
+         */
+        NODISCARD uint64_t platform_realtime_ns(void) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Returns an ID for the thread this is called from that
+         *     can later be given to platform_yield_to. 0 is never a valid
+         *     thread ID.
+         *
+         * <!-- inputs/outputs -->
+         *   @return Returns an ID for the thread this is called from
+         */
+        NODISCARD uint64_t platform_current_thread(void) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Gives the rest of the current thread's time slice to the
+         *     provided thread. Returns SHIM_FAILURE if the thread does not
+         *     exist or is not waiting to run, in which case nothing
+         *     happens.
+         *
+         * <!-- inputs/outputs -->
+         *   @param thread the ID of the thread (from platform_current_thread)
+         *     to yield to
+         *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+         */
+        NODISCARD int64_t platform_yield_to(uint64_t const thread) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Interrupts the provided thread if it is running so that
+         *     it goes back through the scheduler (e.g., so that a VCPU
+         *     thread leaves its guest). Nothing happens if the thread does
+         *     not exist or is not running. This can be called from any
+         *     context, including atomic ones.
+         *
+         * <!-- inputs/outputs -->
+         *   @param thread the ID of the thread (from platform_current_thread)
+         *     to kick
+         */
+        void platform_kick_thread(uint64_t const thread) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Initializes a wait queue. This must be called before a
+         *     wait queue can be used.
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_waitq the wait queue to initialize
+         */
+        void platform_waitq_init(platform_waitq *const pmut_waitq) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Puts the current thread to sleep on the provided wait
+         *     queue until the provided flag is set (see platform_waitq_wake),
+         *     the timeout expires, or the thread is interrupted. The flag is
+         *     cleared before this returns. Returns SHIM_INTERRUPTED if the
+         *     thread was interrupted, SHIM_SUCCESS otherwise.
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_waitq the wait queue to sleep on
+         *   @param pmut_flag the flag to wait for
+         *   @param timeout_ns the maximum number of nanoseconds to sleep
+         *     for, or PLATFORM_WAIT_FOREVER
+         *   @return Returns SHIM_INTERRUPTED if the thread was interrupted,
+         *     SHIM_SUCCESS otherwise.
+         */
+        NODISCARD int64_t platform_waitq_wait(
+            platform_waitq *const pmut_waitq,
+            uint64_t *const pmut_flag,
+            uint64_t const timeout_ns) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Sets the provided flag and wakes up the thread sleeping
+         *     on the provided wait queue, if there is one. If no thread is
+         *     sleeping, the next platform_waitq_wait returns right away.
+         *     This can be called from any context, including atomic ones.
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_waitq the wait queue to wake up
+         *   @param pmut_flag the flag to set
+         */
+        void
+        platform_waitq_wake(platform_waitq *const pmut_waitq, uint64_t *const pmut_flag) NOEXCEPT;
+
+        /**
+         * @brief The callback signature for platform_eventfd_watch
+         */
+        typedef void (*platform_eventfd_func)(void *const) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Prepares a watch that calls pmut_func with pmut_arg each
+         *     time the provided eventfd is signaled, once it is started using
+         *     platform_eventfd_watch_start. fd is only resolved here, so the
+         *     eventfd returned by platform_eventfd_watch_eventfd is always
+         *     the one that is watched. Returns NULL if fd is not an eventfd.
+         *
+         * <!-- inputs/outputs -->
+         *   @param fd the file descriptor of the eventfd to watch
+         *   @param pmut_func the function to call when the eventfd is
+         *     signaled
+         *   @param pmut_arg the argument to pass to pmut_func
+         *   @return Returns a handle to the watch on success, NULL on
+         *     failure.
+         */
+        NODISCARD void *platform_eventfd_watch(
+            uint64_t const fd,
+            platform_eventfd_func const pmut_func,
+            void *const pmut_arg) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Returns the eventfd of the provided watch. The result can
+         *     be compared with the handles returned by platform_eventfd_get,
+         *     and is valid until the watch is stopped.
+         *
+         * <!-- inputs/outputs -->
+         *   @param watch the watch (from platform_eventfd_watch)
+         *   @return Returns the eventfd of the provided watch.
+         */
+        NODISCARD void *platform_eventfd_watch_eventfd(void const *const watch) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Starts a watch from platform_eventfd_watch. From here on,
+         *     the watch's function is called each time the eventfd is
+         *     signaled, as well as right away if it already is. It is called
+         *     from the context of whoever signaled the eventfd, which can be
+         *     an atomic one, so it must not sleep.
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_watch the watch (from platform_eventfd_watch) to start
+         */
+        void platform_eventfd_watch_start(void *const pmut_watch) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Stops watching an eventfd and releases the watch, whether
+         *     or not it was started. Once this returns, the watch's callback
+         *     is no longer running, and will not be called again.
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_watch the watch (from platform_eventfd_watch) to
+         *     stop
+         */
+        void platform_eventfd_unwatch(void *const pmut_watch) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Returns a handle to the provided eventfd that can be
+         *     signaled using platform_eventfd_signal, even after userspace
+         *     closes the file descriptor. Returns NULL if fd is not an
+         *     eventfd.
+         *
+         * <!-- inputs/outputs -->
+         *   @param fd the file descriptor of the eventfd
+         *   @return Returns a handle to the eventfd on success, NULL on
+         *     failure.
+         */
+        NODISCARD void *platform_eventfd_get(uint64_t const fd) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Releases a handle from platform_eventfd_get.
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_eventfd the handle to release
+         */
+        void platform_eventfd_put(void *const pmut_eventfd) NOEXCEPT;
+
+        /**
+         * <!-- description -->
+         *   @brief Signals an eventfd (i.e., adds 1 to its counter).
+         *
+         * <!-- inputs/outputs -->
+         *   @param pmut_eventfd the handle (from platform_eventfd_get) of
+         *     the eventfd to signal
+         */
+        void platform_eventfd_signal(void *const pmut_eventfd) NOEXCEPT;
+
 #ifdef __cplusplus
     }
 }
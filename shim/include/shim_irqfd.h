@@ -0,0 +1,89 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHIM_IRQFD_H
+#define SHIM_IRQFD_H
+
+#include <mv_types.h>
+#include <shim_irqfd_t.h>
+#include <shim_vm_t.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * <!-- description -->
+     *   @brief Called by the platform each time the eventfd of an irqfd is
+     *     signaled. Raises the irqfd's GSI (and lowers it again unless it
+     *     is resampled), and then kicks the VM's VCPUs so that they pick
+     *     up the interrupt. This can be called from any context,
+     *     including atomic ones, so it must not sleep.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_irqfd the shim_irqfd_t whose eventfd was signaled
+     */
+    void shim_irqfd_signal(void *const pmut_irqfd) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Stops watching the eventfds of the provided irqfd and marks
+     *     it as unused. The VM's mutex must be held.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_irqfd the shim_irqfd_t to free
+     */
+    void shim_irqfd_free(struct shim_irqfd_t *const pmut_irqfd) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Signals the resamplefd of each of the VM's irqfds whose
+     *     GSI was resampled (see mv_vm_op_irq_resample).
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_vm the VM whose GSIs were resampled
+     *   @param resampled the resampled GSIs (bit n is GSI n) returned by
+     *     mv_vs_op_run in mv_run_t
+     */
+    void shim_irqfd_resample(struct shim_vm_t *const pmut_vm, uint64_t const resampled) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Frees all of the VM's irqfds. This must be done before the
+     *     VM is destroyed.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_vm the VM whose irqfds are freed
+     */
+    void shim_irqfd_release(struct shim_vm_t *const pmut_vm) NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHIM_IRQFD_T_H
+#define SHIM_IRQFD_T_H
+
+#include <mv_types.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines the max number of irqfds a VM can have */
+#define SHIM_MAX_IRQFDS ((uint64_t)32)
+/** @brief defines the number of GSIs an irqfd can inject (IOAPIC pins) */
+#define SHIM_IRQFD_NUM_GSIS ((uint64_t)24)
+
+    /** prototype */
+    struct shim_vm_t;
+
+    /**
+     * @struct shim_irqfd_t
+     *
+     * <!-- description -->
+     *   @brief Represents an irqfd (see KVM_IRQFD). Signaling the eventfd
+     *     injects the GSI from the context of whoever signaled it, without
+     *     going through userspace. An irqfd is in use if vm is not NULL.
+     */
+    struct shim_irqfd_t
+    {
+        /** @brief stores the VM the GSI is injected into (NULL if unused) */
+        struct shim_vm_t *vm;
+        /** @brief stores the eventfd that injects the GSI (owned by watch) */
+        void *eventfd;
+        /** @brief stores the GSI to inject */
+        uint64_t gsi;
+        /** @brief stores the KVM_IRQFD_FLAG_ flags the irqfd was added with */
+        uint64_t flags;
+        /** @brief stores the platform's watch on fd */
+        void *watch;
+        /** @brief stores the eventfd signaled on EOI (KVM_IRQFD_FLAG_RESAMPLE) */
+        void *resample;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
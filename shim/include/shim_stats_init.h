@@ -0,0 +1,60 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHIM_STATS_INIT_H
+#define SHIM_STATS_INIT_H
+
+#include <mv_types.h>
+#include <shim_stats_t.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * <!-- description -->
+     *   @brief Clears a shim_stats_t and fills in its header, its id
+     *     (i.e., prefix followed by the decimal id) and its descriptors.
+     *     The data is left at 0 for the caller to fill in.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_stats the shim_stats_t to initialize
+     *   @param prefix the prefix of the id string
+     *   @param prefix_size the number of characters in prefix
+     *   @param id the ID of the VM or VCPU the stats are for
+     */
+    void shim_stats_init(
+        struct shim_stats_t *const pmut_stats,
+        char const *const prefix,
+        uint64_t const prefix_size,
+        uint64_t const id) NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
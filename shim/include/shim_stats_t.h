@@ -0,0 +1,81 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHIM_STATS_T_H
+#define SHIM_STATS_T_H
+
+#include <kvm_constants.h>
+#include <kvm_stats_desc.h>
+#include <kvm_stats_header.h>
+#include <mv_stats_t.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines the number of descriptors in a shim_stats_t */
+#define SHIM_STATS_NUM_DESC ((uint64_t)16)
+
+    /**
+     * @struct shim_stats_t
+     *
+     * <!-- description -->
+     *   @brief Stores the binary stats that are read from the file
+     *     descriptor returned by KVM_GET_STATS_FD. The data is the VMExit,
+     *     hypercall, halt-polling and extended state statistics MicroV
+     *     keeps (see
+     *     mv_debug_op_stats_get) and is laid out so that each mv_stats_t
+     *     field is one stat.
+     */
+    struct shim_stats_t
+    {
+        /** @brief stores the binary stats header */
+        struct kvm_stats_header header;
+        /** @brief stores the id string of the binary stats */
+        char id[KVM_STATS_NAME_SIZE];
+        /** @brief stores the binary stats descriptors */
+        struct kvm_stats_desc descs[SHIM_STATS_NUM_DESC];
+        /** @brief stores the VMExit statistics */
+        struct mv_stats_t exits;
+        /** @brief stores the hypercall statistics */
+        struct mv_stats_t hypercalls;
+        /** @brief stores the halt-polling statistics */
+        struct mv_stats_t halt_polls;
+        /** @brief stores the extended state statistics */
+        struct mv_stats_t fpu;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
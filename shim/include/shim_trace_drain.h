@@ -0,0 +1,61 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SHIM_TRACE_DRAIN_H
+#define SHIM_TRACE_DRAIN_H
+
+#include <mv_trace_t.h>
+#include <mv_types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * <!-- description -->
+     *   @brief Moves up to "max" entries out of the trace rings of all
+     *     cpus (i.e. PPs), one cpu after the other, and adds the number of
+     *     entries MicroV dropped since the last drain to "pmut_lost".
+     *     Entries are in order for each cpu, but not between cpus (use
+     *     the tsc of each entry for that). This must not be called from
+     *     more than one thread at a time.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_entries where to copy the entries to
+     *   @param max the total number of entries pmut_entries can hold
+     *   @param pmut_lost the number of dropped entries is added to this
+     *   @return Returns the number of entries copied to pmut_entries
+     */
+    NODISCARD uint64_t shim_trace_drain(
+        struct mv_trace_entry_t *const pmut_entries,
+        uint64_t const max,
+        uint64_t *const pmut_lost) NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
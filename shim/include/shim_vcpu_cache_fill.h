@@ -0,0 +1,58 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHIM_VCPU_CACHE_FILL_H
+#define SHIM_VCPU_CACHE_FILL_H
+
+#include <mv_types.h>
+#include <shim_vcpu_t.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * <!-- description -->
+     *   @brief Makes sure that each of the provided SHIM_VCPU_CACHE_
+     *     groups is in the VCPU's register cache, reading the groups that
+     *     are not from MicroV. Groups that are already cached cost nothing,
+     *     so back to back KVM_GET_REGS/KVM_GET_SREGS calls between two
+     *     KVM_RUNs only make one trip to MicroV.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_vcpu the VCPU to fill the register cache of
+     *   @param groups the SHIM_VCPU_CACHE_ groups to fill
+     *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+     */
+    NODISCARD int64_t
+    shim_vcpu_cache_fill(struct shim_vcpu_t *const pmut_vcpu, uint64_t const groups) NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SHIM_VCPU_EXIT_PAGE_ENABLE_H
+#define SHIM_VCPU_EXIT_PAGE_ENABLE_H
+
+#include <mv_types.h>
+#include <shim_vcpu_t.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * <!-- description -->
+     *   @brief Registers the first page of the VCPU's kvm_run as its MicroV
+     *     exit page (see mv_vs_op_set_exit_page_gpa). From then on, MicroV
+     *     writes non-string IO and MMIO exits directly into kvm_run and
+     *     reads the result of an IN or MMIO read from there, so
+     *     handle_vcpu_kvm_run no longer has to translate them. Only the
+     *     first page is registered as the pages of kvm_run are not
+     *     physically contiguous.
+     *
+     * <!-- inputs/outputs -->
+     *   @param pmut_vcpu the VCPU to enable the exit page of
+     *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+     */
+    NODISCARD int64_t shim_vcpu_exit_page_enable(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,8 +27,11 @@
 #ifndef SHIM_VCPU_T_H
 #define SHIM_VCPU_T_H
 
+#include <kvm_regs.h>
 #include <kvm_run.h>
+#include <kvm_sregs.h>
 #include <mv_types.h>
+#include <platform.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -38,6 +41,13 @@ extern "C"
 
 #pragma pack(push, 1)
 
+/** @brief defines the kvm_regs group of a VCPU's register cache */
+#define SHIM_VCPU_CACHE_REGS ((uint64_t)0x0000000000000001)
+/** @brief defines the kvm_sregs group of a VCPU's register cache */
+#define SHIM_VCPU_CACHE_SREGS ((uint64_t)0x0000000000000002)
+/** @brief defines all of the groups of a VCPU's register cache */
+#define SHIM_VCPU_CACHE_ALL ((uint64_t)0x0000000000000003)
+
     /** prototype */
     struct shim_vm_t;
 
@@ -63,6 +73,27 @@ extern "C"
 
         /** @brief stores the kvm_run struct associated with this VCPU */
         struct kvm_run *run;
+        /** @brief stores whether run->mmio holds a read userspace completed */
+        uint8_t mmio_read_pending;
+        /** @brief stores whether run->io holds an IN userspace completed */
+        uint8_t io_in_pending;
+        /** @brief stores whether run is registered as MicroV's exit page */
+        uint8_t exit_page;
+        /** @brief stores the thread that last ran this VCPU (0 if none) */
+        uint64_t thread;
+        /** @brief stores the wait queue this VCPU sleeps on while halted */
+        platform_waitq halt_waitq;
+        /** @brief stores whether this VCPU has to stop sleeping on a HLT */
+        uint64_t halt_wakeup;
+
+        /** @brief stores the cached kvm_regs (SHIM_VCPU_CACHE_REGS) */
+        struct kvm_regs regs;
+        /** @brief stores the cached kvm_sregs (SHIM_VCPU_CACHE_SREGS) */
+        struct kvm_sregs sregs;
+        /** @brief stores the SHIM_VCPU_CACHE_ groups that are cached */
+        uint64_t cache_valid;
+        /** @brief stores the SHIM_VCPU_CACHE_ groups MicroV has not seen */
+        uint64_t cache_dirty;
 
         /** @brief stores a pointer to the parent VM */
         struct shim_vm_t *vm;
@@ -31,6 +31,7 @@
 #include <mv_constants.h>
 #include <mv_types.h>
 #include <platform.h>
+#include <shim_irqfd_t.h>
 #include <shim_vcpu_t.h>
 #include <stdint.h>
 
@@ -63,9 +64,17 @@ extern "C"
 
         /** @brief stores the VCPUs associated with this VM */
         struct shim_vcpu_t vcpus[MICROV_MAX_VCPUS];
+        /** @brief stores the index of the VCPU that was last yielded to */
+        uint64_t last_yield;
 
         /** @brief stores the memory slots associated with this VM */
         struct kvm_userspace_memory_region slots[MICROV_MAX_SLOTS];
+
+        /** @brief stores whether KVM_CREATE_IRQCHIP was called for this VM */
+        uint8_t irqchip;
+
+        /** @brief stores the irqfds associated with this VM (see KVM_IRQFD) */
+        struct shim_irqfd_t irqfds[SHIM_MAX_IRQFDS];
     };
 
 #pragma pack(pop)
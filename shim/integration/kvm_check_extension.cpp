@@ -86,6 +86,10 @@ main() noexcept -> bsl::exit_code
             mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, capmce_args);
             integration::verify(mut_ret == shim::KVM_CAP_MCE);
 
+            constexpr auto capirqfd_args{32_i64};
+            mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, capirqfd_args);
+            integration::verify(mut_ret == shim::KVM_CAP_IRQFD);
+
             constexpr auto captsckhz_args{61_i64};
             mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, captsckhz_args);
             integration::verify(mut_ret == shim::KVM_CAP_GET_TSC_KHZ);
@@ -99,6 +103,14 @@ main() noexcept -> bsl::exit_code
             mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, capdeadlinetimer_args);
             integration::verify(mut_ret == shim::KVM_CAP_TSC_DEADLINE_TIMER);
 
+            constexpr auto capsyncregs_args{74_i64};
+            mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, capsyncregs_args);
+            integration::verify(mut_ret == shim::KVM_CAP_SYNC_REGS);
+
+            constexpr auto capirqfdresample_args{82_i64};
+            mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, capirqfdresample_args);
+            integration::verify(mut_ret == shim::KVM_CAP_IRQFD_RESAMPLE);
+
             constexpr auto capimmexit_args{136_i64};
             mut_ret = pmut_ctl->write(shim::KVM_CHECK_EXTENSION, capimmexit_args);
             integration::verify(mut_ret == shim::KVM_CAP_IMMEDIATE_EXIT);
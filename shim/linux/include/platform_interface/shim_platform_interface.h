@@ -70,6 +70,7 @@
 #include <kvm_xen_hvm_config.h>
 #include <kvm_xsave.h>
 #include <linux/ioctl.h>
+#include <mv_io_permission.h>
 
 #define SHIMIO 0xAE
 
@@ -77,6 +78,10 @@
 #define SHIM_NAME "microv_shim"
 /** @brief defines the /dev name of the shim */
 #define SHIM_DEVICE_NAME "/dev/microv_shim"
+/** @brief defines the name of the shim's trace device */
+#define SHIM_TRACE_NAME "microv_trace"
+/** @brief defines the /dev name of the shim's trace device */
+#define SHIM_TRACE_DEVICE_NAME "/dev/microv_trace"
 
 /**
  * @brief Hack for defining ioctl commands that require structs
@@ -263,5 +268,10 @@
 #define KVM_GET_SUPPORTED_HV_CPUID _IOWR(SHIMIO, 0xc1, struct kvm_cpuid2)
 /** @brief defines KVM's KVM_SET_PMU_EVENT_FILTER IOCTL */
 #define KVM_SET_PMU_EVENT_FILTER _IOW(SHIMIO, 0xb2, struct kvm_pmu_event_filter)
+/** @brief defines KVM's KVM_GET_STATS_FD IOCTL */
+#define KVM_GET_STATS_FD _IO(SHIMIO, 0xce)
+
+/** @brief defines MicroV's MV_IO_PERMISSION IOCTL (see mv_vm_op_io_permission) */
+#define MV_IO_PERMISSION _IOW(SHIMIO, 0xf0, struct mv_io_permission)
 
 #endif
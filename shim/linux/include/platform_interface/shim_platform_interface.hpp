@@ -289,6 +289,8 @@ namespace shim
     // constexpr bsl::safe_umx KVM_GET_SUPPORTED_HV_CPUID{static_cast<bsl::uintmx>(_IOWR(SHIMIO.get(), 0xc1, struct kvm_cpuid2))};
     // /// @brief defines KVM's KVM_SET_PMU_EVENT_FILTER IOCTL
     // constexpr bsl::safe_umx KVM_SET_PMU_EVENT_FILTER{static_cast<bsl::uintmx>(_IOW(SHIMIO.get(), 0xb2, struct kvm_pmu_event_filter))};
+    /// @brief defines KVM's KVM_GET_STATS_FD IOCTL
+    constexpr bsl::safe_umx KVM_GET_STATS_FD{static_cast<bsl::uintmx>(_IO(SHIMIO.get(), 0xce))};
 }
 
 #endif
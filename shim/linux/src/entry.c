@@ -36,22 +36,33 @@
 #include <handle_system_kvm_get_supported_cpuid.h>
 #include <handle_system_kvm_get_vcpu_mmap_size.h>
 #include <handle_vcpu_kvm_get_fpu.h>
+#include <handle_vcpu_kvm_get_lapic.h>
 #include <handle_vcpu_kvm_get_mp_state.h>
 #include <handle_vcpu_kvm_get_msrs.h>
-#include <handle_vcpu_kvm_get_regs.h>
-#include <handle_vcpu_kvm_get_sregs.h>
+#include <handle_vcpu_kvm_get_stats_fd.h>
 #include <handle_vcpu_kvm_get_tsc_khz.h>
+#include <handle_vcpu_kvm_interrupt.h>
+#include <handle_vcpu_kvm_kvmclock_ctrl.h>
 #include <handle_vcpu_kvm_run.h>
 #include <handle_vcpu_kvm_set_fpu.h>
+#include <handle_vcpu_kvm_set_lapic.h>
 #include <handle_vcpu_kvm_set_mp_state.h>
 #include <handle_vcpu_kvm_set_msrs.h>
-#include <handle_vcpu_kvm_set_regs.h>
-#include <handle_vcpu_kvm_set_sregs.h>
+#include <handle_vcpu_kvm_set_tsc_khz.h>
 #include <handle_vm_kvm_check_extension.h>
+#include <handle_vm_kvm_create_irqchip.h>
 #include <handle_vm_kvm_create_vcpu.h>
 #include <handle_vm_kvm_destroy_vcpu.h>
+#include <handle_vm_kvm_get_clock.h>
+#include <handle_vm_kvm_get_stats_fd.h>
+#include <handle_vm_kvm_irq_line.h>
+#include <handle_vm_kvm_irqfd.h>
+#include <handle_vm_kvm_set_clock.h>
 #include <handle_vm_kvm_set_user_memory_region.h>
+#include <handle_vm_mv_io_permission.h>
 #include <linux/anon_inodes.h>
+#include <linux/atomic.h>
+#include <linux/fs.h>
 #include <linux/kernel.h>
 #include <linux/miscdevice.h>
 #include <linux/module.h>
@@ -59,14 +70,33 @@
 #include <linux/reboot.h>
 #include <linux/suspend.h>
 #include <mv_constants.h>
+#include <mv_trace_t.h>
 #include <mv_types.h>
 #include <platform.h>
 #include <serial_init.h>
 #include <shim_fini.h>
 #include <shim_init.h>
+#include <shim_irqfd.h>
 #include <shim_platform_interface.h>
+#include <shim_stats_t.h>
+#include <shim_trace_disable.h>
+#include <shim_trace_drain.h>
+#include <shim_trace_enable.h>
+#include <shim_vcpu_cache_fill.h>
+#include <shim_vcpu_cache_flush.h>
+#include <shim_vcpu_exit_page_enable.h>
 #include <shim_vm_t.h>
 
+/**
+ * NOTE:
+ * - When set, each VCPU registers the first page of its kvm_run as its
+ *   MicroV exit page, so that IO and MMIO exits are written directly into
+ *   kvm_run instead of being translated from the shared page.
+ */
+static bool exit_page;
+module_param(exit_page, bool, 0444);
+MODULE_PARM_DESC(exit_page, "have MicroV write IO and MMIO exits directly into kvm_run");
+
 static int
 dev_open(struct inode *const inode, struct file *const file)
 {
@@ -99,6 +129,7 @@ vm_release_impl(struct shim_vm_t *const pmut_vm)
         }
     }
 
+    shim_irqfd_release(pmut_vm);
     handle_system_kvm_destroy_vm(pmut_vm);
 
     platform_mutex_destroy(&pmut_vm->mutex);
@@ -150,9 +181,204 @@ device_release(struct inode *const inode, struct file *const file)
     return -EINVAL;
 }
 
+static ssize_t
+vm_stats_read(
+    struct file *const file,
+    char __user *const user_buf,
+    size_t const size,
+    loff_t *const offset)
+{
+    ssize_t mut_ret;
+    struct file *mut_owner;
+    struct shim_stats_t *pmut_mut_stats;
+
+    platform_expects(NULL != file);
+    mut_owner = (struct file *)file->private_data;
+
+    pmut_mut_stats = vmalloc(sizeof(struct shim_stats_t));
+    if (NULL == pmut_mut_stats) {
+        bferror("vmalloc failed");
+        return -ENOMEM;
+    }
+
+    if (handle_vm_kvm_get_stats_fd(
+            (struct shim_vm_t *)mut_owner->private_data, pmut_mut_stats)) {
+        bferror("handle_vm_kvm_get_stats_fd failed");
+        vfree(pmut_mut_stats);
+        return -EINVAL;
+    }
+
+    mut_ret = simple_read_from_buffer(
+        user_buf, size, offset, pmut_mut_stats, sizeof(struct shim_stats_t));
+
+    vfree(pmut_mut_stats);
+    return mut_ret;
+}
+
+static ssize_t
+vcpu_stats_read(
+    struct file *const file,
+    char __user *const user_buf,
+    size_t const size,
+    loff_t *const offset)
+{
+    ssize_t mut_ret;
+    struct file *mut_owner;
+    struct shim_stats_t *pmut_mut_stats;
+
+    platform_expects(NULL != file);
+    mut_owner = (struct file *)file->private_data;
+
+    pmut_mut_stats = vmalloc(sizeof(struct shim_stats_t));
+    if (NULL == pmut_mut_stats) {
+        bferror("vmalloc failed");
+        return -ENOMEM;
+    }
+
+    if (handle_vcpu_kvm_get_stats_fd(
+            (struct shim_vcpu_t const *)mut_owner->private_data,
+            pmut_mut_stats)) {
+        bferror("handle_vcpu_kvm_get_stats_fd failed");
+        vfree(pmut_mut_stats);
+        return -EINVAL;
+    }
+
+    mut_ret = simple_read_from_buffer(
+        user_buf, size, offset, pmut_mut_stats, sizeof(struct shim_stats_t));
+
+    vfree(pmut_mut_stats);
+    return mut_ret;
+}
+
+static int
+stats_release(struct inode *const inode, struct file *const file)
+{
+    (void)inode;
+
+    /**
+     * NOTE:
+     * - A stats fd holds a reference to the VM or VCPU fd it was created
+     *   from so that the VM or VCPU cannot be released while it is still
+     *   being read.
+     */
+
+    platform_expects(NULL != file);
+    fput((struct file *)file->private_data);
+
+    return 0;
+}
+
+/** @brief stores whether or not the trace device is open */
+static atomic_t g_mut_trace_open = ATOMIC_INIT(0);
+
+static int
+trace_open(struct inode *const inode, struct file *const file)
+{
+    (void)inode;
+    (void)file;
+
+    /**
+     * NOTE:
+     * - There is only one set of trace rings, so only one reader is
+     *   allowed at a time. Tracing is enabled for as long as the trace
+     *   device is open, and costs MicroV nothing otherwise.
+     */
+
+    if (0 != atomic_cmpxchg(&g_mut_trace_open, 0, 1)) {
+        return -EBUSY;
+    }
+
+    if (shim_trace_enable()) {
+        bferror("shim_trace_enable failed");
+        atomic_set(&g_mut_trace_open, 0);
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+static ssize_t
+trace_read(
+    struct file *const file,
+    char __user *const user_buf,
+    size_t const size,
+    loff_t *const offset)
+{
+    uint64_t mut_max;
+    uint64_t mut_num;
+    uint64_t mut_lost;
+    uint64_t mut_bytes;
+    struct mv_trace_entry_t *pmut_mut_entries;
+
+    (void)file;
+    (void)offset;
+
+    mut_max = ((uint64_t)size) / sizeof(struct mv_trace_entry_t);
+    if (((uint64_t)0) == mut_max) {
+        return -EINVAL;
+    }
+
+    if (mut_max > (MV_TRACE_NUM_ENTRIES * (uint64_t)platform_num_online_cpus())) {
+        mut_max = MV_TRACE_NUM_ENTRIES * (uint64_t)platform_num_online_cpus();
+    }
+
+    pmut_mut_entries = vmalloc(mut_max * sizeof(struct mv_trace_entry_t));
+    if (NULL == pmut_mut_entries) {
+        bferror("vmalloc failed");
+        return -ENOMEM;
+    }
+
+    mut_lost = ((uint64_t)0);
+    mut_num = shim_trace_drain(pmut_mut_entries, mut_max, &mut_lost);
+    if (((uint64_t)0) != mut_lost) {
+        bfdebug_d64("trace entries lost", mut_lost);
+    }
+
+    mut_bytes = mut_num * sizeof(struct mv_trace_entry_t);
+    if (platform_copy_to_user(user_buf, pmut_mut_entries, mut_bytes)) {
+        bferror("platform_copy_to_user failed");
+        vfree(pmut_mut_entries);
+        return -EFAULT;
+    }
+
+    vfree(pmut_mut_entries);
+    return (ssize_t)mut_bytes;
+}
+
+static int
+trace_release(struct inode *const inode, struct file *const file)
+{
+    (void)inode;
+    (void)file;
+
+    shim_trace_disable();
+    atomic_set(&g_mut_trace_open, 0);
+
+    return 0;
+}
+
 static struct file_operations fops_vm;
 static struct file_operations fops_vcpu;
 static struct file_operations fops_device;
+static struct file_operations fops_vm_stats;
+static struct file_operations fops_vcpu_stats;
+
+static long
+dispatch_kvm_get_stats_fd(
+    struct file *const file, struct file_operations const *const fops)
+{
+    int mut_fd;
+
+    get_file(file);
+
+    mut_fd = anon_inode_getfd("kvm-stats", fops, file, O_RDONLY | O_CLOEXEC);
+    if (mut_fd < 0) {
+        bferror("anon_inode_getfd failed");
+        fput(file);
+    }
+
+    return (long)mut_fd;
+}
 
 /* -------------------------------------------------------------------------- */
 /* System IOCTLs                                                              */
@@ -506,9 +732,14 @@ dispatch_vm_kvm_create_device(struct kvm_create_device *const ioctl_args)
 }
 
 static long
-dispatch_kvm_create_irqchip(void)
+dispatch_kvm_create_irqchip(struct shim_vm_t *const pmut_vm)
 {
-    return -EINVAL;
+    if (handle_vm_kvm_create_irqchip(pmut_vm)) {
+        bferror("handle_vm_kvm_create_irqchip failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
@@ -533,6 +764,14 @@ dispatch_vm_kvm_create_vcpu(struct shim_vm_t *const pmut_vm)
     platform_expects(NULL != pmut_mut_vcpu->run);
 
     platform_expects(NULL != pmut_mut_vcpu);
+
+    if (exit_page) {
+        if (shim_vcpu_exit_page_enable(pmut_mut_vcpu)) {
+            bferror("shim_vcpu_exit_page_enable failed");
+            goto handle_vm_kvm_create_vcpu_failed;
+        }
+    }
+
     snprintf(name, sizeof(name), "kvm-vcpu:%d", pmut_mut_vcpu->id);
 
     pmut_mut_vcpu->fd = (uint64_t)anon_inode_getfd(
@@ -553,10 +792,23 @@ handle_vm_kvm_create_vcpu_failed:
 }
 
 static long
-dispatch_vm_kvm_get_clock(struct kvm_clock_data *const ioctl_args)
+dispatch_vm_kvm_get_clock(
+    struct shim_vm_t const *const vm, struct kvm_clock_data *const user_args)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_clock_data mut_args;
+    uint64_t const size = sizeof(mut_args);
+
+    if (handle_vm_kvm_get_clock(vm, &mut_args)) {
+        bferror("handle_vm_kvm_get_clock failed");
+        return -EINVAL;
+    }
+
+    if (platform_copy_to_user(user_args, &mut_args, size)) {
+        bferror("platform_copy_to_user failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
@@ -594,6 +846,12 @@ dispatch_vm_kvm_get_pit2(struct kvm_pit_state2 *const ioctl_args)
     return -EINVAL;
 }
 
+static long
+dispatch_vm_kvm_get_stats_fd(struct file *const file)
+{
+    return dispatch_kvm_get_stats_fd(file, &fops_vm_stats);
+}
+
 static long
 dispatch_vm_kvm_has_device_attr(struct kvm_device_attr *const ioctl_args)
 {
@@ -616,17 +874,42 @@ dispatch_vm_kvm_ioeventfd(struct kvm_ioeventfd *const ioctl_args)
 }
 
 static long
-dispatch_vm_kvm_irq_line(struct kvm_irq_level *const ioctl_args)
+dispatch_vm_kvm_irq_line(
+    struct kvm_irq_level const *const user_args, struct shim_vm_t *const pmut_vm)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_irq_level mut_args;
+    uint64_t const size = sizeof(mut_args);
+
+    if (platform_copy_from_user(&mut_args, user_args, size)) {
+        bferror("platform_copy_from_user failed");
+        return -EINVAL;
+    }
+
+    if (handle_vm_kvm_irq_line(pmut_vm, &mut_args)) {
+        bferror("handle_vm_kvm_irq_line failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
-dispatch_vm_kvm_irqfd(struct kvm_irqfd *const ioctl_args)
+dispatch_vm_kvm_irqfd(struct kvm_irqfd const *const user_args, struct shim_vm_t *const pmut_vm)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_irqfd mut_args;
+    uint64_t const size = sizeof(mut_args);
+
+    if (platform_copy_from_user(&mut_args, user_args, size)) {
+        bferror("platform_copy_from_user failed");
+        return -EINVAL;
+    }
+
+    if (handle_vm_kvm_irqfd(pmut_vm, &mut_args)) {
+        bferror("handle_vm_kvm_irqfd failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
@@ -650,10 +933,23 @@ dispatch_vm_kvm_set_boot_cpu_id(void)
 }
 
 static long
-dispatch_vm_kvm_set_clock(struct kvm_clock_data *const ioctl_args)
+dispatch_vm_kvm_set_clock(
+    struct shim_vm_t const *const vm, struct kvm_clock_data const *const user_args)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_clock_data mut_args;
+    uint64_t const size = sizeof(mut_args);
+
+    if (platform_copy_from_user(&mut_args, user_args, size)) {
+        bferror("platform_copy_from_user failed");
+        return -EINVAL;
+    }
+
+    if (handle_vm_kvm_set_clock(vm, &mut_args)) {
+        bferror("handle_vm_kvm_set_clock failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
@@ -759,6 +1055,27 @@ dispatch_vm_kvm_xen_hvm_config(struct kvm_xen_hvm_config *const ioctl_args)
     return -EINVAL;
 }
 
+static long
+dispatch_vm_mv_io_permission(
+    struct mv_io_permission const *const user_args,
+    struct shim_vm_t const *const vm)
+{
+    struct mv_io_permission mut_args;
+    uint64_t const size = sizeof(mut_args);
+
+    if (platform_copy_from_user(&mut_args, user_args, size)) {
+        bferror("platform_copy_from_user failed");
+        return -EINVAL;
+    }
+
+    if (handle_vm_mv_io_permission(vm, &mut_args)) {
+        bferror("handle_vm_mv_io_permission failed");
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
 static long
 dev_unlocked_ioctl_vm(
     struct file *const file,
@@ -786,7 +1103,7 @@ dev_unlocked_ioctl_vm(
         }
 
         case KVM_CREATE_IRQCHIP: {
-            return dispatch_kvm_create_irqchip();
+            return dispatch_kvm_create_irqchip(pmut_mut_vm);
         }
 
         case KVM_CREATE_PIT2: {
@@ -800,7 +1117,7 @@ dev_unlocked_ioctl_vm(
 
         case KVM_GET_CLOCK: {
             return dispatch_vm_kvm_get_clock(
-                (struct kvm_clock_data *)ioctl_args);
+                pmut_mut_vm, (struct kvm_clock_data *)ioctl_args);
         }
 
         case KVM_GET_DEBUGREGS: {
@@ -828,6 +1145,10 @@ dev_unlocked_ioctl_vm(
                 (struct kvm_pit_state2 *)ioctl_args);
         }
 
+        case KVM_GET_STATS_FD: {
+            return dispatch_vm_kvm_get_stats_fd(file);
+        }
+
         case KVM_HAS_DEVICE_ATTR: {
             return dispatch_vm_kvm_has_device_attr(
                 (struct kvm_device_attr *)ioctl_args);
@@ -844,11 +1165,12 @@ dev_unlocked_ioctl_vm(
         }
 
         case KVM_IRQ_LINE: {
-            return dispatch_vm_kvm_irq_line((struct kvm_irq_level *)ioctl_args);
+            return dispatch_vm_kvm_irq_line(
+                (struct kvm_irq_level const *)ioctl_args, pmut_mut_vm);
         }
 
         case KVM_IRQFD: {
-            return dispatch_vm_kvm_irqfd((struct kvm_irqfd *)ioctl_args);
+            return dispatch_vm_kvm_irqfd((struct kvm_irqfd const *)ioctl_args, pmut_mut_vm);
         }
 
         case KVM_REGISTER_COALESCED_MMIO: {
@@ -866,7 +1188,7 @@ dev_unlocked_ioctl_vm(
 
         case KVM_SET_CLOCK: {
             return dispatch_vm_kvm_set_clock(
-                (struct kvm_clock_data *)ioctl_args);
+                pmut_mut_vm, (struct kvm_clock_data const *)ioctl_args);
         }
 
         case KVM_SET_DEBUGREGS: {
@@ -928,6 +1250,11 @@ dev_unlocked_ioctl_vm(
                 (struct kvm_xen_hvm_config *)ioctl_args);
         }
 
+        case MV_IO_PERMISSION: {
+            return dispatch_vm_mv_io_permission(
+                (struct mv_io_permission const *)ioctl_args, pmut_mut_vm);
+        }
+
         default: {
             bferror_x64("invalid vm ioctl cmd", cmd);
             return -EINVAL;
@@ -976,10 +1303,34 @@ dispatch_vcpu_kvm_get_fpu(
 }
 
 static long
-dispatch_vcpu_kvm_get_lapic(struct kvm_lapic_state *const ioctl_args)
+dispatch_vcpu_kvm_get_lapic(
+    struct shim_vcpu_t const *const vcpu, struct kvm_lapic_state *const user_args)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_lapic_state *mut_args;
+    long mut_ret = -EINVAL;
+
+    mut_args = platform_alloc(sizeof(struct kvm_lapic_state));
+    if (!mut_args) {
+        bferror("failed to allocated memory for kvm_lapic_state");
+        return -ENOMEM;
+    }
+
+    if (handle_vcpu_kvm_get_lapic(vcpu, mut_args)) {
+        bferror("handle_vcpu_kvm_get_lapic failed");
+        goto OUT_FREE;
+    }
+
+    if (platform_copy_to_user(user_args, mut_args, sizeof(*mut_args))) {
+        bferror("platform_copy_to_user failed");
+        goto OUT_FREE;
+    }
+
+    mut_ret = 0;
+
+OUT_FREE:
+    platform_free(mut_args, sizeof(*mut_args));
+
+    return mut_ret;
 }
 
 static long
@@ -1007,7 +1358,7 @@ dispatch_vcpu_kvm_get_mp_state(
 
 static long
 dispatch_vcpu_kvm_get_msrs(
-    struct shim_vcpu_t const *const vcpu, struct kvm_msrs *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_msrs *const user_args)
 {
     struct kvm_msrs *mut_args;
     long mut_ret = -EINVAL;
@@ -1044,6 +1395,16 @@ dispatch_vcpu_kvm_get_msrs(
         goto OUT_FREE;
     }
 
+    /// NOTE:
+    /// - EFER and APIC_BASE are also part of the sregs, so the register
+    ///   cache is flushed first in case KVM_SET_SREGS changed them.
+    ///
+
+    if (shim_vcpu_cache_flush(vcpu)) {
+        bferror("shim_vcpu_cache_flush failed");
+        goto OUT_FREE;
+    }
+
     if (handle_vcpu_kvm_get_msrs(vcpu, mut_args)) {
         bferror("handle_vcpu_kvm_get_msrs failed");
         goto OUT_FREE;
@@ -1079,17 +1440,16 @@ dispatch_vcpu_kvm_get_one_reg(struct kvm_one_reg *const ioctl_args)
 
 static long
 dispatch_vcpu_kvm_get_regs(
-    struct shim_vcpu_t const *const vcpu, struct kvm_regs *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_regs *const user_args)
 {
-    struct kvm_regs mut_args;
-    uint64_t const size = sizeof(mut_args);
+    uint64_t const size = sizeof(vcpu->regs);
 
-    if (handle_vcpu_kvm_get_regs(vcpu, &mut_args)) {
-        bferror("handle_vcpu_kvm_get_regs failed");
+    if (shim_vcpu_cache_fill(vcpu, SHIM_VCPU_CACHE_REGS)) {
+        bferror("shim_vcpu_cache_fill failed");
         return -EINVAL;
     }
 
-    if (platform_copy_to_user(user_args, &mut_args, size)) {
+    if (platform_copy_to_user(user_args, &vcpu->regs, size)) {
         bferror("platform_copy_from_user failed");
         return -EINVAL;
     }
@@ -1099,17 +1459,16 @@ dispatch_vcpu_kvm_get_regs(
 
 static long
 dispatch_vcpu_kvm_get_sregs(
-    struct shim_vcpu_t const *const vcpu, struct kvm_sregs *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_sregs *const user_args)
 {
-    struct kvm_sregs mut_args;
-    uint64_t const size = sizeof(mut_args);
+    uint64_t const size = sizeof(vcpu->sregs);
 
-    if (handle_vcpu_kvm_get_sregs(vcpu, &mut_args)) {
-        bferror("handle_vcpu_kvm_get_sregs failed");
+    if (shim_vcpu_cache_fill(vcpu, SHIM_VCPU_CACHE_SREGS)) {
+        bferror("shim_vcpu_cache_fill failed");
         return -EINVAL;
     }
 
-    if (platform_copy_to_user(user_args, &mut_args, size)) {
+    if (platform_copy_to_user(user_args, &vcpu->sregs, size)) {
         bferror("platform_copy_from_user failed");
         return -EINVAL;
     }
@@ -1117,6 +1476,12 @@ dispatch_vcpu_kvm_get_sregs(
     return 0;
 }
 
+static long
+dispatch_vcpu_kvm_get_stats_fd(struct file *const file)
+{
+    return dispatch_kvm_get_stats_fd(file, &fops_vcpu_stats);
+}
+
 static long
 dispatch_vcpu_kvm_get_supported_hv_cpuid(struct kvm_cpuid2 *const ioctl_args)
 {
@@ -1125,11 +1490,11 @@ dispatch_vcpu_kvm_get_supported_hv_cpuid(struct kvm_cpuid2 *const ioctl_args)
 }
 
 static long
-dispatch_vcpu_kvm_get_tsc_khz(void)
+dispatch_vcpu_kvm_get_tsc_khz(struct shim_vcpu_t const *const vcpu)
 {
     uint64_t tsc_khz;
 
-    if (handle_vcpu_kvm_get_tsc_khz(&tsc_khz)) {
+    if (handle_vcpu_kvm_get_tsc_khz(vcpu, &tsc_khz)) {
         bferror("handle_vcpu_kvm_get_tsc_khz failed");
         return -EINVAL;
     }
@@ -1159,16 +1524,34 @@ dispatch_vcpu_kvm_get_xsave(struct kvm_xsave *const ioctl_args)
 }
 
 static long
-dispatch_vcpu_kvm_interrupt(struct kvm_interrupt *const ioctl_args)
+dispatch_vcpu_kvm_interrupt(
+    struct shim_vcpu_t const *const vcpu, struct kvm_interrupt *const user_args)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_interrupt mut_args;
+    uint64_t const size = sizeof(mut_args);
+
+    if (platform_copy_from_user(&mut_args, user_args, size)) {
+        bferror("platform_copy_from_user failed");
+        return -EINVAL;
+    }
+
+    if (handle_vcpu_kvm_interrupt(vcpu, &mut_args)) {
+        bferror("handle_vcpu_kvm_interrupt failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
-dispatch_vcpu_kvm_kvmclock_ctrl(void)
+dispatch_vcpu_kvm_kvmclock_ctrl(struct shim_vcpu_t const *const vcpu)
 {
-    return -EINVAL;
+    if (handle_vcpu_kvm_kvmclock_ctrl(vcpu)) {
+        bferror("handle_vcpu_kvm_kvmclock_ctrl failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
@@ -1230,15 +1613,39 @@ dispatch_vcpu_kvm_set_guest_debug(struct kvm_guest_debug *const ioctl_args)
 }
 
 static long
-dispatch_vcpu_kvm_set_lapic(struct kvm_lapic_state *const ioctl_args)
+dispatch_vcpu_kvm_set_lapic(
+    struct shim_vcpu_t const *const vcpu, struct kvm_lapic_state *const user_args)
 {
-    (void)ioctl_args;
-    return -EINVAL;
+    struct kvm_lapic_state *mut_args;
+    long mut_ret = -EINVAL;
+
+    mut_args = platform_alloc(sizeof(struct kvm_lapic_state));
+    if (!mut_args) {
+        bferror("failed to allocated memory for kvm_lapic_state");
+        return -ENOMEM;
+    }
+
+    if (platform_copy_from_user(mut_args, user_args, sizeof(*mut_args))) {
+        bferror("platform_copy_from_user failed");
+        goto OUT_FREE;
+    }
+
+    if (handle_vcpu_kvm_set_lapic(vcpu, mut_args)) {
+        bferror("handle_vcpu_kvm_set_lapic failed");
+        goto OUT_FREE;
+    }
+
+    mut_ret = 0;
+
+OUT_FREE:
+    platform_free(mut_args, sizeof(*mut_args));
+
+    return mut_ret;
 }
 
 static long
 dispatch_vcpu_kvm_set_mp_state(
-    struct shim_vcpu_t const *const vcpu, struct kvm_mp_state *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_mp_state *const user_args)
 {
     struct kvm_mp_state mut_args;
 
@@ -1252,6 +1659,19 @@ dispatch_vcpu_kvm_set_mp_state(
         return -EINVAL;
     }
 
+    /// NOTE:
+    /// - MicroV resets the VS's registers when it is placed back in
+    ///   the INIT state, so the register cache is flushed first, keeping
+    ///   the order userspace made its IOCTLs in, and dropped afterwards.
+    ///
+
+    if (shim_vcpu_cache_flush(vcpu)) {
+        bferror("shim_vcpu_cache_flush failed");
+        return -EINVAL;
+    }
+
+    vcpu->cache_valid = ((uint64_t)0);
+
     if (handle_vcpu_kvm_set_mp_state(vcpu, &mut_args)) {
         bferror("handle_vcpu_kvm_set_mp_state failed");
         return -EINVAL;
@@ -1262,7 +1682,7 @@ dispatch_vcpu_kvm_set_mp_state(
 
 static long
 dispatch_vcpu_kvm_set_msrs(
-    struct shim_vcpu_t const *const vcpu, struct kvm_msrs *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_msrs *const user_args)
 {
 
     struct kvm_msrs *mut_args;
@@ -1293,6 +1713,20 @@ dispatch_vcpu_kvm_set_msrs(
         goto OUT_FREE;
     }
 
+    /// NOTE:
+    /// - EFER and APIC_BASE are also part of the sregs, so the register
+    ///   cache is flushed first so that these MSRs win over an older
+    ///   KVM_SET_SREGS, and the cached sregs are dropped afterwards.
+    ///
+
+    if (shim_vcpu_cache_flush(vcpu)) {
+        bferror("shim_vcpu_cache_flush failed");
+        mut_nmsrs = -EINVAL;
+        goto OUT_FREE;
+    }
+
+    vcpu->cache_valid &= ~SHIM_VCPU_CACHE_SREGS;
+
     if (handle_vcpu_kvm_set_msrs(vcpu, mut_args)) {
         bferror("handle_vcpu_kvm_set_msrs failed");
         mut_nmsrs = -EINVAL;
@@ -1323,7 +1757,7 @@ dispatch_vcpu_kvm_set_one_reg(struct kvm_one_reg *const ioctl_args)
 
 static long
 dispatch_vcpu_kvm_set_regs(
-    struct shim_vcpu_t const *const vcpu, struct kvm_regs *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_regs *const user_args)
 {
     struct kvm_regs mut_args;
     uint64_t const size = sizeof(mut_args);
@@ -1333,10 +1767,15 @@ dispatch_vcpu_kvm_set_regs(
         return -EINVAL;
     }
 
-    if (handle_vcpu_kvm_set_regs(vcpu, &mut_args)) {
-        bferror("handle_vcpu_kvm_set_regs failed");
-        return -EINVAL;
-    }
+    /// NOTE:
+    /// - The registers are only given to MicroV on the next KVM_RUN (or
+    ///   before another IOCTL needs them), so a read-modify-write of the
+    ///   registers between two KVM_RUNs does not call MicroV at all.
+    ///
+
+    vcpu->regs = mut_args;
+    vcpu->cache_valid |= SHIM_VCPU_CACHE_REGS;
+    vcpu->cache_dirty |= SHIM_VCPU_CACHE_REGS;
 
     return 0;
 }
@@ -1350,7 +1789,7 @@ dispatch_vcpu_kvm_set_signal_mask(struct kvm_signal_mask *const ioctl_args)
 
 static long
 dispatch_vcpu_kvm_set_sregs(
-    struct shim_vcpu_t const *const vcpu, struct kvm_sregs *const user_args)
+    struct shim_vcpu_t *const vcpu, struct kvm_sregs *const user_args)
 {
     struct kvm_sregs mut_args;
     uint64_t const size = sizeof(mut_args);
@@ -1360,18 +1799,31 @@ dispatch_vcpu_kvm_set_sregs(
         return -EINVAL;
     }
 
-    if (handle_vcpu_kvm_set_sregs(vcpu, &mut_args)) {
-        bferror("handle_vcpu_kvm_set_sregs failed");
-        return -EINVAL;
-    }
+    /// NOTE:
+    /// - Like KVM_SET_REGS, the sregs are only given to MicroV on the
+    ///   next KVM_RUN. MicroV does not take the interrupt bitmap, so it
+    ///   is cleared to match what KVM_GET_SREGS would return from MicroV.
+    ///
+
+    platform_memset(mut_args.interrupt_bitmap, ((uint8_t)0), sizeof(mut_args.interrupt_bitmap));
+
+    vcpu->sregs = mut_args;
+    vcpu->cache_valid |= SHIM_VCPU_CACHE_SREGS;
+    vcpu->cache_dirty |= SHIM_VCPU_CACHE_SREGS;
 
     return 0;
 }
 
 static long
-dispatch_vcpu_kvm_set_tsc_khz(void)
+dispatch_vcpu_kvm_set_tsc_khz(
+    struct shim_vcpu_t const *const vcpu, unsigned long const tsc_khz)
 {
-    return -EINVAL;
+    if (handle_vcpu_kvm_set_tsc_khz(vcpu, (uint64_t)tsc_khz)) {
+        bferror("handle_vcpu_kvm_set_tsc_khz failed");
+        return -EINVAL;
+    }
+
+    return 0;
 }
 
 static long
@@ -1451,7 +1903,7 @@ dev_unlocked_ioctl_vcpu(
 
         case KVM_GET_LAPIC: {
             return dispatch_vcpu_kvm_get_lapic(
-                (struct kvm_lapic_state *)ioctl_args);
+                pmut_mut_vcpu, (struct kvm_lapic_state *)ioctl_args);
         }
 
         case KVM_GET_MP_STATE: {
@@ -1484,6 +1936,10 @@ dev_unlocked_ioctl_vcpu(
                 pmut_mut_vcpu, (struct kvm_sregs *)ioctl_args);
         }
 
+        case KVM_GET_STATS_FD: {
+            return dispatch_vcpu_kvm_get_stats_fd(file);
+        }
+
         case KVM_GET_SUPPORTED_HV_CPUID: {
             return dispatch_vcpu_kvm_get_supported_hv_cpuid(
                 (struct kvm_cpuid2 *)ioctl_args);
@@ -1494,7 +1950,7 @@ dev_unlocked_ioctl_vcpu(
                 bferror("KVM_GET_TSC_KHZ: ioctl_args are present");
                 return -EINVAL;
             }
-            return dispatch_vcpu_kvm_get_tsc_khz();
+            return dispatch_vcpu_kvm_get_tsc_khz(pmut_mut_vcpu);
         }
 
         case KVM_GET_VCPU_EVENTS: {
@@ -1512,11 +1968,11 @@ dev_unlocked_ioctl_vcpu(
 
         case KVM_INTERRUPT: {
             return dispatch_vcpu_kvm_interrupt(
-                (struct kvm_interrupt *)ioctl_args);
+                pmut_mut_vcpu, (struct kvm_interrupt *)ioctl_args);
         }
 
         case KVM_KVMCLOCK_CTRL: {
-            return dispatch_vcpu_kvm_kvmclock_ctrl();
+            return dispatch_vcpu_kvm_kvmclock_ctrl(pmut_mut_vcpu);
         }
 
         case KVM_NMI: {
@@ -1548,7 +2004,7 @@ dev_unlocked_ioctl_vcpu(
 
         case KVM_SET_LAPIC: {
             return dispatch_vcpu_kvm_set_lapic(
-                (struct kvm_lapic_state *)ioctl_args);
+                pmut_mut_vcpu, (struct kvm_lapic_state *)ioctl_args);
         }
 
         case KVM_SET_MP_STATE: {
@@ -1587,7 +2043,7 @@ dev_unlocked_ioctl_vcpu(
         }
 
         case KVM_SET_TSC_KHZ: {
-            return dispatch_vcpu_kvm_set_tsc_khz();
+            return dispatch_vcpu_kvm_set_tsc_khz(pmut_mut_vcpu, ioctl_args);
         }
 
         case KVM_SET_VCPU_EVENTS: {
@@ -1693,15 +2149,15 @@ dispatch_vcpu_mmap_fault(struct vm_fault *vmf)
 
     platform_expects(NULL != vmf);
 
-    if (vmf->pgoff != 0) {
-        bferror("a page offset of 0 is currently not supported");
+    if (vmf->pgoff >= (sizeof(struct kvm_run) / PAGE_SIZE)) {
+        bferror("the requested page offset is not supported");
         return -EINVAL;
     }
 
     pmut_mut_vcpu = (struct shim_vcpu_t *)vmf->vma->vm_file->private_data;
     platform_expects(NULL != pmut_mut_vcpu);
 
-    vmf->page = vmalloc_to_page(pmut_mut_vcpu->run);
+    vmf->page = vmalloc_to_page(((uint8_t *)pmut_mut_vcpu->run) + (vmf->pgoff * PAGE_SIZE));
     get_page(vmf->page);
 
     return 0;
@@ -1735,6 +2191,19 @@ static struct miscdevice shim_dev = {
     .fops = &fops,
     .mode = 0666};
 
+static struct file_operations fops_trace = {
+    .open = trace_open,          // --
+    .release = trace_release,    // --
+    .read = trace_read,          // --
+    .llseek = noop_llseek        // --
+};
+
+static struct miscdevice shim_trace_dev = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name = SHIM_TRACE_NAME,
+    .fops = &fops_trace,
+    .mode = 0600};
+
 static struct file_operations fops_vm = {
     .release = vm_release,                     // --
     .unlocked_ioctl = dev_unlocked_ioctl_vm    // --
@@ -1751,6 +2220,18 @@ static struct file_operations fops_device = {
     .unlocked_ioctl = dev_unlocked_ioctl_device    // --
 };
 
+static struct file_operations fops_vm_stats = {
+    .release = stats_release,    // --
+    .read = vm_stats_read,       // --
+    .llseek = noop_llseek        // --
+};
+
+static struct file_operations fops_vcpu_stats = {
+    .release = stats_release,    // --
+    .read = vcpu_stats_read,     // --
+    .llseek = noop_llseek        // --
+};
+
 /* -------------------------------------------------------------------------- */
 /* Entry / Exit                                                               */
 /* -------------------------------------------------------------------------- */
@@ -1825,8 +2306,16 @@ dev_init(void)
         goto misc_register_failed;
     }
 
+    if (misc_register(&shim_trace_dev)) {
+        bferror("misc_register failed");
+        goto misc_register_trace_failed;
+    }
+
     return 0;
 
+    misc_deregister(&shim_trace_dev);
+misc_register_trace_failed:
+
     misc_deregister(&shim_dev);
 misc_register_failed:
 
@@ -1842,6 +2331,7 @@ shim_init_failed:
 void
 dev_exit(void)
 {
+    misc_deregister(&shim_trace_dev);
     misc_deregister(&shim_dev);
     shim_fini();
     unregister_pm_notifier(&pm_notifier_block);
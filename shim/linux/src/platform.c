@@ -31,14 +31,23 @@
 #include <asm/pgtable_types.h>
 #include <debug.h>
 #include <linux/cpu.h>
+#include <linux/eventfd.h>
+#include <linux/file.h>
+#include <linux/hrtimer.h>
 #include <linux/mm.h>
+#include <linux/pid_namespace.h>
+#include <linux/poll.h>
+#include <linux/rcupdate.h>
 #include <linux/sched/mm.h>
 #include <linux/sched/signal.h>
 #include <linux/sched/task.h>
 #include <linux/slab.h>
 #include <linux/smp.h>
+#include <linux/timekeeping.h>
 #include <linux/unistd.h>
+#include <linux/version.h>
 #include <linux/vmalloc.h>
+#include <linux/wait.h>
 #include <mv_types.h>
 #include <platform.h>
 #include <work_on_cpu_callback_args.h>
@@ -627,3 +636,508 @@ platform_tsc_khz(void) NOEXCEPT
 {
     return (uint64_t)tsc_khz;
 }
+
+/**
+ * <!-- description -->
+ *   @brief Returns the current wall clock time in nanoseconds
+ *     since the epoch.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns the current wall clock time in nanoseconds
+ *     since the epoch.
+ */
+NODISCARD uint64_t
+platform_realtime_ns(void) NOEXCEPT
+{
+    return (uint64_t)ktime_get_real_ns();
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns an ID for the thread this is called from that
+ *     can later be given to platform_yield_to. 0 is never a valid
+ *     thread ID.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns an ID for the thread this is called from
+ */
+NODISCARD uint64_t
+platform_current_thread(void) NOEXCEPT
+{
+    /// NOTE:
+    /// - The global PID is used (instead of the one seen from the
+    ///   caller's PID namespace) so that the thread can be found from
+    ///   any context, including ones with no meaningful namespace (e.g.,
+    ///   the wakeup of an eventfd, see platform_kick_thread).
+    ///
+
+    return (uint64_t)task_pid_nr(current);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the task_struct of the provided thread with a
+ *     reference held, or NULL if the thread does not exist.
+ *
+ * <!-- inputs/outputs -->
+ *   @param thread the ID of the thread (from platform_current_thread)
+ *   @return Returns the task_struct of the provided thread with a
+ *     reference held, or NULL if the thread does not exist.
+ */
+NODISCARD static struct task_struct *
+platform_get_thread(uint64_t const thread) NOEXCEPT
+{
+    struct task_struct *pmut_mut_task;
+
+    rcu_read_lock();
+    pmut_mut_task = pid_task(find_pid_ns((pid_t)thread, &init_pid_ns), PIDTYPE_PID);
+    if (((void *)0) != pmut_mut_task) {
+        get_task_struct(pmut_mut_task);
+    }
+    else {
+        mv_touch();
+    }
+    rcu_read_unlock();
+
+    return pmut_mut_task;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Gives the rest of the current thread's time slice to the
+ *     provided thread. Returns SHIM_FAILURE if the thread does not
+ *     exist or is not waiting to run, in which case nothing
+ *     happens.
+ *
+ * <!-- inputs/outputs -->
+ *   @param thread the ID of the thread (from platform_current_thread)
+ *     to yield to
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+platform_yield_to(uint64_t const thread) NOEXCEPT
+{
+    int mut_ret;
+    struct task_struct *const pmut_task = platform_get_thread(thread);
+
+    if (((void *)0) == pmut_task) {
+        return SHIM_FAILURE;
+    }
+
+    mut_ret = yield_to(pmut_task, true);
+    put_task_struct(pmut_task);
+
+    if (mut_ret <= 0) {
+        return SHIM_FAILURE;
+    }
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Interrupts the provided thread if it is running so that
+ *     it goes back through the scheduler (e.g., so that a VCPU
+ *     thread leaves its guest). Nothing happens if the thread does
+ *     not exist or is not running. This can be called from any
+ *     context, including atomic ones.
+ *
+ * <!-- inputs/outputs -->
+ *   @param thread the ID of the thread (from platform_current_thread)
+ *     to kick
+ */
+void
+platform_kick_thread(uint64_t const thread) NOEXCEPT
+{
+    struct task_struct *pmut_mut_task;
+
+    /// NOTE:
+    /// - kick_process() sends a reschedule IPI to the PP the thread is
+    ///   running on. If that PP is running a guest, the IPI causes a
+    ///   VMExit, which returns to the shim with EXIT_REASON_INTERRUPT,
+    ///   and the next mv_vs_op_run injects whatever is pending.
+    ///
+
+    rcu_read_lock();
+    pmut_mut_task = pid_task(find_pid_ns((pid_t)thread, &init_pid_ns), PIDTYPE_PID);
+    if (((void *)0) != pmut_mut_task) {
+        kick_process(pmut_mut_task);
+    }
+    else {
+        mv_touch();
+    }
+    rcu_read_unlock();
+}
+
+/**
+ * <!-- description -->
+ *   @brief Initializes a wait queue. This must be called before a
+ *     wait queue can be used.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_waitq the wait queue to initialize
+ */
+void
+platform_waitq_init(platform_waitq *const pmut_waitq) NOEXCEPT
+{
+    init_waitqueue_head(pmut_waitq);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Puts the current thread to sleep on the provided wait
+ *     queue until the provided flag is set (see platform_waitq_wake),
+ *     the timeout expires, or the thread is interrupted. The flag is
+ *     cleared before this returns. Returns SHIM_INTERRUPTED if the
+ *     thread was interrupted, SHIM_SUCCESS otherwise.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_waitq the wait queue to sleep on
+ *   @param pmut_flag the flag to wait for
+ *   @param timeout_ns the maximum number of nanoseconds to sleep
+ *     for, or PLATFORM_WAIT_FOREVER
+ *   @return Returns SHIM_INTERRUPTED if the thread was interrupted,
+ *     SHIM_SUCCESS otherwise.
+ */
+NODISCARD int64_t
+platform_waitq_wait(
+    platform_waitq *const pmut_waitq,
+    uint64_t *const pmut_flag,
+    uint64_t const timeout_ns) NOEXCEPT
+{
+    long mut_ret;
+
+    /// NOTE:
+    /// - A timeout too large for a ktime_t is as good as no timeout.
+    ///   On a timeout, wait_event_interruptible_hrtimeout() returns
+    ///   -ETIME, which, like a wakeup, just means that the VCPU has to
+    ///   be run again.
+    ///
+
+    if (timeout_ns > (uint64_t)KTIME_MAX) {
+        mut_ret = wait_event_interruptible(*pmut_waitq, 0 != READ_ONCE(*pmut_flag));
+    }
+    else {
+        mut_ret = wait_event_interruptible_hrtimeout(
+            *pmut_waitq, 0 != READ_ONCE(*pmut_flag), ns_to_ktime(timeout_ns));
+    }
+
+    WRITE_ONCE(*pmut_flag, ((uint64_t)0));
+
+    if (-ERESTARTSYS == mut_ret) {
+        return SHIM_INTERRUPTED;
+    }
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Sets the provided flag and wakes up the thread sleeping
+ *     on the provided wait queue, if there is one. If no thread is
+ *     sleeping, the next platform_waitq_wait returns right away.
+ *     This can be called from any context, including atomic ones.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_waitq the wait queue to wake up
+ *   @param pmut_flag the flag to set
+ */
+void
+platform_waitq_wake(platform_waitq *const pmut_waitq, uint64_t *const pmut_flag) NOEXCEPT
+{
+    WRITE_ONCE(*pmut_flag, ((uint64_t)1));
+    wake_up_interruptible(pmut_waitq);
+}
+
+/**
+ * @struct platform_eventfd_watch_t
+ *
+ * <!-- description -->
+ *   @brief Stores the state of a watch on an eventfd (see
+ *     platform_eventfd_watch).
+ */
+struct platform_eventfd_watch_t
+{
+    /** @brief stores the entry added to the eventfd's wait queue */
+    wait_queue_entry_t wait;
+    /** @brief stores the poll table used to find the eventfd's wait queue */
+    poll_table pt;
+    /** @brief stores the eventfd that is watched */
+    struct eventfd_ctx *ctx;
+    /** @brief stores the eventfd's file until the watch is started */
+    struct file *file;
+    /** @brief stores the function to call when the eventfd is signaled */
+    platform_eventfd_func func;
+    /** @brief stores the argument to pass to func */
+    void *arg;
+};
+
+/**
+ * <!-- description -->
+ *   @brief Called by the eventfd's wait queue (with its lock held)
+ *     each time the eventfd is signaled or released.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_wait the wait queue entry of the watch
+ *   @param mode ignored
+ *   @param sync ignored
+ *   @param key the poll events that woke the wait queue
+ *   @return Always returns 0
+ */
+static int
+platform_eventfd_wakeup(
+    wait_queue_entry_t *const pmut_wait,
+    unsigned const mode,
+    int const sync,
+    void *const key) NOEXCEPT
+{
+    struct platform_eventfd_watch_t *const pmut_watch =
+        container_of(pmut_wait, struct platform_eventfd_watch_t, wait);
+
+    (void)mode;
+    (void)sync;
+
+    /// NOTE:
+    /// - Like KVM's irqfd, the eventfd's counter is not read here.
+    ///   Every write wakes the wait queue with EPOLLIN whether or not
+    ///   the counter was already set, which is all that is needed.
+    /// - EPOLLHUP (userspace closed the eventfd) is ignored. The watch
+    ///   holds a reference to the eventfd, so it stays valid until it
+    ///   is removed using KVM_IRQFD_FLAG_DEASSIGN or the VM is destroyed.
+    ///
+
+    if (0U != (key_to_poll(key) & EPOLLIN)) {
+        pmut_watch->func(pmut_watch->arg);
+    }
+    else {
+        mv_touch();
+    }
+
+    return 0;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Called by vfs_poll() with the eventfd's wait queue, which
+ *     the watch is added to.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_file ignored
+ *   @param pmut_wqh the eventfd's wait queue
+ *   @param pmut_pt the poll table of the watch
+ */
+static void
+platform_eventfd_queue(
+    struct file *const pmut_file,
+    wait_queue_head_t *const pmut_wqh,
+    poll_table *const pmut_pt) NOEXCEPT
+{
+    struct platform_eventfd_watch_t *const pmut_watch =
+        container_of(pmut_pt, struct platform_eventfd_watch_t, pt);
+
+    (void)pmut_file;
+    add_wait_queue(pmut_wqh, &pmut_watch->wait);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Prepares a watch that calls pmut_func with pmut_arg each
+ *     time the provided eventfd is signaled, once it is started using
+ *     platform_eventfd_watch_start. fd is only resolved here, so the
+ *     eventfd returned by platform_eventfd_watch_eventfd is always the
+ *     one that is watched. Returns NULL if fd is not an eventfd.
+ *
+ * <!-- inputs/outputs -->
+ *   @param fd the file descriptor of the eventfd to watch
+ *   @param pmut_func the function to call when the eventfd is
+ *     signaled
+ *   @param pmut_arg the argument to pass to pmut_func
+ *   @return Returns a handle to the watch on success, NULL on
+ *     failure.
+ */
+NODISCARD void *
+platform_eventfd_watch(
+    uint64_t const fd, platform_eventfd_func const pmut_func, void *const pmut_arg) NOEXCEPT
+{
+    struct platform_eventfd_watch_t *pmut_mut_watch;
+
+    platform_expects(((void *)0) != pmut_func);
+
+    pmut_mut_watch = kzalloc(sizeof(struct platform_eventfd_watch_t), GFP_KERNEL);
+    if (((void *)0) == pmut_mut_watch) {
+        bferror("kzalloc failed");
+        return ((void *)0);
+    }
+
+    pmut_mut_watch->file = fget((unsigned int)fd);
+    if (((void *)0) == pmut_mut_watch->file) {
+        bferror("fget failed");
+        kfree(pmut_mut_watch);
+        return ((void *)0);
+    }
+
+    pmut_mut_watch->ctx = eventfd_ctx_fileget(pmut_mut_watch->file);
+    if (IS_ERR(pmut_mut_watch->ctx)) {
+        bferror("eventfd_ctx_fileget failed");
+        fput(pmut_mut_watch->file);
+        kfree(pmut_mut_watch);
+        return ((void *)0);
+    }
+
+    pmut_mut_watch->func = pmut_func;
+    pmut_mut_watch->arg = pmut_arg;
+
+    init_waitqueue_func_entry(&pmut_mut_watch->wait, &platform_eventfd_wakeup);
+    init_poll_funcptr(&pmut_mut_watch->pt, &platform_eventfd_queue);
+
+    return pmut_mut_watch;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the eventfd of the provided watch. The result can
+ *     be compared with the handles returned by platform_eventfd_get,
+ *     and is valid until the watch is stopped.
+ *
+ * <!-- inputs/outputs -->
+ *   @param watch the watch (from platform_eventfd_watch)
+ *   @return Returns the eventfd of the provided watch.
+ */
+NODISCARD void *
+platform_eventfd_watch_eventfd(void const *const watch) NOEXCEPT
+{
+    platform_expects(((void *)0) != watch);
+    return ((struct platform_eventfd_watch_t const *)watch)->ctx;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Starts a watch from platform_eventfd_watch. From here on,
+ *     the watch's function is called each time the eventfd is
+ *     signaled, as well as right away if it already is. It is called
+ *     from the context of whoever signaled the eventfd, which can be
+ *     an atomic one, so it must not sleep.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_watch the watch (from platform_eventfd_watch) to start
+ */
+void
+platform_eventfd_watch_start(void *const pmut_watch) NOEXCEPT
+{
+    __poll_t mut_events;
+    struct platform_eventfd_watch_t *const pmut_mut_watch =
+        (struct platform_eventfd_watch_t *)pmut_watch;
+
+    platform_expects(((void *)0) != pmut_mut_watch);
+    platform_expects(((void *)0) != pmut_mut_watch->file);
+
+    /// NOTE:
+    /// - The wait is installed on the same file the eventfd was taken
+    ///   from, and not on whatever fd refers to by now.
+    ///
+
+    mut_events = vfs_poll(pmut_mut_watch->file, &pmut_mut_watch->pt);
+    fput(pmut_mut_watch->file);
+    pmut_mut_watch->file = ((void *)0);
+
+    if (0U != (mut_events & EPOLLIN)) {
+        pmut_mut_watch->func(pmut_mut_watch->arg);
+    }
+    else {
+        mv_touch();
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief Stops watching an eventfd and releases the watch, whether
+ *     or not it was started. Once this returns, the watch's callback
+ *     is no longer running, and will not be called again.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_watch the watch (from platform_eventfd_watch) to
+ *     stop
+ */
+void
+platform_eventfd_unwatch(void *const pmut_watch) NOEXCEPT
+{
+    __u64 mut_cnt;
+    struct platform_eventfd_watch_t *const pmut_mut_watch =
+        (struct platform_eventfd_watch_t *)pmut_watch;
+
+    platform_expects(((void *)0) != pmut_mut_watch);
+
+    if (((void *)0) != pmut_mut_watch->file) {
+        fput(pmut_mut_watch->file);
+    }
+    else {
+        /// NOTE:
+        /// - The wait queue entry is removed with the wait queue's lock
+        ///   held, which is also held while the callback runs, so once
+        ///   this returns, the callback is done with the watch.
+        ///
+
+        (void)eventfd_ctx_remove_wait_queue(pmut_mut_watch->ctx, &pmut_mut_watch->wait, &mut_cnt);
+    }
+
+    eventfd_ctx_put(pmut_mut_watch->ctx);
+    kfree(pmut_mut_watch);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns a handle to the provided eventfd that can be
+ *     signaled using platform_eventfd_signal, even after userspace
+ *     closes the file descriptor. Returns NULL if fd is not an
+ *     eventfd.
+ *
+ * <!-- inputs/outputs -->
+ *   @param fd the file descriptor of the eventfd
+ *   @return Returns a handle to the eventfd on success, NULL on
+ *     failure.
+ */
+NODISCARD void *
+platform_eventfd_get(uint64_t const fd) NOEXCEPT
+{
+    struct eventfd_ctx *const pmut_ctx = eventfd_ctx_fdget((int)fd);
+    if (IS_ERR(pmut_ctx)) {
+        bferror("eventfd_ctx_fdget failed");
+        return ((void *)0);
+    }
+
+    return pmut_ctx;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Releases a handle from platform_eventfd_get.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_eventfd the handle to release
+ */
+void
+platform_eventfd_put(void *const pmut_eventfd) NOEXCEPT
+{
+    platform_expects(((void *)0) != pmut_eventfd);
+    eventfd_ctx_put((struct eventfd_ctx *)pmut_eventfd);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Signals an eventfd (i.e., adds 1 to its counter).
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_eventfd the handle (from platform_eventfd_get) of
+ *     the eventfd to signal
+ */
+void
+platform_eventfd_signal(void *const pmut_eventfd) NOEXCEPT
+{
+    platform_expects(((void *)0) != pmut_eventfd);
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 8, 0)
+    eventfd_signal((struct eventfd_ctx *)pmut_eventfd);
+#else
+    (void)eventfd_signal((struct eventfd_ctx *)pmut_eventfd, 1);
+#endif
+}
@@ -31,6 +31,7 @@
 #include <mv_hypercall.h>
 #include <mv_types.h>
 #include <platform.h>
+#include <shim_vcpu_t.h>
 #include <shim_vm_t.h>
 
 /**
@@ -44,6 +45,8 @@
 NODISCARD int64_t
 handle_system_kvm_create_vm(struct shim_vm_t *const pmut_vm) NOEXCEPT
 {
+    uint64_t mut_i;
+
     platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
     platform_expects(NULL != pmut_vm);
 
@@ -55,12 +58,32 @@ handle_system_kvm_create_vm(struct shim_vm_t *const pmut_vm) NOEXCEPT
     platform_memset(pmut_vm, ((uint8_t)0), sizeof(struct shim_vm_t));
     platform_mutex_init(&pmut_vm->mutex);
 
+    for (mut_i = ((uint64_t)0); mut_i < MICROV_MAX_VCPUS; ++mut_i) {
+        platform_waitq_init(&pmut_vm->vcpus[mut_i].halt_waitq);
+    }
+
     pmut_vm->vmid = mv_vm_op_create_vm(g_mut_hndl);
     if (MV_INVALID_ID == (int32_t)pmut_vm->vmid) {
         bferror("mv_vm_op_create_vm failed");
         return SHIM_FAILURE;
     }
 
+    /// NOTE:
+    /// - The kvmclock starts at 0 when the VM is created, so the wall
+    ///   clock that the guest reads through MSR_KVM_WALL_CLOCK_NEW is
+    ///   the time at which the VM was created.
+    ///
+
+    if (mv_vm_op_clock_set(g_mut_hndl, pmut_vm->vmid, ((uint64_t)0), platform_realtime_ns())) {
+        bferror("mv_vm_op_clock_set failed");
+
+        if (mv_vm_op_destroy_vm(g_mut_hndl, pmut_vm->vmid)) {
+            bferror("mv_vm_op_destroy_vm failed");
+        }
+
+        return SHIM_FAILURE;
+    }
+
     pmut_vm->id = pmut_vm->vmid;
     return SHIM_SUCCESS;
 }
@@ -0,0 +1,100 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_stats_t.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shared_page_for_current_pp.h>
+#include <shim_stats_init.h>
+#include <shim_stats_t.h>
+#include <shim_vcpu_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Handles the execution of kvm_get_stats_fd. This is called
+ *     each time the fd is read and returns the VMExit, hypercall,
+ *     halt-polling and extended state statistics of the VCPU's VS.
+ *
+ * <!-- inputs/outputs -->
+ *   @param vcpu the VCPU whose stats are being read
+ *   @param pmut_stats returns the binary stats to read from the fd
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+handle_vcpu_kvm_get_stats_fd(
+    struct shim_vcpu_t const *const vcpu, struct shim_stats_t *const pmut_stats) NOEXCEPT
+{
+    static char const prefix[] = "kvm-vcpu:";
+    struct mv_stats_t *pmut_mut_page;
+
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vcpu);
+    platform_expects(NULL != pmut_stats);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    shim_stats_init(pmut_stats, prefix, sizeof(prefix) - (uint64_t)1, (uint64_t)vcpu->id);
+
+    pmut_mut_page = (struct mv_stats_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_mut_page);
+
+    if (mv_debug_op_stats_get(g_mut_hndl, vcpu->vsid, MV_STATS_TYPE_VS_EXITS)) {
+        bferror("mv_debug_op_stats_get failed");
+        return SHIM_FAILURE;
+    }
+
+    platform_memcpy(&pmut_stats->exits, pmut_mut_page, sizeof(struct mv_stats_t));
+
+    if (mv_debug_op_stats_get(g_mut_hndl, vcpu->vsid, MV_STATS_TYPE_VS_HYPERCALLS)) {
+        bferror("mv_debug_op_stats_get failed");
+        return SHIM_FAILURE;
+    }
+
+    platform_memcpy(&pmut_stats->hypercalls, pmut_mut_page, sizeof(struct mv_stats_t));
+
+    if (mv_debug_op_stats_get(g_mut_hndl, vcpu->vsid, MV_STATS_TYPE_VS_HALT_POLLS)) {
+        bferror("mv_debug_op_stats_get failed");
+        return SHIM_FAILURE;
+    }
+
+    platform_memcpy(&pmut_stats->halt_polls, pmut_mut_page, sizeof(struct mv_stats_t));
+
+    if (mv_debug_op_stats_get(g_mut_hndl, vcpu->vsid, MV_STATS_TYPE_VS_FPU)) {
+        bferror("mv_debug_op_stats_get failed");
+        return SHIM_FAILURE;
+    }
+
+    platform_memcpy(&pmut_stats->fpu, pmut_mut_page, sizeof(struct mv_stats_t));
+    return SHIM_SUCCESS;
+}
@@ -30,23 +30,27 @@
 #include <mv_hypercall.h>
 #include <mv_types.h>
 #include <platform.h>
+#include <shim_vcpu_t.h>
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_get_tsc_khz.
  *
  * <!-- inputs/outputs -->
- *   @param pmut_tsc_khz returns the virtual tsc khz  
+ *   @param vcpu arguments recevied from the private data
+ *   @param pmut_tsc_khz returns the virtual tsc khz
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vcpu_kvm_get_tsc_khz(uint64_t *const pmut_tsc_khz) NOEXCEPT
+handle_vcpu_kvm_get_tsc_khz(
+    struct shim_vcpu_t const *const vcpu, uint64_t *const pmut_tsc_khz) NOEXCEPT
 {
     platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vcpu);
     platform_expects(NULL != pmut_tsc_khz);
 
-    if (mv_pp_op_tsc_get_khz(g_mut_hndl, pmut_tsc_khz)) {
-        bferror("mv_pp_op_tsc_get_khz failed");
+    if (mv_vs_op_tsc_get_khz(g_mut_hndl, vcpu->vsid, pmut_tsc_khz)) {
+        bferror("mv_vs_op_tsc_get_khz failed");
         return SHIM_FAILURE;
     }
     return SHIM_SUCCESS;
@@ -24,20 +24,45 @@
  * SOFTWARE.
  */
 
+
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
 #include <kvm_interrupt.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vcpu_t.h>
 
 /**
  * <!-- description -->
- *   @brief Handles the execution of kvm_interrupt.
+ *   @brief Handles the execution of kvm_interrupt. This is only used when
+ *     userspace emulates the irqchip, in which case the vector is queued
+ *     as an ExtINT and injected once the guest opens an interrupt window.
  *
  * <!-- inputs/outputs -->
- *   @param pmut_ioctl_args the arguments provided by userspace
+ *   @param vcpu arguments received from private data
+ *   @param args the arguments provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vcpu_kvm_interrupt(struct kvm_interrupt *const pmut_ioctl_args) NOEXCEPT
+handle_vcpu_kvm_interrupt(
+    struct shim_vcpu_t const *const vcpu, struct kvm_interrupt const *const args) NOEXCEPT
 {
-    (void)pmut_ioctl_args;
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vcpu);
+    platform_expects(NULL != args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vs_op_queue_interrupt(g_mut_hndl, vcpu->vsid, (uint64_t)args->irq)) {
+        bferror("mv_vs_op_queue_interrupt failed");
+        return SHIM_FAILURE;
+    }
+
     return SHIM_SUCCESS;
 }
@@ -22,19 +22,42 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
- */
 
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vcpu_t.h>
 
 /**
  * <!-- description -->
- *   @brief Handles the execution of kvm_kvmclock_ctrl.
+ *   @brief Handles the execution of kvm_kvmclock_ctrl. This tells the
+ *     guest that it was paused by userspace the next time the vCPU
+ *     runs, so that it does not report the time it was paused as a
+ *     soft lockup.
  *
  * <!-- inputs/outputs -->
+ *   @param vcpu the vCPU that was paused
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vcpu_kvm_kvmclock_ctrl(void) NOEXCEPT
+handle_vcpu_kvm_kvmclock_ctrl(struct shim_vcpu_t const *const vcpu) NOEXCEPT
 {
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vcpu);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vs_op_kvmclock_ctrl(g_mut_hndl, vcpu->vsid)) {
+        bferror("mv_vs_op_kvmclock_ctrl failed");
+        return SHIM_FAILURE;
+    }
+
     return SHIM_SUCCESS;
 }
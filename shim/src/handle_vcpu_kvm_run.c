@@ -29,14 +29,22 @@
 #include <g_mut_hndl.h>
 #include <kvm_run.h>
 #include <kvm_run_io.h>
+#include <kvm_sync_regs.h>
 #include <mv_bit_size_t.h>
 #include <mv_exit_io_t.h>
+#include <mv_exit_mmio_t.h>
 #include <mv_exit_reason_t.h>
 #include <mv_hypercall.h>
+#include <mv_run_t.h>
+#include <mv_sync_regs_t.h>
 #include <mv_types.h>
 #include <platform.h>
 #include <shared_page_for_current_pp.h>
+#include <shim_irqfd.h>
+#include <shim_vcpu_cache_flush.h>
 #include <shim_vcpu_t.h>
+#include <shim_vm_kick.h>
+#include <shim_vm_t.h>
 
 /**
  * <!-- description -->
@@ -123,7 +131,133 @@ handle_vcpu_kvm_run_unknown(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
 
 /**
  * <!-- description -->
- *   @brief Handles mv_exit_reason_t_io
+ *   @brief Handles mv_exit_reason_t_hlt for a VCPU whose interrupts
+ *     are not emulated in the kernel. MicroV only returns this once it
+ *     has given up polling for an interrupt, so userspace gets to
+ *     block the VCPU the same way it would with KVM.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+handle_vcpu_kvm_run_hlt(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    pmut_vcpu->run->exit_reason = KVM_EXIT_HLT;
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Handles mv_exit_reason_t_hlt for a VCPU whose VM has an
+ *     in-kernel irqchip. Like KVM, the VCPU is not handed back to
+ *     userspace, which has no way of knowing when to run it again.
+ *     Instead, it sleeps until an irqfd, KVM_IRQ_LINE or a kick from
+ *     another VCPU wakes it up, or until the timeout MicroV reported
+ *     for its timers has passed, and is then run again.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ *   @return SHIM_SUCCESS once the VCPU has to be run again, and
+ *     SHIM_INTERRUPTED if the wait was interrupted by a signal.
+ */
+NODISCARD static int64_t
+wait_vcpu_kvm_run_hlt(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_timeout_ns;
+    struct mv_run_t const *const mv_run = (struct mv_run_t *)shared_page_for_current_pp();
+    platform_expects(NULL != mv_run);
+
+    mut_timeout_ns = mv_run->hlt_timeout_ns;
+    if (MV_RUN_HLT_NO_TIMEOUT == mut_timeout_ns) {
+        mut_timeout_ns = PLATFORM_WAIT_FOREVER;
+    }
+    else {
+        mv_touch();
+    }
+
+    return platform_waitq_wait(&pmut_vcpu->halt_waitq, &pmut_vcpu->halt_wakeup, mut_timeout_ns);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Handles mv_exit_reason_t_exit_page. MicroV has already written
+ *     the IO or MMIO exit into kvm_run (see shim_vcpu_exit_page_enable),
+ *     including run->exit_reason, and reads the result of an IN or MMIO
+ *     read from kvm_run the next time the VCPU is run, so there is
+ *     nothing to translate and nothing to complete.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+handle_vcpu_kvm_run_exit_page(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    platform_expects(((uint8_t)0) != pmut_vcpu->exit_page);
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Handles mv_exit_reason_t_yield. MicroV returns this when the
+ *     VCPU has been spinning in a PAUSE loop, which usually means that it
+ *     is waiting on a lock held by a sibling VCPU that is not running.
+ *     Like KVM's kvm_vcpu_on_spin, the rest of this thread's time slice
+ *     is given to the thread of a sibling VCPU, starting with the one
+ *     after the VCPU that was last yielded to so that the lock holder is
+ *     eventually found. If no sibling can be yielded to, the VCPU is
+ *     simply run again.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ */
+static void
+handle_vcpu_kvm_run_yield(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_i;
+    uint64_t mut_idx;
+    struct shim_vcpu_t *pmut_mut_sibling;
+    struct shim_vm_t *const pmut_vm = pmut_vcpu->vm;
+
+    if (NULL == pmut_vm) {
+        return;
+    }
+
+    /// NOTE:
+    /// - last_yield is read and written without holding the VM's mutex.
+    ///   Two VCPUs racing on it at worst yield to the same sibling, which
+    ///   is harmless, and taking the mutex here would make spinning VCPUs
+    ///   contend with each other.
+    ///
+
+    mut_idx = pmut_vm->last_yield;
+    for (mut_i = ((uint64_t)0); mut_i < MICROV_MAX_VCPUS; ++mut_i) {
+        mut_idx = (mut_idx + ((uint64_t)1)) % MICROV_MAX_VCPUS;
+        pmut_mut_sibling = &pmut_vm->vcpus[mut_idx];
+
+        if (pmut_mut_sibling == pmut_vcpu) {
+            mv_touch();
+        }
+        else if (((uint64_t)0) == pmut_mut_sibling->thread) {
+            mv_touch();
+        }
+        else if (SHIM_SUCCESS == platform_yield_to(pmut_mut_sibling->thread)) {
+            pmut_vm->last_yield = mut_idx;
+            return;
+        }
+        else {
+            mv_touch();
+        }
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief Handles mv_exit_reason_t_io. IN/OUT use io.data8/16/32 while
+ *     string IO (INS/OUTS) hands userspace a batch of reps elements in
+ *     run->pio_data, the same way KVM does. For IN/INS, the data userspace
+ *     provides is given back to MicroV on the next KVM_RUN.
  *
  * <!-- inputs/outputs -->
  *   @param pmut_vcpu the VCPU associated with the IOCTL
@@ -132,6 +266,7 @@ handle_vcpu_kvm_run_unknown(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
 NODISCARD static int64_t
 handle_vcpu_kvm_run_io(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
 {
+    uint64_t mut_bytes;
     struct mv_exit_io_t *const pmut_exit_io = (struct mv_exit_io_t *)shared_page_for_current_pp();
     platform_expects(NULL != pmut_exit_io);
 
@@ -189,18 +324,322 @@ handle_vcpu_kvm_run_io(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
         return return_failure(pmut_vcpu);
     }
 
-    if (pmut_exit_io->reps < INT32_MAX) {
+    if (((uint64_t)0) == pmut_exit_io->reps) {
+        pmut_vcpu->run->io.count = ((uint32_t)1);
+    }
+    else if (pmut_exit_io->reps <= (MV_EXIT_IO_MAX_BUF_SIZE / (uint64_t)pmut_vcpu->run->io.size)) {
+        mut_bytes = pmut_exit_io->reps * (uint64_t)pmut_vcpu->run->io.size;
         pmut_vcpu->run->io.count = (uint32_t)pmut_exit_io->reps;
+        pmut_vcpu->run->io.data_offset = get_offset(pmut_vcpu, pmut_vcpu->run->pio_data);
+
+        if (KVM_EXIT_IO_OUT == pmut_vcpu->run->io.direction) {
+            platform_memcpy(pmut_vcpu->run->pio_data, pmut_exit_io->buf, mut_bytes);
+        }
+        else {
+            mv_touch();
+        }
     }
     else {
         bferror_x64("reps is invalid", pmut_exit_io->reps);
         return return_failure(pmut_vcpu);
     }
 
+    if (KVM_EXIT_IO_IN == pmut_vcpu->run->io.direction) {
+        pmut_vcpu->io_in_pending = ((uint8_t)1);
+    }
+    else {
+        pmut_vcpu->io_in_pending = ((uint8_t)0);
+    }
+
     pmut_vcpu->run->exit_reason = KVM_EXIT_IO;
     return SHIM_SUCCESS;
 }
 
+/**
+ * <!-- description -->
+ *   @brief Gives the data userspace read for the last IN/INS exit back
+ *     to MicroV so that it can complete the guest's IN/INS. This must be
+ *     done on the same PP as the mv_vs_op_run that follows it.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ */
+static void
+complete_vcpu_kvm_run_io(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_data = ((uint64_t)0);
+    uint64_t const size = (uint64_t)pmut_vcpu->run->io.size;
+    uint64_t const count = (uint64_t)pmut_vcpu->run->io.count;
+    struct mv_exit_io_t *const pmut_exit_io = (struct mv_exit_io_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_exit_io);
+
+    if (get_offset(pmut_vcpu, pmut_vcpu->run->pio_data) == pmut_vcpu->run->io.data_offset) {
+        if ((size * count) <= MV_EXIT_IO_MAX_BUF_SIZE) {
+            platform_memcpy(pmut_exit_io->buf, pmut_vcpu->run->pio_data, size * count);
+        }
+        else {
+            bferror_x64("count is invalid", count);
+        }
+
+        return;
+    }
+
+    switch (size) {
+        case ((uint64_t)1): {
+            mut_data = (uint64_t)pmut_vcpu->run->io.data8;
+            break;
+        }
+
+        case ((uint64_t)2): {
+            mut_data = (uint64_t)pmut_vcpu->run->io.data16;
+            break;
+        }
+
+        default: {
+            mut_data = (uint64_t)pmut_vcpu->run->io.data32;
+            break;
+        }
+    }
+
+    pmut_exit_io->data = mut_data;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Handles mv_exit_reason_t_mmio. MicroV has already decoded the
+ *     instruction and advanced the guest's IP, so all that is left is to
+ *     hand the access to userspace. For reads, the data userspace places
+ *     in run->mmio.data is given back to MicroV on the next KVM_RUN.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+handle_vcpu_kvm_run_mmio(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint32_t mut_len;
+    struct mv_exit_mmio_t *const pmut_exit_mmio =
+        (struct mv_exit_mmio_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_exit_mmio);
+
+    switch ((int32_t)pmut_exit_mmio->size) {
+        case mv_bit_size_t_8: {
+            mut_len = ((uint32_t)1);
+            break;
+        }
+
+        case mv_bit_size_t_16: {
+            mut_len = ((uint32_t)2);
+            break;
+        }
+
+        case mv_bit_size_t_32: {
+            mut_len = ((uint32_t)4);
+            break;
+        }
+
+        case mv_bit_size_t_64: {
+            mut_len = ((uint32_t)8);
+            break;
+        }
+
+        default: {
+            bferror_d32("size is invalid", (uint32_t)pmut_exit_mmio->size);
+            return return_failure(pmut_vcpu);
+        }
+    }
+
+    pmut_vcpu->run->mmio.phys_addr = pmut_exit_mmio->gpa;
+    pmut_vcpu->run->mmio.len = mut_len;
+    platform_memset(pmut_vcpu->run->mmio.data, ((uint8_t)0), KVM_RUN_MMIO_DATA_SIZE);
+
+    if (((uint64_t)0) != (pmut_exit_mmio->flags & MV_EXIT_MMIO_WRITE)) {
+        pmut_vcpu->run->mmio.is_write = ((uint8_t)1);
+        platform_memcpy(pmut_vcpu->run->mmio.data, &pmut_exit_mmio->data, (uint64_t)mut_len);
+        pmut_vcpu->mmio_read_pending = ((uint8_t)0);
+    }
+    else {
+        pmut_vcpu->run->mmio.is_write = ((uint8_t)0);
+        pmut_vcpu->mmio_read_pending = ((uint8_t)1);
+    }
+
+    pmut_vcpu->run->exit_reason = KVM_EXIT_MMIO;
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Gives the data userspace read for the last MMIO exit back to
+ *     MicroV so that it can complete the guest's register writeback. This
+ *     must be done on the same PP as the mv_vs_op_run that follows it.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ */
+static void
+complete_vcpu_kvm_run_mmio(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_data = ((uint64_t)0);
+    struct mv_exit_mmio_t *const pmut_exit_mmio =
+        (struct mv_exit_mmio_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_exit_mmio);
+
+    if (pmut_vcpu->run->mmio.len <= KVM_RUN_MMIO_DATA_SIZE) {
+        platform_memcpy(&mut_data, pmut_vcpu->run->mmio.data, (uint64_t)pmut_vcpu->run->mmio.len);
+    }
+    else {
+        bferror_d32("len is invalid", pmut_vcpu->run->mmio.len);
+    }
+
+    pmut_exit_mmio->data = mut_data;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Implements the entry half of KVM_CAP_SYNC_REGS. Tells MicroV
+ *     which registers to return on exit, and hands it the registers
+ *     userspace marked dirty in run->s.regs so that KVM_SET_REGS is not
+ *     needed. Since a yield can run another VCPU on this PP, this must be
+ *     done before every mv_vs_op_run, on the same PP.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+sync_vcpu_kvm_run_regs_to_mv(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    struct kvm_run *const pmut_run = pmut_vcpu->run;
+    struct mv_run_t *const pmut_mv_run = (struct mv_run_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_mv_run);
+
+    if (((uint64_t)0) != (pmut_run->kvm_valid_regs & ~KVM_SYNC_X86_VALID_FIELDS)) {
+        bferror_x64("kvm_valid_regs is invalid", pmut_run->kvm_valid_regs);
+        return SHIM_FAILURE;
+    }
+
+    if (((uint64_t)0) != (pmut_run->kvm_dirty_regs & ~KVM_SYNC_X86_VALID_FIELDS)) {
+        bferror_x64("kvm_dirty_regs is invalid", pmut_run->kvm_dirty_regs);
+        return SHIM_FAILURE;
+    }
+
+    pmut_mv_run->sync_regs.valid = ((uint64_t)0);
+    pmut_mv_run->sync_regs.dirty = ((uint64_t)0);
+
+    if (((uint64_t)0) != (pmut_run->kvm_valid_regs & KVM_SYNC_X86_REGS)) {
+        pmut_mv_run->sync_regs.valid = MV_SYNC_REGS_GPRS;
+    }
+    else {
+        mv_touch();
+    }
+
+    /// NOTE:
+    /// - kvm_regs and the MV_SYNC_REGS_GPRS part of mv_sync_regs_t store
+    ///   the same registers in the same order, starting with rax.
+    ///
+
+    if (((uint64_t)0) != (pmut_run->kvm_dirty_regs & KVM_SYNC_X86_REGS)) {
+        platform_memcpy(
+            &pmut_mv_run->sync_regs.rax, &pmut_run->s.regs.regs, sizeof(struct kvm_regs));
+
+        pmut_mv_run->sync_regs.dirty = MV_SYNC_REGS_GPRS;
+        pmut_run->kvm_dirty_regs &= ~KVM_SYNC_X86_REGS;
+    }
+    else {
+        mv_touch();
+    }
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Implements the exit half of KVM_CAP_SYNC_REGS. Copies the
+ *     registers MicroV returned from mv_vs_op_run into run->s.regs so
+ *     that KVM_GET_REGS is not needed. Running the VS invalidates the
+ *     VCPU's register cache, but the registers MicroV returned are just
+ *     as current, so they are cached as well.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ */
+static void
+sync_vcpu_kvm_run_regs_from_mv(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    struct kvm_run *const pmut_run = pmut_vcpu->run;
+    struct mv_run_t const *const mv_run = (struct mv_run_t *)shared_page_for_current_pp();
+    platform_expects(NULL != mv_run);
+
+    pmut_vcpu->cache_valid = ((uint64_t)0);
+
+    if (((uint64_t)0) != (pmut_run->kvm_valid_regs & KVM_SYNC_X86_REGS)) {
+        platform_memcpy(&pmut_run->s.regs.regs, &mv_run->sync_regs.rax, sizeof(struct kvm_regs));
+        platform_memcpy(&pmut_vcpu->regs, &mv_run->sync_regs.rax, sizeof(struct kvm_regs));
+        pmut_vcpu->cache_valid = SHIM_VCPU_CACHE_REGS;
+    }
+    else {
+        mv_touch();
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief Signals the resamplefds of the irqfds whose GSIs MicroV
+ *     resampled (see KVM_IRQFD_FLAG_RESAMPLE) while the VS ran. The
+ *     GSIs are cleared once they are read so that they are not
+ *     signaled again if the next mv_vs_op_run fails before it gets to
+ *     fill them in.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ */
+static void
+resample_vcpu_kvm_run_irqfds(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_resampled;
+    struct mv_run_t *const pmut_mv_run = (struct mv_run_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_mv_run);
+
+    mut_resampled = pmut_mv_run->resampled;
+    pmut_mv_run->resampled = ((uint64_t)0);
+
+    if (NULL != pmut_vcpu->vm) {
+        shim_irqfd_resample(pmut_vcpu->vm, mut_resampled);
+    }
+    else {
+        mv_touch();
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief MicroV sets mv_run_t.wakeup when this VS sent an IPI, NMI or
+ *     kick to a VS of the same VM that had halted. That VS might be
+ *     sleeping in wait_vcpu_kvm_run_hlt, so the VM is kicked to wake
+ *     it up.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU associated with the IOCTL
+ */
+static void
+wakeup_vcpu_kvm_run_vm(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_wakeup;
+    struct mv_run_t *const pmut_mv_run = (struct mv_run_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_mv_run);
+
+    mut_wakeup = pmut_mv_run->wakeup;
+    pmut_mv_run->wakeup = ((uint64_t)0);
+
+    if (((uint64_t)0) != mut_wakeup && NULL != pmut_vcpu->vm) {
+        shim_vm_kick(pmut_vcpu->vm);
+    }
+    else {
+        mv_touch();
+    }
+}
+
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_run.
@@ -221,12 +660,52 @@ handle_vcpu_kvm_run(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
         return return_failure(pmut_vcpu);
     }
 
+    pmut_vcpu->thread = platform_current_thread();
+
+    /// NOTE:
+    /// - Registers userspace set since the last KVM_RUN are only written
+    ///   back to MicroV now. This is done before the MMIO/IO completion
+    ///   and the sync regs are placed in the shared page, as the flush
+    ///   uses the shared page too, and it leaves nothing dirty, so it is
+    ///   not needed again if the loop below runs the VS more than once.
+    ///
+
+    if (SHIM_SUCCESS != shim_vcpu_cache_flush(pmut_vcpu)) {
+        bferror("shim_vcpu_cache_flush failed");
+        return return_failure(pmut_vcpu);
+    }
+
     while (0 == (int32_t)pmut_vcpu->run->immediate_exit) {
         if (platform_interrupted()) {
             break;
         }
 
+        if (((uint8_t)0) != pmut_vcpu->mmio_read_pending) {
+            complete_vcpu_kvm_run_mmio(pmut_vcpu);
+            pmut_vcpu->mmio_read_pending = ((uint8_t)0);
+        }
+        else {
+            mv_touch();
+        }
+
+        if (((uint8_t)0) != pmut_vcpu->io_in_pending) {
+            complete_vcpu_kvm_run_io(pmut_vcpu);
+            pmut_vcpu->io_in_pending = ((uint8_t)0);
+        }
+        else {
+            mv_touch();
+        }
+
+        if (SHIM_SUCCESS != sync_vcpu_kvm_run_regs_to_mv(pmut_vcpu)) {
+            bferror("sync_vcpu_kvm_run_regs_to_mv failed");
+            return return_failure(pmut_vcpu);
+        }
+
         mut_exit_reason = mv_vs_op_run(g_mut_hndl, pmut_vcpu->vsid);
+        sync_vcpu_kvm_run_regs_from_mv(pmut_vcpu);
+        resample_vcpu_kvm_run_irqfds(pmut_vcpu);
+        wakeup_vcpu_kvm_run_vm(pmut_vcpu);
+
         switch ((int32_t)mut_exit_reason) {
             case mv_exit_reason_t_failure: {
                 return handle_vcpu_kvm_run_failure(pmut_vcpu);
@@ -237,8 +716,16 @@ handle_vcpu_kvm_run(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
             }
 
             case mv_exit_reason_t_hlt: {
-                bferror("mv_exit_reason_t_hlt currently not implemented\n");
-                return return_failure(pmut_vcpu);
+                if (NULL == pmut_vcpu->vm || ((uint8_t)0) == pmut_vcpu->vm->irqchip) {
+                    return handle_vcpu_kvm_run_hlt(pmut_vcpu);
+                }
+
+                if (SHIM_SUCCESS != wait_vcpu_kvm_run_hlt(pmut_vcpu)) {
+                    pmut_vcpu->run->exit_reason = KVM_EXIT_INTR;
+                    return SHIM_INTERRUPTED;
+                }
+
+                continue;
             }
 
             case mv_exit_reason_t_io: {
@@ -246,8 +733,7 @@ handle_vcpu_kvm_run(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
             }
 
             case mv_exit_reason_t_mmio: {
-                bferror("mv_exit_reason_t_mmio currently not implemented\n");
-                return return_failure(pmut_vcpu);
+                return handle_vcpu_kvm_run_mmio(pmut_vcpu);
             }
 
             case mv_exit_reason_t_msr: {
@@ -263,6 +749,15 @@ handle_vcpu_kvm_run(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
                 continue;
             }
 
+            case mv_exit_reason_t_yield: {
+                handle_vcpu_kvm_run_yield(pmut_vcpu);
+                continue;
+            }
+
+            case mv_exit_reason_t_exit_page: {
+                return handle_vcpu_kvm_run_exit_page(pmut_vcpu);
+            }
+
             default: {
                 break;
             }
@@ -24,20 +24,52 @@
  * SOFTWARE.
  */
 
+
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
 #include <kvm_lapic_state.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_lapic_state_t.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shared_page_for_current_pp.h>
+#include <shim_vcpu_t.h>
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_set_lapic.
  *
  * <!-- inputs/outputs -->
- *   @param pmut_ioctl_args the arguments provided by userspace
+ *   @param vcpu arguments received from private data
+ *   @param args the arguments provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vcpu_kvm_set_lapic(struct kvm_lapic_state *const pmut_ioctl_args) NOEXCEPT
+handle_vcpu_kvm_set_lapic(
+    struct shim_vcpu_t const *const vcpu, struct kvm_lapic_state const *const args) NOEXCEPT
 {
-    (void)pmut_ioctl_args;
+    struct mv_lapic_state_t *pmut_mut_lapic;
+
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vcpu);
+    platform_expects(NULL != args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    pmut_mut_lapic = (struct mv_lapic_state_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_mut_lapic);
+
+    platform_memcpy(pmut_mut_lapic->regs, args->regs, KVM_APIC_REG_SIZE);
+
+    if (mv_vs_op_lapic_set_all(g_mut_hndl, vcpu->vsid)) {
+        bferror("mv_vs_op_lapic_set_all failed");
+        return SHIM_FAILURE;
+    }
+
     return SHIM_SUCCESS;
 }
@@ -24,17 +24,38 @@
  * SOFTWARE.
  */
 
+#include <debug.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vcpu_t.h>
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_set_tsc_khz.
  *
  * <!-- inputs/outputs -->
+ *   @param vcpu arguments recevied from the private data
+ *   @param tsc_khz the virtual tsc khz provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vcpu_kvm_set_tsc_khz(void) NOEXCEPT
+handle_vcpu_kvm_set_tsc_khz(struct shim_vcpu_t const *const vcpu, uint64_t const tsc_khz) NOEXCEPT
 {
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vcpu);
+
+    if (((uint64_t)0) == tsc_khz) {
+        bferror("KVM_SET_TSC_KHZ: a frequency of 0 is not supported");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vs_op_tsc_set_khz(g_mut_hndl, vcpu->vsid, tsc_khz)) {
+        bferror("mv_vs_op_tsc_set_khz failed");
+        return SHIM_FAILURE;
+    }
+
     return SHIM_SUCCESS;
 }
@@ -26,6 +26,7 @@
 #include <debug.h>
 #include <g_mut_hndl.h>
 #include <kvm_constants.h>
+#include <kvm_sync_regs.h>
 #include <mv_constants.h>
 #include <mv_types.h>
 #include <platform.h>
@@ -55,6 +56,9 @@ handle_vm_kvm_check_extension(unsigned long mut_userargs, uint32_t *const pmut_r
         case KVM_CAP_TSC_DEADLINE_TIMER: {
             FALLTHROUGH;
         }
+        case KVM_CAP_KVMCLOCK_CTRL: {
+            FALLTHROUGH;
+        }
         case KVM_CAP_USER_MEMORY: {
             FALLTHROUGH;
         }
@@ -71,6 +75,15 @@ handle_vm_kvm_check_extension(unsigned long mut_userargs, uint32_t *const pmut_r
             FALLTHROUGH;
         }
         case KVM_CAP_IMMEDIATE_EXIT: {
+            FALLTHROUGH;
+        }
+        case KVM_CAP_IRQFD: {
+            FALLTHROUGH;
+        }
+        case KVM_CAP_IRQFD_RESAMPLE: {
+            FALLTHROUGH;
+        }
+        case KVM_CAP_BINARY_STATS_FD: {
             *pmut_ret = (uint32_t)1;
             break;
         }
@@ -94,6 +107,14 @@ handle_vm_kvm_check_extension(unsigned long mut_userargs, uint32_t *const pmut_r
             *pmut_ret = (uint32_t)MICROV_MAX_MCE_BANKS;
             break;
         }
+        case KVM_CAP_ADJUST_CLOCK: {
+            *pmut_ret = (uint32_t)(KVM_CLOCK_TSC_STABLE | KVM_CLOCK_REALTIME);
+            break;
+        }
+        case KVM_CAP_SYNC_REGS: {
+            *pmut_ret = (uint32_t)KVM_SYNC_X86_VALID_FIELDS;
+            break;
+        }
         default: {
             bfdebug_x64("Unsupported Extension userargs", mut_userargs);
             *pmut_ret = (uint32_t)0;
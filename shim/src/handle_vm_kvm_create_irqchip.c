@@ -24,17 +24,44 @@
  * SOFTWARE.
  */
 
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vm_t.h>
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_create_irqchip.
  *
  * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM to create the irqchip for
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vm_kvm_create_irqchip(void) NOEXCEPT
+handle_vm_kvm_create_irqchip(struct shim_vm_t *const pmut_vm) NOEXCEPT
 {
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != pmut_vm);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (pmut_vm->irqchip) {
+        bferror("KVM_CREATE_IRQCHIP was already called for this VM");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vm_op_irqchip_create(g_mut_hndl, pmut_vm->vmid)) {
+        bferror("mv_vm_op_irqchip_create failed");
+        return SHIM_FAILURE;
+    }
+
+    pmut_vm->irqchip = ((uint8_t)1);
     return SHIM_SUCCESS;
 }
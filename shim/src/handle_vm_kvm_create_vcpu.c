@@ -93,5 +93,12 @@ handle_vm_kvm_create_vcpu(
     }
 
     (*pmut_vcpu)->id = (*pmut_vcpu)->vsid;
+    (*pmut_vcpu)->mmio_read_pending = ((uint8_t)0);
+    (*pmut_vcpu)->io_in_pending = ((uint8_t)0);
+    (*pmut_vcpu)->exit_page = ((uint8_t)0);
+    (*pmut_vcpu)->thread = ((uint64_t)0);
+    (*pmut_vcpu)->halt_wakeup = ((uint64_t)0);
+    (*pmut_vcpu)->cache_valid = ((uint64_t)0);
+    (*pmut_vcpu)->cache_dirty = ((uint64_t)0);
     return SHIM_SUCCESS;
 }
@@ -49,6 +49,20 @@ handle_vm_kvm_destroy_vcpu(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
         return;
     }
 
+    /// NOTE:
+    /// - The exit page is the first page of kvm_run, which is freed
+    ///   once the VCPU is gone, so MicroV has to let go of it first.
+    ///
+
+    if (((uint8_t)0) != pmut_vcpu->exit_page) {
+        platform_expects(
+            MV_STATUS_SUCCESS == mv_vs_op_clr_exit_page_gpa(g_mut_hndl, pmut_vcpu->vsid));
+        pmut_vcpu->exit_page = ((uint8_t)0);
+    }
+    else {
+        mv_touch();
+    }
+
     platform_expects(MV_STATUS_SUCCESS == mv_vs_op_destroy_vs(g_mut_hndl, pmut_vcpu->vsid));
     platform_expects(MV_STATUS_SUCCESS == mv_vp_op_destroy_vp(g_mut_hndl, pmut_vcpu->vpid));
 }
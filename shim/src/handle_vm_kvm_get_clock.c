@@ -22,22 +22,51 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
- */
 
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
 #include <kvm_clock_data.h>
+#include <kvm_constants.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vm_t.h>
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_get_clock.
  *
  * <!-- inputs/outputs -->
+ *   @param vm the VM whose kvmclock is being read
  *   @param pmut_ioctl_args the arguments provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vm_kvm_get_clock(struct kvm_clock_data *const pmut_ioctl_args) NOEXCEPT
+handle_vm_kvm_get_clock(
+    struct shim_vm_t const *const vm, struct kvm_clock_data *const pmut_ioctl_args) NOEXCEPT
 {
-    (void)pmut_ioctl_args;
+    uint64_t mut_ns;
+
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vm);
+    platform_expects(NULL != pmut_ioctl_args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vm_op_clock_get(g_mut_hndl, vm->vmid, &mut_ns)) {
+        bferror("mv_vm_op_clock_get failed");
+        return SHIM_FAILURE;
+    }
+
+    platform_memset(pmut_ioctl_args, ((uint8_t)0), sizeof(struct kvm_clock_data));
+    pmut_ioctl_args->clock = mut_ns;
+    pmut_ioctl_args->realtime = platform_realtime_ns();
+    pmut_ioctl_args->flags = (uint32_t)(KVM_CLOCK_TSC_STABLE | KVM_CLOCK_REALTIME);
+
     return SHIM_SUCCESS;
 }
@@ -0,0 +1,149 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_stats_t.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shared_page_for_current_pp.h>
+#include <shim_stats_init.h>
+#include <shim_stats_t.h>
+#include <shim_vcpu_t.h>
+#include <shim_vm_t.h>
+
+/** @brief the fd a VCPU has while KVM_CREATE_VCPU is still creating it */
+#define FD_USED ((uint64_t)1)
+
+/**
+ * <!-- description -->
+ *   @brief Adds the statistics in src to pmut_dst.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_dst the statistics to add to
+ *   @param src the statistics to add
+ */
+static void
+add_stats(struct mv_stats_t *const pmut_dst, struct mv_stats_t const *const src) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    pmut_dst->count += src->count;
+    pmut_dst->cycles += src->cycles;
+
+    for (mut_i = ((uint64_t)0); mut_i < MV_STATS_NUM_BUCKETS; ++mut_i) {
+        pmut_dst->hist[mut_i] += src->hist[mut_i];
+    }
+
+    for (mut_i = ((uint64_t)0); mut_i < MV_STATS_NUM_SLOTS; ++mut_i) {
+        pmut_dst->slots[mut_i] += src->slots[mut_i];
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief Handles the execution of kvm_get_stats_fd. This is called
+ *     each time the fd is read and returns the sum of the VMExit,
+ *     hypercall, halt-polling and extended state statistics of the VM's
+ *     VCPUs.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM whose stats are being read
+ *   @param pmut_stats returns the binary stats to read from the fd
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+handle_vm_kvm_get_stats_fd(
+    struct shim_vm_t *const pmut_vm, struct shim_stats_t *const pmut_stats) NOEXCEPT
+{
+    static char const prefix[] = "kvm-vm:";
+    int64_t mut_ret;
+    uint64_t mut_i;
+    struct mv_stats_t *pmut_mut_page;
+    struct shim_vcpu_t const *mut_vcpu;
+
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != pmut_vm);
+    platform_expects(NULL != pmut_stats);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    shim_stats_init(pmut_stats, prefix, sizeof(prefix) - (uint64_t)1, (uint64_t)pmut_vm->id);
+
+    pmut_mut_page = (struct mv_stats_t *)shared_page_for_current_pp();
+    platform_expects(NULL != pmut_mut_page);
+
+    mut_ret = SHIM_SUCCESS;
+    platform_mutex_lock(&pmut_vm->mutex);
+
+    for (mut_i = ((uint64_t)0); mut_i < MICROV_MAX_VCPUS; ++mut_i) {
+        mut_vcpu = &pmut_vm->vcpus[mut_i];
+        if (mut_vcpu->fd <= FD_USED) {
+            continue;
+        }
+
+        if (mv_debug_op_stats_get(g_mut_hndl, mut_vcpu->vsid, MV_STATS_TYPE_VS_EXITS)) {
+            bferror("mv_debug_op_stats_get failed");
+            mut_ret = SHIM_FAILURE;
+            break;
+        }
+
+        add_stats(&pmut_stats->exits, pmut_mut_page);
+
+        if (mv_debug_op_stats_get(g_mut_hndl, mut_vcpu->vsid, MV_STATS_TYPE_VS_HYPERCALLS)) {
+            bferror("mv_debug_op_stats_get failed");
+            mut_ret = SHIM_FAILURE;
+            break;
+        }
+
+        add_stats(&pmut_stats->hypercalls, pmut_mut_page);
+
+        if (mv_debug_op_stats_get(g_mut_hndl, mut_vcpu->vsid, MV_STATS_TYPE_VS_HALT_POLLS)) {
+            bferror("mv_debug_op_stats_get failed");
+            mut_ret = SHIM_FAILURE;
+            break;
+        }
+
+        add_stats(&pmut_stats->halt_polls, pmut_mut_page);
+
+        if (mv_debug_op_stats_get(g_mut_hndl, mut_vcpu->vsid, MV_STATS_TYPE_VS_FPU)) {
+            bferror("mv_debug_op_stats_get failed");
+            mut_ret = SHIM_FAILURE;
+            break;
+        }
+
+        add_stats(&pmut_stats->fpu, pmut_mut_page);
+    }
+
+    platform_mutex_unlock(&pmut_vm->mutex);
+    return mut_ret;
+}
@@ -24,20 +24,58 @@
  * SOFTWARE.
  */
 
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
 #include <kvm_irq_level.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vm_kick.h>
+#include <shim_vm_t.h>
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_irq_line.
  *
  * <!-- inputs/outputs -->
- *   @param pmut_ioctl_args the arguments provided by userspace
+ *   @param pmut_vm the VM whose interrupt line is being set
+ *   @param args the arguments provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vm_kvm_irq_line(struct kvm_irq_level *const pmut_ioctl_args) NOEXCEPT
+handle_vm_kvm_irq_line(
+    struct shim_vm_t *const pmut_vm, struct kvm_irq_level const *const args) NOEXCEPT
 {
-    (void)pmut_ioctl_args;
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != pmut_vm);
+    platform_expects(NULL != args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (!pmut_vm->irqchip) {
+        bferror("KVM_IRQ_LINE requires KVM_CREATE_IRQCHIP");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vm_op_irq_line(
+            g_mut_hndl,
+            pmut_vm->vmid,
+            (uint64_t)args->irq,
+            (uint64_t)(((uint32_t)0) != args->level))) {
+        bferror("mv_vm_op_irq_line failed");
+        return SHIM_FAILURE;
+    }
+
+    /// NOTE:
+    /// - A VCPU of this VM might be sleeping in the shim on a HLT,
+    ///   waiting for exactly this interrupt, so wake it up.
+    ///
+
+    shim_vm_kick(pmut_vm);
     return SHIM_SUCCESS;
 }
@@ -24,20 +24,264 @@
  * SOFTWARE.
  */
 
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
 #include <kvm_irqfd.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_irqfd.h>
+#include <shim_irqfd_t.h>
+#include <shim_vm_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Returns the irqfd of the VM that uses the provided eventfd,
+ *     or NULL if there is none. Like KVM, the eventfd itself is
+ *     compared and not the file descriptor, as userspace can dup an
+ *     eventfd, or close it and reuse its number for another one.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM to search
+ *   @param eventfd the eventfd (from platform_eventfd_get) to look for
+ *   @return Returns the irqfd of the VM that uses the provided eventfd,
+ *     or NULL if there is none.
+ */
+NODISCARD static struct shim_irqfd_t *
+find_irqfd(struct shim_vm_t *const pmut_vm, void const *const eventfd) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    for (mut_i = ((uint64_t)0); mut_i < SHIM_MAX_IRQFDS; ++mut_i) {
+        if (NULL == pmut_vm->irqfds[mut_i].vm) {
+            mv_touch();
+        }
+        else if (eventfd != pmut_vm->irqfds[mut_i].eventfd) {
+            mv_touch();
+        }
+        else {
+            return &pmut_vm->irqfds[mut_i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Turns resampling of the provided GSI off in MicroV unless
+ *     another one of the VM's irqfds still resamples it.
+ *
+ * <!-- inputs/outputs -->
+ *   @param vm the VM whose GSI is no longer resampled by an irqfd
+ *   @param gsi the GSI that is no longer resampled by an irqfd
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+release_resample(struct shim_vm_t const *const vm, uint64_t const gsi) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    for (mut_i = ((uint64_t)0); mut_i < SHIM_MAX_IRQFDS; ++mut_i) {
+        if (NULL == vm->irqfds[mut_i].resample) {
+            mv_touch();
+        }
+        else if (gsi != vm->irqfds[mut_i].gsi) {
+            mv_touch();
+        }
+        else {
+            return SHIM_SUCCESS;
+        }
+    }
+
+    if (mv_vm_op_irq_resample(g_mut_hndl, vm->vmid, gsi, ((uint64_t)0))) {
+        bferror("mv_vm_op_irq_resample failed");
+        return SHIM_FAILURE;
+    }
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Removes an irqfd. Like KVM, removing an irqfd that does not
+ *     exist is not an error.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM to remove the irqfd from
+ *   @param args the arguments provided by userspace
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+deassign_irqfd(struct shim_vm_t *const pmut_vm, struct kvm_irqfd const *const args) NOEXCEPT
+{
+    uint64_t mut_resample;
+    struct shim_irqfd_t *pmut_mut_irqfd;
+    void *const pmut_eventfd = platform_eventfd_get((uint64_t)args->fd);
+
+    if (NULL == pmut_eventfd) {
+        return SHIM_SUCCESS;
+    }
+
+    pmut_mut_irqfd = find_irqfd(pmut_vm, pmut_eventfd);
+    platform_eventfd_put(pmut_eventfd);
+
+    if (NULL == pmut_mut_irqfd) {
+        return SHIM_SUCCESS;
+    }
+
+    if (((uint64_t)args->gsi) != pmut_mut_irqfd->gsi) {
+        return SHIM_SUCCESS;
+    }
+
+    mut_resample = (uint64_t)(NULL != pmut_mut_irqfd->resample);
+    shim_irqfd_free(pmut_mut_irqfd);
+
+    if (((uint64_t)0) != mut_resample) {
+        return release_resample(pmut_vm, (uint64_t)args->gsi);
+    }
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Adds an irqfd.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM to add the irqfd to
+ *   @param args the arguments provided by userspace
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD static int64_t
+assign_irqfd(struct shim_vm_t *const pmut_vm, struct kvm_irqfd const *const args) NOEXCEPT
+{
+    uint64_t mut_i;
+    struct shim_irqfd_t *pmut_mut_irqfd;
+    void *pmut_mut_watch;
+    void *pmut_mut_resample;
+
+    pmut_mut_irqfd = NULL;
+    for (mut_i = ((uint64_t)0); mut_i < SHIM_MAX_IRQFDS; ++mut_i) {
+        if (NULL == pmut_vm->irqfds[mut_i].vm) {
+            pmut_mut_irqfd = &pmut_vm->irqfds[mut_i];
+            break;
+        }
+
+        mv_touch();
+    }
+
+    if (NULL == pmut_mut_irqfd) {
+        bferror("the VM has too many irqfds");
+        return SHIM_FAILURE;
+    }
+
+    /// NOTE:
+    /// - Like KVM, fd is resolved once. The watch holds the eventfd
+    ///   that is compared against the other irqfds, and it is only
+    ///   started (see below) once the irqfd is filled in.
+    ///
+
+    pmut_mut_watch = platform_eventfd_watch((uint64_t)args->fd, &shim_irqfd_signal, pmut_mut_irqfd);
+    if (NULL == pmut_mut_watch) {
+        bferror("platform_eventfd_watch failed");
+        return SHIM_FAILURE;
+    }
+
+    if (NULL != find_irqfd(pmut_vm, platform_eventfd_watch_eventfd(pmut_mut_watch))) {
+        bferror("the eventfd is already used by an irqfd");
+        platform_eventfd_unwatch(pmut_mut_watch);
+        return SHIM_FAILURE;
+    }
+
+    pmut_mut_resample = NULL;
+    if (((uint32_t)0) != (args->flags & KVM_IRQFD_FLAG_RESAMPLE)) {
+        pmut_mut_resample = platform_eventfd_get((uint64_t)args->resamplefd);
+        if (NULL == pmut_mut_resample) {
+            bferror("platform_eventfd_get failed");
+            platform_eventfd_unwatch(pmut_mut_watch);
+            return SHIM_FAILURE;
+        }
+
+        if (mv_vm_op_irq_resample(g_mut_hndl, pmut_vm->vmid, (uint64_t)args->gsi, ((uint64_t)1))) {
+            bferror("mv_vm_op_irq_resample failed");
+            platform_eventfd_put(pmut_mut_resample);
+            platform_eventfd_unwatch(pmut_mut_watch);
+            return SHIM_FAILURE;
+        }
+    }
+    else {
+        mv_touch();
+    }
+
+    /// NOTE:
+    /// - The irqfd must be filled in before the watch is started, as
+    ///   the callback runs right away if the eventfd is already signaled.
+    ///   From here on, the irqfd owns the watch and the resamplefd, and
+    ///   shim_irqfd_free releases them.
+    ///
+
+    pmut_mut_irqfd->vm = pmut_vm;
+    pmut_mut_irqfd->eventfd = platform_eventfd_watch_eventfd(pmut_mut_watch);
+    pmut_mut_irqfd->gsi = (uint64_t)args->gsi;
+    pmut_mut_irqfd->flags = (uint64_t)args->flags;
+    pmut_mut_irqfd->watch = pmut_mut_watch;
+    pmut_mut_irqfd->resample = pmut_mut_resample;
+
+    platform_eventfd_watch_start(pmut_mut_watch);
+    return SHIM_SUCCESS;
+}
 
 /**
  * <!-- description -->
  *   @brief Handles the execution of kvm_irqfd.
  *
  * <!-- inputs/outputs -->
- *   @param pmut_ioctl_args the arguments provided by userspace
+ *   @param pmut_vm the VM to add the irqfd to, or remove it from
+ *   @param args the arguments provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vm_kvm_irqfd(struct kvm_irqfd *const pmut_ioctl_args) NOEXCEPT
+handle_vm_kvm_irqfd(struct shim_vm_t *const pmut_vm, struct kvm_irqfd const *const args) NOEXCEPT
 {
-    (void)pmut_ioctl_args;
-    return SHIM_SUCCESS;
+    int64_t mut_ret;
+    uint32_t const valid_flags = (KVM_IRQFD_FLAG_DEASSIGN | KVM_IRQFD_FLAG_RESAMPLE);
+
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != pmut_vm);
+    platform_expects(NULL != args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (!pmut_vm->irqchip) {
+        bferror("KVM_IRQFD requires KVM_CREATE_IRQCHIP");
+        return SHIM_FAILURE;
+    }
+
+    if (((uint32_t)0) != (args->flags & ~valid_flags)) {
+        bferror_x64("kvm_irqfd.flags is invalid", (uint64_t)args->flags);
+        return SHIM_FAILURE;
+    }
+
+    if (((uint64_t)args->gsi) >= SHIM_IRQFD_NUM_GSIS) {
+        bferror_x64("kvm_irqfd.gsi is out of range", (uint64_t)args->gsi);
+        return SHIM_FAILURE;
+    }
+
+    platform_mutex_lock(&pmut_vm->mutex);
+
+    if (((uint32_t)0) != (args->flags & KVM_IRQFD_FLAG_DEASSIGN)) {
+        mut_ret = deassign_irqfd(pmut_vm, args);
+    }
+    else {
+        mut_ret = assign_irqfd(pmut_vm, args);
+    }
+
+    platform_mutex_unlock(&pmut_vm->mutex);
+    return mut_ret;
 }
@@ -22,22 +22,60 @@
  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
- */
 
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
 #include <kvm_clock_data.h>
+#include <kvm_constants.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
 #include <mv_types.h>
+#include <platform.h>
+#include <shim_vm_t.h>
 
 /**
  * <!-- description -->
- *   @brief Handles the execution of kvm_set_clock.
+ *   @brief Handles the execution of kvm_set_clock. If userspace provides
+ *     KVM_CLOCK_REALTIME, the wall clock time that has passed since
+ *     "realtime" is added to the clock, which is how a saved clock is
+ *     moved forward on restore. The VM's wall clock is always derived
+ *     from the current wall clock time, just like KVM does.
  *
  * <!-- inputs/outputs -->
- *   @param pmut_ioctl_args the arguments provided by userspace
+ *   @param vm the VM whose kvmclock is being set
+ *   @param args the arguments provided by userspace
  *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
  */
 NODISCARD int64_t
-handle_vm_kvm_set_clock(struct kvm_clock_data *const pmut_ioctl_args) NOEXCEPT
+handle_vm_kvm_set_clock(
+    struct shim_vm_t const *const vm, struct kvm_clock_data const *const args) NOEXCEPT
 {
-    (void)pmut_ioctl_args;
+    uint64_t mut_ns;
+    uint64_t const realtime = platform_realtime_ns();
+
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vm);
+    platform_expects(NULL != args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    mut_ns = args->clock;
+    if ((((uint32_t)0) != (args->flags & ((uint32_t)KVM_CLOCK_REALTIME))) &&
+        (realtime > args->realtime)) {
+        mut_ns += (realtime - args->realtime);
+    }
+    else {
+        mv_touch();
+    }
+
+    if (mv_vm_op_clock_set(g_mut_hndl, vm->vmid, mut_ns, realtime)) {
+        bferror("mv_vm_op_clock_set failed");
+        return SHIM_FAILURE;
+    }
+
     return SHIM_SUCCESS;
 }
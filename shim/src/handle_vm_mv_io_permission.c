@@ -0,0 +1,88 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_io_permission.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_vm_t.h>
+
+/** @brief defines the total number of IO ports */
+#define MV_IO_NUM_PORTS ((uint64_t)0x10000)
+
+/**
+ * <!-- description -->
+ *   @brief Handles the execution of mv_io_permission.
+ *
+ * <!-- inputs/outputs -->
+ *   @param vm the VM whose IO permissions are being set
+ *   @param args the arguments provided by userspace
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+handle_vm_mv_io_permission(
+    struct shim_vm_t const *const vm, struct mv_io_permission const *const args) NOEXCEPT
+{
+    platform_expects(MV_INVALID_HANDLE != g_mut_hndl);
+    platform_expects(NULL != vm);
+    platform_expects(NULL != args);
+
+    if (detect_hypervisor()) {
+        bferror("The shim is not running in a VM. Did you forget to start MicroV?");
+        return SHIM_FAILURE;
+    }
+
+    if (((uint16_t)0) != args->pad) {
+        bferror("mv_io_permission pad must be 0");
+        return SHIM_FAILURE;
+    }
+
+    if (((uint32_t)0) == args->num) {
+        bferror("mv_io_permission requires at least one port");
+        return SHIM_FAILURE;
+    }
+
+    if (((uint64_t)args->port) + ((uint64_t)args->num) > MV_IO_NUM_PORTS) {
+        bferror("mv_io_permission port range is out of bounds");
+        return SHIM_FAILURE;
+    }
+
+    if (args->type > MV_IO_PERM_EMULATE) {
+        bferror("mv_io_permission type is not supported");
+        return SHIM_FAILURE;
+    }
+
+    if (mv_vm_op_io_permission(g_mut_hndl, vm->vmid, args->port, args->num, args->type)) {
+        bferror("mv_vm_op_io_permission failed");
+        return SHIM_FAILURE;
+    }
+
+    return SHIM_SUCCESS;
+}
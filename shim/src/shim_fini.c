@@ -31,6 +31,7 @@
 #include <mv_hypercall.h>
 #include <mv_types.h>
 #include <platform.h>
+#include <shim_trace_disable.h>
 
 /**
  * <!-- description -->
@@ -73,6 +74,7 @@ shim_fini(void) NOEXCEPT
         return;
     }
 
+    shim_trace_disable();
     (void)platform_on_each_cpu(shim_fini_on_cpu, PLATFORM_REVERSE);
     (void)mv_handle_op_close_handle(g_mut_hndl);
 
@@ -0,0 +1,183 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <g_mut_hndl.h>
+#include <kvm_irqfd.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_irqfd_t.h>
+#include <shim_vm_kick.h>
+#include <shim_vm_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Called by the platform each time the eventfd of an irqfd is
+ *     signaled. Raises the irqfd's GSI (and lowers it again unless it
+ *     is resampled), and then kicks the VM's VCPUs so that they pick
+ *     up the interrupt. This can be called from any context,
+ *     including atomic ones, so it must not sleep.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_irqfd the shim_irqfd_t whose eventfd was signaled
+ */
+void
+shim_irqfd_signal(void *const pmut_irqfd) NOEXCEPT
+{
+    struct shim_irqfd_t const *const irqfd = (struct shim_irqfd_t const *)pmut_irqfd;
+    struct shim_vm_t const *vm;
+
+    platform_expects(NULL != irqfd);
+    platform_expects(NULL != irqfd->vm);
+
+    vm = irqfd->vm;
+
+    /// NOTE:
+    /// - An edge triggered irqfd pulses the GSI, the same way KVM does.
+    ///   A resampled one leaves it raised. MicroV lowers it when the
+    ///   guest EOIs it, and the resamplefd tells userspace to raise it
+    ///   again if the device still needs service.
+    ///
+
+    if (mv_vm_op_irq_line(g_mut_hndl, vm->vmid, irqfd->gsi, ((uint64_t)1))) {
+        bferror("mv_vm_op_irq_line failed");
+        return;
+    }
+
+    if (((uint64_t)0) == (irqfd->flags & (uint64_t)KVM_IRQFD_FLAG_RESAMPLE)) {
+        if (mv_vm_op_irq_line(g_mut_hndl, vm->vmid, irqfd->gsi, ((uint64_t)0))) {
+            bferror("mv_vm_op_irq_line failed");
+            return;
+        }
+    }
+    else {
+        mv_touch();
+    }
+
+    shim_vm_kick(irqfd->vm);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Stops watching the eventfds of the provided irqfd, releases
+ *     them, and marks it as unused. This works on a partially filled
+ *     in irqfd as well. The VM's mutex must be held.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_irqfd the shim_irqfd_t to free
+ */
+void
+shim_irqfd_free(struct shim_irqfd_t *const pmut_irqfd) NOEXCEPT
+{
+    platform_expects(NULL != pmut_irqfd);
+
+    if (NULL != pmut_irqfd->watch) {
+        platform_eventfd_unwatch(pmut_irqfd->watch);
+    }
+    else {
+        mv_touch();
+    }
+
+    if (NULL != pmut_irqfd->resample) {
+        platform_eventfd_put(pmut_irqfd->resample);
+    }
+    else {
+        mv_touch();
+    }
+
+    platform_memset(pmut_irqfd, ((uint8_t)0), sizeof(struct shim_irqfd_t));
+}
+
+/**
+ * <!-- description -->
+ *   @brief Signals the resamplefd of each of the VM's irqfds whose
+ *     GSI was resampled (see mv_vm_op_irq_resample).
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM whose GSIs were resampled
+ *   @param resampled the resampled GSIs (bit n is GSI n) returned by
+ *     mv_vs_op_run in mv_run_t
+ */
+void
+shim_irqfd_resample(struct shim_vm_t *const pmut_vm, uint64_t const resampled) NOEXCEPT
+{
+    uint64_t mut_i;
+    struct shim_irqfd_t const *irqfd;
+
+    if (((uint64_t)0) == resampled) {
+        return;
+    }
+
+    platform_expects(NULL != pmut_vm);
+
+    platform_mutex_lock(&pmut_vm->mutex);
+
+    for (mut_i = ((uint64_t)0); mut_i < SHIM_MAX_IRQFDS; ++mut_i) {
+        irqfd = &pmut_vm->irqfds[mut_i];
+
+        if (NULL == irqfd->resample) {
+            mv_touch();
+        }
+        else if (((uint64_t)0) == (resampled & (((uint64_t)1) << irqfd->gsi))) {
+            mv_touch();
+        }
+        else {
+            platform_eventfd_signal(irqfd->resample);
+        }
+    }
+
+    platform_mutex_unlock(&pmut_vm->mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Frees all of the VM's irqfds. This must be done before the
+ *     VM is destroyed.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM whose irqfds are freed
+ */
+void
+shim_irqfd_release(struct shim_vm_t *const pmut_vm) NOEXCEPT
+{
+    uint64_t mut_i;
+    platform_expects(NULL != pmut_vm);
+
+    platform_mutex_lock(&pmut_vm->mutex);
+
+    for (mut_i = ((uint64_t)0); mut_i < SHIM_MAX_IRQFDS; ++mut_i) {
+        if (NULL != pmut_vm->irqfds[mut_i].vm) {
+            shim_irqfd_free(&pmut_vm->irqfds[mut_i]);
+        }
+        else {
+            mv_touch();
+        }
+    }
+
+    platform_mutex_unlock(&pmut_vm->mutex);
+}
@@ -0,0 +1,214 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <itoa.h>
+#include <kvm_constants.h>
+#include <kvm_stats_desc.h>
+#include <mv_stats_t.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_stats_t.h>
+
+/** @brief defines the offset of mv_stats_t.count */
+#define SHIM_STATS_COUNT_OFFSET ((uint32_t)0)
+/** @brief defines the offset of mv_stats_t.cycles */
+#define SHIM_STATS_CYCLES_OFFSET ((uint32_t)sizeof(uint64_t))
+/** @brief defines the offset of mv_stats_t.hist */
+#define SHIM_STATS_HIST_OFFSET ((uint32_t)(sizeof(uint64_t) * (uint64_t)2))
+/** @brief defines the offset of mv_stats_t.slots */
+#define SHIM_STATS_SLOTS_OFFSET                                                                    \
+    ((uint32_t)(SHIM_STATS_HIST_OFFSET + (sizeof(uint64_t) * MV_STATS_NUM_BUCKETS)))
+/** @brief defines the size of an itoa'd uint64_t, including the '\0' */
+#define SHIM_STATS_ID_DIGITS ((uint64_t)21)
+
+/**
+ * <!-- description -->
+ *   @brief Fills in a kvm_stats_desc.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_desc the kvm_stats_desc to fill in
+ *   @param flags the KVM_STATS_TYPE/UNIT/BASE_ flags of the stat
+ *   @param size the number of uint64_t values in the stat
+ *   @param offset the offset of the stat from the start of the data
+ *   @param name the name of the stat, which must be '\0' terminated and
+ *     shorter than KVM_STATS_NAME_SIZE
+ */
+static void
+set_desc(
+    struct kvm_stats_desc *const pmut_desc,
+    uint32_t const flags,
+    uint64_t const size,
+    uint32_t const offset,
+    char const *const name) NOEXCEPT
+{
+    uint64_t mut_i;
+
+    pmut_desc->flags = flags;
+    pmut_desc->size = (uint16_t)size;
+    pmut_desc->offset = offset;
+
+    /**
+     * NOTE:
+     * - Log histograms have no bucket size, and the linear histograms
+     *   here have one bucket per slot.
+     */
+
+    if (KVM_STATS_TYPE_LINEAR_HIST == (flags & (uint32_t)0xF)) {
+        pmut_desc->bucket_size = (uint32_t)1;
+    }
+    else {
+        pmut_desc->bucket_size = (uint32_t)0;
+    }
+
+    for (mut_i = ((uint64_t)0); mut_i < (uint64_t)(KVM_STATS_NAME_SIZE - 1); ++mut_i) {
+        if ('\0' == name[mut_i]) {
+            break;
+        }
+
+        pmut_desc->name[mut_i] = name[mut_i];
+    }
+}
+
+/**
+ * <!-- description -->
+ *   @brief Fills in the descriptors of one mv_stats_t.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_descs the 4 descriptors to fill in
+ *   @param base the offset of the mv_stats_t from the start of the data
+ *   @param count the name of mv_stats_t.count
+ *   @param cycles the name of mv_stats_t.cycles
+ *   @param hist the name of mv_stats_t.hist
+ *   @param slots the name of mv_stats_t.slots
+ */
+static void
+set_descs(
+    struct kvm_stats_desc *const pmut_descs,
+    uint32_t const base,
+    char const *const count,
+    char const *const cycles,
+    char const *const hist,
+    char const *const slots) NOEXCEPT
+{
+    uint32_t const cumulative = KVM_STATS_TYPE_CUMULATIVE | KVM_STATS_BASE_POW10;
+    uint32_t const log_hist = KVM_STATS_TYPE_LOG_HIST | KVM_STATS_BASE_POW2;
+    uint32_t const lin_hist = KVM_STATS_TYPE_LINEAR_HIST | KVM_STATS_BASE_POW10;
+
+    set_desc(
+        &pmut_descs[0],
+        cumulative | KVM_STATS_UNIT_NONE,
+        (uint64_t)1,
+        base + SHIM_STATS_COUNT_OFFSET,
+        count);
+    set_desc(
+        &pmut_descs[1],
+        cumulative | KVM_STATS_UNIT_CYCLES,
+        (uint64_t)1,
+        base + SHIM_STATS_CYCLES_OFFSET,
+        cycles);
+    set_desc(
+        &pmut_descs[2],
+        log_hist | KVM_STATS_UNIT_CYCLES,
+        MV_STATS_NUM_BUCKETS,
+        base + SHIM_STATS_HIST_OFFSET,
+        hist);
+    set_desc(
+        &pmut_descs[3],
+        lin_hist | KVM_STATS_UNIT_NONE,
+        MV_STATS_NUM_SLOTS,
+        base + SHIM_STATS_SLOTS_OFFSET,
+        slots);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Clears a shim_stats_t and fills in its header, its id
+ *     (i.e., prefix followed by the decimal id) and its descriptors.
+ *     The data is left at 0 for the caller to fill in.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_stats the shim_stats_t to initialize
+ *   @param prefix the prefix of the id string
+ *   @param prefix_size the number of characters in prefix
+ *   @param id the ID of the VM or VCPU the stats are for
+ */
+void
+shim_stats_init(
+    struct shim_stats_t *const pmut_stats,
+    char const *const prefix,
+    uint64_t const prefix_size,
+    uint64_t const id) NOEXCEPT
+{
+    uint32_t const hypercalls = (uint32_t)sizeof(struct mv_stats_t);
+    uint32_t const halt_polls = hypercalls + (uint32_t)sizeof(struct mv_stats_t);
+    uint32_t const fpu = halt_polls + (uint32_t)sizeof(struct mv_stats_t);
+
+    platform_expects(NULL != pmut_stats);
+    platform_expects(NULL != prefix);
+    platform_expects(prefix_size + SHIM_STATS_ID_DIGITS <= (uint64_t)KVM_STATS_NAME_SIZE);
+
+    platform_memset(pmut_stats, ((uint8_t)0), sizeof(struct shim_stats_t));
+
+    pmut_stats->header.name_size = (uint32_t)KVM_STATS_NAME_SIZE;
+    pmut_stats->header.num_desc = (uint32_t)SHIM_STATS_NUM_DESC;
+    pmut_stats->header.id_offset = (uint32_t)sizeof(struct kvm_stats_header);
+    pmut_stats->header.desc_offset =
+        pmut_stats->header.id_offset + (uint32_t)KVM_STATS_NAME_SIZE;
+    pmut_stats->header.data_offset =
+        pmut_stats->header.desc_offset + (uint32_t)sizeof(pmut_stats->descs);
+
+    platform_memcpy(pmut_stats->id, prefix, prefix_size);
+    (void)bfitoa(id, &pmut_stats->id[prefix_size], (uint64_t)10);
+
+    set_descs(
+        &pmut_stats->descs[0],
+        (uint32_t)0,
+        "exits",
+        "exit_cycles",
+        "exit_cycles_hist",
+        "exit_reason_hist");
+    set_descs(
+        &pmut_stats->descs[4],
+        hypercalls,
+        "hypercalls",
+        "hypercall_cycles",
+        "hypercall_cycles_hist",
+        "hypercall_nr_hist");
+    set_descs(
+        &pmut_stats->descs[8],
+        halt_polls,
+        "halt_polls",
+        "halt_poll_cycles",
+        "halt_poll_cycles_hist",
+        "halt_poll_hist");
+    set_descs(
+        &pmut_stats->descs[12],
+        fpu,
+        "fpu_saves_restores",
+        "fpu_cycles",
+        "fpu_cycles_hist",
+        "fpu_hist");
+}
@@ -0,0 +1,74 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <detect_hypervisor.h>
+#include <g_mut_hndl.h>
+#include <g_mut_trace_rings.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_types.h>
+#include <platform.h>
+
+/**
+ * <!-- description -->
+ *   @brief Disables tracing on the requested cpu (i.e. PP). The trace
+ *     ring is only freed once MicroV no longer has it mapped.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the cpu (i.e. PP) we are executing on
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+shim_trace_disable_on_cpu(uint32_t const cpu) NOEXCEPT
+{
+    if (((void *)0) == g_mut_trace_rings[cpu]) {
+        return SHIM_SUCCESS;
+    }
+
+    if (!detect_hypervisor()) {
+        (void)mv_pp_op_clr_trace_gpa(g_mut_hndl);
+    }
+
+    (void)platform_free(g_mut_trace_rings[cpu], HYPERVISOR_PAGE_SIZE);
+    g_mut_trace_rings[cpu] = ((void *)0);
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Disables tracing by taking the trace ring of each cpu
+ *     (i.e. PP) back from MicroV and freeing it. Calling this when
+ *     tracing is disabled is fine.
+ */
+void
+shim_trace_disable(void) NOEXCEPT
+{
+    if (MV_INVALID_HANDLE == g_mut_hndl) {
+        return;
+    }
+
+    (void)platform_on_each_cpu(shim_trace_disable_on_cpu, PLATFORM_REVERSE);
+}
@@ -0,0 +1,131 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <g_mut_trace_rings.h>
+#include <mv_constants.h>
+#include <mv_trace_t.h>
+#include <mv_types.h>
+#include <platform.h>
+
+/**
+ * <!-- description -->
+ *   @brief Moves up to "max" entries out of a single trace ring.
+ *
+ * <!-- notes -->
+ *   @note MicroV writes an entry before it publishes the new head, so
+ *     every entry before the head we read is complete. The entries are
+ *     copied with platform_memcpy before the new tail is written, which
+ *     is what keeps the compiler from writing the tail early, and x86
+ *     does not reorder stores with older loads, so MicroV cannot reuse
+ *     a slot before we are done copying it.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_ring the trace ring to drain
+ *   @param pmut_entries where to copy the entries to
+ *   @param max the number of entries pmut_entries can hold
+ *   @param pmut_lost the number of dropped entries is added to this
+ *   @return Returns the number of entries copied to pmut_entries
+ */
+NODISCARD static uint64_t
+drain_ring(
+    struct mv_trace_t *const pmut_ring,
+    struct mv_trace_entry_t *const pmut_entries,
+    uint64_t const max,
+    uint64_t *const pmut_lost) NOEXCEPT
+{
+    uint64_t mut_i;
+    uint64_t mut_tail;
+    uint64_t const head = *(uint64_t const volatile *)&pmut_ring->head;
+    uint64_t const lost = *(uint64_t const volatile *)&pmut_ring->lost;
+
+    mut_tail = pmut_ring->tail;
+    if (head < mut_tail) {
+        mut_tail = head;
+    }
+
+    if ((head - mut_tail) > MV_TRACE_NUM_ENTRIES) {
+        mut_tail = head - MV_TRACE_NUM_ENTRIES;
+    }
+
+    for (mut_i = ((uint64_t)0); mut_i < max; ++mut_i) {
+        if (head == mut_tail) {
+            break;
+        }
+
+        platform_memcpy(
+            &pmut_entries[mut_i],
+            &pmut_ring->entries[mut_tail % MV_TRACE_NUM_ENTRIES],
+            sizeof(struct mv_trace_entry_t));
+
+        ++mut_tail;
+    }
+
+    *(uint64_t volatile *)&pmut_ring->tail = mut_tail;
+
+    *pmut_lost += lost - pmut_ring->lost_seen;
+    pmut_ring->lost_seen = lost;
+
+    return mut_i;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Moves up to "max" entries out of the trace rings of all
+ *     cpus (i.e. PPs), one cpu after the other, and adds the number of
+ *     entries MicroV dropped since the last drain to "pmut_lost".
+ *     Entries are in order for each cpu, but not between cpus (use
+ *     the tsc of each entry for that). This must not be called from
+ *     more than one thread at a time.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_entries where to copy the entries to
+ *   @param max the total number of entries pmut_entries can hold
+ *   @param pmut_lost the number of dropped entries is added to this
+ *   @return Returns the number of entries copied to pmut_entries
+ */
+NODISCARD uint64_t
+shim_trace_drain(
+    struct mv_trace_entry_t *const pmut_entries,
+    uint64_t const max,
+    uint64_t *const pmut_lost) NOEXCEPT
+{
+    uint32_t mut_cpu;
+    uint64_t mut_num = ((uint64_t)0);
+    uint32_t const num_cpus = platform_num_online_cpus();
+
+    platform_expects(NULL != pmut_entries);
+    platform_expects(NULL != pmut_lost);
+
+    for (mut_cpu = ((uint32_t)0); mut_cpu < num_cpus; ++mut_cpu) {
+        if (((void *)0) == g_mut_trace_rings[mut_cpu]) {
+            continue;
+        }
+
+        mut_num += drain_ring(
+            g_mut_trace_rings[mut_cpu], &pmut_entries[mut_num], max - mut_num, pmut_lost);
+    }
+
+    return mut_num;
+}
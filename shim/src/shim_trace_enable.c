@@ -0,0 +1,94 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <debug.h>
+#include <g_mut_hndl.h>
+#include <g_mut_trace_rings.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_trace_t.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_trace_disable.h>
+
+/**
+ * <!-- description -->
+ *   @brief Enables tracing on the requested cpu (i.e. PP). Like the
+ *     shared page, mv_pp_op_set_trace_gpa has to be executed on the PP
+ *     the trace ring will be used on.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the cpu (i.e. PP) we are executing on
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+shim_trace_enable_on_cpu(uint32_t const cpu) NOEXCEPT
+{
+    uint64_t mut_gpa;
+
+    if (((void *)0) == g_mut_trace_rings[cpu]) {
+        g_mut_trace_rings[cpu] = (struct mv_trace_t *)platform_alloc(HYPERVISOR_PAGE_SIZE);
+        if (((void *)0) == g_mut_trace_rings[cpu]) {
+            bferror("platform_alloc failed");
+            return SHIM_FAILURE;
+        }
+    }
+
+    mut_gpa = platform_virt_to_phys(g_mut_trace_rings[cpu]);
+
+    (void)mv_pp_op_clr_trace_gpa(g_mut_hndl);
+    if (mv_pp_op_set_trace_gpa(g_mut_hndl, mut_gpa)) {
+        bferror("mv_pp_op_set_trace_gpa failed");
+        return SHIM_FAILURE;
+    }
+
+    return SHIM_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Enables tracing by giving MicroV a trace ring on each
+ *     cpu (i.e. PP). If tracing is already enabled, the rings are
+ *     reset. On failure, tracing is left disabled.
+ *
+ * <!-- inputs/outputs -->
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+shim_trace_enable(void) NOEXCEPT
+{
+    if (MV_INVALID_HANDLE == g_mut_hndl) {
+        bferror("the shim is not initialized");
+        return SHIM_FAILURE;
+    }
+
+    if (platform_on_each_cpu(shim_trace_enable_on_cpu, PLATFORM_FORWARD)) {
+        bferror("shim_trace_enable_on_cpu failed");
+        shim_trace_disable();
+        return SHIM_FAILURE;
+    }
+
+    return SHIM_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <handle_vcpu_kvm_set_regs.h>
+#include <handle_vcpu_kvm_set_sregs.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_vcpu_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Writes each dirty group in the VCPU's register cache back
+ *     to MicroV. The groups stay cached, so this must be done before
+ *     anything else reads or writes the VS's state, and the cache must
+ *     be invalidated afterwards if that changes the VS's state.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU to flush the register cache of
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+shim_vcpu_cache_flush(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    platform_expects(NULL != pmut_vcpu);
+
+    /// NOTE:
+    /// - A dirty bit is only cleared once MicroV has the group, so if a
+    ///   flush fails, the next one tries again.
+    ///
+
+    if (((uint64_t)0) != (pmut_vcpu->cache_dirty & SHIM_VCPU_CACHE_REGS)) {
+        if (handle_vcpu_kvm_set_regs(pmut_vcpu, &pmut_vcpu->regs)) {
+            bferror("handle_vcpu_kvm_set_regs failed");
+            return SHIM_FAILURE;
+        }
+
+        pmut_vcpu->cache_dirty &= ~SHIM_VCPU_CACHE_REGS;
+    }
+    else {
+        mv_touch();
+    }
+
+    if (((uint64_t)0) != (pmut_vcpu->cache_dirty & SHIM_VCPU_CACHE_SREGS)) {
+        if (handle_vcpu_kvm_set_sregs(pmut_vcpu, &pmut_vcpu->sregs)) {
+            bferror("handle_vcpu_kvm_set_sregs failed");
+            return SHIM_FAILURE;
+        }
+
+        pmut_vcpu->cache_dirty &= ~SHIM_VCPU_CACHE_SREGS;
+    }
+    else {
+        mv_touch();
+    }
+
+    return SHIM_SUCCESS;
+}
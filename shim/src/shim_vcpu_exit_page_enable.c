@@ -0,0 +1,73 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <debug.h>
+#include <g_mut_hndl.h>
+#include <mv_constants.h>
+#include <mv_hypercall.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_vcpu_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Registers the first page of the VCPU's kvm_run as its MicroV
+ *     exit page (see mv_vs_op_set_exit_page_gpa). From then on, MicroV
+ *     writes non-string IO and MMIO exits directly into kvm_run and
+ *     reads the result of an IN or MMIO read from there, so
+ *     handle_vcpu_kvm_run no longer has to translate them. Only the
+ *     first page is registered as the pages of kvm_run are not
+ *     physically contiguous.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vcpu the VCPU to enable the exit page of
+ *   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+ */
+NODISCARD int64_t
+shim_vcpu_exit_page_enable(struct shim_vcpu_t *const pmut_vcpu) NOEXCEPT
+{
+    uint64_t mut_gpa;
+
+    platform_expects(NULL != pmut_vcpu);
+    platform_expects(NULL != pmut_vcpu->run);
+
+    if (MV_INVALID_HANDLE == g_mut_hndl) {
+        bferror("the shim is not initialized");
+        return SHIM_FAILURE;
+    }
+
+    if (((uint8_t)0) != pmut_vcpu->exit_page) {
+        return SHIM_SUCCESS;
+    }
+
+    mut_gpa = platform_virt_to_phys(pmut_vcpu->run);
+    if (mv_vs_op_set_exit_page_gpa(g_mut_hndl, pmut_vcpu->vsid, mut_gpa)) {
+        bferror("mv_vs_op_set_exit_page_gpa failed");
+        return SHIM_FAILURE;
+    }
+
+    pmut_vcpu->exit_page = ((uint8_t)1);
+    return SHIM_SUCCESS;
+}
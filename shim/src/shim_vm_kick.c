@@ -0,0 +1,72 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <mv_constants.h>
+#include <mv_types.h>
+#include <platform.h>
+#include <shim_vcpu_t.h>
+#include <shim_vm_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Makes each of the VM's VCPUs pick up the interrupts that
+ *     were raised for the VM. A VCPU that is running is kicked out of
+ *     its guest, and a VCPU that is sleeping on a HLT (see
+ *     handle_vcpu_kvm_run) is woken up. This can be called from any
+ *     context, including atomic ones, so it must not sleep.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_vm the VM whose VCPUs are kicked
+ */
+void
+shim_vm_kick(struct shim_vm_t *const pmut_vm) NOEXCEPT
+{
+    uint64_t mut_i;
+    struct shim_vcpu_t *pmut_mut_vcpu;
+
+    platform_expects(NULL != pmut_vm);
+
+    /// NOTE:
+    /// - MicroV only hands a VS the interrupts that are pending for it on
+    ///   the way into the guest. A VCPU that has never been run has no
+    ///   thread, and picks them up the first time it is run.
+    /// - A VCPU that is between a HLT exit and going to sleep is not
+    ///   missed, as the wakeup is recorded and its next sleep returns
+    ///   right away. A VCPU that is running just sees a spurious wakeup
+    ///   the next time it halts.
+    ///
+
+    for (mut_i = ((uint64_t)0); mut_i < MICROV_MAX_VCPUS; ++mut_i) {
+        pmut_mut_vcpu = &pmut_vm->vcpus[mut_i];
+        if (((uint64_t)0) != pmut_mut_vcpu->thread) {
+            platform_kick_thread(pmut_mut_vcpu->thread);
+            platform_waitq_wake(&pmut_mut_vcpu->halt_waitq, &pmut_mut_vcpu->halt_wakeup);
+        }
+        else {
+            mv_touch();
+        }
+    }
+}
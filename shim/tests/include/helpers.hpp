@@ -25,6 +25,7 @@
 #include "g_mut_hndl.h"      // IWYU pragma: export
 #include "mv_constants.h"    // IWYU pragma: export
 #include "mv_exit_io_t.h"    // IWYU pragma: export
+#include "mv_exit_mmio_t.h"    // IWYU pragma: export
 #include "mv_exit_reason_t.h"
 #include "mv_hypercall.h"    // IWYU pragma: export
 #include "mv_translation_t.h"
@@ -60,46 +61,68 @@ namespace shim
         constinit bsl::uint64 g_mut_mv_handle_op_open_handle{};     // NOLINT
         constinit mv_status_t g_mut_mv_handle_op_close_handle{};    // NOLINT
 
+        constinit mv_status_t g_mut_mv_debug_op_stats_get{};    // NOLINT
+
         constinit bsl::uint16 g_mut_mv_pp_op_ppid{};                        // NOLINT
         constinit mv_status_t g_mut_mv_pp_op_clr_shared_page_gpa{};         // NOLINT
+        constinit mv_status_t g_mut_mv_pp_op_clr_trace_gpa{};               // NOLINT
         constinit mv_status_t g_mut_mv_pp_op_cpuid_get_supported_list{};    // NOLINT
         constinit mv_status_t g_mut_mv_pp_op_msr_get_supported_list{};      // NOLINT
         constinit mv_status_t g_mut_mv_pp_op_set_shared_page_gpa{};         // NOLINT
+        constinit mv_status_t g_mut_mv_pp_op_set_trace_gpa{};               // NOLINT
         constinit mv_status_t g_mut_mv_pp_op_tsc_get_khz{};                 // NOLINT
         constinit mv_status_t g_mut_mv_pp_op_tsc_set_khz{};                 // NOLINT
 
-        constinit bsl::uint16 g_mut_mv_vm_op_create_vm{};     // NOLINT
-        constinit mv_status_t g_mut_mv_vm_op_destroy_vm{};    // NOLINT
-        constinit bsl::uint16 g_mut_mv_vm_op_vmid{};          // NOLINT
-        constinit mv_status_t g_mut_mv_vm_op_mmio_map{};      // NOLINT
-        constinit mv_status_t g_mut_mv_vm_op_mmio_unmap{};    // NOLINT
+        constinit bsl::uint16 g_mut_mv_vm_op_create_vm{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_destroy_vm{};        // NOLINT
+        constinit bsl::uint16 g_mut_mv_vm_op_vmid{};              // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_mmio_map{};          // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_mmio_unmap{};        // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_irqchip_create{};    // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_irq_line{};          // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_io_permission{};     // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_clock_get{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_clock_set{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vm_op_irq_resample{};      // NOLINT
 
         constinit bsl::uint16 g_mut_mv_vp_op_create_vp{};     // NOLINT
         constinit mv_status_t g_mut_mv_vp_op_destroy_vp{};    // NOLINT
         constinit bsl::uint16 g_mut_mv_vp_op_vmid{};          // NOLINT
         constinit bsl::uint16 g_mut_mv_vp_op_vpid{};          // NOLINT
 
-        constinit bsl::uint16 g_mut_mv_vs_op_create_vs{};          // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_destroy_vs{};         // NOLINT
-        constinit bsl::uint16 g_mut_mv_vs_op_vmid{};               // NOLINT
-        constinit bsl::uint16 g_mut_mv_vs_op_vpid{};               // NOLINT
-        constinit bsl::uint16 g_mut_mv_vs_op_vsid{};               // NOLINT
-        constinit mv_translation_t g_mut_mv_vs_op_gla_to_gpa{};    // NOLINT
-        constinit mv_exit_reason_t g_mut_mv_vs_op_run{};           // NOLINT
-        constinit mv_exit_io_t g_mut_mv_vs_op_run_io{};            // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_reg_get{};            // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_reg_set{};            // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_reg_get_list{};       // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_reg_set_list{};       // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_msr_get{};            // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_msr_set{};            // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_msr_get_list{};       // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_msr_set_list{};       // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_fpu_get_all{};        // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_fpu_set_all{};        // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_mp_state_get{};       // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_mp_state_set{};       // NOLINT
-        constinit mv_status_t g_mut_mv_vs_op_tsc_get_khz{};        // NOLINT
+        constinit bsl::uint16 g_mut_mv_vs_op_create_vs{};            // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_destroy_vs{};           // NOLINT
+        constinit bsl::uint16 g_mut_mv_vs_op_vmid{};                 // NOLINT
+        constinit bsl::uint16 g_mut_mv_vs_op_vpid{};                 // NOLINT
+        constinit bsl::uint16 g_mut_mv_vs_op_vsid{};                 // NOLINT
+        constinit mv_translation_t g_mut_mv_vs_op_gla_to_gpa{};      // NOLINT
+        constinit mv_exit_reason_t g_mut_mv_vs_op_run{};             // NOLINT
+        constinit mv_exit_io_t g_mut_mv_vs_op_run_io{};              // NOLINT
+        constinit mv_exit_io_t g_mut_mv_vs_op_run_io_in{};           // NOLINT
+        constinit mv_exit_mmio_t g_mut_mv_vs_op_run_mmio{};          // NOLINT
+        constinit uint64_t g_mut_mv_vs_op_run_mmio_data{};           // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_reg_get{};              // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_reg_set{};              // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_reg_get_list{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_reg_set_list{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_msr_get{};              // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_msr_set{};              // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_msr_get_list{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_msr_set_list{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_fpu_get_all{};          // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_fpu_set_all{};          // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_mp_state_get{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_mp_state_set{};         // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_tsc_get_khz{};          // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_tsc_set_khz{};          // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_queue_interrupt{};      // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_lapic_get_all{};        // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_lapic_set_all{};        // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_kvmclock_ctrl{};        // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_clr_exit_page_gpa{};    // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_set_exit_page_gpa{};    // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_state_get_all{};        // NOLINT
+        constinit mv_status_t g_mut_mv_vs_op_state_set_all{};        // NOLINT
 
         extern bool g_mut_hypervisor_detected;
         extern bool g_mut_platform_alloc_fails;
@@ -108,6 +131,14 @@ namespace shim
         extern int64_t g_mut_platform_mlock;
         extern int64_t g_mut_platform_munlock;
         extern bool g_mut_platform_interrupted;
+        extern bool g_mut_platform_eventfd_watch_fails;
+        extern bool g_mut_platform_eventfd_get_fails;
+        extern bsl::safe_u64 g_mut_platform_eventfd_signaled;
+        extern bsl::safe_i64 g_mut_platform_eventfd_refs;
+        extern bsl::safe_u64 g_mut_platform_kicked;
+        extern bool g_mut_platform_waitq_interrupted;
+        extern bsl::safe_u64 g_mut_platform_waitq_timeout;
+        extern bsl::safe_u64 g_mut_platform_waitq_woken;
     }
 
     /// <!-- description -->
@@ -26,7 +26,9 @@
 #include <platform.h>
 #include <string.h>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
@@ -45,6 +47,27 @@ namespace shim
     extern "C" int64_t g_mut_platform_munlock{SHIM_SUCCESS};    // NOLINT
     /// @brief tells platform_interrupted to return interrupted
     extern "C" bool g_mut_platform_interrupted{};    // NOLINT
+    /// @brief tells platform_eventfd_watch to fail
+    extern "C" bool g_mut_platform_eventfd_watch_fails{};    // NOLINT
+    /// @brief tells platform_eventfd_get to fail
+    extern "C" bool g_mut_platform_eventfd_get_fails{};    // NOLINT
+    /// @brief stores the number of times platform_eventfd_signal was called
+    extern "C" bsl::safe_u64 g_mut_platform_eventfd_signaled{};    // NOLINT
+    /// @brief stores the number of eventfd handles that have not been put
+    extern "C" bsl::safe_i64 g_mut_platform_eventfd_refs{};    // NOLINT
+    /// @brief stores the number of times platform_kick_thread was called
+    extern "C" bsl::safe_u64 g_mut_platform_kicked{};    // NOLINT
+    /// @brief tells platform_waitq_wait to return interrupted
+    extern "C" bool g_mut_platform_waitq_interrupted{};    // NOLINT
+    /// @brief stores the timeout platform_waitq_wait was last called with
+    extern "C" bsl::safe_u64 g_mut_platform_waitq_timeout{};    // NOLINT
+    /// @brief stores the number of times platform_waitq_wake was called
+    extern "C" bsl::safe_u64 g_mut_platform_waitq_woken{};    // NOLINT
+    /// @brief defines the number of eventfds. fd and fd + this are the same eventfd
+    constexpr auto PLATFORM_NUM_EVENTFDS{64_u64};
+    /// @brief stands in for the eventfds and watches handed out
+    constinit bsl::array<bsl::uint8, PLATFORM_NUM_EVENTFDS.get()>
+        g_mut_platform_eventfds{};    // NOLINT
 
     /// <!-- description -->
     ///   @brief If test is false, a contract violation has occurred. This
@@ -394,4 +417,274 @@ namespace shim
         constexpr auto tsc_khz{42_u64};
         return tsc_khz.get();
     }
+
+    /// <!-- description -->
+    ///   @brief Returns the current wall clock time in nanoseconds
+    ///     since the epoch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current wall clock time in nanoseconds
+    ///     since the epoch.
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_realtime_ns() noexcept -> uint64_t
+    {
+        constexpr auto realtime_ns{42_u64};
+        return realtime_ns.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns an ID for the thread this is called from that
+    ///     can later be given to platform_yield_to. 0 is never a valid
+    ///     thread ID.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns an ID for the thread this is called from
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_current_thread() noexcept -> uint64_t
+    {
+        constexpr auto thread{42_u64};
+        return thread.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Gives the rest of the current thread's time slice to the
+    ///     provided thread. Returns SHIM_FAILURE if the thread does not
+    ///     exist or is not waiting to run, in which case nothing
+    ///     happens.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param thread the ID of the thread (from platform_current_thread)
+    ///     to yield to
+    ///   @return SHIM_SUCCESS on success, SHIM_FAILURE on failure.
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_yield_to(uint64_t const thread) noexcept -> int64_t
+    {
+        if (0U == thread) {
+            return SHIM_FAILURE;
+        }
+
+        return SHIM_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Interrupts the provided thread if it is running so that
+    ///     it goes back through the scheduler (e.g., so that a VCPU
+    ///     thread leaves its guest). Nothing happens if the thread does
+    ///     not exist or is not running. This can be called from any
+    ///     context, including atomic ones.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param thread the ID of the thread (from platform_current_thread)
+    ///     to kick
+    ///
+    extern "C" void
+    platform_kick_thread(uint64_t const thread) noexcept
+    {
+        bsl::expects(0U != thread);
+        ++g_mut_platform_kicked;
+    }
+
+    /// <!-- description -->
+    ///   @brief Initializes a wait queue. This must be called before a
+    ///     wait queue can be used.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_waitq the wait queue to initialize
+    ///
+    extern "C" void
+    platform_waitq_init(platform_waitq *const pmut_waitq) noexcept
+    {
+        bsl::expects(nullptr != pmut_waitq);
+        *pmut_waitq = {};
+    }
+
+    /// <!-- description -->
+    ///   @brief Puts the current thread to sleep on the provided wait
+    ///     queue until the provided flag is set (see platform_waitq_wake),
+    ///     the timeout expires, or the thread is interrupted. The flag is
+    ///     cleared before this returns. Returns SHIM_INTERRUPTED if the
+    ///     thread was interrupted, SHIM_SUCCESS otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_waitq the wait queue to sleep on
+    ///   @param pmut_flag the flag to wait for
+    ///   @param timeout_ns the maximum number of nanoseconds to sleep
+    ///     for, or PLATFORM_WAIT_FOREVER
+    ///   @return Returns SHIM_INTERRUPTED if the thread was interrupted,
+    ///     SHIM_SUCCESS otherwise.
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_waitq_wait(
+        platform_waitq *const pmut_waitq,
+        uint64_t *const pmut_flag,
+        uint64_t const timeout_ns) noexcept -> int64_t
+    {
+        bsl::expects(nullptr != pmut_waitq);
+        bsl::expects(nullptr != pmut_flag);
+
+        *pmut_flag = {};
+        g_mut_platform_waitq_timeout = timeout_ns;
+
+        if (g_mut_platform_waitq_interrupted) {
+            return SHIM_INTERRUPTED;
+        }
+
+        return SHIM_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets the provided flag and wakes up the thread sleeping
+    ///     on the provided wait queue, if there is one. If no thread is
+    ///     sleeping, the next platform_waitq_wait returns right away.
+    ///     This can be called from any context, including atomic ones.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_waitq the wait queue to wake up
+    ///   @param pmut_flag the flag to set
+    ///
+    extern "C" void
+    platform_waitq_wake(platform_waitq *const pmut_waitq, uint64_t *const pmut_flag) noexcept
+    {
+        bsl::expects(nullptr != pmut_waitq);
+        bsl::expects(nullptr != pmut_flag);
+
+        *pmut_flag = 1U;
+        ++g_mut_platform_waitq_woken;
+    }
+
+    /// <!-- description -->
+    ///   @brief Prepares a watch that calls pmut_func with pmut_arg each
+    ///     time the provided eventfd is signaled, once it is started using
+    ///     platform_eventfd_watch_start. fd is only resolved here, so the
+    ///     eventfd returned by platform_eventfd_watch_eventfd is always
+    ///     the one that is watched. Returns NULL if fd is not an eventfd.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param fd the file descriptor of the eventfd to watch
+    ///   @param pmut_func the function to call when the eventfd is
+    ///     signaled
+    ///   @param pmut_arg the argument to pass to pmut_func
+    ///   @return Returns a handle to the watch on success, NULL on
+    ///     failure.
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_eventfd_watch(
+        uint64_t const fd, platform_eventfd_func const pmut_func, void *const pmut_arg) noexcept
+        -> void *
+    {
+        bsl::discard(pmut_arg);
+        bsl::expects(nullptr != pmut_func);
+
+        if (g_mut_platform_eventfd_watch_fails) {
+            return nullptr;
+        }
+
+        /// NOTE:
+        /// - The watch stands in for the eventfd it watches, which is
+        ///   all that platform_eventfd_watch_eventfd needs.
+        ///
+
+        ++g_mut_platform_eventfd_refs;
+        return g_mut_platform_eventfds.at_if(bsl::to_idx(bsl::to_u64(fd) % PLATFORM_NUM_EVENTFDS));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the eventfd of the provided watch. The result can
+    ///     be compared with the handles returned by platform_eventfd_get,
+    ///     and is valid until the watch is stopped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param watch the watch (from platform_eventfd_watch)
+    ///   @return Returns the eventfd of the provided watch.
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_eventfd_watch_eventfd(void const *const watch) noexcept -> void *
+    {
+        bsl::expects(nullptr != watch);
+        return const_cast<void *>(watch);    // NOLINT
+    }
+
+    /// <!-- description -->
+    ///   @brief Starts a watch from platform_eventfd_watch. From here on,
+    ///     the watch's function is called each time the eventfd is
+    ///     signaled, as well as right away if it already is. It is called
+    ///     from the context of whoever signaled the eventfd, which can be
+    ///     an atomic one, so it must not sleep.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_watch the watch (from platform_eventfd_watch) to start
+    ///
+    extern "C" void
+    platform_eventfd_watch_start(void *const pmut_watch) noexcept
+    {
+        bsl::expects(nullptr != pmut_watch);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stops watching an eventfd and releases the watch, whether
+    ///     or not it was started. Once this returns, the watch's callback
+    ///     is no longer running, and will not be called again.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_watch the watch (from platform_eventfd_watch) to
+    ///     stop
+    ///
+    extern "C" void
+    platform_eventfd_unwatch(void *const pmut_watch) noexcept
+    {
+        bsl::expects(nullptr != pmut_watch);
+        --g_mut_platform_eventfd_refs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns a handle to the provided eventfd that can be
+    ///     signaled using platform_eventfd_signal, even after userspace
+    ///     closes the file descriptor. Returns NULL if fd is not an
+    ///     eventfd.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param fd the file descriptor of the eventfd
+    ///   @return Returns a handle to the eventfd on success, NULL on
+    ///     failure.
+    ///
+    extern "C" [[nodiscard]] auto
+    platform_eventfd_get(uint64_t const fd) noexcept -> void *
+    {
+        if (g_mut_platform_eventfd_get_fails) {
+            return nullptr;
+        }
+
+        ++g_mut_platform_eventfd_refs;
+        return g_mut_platform_eventfds.at_if(bsl::to_idx(bsl::to_u64(fd) % PLATFORM_NUM_EVENTFDS));
+    }
+
+    /// <!-- description -->
+    ///   @brief Releases a handle from platform_eventfd_get.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_eventfd the handle to release
+    ///
+    extern "C" void
+    platform_eventfd_put(void *const pmut_eventfd) noexcept
+    {
+        bsl::expects(nullptr != pmut_eventfd);
+        --g_mut_platform_eventfd_refs;
+    }
+
+    /// <!-- description -->
+    ///   @brief Signals an eventfd (i.e., adds 1 to its counter).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_eventfd the handle (from platform_eventfd_get) of
+    ///     the eventfd to signal
+    ///
+    extern "C" void
+    platform_eventfd_signal(void *const pmut_eventfd) noexcept
+    {
+        bsl::expects(nullptr != pmut_eventfd);
+        ++g_mut_platform_eventfd_signaled;
+    }
 }
@@ -93,6 +93,21 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"mv_vm_op_clock_set fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_clock_set = MV_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_clock_set = {};
+                    };
+                };
+            };
+        };
+
         return fini_tests();
     }
 }
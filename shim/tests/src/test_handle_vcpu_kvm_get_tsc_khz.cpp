@@ -25,6 +25,7 @@
 #include "../../include/handle_vcpu_kvm_get_tsc_khz.h"
 
 #include <helpers.hpp>
+#include <shim_vcpu_t.h>
 
 #include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
@@ -46,16 +47,17 @@ namespace shim
         init_tests();
         constexpr auto handle{&handle_vcpu_kvm_get_tsc_khz};
 
-        bsl::ut_scenario{"ms_vs_op_mp_get_state fails"} = []() noexcept {
+        bsl::ut_scenario{"mv_vs_op_tsc_get_khz fails"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
                 bsl::safe_u64 mut_tsckhz{};
                 bsl::ut_when{} = [&]() noexcept {
-                    g_mut_mv_pp_op_tsc_get_khz = MV_STATUS_FAILURE_UNKNOWN;
+                    g_mut_mv_vs_op_tsc_get_khz = MV_STATUS_FAILURE_UNKNOWN;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_FAILURE == handle(mut_tsckhz.data()));
+                        bsl::ut_check(SHIM_FAILURE == handle(&vcpu, mut_tsckhz.data()));
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
-                        g_mut_mv_pp_op_tsc_get_khz = {};
+                        g_mut_mv_vs_op_tsc_get_khz = {};
                     };
                 };
             };
@@ -63,10 +65,11 @@ namespace shim
 
         bsl::ut_scenario{"vcpu_kvm_get_tsc_khz Success"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
                 bsl::safe_u64 mut_tsckhz{};
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle(mut_tsckhz.data()));
+                        bsl::ut_check(SHIM_SUCCESS == handle(&vcpu, mut_tsckhz.data()));
                         bsl::ut_check(mut_tsckhz >= bsl::safe_u64::magic_0());
                     };
                 };
@@ -24,7 +24,8 @@
 
 #include "../../include/handle_vcpu_kvm_kvmclock_ctrl.h"
 
-#include <mv_types.h>
+#include <helpers.hpp>
+#include <shim_vcpu_t.h>
 
 #include <bsl/ut.hpp>
 
@@ -42,17 +43,49 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vcpu_kvm_kvmclock_ctrl};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vcpu));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_kvmclock_ctrl fails"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
                 bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_kvmclock_ctrl = MV_STATUS_FAILURE_UNKNOWN;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vcpu_kvm_kvmclock_ctrl());
+                        bsl::ut_check(SHIM_FAILURE == handle(&vcpu));
                     };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vs_op_kvmclock_ctrl = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(SHIM_SUCCESS == handle(&vcpu));
                 };
             };
         };
 
-        return bsl::ut_success();
+        return fini_tests();
     }
 }
 
@@ -26,9 +26,15 @@
 
 #include <helpers.hpp>
 #include <kvm_run.h>
+#include <kvm_sync_regs.h>
 #include <mv_bit_size_t.h>
+#include <mv_exit_mmio_t.h>
 #include <mv_exit_reason_t.h>
+#include <mv_run_t.h>
+#include <mv_sync_regs_t.h>
+#include <platform.h>
 #include <shim_vcpu_t.h>
+#include <shim_vm_t.h>
 
 #include <bsl/convert.hpp>
 #include <bsl/safe_integral.hpp>
@@ -143,7 +149,8 @@ namespace shim
                     mut_vcpu.run = new kvm_run();    // NOLINT
                     g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu));
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_HLT == mut_vcpu.run->exit_reason);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
@@ -152,6 +159,78 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns hlt with irqchip"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                shim_vcpu_t *const pmut_vcpu{&mut_vm.vcpus[0]};    // NOLINT
+                constexpr auto timeout{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    pmut_vcpu->vm = &mut_vm;
+                    pmut_vcpu->run = new kvm_run();    // NOLINT
+                    shared_page_as<mv_run_t>()->hlt_timeout_ns = timeout.get();
+                    g_mut_platform_waitq_interrupted = true;
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_INTERRUPTED == handle(pmut_vcpu));
+                        bsl::ut_check(KVM_EXIT_INTR == pmut_vcpu->run->exit_reason);
+                        bsl::ut_check(timeout == g_mut_platform_waitq_timeout);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_platform_waitq_interrupted = false;
+                        delete pmut_vcpu->run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns hlt with no timeout"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                shim_vcpu_t *const pmut_vcpu{&mut_vm.vcpus[0]};    // NOLINT
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    pmut_vcpu->vm = &mut_vm;
+                    pmut_vcpu->run = new kvm_run();    // NOLINT
+                    shared_page_as<mv_run_t>()->hlt_timeout_ns = MV_RUN_HLT_NO_TIMEOUT;
+                    g_mut_platform_waitq_interrupted = true;
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_INTERRUPTED == handle(pmut_vcpu));
+                        bsl::ut_check(
+                            bsl::to_u64(PLATFORM_WAIT_FOREVER) == g_mut_platform_waitq_timeout);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_platform_waitq_interrupted = false;
+                        delete pmut_vcpu->run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns wakeup"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                shim_vcpu_t *const pmut_vcpu{&mut_vm.vcpus[0]};    // NOLINT
+                bsl::ut_when{} = [&]() noexcept {
+                    pmut_vcpu->vm = &mut_vm;
+                    pmut_vcpu->run = new kvm_run();    // NOLINT
+                    shared_page_as<mv_run_t>()->wakeup = bsl::safe_u64::magic_1().get();
+                    g_mut_platform_waitq_woken = {};
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(pmut_vcpu));
+                        bsl::ut_check(KVM_EXIT_HLT == pmut_vcpu->run->exit_reason);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_platform_waitq_woken);
+                        bsl::ut_check(0U == shared_page_as<mv_run_t>()->wakeup);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete pmut_vcpu->run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"g_mut_mv_vs_op_run returns io in"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 shim_vcpu_t mut_vcpu{};
@@ -391,6 +470,106 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns io in completed on next run"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr auto addr{0x10_u64};
+                constexpr auto data{0x1234_u64};
+                constexpr bsl::safe_u64 type{MV_EXIT_IO_IN};
+                constexpr auto size{mv_bit_size_t_16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_io;
+                    g_mut_mv_vs_op_run_io.addr = addr.get();
+                    g_mut_mv_vs_op_run_io.data = {};
+                    g_mut_mv_vs_op_run_io.reps = {};
+                    g_mut_mv_vs_op_run_io.type = type.get();
+                    g_mut_mv_vs_op_run_io.size = size;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_IO == mut_vcpu.run->exit_reason);
+                        bsl::ut_check(1_u32 == mut_vcpu.run->io.count);
+                        bsl::ut_check(1_u8 == mut_vcpu.io_in_pending);
+
+                        mut_vcpu.run->io.data16 = static_cast<bsl::uint16>(data.get());
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(data == g_mut_mv_vs_op_run_io_in.data);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns io string out"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr auto addr{0x1F0_u64};
+                constexpr auto reps{4_u64};
+                constexpr bsl::safe_u64 type{MV_EXIT_IO_OUT};
+                constexpr auto size{mv_bit_size_t_8};
+                constexpr auto pio_offset{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_io;
+                    g_mut_mv_vs_op_run_io.addr = addr.get();
+                    g_mut_mv_vs_op_run_io.data = {};
+                    g_mut_mv_vs_op_run_io.reps = reps.get();
+                    g_mut_mv_vs_op_run_io.type = type.get();
+                    g_mut_mv_vs_op_run_io.size = size;
+                    for (bsl::safe_u64 mut_i{}; mut_i < reps; ++mut_i) {
+                        g_mut_mv_vs_op_run_io.buf[mut_i.get()] =    // NOLINT
+                            static_cast<bsl::uint8>(mut_i.get());
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_IO == mut_vcpu.run->exit_reason);
+                        bsl::ut_check(bsl::to_u32(reps) == mut_vcpu.run->io.count);
+                        bsl::ut_check(pio_offset == mut_vcpu.run->io.data_offset);
+                        bsl::ut_check(3_u8 == mut_vcpu.run->pio_data[3]);    // NOLINT
+                        bsl::ut_check(0_u8 == mut_vcpu.io_in_pending);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns io string in"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr auto addr{0x1F0_u64};
+                constexpr auto reps{2_u64};
+                constexpr bsl::safe_u64 type{MV_EXIT_IO_IN};
+                constexpr auto size{mv_bit_size_t_16};
+                constexpr auto val{0x42_u8};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_io;
+                    g_mut_mv_vs_op_run_io.addr = addr.get();
+                    g_mut_mv_vs_op_run_io.data = {};
+                    g_mut_mv_vs_op_run_io.reps = reps.get();
+                    g_mut_mv_vs_op_run_io.type = type.get();
+                    g_mut_mv_vs_op_run_io.size = size;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_IO == mut_vcpu.run->exit_reason);
+                        bsl::ut_check(bsl::to_u32(reps) == mut_vcpu.run->io.count);
+                        bsl::ut_check(1_u8 == mut_vcpu.io_in_pending);
+
+                        mut_vcpu.run->pio_data[3] = val.get();    // NOLINT
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(val == g_mut_mv_vs_op_run_io_in.buf[3]);    // NOLINT
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"g_mut_mv_vs_op_run returns io reps out of range"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 shim_vcpu_t mut_vcpu{};
@@ -417,12 +596,102 @@ namespace shim
             };
         };
 
-        bsl::ut_scenario{"g_mut_mv_vs_op_run returns mmio"} = []() noexcept {
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns mmio write"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr auto gpa{0xFEE00000_u64};
+                constexpr auto data{0x12345678_u64};
+                constexpr bsl::safe_u64 flags{MV_EXIT_MMIO_WRITE};
+                constexpr auto size{mv_bit_size_t_32};
+                constexpr auto len{4_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_mmio;
+                    g_mut_mv_vs_op_run_mmio.gpa = gpa.get();
+                    g_mut_mv_vs_op_run_mmio.flags = flags.get();
+                    g_mut_mv_vs_op_run_mmio.data = data.get();
+                    g_mut_mv_vs_op_run_mmio.size = size;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_MMIO == mut_vcpu.run->exit_reason);
+                        bsl::ut_check(gpa == mut_vcpu.run->mmio.phys_addr);
+                        bsl::ut_check(len == mut_vcpu.run->mmio.len);
+                        bsl::ut_check(1_u8 == mut_vcpu.run->mmio.is_write);
+                        bsl::ut_check(0_u8 == mut_vcpu.mmio_read_pending);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns mmio read"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr auto gpa{0xFEE00000_u64};
+                constexpr auto data{0x42_u64};
+                constexpr bsl::safe_u64 flags{MV_EXIT_MMIO_READ};
+                constexpr auto size{mv_bit_size_t_8};
+                constexpr auto len{1_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_mmio;
+                    g_mut_mv_vs_op_run_mmio.gpa = gpa.get();
+                    g_mut_mv_vs_op_run_mmio.flags = flags.get();
+                    g_mut_mv_vs_op_run_mmio.data = {};
+                    g_mut_mv_vs_op_run_mmio.size = size;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_MMIO == mut_vcpu.run->exit_reason);
+                        bsl::ut_check(gpa == mut_vcpu.run->mmio.phys_addr);
+                        bsl::ut_check(len == mut_vcpu.run->mmio.len);
+                        bsl::ut_check(0_u8 == mut_vcpu.run->mmio.is_write);
+                        bsl::ut_check(1_u8 == mut_vcpu.mmio_read_pending);
+
+                        mut_vcpu.run->mmio.data[0] = static_cast<bsl::uint8>(data.get());
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(data == g_mut_mv_vs_op_run_mmio_data);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns mmio 16 and 64 bit"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr bsl::safe_u64 flags{MV_EXIT_MMIO_WRITE};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_mmio;
+                    g_mut_mv_vs_op_run_mmio.flags = flags.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        g_mut_mv_vs_op_run_mmio.size = mv_bit_size_t_16;
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(2_u32 == mut_vcpu.run->mmio.len);
+
+                        g_mut_mv_vs_op_run_mmio.size = mv_bit_size_t_64;
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(8_u32 == mut_vcpu.run->mmio.len);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns mmio invalid size"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 shim_vcpu_t mut_vcpu{};
+                constexpr auto size{static_cast<mv_bit_size_t>(0xFF)};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_vcpu.run = new kvm_run();    // NOLINT
                     g_mut_mv_vs_op_run = mv_exit_reason_t_mmio;
+                    g_mut_mv_vs_op_run_mmio.size = size;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu));
                     };
@@ -481,6 +750,196 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns yield"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_yield;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns yield with no siblings"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                shim_vcpu_t *const pmut_vcpu{&mut_vm.vcpus[0]};    // NOLINT
+                bsl::ut_when{} = [&]() noexcept {
+                    pmut_vcpu->vm = &mut_vm;
+                    pmut_vcpu->run = new kvm_run();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_yield;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(pmut_vcpu));
+                        bsl::ut_check(0U == mut_vm.last_yield);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete pmut_vcpu->run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns yield with a sibling"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                shim_vcpu_t *const pmut_vcpu{&mut_vm.vcpus[0]};    // NOLINT
+                constexpr auto sibling{1_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    pmut_vcpu->vm = &mut_vm;
+                    pmut_vcpu->run = new kvm_run();    // NOLINT
+                    mut_vm.vcpus[sibling.get()].thread = platform_current_thread();    // NOLINT
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_yield;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(pmut_vcpu));
+                        bsl::ut_check(sibling.get() == mut_vm.last_yield);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete pmut_vcpu->run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"g_mut_mv_vs_op_run returns exit page"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    mut_vcpu.exit_page = bsl::safe_u8::magic_1().get();
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_exit_page;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(bsl::safe_u8::magic_0() == mut_vcpu.io_in_pending);
+                        bsl::ut_check(bsl::safe_u8::magic_0() == mut_vcpu.mmio_read_pending);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sync regs"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr bsl::safe_u64 regs{KVM_SYNC_X86_REGS};
+                constexpr bsl::safe_u64 gprs{MV_SYNC_REGS_GPRS};
+                constexpr auto rax{42_u64};
+                constexpr auto rip{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    mut_vcpu.run->kvm_valid_regs = regs.get();
+                    mut_vcpu.run->kvm_dirty_regs = regs.get();
+                    mut_vcpu.run->s.regs.regs.rax = rax.get();
+                    mut_vcpu.run->s.regs.regs.rip = rip.get();
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const mv_run{shared_page_as<mv_run_t>()};
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(gprs == mv_run->sync_regs.valid);
+                        bsl::ut_check(gprs == mv_run->sync_regs.dirty);
+                        bsl::ut_check(rax == mv_run->sync_regs.rax);
+                        bsl::ut_check(rip == mv_run->sync_regs.rip);
+                        bsl::ut_check(0_u64 == mut_vcpu.run->kvm_dirty_regs);
+                        bsl::ut_check(rax == mut_vcpu.run->s.regs.regs.rax);
+                        bsl::ut_check(rip == mut_vcpu.run->s.regs.regs.rip);
+                        bsl::ut_check(SHIM_VCPU_CACHE_REGS == mut_vcpu.cache_valid);
+                        bsl::ut_check(rax == mut_vcpu.regs.rax);
+                        bsl::ut_check(rip == mut_vcpu.regs.rip);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"flushes and invalidates the register cache"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    mut_vcpu.cache_valid = SHIM_VCPU_CACHE_ALL;
+                    mut_vcpu.cache_dirty = SHIM_VCPU_CACHE_REGS;
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu));
+                        bsl::ut_check(0_u64 == mut_vcpu.cache_valid);
+                        bsl::ut_check(0_u64 == mut_vcpu.cache_dirty);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"register cache flush fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    mut_vcpu.cache_valid = SHIM_VCPU_CACHE_REGS;
+                    mut_vcpu.cache_dirty = SHIM_VCPU_CACHE_REGS;
+                    g_mut_mv_vs_op_reg_set_list = MV_STATUS_FAILURE_UNKNOWN;
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_FAIL_ENTRY == mut_vcpu.run->exit_reason);
+                        bsl::ut_check(SHIM_VCPU_CACHE_REGS == mut_vcpu.cache_dirty);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vs_op_reg_set_list = {};
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sync regs unsupported valid regs"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr bsl::safe_u64 sregs{KVM_SYNC_X86_SREGS};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    mut_vcpu.run->kvm_valid_regs = sregs.get();
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_FAIL_ENTRY == mut_vcpu.run->exit_reason);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"sync regs unsupported dirty regs"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                constexpr bsl::safe_u64 events{KVM_SYNC_X86_EVENTS};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.run = new kvm_run();    // NOLINT
+                    mut_vcpu.run->kvm_dirty_regs = events.get();
+                    g_mut_mv_vs_op_run = mv_exit_reason_t_hlt;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu));
+                        bsl::ut_check(KVM_EXIT_FAIL_ENTRY == mut_vcpu.run->exit_reason);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        delete mut_vcpu.run;    // NOLINT // GRCOV_EXCLUDE_BR
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"g_mut_mv_vs_op_run returns random"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 shim_vcpu_t mut_vcpu{};
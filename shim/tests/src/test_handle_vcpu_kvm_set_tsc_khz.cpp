@@ -24,8 +24,10 @@
 
 #include "../../include/handle_vcpu_kvm_set_tsc_khz.h"
 
-#include <mv_types.h>
+#include <helpers.hpp>
+#include <shim_vcpu_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
@@ -42,17 +44,49 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vcpu_kvm_set_tsc_khz};
+
+        bsl::ut_scenario{"tsc_khz of 0 fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vcpu, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vs_op_tsc_set_khz fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
+                constexpr auto tsc_khz{2000000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_tsc_set_khz = MV_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vcpu, tsc_khz.get()));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vs_op_tsc_set_khz = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t const vcpu{};
+                constexpr auto tsc_khz{2000000_u64};
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vcpu_kvm_set_tsc_khz());
+                        bsl::ut_check(SHIM_SUCCESS == handle(&vcpu, tsc_khz.get()));
                     };
                 };
             };
         };
 
-        return bsl::ut_success();
+        return fini_tests();
     }
 }
 
@@ -241,6 +241,89 @@ namespace shim
                 };
             };
         };
+        bsl::ut_scenario{"capadjustclock success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::safe_u32 mut_checkext{};
+                constexpr auto ret_capadjustclock{6_u16};
+                constexpr auto capadjustclock{39_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            SHIM_SUCCESS == handle(capadjustclock.get(), mut_checkext.data()));
+                        bsl::ut_check(ret_capadjustclock == bsl::to_u16(mut_checkext));
+                    };
+                };
+            };
+        };
+        bsl::ut_scenario{"capkvmclockctrl success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::safe_u32 mut_checkext{};
+                constexpr auto ret_capkvmclockctrl{1_u16};
+                constexpr auto capkvmclockctrl{76_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            SHIM_SUCCESS == handle(capkvmclockctrl.get(), mut_checkext.data()));
+                        bsl::ut_check(ret_capkvmclockctrl == bsl::to_u16(mut_checkext));
+                    };
+                };
+            };
+        };
+        bsl::ut_scenario{"capsyncregs success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::safe_u32 mut_checkext{};
+                constexpr auto ret_capsyncregs{1_u16};
+                constexpr auto capsyncregs{74_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            SHIM_SUCCESS == handle(capsyncregs.get(), mut_checkext.data()));
+                        bsl::ut_check(ret_capsyncregs == bsl::to_u16(mut_checkext));
+                    };
+                };
+            };
+        };
+        bsl::ut_scenario{"capirqfd success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::safe_u32 mut_checkext{};
+                constexpr auto ret_capirqfd{1_u16};
+                constexpr auto capirqfd{32_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(capirqfd.get(), mut_checkext.data()));
+                        bsl::ut_check(ret_capirqfd == bsl::to_u16(mut_checkext));
+                    };
+                };
+            };
+        };
+        bsl::ut_scenario{"capirqfdresample success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::safe_u32 mut_checkext{};
+                constexpr auto ret_capirqfdresample{1_u16};
+                constexpr auto capirqfdresample{82_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            SHIM_SUCCESS == handle(capirqfdresample.get(), mut_checkext.data()));
+                        bsl::ut_check(ret_capirqfdresample == bsl::to_u16(mut_checkext));
+                    };
+                };
+            };
+        };
+        bsl::ut_scenario{"capbinarystatsfd success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::safe_u32 mut_checkext{};
+                constexpr auto ret_capbinarystatsfd{1_u16};
+                constexpr auto capbinarystatsfd{203_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            SHIM_SUCCESS == handle(capbinarystatsfd.get(), mut_checkext.data()));
+                        bsl::ut_check(ret_capbinarystatsfd == bsl::to_u16(mut_checkext));
+                    };
+                };
+            };
+        };
         bsl::ut_scenario{"unsupported extension"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 bsl::safe_u32 mut_checkext{};
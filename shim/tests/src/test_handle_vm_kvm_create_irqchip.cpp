@@ -24,8 +24,10 @@
 
 #include "../../include/handle_vm_kvm_create_irqchip.h"
 
-#include <mv_types.h>
+#include <helpers.hpp>
+#include <shim_vm_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
@@ -42,11 +44,57 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vm_kvm_create_irqchip};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm));
+                        bsl::ut_check(bsl::safe_u8::magic_0() == mut_vm.irqchip);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_irqchip_create fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_irqchip_create = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm));
+                        bsl::ut_check(bsl::safe_u8::magic_0() == mut_vm.irqchip);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm));
+                        bsl::ut_check(bsl::safe_u8::magic_0() != mut_vm.irqchip);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"irqchip already created"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
                 bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vm_kvm_create_irqchip());
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm));
                     };
                 };
             };
@@ -27,6 +27,7 @@
 #include <helpers.hpp>
 #include <shim_vcpu_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
@@ -55,6 +56,19 @@ namespace shim
             };
         };
 
+        bsl::ut_scenario{"success with an exit page"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.exit_page = bsl::safe_u8::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        handle(&mut_vcpu);
+                        bsl::ut_check(bsl::safe_u8::magic_0().get() == mut_vcpu.exit_page);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 shim_vcpu_t mut_vcpu{};
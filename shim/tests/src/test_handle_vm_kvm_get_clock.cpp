@@ -24,9 +24,11 @@
 
 #include "../../include/handle_vm_kvm_get_clock.h"
 
+#include <helpers.hpp>
 #include <kvm_clock_data.h>
-#include <mv_types.h>
+#include <shim_vm_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
@@ -43,18 +45,63 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vm_kvm_get_clock};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                kvm_clock_data mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_clock_get fails"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
                 kvm_clock_data mut_args{};
                 bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_clock_get = MV_STATUS_FAILURE_UNKNOWN;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vm_kvm_get_clock(&mut_args));
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_clock_get = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                kvm_clock_data mut_args{};
+                constexpr auto ns{42_u64};
+                constexpr auto flags{6_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = ns.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&vm, &mut_args));
+                        bsl::ut_check(ns == mut_args.clock);
+                        bsl::ut_check(flags == mut_args.flags);
+                        bsl::ut_check(bsl::safe_u64{mut_args.realtime}.is_pos());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_val = {};
                     };
                 };
             };
         };
 
-        return bsl::ut_success();
+        return fini_tests();
     }
 }
 
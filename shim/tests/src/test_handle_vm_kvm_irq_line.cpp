@@ -24,9 +24,11 @@
 
 #include "../../include/handle_vm_kvm_irq_line.h"
 
+#include <helpers.hpp>
 #include <kvm_irq_level.h>
-#include <mv_types.h>
+#include <shim_vm_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
@@ -43,12 +45,65 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vm_kvm_irq_line};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irq_level const args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"irqchip not created"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irq_level const args{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &args));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_irq_line fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irq_level const args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    g_mut_mv_vm_op_irq_line = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
                 kvm_irq_level mut_args{};
+                constexpr auto irq{4_u32};
                 bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.irq = irq.get();
+                    mut_args.level = bsl::safe_u32::magic_1().get();
+                    mut_vm.vcpus[0].thread = bsl::safe_u64::magic_1().get();
+                    g_mut_platform_waitq_woken = {};
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vm_kvm_irq_line(&mut_args));
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_platform_waitq_woken);
+                        bsl::ut_check(1U == mut_vm.vcpus[0].halt_wakeup);
                     };
                 };
             };
@@ -24,13 +24,24 @@
 
 #include "../../include/handle_vm_kvm_irqfd.h"
 
+#include <helpers.hpp>
 #include <kvm_irqfd.h>
 #include <mv_types.h>
+#include <shim_irqfd_t.h>
+#include <shim_vm_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
 {
+    /// @brief defines the eventfd used by the tests
+    constexpr auto FD{42_u32};
+    /// @brief defines the resamplefd used by the tests
+    constexpr auto RESAMPLEFD{43_u32};
+    /// @brief defines the GSI used by the tests
+    constexpr auto GSI{5_u32};
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -43,12 +54,352 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vm_kvm_irqfd};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd const args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"irqchip not created"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd const args{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &args));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid flags"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                constexpr auto flags{0x4_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.flags = flags.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"gsi out of range"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                constexpr auto gsi{24_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.gsi = gsi.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"platform_eventfd_watch fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_RESAMPLE;
+                    mut_args.resamplefd = RESAMPLEFD.get();
+                    g_mut_platform_eventfd_watch_fails = true;
+                    g_mut_platform_eventfd_refs = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(g_mut_platform_eventfd_refs.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_platform_eventfd_watch_fails = false;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"platform_eventfd_get fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_RESAMPLE;
+                    mut_args.resamplefd = RESAMPLEFD.get();
+                    g_mut_platform_eventfd_get_fails = true;
+                    g_mut_platform_eventfd_refs = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(g_mut_platform_eventfd_refs.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_platform_eventfd_get_fails = false;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_irq_resample fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_RESAMPLE;
+                    mut_args.resamplefd = RESAMPLEFD.get();
+                    g_mut_mv_vm_op_irq_resample = bsl::safe_u64::magic_1().get();
+                    g_mut_platform_eventfd_refs = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].resample);
+                        bsl::ut_check(g_mut_platform_eventfd_refs.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_irq_resample = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"assign success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(&mut_vm == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(nullptr != mut_vm.irqfds[0].watch);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].resample);
+                        bsl::ut_check(bsl::to_u64(GSI) == mut_vm.irqfds[0].gsi);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"assign with resample success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_RESAMPLE;
+                    mut_args.resamplefd = RESAMPLEFD.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(&mut_vm == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(nullptr != mut_vm.irqfds[0].watch);
+                        bsl::ut_check(nullptr != mut_vm.irqfds[0].resample);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"assign the same eventfd twice fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"assign the same eventfd through another fd fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                constexpr auto dup_fd{(FD + 64_u32).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.fd = dup_fd.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[1].vm);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"too many irqfds"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.gsi = GSI.get();
+                    for (bsl::safe_u32 mut_i{}; mut_i < bsl::to_u32(SHIM_MAX_IRQFDS); ++mut_i) {
+                        mut_args.fd = mut_i.get();
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_args.fd = bsl::to_u32(SHIM_MAX_IRQFDS).get();
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deassign an irqfd that does not exist"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_DEASSIGN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deassign with the wrong gsi does nothing"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.gsi = (GSI + 1_u32).checked().get();
+                    mut_args.flags = KVM_IRQFD_FLAG_DEASSIGN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(&mut_vm == mut_vm.irqfds[0].vm);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deassign success"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
                 kvm_irqfd mut_args{};
                 bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.flags = KVM_IRQFD_FLAG_DEASSIGN;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vm_kvm_irqfd(&mut_args));
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].watch);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deassign through another fd for the same eventfd"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                constexpr auto dup_fd{(FD + 64_u32).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.fd = dup_fd.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_DEASSIGN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deassign with resample mv_vm_op_irq_resample fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_RESAMPLE;
+                    mut_args.resamplefd = RESAMPLEFD.get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.flags = KVM_IRQFD_FLAG_DEASSIGN;
+                    g_mut_mv_vm_op_irq_resample = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_irq_resample = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deassign keeps a GSI resampled by another irqfd"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                kvm_irqfd mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqchip = bsl::safe_u8::magic_1().get();
+                    mut_args.fd = FD.get();
+                    mut_args.gsi = GSI.get();
+                    mut_args.flags = KVM_IRQFD_FLAG_RESAMPLE;
+                    mut_args.resamplefd = RESAMPLEFD.get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.fd = (FD + 1_u32).checked().get();
+                    bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                    mut_args.flags = KVM_IRQFD_FLAG_DEASSIGN;
+                    g_mut_mv_vm_op_irq_resample = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vm, &mut_args));
+                        bsl::ut_check(nullptr == mut_vm.irqfds[1].vm);
+                        bsl::ut_check(nullptr != mut_vm.irqfds[0].resample);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_irq_resample = {};
                     };
                 };
             };
@@ -24,9 +24,12 @@
 
 #include "../../include/handle_vm_kvm_set_clock.h"
 
+#include <helpers.hpp>
 #include <kvm_clock_data.h>
-#include <mv_types.h>
+#include <kvm_constants.h>
+#include <shim_vm_t.h>
 
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace shim
@@ -43,18 +46,65 @@ namespace shim
     [[nodiscard]] constexpr auto
     tests() noexcept -> bsl::exit_code
     {
-        bsl::ut_scenario{"description"} = []() noexcept {
+        init_tests();
+        constexpr auto handle{&handle_vm_kvm_set_clock};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                kvm_clock_data const args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_clock_set fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                kvm_clock_data const args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vm_op_clock_set = MV_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_clock_set = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                kvm_clock_data const args{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(SHIM_SUCCESS == handle(&vm, &args));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success with realtime"} = []() noexcept {
             bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
                 kvm_clock_data mut_args{};
                 bsl::ut_when{} = [&]() noexcept {
+                    mut_args.flags = KVM_CLOCK_REALTIME;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(SHIM_SUCCESS == handle_vm_kvm_set_clock(&mut_args));
+                        bsl::ut_check(SHIM_SUCCESS == handle(&vm, &mut_args));
                     };
                 };
             };
         };
 
-        return bsl::ut_success();
+        return fini_tests();
     }
 }
 
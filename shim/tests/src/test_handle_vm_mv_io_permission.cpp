@@ -0,0 +1,187 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/handle_vm_mv_io_permission.h"
+
+#include <helpers.hpp>
+#include <mv_constants.h>
+#include <mv_io_permission.h>
+#include <shim_vm_t.h>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        init_tests();
+        constexpr auto handle{&handle_vm_mv_io_permission};
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto port{0x80_u16};
+                constexpr auto num{2_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = port.get();
+                    mut_args.num = num.get();
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_hypervisor_detected = true;
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"pad is not 0"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto port{0x80_u16};
+                constexpr auto num{2_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = port.get();
+                    mut_args.pad = bsl::safe_u16::magic_1().get();
+                    mut_args.num = num.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"no ports"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto port{0x80_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = port.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"range goes past the last port"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto last_port{0xFFFF_u16};
+                constexpr auto num{2_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = last_port.get();
+                    mut_args.num = num.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unknown type"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto port{0x80_u16};
+                constexpr auto num{2_u32};
+                constexpr auto bad_type{0x3_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = port.get();
+                    mut_args.num = num.get();
+                    mut_args.type = bad_type.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"mv_vm_op_io_permission fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto port{0x80_u16};
+                constexpr auto num{2_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = port.get();
+                    mut_args.num = num.get();
+                    g_mut_mv_vm_op_io_permission = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t const vm{};
+                mv_io_permission mut_args{};
+                constexpr auto last_port{0xFFFF_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.port = last_port.get();
+                    mut_args.num = bsl::safe_u32::magic_1().get();
+                    mut_args.type = MV_IO_PERM_PASSTHROUGH;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&vm, &mut_args));
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
@@ -0,0 +1,209 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/shim_irqfd.h"
+
+#include <helpers.hpp>
+#include <kvm_irqfd.h>
+#include <mv_types.h>
+#include <shim_irqfd_t.h>
+#include <shim_vm_t.h>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    /// @brief defines the GSI used by the tests
+    constexpr auto GSI{5_u64};
+    /// @brief defines the thread used by the tests
+    constexpr auto THREAD{42_u64};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        init_tests();
+
+        bsl::ut_scenario{"signal raising the gsi fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.vcpus[0].thread = THREAD.get();
+                    mut_vm.irqfds[0].vm = &mut_vm;
+                    mut_vm.irqfds[0].gsi = GSI.get();
+                    g_mut_mv_vm_op_irq_line = bsl::safe_u64::magic_1().get();
+                    g_mut_platform_kicked = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_signal(&mut_vm.irqfds[0]);
+                        bsl::ut_check(g_mut_platform_kicked.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_irq_line = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal lowering the gsi fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.vcpus[0].thread = THREAD.get();
+                    mut_vm.irqfds[0].vm = &mut_vm;
+                    mut_vm.irqfds[0].gsi = GSI.get();
+                    g_mut_mv_vm_op_irq_line = 2_u64.get();
+                    g_mut_platform_kicked = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_signal(&mut_vm.irqfds[0]);
+                        bsl::ut_check(g_mut_platform_kicked.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_irq_line = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal kicks the running vcpus"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.vcpus[0].thread = THREAD.get();
+                    mut_vm.irqfds[0].vm = &mut_vm;
+                    mut_vm.irqfds[0].gsi = GSI.get();
+                    g_mut_platform_kicked = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_signal(&mut_vm.irqfds[0]);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_platform_kicked);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"signal leaves a resampled gsi raised"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqfds[0].vm = &mut_vm;
+                    mut_vm.irqfds[0].gsi = GSI.get();
+                    mut_vm.irqfds[0].flags = bsl::to_u64(KVM_IRQFD_FLAG_RESAMPLE).get();
+                    g_mut_mv_vm_op_irq_line = 2_u64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_signal(&mut_vm.irqfds[0]);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_mv_vm_op_irq_line);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vm_op_irq_line = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"resample with nothing resampled"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_platform_eventfd_signaled = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_resample(&mut_vm, {});
+                        bsl::ut_check(g_mut_platform_eventfd_signaled.is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"resample signals the matching resamplefds"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::uint8 mut_resample{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqfds[0].vm = &mut_vm;
+                    mut_vm.irqfds[0].gsi = GSI.get();
+                    mut_vm.irqfds[0].resample = &mut_resample;
+                    mut_vm.irqfds[1].vm = &mut_vm;
+                    mut_vm.irqfds[1].gsi = (GSI + 1_u64).checked().get();
+                    mut_vm.irqfds[1].resample = &mut_resample;
+                    mut_vm.irqfds[2].vm = &mut_vm;
+                    mut_vm.irqfds[2].gsi = GSI.get();
+                    g_mut_platform_eventfd_signaled = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_resample(&mut_vm, (1_u64 << GSI).get());
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_platform_eventfd_signaled);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"release frees every irqfd"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::uint8 mut_handle{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.irqfds[0].vm = &mut_vm;
+                    mut_vm.irqfds[0].watch = &mut_handle;
+                    mut_vm.irqfds[1].vm = &mut_vm;
+                    mut_vm.irqfds[1].eventfd = &mut_handle;
+                    mut_vm.irqfds[1].watch = &mut_handle;
+                    mut_vm.irqfds[1].resample = &mut_handle;
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_irqfd_release(&mut_vm);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].vm);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[0].watch);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[1].vm);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[1].eventfd);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[1].watch);
+                        bsl::ut_check(nullptr == mut_vm.irqfds[1].resample);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
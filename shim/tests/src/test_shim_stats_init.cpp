@@ -0,0 +1,140 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/shim_stats_init.h"
+
+#include <helpers.hpp>
+#include <shim_stats_t.h>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"header"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_stats_t mut_stats{};
+                constexpr auto name_size{48_u32};
+                constexpr auto num_desc{16_u32};
+                constexpr auto id_offset{24_u32};
+                constexpr auto desc_offset{72_u32};
+                constexpr auto data_offset{1096_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    shim_stats_init(&mut_stats, "kvm-vm:", 7U, 42U);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(name_size == mut_stats.header.name_size);
+                        bsl::ut_check(num_desc == mut_stats.header.num_desc);
+                        bsl::ut_check(id_offset == mut_stats.header.id_offset);
+                        bsl::ut_check(desc_offset == mut_stats.header.desc_offset);
+                        bsl::ut_check(data_offset == mut_stats.header.data_offset);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"id"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_stats_t mut_stats{};
+                bsl::ut_when{} = [&]() noexcept {
+                    shim_stats_init(&mut_stats, "kvm-vcpu:", 9U, 23U);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::string_view{"kvm-vcpu:23"} == mut_stats.id);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"descriptors"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_stats_t mut_stats{};
+                constexpr auto hypercalls{4096_u32};
+                constexpr auto halt_polls{8192_u32};
+                constexpr auto fpu{12288_u32};
+                constexpr auto hist_offset{16_u32};
+                constexpr auto hist_size{62_u16};
+                constexpr auto slots_offset{512_u32};
+                constexpr auto slots_size{448_u16};
+                constexpr auto bucket_size{1_u32};
+                bsl::ut_when{} = [&]() noexcept {
+                    shim_stats_init(&mut_stats, "kvm-vm:", 7U, 0U);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(bsl::string_view{"exits"} == mut_stats.descs[0].name);
+                        bsl::ut_check(bsl::safe_u32{mut_stats.descs[0].offset}.is_zero());
+                        bsl::ut_check(hist_offset == mut_stats.descs[2].offset);
+                        bsl::ut_check(hist_size == mut_stats.descs[2].size);
+                        bsl::ut_check(bsl::safe_u32{mut_stats.descs[2].bucket_size}.is_zero());
+                        bsl::ut_check(slots_offset == mut_stats.descs[3].offset);
+                        bsl::ut_check(slots_size == mut_stats.descs[3].size);
+                        bsl::ut_check(bucket_size == mut_stats.descs[3].bucket_size);
+                        bsl::ut_check(bsl::string_view{"hypercalls"} == mut_stats.descs[4].name);
+                        bsl::ut_check(hypercalls == mut_stats.descs[4].offset);
+                        bsl::ut_check(
+                            (hypercalls + slots_offset).checked() == mut_stats.descs[7].offset);
+                        bsl::ut_check(bsl::string_view{"halt_polls"} == mut_stats.descs[8].name);
+                        bsl::ut_check(halt_polls == mut_stats.descs[8].offset);
+                        bsl::ut_check(
+                            (halt_polls + slots_offset).checked() == mut_stats.descs[11].offset);
+                        bsl::ut_check(
+                            bsl::string_view{"fpu_saves_restores"} == mut_stats.descs[12].name);
+                        bsl::ut_check(fpu == mut_stats.descs[12].offset);
+                        bsl::ut_check(
+                            (fpu + slots_offset).checked() == mut_stats.descs[15].offset);
+                    };
+                };
+            };
+        };
+
+        return fini_tests();
+    }
+}
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
@@ -0,0 +1,128 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/shim_trace_disable.h"
+#include "g_mut_trace_rings.h"
+#include "shim_trace_enable.h"
+
+#include <helpers.hpp>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                g_mut_hypervisor_detected = true;
+                g_mut_platform_num_online_cpus = 1U;
+                g_mut_hndl = MV_HANDLE_VAL;
+                g_mut_platform_alloc_fails = {};
+                g_mut_mv_pp_op_set_trace_gpa = {};
+                bsl::ut_required_step(SHIM_SUCCESS == shim_trace_enable());
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_pp_op_clr_trace_gpa = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_trace_disable();
+                        bsl::ut_check(nullptr == g_mut_trace_rings[0]);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"not enabled"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = true;
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_hndl = MV_HANDLE_VAL;
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_trace_disable();
+                        bsl::ut_check(nullptr == g_mut_trace_rings[0]);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid handle"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = true;
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_hndl = MV_INVALID_HANDLE;
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_trace_disable();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"hypervisor not detected"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                g_mut_hypervisor_detected = true;
+                g_mut_platform_num_online_cpus = 1U;
+                g_mut_hndl = MV_HANDLE_VAL;
+                g_mut_platform_alloc_fails = {};
+                g_mut_mv_pp_op_set_trace_gpa = {};
+                bsl::ut_required_step(SHIM_SUCCESS == shim_trace_enable());
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_hypervisor_detected = false;
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_trace_disable();
+                        bsl::ut_check(nullptr == g_mut_trace_rings[0]);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
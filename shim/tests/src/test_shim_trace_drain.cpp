@@ -0,0 +1,179 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/shim_trace_drain.h"
+#include "g_mut_trace_rings.h"
+#include "mv_trace_t.h"
+
+#include <helpers.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"empty ring"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                mv_trace_t mut_ring{};
+                constexpr auto max{4_u64};
+                bsl::array<mv_trace_entry_t, max.get()> mut_entries{};
+                bsl::uint64 mut_lost{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_trace_rings[0] = &mut_ring;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            0_u64 == shim_trace_drain(mut_entries.data(), max.get(), &mut_lost));
+                        bsl::ut_check(0_u64 == mut_lost);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_trace_rings[0] = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"no rings"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                constexpr auto max{4_u64};
+                bsl::array<mv_trace_entry_t, max.get()> mut_entries{};
+                bsl::uint64 mut_lost{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_trace_rings[0] = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            0_u64 == shim_trace_drain(mut_entries.data(), max.get(), &mut_lost));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"drains entries and lost count"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                mv_trace_t mut_ring{};
+                constexpr auto max{4_u64};
+                bsl::array<mv_trace_entry_t, max.get()> mut_entries{};
+                bsl::uint64 mut_lost{};
+                bsl::ut_when{} = [&]() noexcept {
+                    constexpr auto rip{0x42_u64};
+                    constexpr auto lost{3_u64};
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_trace_rings[0] = &mut_ring;
+                    mut_ring.head = 2_u64.get();
+                    mut_ring.lost = lost.get();
+                    mut_ring.entries[1].rip = rip.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            2_u64 == shim_trace_drain(mut_entries.data(), max.get(), &mut_lost));
+                        bsl::ut_check(rip == mut_entries.at_if(1_idx)->rip);
+                        bsl::ut_check(2_u64 == mut_ring.tail);
+                        bsl::ut_check(lost == mut_lost);
+                        bsl::ut_check(lost == mut_ring.lost_seen);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_trace_rings[0] = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"max limits the entries"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                mv_trace_t mut_ring{};
+                constexpr auto max{1_u64};
+                bsl::array<mv_trace_entry_t, max.get()> mut_entries{};
+                bsl::uint64 mut_lost{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_trace_rings[0] = &mut_ring;
+                    mut_ring.head = 2_u64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            1_u64 == shim_trace_drain(mut_entries.data(), max.get(), &mut_lost));
+                        bsl::ut_check(1_u64 == mut_ring.tail);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_trace_rings[0] = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"ring wraps"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                mv_trace_t mut_ring{};
+                constexpr auto max{4_u64};
+                bsl::array<mv_trace_entry_t, max.get()> mut_entries{};
+                bsl::uint64 mut_lost{};
+                bsl::ut_when{} = [&]() noexcept {
+                    constexpr auto rip{0x42_u64};
+                    g_mut_platform_num_online_cpus = 1U;
+                    g_mut_trace_rings[0] = &mut_ring;
+                    mut_ring.tail = MV_TRACE_NUM_ENTRIES;
+                    mut_ring.head = MV_TRACE_NUM_ENTRIES + 1U;
+                    mut_ring.entries[0].rip = rip.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            1_u64 == shim_trace_drain(mut_entries.data(), max.get(), &mut_lost));
+                        bsl::ut_check(rip == mut_entries.at_if(0_idx)->rip);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_trace_rings[0] = {};
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
@@ -0,0 +1,159 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/shim_vcpu_cache_fill.h"
+
+#include <helpers.hpp>
+#include <shim_vcpu_t.h>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    constexpr auto VAL64{42_u64};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        init_tests();
+        constexpr auto handle{&shim_vcpu_cache_fill};
+
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = VAL64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu, SHIM_VCPU_CACHE_ALL));
+                        bsl::ut_check(SHIM_VCPU_CACHE_ALL == mut_vcpu.cache_valid);
+                        bsl::ut_check(VAL64 == mut_vcpu.regs.rax);
+                        bsl::ut_check(VAL64 == mut_vcpu.regs.rip);
+                        bsl::ut_check(VAL64 == mut_vcpu.sregs.cr0);
+                        bsl::ut_check(VAL64 == mut_vcpu.sregs.efer);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_val = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"only fills the groups requested"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_val = VAL64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu, SHIM_VCPU_CACHE_REGS));
+                        bsl::ut_check(SHIM_VCPU_CACHE_REGS == mut_vcpu.cache_valid);
+                        bsl::ut_check(VAL64 == mut_vcpu.regs.rax);
+                        bsl::ut_check(bsl::safe_u64::magic_0() == mut_vcpu.sregs.cr0);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_val = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"cached groups do not call MicroV"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vcpu.cache_valid = SHIM_VCPU_CACHE_ALL;
+                    mut_vcpu.regs.rax = VAL64.get();
+                    g_mut_mv_vs_op_reg_get_list = MV_STATUS_FAILURE_UNKNOWN;
+                    g_mut_mv_vs_op_msr_get_list = MV_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_SUCCESS == handle(&mut_vcpu, SHIM_VCPU_CACHE_ALL));
+                        bsl::ut_check(VAL64 == mut_vcpu.regs.rax);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vs_op_reg_get_list = {};
+                        g_mut_mv_vs_op_msr_get_list = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_vcpu_kvm_get_regs fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_reg_get_list = MV_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu, SHIM_VCPU_CACHE_REGS));
+                        bsl::ut_check(bsl::safe_u64::magic_0() == mut_vcpu.cache_valid);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vs_op_reg_get_list = {};
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_vcpu_kvm_get_sregs fails"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vcpu_t mut_vcpu{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_mv_vs_op_msr_get_list = MV_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(SHIM_FAILURE == handle(&mut_vcpu, SHIM_VCPU_CACHE_ALL));
+                        bsl::ut_check(SHIM_VCPU_CACHE_REGS == mut_vcpu.cache_valid);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mv_vs_op_msr_get_list = {};
+                    };
+                };
+            };
+        };
+
+        return fini_tests();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
@@ -0,0 +1,105 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/shim_vm_kick.h"
+
+#include <helpers.hpp>
+#include <mv_types.h>
+#include <shim_vm_t.h>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace shim
+{
+    /// @brief defines the thread used by the tests
+    constexpr auto THREAD{42_u64};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        init_tests();
+
+        bsl::ut_scenario{"kick with no vcpus that ran"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_platform_kicked = {};
+                    g_mut_platform_waitq_woken = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_vm_kick(&mut_vm);
+                        bsl::ut_check(g_mut_platform_kicked.is_zero());
+                        bsl::ut_check(g_mut_platform_waitq_woken.is_zero());
+                        bsl::ut_check(0U == mut_vm.vcpus[0].halt_wakeup);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"kick kicks and wakes the vcpus that ran"} = []() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                shim_vm_t mut_vm{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm.vcpus[1].thread = THREAD.get();
+                    g_mut_platform_kicked = {};
+                    g_mut_platform_waitq_woken = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        shim_vm_kick(&mut_vm);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_platform_kicked);
+                        bsl::ut_check(bsl::safe_u64::magic_1() == g_mut_platform_waitq_woken);
+                        bsl::ut_check(0U == mut_vm.vcpus[0].halt_wakeup);
+                        bsl::ut_check(1U == mut_vm.vcpus[1].halt_wakeup);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return shim::tests();
+}
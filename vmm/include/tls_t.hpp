@@ -56,6 +56,9 @@ namespace microv
         /// @brief stores the ID of the parent VS
         bsl::safe_u16 parent_vsid;
 
+        /// @brief stores the ID of the VS whose extended state is loaded
+        bsl::safe_u16 fpu_vsid;
+
         /// @brief tells the VMExit handler that we are in a vmcall
         bool handling_vmcall;
     };
@@ -48,20 +48,25 @@ namespace microv
         /// @brief stores the SPA of the IO permissions map for the root VM
         bsl::safe_u64 root_iopm_spa;
 
-        /// @brief stores the IO permissions map for guest VMs
-        bsl::span<bsl::uint8> guest_iopm;
-        /// @brief stores the SPA of the IO permissions map for guest VMs
-        bsl::safe_u64 guest_iopm_spa;
-
         /// @brief stores the MSR permissions map for root the VM
         bsl::span<bsl::uint8> root_msrpm;
         /// @brief stores the SPA of the MSR permissions map for root the VM
         bsl::safe_u64 root_msrpm_spa;
 
-        /// @brief stores the MSR permissions map for guest VMs
-        bsl::span<bsl::uint8> guest_msrpm;
-        /// @brief stores the SPA of the MSR permissions map for guest VMs
-        bsl::safe_u64 guest_msrpm_spa;
+        /// @brief stores the number of bytes needed to store a VS's xsave region
+        bsl::safe_u64 xsave_size;
+        /// @brief stores true if XSAVEOPT is supported, false otherwise
+        bool xsaveopt_supported;
+
+        /// @brief stores true if the CPU supports AVIC, false otherwise
+        bool avic_supported;
+        /// @brief stores the SPA of the page mapped at the guest APIC BAR (0 without AVIC)
+        bsl::safe_u64 apic_access_spa;
+
+        /// @brief stores true if the CPU has a PAUSE filter with a threshold, false otherwise
+        bool pause_filter_supported;
+        /// @brief stores true if the CPU supports TSC scaling, false otherwise
+        bool tsc_scaling_supported;
     };
 }
 
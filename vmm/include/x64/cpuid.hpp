@@ -34,6 +34,12 @@ namespace microv
     constexpr auto CPUID_FN0000_0000{0x00000000_u32};
     /// @brief the feature information CPUID
     constexpr auto CPUID_FN0000_0001{0x00000001_u32};
+    /// @brief the hypervisor vendor-id and largest hypervisor function CPUID
+    constexpr auto CPUID_FN4000_0000{0x40000000_u32};
+    /// @brief the KVM paravirtual features CPUID
+    constexpr auto CPUID_FN4000_0001{0x40000001_u32};
+    /// @brief the TSC and LAPIC bus frequency CPUID
+    constexpr auto CPUID_FN4000_0010{0x40000010_u32};
     /// @brief the largest extended function CPUID
     constexpr auto CPUID_FN8000_0000{0x80000000_u32};
     /// @brief the extended feature bits
@@ -55,6 +61,27 @@ namespace microv
     constexpr auto CPUID_FN8000_0001_ECX{0x00000121_u64};
     /// @brief the EDX mask for CPUID Fn8000_0001
     constexpr auto CPUID_FN8000_0001_EDX{0x24100800_u64};
+
+    /// @brief the EBX of CPUID Fn4000_0000 ("KVMK")
+    constexpr auto CPUID_FN4000_0000_EBX_KVM{0x4B4D564B_u64};
+    /// @brief the ECX of CPUID Fn4000_0000 ("VMKV")
+    constexpr auto CPUID_FN4000_0000_ECX_KVM{0x564B4D56_u64};
+    /// @brief the EDX of CPUID Fn4000_0000 ("M")
+    constexpr auto CPUID_FN4000_0000_EDX_KVM{0x0000004D_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for MSR_KVM_SYSTEM_TIME_NEW/WALL_CLOCK_NEW
+    constexpr auto CPUID_FN4000_0001_EAX_CLOCKSOURCE2{0x00000008_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for MSR_KVM_STEAL_TIME
+    constexpr auto CPUID_FN4000_0001_EAX_STEAL_TIME{0x00000020_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for MSR_KVM_PV_EOI_EN
+    constexpr auto CPUID_FN4000_0001_EAX_PV_EOI{0x00000040_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for KVM_HC_KICK_CPU
+    constexpr auto CPUID_FN4000_0001_EAX_PV_UNHALT{0x00000080_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for KVM_VCPU_FLUSH_TLB
+    constexpr auto CPUID_FN4000_0001_EAX_PV_TLB_FLUSH{0x00000200_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for KVM_HC_SEND_IPI
+    constexpr auto CPUID_FN4000_0001_EAX_PV_SEND_IPI{0x00000800_u64};
+    /// @brief CPUID Fn4000_0001 EAX bit for PVCLOCK_TSC_STABLE_BIT
+    constexpr auto CPUID_FN4000_0001_EAX_CLOCKSOURCE_STABLE{0x01000000_u64};
 }
 
 #endif
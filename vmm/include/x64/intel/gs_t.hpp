@@ -25,11 +25,15 @@
 #ifndef GS_T_HPP
 #define GS_T_HPP
 
+#include <bsl/convert.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 
 namespace microv
 {
+    /// @brief stores the size of the IO permissions map (bitmaps A and B)
+    constexpr auto IOPM_SIZE{0x2000_umx};
+
     /// @class microv::gs_t
     ///
     /// <!-- description -->
@@ -46,24 +50,32 @@ namespace microv
         /// @brief stores the SPA of the IO permissions map B for the root VM
         bsl::safe_u64 root_iopm_b_spa;
 
-        /// @brief stores the IO permissions map A for guest VMs
-        bsl::span<bsl::uint8> guest_iopm_a;
-        /// @brief stores the SPA of the IO permissions map A for guest VMs
-        bsl::safe_u64 guest_iopm_a_spa;
-        /// @brief stores the IO permissions map B for guest VMs
-        bsl::span<bsl::uint8> guest_iopm_b;
-        /// @brief stores the SPA of the IO permissions map B for guest VMs
-        bsl::safe_u64 guest_iopm_b_spa;
-
         /// @brief stores the MSR permissions map for root the VM
         bsl::span<bsl::uint8> root_msrpm;
         /// @brief stores the SPA of the MSR permissions map for root the VM
         bsl::safe_u64 root_msrpm_spa;
 
-        /// @brief stores the MSR permissions map for guest VMs
-        bsl::span<bsl::uint8> guest_msrpm;
-        /// @brief stores the SPA of the MSR permissions map for guest VMs
-        bsl::safe_u64 guest_msrpm_spa;
+        /// @brief stores the number of bytes needed to store a VS's xsave region
+        bsl::safe_u64 xsave_size;
+        /// @brief stores true if XSAVEOPT is supported, false otherwise
+        bool xsaveopt_supported;
+
+        /// @brief stores true if the CPU can shadow the TPR, false otherwise
+        bool tpr_shadow_supported;
+        /// @brief stores true if the CPU supports APICv, false otherwise
+        bool apicv_supported;
+        /// @brief stores the SPA of the APIC-access page (0 without APICv)
+        bsl::safe_u64 apic_access_spa;
+
+        /// @brief stores true if the CPU has a VMX-preemption timer, false otherwise
+        bool preemption_timer_supported;
+        /// @brief stores the rate of the VMX-preemption timer (a TSC shift)
+        bsl::safe_u64 preemption_timer_rate;
+
+        /// @brief stores true if the CPU supports PAUSE-loop exiting, false otherwise
+        bool ple_supported;
+        /// @brief stores true if the CPU supports TSC scaling, false otherwise
+        bool tsc_scaling_supported;
     };
 }
 
@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IO_ACCESS_T_HPP
+#define IO_ACCESS_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Describes a port IO access (IN, OUT, INS or OUTS) as
+    ///     reported by hardware, as well as the portion of a string
+    ///     instruction that a single exit to the root VM transfers.
+    ///
+    struct io_access_t final
+    {
+        /// @brief stores the port being accessed
+        bsl::safe_u64 port;
+        /// @brief stores the size of each element in bytes (1, 2 or 4)
+        bsl::safe_u64 bytes;
+        /// @brief stores the address size of a string instruction in bytes
+        bsl::safe_u64 addr_bytes;
+        /// @brief stores the number of elements transferred by this exit
+        bsl::safe_u64 count;
+        /// @brief stores the SPA of the first element of a string access
+        bsl::safe_u64 spa;
+        /// @brief stores true if the access is an IN or INS
+        bool in;
+        /// @brief stores true if the access is an INS or OUTS
+        bool string;
+        /// @brief stores true if the access has a REP prefix
+        bool rep;
+        /// @brief stores true if RFLAGS.DF is set (i.e., addresses decrement)
+        bool down;
+    };
+}
+
+#endif
@@ -0,0 +1,72 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef KVM_PARA_HPP
+#define KVM_PARA_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the enable bit of MSR_KVM_STEAL_TIME
+    constexpr auto KVM_STEAL_TIME_ENABLE{0x1_u64};
+    /// @brief defines the bits of MSR_KVM_STEAL_TIME below the 64 byte aligned GPA
+    constexpr auto KVM_STEAL_TIME_ALIGN_MASK{0x3F_u64};
+    /// @brief defines the reserved bits of MSR_KVM_STEAL_TIME
+    constexpr auto KVM_STEAL_TIME_RSVD{0x3E_u64};
+    /// @brief defines the offset of the preempted field of a kvm_steal_time
+    constexpr auto KVM_STEAL_TIME_PREEMPTED_OFFSET{0x10_u64};
+
+    /// @brief tells the guest that the VS is not running (kvm_steal_time.preempted)
+    constexpr auto KVM_VCPU_PREEMPTED{0x01_u64};
+    /// @brief asks for the VS's TLB to be flushed before it runs again
+    constexpr auto KVM_VCPU_FLUSH_TLB{0x02_u64};
+
+    /// @brief defines the enable bit of MSR_KVM_PV_EOI_EN
+    constexpr auto KVM_PV_EOI_ENABLE{0x1_u64};
+    /// @brief defines the bits of MSR_KVM_PV_EOI_EN below the 4 byte aligned GPA
+    constexpr auto KVM_PV_EOI_ALIGN_MASK{0x3_u64};
+    /// @brief defines the reserved bits of MSR_KVM_PV_EOI_EN
+    constexpr auto KVM_PV_EOI_RSVD{0x2_u64};
+    /// @brief tells the guest that it can skip the EOI of the in-service vector
+    constexpr auto KVM_PV_EOI_PENDING{0x1_u64};
+    /// @brief defines the size of the guest's PV EOI word
+    constexpr auto KVM_PV_EOI_SIZE{0x4_u64};
+
+    /// @brief defines the KVM_HC_KICK_CPU hypercall (wake a halted VS)
+    constexpr auto KVM_HC_KICK_CPU{5_u64};
+    /// @brief defines the KVM_HC_SEND_IPI hypercall (fixed/NMI IPI to a bitmap of APIC IDs)
+    constexpr auto KVM_HC_SEND_IPI{10_u64};
+    /// @brief defines the value returned by an unknown KVM hypercall (-KVM_ENOSYS)
+    constexpr auto KVM_HC_ENOSYS{0xFFFFFFFFFFFFFC18_u64};
+    /// @brief defines the value returned by a KVM hypercall from outside of ring 0 (-KVM_EPERM)
+    constexpr auto KVM_HC_EPERM{0xFFFFFFFFFFFFFFFF_u64};
+    /// @brief defines the value returned by an invalid KVM hypercall (-KVM_EINVAL)
+    constexpr auto KVM_HC_EINVAL{0xFFFFFFFFFFFFFFEA_u64};
+    /// @brief defines the number of APIC IDs covered by KVM_HC_SEND_IPI's bitmap
+    constexpr auto KVM_HC_SEND_IPI_BITS{128_u64};
+}
+
+#endif
@@ -0,0 +1,62 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MMIO_ACCESS_T_HPP
+#define MMIO_ACCESS_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Stores the results of decoding an instruction that
+    ///     generated an MMIO access. Only simple data moves between
+    ///     memory and a general purpose register (or an immediate) are
+    ///     described by this structure.
+    ///
+    struct mmio_access_t final
+    {
+        /// @brief stores the length of the instruction in bytes
+        bsl::safe_u64 len;
+        /// @brief stores the number of bytes read/written from/to memory
+        bsl::safe_u64 bytes;
+        /// @brief stores the number of bytes written to reg on a read
+        bsl::safe_u64 reg_bytes;
+        /// @brief stores the x86 encoding of the GPR (i.e., rax == 0)
+        bsl::safe_u64 reg;
+        /// @brief stores the immediate (only valid if has_imm is true)
+        bsl::safe_u64 imm;
+        /// @brief stores true if reg refers to AH, CH, DH or BH
+        bool reg_high8;
+        /// @brief stores true if the access writes to memory
+        bool write;
+        /// @brief stores true if the data to write comes from imm
+        bool has_imm;
+        /// @brief stores true if a read must be sign extended into reg
+        bool sign_extend;
+    };
+}
+
+#endif
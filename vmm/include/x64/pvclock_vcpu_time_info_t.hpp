@@ -0,0 +1,87 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef PVCLOCK_VCPU_TIME_INFO_T_HPP
+#define PVCLOCK_VCPU_TIME_INFO_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the enable bit of MSR_KVM_SYSTEM_TIME_NEW
+    constexpr auto PVCLOCK_SYSTEM_TIME_ENABLE{0x1_u64};
+    /// @brief defines the size of a pvclock_vcpu_time_info in guest memory
+    constexpr auto PVCLOCK_VCPU_TIME_INFO_SIZE{0x20_u64};
+    /// @brief defines the offset of the version field
+    constexpr auto PVCLOCK_VERSION_OFFSET{0x00_u64};
+    /// @brief defines the offset of the tsc_timestamp field
+    constexpr auto PVCLOCK_TSC_TIMESTAMP_OFFSET{0x08_u64};
+    /// @brief defines the offset of the system_time field
+    constexpr auto PVCLOCK_SYSTEM_TIME_OFFSET{0x10_u64};
+    /// @brief defines the offset of the tsc_to_system_mul field
+    constexpr auto PVCLOCK_TSC_TO_SYSTEM_MUL_OFFSET{0x18_u64};
+    /// @brief defines the offset of the tsc_shift field
+    constexpr auto PVCLOCK_TSC_SHIFT_OFFSET{0x1C_u64};
+    /// @brief defines the offset of the flags field
+    constexpr auto PVCLOCK_FLAGS_OFFSET{0x1D_u64};
+
+    /// @brief tells the guest that the TSC is synchronized across VSs
+    constexpr auto PVCLOCK_TSC_STABLE_BIT{0x01_u64};
+    /// @brief tells the guest that software paused it (see mv_vs_op_kvmclock_ctrl)
+    constexpr auto PVCLOCK_GUEST_STOPPED{0x02_u64};
+
+    /// @brief defines the offset of the version field of a pvclock_wall_clock
+    constexpr auto PVCLOCK_WALL_VERSION_OFFSET{0x00_u64};
+    /// @brief defines the offset of the sec field of a pvclock_wall_clock
+    constexpr auto PVCLOCK_WALL_SEC_OFFSET{0x04_u64};
+    /// @brief defines the offset of the nsec field of a pvclock_wall_clock
+    constexpr auto PVCLOCK_WALL_NSEC_OFFSET{0x08_u64};
+    /// @brief defines the size of a pvclock_wall_clock in guest memory
+    constexpr auto PVCLOCK_WALL_CLOCK_SIZE{0x0C_u64};
+
+    /// <!-- description -->
+    ///   @brief Describes the contents of a VS's pvclock_vcpu_time_info
+    ///     (the page a guest registers with MSR_KVM_SYSTEM_TIME_NEW).
+    ///     The guest computes the current kvmclock in nanoseconds as
+    ///     system_time + scale(TSC - tsc_timestamp, mul, shift).
+    ///
+    struct pvclock_vcpu_time_info_t final
+    {
+        /// @brief stores the version (odd while the VMM is writing)
+        bsl::safe_u64 version;
+        /// @brief stores the guest's TSC when system_time was sampled
+        bsl::safe_u64 tsc_timestamp;
+        /// @brief stores the kvmclock in nanoseconds at tsc_timestamp
+        bsl::safe_u64 system_time;
+        /// @brief stores the 32 bit TSC to nanoseconds multiplier
+        bsl::safe_u64 tsc_to_system_mul;
+        /// @brief stores the 8 bit two's complement TSC shift
+        bsl::safe_u64 tsc_shift;
+        /// @brief stores the PVCLOCK_ flags
+        bsl::safe_u64 flags;
+    };
+}
+
+#endif
@@ -0,0 +1,151 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <integration_utils.hpp>
+#include <mv_constants.hpp>
+#include <mv_hypercall_impl.hpp>
+#include <mv_hypercall_t.hpp>
+#include <mv_stats_t.hpp>
+#include <mv_types.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/enable_color.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace hypercall
+{
+    /// @brief stores the slot of the mv_debug_op_stats_get hypercall
+    constexpr auto STATS_GET_SLOT{
+        (((MV_DEBUG_OP_VAL & MV_HYPERCALL_OPCODE_NOSIG_MASK) >> 16_u64)
+         << MV_STATS_HYPERCALL_OPCODE_SHIFT) |
+        MV_DEBUG_OP_STATS_GET_IDX_VAL};
+
+    /// <!-- description -->
+    ///   @brief Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        mv_status_t mut_ret{};
+
+        integration::initialize_globals();
+        auto *const pmut_stats0{to_0<mv_stats_t>()};
+
+        // invalid VSID
+        mut_ret = mv_debug_op_stats_get_impl(
+            hndl.get(), MV_INVALID_ID.get(), MV_STATS_TYPE_VS_EXITS.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VSID out of range
+        auto const oor{bsl::to_u16(HYPERVISOR_MAX_VSS + bsl::safe_u64::magic_1()).checked()};
+        mut_ret = mv_debug_op_stats_get_impl(hndl.get(), oor.get(), MV_STATS_TYPE_VS_EXITS.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VSID not yet created
+        auto const nyc{bsl::to_u16(HYPERVISOR_MAX_VSS - bsl::safe_u64::magic_1()).checked()};
+        mut_ret = mv_debug_op_stats_get_impl(hndl.get(), nyc.get(), MV_STATS_TYPE_VS_EXITS.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // invalid PPID
+        mut_ret = mv_debug_op_stats_get_impl(
+            hndl.get(), MV_INVALID_ID.get(), MV_STATS_TYPE_PP_EXITS.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // invalid type
+        mut_ret = mv_debug_op_stats_get_impl(hndl.get(), self.get(), 0xFFFFFFFFFFFFFFFFU);
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // No shared paged
+        mut_ret = mv_debug_op_stats_get_impl(hndl.get(), self.get(), MV_STATS_TYPE_VS_EXITS.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        integration::initialize_shared_pages();
+
+        // Statistics only go up and count the hypercalls made
+        {
+            integration::set_affinity(core0);
+
+            integration::verify(mut_hvc.mv_debug_op_stats_get(self, MV_STATS_TYPE_PP_HYPERCALLS));
+            auto const count0{bsl::to_u64(pmut_stats0->count)};
+            auto const slot0{bsl::to_u64(*pmut_stats0->slots.at_if(bsl::to_idx(STATS_GET_SLOT)))};
+
+            integration::verify(mut_hvc.mv_debug_op_stats_get(self, MV_STATS_TYPE_PP_HYPERCALLS));
+            auto const count1{bsl::to_u64(pmut_stats0->count)};
+            auto const slot1{bsl::to_u64(*pmut_stats0->slots.at_if(bsl::to_idx(STATS_GET_SLOT)))};
+
+            integration::verify(count1 > count0);
+            integration::verify(slot1 > slot0);
+
+            integration::verify(mut_hvc.mv_debug_op_stats_get(self, MV_STATS_TYPE_VS_EXITS));
+            integration::verify(bsl::to_u64(pmut_stats0->count).is_pos());
+            integration::verify(bsl::to_u64(pmut_stats0->cycles).is_pos());
+        }
+
+        // A new VS starts with no statistics
+        {
+            auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+            auto const vpid{mut_hvc.mv_vp_op_create_vp(vmid)};
+            auto const vsid{mut_hvc.mv_vs_op_create_vs(vpid)};
+
+            integration::verify(vmid.is_valid_and_checked());
+            integration::verify(vpid.is_valid_and_checked());
+            integration::verify(vsid.is_valid_and_checked());
+
+            integration::verify(mut_hvc.mv_debug_op_stats_get(vsid, MV_STATS_TYPE_VS_EXITS));
+            integration::verify(bsl::to_u64(pmut_stats0->count).is_zero());
+            integration::verify(mut_hvc.mv_debug_op_stats_get(vsid, MV_STATS_TYPE_VS_HYPERCALLS));
+            integration::verify(bsl::to_u64(pmut_stats0->count).is_zero());
+            integration::verify(mut_hvc.mv_debug_op_stats_get(vsid, MV_STATS_TYPE_VS_HALT_POLLS));
+            integration::verify(bsl::to_u64(pmut_stats0->count).is_zero());
+            integration::verify(mut_hvc.mv_debug_op_stats_get(vsid, MV_STATS_TYPE_VS_FPU));
+            integration::verify(bsl::to_u64(pmut_stats0->count).is_zero());
+
+            integration::verify(mut_hvc.mv_vs_op_destroy_vs(vsid));
+            integration::verify(mut_hvc.mv_vp_op_destroy_vp(vpid));
+            integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+        }
+
+        return bsl::exit_success;
+    }
+}
+
+/// <!-- description -->
+///   @brief Provides the main entry point for this application.
+///
+/// <!-- inputs/outputs -->
+///   @return bsl::exit_success on success, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return hypercall::tests();
+}
@@ -26,7 +26,6 @@
 #include <mv_exit_io_t.hpp>
 #include <mv_exit_reason_t.hpp>
 #include <mv_hypercall_t.hpp>
-#include <mv_reg_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
@@ -92,47 +91,14 @@ namespace hypercall
             ///   could be attempting to read from an emulated configuration
             ///   space for PCI, or something else. Just depends on the port.
             ///
-            /// - The guest VM is expecting to get it's value in AX. But this
-            ///   is not always the case. All possible forms of IN/OUT should
-            ///   be tested here. But to keep it simple, for now, we know that
-            ///   the test wants AX, so we store the value in AX.
-            ///
-            /// - To give the guest it's value in AX, we need to set the
-            ///   guest's AX with the value of our fake port. We only have
-            ///   a way to set RAX, not AX. So we need to first, read the
-            ///   value of RAX, change the AX portion, and then write it
-            ///   back. This makes sure that only AX is changed, and that
-            ///   the upper bits of RAX are left unchanged. Thankfully, we
-            ///   set data to the value of RAX for both IN and OUT. So we
-            ///   can just read the value of RAX from the data field.
-            ///
-
-            constexpr auto ax_mask{0xFFFFFFFFFFFF0000_u64};
-            bsl::safe_u64 mut_rax{pmut_exit_io->data};
-            mut_rax &= ax_mask;
-            mut_rax |= bsl::to_u64(mut_port10);
-
-            /// NOTE:
-            /// - No need to use checked() or .is_poisoned() here because
-            ///   binary arithmetic will never overflow, so the safe
-            ///   integral will not trigger a requirement to check the
-            ///   math above. It's only needed when you do +, -, *, / and %
-            ///   for the most part. I have a really good set of notes in
-            ///   the code found here:
-            ///   https://github.com/Bareflank/bsl/blob/master/include/bsl/safe_integral.hpp#L75
-            ///
-            /// - Ok, now we have the value of RAX that the guest should
-            ///   have. The next step is to give this to the guest. For
-            ///   now, I will just write it using mv_vs_op_reg_set. But,
-            ///   what really should happen is:
-            ///   - implement mv_run_t. it is defined in the spec
-            ///   - use to_0<mv_run_t>() to get a pointer to the shared page
-            ///   - set reg0 to the value of rax
-            ///   - implement support for mv_run_t on run so that registers
-            ///     can be set when we run instead of needing two hypercalls
+            /// - To give the guest it's value, we place it in the data field.
+            ///   MicroV completes the IN the next time the guest is run,
+            ///   writing the value to AL/AX/EAX (depending on the size of
+            ///   the IN) and leaving the rest of RAX alone, so there is no
+            ///   need to use mv_vs_op_reg_set here.
             ///
 
-            integration::verify(mut_hvc.mv_vs_op_reg_set(vsid, mv_reg_t::mv_reg_t_rax, mut_rax));
+            pmut_exit_io->data = bsl::to_u64(mut_port10).get();
 
             /// NOTE:
             /// - Now, all we need to do is run the guest again and wait for
@@ -0,0 +1,97 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <integration_utils.hpp>
+#include <mv_constants.hpp>
+#include <mv_hypercall_impl.hpp>
+#include <mv_hypercall_t.hpp>
+#include <mv_types.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/enable_color.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace hypercall
+{
+    /// <!-- description -->
+    ///   @brief Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        constexpr auto ns{0x42000000_u64};
+        constexpr auto realtime{0x1000000000000000_u64};
+
+        mv_status_t mut_ret{};
+        bsl::safe_u16 mut_vmid{};
+
+        integration::initialize_globals();
+        auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+
+        // invalid VMID
+        mut_vmid = MV_INVALID_ID;
+        mut_ret = mv_vm_op_clock_set_impl(hndl.get(), mut_vmid.get(), ns.get(), realtime.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VMID out of range
+        mut_vmid = bsl::to_u16(HYPERVISOR_MAX_VMS + bsl::safe_u64::magic_1()).checked();
+        mut_ret = mv_vm_op_clock_set_impl(hndl.get(), mut_vmid.get(), ns.get(), realtime.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VMID cannot be the root VM
+        mut_vmid = self;
+        mut_ret = mv_vm_op_clock_set_impl(hndl.get(), mut_vmid.get(), ns.get(), realtime.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // the kvmclock continues from the value that was set
+        integration::verify(mut_hvc.mv_vm_op_clock_set(vmid, ns, realtime));
+        integration::verify(mut_hvc.mv_vm_op_clock_get(vmid) >= ns);
+
+        integration::verify(mut_hvc.mv_vm_op_clock_set(vmid, {}, {}));
+        integration::verify(mut_hvc.mv_vm_op_clock_get(vmid) < ns);
+
+        integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+
+        return bsl::exit_success;
+    }
+}
+
+/// <!-- description -->
+///   @brief Provides the main entry point for this application.
+///
+/// <!-- inputs/outputs -->
+///   @return bsl::exit_success on success, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return hypercall::tests();
+}
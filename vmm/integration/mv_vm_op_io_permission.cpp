@@ -0,0 +1,114 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <integration_utils.hpp>
+#include <mv_constants.hpp>
+#include <mv_hypercall_impl.hpp>
+#include <mv_hypercall_t.hpp>
+#include <mv_types.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/enable_color.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace hypercall
+{
+    /// <!-- description -->
+    ///   @brief Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        constexpr auto port{0x80_u16};
+        constexpr auto num{1_u32};
+        constexpr auto all_ports{0x10000_u32};
+        constexpr auto reg2{
+            ((bsl::to_u64(num) << MV_IO_PERM_NUM_PORTS_SHIFT) | bsl::to_u64(port)).checked()};
+        constexpr auto rsvd{0x0000000000010000_u64};
+        constexpr auto type{MV_IO_PERM_PASSTHROUGH};
+        constexpr auto bad_type{(MV_IO_PERM_EMULATE + bsl::safe_u64::magic_1()).checked()};
+
+        mv_status_t mut_ret{};
+        bsl::safe_u16 mut_vmid{};
+
+        integration::initialize_globals();
+        auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+
+        // invalid VMID
+        mut_vmid = MV_INVALID_ID;
+        mut_ret = mv_vm_op_io_permission_impl(hndl.get(), mut_vmid.get(), reg2.get(), type.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VMID out of range
+        mut_vmid = bsl::to_u16(HYPERVISOR_MAX_VMS + bsl::safe_u64::magic_1()).checked();
+        mut_ret = mv_vm_op_io_permission_impl(hndl.get(), mut_vmid.get(), reg2.get(), type.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VMID cannot be the root VM
+        mut_vmid = self;
+        mut_ret = mv_vm_op_io_permission_impl(hndl.get(), mut_vmid.get(), reg2.get(), type.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // reserved bits in REG2 are set
+        mut_ret = mv_vm_op_io_permission_impl(
+            hndl.get(), vmid.get(), (reg2 | rsvd).checked().get(), type.get());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // no ports
+        integration::verify(!mut_hvc.mv_vm_op_io_permission(vmid, port, {}, type));
+
+        // range goes past the last port
+        integration::verify(!mut_hvc.mv_vm_op_io_permission(vmid, port, all_ports, type));
+
+        // unknown type
+        integration::verify(!mut_hvc.mv_vm_op_io_permission(vmid, port, num, bad_type));
+
+        // success
+        integration::verify(mut_hvc.mv_vm_op_io_permission(vmid, port, num, type));
+        integration::verify(mut_hvc.mv_vm_op_io_permission(vmid, port, num, MV_IO_PERM_EMULATE));
+        integration::verify(mut_hvc.mv_vm_op_io_permission(vmid, {}, all_ports, MV_IO_PERM_EXIT));
+
+        integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+        return bsl::exit_success;
+    }
+}
+
+/// <!-- description -->
+///   @brief Provides the main entry point for this application.
+///
+/// <!-- inputs/outputs -->
+///   @return bsl::exit_success on success, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return hypercall::tests();
+}
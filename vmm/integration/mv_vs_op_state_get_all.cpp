@@ -0,0 +1,187 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <integration_utils.hpp>
+#include <mv_constants.hpp>
+#include <mv_hypercall_impl.hpp>
+#include <mv_hypercall_t.hpp>
+#include <mv_types.hpp>
+#include <mv_vs_state_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/enable_color.hpp>
+#include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace hypercall
+{
+    /// <!-- description -->
+    ///   @brief Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success. If a failure occurs,
+    ///     this function will exit early.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        mv_status_t mut_ret{};
+        bsl::safe_u64 mut_next{};
+
+        integration::initialize_globals();
+        auto *const pmut_state0{to_0<mv_vs_state_t>()};
+
+        // invalid VSID #1
+        mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), MV_INVALID_ID.get(), {}, mut_next.data());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // invalid VSID #2
+        mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), MV_SELF_ID.get(), {}, mut_next.data());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // invalid VSID #3
+        mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), vsid0.get(), {}, mut_next.data());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // invalid VSID #4
+        mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), vsid1.get(), {}, mut_next.data());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VSID out of range
+        auto const oor{bsl::to_u16(HYPERVISOR_MAX_VSS + bsl::safe_u64::magic_1()).checked()};
+        mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), oor.get(), {}, mut_next.data());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // VSID not yet created
+        auto const nyc{bsl::to_u16(HYPERVISOR_MAX_VSS - bsl::safe_u64::magic_1()).checked()};
+        mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), nyc.get(), {}, mut_next.data());
+        integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+        // No shared paged
+        {
+            auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+            auto const vpid{mut_hvc.mv_vp_op_create_vp(vmid)};
+            auto const vsid{mut_hvc.mv_vs_op_create_vs(vpid)};
+
+            integration::set_affinity(core0);
+            mut_ret = mv_vs_op_state_get_all_impl(hndl.get(), vsid.get(), {}, mut_next.data());
+            integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+            integration::verify(mut_hvc.mv_vs_op_destroy_vs(vsid));
+            integration::verify(mut_hvc.mv_vp_op_destroy_vp(vpid));
+            integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+        }
+
+        integration::initialize_shared_pages();
+
+        // Chunk out of range
+        {
+            auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+            auto const vpid{mut_hvc.mv_vp_op_create_vp(vmid)};
+            auto const vsid{mut_hvc.mv_vs_op_create_vs(vpid)};
+
+            auto const chunk{MV_VS_STATE_NUM_CHUNKS};
+            integration::set_affinity(core0);
+            mut_ret = mv_vs_op_state_get_all_impl(
+                hndl.get(), vsid.get(), chunk.get(), mut_next.data());
+            integration::verify(mut_ret != MV_STATUS_SUCCESS);
+
+            integration::verify(mut_hvc.mv_vs_op_destroy_vs(vsid));
+            integration::verify(mut_hvc.mv_vp_op_destroy_vp(vpid));
+            integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+        }
+
+        // Success test
+        {
+            auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+            auto const vpid{mut_hvc.mv_vp_op_create_vp(vmid)};
+            auto const vsid{mut_hvc.mv_vs_op_create_vs(vpid)};
+
+            integration::verify(vmid.is_valid_and_checked());
+            integration::verify(vpid.is_valid_and_checked());
+            integration::verify(vsid.is_valid_and_checked());
+
+            integration::set_affinity(core0);
+            mut_next = mut_hvc.mv_vs_op_state_get_all(vsid, MV_VS_STATE_CHUNK_CPU);
+            integration::verify(MV_VS_STATE_CHUNK_FPU == mut_next);
+
+            integration::verify(MV_VS_STATE_VERSION == pmut_state0->version);
+            integration::verify(MV_VS_STATE_NUM_CHUNKS == bsl::to_u64(pmut_state0->num_chunks));
+            integration::verify(bsl::to_u64(pmut_state0->num_regs).is_pos());
+            integration::verify(bsl::to_u64(pmut_state0->num_msrs).is_pos());
+
+            while (mut_next < MV_VS_STATE_NUM_CHUNKS) {
+                mut_next = mut_hvc.mv_vs_op_state_get_all(vsid, mut_next);
+                integration::verify(mut_next.is_valid_and_checked());
+            }
+
+            integration::verify(MV_VS_STATE_NUM_CHUNKS == mut_next);
+
+            integration::verify(mut_hvc.mv_vs_op_destroy_vs(vsid));
+            integration::verify(mut_hvc.mv_vp_op_destroy_vp(vpid));
+            integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+        }
+
+        // CPU affinity test
+        {
+            auto const vmid{mut_hvc.mv_vm_op_create_vm()};
+            auto const vpid{mut_hvc.mv_vp_op_create_vp(vmid)};
+            auto const vsid{mut_hvc.mv_vs_op_create_vs(vpid)};
+
+            integration::verify(vmid.is_valid_and_checked());
+            integration::verify(vpid.is_valid_and_checked());
+            integration::verify(vsid.is_valid_and_checked());
+
+            integration::set_affinity(core0);
+            mut_next = mut_hvc.mv_vs_op_state_get_all(vsid, MV_VS_STATE_CHUNK_CPU);
+            integration::verify(mut_next.is_valid_and_checked());
+            integration::set_affinity(core1);
+            mut_next = mut_hvc.mv_vs_op_state_get_all(vsid, MV_VS_STATE_CHUNK_CPU);
+            integration::verify(mut_next.is_valid_and_checked());
+            integration::set_affinity(core0);
+            mut_next = mut_hvc.mv_vs_op_state_get_all(vsid, MV_VS_STATE_CHUNK_CPU);
+            integration::verify(mut_next.is_valid_and_checked());
+
+            integration::verify(mut_hvc.mv_vs_op_destroy_vs(vsid));
+            integration::verify(mut_hvc.mv_vp_op_destroy_vp(vpid));
+            integration::verify(mut_hvc.mv_vm_op_destroy_vm(vmid));
+        }
+
+        return bsl::exit_success;
+    }
+}
+
+/// <!-- description -->
+///   @brief Provides the main entry point for this application.
+///
+/// <!-- inputs/outputs -->
+///   @return bsl::exit_success on success, bsl::exit_failure otherwise.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return hypercall::tests();
+}
@@ -105,7 +105,9 @@ namespace microv
             vpid,
             ppid,
             tsc_khz,
-            mut_vm_pool.slpt_spa(vmid))};
+            mut_vm_pool.slpt_spa(vmid),
+            mut_vm_pool.msrpm_spa(vmid),
+            mut_vm_pool.iopm_spa(vmid))};
 
         if (bsl::unlikely(vsid.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
@@ -114,7 +116,7 @@ namespace microv
 
         mut_vm_pool.set_active(mut_tls, vmid);
         mut_vp_pool.set_active(mut_tls, vpid);
-        mut_vs_pool.set_active(mut_tls, intrinsic, vsid);
+        mut_vs_pool.set_active(mut_tls, mut_sys, intrinsic, vsid);
 
         return mut_sys.bf_vs_op_run(vmid, vpid, vsid);
     }
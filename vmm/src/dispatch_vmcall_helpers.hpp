@@ -1736,23 +1736,54 @@ namespace microv
             return bsl::errc_failure;
         }
 
+        auto const flush_ret{mut_vs_pool.reg_cache_flush(mut_sys, vsid)};
+        if (bsl::unlikely(!flush_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return flush_ret;
+        }
+
+        /// NOTE:
+        /// - A HLT is only polled for the interrupts of the VM's emulated
+        ///   irqchip (timers, IOAPIC pins and IPIs) and PV kicks. If the
+        ///   VM has no irqchip, or the root VM queued the interrupt that
+        ///   woke the VS up itself, polling could not have seen the
+        ///   wakeup, so the poll window is not allowed to grow.
+        ///
+
+        bool mut_observable{};
+        if constexpr (MICROV_EMULATED_IRQCHIP) {
+            if (mut_vm_pool.irqchip_enabled(vmid)) {
+                mut_observable = !mut_vs_pool.interrupt_pending(vsid);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        mut_vs_pool.halt_poll_wakeup(intrinsic.rdtsc(), mut_observable, vsid);
+        mut_vm_pool.pv_unhalt(mut_tls, mut_vs_pool.apic_id(vsid), vmid);
+
         mut_tls.parent_vmid = mut_sys.bf_tls_vmid();
         mut_tls.parent_vpid = mut_sys.bf_tls_vpid();
         mut_tls.parent_vsid = mut_sys.bf_tls_vsid();
 
         mut_vm_pool.set_inactive(mut_tls, mut_tls.parent_vmid);
         mut_vp_pool.set_inactive(mut_tls, mut_tls.parent_vpid);
-        mut_vs_pool.set_inactive(mut_tls, intrinsic, mut_tls.parent_vsid);
+        mut_vs_pool.set_inactive(mut_tls, mut_sys, intrinsic, mut_tls.parent_vsid);
 
         bsl::expects(mut_sys.bf_vs_op_set_active(vmid, vpid, vsid));
 
         mut_vm_pool.set_active(mut_tls, vmid);
         mut_vp_pool.set_active(mut_tls, vpid);
-        mut_vs_pool.set_active(mut_tls, intrinsic, vsid);
+        mut_vs_pool.set_active(mut_tls, mut_sys, intrinsic, vsid);
 
         bsl::expects(mut_vs_pool.mp_state_set(
             mut_sys, hypercall::mv_mp_state_t::mv_mp_state_t_running, vsid));
 
+        auto const pause_gap{mut_vm_pool.pause_gap(vmid)};
+        auto const pause_window{mut_vm_pool.pause_window(vmid)};
+        bsl::expects(mut_vs_pool.pause_exiting_update(mut_sys, pause_gap, pause_window, vsid));
+
         return mut_sys.bf_vs_op_run_current();
     }
 
@@ -1869,7 +1900,7 @@ namespace microv
 
         mut_vm_pool.set_inactive(mut_tls, vmid);
         mut_vp_pool.set_inactive(mut_tls, vpid);
-        mut_vs_pool.set_inactive(mut_tls, intrinsic, vsid);
+        mut_vs_pool.set_inactive(mut_tls, mut_sys, intrinsic, vsid);
 
         if (advance_ip) {
             bsl::expects(mut_sys.bf_vs_op_advance_ip_and_set_active(
@@ -1882,7 +1913,7 @@ namespace microv
 
         mut_vm_pool.set_active(mut_tls, mut_tls.parent_vmid);
         mut_vp_pool.set_active(mut_tls, mut_tls.parent_vpid);
-        mut_vs_pool.set_active(mut_tls, intrinsic, mut_tls.parent_vsid);
+        mut_vs_pool.set_active(mut_tls, mut_sys, intrinsic, mut_tls.parent_vsid);
 
         mut_tls.parent_vmid = hypercall::MV_INVALID_ID;
         mut_tls.parent_vpid = hypercall::MV_INVALID_ID;
@@ -2001,6 +2032,26 @@ namespace microv
         bsl::safe_u16 const &vsid,
         bsl::errc_type const &errc) noexcept -> bsl::errc_type
     {
+        /// NOTE:
+        /// - Registers set through the register cache of the VS that is
+        ///   about to run still have to be written back. If the VMExit
+        ///   is promoted, that VS is the one that VMExited.
+        ///
+
+        auto mut_run_vsid{mut_sys.bf_tls_vsid()};
+        if (vmexit_success_promote == errc) {
+            mut_run_vsid = vsid;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::unlikely(!mut_vs_pool.reg_cache_flush(mut_sys, mut_run_vsid))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return return_unknown(
+                mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool);
+        }
+
         switch (errc.get()) {
             case vmexit_success_run.get(): {
                 return mut_sys.bf_vs_op_run_current();
@@ -31,6 +31,7 @@
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <mv_constants.hpp>
+#include <mv_stats_t.hpp>
 #include <page_pool_t.hpp>
 #include <pp_pool_t.hpp>
 #include <tls_t.hpp>
@@ -41,9 +42,115 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// <!-- description -->
+    ///   @brief Implements the mv_debug_op_stats_get hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_debug_op_stats_get(
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t const &vs_pool) noexcept -> bsl::errc_type
+    {
+        if (bsl::unlikely(!verify_handle(mut_sys))) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG0);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(!verify_root_vm(mut_sys))) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_PERM_DENIED);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        hypercall::mv_stats_t const *pmut_stats{};
+        auto const type{get_reg2(mut_sys)};
+
+        if (type == hypercall::MV_STATS_TYPE_VS_EXITS ||
+            type == hypercall::MV_STATS_TYPE_VS_HYPERCALLS ||
+            type == hypercall::MV_STATS_TYPE_VS_HALT_POLLS ||
+            type == hypercall::MV_STATS_TYPE_VS_FPU) {
+
+            /// NOTE:
+            /// - get_allocated_vsid() is not used here as it migrates the
+            ///   VS to this PP. Reading the statistics of a VS that is
+            ///   running on another PP is allowed, in which case the
+            ///   snapshot might not be self-consistent.
+            ///
+
+            auto const vsid{get_vsid(mut_sys, get_reg1(mut_sys))};
+            if (bsl::unlikely(vsid.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            if (bsl::unlikely(vs_pool.is_deallocated(vsid))) {
+                bsl::error() << "the provided vsid "                         // --
+                             << bsl::hex(vsid)                               // --
+                             << " was never allocated and cannot be used"    // --
+                             << bsl::endl                                    // --
+                             << bsl::here();                                 // --
+
+                set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            pmut_stats = vs_pool.stats_get(type, vsid);
+        }
+        else if (
+            type == hypercall::MV_STATS_TYPE_PP_EXITS ||
+            type == hypercall::MV_STATS_TYPE_PP_HYPERCALLS) {
+
+            auto const ppid{get_ppid(mut_sys, get_reg1(mut_sys))};
+            if (bsl::unlikely(ppid.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            pmut_stats = mut_pp_pool.stats_get(type, ppid);
+        }
+        else {
+            bsl::error() << "unsupported stats type "    // --
+                         << bsl::hex(type)              // --
+                         << bsl::endl                   // --
+                         << bsl::here();                // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(nullptr == pmut_stats)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto mut_stats{mut_pp_pool.shared_page<hypercall::mv_stats_t>(mut_sys)};
+        if (bsl::unlikely(mut_stats.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        *mut_stats = *pmut_stats;
+
+        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+        return vmexit_success_advance_ip_and_run;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches debug VMCalls.
     ///
@@ -53,7 +160,7 @@ namespace microv
     ///   @param mut_sys the bf_syscall_t to use
     ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
-    ///   @param pp_pool the pp_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @param vp_pool the vp_pool_t to use
     ///   @param vs_pool the vs_pool_t to use
@@ -68,7 +175,7 @@ namespace microv
         syscall::bf_syscall_t &mut_sys,
         page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
-        pp_pool_t const &pp_pool,
+        pp_pool_t &mut_pp_pool,
         vm_pool_t const &vm_pool,
         vp_pool_t const &vp_pool,
         vs_pool_t const &vs_pool,
@@ -78,10 +185,8 @@ namespace microv
         bsl::discard(tls);
         bsl::discard(page_pool);
         bsl::discard(intrinsic);
-        bsl::discard(pp_pool);
         bsl::discard(vm_pool);
         bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
         bsl::discard(vsid);
 
         switch (hypercall::mv_hypercall_index(get_reg_hypercall(mut_sys)).get()) {
@@ -94,6 +199,16 @@ namespace microv
                 return vmexit_success_advance_ip_and_run;
             }
 
+            case hypercall::MV_DEBUG_OP_STATS_GET_IDX_VAL.get(): {
+                auto const ret{handle_mv_debug_op_stats_get(mut_sys, mut_pp_pool, vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
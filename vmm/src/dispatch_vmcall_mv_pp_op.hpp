@@ -113,6 +113,17 @@ namespace microv
         ///   TLB related issues will occur.
         ///
 
+        if (bsl::unlikely(mut_pp_pool.is_spa_mapped(mut_sys, spa))) {
+            bsl::error() << "shared page spa "                 // --
+                         << bsl::hex(spa)                      // --
+                         << " is already mapped on this pp"    // --
+                         << bsl::endl                          // --
+                         << bsl::here();                       // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
         auto const ret{mut_pp_pool.set_shared_page_spa(mut_sys, spa)};
         if (bsl::unlikely(!ret)) {
             bsl::print<bsl::V>() << bsl::here();
@@ -247,6 +258,73 @@ namespace microv
         return vmexit_success_advance_ip_and_run;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the mv_pp_op_clr_trace_gpa hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_pp_op_clr_trace_gpa(syscall::bf_syscall_t &mut_sys, pp_pool_t &mut_pp_pool) noexcept
+        -> bsl::errc_type
+    {
+        mut_pp_pool.clr_trace_spa(mut_sys);
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_pp_op_set_trace_gpa hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_pp_op_set_trace_gpa(
+        syscall::bf_syscall_t &mut_sys, pp_pool_t &mut_pp_pool, vm_pool_t const &vm_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const gpa{get_pos_gpa(get_reg1(mut_sys))};
+        if (bsl::unlikely(gpa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const spa{vm_pool.gpa_to_spa(mut_sys, gpa, mut_sys.bf_tls_vmid())};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(mut_pp_pool.is_spa_mapped(mut_sys, spa))) {
+            bsl::error() << "trace ring spa "                  // --
+                         << bsl::hex(spa)                      // --
+                         << " is already mapped on this pp"    // --
+                         << bsl::endl                          // --
+                         << bsl::here();                       // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ret{mut_pp_pool.set_trace_spa(mut_sys, spa)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches physical processor VMCalls.
     ///
@@ -369,6 +447,26 @@ namespace microv
                 return ret;
             }
 
+            case hypercall::MV_PP_OP_CLR_TRACE_GPA_IDX_VAL.get(): {
+                auto const ret{handle_mv_pp_op_clr_trace_gpa(mut_sys, mut_pp_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_PP_OP_SET_TRACE_GPA_IDX_VAL.get(): {
+                auto const ret{handle_mv_pp_op_set_trace_gpa(mut_sys, mut_pp_pool, vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
@@ -28,9 +28,12 @@
 #include <bf_syscall_t.hpp>
 #include <dispatch_abi_helpers.hpp>
 #include <dispatch_vmcall_helpers.hpp>
+#include <emulated_ioapic_t.hpp>
+#include <emulated_pic_t.hpp>
 #include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <iopm_helpers.hpp>
 #include <mv_constants.hpp>
 #include <mv_types.hpp>
 #include <page_pool_t.hpp>
@@ -258,6 +261,351 @@ namespace microv
         return vmexit_success_advance_ip_and_run;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_irqchip_create hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_irqchip_create(
+        gs_t const &gs,
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t &mut_page_pool,
+        vm_pool_t &mut_vm_pool) noexcept -> bsl::errc_type
+    {
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), mut_vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if constexpr (!MICROV_EMULATED_IRQCHIP) {
+            bsl::error() << "MicroV was built without MICROV_EMULATED_IRQCHIP"    // --
+                         << bsl::endl                                            // --
+                         << bsl::here();                                         // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ret{mut_vm_pool.irqchip_create(gs, tls, mut_sys, mut_page_pool, vmid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_irq_line hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_irq_line(
+        tls_t const &tls, syscall::bf_syscall_t &mut_sys, vm_pool_t &mut_vm_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), mut_vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const gsi{get_reg2(mut_sys)};
+        if (bsl::unlikely(gsi >= IOAPIC_NUM_PINS)) {
+            bsl::error() << "gsi "                      // --
+                         << bsl::hex(gsi)               // --
+                         << " is out of range"          // --
+                         << bsl::endl                   // --
+                         << bsl::here();                // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(!mut_vm_pool.irqchip_enabled(vmid))) {
+            bsl::error() << "the irqchip of vm "    // --
+                         << bsl::hex(vmid)          // --
+                         << " was never created"    // --
+                         << bsl::endl               // --
+                         << bsl::here();            // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const level{get_reg3(mut_sys).is_pos()};
+        auto const ret{mut_vm_pool.irq_line(tls, gsi, level, vmid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_irq_resample hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_irq_resample(
+        tls_t const &tls, syscall::bf_syscall_t &mut_sys, vm_pool_t &mut_vm_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), mut_vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const gsi{get_reg2(mut_sys)};
+        bool const cascade{gsi.is_zero() || (PIC_CASCADE_PIN == gsi)};
+        if (bsl::unlikely((gsi >= IOAPIC_NUM_PINS) || cascade)) {
+            bsl::error() << "gsi "                      // --
+                         << bsl::hex(gsi)               // --
+                         << " cannot be resampled"      // --
+                         << bsl::endl                   // --
+                         << bsl::here();                // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(!mut_vm_pool.irqchip_enabled(vmid))) {
+            bsl::error() << "the irqchip of vm "    // --
+                         << bsl::hex(vmid)          // --
+                         << " was never created"    // --
+                         << bsl::endl               // --
+                         << bsl::here();            // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const enable{get_reg3(mut_sys).is_pos()};
+        auto const ret{mut_vm_pool.irq_resample(tls, gsi, enable, vmid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_io_permission hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_io_permission(syscall::bf_syscall_t &mut_sys, vm_pool_t &mut_vm_pool) noexcept
+        -> bsl::errc_type
+    {
+        constexpr auto port_mask{0x000000000000FFFF_u64};
+        constexpr auto rsvd_mask{0x00000000FFFF0000_u64};
+
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), mut_vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const reg2{get_reg2(mut_sys)};
+        auto const port{reg2 & port_mask};
+        auto const num{reg2 >> hypercall::MV_IO_PERM_NUM_PORTS_SHIFT};
+        if (bsl::unlikely((reg2 & rsvd_mask).is_pos() || num.is_zero())) {
+            bsl::error() << "invalid port range "    // --
+                         << bsl::hex(reg2)           // --
+                         << bsl::endl                // --
+                         << bsl::here();             // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely((port + num).checked() > IO_NUM_PORTS)) {
+            bsl::error() << "port range "         // --
+                         << bsl::hex(port)        // --
+                         << " + "                 // --
+                         << bsl::hex(num)         // --
+                         << " is out of range"    // --
+                         << bsl::endl             // --
+                         << bsl::here();          // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const type{get_reg3(mut_sys)};
+        if (bsl::unlikely(type > hypercall::MV_IO_PERM_EMULATE)) {
+            bsl::error() << "unknown io permission type "    // --
+                         << bsl::hex(type)                   // --
+                         << bsl::endl                        // --
+                         << bsl::here();                     // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG3);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ret{mut_vm_pool.io_permission(port, num, type, vmid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_pause_exiting hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_pause_exiting(syscall::bf_syscall_t &mut_sys, vm_pool_t &mut_vm_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), mut_vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const gap{get_reg2(mut_sys)};
+        if (bsl::unlikely(gap > hypercall::MV_PAUSE_EXITING_MAX)) {
+            bsl::error() << "invalid pause gap "    // --
+                         << bsl::hex(gap)           // --
+                         << bsl::endl               // --
+                         << bsl::here();            // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const window{get_reg3(mut_sys)};
+        if (bsl::unlikely(window > hypercall::MV_PAUSE_EXITING_MAX)) {
+            bsl::error() << "invalid pause window "    // --
+                         << bsl::hex(window)           // --
+                         << bsl::endl                  // --
+                         << bsl::here();               // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG3);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        mut_vm_pool.set_pause_exiting(gap, window, vmid);
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_clock_get hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_clock_get(
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t const &vm_pool) noexcept -> bsl::errc_type
+    {
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const tsc_khz{pp_pool.tsc_khz_get(mut_sys)};
+        if (bsl::unlikely(!is_tsc_khz_set(mut_sys, tsc_khz))) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ns{vm_pool.kvmclock_get(intrinsic.rdtsc(), tsc_khz, vmid)};
+        if (bsl::unlikely(ns.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        set_reg0(mut_sys, ns);
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vm_op_clock_set hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vm_op_clock_set(
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vm_pool_t &mut_vm_pool) noexcept -> bsl::errc_type
+    {
+        auto const vmid{get_allocated_guest_vmid(mut_sys, get_reg1(mut_sys), mut_vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        mut_vm_pool.kvmclock_set(intrinsic.rdtsc(), get_reg2(mut_sys), get_reg3(mut_sys), vmid);
+        return vmexit_success_advance_ip_and_run;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches virtual machine VMCalls.
     ///
@@ -358,6 +706,78 @@ namespace microv
                 return ret;
             }
 
+            case hypercall::MV_VM_OP_IRQCHIP_CREATE_IDX_VAL.get(): {
+                auto const ret{handle_mv_vm_op_irqchip_create(
+                    gs, tls, mut_sys, mut_page_pool, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VM_OP_IRQ_LINE_IDX_VAL.get(): {
+                auto const ret{handle_mv_vm_op_irq_line(tls, mut_sys, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VM_OP_IO_PERMISSION_IDX_VAL.get(): {
+                auto const ret{handle_mv_vm_op_io_permission(mut_sys, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VM_OP_PAUSE_EXITING_IDX_VAL.get(): {
+                auto const ret{handle_mv_vm_op_pause_exiting(mut_sys, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VM_OP_CLOCK_GET_IDX_VAL.get(): {
+                auto const ret{
+                    handle_mv_vm_op_clock_get(mut_sys, intrinsic, mut_pp_pool, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VM_OP_CLOCK_SET_IDX_VAL.get(): {
+                auto const ret{handle_mv_vm_op_clock_set(mut_sys, intrinsic, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VM_OP_IRQ_RESAMPLE_IDX_VAL.get(): {
+                auto const ret{handle_mv_vm_op_irq_resample(tls, mut_sys, mut_vm_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
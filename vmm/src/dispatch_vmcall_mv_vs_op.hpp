@@ -28,10 +28,20 @@
 #include <bf_syscall_t.hpp>
 #include <dispatch_abi_helpers.hpp>
 #include <dispatch_vmcall_helpers.hpp>
+#include <dispatch_vmcall_vs_state_helpers.hpp>
+#include <dispatch_vmexit_io_helpers.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_kvm_pv_helpers.hpp>
+#include <dispatch_vmexit_kvmclock_helpers.hpp>
+#include <dispatch_vmexit_mmio_helpers.hpp>
+#include <dispatch_vmexit_sync_regs_helpers.hpp>
+#include <dispatch_vmexit_trace_helpers.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <mv_constants.hpp>
+#include <mv_lapic_state_t.hpp>
 #include <mv_translation_t.hpp>
+#include <mv_vs_state_t.hpp>
 #include <page_pool_t.hpp>
 #include <pp_pool_t.hpp>
 #include <tls_t.hpp>
@@ -43,6 +53,8 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
@@ -102,7 +114,9 @@ namespace microv
             vpid,
             tls.ppid,
             tsc_khz,
-            vm_pool.slpt_spa(vmid))};
+            vm_pool.slpt_spa(vmid),
+            vm_pool.msrpm_spa(vmid),
+            vm_pool.iopm_spa(vmid))};
 
         if (bsl::unlikely(vsid.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
@@ -150,6 +164,7 @@ namespace microv
             return vmexit_failure_advance_ip_and_run;
         }
 
+        mut_vs_pool.clr_exit_page_spa(mut_sys, vsid);
         mut_vs_pool.deallocate(gs, tls, mut_sys, mut_page_pool, intrinsic, vsid);
         return vmexit_success_advance_ip_and_run;
     }
@@ -267,6 +282,19 @@ namespace microv
             return vmexit_failure_advance_ip_and_run;
         }
 
+        /// NOTE:
+        /// - The translation reads CR0, CR3 and CR4 directly, so the
+        ///   registers set through the VS's register cache have to be
+        ///   written back first.
+        ///
+
+        auto const flush_ret{mut_vs_pool.reg_cache_flush(mut_sys, mut_vsid)};
+        if (bsl::unlikely(!flush_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
         auto const translation{mut_vs_pool.gla_to_gpa(mut_sys, mut_pp_pool, gla, mut_vsid)};
         if (bsl::unlikely(!translation.is_valid)) {
             bsl::print<bsl::V>() << bsl::here();
@@ -284,7 +312,9 @@ namespace microv
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the tls_t to use
     ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
     ///   @param mut_vm_pool the vm_pool_t to use
     ///   @param mut_vp_pool the vp_pool_t to use
     ///   @param mut_vs_pool the vs_pool_t to use
@@ -295,7 +325,9 @@ namespace microv
     handle_mv_vs_op_run(
         tls_t &mut_tls,
         syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
         vm_pool_t &mut_vm_pool,
         vp_pool_t &mut_vp_pool,
         vs_pool_t &mut_vs_pool) noexcept -> bsl::errc_type
@@ -307,6 +339,73 @@ namespace microv
             return vmexit_failure_advance_ip_and_run;
         }
 
+        auto const sync_ret{sync_regs_from_root(mut_sys, mut_pp_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!sync_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const mmio_ret{complete_vmexit_mmio(mut_sys, mut_pp_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!mmio_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const io_ret{complete_vmexit_io(mut_sys, mut_pp_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!io_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if constexpr (MICROV_EMULATED_IRQCHIP) {
+            auto const irq_ret{
+                queue_vm_interrupt(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!irq_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+        }
+
+        /// NOTE:
+        /// - If the VS can take a queued interrupt right away, it is
+        ///   injected here, which saves the interrupt window VMExit that
+        ///   would otherwise deliver it.
+        ///
+
+        if (mut_vs_pool.interrupt_pending(vsid) && mut_vs_pool.interruptible(mut_sys, vsid)) {
+            auto const inj_ret{mut_vs_pool.inject_pending_interrupt(mut_sys, vsid)};
+            if (bsl::unlikely(!inj_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const clock_ret{update_kvmclock(
+            mut_tls, mut_sys, page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!clock_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const pv_ret{kvm_pv_sync_to_guest(
+            mut_tls, mut_sys, page_pool, intrinsic, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!pv_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        trace_inject(mut_sys, intrinsic, mut_pp_pool, mut_vs_pool, vsid);
+
         auto const ret{
             run_guest(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, vsid)};
 
@@ -791,156 +890,767 @@ namespace microv
     }
 
     /// <!-- description -->
-    ///   @brief Dispatches virtual processor state VMCalls.
+    ///   @brief Implements the mv_vs_op_tsc_set_khz hypercall
     ///
     /// <!-- inputs/outputs -->
-    ///   @param gs the gs_t to use
-    ///   @param mut_tls the tls_t to use
     ///   @param mut_sys the bf_syscall_t to use
-    ///   @param mut_page_pool the page_pool_t to use
-    ///   @param intrinsic the intrinsic_t to use
-    ///   @param mut_pp_pool the pp_pool_t to use
-    ///   @param mut_vm_pool the vm_pool_t to use
-    ///   @param mut_vp_pool the vp_pool_t to use
     ///   @param mut_vs_pool the vs_pool_t to use
-    ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
     ///
     [[nodiscard]] constexpr auto
-    dispatch_vmcall_mv_vs_op(
-        gs_t const &gs,
-        tls_t &mut_tls,
-        syscall::bf_syscall_t &mut_sys,
-        page_pool_t &mut_page_pool,
-        intrinsic_t const &intrinsic,
-        pp_pool_t &mut_pp_pool,
-        vm_pool_t &mut_vm_pool,
-        vp_pool_t &mut_vp_pool,
-        vs_pool_t &mut_vs_pool,
-        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    handle_mv_vs_op_tsc_set_khz(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
     {
-        bsl::discard(vsid);
-
-        if (bsl::unlikely(!verify_handle(mut_sys))) {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
-            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG0);
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
             return vmexit_failure_advance_ip_and_run;
         }
 
-        if (bsl::unlikely(!verify_root_vm(mut_sys))) {
-            bsl::print<bsl::V>() << bsl::here();
-            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_PERM_DENIED);
+        if (bsl::unlikely(mut_sys.is_vs_a_root_vs(vsid))) {
+            bsl::error() << "the TSC of root vs "    // --
+                         << bsl::hex(vsid)           // --
+                         << " cannot be changed"     // --
+                         << bsl::endl                // --
+                         << bsl::here();             // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
             return vmexit_failure_advance_ip_and_run;
         }
 
-        switch (hypercall::mv_hypercall_index(get_reg_hypercall(mut_sys)).get()) {
-            case hypercall::MV_VS_OP_CREATE_VS_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_create_vs(
-                    gs,
-                    mut_tls,
-                    mut_sys,
-                    mut_page_pool,
-                    intrinsic,
-                    mut_pp_pool,
-                    mut_vm_pool,
-                    mut_vp_pool,
-                    mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
-
-                return ret;
-            }
+        auto const tsc_khz{get_reg2(mut_sys)};
+        if (bsl::unlikely(tsc_khz.is_zero())) {
+            bsl::error() << "a TSC frequency of 0 is not supported"    // --
+                         << bsl::endl                                  // --
+                         << bsl::here();                               // --
 
-            case hypercall::MV_VS_OP_DESTROY_VS_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_destroy_vs(
-                    gs, mut_tls, mut_sys, mut_page_pool, intrinsic, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-                return ret;
-            }
+        auto const ret{mut_vs_pool.tsc_set_khz(mut_sys, tsc_khz, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-            case hypercall::MV_VS_OP_VMID_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_vmid(mut_sys, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+        return vmexit_success_advance_ip_and_run;
+    }
 
-                return ret;
-            }
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_queue_interrupt hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_queue_interrupt(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        constexpr auto max_vector{0xFF_u64};
 
-            case hypercall::MV_VS_OP_VPID_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_vpid(mut_sys, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-                return ret;
-            }
+        auto const vector{get_reg2(mut_sys)};
+        if (bsl::unlikely(vector > max_vector)) {
+            bsl::error() << "the vector "                              // --
+                         << bsl::hex(vector)                           // --
+                         << " is out of range and cannot be queued"    // --
+                         << bsl::endl                                  // --
+                         << bsl::here();                               // --
 
-            case hypercall::MV_VS_OP_VSID_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_vsid(mut_sys)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-                return ret;
-            }
+        auto const ret{mut_vs_pool.queue_interrupt(mut_sys, vector, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-            case hypercall::MV_VS_OP_GLA_TO_GPA_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_gla_to_gpa(mut_sys, mut_pp_pool, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+        return vmexit_success_advance_ip_and_run;
+    }
 
-                return ret;
-            }
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_lapic_get_all hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_lapic_get_all(
+        syscall::bf_syscall_t &mut_sys, pp_pool_t &mut_pp_pool, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-            case hypercall::MV_VS_OP_RUN_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_run(
-                    mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+        auto mut_state{mut_pp_pool.shared_page<hypercall::mv_lapic_state_t>(mut_sys)};
+        if (bsl::unlikely(mut_state.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-                return ret;
-            }
+        mut_vs_pool.lapic_get_all(mut_sys, *mut_state, vsid);
+        return vmexit_success_advance_ip_and_run;
+    }
 
-            case hypercall::MV_VS_OP_REG_GET_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_reg_get(mut_sys, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_lapic_set_all hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_lapic_set_all(
+        syscall::bf_syscall_t &mut_sys, pp_pool_t &mut_pp_pool, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-                return ret;
-            }
+        auto const state{mut_pp_pool.shared_page<hypercall::mv_lapic_state_t>(mut_sys)};
+        if (bsl::unlikely(state.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-            case hypercall::MV_VS_OP_REG_SET_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_reg_set(mut_sys, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
-                }
+        auto const ret{mut_vs_pool.lapic_set_all(mut_sys, *state, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
 
-                return ret;
-            }
+        return vmexit_success_advance_ip_and_run;
+    }
 
-            case hypercall::MV_VS_OP_REG_GET_LIST_IDX_VAL.get(): {
-                auto const ret{handle_mv_vs_op_reg_get_list(mut_sys, mut_pp_pool, mut_vs_pool)};
-                if (bsl::unlikely(!ret)) {
-                    bsl::print<bsl::V>() << bsl::here();
-                    return ret;
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_tsc_get_offset hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_tsc_get_offset(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(mut_sys.is_vs_a_root_vs(vsid))) {
+            bsl::error() << "the TSC of root vs "    // --
+                         << bsl::hex(vsid)           // --
+                         << " cannot be changed"     // --
+                         << bsl::endl                // --
+                         << bsl::here();             // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        set_reg0(mut_sys, mut_vs_pool.tsc_offset_get(vsid));
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_tsc_set_offset hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_tsc_set_offset(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(mut_sys.is_vs_a_root_vs(vsid))) {
+            bsl::error() << "the TSC of root vs "    // --
+                         << bsl::hex(vsid)           // --
+                         << " cannot be changed"     // --
+                         << bsl::endl                // --
+                         << bsl::here();             // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ret{mut_vs_pool.tsc_offset_set(mut_sys, get_reg2(mut_sys), vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_kvmclock_ctrl hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_kvmclock_ctrl(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(mut_sys.is_vs_a_root_vs(vsid))) {
+            bsl::error() << "root vs "                   // --
+                         << bsl::hex(vsid)               // --
+                         << " does not use kvmclock"     // --
+                         << bsl::endl                    // --
+                         << bsl::here();                 // --
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ret{mut_vs_pool.kvmclock_stop(vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the ID of the guest VS that an exit page
+    ///     hypercall targets, or bsl::safe_u16::failure() if the VS is
+    ///     invalid, is a root VS, or has an IN or MMIO read that is still
+    ///     waiting for its data (as that data could otherwise be read
+    ///     from the wrong page).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns the ID of the guest VS that an exit page
+    ///     hypercall targets, or bsl::safe_u16::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    get_exit_page_vsid(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::safe_u16
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::safe_u16::failure();
+        }
+
+        if (bsl::unlikely(mut_sys.is_vs_a_root_vs(vsid))) {
+            bsl::error() << "root vs "                       // --
+                         << bsl::hex(vsid)                   // --
+                         << " does not have an exit page"    // --
+                         << bsl::endl                        // --
+                         << bsl::here();                     // --
+
+            return bsl::safe_u16::failure();
+        }
+
+        if (bsl::unlikely(mut_vs_pool.io_in_pending(vsid) || mut_vs_pool.mmio_read_pending(vsid))) {
+            bsl::error() << "vs "                                          // --
+                         << bsl::hex(vsid)                                 // --
+                         << " has an exit that is waiting for its data"    // --
+                         << bsl::endl                                      // --
+                         << bsl::here();                                   // --
+
+            return bsl::safe_u16::failure();
+        }
+
+        return vsid;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_clr_exit_page_gpa hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_clr_exit_page_gpa(
+        syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept -> bsl::errc_type
+    {
+        auto const vsid{get_exit_page_vsid(mut_sys, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        mut_vs_pool.clr_exit_page_spa(mut_sys, vsid);
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_set_exit_page_gpa hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_set_exit_page_gpa(
+        syscall::bf_syscall_t &mut_sys, vm_pool_t const &vm_pool, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_exit_page_vsid(mut_sys, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const gpa{get_pos_gpa(get_reg2(mut_sys))};
+        if (bsl::unlikely(gpa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const spa{vm_pool.gpa_to_spa(mut_sys, gpa, mut_sys.bf_tls_vmid())};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const ret{mut_vs_pool.set_exit_page_spa(mut_sys, spa, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the ID of the guest VS that an
+    ///     mv_vs_op_state_get_all or mv_vs_op_state_set_all hypercall
+    ///     targets. The state of a root VS cannot be saved or restored.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns the ID of the guest VS that the hypercall
+    ///     targets, or bsl::safe_u16::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    get_vs_state_vsid(syscall::bf_syscall_t &mut_sys, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::safe_u16
+    {
+        auto const vsid{get_allocated_non_self_vsid(mut_sys, get_reg1(mut_sys), mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::safe_u16::failure();
+        }
+
+        if (bsl::unlikely(mut_sys.is_vs_a_root_vs(vsid))) {
+            bsl::error() << "the state of root vs "           // --
+                         << bsl::hex(vsid)                    // --
+                         << " cannot be saved or restored"    // --
+                         << bsl::endl                         // --
+                         << bsl::here();                      // --
+
+            return bsl::safe_u16::failure();
+        }
+
+        return vsid;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the chunk of a VS's state that an
+    ///     mv_vs_op_state_get_all or mv_vs_op_state_set_all hypercall
+    ///     targets, or bsl::safe_u64::failure() if REG2 is not a chunk.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the chunk from
+    ///   @return Returns the chunk of a VS's state that the hypercall
+    ///     targets, or bsl::safe_u64::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    get_vs_state_chunk(bsl::safe_u64 const &reg) noexcept -> bsl::safe_u64
+    {
+        if (bsl::unlikely(reg >= hypercall::MV_VS_STATE_NUM_CHUNKS)) {
+            bsl::error() << "VS state chunk "     // --
+                         << bsl::hex(reg)         // --
+                         << " is out of range"    // --
+                         << bsl::endl             // --
+                         << bsl::here();          // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return reg;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_state_get_all hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_state_get_all(
+        syscall::bf_syscall_t &mut_sys, pp_pool_t &mut_pp_pool, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        auto const vsid{get_vs_state_vsid(mut_sys, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const chunk{get_vs_state_chunk(get_reg2(mut_sys))};
+        if (bsl::unlikely(chunk.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (hypercall::MV_VS_STATE_CHUNK_CPU == chunk) {
+            auto mut_state{mut_pp_pool.shared_page<hypercall::mv_vs_state_t>(mut_sys)};
+            if (bsl::unlikely(mut_state.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            auto const ret{vs_state_get_cpu(mut_sys, mut_vs_pool, vsid, *mut_state)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            bsl::touch();
+        }
+        else if (hypercall::MV_VS_STATE_CHUNK_FPU == chunk) {
+            auto mut_page{mut_pp_pool.shared_page<page_4k_t>(mut_sys)};
+            if (bsl::unlikely(mut_page.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            mut_vs_pool.fpu_get_all(mut_sys, *mut_page, vsid);
+        }
+        else {
+            auto mut_state{mut_pp_pool.shared_page<hypercall::mv_lapic_state_t>(mut_sys)};
+            if (bsl::unlikely(mut_state.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            mut_vs_pool.lapic_get_all(mut_sys, *mut_state, vsid);
+        }
+
+        set_reg0(mut_sys, (chunk + bsl::safe_u64::magic_1()).checked());
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the mv_vs_op_state_set_all hypercall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_mv_vs_op_state_set_all(
+        syscall::bf_syscall_t &mut_sys, pp_pool_t &mut_pp_pool, vs_pool_t &mut_vs_pool) noexcept
+        -> bsl::errc_type
+    {
+        bsl::errc_type mut_ret{};
+
+        auto const vsid{get_vs_state_vsid(mut_sys, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG1);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        auto const chunk{get_vs_state_chunk(get_reg2(mut_sys))};
+        if (bsl::unlikely(chunk.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG2);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (hypercall::MV_VS_STATE_CHUNK_CPU == chunk) {
+            auto const state{mut_pp_pool.shared_page<hypercall::mv_vs_state_t>(mut_sys)};
+            if (bsl::unlikely(state.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            mut_ret = vs_state_set_cpu(mut_sys, mut_vs_pool, vsid, *state);
+        }
+        else if (hypercall::MV_VS_STATE_CHUNK_FPU == chunk) {
+            auto const page{mut_pp_pool.shared_page<page_4k_t>(mut_sys)};
+            if (bsl::unlikely(page.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            mut_vs_pool.fpu_set_all(mut_sys, *page, vsid);
+            mut_ret = bsl::errc_success;
+        }
+        else {
+            auto const state{mut_pp_pool.shared_page<hypercall::mv_lapic_state_t>(mut_sys)};
+            if (bsl::unlikely(state.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+                return vmexit_failure_advance_ip_and_run;
+            }
+
+            mut_ret = mut_vs_pool.lapic_set_all(mut_sys, *state, vsid);
+        }
+
+        if (bsl::unlikely(!mut_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_FAILURE_UNKNOWN);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        set_reg0(mut_sys, (chunk + bsl::safe_u64::magic_1()).checked());
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches virtual processor state VMCalls.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmcall_mv_vs_op(
+        gs_t const &gs,
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t &mut_page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(vsid);
+
+        if (bsl::unlikely(!verify_handle(mut_sys))) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_INPUT_REG0);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        if (bsl::unlikely(!verify_root_vm(mut_sys))) {
+            bsl::print<bsl::V>() << bsl::here();
+            set_reg_return(mut_sys, hypercall::MV_STATUS_INVALID_PERM_DENIED);
+            return vmexit_failure_advance_ip_and_run;
+        }
+
+        switch (hypercall::mv_hypercall_index(get_reg_hypercall(mut_sys)).get()) {
+            case hypercall::MV_VS_OP_CREATE_VS_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_create_vs(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_DESTROY_VS_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_destroy_vs(
+                    gs, mut_tls, mut_sys, mut_page_pool, intrinsic, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_VMID_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_vmid(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_VPID_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_vpid(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_VSID_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_vsid(mut_sys)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_GLA_TO_GPA_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_gla_to_gpa(mut_sys, mut_pp_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_RUN_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_run(
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_REG_GET_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_reg_get(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_REG_SET_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_reg_set(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_REG_GET_LIST_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_reg_get_list(mut_sys, mut_pp_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
                 }
 
                 return ret;
@@ -1036,6 +1746,16 @@ namespace microv
                 return ret;
             }
 
+            case hypercall::MV_VS_OP_QUEUE_INTERRUPT_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_queue_interrupt(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             case hypercall::MV_VS_OP_TSC_GET_KHZ_IDX_VAL.get(): {
                 auto const ret{handle_mv_vs_op_tsc_get_khz(mut_sys, mut_vs_pool)};
                 if (bsl::unlikely(!ret)) {
@@ -1046,6 +1766,107 @@ namespace microv
                 return ret;
             }
 
+            case hypercall::MV_VS_OP_TSC_SET_KHZ_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_tsc_set_khz(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_LAPIC_GET_ALL_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_lapic_get_all(mut_sys, mut_pp_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_LAPIC_SET_ALL_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_lapic_set_all(mut_sys, mut_pp_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_TSC_GET_OFFSET_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_tsc_get_offset(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_TSC_SET_OFFSET_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_tsc_set_offset(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_KVMCLOCK_CTRL_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_kvmclock_ctrl(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_CLR_EXIT_PAGE_GPA_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_clr_exit_page_gpa(mut_sys, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_SET_EXIT_PAGE_GPA_IDX_VAL.get(): {
+                auto const ret{
+                    handle_mv_vs_op_set_exit_page_gpa(mut_sys, mut_vm_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_STATE_GET_ALL_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_state_get_all(mut_sys, mut_pp_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case hypercall::MV_VS_OP_STATE_SET_ALL_IDX_VAL.get(): {
+                auto const ret{handle_mv_vs_op_state_set_all(mut_sys, mut_pp_pool, mut_vs_pool)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
@@ -34,6 +34,7 @@
 #include <dispatch_vmcall_mv_vm_op.hpp>
 #include <dispatch_vmcall_mv_vp_op.hpp>
 #include <dispatch_vmcall_mv_vs_op.hpp>
+#include <dispatch_vmexit_kvm_hypercall.hpp>
 #include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
@@ -52,7 +53,9 @@
 namespace microv
 {
     /// <!-- description -->
-    ///   @brief Dispatches VMCALL VMExits.
+    ///   @brief Dispatches VMCALL VMExits. VMCALLs made by the root VM
+    ///     are MicroV hypercalls, while VMCALLs made by a guest VM are
+    ///     KVM hypercalls.
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
@@ -81,6 +84,20 @@ namespace microv
         vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
+        if (!mut_sys.is_the_active_vm_the_root_vm()) {
+            return dispatch_vmexit_kvm_hypercall(
+                gs,
+                mut_tls,
+                mut_sys,
+                mut_page_pool,
+                intrinsic,
+                mut_pp_pool,
+                mut_vm_pool,
+                mut_vp_pool,
+                mut_vs_pool,
+                vsid);
+        }
+
         mut_tls.handling_vmcall = true;
 
         switch (hypercall::mv_hypercall_opcode(get_reg_hypercall(mut_sys)).get()) {
@@ -0,0 +1,154 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef EXIT_PAGE_T_HPP
+#define EXIT_PAGE_T_HPP
+
+#include <bf_syscall_t.hpp>
+#include <mv_constants.hpp>
+#include <page_4k_t.hpp>
+
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/is_pod.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @class microv::exit_page_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the exit page of a single VS (see
+    ///     mv_vs_op_set_exit_page_gpa). The exit page is a page owned by
+    ///     the root VM (normally the first page of the shim's kvm_run)
+    ///     that MicroV maps for as long as it is set, so that IO and MMIO
+    ///     exits can be written directly into it instead of the shared
+    ///     page of whichever PP the VS happens to run on.
+    ///
+    class exit_page_t final
+    {
+        /// @brief stores the exit page, or a nullptr if it is not set
+        page_4k_t *m_page{};
+        /// @brief stores the SPA of the exit page, or 0 if it is not set
+        bsl::safe_u64 m_spa{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns true if an exit page is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if an exit page is set.
+        ///
+        [[nodiscard]] constexpr auto
+        is_set() const noexcept -> bool
+        {
+            return nullptr != m_page;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the exit page if one is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        clr_spa(syscall::bf_syscall_t &mut_sys) noexcept
+        {
+            constexpr auto vmid{hypercall::MV_ROOT_VMID};
+
+            if (nullptr != m_page) {
+                bsl::expects(mut_sys.bf_vm_op_unmap_direct(vmid, m_page));
+                m_page = {};
+                m_spa = {};
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps the exit page located at the provided SPA. Unlike
+        ///     the trace ring, the page is not cleared as it belongs to
+        ///     software and MicroV only ever writes the fields of the exit
+        ///     it is reporting.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param spa the system physical address of the exit page
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_spa(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &spa) noexcept
+            -> bsl::errc_type
+        {
+            constexpr auto vmid{hypercall::MV_ROOT_VMID};
+
+            bsl::expects(spa.is_valid_and_checked());
+            bsl::expects(spa.is_pos());
+
+            if (bsl::unlikely(nullptr != m_page)) {
+                bsl::error() << "exit page was already set to spa "    // --
+                             << bsl::hex(m_spa)                        // --
+                             << bsl::endl;                             // --
+
+                return bsl::errc_failure;
+            }
+
+            m_page = mut_sys.bf_vm_op_map_direct<page_4k_t>(vmid, spa);
+            if (bsl::unlikely(nullptr == m_page)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            m_spa = spa;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the exit page as a T *, or a nullptr if no
+        ///     exit page is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of exit record to return
+        ///   @return Returns the exit page as a T *, or a nullptr if no
+        ///     exit page is set.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        get() const noexcept -> T *
+        {
+            static_assert(bsl::is_pod<T>::value);
+            static_assert(sizeof(T) <= HYPERVISOR_PAGE_SIZE);
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return reinterpret_cast<T *>(m_page);
+        }
+    };
+}
+
+#endif
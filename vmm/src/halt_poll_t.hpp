@@ -0,0 +1,184 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HALT_POLL_T_HPP
+#define HALT_POLL_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// @brief defines the first (non-zero) poll window in nanoseconds
+    constexpr auto HALT_POLL_GROW_START_NS{10000_u64};
+    /// @brief defines the factor a poll window grows by
+    constexpr auto HALT_POLL_GROW{2_u64};
+    /// @brief defines the factor a poll window shrinks by
+    constexpr auto HALT_POLL_SHRINK{2_u64};
+    /// @brief defines the number of nanoseconds in a millisecond (TSC is in KHz)
+    constexpr auto HALT_POLL_NS_PER_MS{1000000_u64};
+
+    /// @class microv::halt_poll_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the adaptive halt-polling state of a single VS.
+    ///     When a guest executes HLT, MicroV spins for at most window()
+    ///     cycles waiting for an interrupt before giving the PP back to
+    ///     the root VM. The window is adjusted the same way KVM adjusts
+    ///     halt_poll_ns: it grows when a halt that left MicroV was short
+    ///     enough that polling a little longer would have caught the
+    ///     wakeup, and shrinks when halts are longer than the max window
+    ///     (MICROV_HALT_POLL_NS), meaning polling is just burning cycles.
+    ///     Unlike KVM, the window only grows if the wakeup came from a
+    ///     source that MicroV can see while polling. A VS that is only
+    ///     ever woken up by the root VM (e.g., an interrupt injected from
+    ///     userspace) never polls, as polling could never succeed. The
+    ///     halt-polling counters live in the VS's stats_t (see
+    ///     MV_STATS_TYPE_VS_HALT_POLLS).
+    ///
+    class halt_poll_t final
+    {
+        /// @brief stores the current poll window in TSC ticks
+        bsl::safe_u64 m_window{};
+        /// @brief stores the TSC at which the VS halted in the root VM
+        bsl::safe_u64 m_halt_tsc{};
+
+        /// <!-- description -->
+        ///   @brief Converts nanoseconds to TSC ticks.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ns the nanoseconds to convert
+        ///   @param tsc_khz the TSC frequency in KHz to use
+        ///   @return Returns ns converted to TSC ticks
+        ///
+        [[nodiscard]] static constexpr auto
+        ns_to_ticks(bsl::safe_u64 const &ns, bsl::safe_u64 const &tsc_khz) noexcept
+            -> bsl::safe_u64
+        {
+            return ((ns * tsc_khz) / HALT_POLL_NS_PER_MS).checked();
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Resets the halt_poll_t.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_halt_tsc = {};
+            m_window = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of TSC ticks the next HLT should
+        ///     be polled for. A window of 0 means do not poll.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of TSC ticks the next HLT should
+        ///     be polled for.
+        ///
+        [[nodiscard]] constexpr auto
+        window() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_window.is_valid_and_checked());
+            return m_window;
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a HLT that was not woken up while polling and
+        ///     is about to be handed to the root VM. A HLT that was woken
+        ///     up while polling was shorter than the window, so there is
+        ///     nothing to record for it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current TSC
+        ///
+        constexpr void
+        miss(bsl::safe_u64 const &tsc) noexcept
+        {
+            m_halt_tsc = tsc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Called when the VS is run again. If the VS was halted
+        ///     in the root VM, the total halt time is used to adjust the
+        ///     poll window.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current TSC
+        ///   @param tsc_khz the TSC frequency of the VS in KHz
+        ///   @param observable true if the VS was woken up by a source that
+        ///     MicroV can see while polling, in which case the window is
+        ///     allowed to grow.
+        ///
+        constexpr void
+        wakeup(
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u64 const &tsc_khz,
+            bool const observable) noexcept
+        {
+            if (m_halt_tsc.is_zero()) {
+                return;
+            }
+
+            auto const halt{(tsc - m_halt_tsc).checked()};
+            auto const max{ns_to_ticks(bsl::to_u64(MICROV_HALT_POLL_NS), tsc_khz)};
+            m_halt_tsc = {};
+
+            if (halt <= m_window) {
+                bsl::touch();
+            }
+            else if (m_window.is_pos() && halt > max) {
+                m_window /= HALT_POLL_SHRINK;
+                if (m_window < ns_to_ticks(HALT_POLL_GROW_START_NS, tsc_khz)) {
+                    m_window = {};
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else if (observable && m_window < max && halt < max) {
+                if (m_window.is_zero()) {
+                    m_window = ns_to_ticks(HALT_POLL_GROW_START_NS, tsc_khz);
+                }
+                else {
+                    m_window *= HALT_POLL_GROW;
+                }
+
+                if (m_window > max) {
+                    m_window = max;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    };
+}
+
+#endif
@@ -27,6 +27,8 @@
 
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
+#include <mv_stats_t.hpp>
+#include <mv_trace_t.hpp>
 #include <page_pool_t.hpp>
 #include <pp_t.hpp>
 #include <tls_t.hpp>
@@ -179,6 +181,140 @@ namespace microv
             return this->get_pp(mut_sys.bf_tls_ppid())->set_shared_page_spa(mut_sys, spa);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided SPA is already mapped by
+        ///     the requested pp_t as either its shared page or its trace
+        ///     ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param spa the system physical address to check
+        ///   @return Returns true if the provided SPA is already mapped by
+        ///     the requested pp_t as either its shared page or its trace
+        ///     ring.
+        ///
+        [[nodiscard]] constexpr auto
+        is_spa_mapped(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &spa) const noexcept
+            -> bool
+        {
+            return this->get_pp(sys.bf_tls_ppid())->is_spa_mapped(spa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the SPA of the trace ring associated with the
+        ///     requested pp_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        clr_trace_spa(syscall::bf_syscall_t &mut_sys) noexcept
+        {
+            this->get_pp(mut_sys.bf_tls_ppid())->clr_trace_spa(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the SPA of the trace ring associated with the
+        ///     requested pp_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param spa the system physical address of the trace ring
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_trace_spa(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &spa) noexcept
+            -> bsl::errc_type
+        {
+            return this->get_pp(mut_sys.bf_tls_ppid())->set_trace_spa(mut_sys, spa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if tracing is enabled on the pp_t the
+        ///     caller is executing on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @return Returns true if tracing is enabled on the pp_t the
+        ///     caller is executing on.
+        ///
+        [[nodiscard]] constexpr auto
+        trace_enabled(syscall::bf_syscall_t const &sys) const noexcept -> bool
+        {
+            return this->get_pp(sys.bf_tls_ppid())->trace_enabled();
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds an entry to the trace ring of the pp_t the caller
+        ///     is executing on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param entry the entry to add
+        ///
+        constexpr void
+        trace_add(
+            syscall::bf_syscall_t const &sys,
+            intrinsic_t const &intrinsic,
+            hypercall::mv_trace_entry_t const &entry) noexcept
+        {
+            this->get_pp(sys.bf_tls_ppid())->trace_add(intrinsic, entry);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a VMExit in the statistics of the pp_t the
+        ///     VMExit occurred on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles spent handling the VMExit
+        ///
+        constexpr void
+        stats_add_exit(
+            syscall::bf_syscall_t const &sys,
+            bsl::safe_u64 const &reason,
+            bsl::safe_u64 const &cycles) noexcept
+        {
+            this->get_pp(sys.bf_tls_ppid())->stats_add_exit(reason, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hypercall in the statistics of the pp_t the
+        ///     hypercall was made on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param slot the slot of the hypercall
+        ///   @param cycles the number of cycles spent handling the hypercall
+        ///
+        constexpr void
+        stats_add_hypercall(
+            syscall::bf_syscall_t const &sys,
+            bsl::safe_u64 const &slot,
+            bsl::safe_u64 const &cycles) noexcept
+        {
+            this->get_pp(sys.bf_tls_ppid())->stats_add_hypercall(slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested pp_t's statistics of the
+        ///     provided type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type the MV_STATS_TYPE of the statistics to return
+        ///   @param ppid the ID of the pp_t to query
+        ///   @return Returns the requested statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats_get(bsl::safe_u64 const &type, bsl::safe_u16 const &ppid) const noexcept
+            -> hypercall::mv_stats_t const *
+        {
+            return this->get_pp(ppid)->stats_get(type);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the PP's TSC frequency in KHz. If the TSC
         ///     frequency has not yet been set, bsl::safe_u64::failure is
@@ -0,0 +1,328 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef REG_CACHE_T_HPP
+#define REG_CACHE_T_HPP
+
+#include <bf_syscall_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the number of registers a reg_cache_t can store.
+    ///   Registers with a larger bf_reg_t are not cached.
+    constexpr auto REG_CACHE_SIZE{256_umx};
+    /// @brief defines the number of bits in a reg_cache_t bitmap word
+    constexpr auto REG_CACHE_BITS{64_umx};
+    /// @brief defines the number of words in a reg_cache_t bitmap
+    constexpr auto REG_CACHE_WORDS{(REG_CACHE_SIZE / REG_CACHE_BITS).checked()};
+
+    /// @class microv::reg_cache_t
+    ///
+    /// <!-- description -->
+    ///   @brief Caches the registers of a single VS so that reading or
+    ///     writing the same register more than once while the VS is
+    ///     stopped only costs a single bf_vs_op_read/bf_vs_op_write.
+    ///     Reads fill the cache lazily, and writes are only marked dirty
+    ///     until flush() is called, which must happen before the VS runs
+    ///     again. The VS's state changes while it runs, so the cache must
+    ///     be invalidated on every VMExit of the VS.
+    ///
+    /// <!-- notes -->
+    ///   @note Only the accesses made through the reg_cache_t are cached.
+    ///     Code that reads or writes a register directly using the
+    ///     bf_syscall_t bypasses the cache, and will either miss a dirty
+    ///     value or be overwritten by the next flush(). Code that has to
+    ///     write a register after the cache was flushed (i.e., while the
+    ///     VS is being made active) must use write_through().
+    ///
+    class reg_cache_t final
+    {
+        /// @brief stores the cached register values
+        bsl::array<bsl::uint64, REG_CACHE_SIZE.get()> m_vals{};
+        /// @brief stores which registers are cached
+        bsl::array<bsl::uint64, REG_CACHE_WORDS.get()> m_valid{};
+        /// @brief stores which registers have to be written back
+        bsl::array<bsl::uint64, REG_CACHE_WORDS.get()> m_dirty{};
+        /// @brief stores the index of each register that was made dirty
+        bsl::array<bsl::uintmx, REG_CACHE_SIZE.get()> m_dirty_list{};
+        /// @brief stores the number of entries in m_dirty_list
+        bsl::safe_umx m_dirty_count{};
+
+        /// <!-- description -->
+        ///   @brief Returns the index of "reg" in the cache, or
+        ///     bsl::safe_idx::failure() if "reg" is not cached.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the register to get the index of
+        ///   @return Returns the index of "reg" in the cache, or
+        ///     bsl::safe_idx::failure() if "reg" is not cached.
+        ///
+        [[nodiscard]] static constexpr auto
+        index(syscall::bf_reg_t const reg) noexcept -> bsl::safe_idx
+        {
+            auto const val{bsl::to_umx(static_cast<bsl::uintmx>(reg))};
+            if (bsl::unlikely(val >= REG_CACHE_SIZE)) {
+                return bsl::safe_idx::failure();
+            }
+
+            return bsl::to_idx(val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bit of the register at "idx" in its
+        ///     bitmap word.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the register
+        ///   @return Returns the bit of the register at "idx" in its
+        ///     bitmap word.
+        ///
+        [[nodiscard]] static constexpr auto
+        bit(bsl::safe_idx const &idx) noexcept -> bsl::safe_u64
+        {
+            return 1_u64 << bsl::to_u64(idx.get() % REG_CACHE_BITS.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the bitmap word of the register
+        ///     at "idx".
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the register
+        ///   @return Returns the index of the bitmap word of the register
+        ///     at "idx".
+        ///
+        [[nodiscard]] static constexpr auto
+        word(bsl::safe_idx const &idx) noexcept -> bsl::safe_idx
+        {
+            return bsl::to_idx(idx.get() / REG_CACHE_BITS.get());
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the value of the requested register, reading
+        ///     it from the microkernel only if it is not already cached.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS the cache belongs to
+        ///   @param reg the register to read
+        ///   @return Returns the value of the requested register, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        read(
+            syscall::bf_syscall_t const &sys,
+            bsl::safe_u16 const &vsid,
+            syscall::bf_reg_t const reg) noexcept -> bsl::safe_u64
+        {
+            auto const idx{index(reg)};
+            if (bsl::unlikely(idx.is_invalid())) {
+                return sys.bf_vs_op_read(vsid, reg);
+            }
+
+            auto *const pmut_valid{m_valid.at_if(word(idx))};
+            if ((bsl::to_u64(*pmut_valid) & bit(idx)).is_pos()) {
+                return bsl::to_u64(*m_vals.at_if(idx));
+            }
+
+            auto const val{sys.bf_vs_op_read(vsid, reg)};
+            if (bsl::unlikely(val.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            *m_vals.at_if(idx) = val.get();
+            *pmut_valid = (bsl::to_u64(*pmut_valid) | bit(idx)).get();
+
+            return val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the requested register. The value
+        ///     is only written to the microkernel on the next flush().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS the cache belongs to
+        ///   @param reg the register to write
+        ///   @param val the value to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vsid,
+            syscall::bf_reg_t const reg,
+            bsl::safe_u64 const &val) noexcept -> bsl::errc_type
+        {
+            auto const idx{index(reg)};
+            if (bsl::unlikely(idx.is_invalid())) {
+                return mut_sys.bf_vs_op_write(vsid, reg, val);
+            }
+
+            auto *const pmut_valid{m_valid.at_if(word(idx))};
+            auto *const pmut_dirty{m_dirty.at_if(word(idx))};
+
+            if ((bsl::to_u64(*pmut_dirty) & bit(idx)).is_zero()) {
+                *m_dirty_list.at_if(bsl::to_idx(m_dirty_count)) = idx.get();
+                ++m_dirty_count;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *m_vals.at_if(idx) = val.get();
+            *pmut_valid = (bsl::to_u64(*pmut_valid) | bit(idx)).get();
+            *pmut_dirty = (bsl::to_u64(*pmut_dirty) | bit(idx)).get();
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes the requested register to the microkernel right
+        ///     away, and caches it as clean so that a pending write to the
+        ///     same register cannot overwrite it on the next flush().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS the cache belongs to
+        ///   @param reg the register to write
+        ///   @param val the value to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write_through(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u16 const &vsid,
+            syscall::bf_reg_t const reg,
+            bsl::safe_u64 const &val) noexcept -> bsl::errc_type
+        {
+            auto const ret{mut_sys.bf_vs_op_write(vsid, reg, val)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            auto const idx{index(reg)};
+            if (bsl::unlikely(idx.is_invalid())) {
+                return bsl::errc_success;
+            }
+
+            auto *const pmut_valid{m_valid.at_if(word(idx))};
+            auto *const pmut_dirty{m_dirty.at_if(word(idx))};
+
+            *m_vals.at_if(idx) = val.get();
+            *pmut_valid = (bsl::to_u64(*pmut_valid) | bit(idx)).get();
+            *pmut_dirty = (bsl::to_u64(*pmut_dirty) & ~bit(idx)).get();
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes every dirty register to the microkernel, once
+        ///     each, and then drops every cached register. Nothing else
+        ///     is cached until the VS runs, so a register that is written
+        ///     directly after the flush cannot leave a stale value behind.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the VS the cache belongs to
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        flush(syscall::bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept
+            -> bsl::errc_type
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < m_dirty_count; ++mut_i) {
+                auto const idx{bsl::to_idx(*m_dirty_list.at_if(mut_i))};
+
+                /// NOTE:
+                /// - A register that was written through after it was made
+                ///   dirty is still in the list, but it is no longer dirty
+                ///   and must not be written back.
+                ///
+
+                auto *const pmut_dirty{m_dirty.at_if(word(idx))};
+                if ((bsl::to_u64(*pmut_dirty) & bit(idx)).is_zero()) {
+                    continue;
+                }
+
+                auto const reg{static_cast<syscall::bf_reg_t>(idx.get())};
+                auto const val{bsl::to_u64(*m_vals.at_if(idx))};
+
+                auto const ret{mut_sys.bf_vs_op_write(vsid, reg, val)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                *pmut_dirty = (bsl::to_u64(*pmut_dirty) & ~bit(idx)).get();
+            }
+
+            this->invalidate();
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Drops every cached register. Any register that is
+        ///     still dirty is dropped as well, so the cache must be
+        ///     flushed before the VS runs.
+        ///
+        constexpr void
+        invalidate() noexcept
+        {
+            m_valid = {};
+            m_dirty = {};
+            m_dirty_count = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the cache has registers that have not
+        ///     been written back yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the cache has registers that have not
+        ///     been written back yet.
+        ///
+        [[nodiscard]] constexpr auto
+        is_dirty() const noexcept -> bool
+        {
+            return m_dirty_count.is_pos();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,353 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef STATS_T_HPP
+#define STATS_T_HPP
+
+#include <bf_syscall_t.hpp>
+#include <mv_constants.hpp>
+#include <mv_stats_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @class microv::stats_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the VMExit and hypercall statistics of a single VS
+    ///     or PP, as well as the halt-polling and extended state statistics
+    ///     of a VS (see mv_debug_op_stats_get). Each set of statistics is a
+    ///     hypercall::mv_stats_t that lives in its own page so that it can
+    ///     be copied into the shared page as is. Pages allocated from the
+    ///     microkernel cannot be freed, so once a stats_t has its pages,
+    ///     it keeps them and clears them each time it is allocated.
+    ///
+    class stats_t final
+    {
+        /// @brief stores the VMExit statistics
+        hypercall::mv_stats_t *m_exits{};
+        /// @brief stores the hypercall statistics
+        hypercall::mv_stats_t *m_hypercalls{};
+        /// @brief stores the halt-polling statistics (VS only)
+        hypercall::mv_stats_t *m_halt_polls{};
+        /// @brief stores the extended state statistics (VS only)
+        hypercall::mv_stats_t *m_fpu{};
+
+        /// <!-- description -->
+        ///   @brief Returns the histogram bucket an event that took
+        ///     "cycles" cycles to handle is counted in, which is
+        ///     floor(log2(cycles)) capped at MV_STATS_NUM_BUCKETS - 1.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cycles the number of cycles the event took
+        ///   @return Returns the histogram bucket for "cycles"
+        ///
+        [[nodiscard]] static constexpr auto
+        bucket(bsl::safe_u64 const &cycles) noexcept -> bsl::safe_idx
+        {
+            constexpr auto max_shift{32_u64};
+            constexpr auto last{(hypercall::MV_STATS_NUM_BUCKETS - bsl::safe_u64::magic_1())};
+
+            auto mut_val{cycles};
+            bsl::safe_u64 mut_log2{};
+
+            for (auto mut_shift{max_shift}; mut_shift.is_pos(); mut_shift >>= 1_u64) {
+                auto const upper{mut_val >> mut_shift};
+                if (upper.is_pos()) {
+                    mut_val = upper;
+                    mut_log2 += mut_shift;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (mut_log2 > last.checked()) {
+                return bsl::to_idx(last.checked());
+            }
+
+            return bsl::to_idx(mut_log2.checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Increments a slot of the provided statistics without
+        ///     counting an event. Slots that are out of range are ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_stats the statistics to increment the slot of
+        ///   @param slot the slot to increment
+        ///
+        static constexpr void
+        add_slot(hypercall::mv_stats_t *const pmut_stats, bsl::safe_u64 const &slot) noexcept
+        {
+            if (bsl::unlikely(nullptr == pmut_stats)) {
+                return;
+            }
+
+            if (slot < hypercall::MV_STATS_NUM_SLOTS) {
+                auto *const pmut_slot{pmut_stats->slots.at_if(bsl::to_idx(slot))};
+                *pmut_slot = (bsl::to_u64(*pmut_slot) + 1_u64).checked().get();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts an event in the provided statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_stats the statistics to count the event in
+        ///   @param slot the slot of the event. If the slot is out of
+        ///     range, the event is only counted in the totals and the
+        ///     histogram.
+        ///   @param cycles the number of cycles the event took
+        ///
+        static constexpr void
+        add(hypercall::mv_stats_t *const pmut_stats,
+            bsl::safe_u64 const &slot,
+            bsl::safe_u64 const &cycles) noexcept
+        {
+            if (bsl::unlikely(nullptr == pmut_stats)) {
+                return;
+            }
+
+            pmut_stats->count = (bsl::to_u64(pmut_stats->count) + 1_u64).checked().get();
+            pmut_stats->cycles = (bsl::to_u64(pmut_stats->cycles) + cycles).checked().get();
+
+            auto *const pmut_bucket{pmut_stats->hist.at_if(bucket(cycles))};
+            *pmut_bucket = (bsl::to_u64(*pmut_bucket) + 1_u64).checked().get();
+
+            add_slot(pmut_stats, slot);
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates the page that stores a set of statistics if
+        ///     it has not been allocated yet, and clears it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param pmut_mut_stats the statistics to allocate
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        allocate_page(
+            syscall::bf_syscall_t &mut_sys, hypercall::mv_stats_t *&pmut_mut_stats) noexcept
+            -> bsl::errc_type
+        {
+            if (nullptr == pmut_mut_stats) {
+                pmut_mut_stats = mut_sys.bf_mem_op_alloc_page<hypercall::mv_stats_t>();
+                if (bsl::unlikely(nullptr == pmut_mut_stats)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+                *pmut_mut_stats = {};
+            }
+
+            return bsl::errc_success;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Allocates the pages that store the statistics if they
+        ///     have not been allocated yet, and clears them.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vs if true, the statistics that only a VS has are
+        ///     allocated as well
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        allocate(syscall::bf_syscall_t &mut_sys, bool const vs) noexcept -> bsl::errc_type
+        {
+            auto const exits_ret{allocate_page(mut_sys, m_exits)};
+            if (bsl::unlikely(!exits_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return exits_ret;
+            }
+
+            auto const hypercalls_ret{allocate_page(mut_sys, m_hypercalls)};
+            if (bsl::unlikely(!hypercalls_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return hypercalls_ret;
+            }
+
+            if (!vs) {
+                return bsl::errc_success;
+            }
+
+            auto const halt_polls_ret{allocate_page(mut_sys, m_halt_polls)};
+            if (bsl::unlikely(!halt_polls_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return halt_polls_ret;
+            }
+
+            auto const fpu_ret{allocate_page(mut_sys, m_fpu)};
+            if (bsl::unlikely(!fpu_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fpu_ret;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a VMExit. Exit reasons at or above
+        ///     MV_STATS_EXIT_HIGH_REASON (e.g., AMD's NPF and AVIC exit
+        ///     codes) are folded down to MV_STATS_EXIT_HIGH_SLOT so that
+        ///     they still get a slot.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles spent handling the VMExit
+        ///
+        constexpr void
+        add_exit(bsl::safe_u64 const &reason, bsl::safe_u64 const &cycles) noexcept
+        {
+            if (reason < hypercall::MV_STATS_EXIT_HIGH_REASON) {
+                add(m_exits, reason, cycles);
+            }
+            else {
+                auto const high{(reason - hypercall::MV_STATS_EXIT_HIGH_REASON).checked()};
+                add(m_exits, (hypercall::MV_STATS_EXIT_HIGH_SLOT + high).checked(), cycles);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hypercall.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the hypercall (see
+        ///     mv_debug_op_stats_get)
+        ///   @param cycles the number of cycles spent handling the hypercall
+        ///
+        constexpr void
+        add_hypercall(bsl::safe_u64 const &slot, bsl::safe_u64 const &cycles) noexcept
+        {
+            add(m_hypercalls, slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a HLT that was polled, either because it was
+        ///     woken up while polling (MV_STATS_HALT_POLL_SLOT_HIT) or
+        ///     because it is being handed to the root VM
+        ///     (MV_STATS_HALT_POLL_SLOT_MISS).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the HLT
+        ///   @param cycles the number of cycles spent polling
+        ///
+        constexpr void
+        add_halt_poll(bsl::safe_u64 const &slot, bsl::safe_u64 const &cycles) noexcept
+        {
+            add(m_halt_polls, slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a change of the halt-poll window
+        ///     (MV_STATS_HALT_POLL_SLOT_GROW or MV_STATS_HALT_POLL_SLOT_SHRINK).
+        ///     Only the slot is incremented as this is not a HLT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the change
+        ///
+        constexpr void
+        add_halt_poll_resize(bsl::safe_u64 const &slot) noexcept
+        {
+            add_slot(m_halt_polls, slot);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a save (MV_STATS_FPU_SLOT_SAVE) or a restore
+        ///     (MV_STATS_FPU_SLOT_RESTORE) of the extended state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the save or restore
+        ///   @param cycles the number of cycles the save or restore took
+        ///
+        constexpr void
+        add_fpu(bsl::safe_u64 const &slot, bsl::safe_u64 const &cycles) noexcept
+        {
+            add(m_fpu, slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts the VS being set active
+        ///     (MV_STATS_FPU_SLOT_SWITCH). Only the slot is incremented as
+        ///     a switch does not touch the extended state by itself.
+        ///
+        constexpr void
+        add_fpu_switch() noexcept
+        {
+            add_slot(m_fpu, hypercall::MV_STATS_FPU_SLOT_SWITCH);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested statistics, or a nullptr if the
+        ///     stats_t was never allocated or does not store "type".
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type the MV_STATS_TYPE of the statistics to return
+        ///   @return Returns the requested statistics
+        ///
+        [[nodiscard]] constexpr auto
+        get(bsl::safe_u64 const &type) const noexcept -> hypercall::mv_stats_t const *
+        {
+            if (hypercall::MV_STATS_TYPE_VS_EXITS == type ||
+                hypercall::MV_STATS_TYPE_PP_EXITS == type) {
+                return m_exits;
+            }
+
+            if (hypercall::MV_STATS_TYPE_VS_HYPERCALLS == type ||
+                hypercall::MV_STATS_TYPE_PP_HYPERCALLS == type) {
+                return m_hypercalls;
+            }
+
+            if (hypercall::MV_STATS_TYPE_VS_HALT_POLLS == type) {
+                return m_halt_polls;
+            }
+
+            if (hypercall::MV_STATS_TYPE_VS_FPU == type) {
+                return m_fpu;
+            }
+
+            return nullptr;
+        }
+    };
+}
+
+#endif
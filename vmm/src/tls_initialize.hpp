@@ -66,6 +66,8 @@ namespace microv
         mut_tls.parent_vpid = hypercall::MV_INVALID_ID;
         mut_tls.parent_vsid = hypercall::MV_INVALID_ID;
 
+        mut_tls.fpu_vsid = hypercall::MV_INVALID_ID;
+
         return bsl::errc_success;
     }
 }
@@ -0,0 +1,193 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_T_HPP
+#define TRACE_T_HPP
+
+#include <bf_syscall_t.hpp>
+#include <intrinsic_t.hpp>
+#include <mv_constants.hpp>
+#include <mv_trace_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @class microv::trace_t
+    ///
+    /// <!-- description -->
+    ///   @brief Produces the trace ring of a single PP (see
+    ///     mv_pp_op_set_trace_gpa). The ring is a page owned by the root
+    ///     VM that MicroV maps for as long as tracing is enabled. When no
+    ///     ring is set, adding an entry costs a single compare.
+    ///
+    class trace_t final
+    {
+        /// @brief stores the trace ring, or a nullptr if tracing is disabled
+        hypercall::mv_trace_t *m_trace{};
+        /// @brief stores the SPA of the trace ring, or 0 if tracing is disabled
+        bsl::safe_u64 m_spa{};
+        /// @brief stores MicroV's copy of the head of the ring
+        bsl::safe_u64 m_head{};
+        /// @brief stores MicroV's copy of the lost entry count of the ring
+        bsl::safe_u64 m_lost{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns true if a trace ring is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if a trace ring is set.
+        ///
+        [[nodiscard]] constexpr auto
+        is_enabled() const noexcept -> bool
+        {
+            return nullptr != m_trace;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the SPA of the trace ring, or 0 if no trace
+        ///     ring is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the SPA of the trace ring, or 0 if no trace
+        ///     ring is set.
+        ///
+        [[nodiscard]] constexpr auto
+        spa() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_spa;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the trace ring, disabling tracing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        clr_spa(syscall::bf_syscall_t &mut_sys) noexcept
+        {
+            constexpr auto vmid{hypercall::MV_ROOT_VMID};
+
+            if (nullptr != m_trace) {
+                bsl::expects(mut_sys.bf_vm_op_unmap_direct(vmid, m_trace));
+                m_trace = {};
+                m_spa = {};
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Maps the trace ring located at the provided SPA and
+        ///     resets it, enabling tracing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param spa the system physical address of the trace ring
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_spa(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &spa) noexcept
+            -> bsl::errc_type
+        {
+            constexpr auto vmid{hypercall::MV_ROOT_VMID};
+
+            bsl::expects(spa.is_valid_and_checked());
+            bsl::expects(spa.is_pos());
+
+            if (bsl::unlikely(nullptr != m_trace)) {
+                bsl::error() << "trace ring was already set to spa "    // --
+                             << bsl::hex(spa)                           // --
+                             << bsl::endl;                              // --
+
+                return bsl::errc_failure;
+            }
+
+            m_trace = mut_sys.bf_vm_op_map_direct<hypercall::mv_trace_t>(vmid, spa);
+            if (bsl::unlikely(nullptr == m_trace)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            *m_trace = {};
+            m_spa = spa;
+            m_head = {};
+            m_lost = {};
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds an entry to the trace ring. The entry is written
+        ///     first and then published by storing the new head, so the
+        ///     root VM never sees a partially written entry. If the ring
+        ///     is full, the entry is dropped and counted in "lost" instead.
+        ///     MicroV keeps its own copy of head and lost, so nothing the
+        ///     root VM writes to the ring can make MicroV write outside of
+        ///     it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param entry the entry to add
+        ///
+        constexpr void
+        add(intrinsic_t const &intrinsic, hypercall::mv_trace_entry_t const &entry) noexcept
+        {
+            if (nullptr == m_trace) {
+                return;
+            }
+
+            auto const tail{bsl::to_u64(m_trace->tail)};
+            if (bsl::unlikely(tail > m_head)) {
+                ++m_lost;
+                intrinsic.store64(&m_trace->lost, m_lost.checked());
+                return;
+            }
+
+            if (bsl::unlikely((m_head - tail).checked() >= hypercall::MV_TRACE_NUM_ENTRIES)) {
+                ++m_lost;
+                intrinsic.store64(&m_trace->lost, m_lost.checked());
+                return;
+            }
+
+            auto const idx{bsl::to_idx((m_head % hypercall::MV_TRACE_NUM_ENTRIES).checked())};
+            *m_trace->entries.at_if(idx) = entry;
+
+            ++m_head;
+            intrinsic.store64(&m_trace->head, m_head.checked());
+        }
+    };
+}
+
+#endif
@@ -28,7 +28,9 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
 #include <lock_guard_t.hpp>
+#include <mv_exit_io_t.hpp>
 #include <mv_translation_t.hpp>
 #include <page_pool_t.hpp>
 #include <spinlock_t.hpp>
@@ -313,6 +315,224 @@ namespace microv
             return this->get_vm(vmid)->slpt_spa();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the system physical address of the MSR
+        ///     permissions map used by the requested vm_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the system physical address of the MSR
+        ///     permissions map used by the requested vm_t.
+        ///
+        [[nodiscard]] constexpr auto
+        msrpm_spa(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->msrpm_spa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the system physical address of the IO
+        ///     permissions map used by the requested vm_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the system physical address of the IO
+        ///     permissions map used by the requested vm_t.
+        ///
+        [[nodiscard]] constexpr auto
+        iopm_spa(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->iopm_spa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets how the requested vm_t's accesses to a range of
+        ///     ports are handled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the first port in the range
+        ///   @param num the number of ports in the range
+        ///   @param type MV_IO_PERM_EXIT, MV_IO_PERM_PASSTHROUGH or
+        ///     MV_IO_PERM_EMULATE
+        ///   @param vmid the ID of the vm_t to modify
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        io_permission(
+            bsl::safe_u64 const &port,
+            bsl::safe_u64 const &num,
+            bsl::safe_u64 const &type,
+            bsl::safe_u16 const &vmid) noexcept -> bsl::errc_type
+        {
+            return this->get_vm(vmid)->io_permission(port, num, type);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vm_t's accesses to the
+        ///     provided port were marked as MV_IO_PERM_EMULATE, false
+        ///     otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port to query
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns true if the requested vm_t's accesses to the
+        ///     provided port were marked as MV_IO_PERM_EMULATE, false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        io_emulated(bsl::safe_u64 const &port, bsl::safe_u16 const &vmid) const noexcept -> bool
+        {
+            return this->get_vm(vmid)->io_emulated(port);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the requested vm_t's PAUSE-loop exiting
+        ///     thresholds. A gap or window of 0 disables PAUSE-loop
+        ///     exiting.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gap the max number of cycles between PAUSEs of a loop
+        ///   @param window the number of cycles a VS can spin before yielding
+        ///   @param vmid the ID of the vm_t to set the thresholds for
+        ///
+        constexpr void
+        set_pause_exiting(
+            bsl::safe_u64 const &gap,
+            bsl::safe_u64 const &window,
+            bsl::safe_u16 const &vmid) noexcept
+        {
+            this->get_vm(vmid)->set_pause_exiting(gap, window);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of cycles between two PAUSEs
+        ///     of a loop for the requested vm_t's VSs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the max number of cycles between two PAUSEs
+        ///     of a loop for the requested vm_t's VSs.
+        ///
+        [[nodiscard]] constexpr auto
+        pause_gap(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pause_gap();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of cycles the requested vm_t's VSs
+        ///     can spin before yielding.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the number of cycles the requested vm_t's VSs
+        ///     can spin before yielding.
+        ///
+        [[nodiscard]] constexpr auto
+        pause_window(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pause_window();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested vm_t's kvmclock in nanoseconds.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the PP's current TSC
+        ///   @param tsc_khz the PP's TSC frequency in KHz
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the requested vm_t's kvmclock in nanoseconds.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_get(
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->kvmclock_get(tsc, tsc_khz);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the requested vm_t's kvmclock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the PP's current TSC
+        ///   @param ns the kvmclock in nanoseconds at "tsc"
+        ///   @param realtime the wall clock time in nanoseconds at "tsc"
+        ///     or 0 to keep the current wall clock time
+        ///   @param vmid the ID of the vm_t to set
+        ///
+        constexpr void
+        kvmclock_set(
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u64 const &ns,
+            bsl::safe_u64 const &realtime,
+            bsl::safe_u16 const &vmid) noexcept
+        {
+            this->get_vm(vmid)->kvmclock_set(tsc, ns, realtime);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PP's TSC when the requested vm_t's kvmclock
+        ///     was last set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the PP's TSC when the requested vm_t's kvmclock
+        ///     was last set.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_tsc(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->kvmclock_tsc();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested vm_t's kvmclock in nanoseconds
+        ///     when it was last set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the requested vm_t's kvmclock in nanoseconds
+        ///     when it was last set.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_ns(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->kvmclock_ns();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the wall clock time in nanoseconds at which the
+        ///     requested vm_t's kvmclock was 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the wall clock time in nanoseconds at which the
+        ///     requested vm_t's kvmclock was 0.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_boot_ns(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->kvmclock_boot_ns();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of times the requested vm_t's
+        ///     kvmclock was set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the number of times the requested vm_t's
+        ///     kvmclock was set.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_gen(bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->kvmclock_gen();
+        }
+
         /// <!-- description -->
         ///   @brief Maps memory into the requested vm_t using instructions
         ///     from the provided MDL.
@@ -382,6 +602,641 @@ namespace microv
         {
             return this->get_vm(vmid)->gpa_to_spa(sys, gpa);
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the system physical address that a guest
+        ///     physical address owned by the requested vm_t is mapped to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param sys the bf_syscall_t to use
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the GPA to translate to a SPA
+        ///   @param vmid the ID of the vm_t that owns the GPA
+        ///   @return Returns the resulting SPA, or bsl::safe_u64::failure()
+        ///     if the GPA is not mapped into the requested vm_t.
+        ///
+        [[nodiscard]] constexpr auto
+        translate_gpa(
+            tls_t const &tls,
+            syscall::bf_syscall_t const &sys,
+            page_pool_t const &page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->translate_gpa(tls, sys, page_pool, gpa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to the requested vm_t's PIT. Returns
+        ///     false if the write has to be handed to the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @param vmid the ID of the vm_t to emulate the write for
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pit_write(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            io_access_t const &access,
+            bsl::safe_u64 const &val,
+            bsl::safe_u16 const &vmid) noexcept -> bool
+        {
+            return this->get_vm(vmid)->pit_write(tls, tsc_khz, tsc, access, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from the requested vm_t's PIT. Returns
+        ///     bsl::safe_u64::failure() if the read has to be handed to
+        ///     the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param access the port IO access to emulate
+        ///   @param vmid the ID of the vm_t to emulate the read for
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        pit_read(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            io_access_t const &access,
+            bsl::safe_u16 const &vmid) noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pit_read(tls, tsc_khz, tsc, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vm_t's PIT has produced
+        ///     a tick on IRQ0 that has not been acknowledged yet and marks
+        ///     it as acknowledged.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param vmid the ID of the vm_t to check
+        ///   @return Returns true if IRQ0 should be pulsed, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        pit_ack_irq(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u16 const &vmid) noexcept -> bool
+        {
+            return this->get_vm(vmid)->pit_ack_irq(tls, tsc_khz, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of nanoseconds until the requested
+        ///     vm_t's PIT produces its next tick on IRQ0, 0 if it has
+        ///     produced one that has not been acknowledged yet, or
+        ///     bsl::safe_u64::max_value() if it will not produce one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the number of nanoseconds until the requested
+        ///     vm_t's PIT produces its next tick on IRQ0.
+        ///
+        [[nodiscard]] constexpr auto
+        pit_irq_ns(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pit_irq_ns(tls, tsc_khz, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells MicroV to emulate the requested vm_t's PIC,
+        ///     IOAPIC and PIT instead of handing accesses to them to the
+        ///     root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gs the gs_t to use
+        ///   @param tls the tls_t to use
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param vmid the ID of the vm_t to create the irqchip for
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        irqchip_create(
+            gs_t const &gs,
+            tls_t const &tls,
+            syscall::bf_syscall_t &mut_sys,
+            page_pool_t &mut_page_pool,
+            bsl::safe_u16 const &vmid) noexcept -> bsl::errc_type
+        {
+            return this->get_vm(vmid)->irqchip_create(gs, tls, mut_sys, mut_page_pool);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if MicroV emulates the requested vm_t's
+        ///     PIC, IOAPIC and PIT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns true if MicroV emulates the requested vm_t's
+        ///     PIC, IOAPIC and PIT.
+        ///
+        [[nodiscard]] constexpr auto
+        irqchip_enabled(bsl::safe_u16 const &vmid) const noexcept -> bool
+        {
+            return this->get_vm(vmid)->irqchip_enabled();
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to the requested vm_t's PIC. Returns
+        ///     false if the write has to be handed to the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @param vmid the ID of the vm_t to emulate the write for
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pic_write(
+            tls_t const &tls,
+            io_access_t const &access,
+            bsl::safe_u64 const &val,
+            bsl::safe_u16 const &vmid) noexcept -> bool
+        {
+            return this->get_vm(vmid)->pic_write(tls, access, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from the requested vm_t's PIC. Returns
+        ///     bsl::safe_u64::failure() if the read has to be handed to
+        ///     the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param vmid the ID of the vm_t to emulate the read for
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        pic_read(tls_t const &tls, io_access_t const &access, bsl::safe_u16 const &vmid) noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pic_read(tls, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an MMIO write to the requested vm_t's IOAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gpa the guest physical address being written
+        ///   @param bytes the number of bytes being written
+        ///   @param val the value being written
+        ///   @param vmid the ID of the vm_t to emulate the write for
+        ///
+        constexpr void
+        ioapic_write(
+            tls_t const &tls,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &val,
+            bsl::safe_u16 const &vmid) noexcept
+        {
+            this->get_vm(vmid)->ioapic_write(tls, gpa, bytes, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an MMIO read from the requested vm_t's IOAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gpa the guest physical address being read
+        ///   @param bytes the number of bytes being read
+        ///   @param vmid the ID of the vm_t to emulate the read for
+        ///   @return Returns the value read
+        ///
+        [[nodiscard]] constexpr auto
+        ioapic_read(
+            tls_t const &tls,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u16 const &vmid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->ioapic_read(tls, gpa, bytes);
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles an EOI for the provided vector on the requested
+        ///     vm_t's IOAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vector the vector that was EOI'd
+        ///   @param vmid the ID of the vm_t to EOI
+        ///
+        constexpr void
+        ioapic_eoi(
+            tls_t const &tls, bsl::safe_u64 const &vector, bsl::safe_u16 const &vmid) noexcept
+        {
+            this->get_vm(vmid)->ioapic_eoi(tls, vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Drives the provided GSI of the requested vm_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gsi the GSI to drive
+        ///   @param level the new level of the GSI
+        ///   @param vmid the ID of the vm_t to drive
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        irq_line(
+            tls_t const &tls,
+            bsl::safe_u64 const &gsi,
+            bool const level,
+            bsl::safe_u16 const &vmid) noexcept -> bsl::errc_type
+        {
+            return this->get_vm(vmid)->irq_line(tls, gsi, level);
+        }
+
+        /// <!-- description -->
+        ///   @brief Turns resampling of the provided GSI of the requested
+        ///     vm_t on or off.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gsi the GSI to resample
+        ///   @param enable true to turn resampling on, false to turn it off
+        ///   @param vmid the ID of the vm_t whose GSI is resampled
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        irq_resample(
+            tls_t const &tls,
+            bsl::safe_u64 const &gsi,
+            bool const enable,
+            bsl::safe_u16 const &vmid) noexcept -> bsl::errc_type
+        {
+            return this->get_vm(vmid)->irq_resample(tls, gsi, enable);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a resampled GSI of the requested vm_t
+        ///     was EOI'd and has not been collected yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns true if a resampled GSI of the requested vm_t
+        ///     was EOI'd and has not been collected yet.
+        ///
+        [[nodiscard]] constexpr auto
+        irq_resampled_pending(tls_t const &tls, bsl::safe_u16 const &vmid) const noexcept
+            -> bool
+        {
+            return this->get_vm(vmid)->irq_resampled_pending(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the resampled GSIs of the requested vm_t that
+        ///     were EOI'd since the last call, and forgets them.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns the resampled GSIs of the requested vm_t that
+        ///     were EOI'd since the last call
+        ///
+        [[nodiscard]] constexpr auto
+        irq_resampled_take(tls_t const &tls, bsl::safe_u16 const &vmid) noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->irq_resampled_take(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the next interrupt the requested vm_t's IOAPIC
+        ///     has for the VS with the provided APIC ID and marks it as
+        ///     acknowledged, or bsl::safe_u64::failure() if there is
+        ///     nothing to deliver. The vector has IOAPIC_RTE_LEVEL set if
+        ///     it is level triggered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @param vmid the ID of the vm_t to acknowledge from
+        ///   @return Returns the interrupt to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        ioapic_ack(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->ioapic_ack(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Posts a fixed IPI sent with KVM_HC_SEND_IPI to the VS of
+        ///     the requested vm_t with the provided APIC ID. Returns false
+        ///     if no VS can have the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to send the IPI to
+        ///   @param vector the vector of the IPI
+        ///   @param vmid the ID of the vm_t to send the IPI in
+        ///   @return Returns true if the IPI was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_ipi_send(
+            tls_t const &tls,
+            bsl::safe_u64 const &apic_id,
+            bsl::safe_u64 const &vector,
+            bsl::safe_u16 const &vmid) noexcept -> bool
+        {
+            return this->get_vm(vmid)->pv_ipi_send(tls, apic_id, vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Posts an NMI sent with KVM_HC_SEND_IPI to the VS of the
+        ///     requested vm_t with the provided APIC ID. Returns false if
+        ///     no VS can have the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to send the NMI to
+        ///   @param vmid the ID of the vm_t to send the NMI in
+        ///   @return Returns true if the NMI was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_nmi_send(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bool
+        {
+            return this->get_vm(vmid)->pv_nmi_send(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Kicks the VS of the requested vm_t with the provided
+        ///     APIC ID out of a HLT. Returns false if no VS can have the
+        ///     provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to kick
+        ///   @param vmid the ID of the vm_t to kick in
+        ///   @return Returns true if the kick was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_kick(tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bool
+        {
+            return this->get_vm(vmid)->pv_kick(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector sent with KVM_HC_SEND_IPI to
+        ///     the VS with the provided APIC ID and marks it as delivered,
+        ///     or bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @param vmid the ID of the vm_t to acknowledge from
+        ///   @return Returns the vector to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_ipi_ack(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pv_ipi_ack(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an NMI was sent with KVM_HC_SEND_IPI to
+        ///     the VS with the provided APIC ID, and marks it as delivered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @param vmid the ID of the vm_t to acknowledge from
+        ///   @return Returns true if an NMI has to be delivered
+        ///
+        [[nodiscard]] constexpr auto
+        pv_nmi_ack(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bool
+        {
+            return this->get_vm(vmid)->pv_nmi_ack(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the VS with the provided APIC ID was
+        ///     kicked with KVM_HC_KICK_CPU, and consumes the kick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @param vmid the ID of the vm_t to acknowledge from
+        ///   @return Returns true if the VS was kicked
+        ///
+        [[nodiscard]] constexpr auto
+        pv_kick_ack(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bool
+        {
+            return this->get_vm(vmid)->pv_kick_ack(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the VS with the provided APIC ID as halted in the
+        ///     root VM, so that IPIs, NMIs and kicks sent to it from now on
+        ///     record a wakeup (see pv_wakeup_take). Returns false without
+        ///     marking it if one was already sent to it, in which case it
+        ///     should not halt at all.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS halting
+        ///   @param vmid the ID of the vm_t the VS belongs to
+        ///   @return Returns true if the VS was marked as halted, false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_halt(tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+            -> bool
+        {
+            return this->get_vm(vmid)->pv_halt(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the VS with the provided APIC ID as no longer
+        ///     halted. This is called each time the VS is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS being run
+        ///   @param vmid the ID of the vm_t the VS belongs to
+        ///
+        constexpr void
+        pv_unhalt(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u16 const &vmid) noexcept
+        {
+            this->get_vm(vmid)->pv_unhalt(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an IPI, NMI or kick was sent to a VS of
+        ///     the requested vm_t that is halted in the root VM, and has
+        ///     not been collected using pv_wakeup_take() yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns true if a wakeup is pending, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_wakeup_pending(tls_t const &tls, bsl::safe_u16 const &vmid) const noexcept -> bool
+        {
+            return this->get_vm(vmid)->pv_wakeup_pending(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an IPI, NMI or kick was sent to a VS of
+        ///     the requested vm_t that is halted in the root VM since this
+        ///     was last called, and consumes the wakeup.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns true if the root VM has to wake up the
+        ///     requested vm_t's halted VSs, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_wakeup_take(tls_t const &tls, bsl::safe_u16 const &vmid) noexcept -> bool
+        {
+            return this->get_vm(vmid)->pv_wakeup_take(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the vector of the next interrupt the requested
+        ///     vm_t's PIC has and marks it as acknowledged, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the vm_t to acknowledge from
+        ///   @return Returns the vector to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        pic_ack(tls_t const &tls, bsl::safe_u16 const &vmid) noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->pic_ack(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to the requested vm_t's UART. Returns
+        ///     false if the write has to be handed to the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @param vmid the ID of the vm_t to emulate the write for
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        uart_write(
+            tls_t const &tls,
+            io_access_t const &access,
+            bsl::safe_u64 const &val,
+            bsl::safe_u16 const &vmid) noexcept -> bool
+        {
+            return this->get_vm(vmid)->uart_write(tls, access, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from the requested vm_t's UART. Returns
+        ///     bsl::safe_u64::failure() if the read has to be handed to
+        ///     the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param vmid the ID of the vm_t to emulate the read for
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        uart_read(tls_t const &tls, io_access_t const &access, bsl::safe_u16 const &vmid) noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->uart_read(tls, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vm_t's UART has
+        ///     transmitted bytes that have not yet been handed to the root
+        ///     VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the vm_t to query
+        ///   @return Returns true if the requested vm_t's UART has
+        ///     transmitted bytes that have not yet been handed to the root
+        ///     VM.
+        ///
+        [[nodiscard]] constexpr auto
+        uart_tx_pending(tls_t const &tls, bsl::safe_u16 const &vmid) const noexcept -> bool
+        {
+            return this->get_vm(vmid)->uart_tx_pending(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the requested vm_t's buffered UART bytes into the
+        ///     provided mv_exit_io_t and returns the number of bytes moved.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param mut_exit_io the mv_exit_io_t to fill in
+        ///   @param vmid the ID of the vm_t to flush
+        ///   @return Returns the number of bytes moved
+        ///
+        [[nodiscard]] constexpr auto
+        uart_flush(
+            tls_t const &tls,
+            hypercall::mv_exit_io_t &mut_exit_io,
+            bsl::safe_u16 const &vmid) noexcept -> bsl::safe_u64
+        {
+            return this->get_vm(vmid)->uart_flush(tls, mut_exit_io);
+        }
     };
 }
 
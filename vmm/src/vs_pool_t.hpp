@@ -26,13 +26,20 @@
 #define VS_POOL_T_HPP
 
 #include <bf_syscall_t.hpp>
+#include <emulated_decoder_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
 #include <lock_guard_t.hpp>
+#include <mmio_access_t.hpp>
 #include <mv_exit_reason_t.hpp>
+#include <mv_lapic_state_t.hpp>
 #include <mv_run_t.hpp>
+#include <mv_stats_t.hpp>
+#include <mv_vs_state_t.hpp>
 #include <page_pool_t.hpp>
 #include <pp_pool_t.hpp>
+#include <pvclock_vcpu_time_info_t.hpp>
 #include <running_status_t.hpp>
 #include <spinlock_t.hpp>
 #include <tls_t.hpp>
@@ -151,6 +158,10 @@ namespace microv
         ///   @param tsc_khz the starting TSC frequency of the newly created vs_t
         ///   @param slpt_spa the system physical address of the second level
         ///     page tables to use.
+        ///   @param msrpm_spa the system physical address of the MSR
+        ///     permissions map to use.
+        ///   @param iopm_spa the system physical address of the IO
+        ///     permissions map to use.
         ///   @return Returns ID of the newly allocated vs_t. Returns
         ///     bsl::safe_u16::failure() on failure.
         ///
@@ -165,7 +176,9 @@ namespace microv
             bsl::safe_u16 const &vpid,
             bsl::safe_u16 const &ppid,
             bsl::safe_u64 const &tsc_khz,
-            bsl::safe_u64 const &slpt_spa) noexcept -> bsl::safe_u16
+            bsl::safe_u64 const &slpt_spa,
+            bsl::safe_u64 const &msrpm_spa,
+            bsl::safe_u64 const &iopm_spa) noexcept -> bsl::safe_u16
         {
             lock_guard_t mut_lock{tls, m_lock};
 
@@ -175,8 +188,36 @@ namespace microv
                 return bsl::safe_u16::failure();
             }
 
+            /// NOTE:
+            /// - The APIC ID of a vs_t is the number of vs_ts the VM
+            ///   already has, so the first vs_t created for a VM is its
+            ///   BSP (APIC ID 0), the same as vCPU 0 with KVM.
+            ///
+
+            bsl::safe_u64 mut_apic_id{};
+            for (auto const &vs : m_pool) {
+                if (vs.is_allocated() && (vs.assigned_vm() == vmid)) {
+                    ++mut_apic_id;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
             return this->get_vs(vsid)->allocate(
-                gs, tls, mut_sys, mut_page_pool, intrinsic, vmid, vpid, ppid, tsc_khz, slpt_spa);
+                gs,
+                tls,
+                mut_sys,
+                mut_page_pool,
+                intrinsic,
+                vmid,
+                vpid,
+                ppid,
+                mut_apic_id.checked(),
+                tsc_khz,
+                slpt_spa,
+                msrpm_spa,
+                iopm_spa);
         }
 
         /// <!-- description -->
@@ -242,36 +283,114 @@ namespace microv
         }
 
         /// <!-- description -->
-        ///   @brief Sets the requested vs_t as active
+        ///   @brief Sets the requested vs_t as active. If possible, loading
+        ///     the vs_t's extended state is deferred until it is actually
+        ///     used, otherwise it is loaded here. A guest's TSC is also
+        ///     kept from going backwards if it was migrated.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
+        ///   @param mut_sys the bf_syscall_t to use
         ///   @param intrinsic the intrinsic_t to use
         ///   @param vsid the ID of the vs_t to set as active
         ///
         constexpr void
-        set_active(tls_t &mut_tls, intrinsic_t const &intrinsic, bsl::safe_u16 const &vsid) noexcept
+        set_active(
+            tls_t &mut_tls,
+            syscall::bf_syscall_t &mut_sys,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vsid) noexcept
         {
-            this->get_vs(vsid)->set_active(mut_tls, intrinsic);
+            auto *const pmut_vs{this->get_vs(vsid)};
+            pmut_vs->set_active(mut_tls);
+
+            if (!mut_sys.is_vs_a_root_vs(vsid)) {
+                pmut_vs->tsc_load(mut_sys, intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (pmut_vs->fpu_try_lazy(mut_sys)) {
+                return;
+            }
+
+            this->fpu_load(mut_tls, mut_sys, intrinsic, vsid);
         }
 
         /// <!-- description -->
-        ///   @brief Sets the requested vs_t as inactive
+        ///   @brief Sets the requested vs_t as inactive. The root VS's
+        ///     extended state is left loaded, and is only saved if a guest
+        ///     actually needs the FPU. A guest's extended state is always
+        ///     saved here (if it was loaded), as nothing traps the root VS's
+        ///     use of the FPU. A guest's TSC is recorded so that set_active()
+        ///     can tell if it went backwards.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
+        ///   @param mut_sys the bf_syscall_t to use
         ///   @param intrinsic the intrinsic_t to use
         ///   @param vsid the ID of the vs_t to set as inactive
         ///
         constexpr void
         set_inactive(
-            tls_t &mut_tls, intrinsic_t const &intrinsic, bsl::safe_u16 const &vsid) noexcept
+            tls_t &mut_tls,
+            syscall::bf_syscall_t &mut_sys,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vsid) noexcept
         {
             if (bsl::unlikely(vsid == syscall::BF_INVALID_ID)) {
                 return;
             }
 
-            this->get_vs(vsid)->set_inactive(mut_tls, intrinsic);
+            auto *const pmut_vs{this->get_vs(vsid)};
+            pmut_vs->set_inactive(mut_tls);
+
+            if (mut_sys.is_vs_a_root_vs(vsid)) {
+                return;
+            }
+
+            pmut_vs->tsc_save(mut_sys, intrinsic);
+
+            if (vsid == mut_tls.fpu_vsid) {
+                pmut_vs->fpu_save(mut_tls, intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Loads the requested vs_t's extended state into the CPU.
+        ///     If another vs_t owns the CPU's extended state, it is saved
+        ///     first. If the requested vs_t already owns the CPU's extended
+        ///     state, this function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vsid the ID of the vs_t whose extended state to load
+        ///
+        constexpr void
+        fpu_load(
+            tls_t &mut_tls,
+            syscall::bf_syscall_t &mut_sys,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            if (vsid == mut_tls.fpu_vsid) {
+                return;
+            }
+
+            if (syscall::BF_INVALID_ID != mut_tls.fpu_vsid) {
+                this->get_vs(mut_tls.fpu_vsid)->fpu_save(mut_tls, intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->get_vs(vsid)->fpu_restore(mut_tls, mut_sys, intrinsic);
         }
 
         /// <!-- description -->
@@ -384,6 +503,20 @@ namespace microv
             return bsl::safe_u16::failure();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the APIC ID of the requested vs_t, as stored in
+        ///     the ID register of its emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the APIC ID of the requested vs_t
+        ///
+        [[nodiscard]] constexpr auto
+        apic_id(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->apic_id();
+        }
+
         /// <!-- description -->
         ///   @brief Migrates the requested vs_t to the current PP. If the
         ///     requested vs_t is already assigned to the current PP, this
@@ -457,7 +590,7 @@ namespace microv
         reg_get(
             syscall::bf_syscall_t const &sys,
             bsl::safe_u64 const &reg,
-            bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+            bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
         {
             return this->get_vs(vsid)->reg_get(sys, reg);
         }
@@ -498,7 +631,7 @@ namespace microv
         reg_get_list(
             syscall::bf_syscall_t const &sys,
             hypercall::mv_rdl_t &mut_rdl,
-            bsl::safe_u16 const &vsid) const noexcept -> bsl::errc_type
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
         {
             return this->get_vs(vsid)->reg_get_list(sys, mut_rdl);
         }
@@ -605,7 +738,7 @@ namespace microv
         msr_get(
             syscall::bf_syscall_t const &sys,
             bsl::safe_u64 const &msr,
-            bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+            bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
         {
             return this->get_vs(vsid)->msr_get(sys, msr);
         }
@@ -646,7 +779,7 @@ namespace microv
         msr_get_list(
             syscall::bf_syscall_t const &sys,
             hypercall::mv_rdl_t &mut_rdl,
-            bsl::safe_u16 const &vsid) const noexcept -> bsl::errc_type
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
         {
             return this->get_vs(vsid)->msr_get_list(sys, mut_rdl);
         }
@@ -727,9 +860,10 @@ namespace microv
         }
 
         /// <!-- description -->
-        ///   @brief Queues an interrupt for injection when this vs_t is
-        ///     capable of injecting interrupts. If the queue is full, this
-        ///     function will fail.
+        ///   @brief Queues an ExtINT interrupt (i.e., an interrupt from the
+        ///     PIC, or one queued from userspace) for injection when the
+        ///     requested vs_t is capable of injecting interrupts. If an
+        ///     ExtINT interrupt is already waiting, this function will fail.
         ///
         /// <!-- notes -->
         ///   @note You can only queue an interrupt for a vs_t that is assigned
@@ -737,11 +871,11 @@ namespace microv
         ///     interrupt for another vs_t. Instead, you need to IPI the other
         ///     PP, and queue the interrupt into the vs_t from the PP the vs_t
         ///     is assigned to. This is done to ensure that not only is there
-        ///     no need for a lock on the queue, but more importantly, on Intel
-        ///     you cannot actually do interrupt/exception queuing on a vs_t
-        ///     on a remote PP as such an action is undefined by Intel, and
-        ///     we should not be migrating a vs_t to our current PP every time
-        ///     that we need to inject an interrupt.
+        ///     no need for a lock on the LAPIC, but more importantly, on
+        ///     Intel you cannot actually do interrupt/exception queuing on a
+        ///     vs_t on a remote PP as such an action is undefined by Intel,
+        ///     and we should not be migrating a vs_t to our current PP every
+        ///     time that we need to inject an interrupt.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_sys the bf_syscall_t to use
@@ -760,16 +894,1060 @@ namespace microv
         }
 
         /// <!-- description -->
-        ///   @brief Returns the requested vs_t's TSC frequency in KHz.
+        ///   @brief Accepts a fixed interrupt into the requested vs_t's
+        ///     emulated LAPIC. Like queue_interrupt, this can only be
+        ///     called on the PP the vs_t is assigned to.
         ///
         /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vector the vector to accept
+        ///   @param level true if the interrupt is level triggered
         ///   @param vsid the ID of the vs_t to query
-        ///   @return Returns the requested vs_t's TSC frequency in KHz.
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        tsc_khz_get(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        queue_lapic_interrupt(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &vector,
+            bool const level,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
         {
-            return this->get_vs(vsid)->tsc_khz_get();
+            return this->get_vs(vsid)->queue_lapic_interrupt(mut_sys, vector, level);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t has an interrupt
+        ///     that can be injected.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t has an interrupt
+        ///     that can be injected.
+        ///
+        [[nodiscard]] constexpr auto
+        interrupt_pending(bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->interrupt_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t is waiting on an
+        ///     ExtINT interrupt to be injected.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t is waiting on an
+        ///     ExtINT interrupt to be injected.
+        ///
+        [[nodiscard]] constexpr auto
+        extint_pending(bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->extint_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t's emulated LAPIC
+        ///     takes interrupts from the PIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t's emulated LAPIC
+        ///     takes interrupts from the PIC.
+        ///
+        [[nodiscard]] constexpr auto
+        accepts_extint(bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->accepts_extint();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an interrupt can be injected into the
+        ///     requested vs_t right now.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if an interrupt can be injected into the
+        ///     requested vs_t right now.
+        ///
+        [[nodiscard]] constexpr auto
+        interruptible(syscall::bf_syscall_t const &sys, bsl::safe_u16 const &vsid) noexcept
+            -> bool
+        {
+            return this->get_vs(vsid)->interruptible(sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the arch specific information of the requested
+        ///     vs_t's last VMExit (Intel's exit qualification or AMD's
+        ///     EXITINFO1).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the arch specific information of the requested
+        ///     vs_t's last VMExit.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info(syscall::bf_syscall_t const &sys, bsl::safe_u16 const &vsid) const noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->exit_info(sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the event that will be injected into the
+        ///     requested vs_t on its next VMEntry (Intel's VM-entry
+        ///     interruption-information field or AMD's EVENTINJ field).
+        ///     Bit 31 is set if there is such an event.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the event that will be injected into the
+        ///     requested vs_t on its next VMEntry.
+        ///
+        [[nodiscard]] constexpr auto
+        pending_event(syscall::bf_syscall_t const &sys, bsl::safe_u16 const &vsid) const noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->pending_event(sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores the events that are pending for the requested
+        ///     vs_t in the provided mv_vs_state_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_state the mv_vs_state_t to store the events in
+        ///   @param vsid the ID of the vs_t to query
+        ///
+        constexpr void
+        events_get(
+            syscall::bf_syscall_t const &sys,
+            hypercall::mv_vs_state_t &mut_state,
+            bsl::safe_u16 const &vsid) const noexcept
+        {
+            this->get_vs(vsid)->events_get(sys, mut_state);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the events that are pending for the requested
+        ///     vs_t from the provided mv_vs_state_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param state the mv_vs_state_t to get the events from
+        ///   @param vsid the ID of the vs_t to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        events_set(
+            syscall::bf_syscall_t &mut_sys,
+            hypercall::mv_vs_state_t const &state,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->events_set(mut_sys, state);
+        }
+
+        /// <!-- description -->
+        ///   @brief Injects the highest priority pending interrupt into the
+        ///     requested vs_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to inject into
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        inject_pending_interrupt(syscall::bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept
+            -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->inject_pending_interrupt(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided GPA is in the MMIO page of
+        ///     the requested vs_t's emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address to query
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the provided GPA is in the MMIO page of
+        ///     the requested vs_t's emulated LAPIC.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_handles(bsl::safe_u64 const &gpa, bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->lapic_handles(gpa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a read from the requested vs_t's emulated
+        ///     LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address being read
+        ///   @param tsc the current value of the TSC
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the value that was read
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_read(
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->lapic_read(gpa, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a write to the requested vs_t's emulated
+        ///     LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param gpa the guest physical address being written
+        ///   @param val the value being written
+        ///   @param tsc the current value of the TSC
+        ///   @param vsid the ID of the vs_t to write to
+        ///   @return Returns the vector to forward to the IOAPIC if the
+        ///     write was an EOI for a level triggered vector, or
+        ///     bsl::safe_u64::failure() otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_write(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &val,
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->lapic_write(mut_sys, gpa, val, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the registers of the requested vs_t's emulated
+        ///     LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_state where to store the LAPIC's registers
+        ///   @param vsid the ID of the vs_t to query
+        ///
+        constexpr void
+        lapic_get_all(
+            syscall::bf_syscall_t const &sys,
+            hypercall::mv_lapic_state_t &mut_state,
+            bsl::safe_u16 const &vsid) const noexcept
+        {
+            this->get_vs(vsid)->lapic_get_all(sys, mut_state);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the registers of the requested vs_t's emulated
+        ///     LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param state the registers to set the LAPIC to
+        ///   @param vsid the ID of the vs_t to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_set_all(
+            syscall::bf_syscall_t &mut_sys,
+            hypercall::mv_lapic_state_t const &state,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->lapic_set_all(mut_sys, state);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the requested vs_t to let the CPU accelerate its
+        ///     emulated LAPIC (TPR shadow/APICv on Intel, AVIC on AMD)
+        ///     if the CPU supports it. Does nothing if the vs_t is
+        ///     already accelerated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to accelerate
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_accelerate(syscall::bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept
+            -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->lapic_accelerate(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the requested vs_t that the CPU changed its
+        ///     emulated LAPIC's registers behind its back (e.g. the guest
+        ///     lowered the TPR), so that it can re-evaluate which
+        ///     interrupts are pending.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to sync
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_sync(syscall::bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) const noexcept
+            -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->lapic_sync(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the guest physical address of the MMIO page of
+        ///     the requested vs_t's emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the guest physical address of the MMIO page of
+        ///     the requested vs_t's emulated LAPIC.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_base(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->lapic_base();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TPR of the requested vs_t's emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the TPR of the requested vs_t's emulated LAPIC.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_tpr(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->lapic_tpr();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the TPR of the requested vs_t's emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param val the value to set the TPR to
+        ///   @param vsid the ID of the vs_t to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_set_tpr(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &val,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->lapic_set_tpr(mut_sys, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Delivers the requested vs_t's LAPIC timer interrupt if
+        ///     the timer has expired, and (re)arms the hardware timer that
+        ///     tracks it, if there is one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param tsc the current value of the TSC
+        ///   @param vsid the ID of the vs_t to update
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_timer_update(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->lapic_timer_update(mut_sys, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of nanoseconds until the requested
+        ///     vs_t's LAPIC timer fires, 0 if it already has, or
+        ///     bsl::safe_u64::max_value() if it is not armed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current value of the TSC
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the number of nanoseconds until the requested
+        ///     vs_t's LAPIC timer fires.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_timer_ns(bsl::safe_u64 const &tsc, bsl::safe_u16 const &vsid) const noexcept
+            -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->lapic_timer_ns(tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives the requested vs_t the PAUSE-loop exiting
+        ///     thresholds of its VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param gap the max number of cycles between two PAUSEs of a loop
+        ///   @param window the max number of cycles a loop can run for
+        ///   @param vsid the ID of the vs_t to update
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pause_exiting_update(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &gap,
+            bsl::safe_u64 const &window,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->pause_exiting_update(mut_sys, gap, window);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of TSC ticks a HLT from the
+        ///     requested vs_t should be polled for.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the number of TSC ticks a HLT from the
+        ///     requested vs_t should be polled for.
+        ///
+        [[nodiscard]] constexpr auto
+        halt_poll_window(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->halt_poll_window();
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a HLT from the requested vs_t that was woken
+        ///     up while polling.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cycles the number of cycles spent polling
+        ///   @param vsid the ID of the vs_t that halted
+        ///
+        constexpr void
+        halt_poll_hit(bsl::safe_u64 const &cycles, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->halt_poll_hit(cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a HLT from the requested vs_t that is being
+        ///     handed to the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cycles the number of cycles spent polling
+        ///   @param tsc the current TSC
+        ///   @param vsid the ID of the vs_t that halted
+        ///
+        constexpr void
+        halt_poll_miss(
+            bsl::safe_u64 const &cycles,
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->halt_poll_miss(cycles, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the requested vs_t that it is about to run
+        ///     again, adjusting its halt-poll window if it was halted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current TSC
+        ///   @param observable true if the wakeup could have been seen
+        ///     while polling
+        ///   @param vsid the ID of the vs_t to run
+        ///
+        constexpr void
+        halt_poll_wakeup(
+            bsl::safe_u64 const &tsc, bool const observable, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->halt_poll_wakeup(tsc, observable);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a VMExit in the requested vs_t's statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles spent handling the VMExit
+        ///   @param vsid the ID of the vs_t to count the VMExit for
+        ///
+        constexpr void
+        stats_add_exit(
+            bsl::safe_u64 const &reason,
+            bsl::safe_u64 const &cycles,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->stats_add_exit(reason, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hypercall in the requested vs_t's statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the hypercall
+        ///   @param cycles the number of cycles spent handling the hypercall
+        ///   @param vsid the ID of the vs_t to count the hypercall for
+        ///
+        constexpr void
+        stats_add_hypercall(
+            bsl::safe_u64 const &slot,
+            bsl::safe_u64 const &cycles,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->stats_add_hypercall(slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested vs_t's statistics of the
+        ///     provided type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type the MV_STATS_TYPE of the statistics to return
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the requested statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats_get(bsl::safe_u64 const &type, bsl::safe_u16 const &vsid) const noexcept
+            -> hypercall::mv_stats_t const *
+        {
+            return this->get_vs(vsid)->stats_get(type);
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes the registers that were set through the
+        ///     requested vs_t's register cache back to the microkernel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to flush
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reg_cache_flush(syscall::bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept
+            -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->reg_cache_flush(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the requested register of the
+        ///     requested vs_t using its register cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param reg the register to read
+        ///   @param vsid the ID of the vs_t to read from
+        ///   @return Returns the value of the requested register, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        reg_cache_read(
+            syscall::bf_syscall_t const &sys,
+            syscall::bf_reg_t const reg,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->reg_cache_read(sys, reg);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the requested register of the
+        ///     requested vs_t using its register cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param reg the register to write
+        ///   @param val the value to write
+        ///   @param vsid the ID of the vs_t to write to
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reg_cache_write(
+            syscall::bf_syscall_t &mut_sys,
+            syscall::bf_reg_t const reg,
+            bsl::safe_u64 const &val,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->reg_cache_write(mut_sys, reg, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Drops the requested vs_t's cached registers.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to invalidate
+        ///
+        constexpr void
+        reg_cache_invalidate(bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->reg_cache_invalidate();
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the SPA of the requested vs_t's exit page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vsid the ID of the vs_t to clear the exit page of
+        ///
+        constexpr void
+        clr_exit_page_spa(syscall::bf_syscall_t &mut_sys, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->clr_exit_page_spa(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the SPA of the requested vs_t's exit page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param spa the system physical address of the exit page
+        ///   @param vsid the ID of the vs_t to set the exit page of
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_exit_page_spa(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &spa,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->set_exit_page_spa(mut_sys, spa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested vs_t's exit page as a T *, or a
+        ///     nullptr if it does not have one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of exit record to return
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the requested vs_t's exit page as a T *, or a
+        ///     nullptr if it does not have one.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        exit_page(bsl::safe_u16 const &vsid) const noexcept -> T *
+        {
+            return this->get_vs(vsid)->exit_page<T>();
+        }
+
+        /// <!-- description -->
+        ///   @brief Decodes the instruction that generated an MMIO access
+        ///     from the requested vs_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param bytes the instruction bytes to decode
+        ///   @param num the total number of valid bytes in "bytes"
+        ///   @param mut_access where to store the results of the decode
+        ///   @param vsid the ID of the vs_t that generated the MMIO access
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_decode(
+            syscall::bf_syscall_t const &sys,
+            instruction_bytes_t const &bytes,
+            bsl::safe_u64 const &num,
+            mmio_access_t &mut_access,
+            bsl::safe_u16 const &vsid) const noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->mmio_decode(sys, bytes, num, mut_access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the data that a decoded MMIO write from the
+        ///     requested vs_t will write to memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param access the decoded MMIO write
+        ///   @param vsid the ID of the vs_t that generated the MMIO access
+        ///   @return Returns the data that a decoded MMIO write will write
+        ///     to memory, or bsl::safe_u64::failure() on error.
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_write_data(
+            syscall::bf_syscall_t const &sys,
+            mmio_access_t const &access,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->mmio_write_data(sys, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a decoded MMIO read that must be completed
+        ///     the next time the requested vs_t is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param access the decoded MMIO read
+        ///   @param vsid the ID of the vs_t that generated the MMIO access
+        ///
+        constexpr void
+        mmio_set_pending_read(mmio_access_t const &access, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->mmio_set_pending_read(access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t has an MMIO read
+        ///     that is waiting for its data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t has an MMIO read
+        ///     that is waiting for its data.
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_read_pending(bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->mmio_read_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes the requested vs_t's pending MMIO read by
+        ///     writing the provided data to the destination register.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param data the data that was read from the MMIO region
+        ///   @param vsid the ID of the vs_t to complete
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_complete_read(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &data,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->mmio_complete_read(mut_sys, data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records an IN/INS access that must be completed the
+        ///     next time the requested vs_t is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param access the IN/INS access to record
+        ///   @param vsid the ID of the vs_t that generated the IO access
+        ///
+        constexpr void
+        io_set_pending_in(io_access_t const &access, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->io_set_pending_in(access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t has an IN/INS access
+        ///     that is waiting for its data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t has an IN/INS access
+        ///     that is waiting for its data.
+        ///
+        [[nodiscard]] constexpr auto
+        io_in_pending(bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->io_in_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the IN/INS access the requested vs_t is
+        ///     waiting on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the IN/INS access the requested vs_t is
+        ///     waiting on.
+        ///
+        [[nodiscard]] constexpr auto
+        io_pending_in(bsl::safe_u16 const &vsid) const noexcept -> io_access_t
+        {
+            return this->get_vs(vsid)->io_pending_in();
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes the requested vs_t's pending IN/INS access.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param data the data that was read from the port
+        ///   @param vsid the ID of the vs_t to complete
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        io_complete_in(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &data,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->io_complete_in(mut_sys, data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested vs_t's TSC frequency in KHz.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the requested vs_t's TSC frequency in KHz.
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_khz_get(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->tsc_khz_get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TSC frequency in KHz of the PP the requested
+        ///     vs_t runs on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the TSC frequency in KHz of the PP the requested
+        ///     vs_t runs on.
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_host_khz_get(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->tsc_host_khz_get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the requested vs_t's TSC frequency in KHz.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param tsc_khz the TSC frequency in KHz to set
+        ///   @param vsid the ID of the vs_t to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_set_khz(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->tsc_set_khz(mut_sys, tsc_khz);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the requested vs_t's TSC offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the requested vs_t's TSC offset.
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_offset_get(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->tsc_offset_get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the requested vs_t's TSC offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param offset the TSC offset to set
+        ///   @param vsid the ID of the vs_t to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_offset_set(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &offset,
+            bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->tsc_offset_set(mut_sys, offset);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t's pvclock has to be
+        ///     written before it runs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gen the VM's current kvmclock generation
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t's pvclock has to be
+        ///     written before it runs.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_pending(bsl::safe_u64 const &gen, bsl::safe_u16 const &vsid) const noexcept
+            -> bool
+        {
+            return this->get_vs(vsid)->kvmclock_pending(gen);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the requested vs_t's pvclock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the GPA of the requested vs_t's pvclock.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_gpa(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->kvmclock_gpa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns what the requested vs_t's pvclock has to contain
+        ///     and marks it as up to date.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the PP's TSC when the VM's kvmclock was set
+        ///   @param ns the VM's kvmclock in nanoseconds at "tsc"
+        ///   @param gen the VM's current kvmclock generation
+        ///   @param vsid the ID of the vs_t to update
+        ///   @return Returns the new contents of the requested vs_t's pvclock
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_update(
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u64 const &ns,
+            bsl::safe_u64 const &gen,
+            bsl::safe_u16 const &vsid) noexcept -> pvclock_vcpu_time_info_t
+        {
+            return this->get_vs(vsid)->kvmclock_update(tsc, ns, gen);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets PVCLOCK_GUEST_STOPPED the next time the requested
+        ///     vs_t's pvclock is written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to stop
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_stop(bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+        {
+            return this->get_vs(vsid)->kvmclock_stop();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the requested vs_t's kvm_steal_time,
+        ///     or 0 if the guest has not enabled steal time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the GPA of the requested vs_t's kvm_steal_time,
+        ///     or 0 if the guest has not enabled steal time.
+        ///
+        [[nodiscard]] constexpr auto
+        kvm_steal_time_gpa(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->kvm_steal_time_gpa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the requested vs_t's PV EOI word, or
+        ///     0 if the guest has not enabled PV EOI.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns the GPA of the requested vs_t's PV EOI word, or
+        ///     0 if the guest has not enabled PV EOI.
+        ///
+        [[nodiscard]] constexpr auto
+        kvm_pv_eoi_gpa(bsl::safe_u16 const &vsid) const noexcept -> bsl::safe_u64
+        {
+            return this->get_vs(vsid)->kvm_pv_eoi_gpa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t's guest may skip
+        ///     its next EOI, in which case the PV EOI is marked as pending.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to arm
+        ///   @return Returns true if the guest's PV EOI word must be set
+        ///     before the requested vs_t runs.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_eoi_arm(bsl::safe_u16 const &vsid) noexcept -> bool
+        {
+            return this->get_vs(vsid)->pv_eoi_arm();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested vs_t has a pending PV EOI.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to query
+        ///   @return Returns true if the requested vs_t has a pending PV EOI.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_eoi_pending(bsl::safe_u16 const &vsid) const noexcept -> bool
+        {
+            return this->get_vs(vsid)->pv_eoi_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes the requested vs_t's pending PV EOI.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param eoi true if the guest cleared its PV EOI word
+        ///   @param vsid the ID of the vs_t to complete the PV EOI for
+        ///
+        constexpr void
+        pv_eoi_complete(bool const eoi, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->pv_eoi_complete(eoi);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested VM has a vs_t with the
+        ///     provided APIC ID, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vmid the ID of the VM to query
+        ///   @param apic_id the APIC ID to look for
+        ///   @return Returns true if the requested VM has a vs_t with the
+        ///     provided APIC ID, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        has_apic_id(
+            tls_t const &tls,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &apic_id) const noexcept -> bool
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            for (auto const &vs : m_pool) {
+                if (vs.is_allocated() && (vs.assigned_vm() == vmid) && (vs.apic_id() == apic_id)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
         }
     };
 }
@@ -27,6 +27,7 @@
 
 #include <bf_debug_ops.hpp>
 #include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_avic.hpp>
 #include <dispatch_vmexit_cpuid.hpp>
 #include <dispatch_vmexit_cr.hpp>
 #include <dispatch_vmexit_dr.hpp>
@@ -35,10 +36,16 @@
 #include <dispatch_vmexit_intr.hpp>
 #include <dispatch_vmexit_intr_window.hpp>
 #include <dispatch_vmexit_io.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_kvm_pv_helpers.hpp>
 #include <dispatch_vmexit_mmio.hpp>
 #include <dispatch_vmexit_nmi.hpp>
+#include <dispatch_vmexit_pause.hpp>
 #include <dispatch_vmexit_rdmsr.hpp>
 #include <dispatch_vmexit_sipi.hpp>
+#include <dispatch_vmexit_stats_helpers.hpp>
+#include <dispatch_vmexit_sync_regs_helpers.hpp>
+#include <dispatch_vmexit_trace_helpers.hpp>
 #include <dispatch_vmexit_triple_fault.hpp>
 #include <dispatch_vmexit_unknown.hpp>
 #include <dispatch_vmexit_vmcall.hpp>
@@ -62,14 +69,28 @@ namespace microv
     constexpr auto EXIT_REASON_INTR{0x60_u64};
     /// @brief defines the NMI exit reason code
     constexpr auto EXIT_REASON_NMI{0x61_u64};
+    /// @brief defines the VINTR exit reason code
+    constexpr auto EXIT_REASON_VINTR{0x64_u64};
     /// @brief defines the NMI exit reason code
     constexpr auto EXIT_REASON_CR0_SPECIAL{0x65_u64};
     /// @brief defines the CPUID exit reason code
     constexpr auto EXIT_REASON_CPUID{0x72_u64};
+    /// @brief defines the PAUSE exit reason code
+    constexpr auto EXIT_REASON_PAUSE{0x77_u64};
+    /// @brief defines the HLT exit reason code
+    constexpr auto EXIT_REASON_HLT{0x78_u64};
     /// @brief defines the IO exit reason code
     constexpr auto EXIT_REASON_IO{0x7B_u64};
+    /// @brief defines the MSR exit reason code
+    constexpr auto EXIT_REASON_MSR{0x7C_u64};
     /// @brief defines the VMCALL exit reason code
     constexpr auto EXIT_REASON_VMCALL{0x81_u64};
+    /// @brief defines the NPF exit reason code
+    constexpr auto EXIT_REASON_NPF{0x400_u64};
+    /// @brief defines the AVIC incomplete IPI exit reason code
+    constexpr auto EXIT_REASON_AVIC_INCOMPLETE_IPI{0x401_u64};
+    /// @brief defines the AVIC unaccelerated access exit reason code
+    constexpr auto EXIT_REASON_AVIC_NOACCEL{0x402_u64};
 
     /// <!-- description -->
     ///   @brief Dispatches the VMExit.
@@ -103,7 +124,43 @@ namespace microv
         bsl::safe_u16 const &vsid,
         bsl::safe_u64 const &exit_reason) noexcept -> bsl::errc_type
     {
+        auto const start{intrinsic.rdtsc()};
+        bool const is_hypercall{EXIT_REASON_VMCALL == exit_reason};
+        auto const slot{stats_hypercall_slot(mut_sys)};
+
+        /// NOTE:
+        /// - The VS's registers changed while it was running, so anything
+        ///   in its register cache is out of date.
+        ///
+
+        mut_vs_pool.reg_cache_invalidate(vsid);
+
+        trace_vmexit(mut_sys, intrinsic, mut_pp_pool, mut_vs_pool, vsid, exit_reason, is_hypercall);
+
         bsl::errc_type mut_ret{};
+        bool const guest{!mut_sys.is_the_active_vm_the_root_vm()};
+
+        if (guest) {
+            mut_ret = kvm_pv_sync_from_guest(
+                mut_tls, mut_sys, mut_page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return return_from_vmexit(
+                    mut_tls,
+                    mut_sys,
+                    intrinsic,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid,
+                    mut_ret);
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
 
         switch (exit_reason.get()) {
             case EXIT_REASON_INTR.get(): {
@@ -121,6 +178,21 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_VINTR.get(): {
+                mut_ret = dispatch_vmexit_external_interrupt_window(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             case EXIT_REASON_NMI.get(): {
                 mut_ret = dispatch_vmexit_nmi(
                     gs,
@@ -167,6 +239,36 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_HLT.get(): {
+                mut_ret = dispatch_vmexit_hlt(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_PAUSE.get(): {
+                mut_ret = dispatch_vmexit_pause(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             case EXIT_REASON_IO.get(): {
                 mut_ret = dispatch_vmexit_io(
                     gs,
@@ -182,6 +284,37 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_MSR.get(): {
+                constexpr auto exitinfo1_idx{syscall::bf_reg_t::bf_reg_t_exitinfo1};
+                if (mut_sys.bf_vs_op_read(vsid, exitinfo1_idx).is_pos()) {
+                    mut_ret = dispatch_vmexit_wrmsr(
+                        gs,
+                        mut_tls,
+                        mut_sys,
+                        mut_page_pool,
+                        intrinsic,
+                        mut_pp_pool,
+                        mut_vm_pool,
+                        mut_vp_pool,
+                        mut_vs_pool,
+                        vsid);
+                    break;
+                }
+
+                mut_ret = dispatch_vmexit_rdmsr(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             case EXIT_REASON_VMCALL.get(): {
                 mut_ret = dispatch_vmexit_vmcall(
                     gs,
@@ -197,6 +330,51 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_NPF.get(): {
+                mut_ret = dispatch_vmexit_mmio(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_AVIC_INCOMPLETE_IPI.get(): {
+                mut_ret = dispatch_vmexit_avic_incomplete_ipi(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_AVIC_NOACCEL.get(): {
+                mut_ret = dispatch_vmexit_avic_noaccel(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             default: {
                 mut_ret = dispatch_vmexit_unknown(
                     gs,
@@ -214,6 +392,67 @@ namespace microv
             }
         }
 
+        mut_ret = return_vmexit_irq_resampled(
+            mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, vsid, mut_ret);
+
+        if (guest && mut_sys.is_the_active_vm_the_root_vm()) {
+            auto const pv_ret{kvm_pv_set_preempted(
+                mut_tls, mut_sys, mut_page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!pv_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const sync_ret{sync_regs_to_root(mut_sys, mut_pp_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!sync_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const irq_ret{irq_resampled_to_root(
+                mut_tls, mut_sys, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!irq_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const wakeup_ret{
+                pv_wakeup_to_root(mut_tls, mut_sys, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!wakeup_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (!mut_sys.is_the_active_vm_the_root_vm()) {
+            trace_inject(mut_sys, intrinsic, mut_pp_pool, mut_vs_pool, vsid);
+        }
+        else {
+            bsl::touch();
+        }
+
+        stats_add_vmexit(
+            mut_sys,
+            intrinsic,
+            mut_pp_pool,
+            mut_vs_pool,
+            vsid,
+            exit_reason,
+            is_hypercall,
+            slot,
+            start);
+
         return return_from_vmexit(
             mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, vsid, mut_ret);
     }
@@ -0,0 +1,241 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_AVIC_HPP
+#define DISPATCH_VMEXIT_AVIC_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_mmio_helpers.hpp>
+#include <emulated_lapic_t.hpp>
+#include <errc_types.hpp>
+#include <gs_t.hpp>
+#include <intrinsic_t.hpp>
+#include <mv_exit_mmio_t.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the bits of EXITINFO1 holding the register offset
+    constexpr auto AVIC_EXITINFO1_OFFSET{0x0000000000000FF0_u64};
+    /// @brief defines the bit of EXITINFO1 that is set for writes
+    constexpr auto AVIC_EXITINFO1_WRITE{0x0000000100000000_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns true if an unaccelerated access to the provided
+    ///     LAPIC register is trap-like (i.e., it is a write that the CPU
+    ///     has already stored in the backing page and the guest has
+    ///     already been advanced past), and false if it is fault-like and
+    ///     still has to be emulated.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param offset the offset of the LAPIC register that was accessed
+    ///   @param write true if the access was a write
+    ///   @return Returns true if the access is trap-like, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    is_avic_trap(bsl::safe_u64 const &offset, bool const write) noexcept -> bool
+    {
+        if (!write) {
+            return false;
+        }
+
+        switch (offset.get()) {
+            case LAPIC_REG_ID.get():
+            case LAPIC_REG_EOI.get():
+            case LAPIC_REG_LDR.get():
+            case LAPIC_REG_DFR.get():
+            case LAPIC_REG_SVR.get():
+            case LAPIC_REG_ESR.get():
+            case LAPIC_REG_ICR_LO.get():
+            case LAPIC_REG_ICR_HI.get():
+            case LAPIC_REG_LVT_TIMER.get():
+            case LAPIC_REG_LVT_THERMAL.get():
+            case LAPIC_REG_LVT_PMC.get():
+            case LAPIC_REG_LVT_LINT0.get():
+            case LAPIC_REG_LVT_LINT1.get():
+            case LAPIC_REG_LVT_ERROR.get():
+            case LAPIC_REG_TIMER_ICR.get():
+            case LAPIC_REG_TIMER_DCR.get(): {
+                return true;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return false;
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches AVIC incomplete IPI VMExits. Each VS's AVIC
+    ///     APIC ID tables only contain the VS itself, so these occur when
+    ///     the guest sends an IPI to any other APIC. MicroV does not
+    ///     emulate IPIs between VSs, so just like the emulated LAPIC, the
+    ///     IPI is dropped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vp_pool the vp_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_avic_incomplete_ipi(
+        gs_t const &gs,
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t const &vm_pool,
+        vp_pool_t const &vp_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+        bsl::discard(tls);
+        bsl::discard(page_pool);
+        bsl::discard(intrinsic);
+        bsl::discard(pp_pool);
+        bsl::discard(vm_pool);
+        bsl::discard(vp_pool);
+        bsl::discard(vs_pool);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto exitinfo1_idx{syscall::bf_reg_t::bf_reg_t_exitinfo1};
+        auto const exitinfo1{mut_sys.bf_vs_op_read(vsid, exitinfo1_idx)};
+
+        bsl::debug<bsl::V>() << "vs "                                  // --
+                             << bsl::hex(vsid)                         // --
+                             << " sent an unsupported IPI with ICR "    // --
+                             << bsl::hex(exitinfo1)                    // --
+                             << bsl::endl;                             // --
+
+        return vmexit_success_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches AVIC unaccelerated access VMExits. These are
+    ///     accesses to the APIC BAR that the CPU could not complete using
+    ///     the backing page. Trap-like writes only need to be replayed to
+    ///     get their side effects, while fault-like accesses are emulated
+    ///     the same way as any other MMIO access to the emulated LAPIC.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_avic_noaccel(
+        gs_t const &gs,
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto exitinfo1_idx{syscall::bf_reg_t::bf_reg_t_exitinfo1};
+        auto const exitinfo1{mut_sys.bf_vs_op_read(vsid, exitinfo1_idx)};
+
+        auto const offset{exitinfo1 & AVIC_EXITINFO1_OFFSET};
+        bool const write{(exitinfo1 & AVIC_EXITINFO1_WRITE).is_pos()};
+
+        if (is_avic_trap(offset, write)) {
+            return replay_vmexit_lapic_write(
+                mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vs_pool, vsid, offset);
+        }
+
+        auto mut_flags{hypercall::MV_EXIT_MMIO_READ};
+        if (write) {
+            mut_flags |= hypercall::MV_EXIT_MMIO_WRITE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const ret{handle_vmexit_mmio(
+            mut_tls,
+            mut_sys,
+            page_pool,
+            intrinsic,
+            mut_pp_pool,
+            mut_vm_pool,
+            mut_vp_pool,
+            mut_vs_pool,
+            vsid,
+            mut_vs_pool.lapic_base(vsid) | offset,
+            mut_flags)};
+
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        return ret;
+    }
+}
+
+#endif
@@ -43,6 +43,14 @@
 
 namespace microv
 {
+    /// NOTE:
+    /// - On AMD, the guest owns all of CR0/CR4, and vs_t does not enable
+    ///   the selective CR0 write intercept, so this is only reached if a
+    ///   CR0 intercept is turned on. If it is, decode assists provide the
+    ///   GPR that holds the new value in EXITINFO1, which must be RAX as
+    ///   that is the only GPR handled here.
+    ///
+
     /// <!-- description -->
     ///   @brief Dispatches control register VMExits.
     ///
@@ -55,7 +63,7 @@ namespace microv
     ///   @param pp_pool the pp_pool_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param cr_access the type of control register access
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
@@ -71,7 +79,7 @@ namespace microv
         pp_pool_t const &pp_pool,
         vm_pool_t const &vm_pool,
         vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        vs_pool_t &mut_vs_pool,
         cr_access_t const cr_access,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
@@ -84,7 +92,6 @@ namespace microv
         bsl::discard(pp_pool);
         bsl::discard(vm_pool);
         bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
         bsl::discard(cr_access);
 
         bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
@@ -92,9 +99,17 @@ namespace microv
         auto const exitinfo1{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_exitinfo1)};
         bsl::expects(exitinfo1.is_valid());
 
+        constexpr auto gpr_valid{0x8000000000000000_u64};
+        constexpr auto gpr_num{0x000000000000000F_u64};
+        if (bsl::unlikely((exitinfo1 & gpr_valid).is_pos() && (exitinfo1 & gpr_num).is_pos())) {
+            bsl::error() << "CR0 writes from a GPR other than RAX are not supported\n"    // --
+                         << bsl::here();                                                // --
+            return bsl::errc_failure;
+        }
+
         auto const cr0_val{gpr_mask & mut_sys.bf_tls_rax()};
         auto const cr0_idx{syscall::bf_reg_t::bf_reg_t_cr0};
-        bsl::expects(mut_sys.bf_vs_op_write(vsid, cr0_idx, cr0_val));
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, cr0_idx, cr0_val, vsid));
 
         return vmexit_success_advance_ip_and_run;
     }
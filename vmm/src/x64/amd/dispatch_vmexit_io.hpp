@@ -26,11 +26,10 @@
 #define DISPATCH_VMEXIT_IO_HPP
 
 #include <bf_syscall_t.hpp>
-#include <dispatch_abi_helpers.hpp>
-#include <dispatch_vmcall_helpers.hpp>
+#include <dispatch_vmexit_io_helpers.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
-#include <mv_exit_io_t.hpp>
+#include <io_access_t.hpp>
 #include <pp_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
@@ -74,100 +73,64 @@ namespace microv
         vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
-        /// TODO:
-        /// - Need to properly handle string instructions (INS/OUTS)
-        ///
-
         bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
-
         bsl::discard(gs);
-        bsl::discard(page_pool);
-        bsl::discard(vsid);
-
-        // ---------------------------------------------------------------------
-        // Context: Guest VM
-        // ---------------------------------------------------------------------
 
         auto const exitinfo1{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_exitinfo1)};
         bsl::expects(exitinfo1.is_valid());
 
-        auto const rax{mut_sys.bf_tls_rax()};
-        auto const rcx{mut_sys.bf_tls_rcx()};
-
-        // ---------------------------------------------------------------------
-        // Context: Change To Root VM
-        // ---------------------------------------------------------------------
-
-        switch_to_root(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, true);
-
-        // ---------------------------------------------------------------------
-        // Context: Root VM
-        // ---------------------------------------------------------------------
-
-        auto mut_exit_io{mut_pp_pool.shared_page<hypercall::mv_exit_io_t>(mut_sys)};
-        bsl::expects(mut_exit_io.is_valid());
-
-        constexpr auto port_mask{0xFFFF0000_u64};
-        constexpr auto port_shft{16_u64};
-        constexpr auto reps_mask{0x00000008_u64};
-        constexpr auto reps_shft{3_u64};
         constexpr auto type_mask{0x00000001_u64};
         constexpr auto type_shft{0_u64};
+        constexpr auto strn_mask{0x00000004_u64};
+        constexpr auto strn_shft{2_u64};
+        constexpr auto reps_mask{0x00000008_u64};
+        constexpr auto reps_shft{3_u64};
+        constexpr auto port_mask{0xFFFF0000_u64};
+        constexpr auto port_shft{16_u64};
 
         constexpr auto sz32_mask{0x00000040_u64};
-        constexpr auto sz32_shft{6_u64};
         constexpr auto sz16_mask{0x00000020_u64};
-        constexpr auto sz16_shft{5_u64};
-        constexpr auto sz08_mask{0x00000010_u64};
-        constexpr auto sz08_shft{4_u64};
+        constexpr auto a64_mask{0x00000200_u64};
+        constexpr auto a32_mask{0x00000100_u64};
 
-        mut_exit_io->addr = ((exitinfo1 & port_mask) >> port_shft).get();
+        io_access_t mut_access{};
 
-        if (((exitinfo1 & type_mask) >> type_shft).is_zero()) {
-            mut_exit_io->type = hypercall::MV_EXIT_IO_OUT.get();
-        }
-        else {
-            mut_exit_io->type = hypercall::MV_EXIT_IO_IN.get();
-        }
+        mut_access.port = (exitinfo1 & port_mask) >> port_shft;
+        mut_access.in = ((exitinfo1 & type_mask) >> type_shft).is_pos();
+        mut_access.string = ((exitinfo1 & strn_mask) >> strn_shft).is_pos();
+        mut_access.rep = ((exitinfo1 & reps_mask) >> reps_shft).is_pos();
 
-        if (((exitinfo1 & sz32_mask) >> sz32_shft).is_pos()) {
-            constexpr auto data_mask{0x00000000FFFFFFFF_u64};
-            mut_exit_io->size = hypercall::mv_bit_size_t::mv_bit_size_t_32;
-            mut_exit_io->data = (data_mask & rax).get();
+        if ((exitinfo1 & sz32_mask).is_pos()) {
+            mut_access.bytes = 4_u64;
         }
-        else {
-            bsl::touch();
-        }
-
-        if (((exitinfo1 & sz16_mask) >> sz16_shft).is_pos()) {
-            constexpr auto data_mask{0x000000000000FFFF_u64};
-            mut_exit_io->size = hypercall::mv_bit_size_t::mv_bit_size_t_16;
-            mut_exit_io->data = (data_mask & rax).get();
+        else if ((exitinfo1 & sz16_mask).is_pos()) {
+            mut_access.bytes = 2_u64;
         }
         else {
-            bsl::touch();
+            mut_access.bytes = 1_u64;
         }
 
-        if (((exitinfo1 & sz08_mask) >> sz08_shft).is_pos()) {
-            constexpr auto data_mask{0x00000000000000FF_u64};
-            mut_exit_io->size = hypercall::mv_bit_size_t::mv_bit_size_t_8;
-            mut_exit_io->data = (data_mask & rax).get();
-        }
-        else {
-            bsl::touch();
+        if ((exitinfo1 & a64_mask).is_pos()) {
+            mut_access.addr_bytes = 8_u64;
         }
-
-        if (((exitinfo1 & reps_mask) >> reps_shft).is_pos()) {
-            mut_exit_io->reps = rcx.get();
+        else if ((exitinfo1 & a32_mask).is_pos()) {
+            mut_access.addr_bytes = 4_u64;
         }
         else {
-            mut_exit_io->reps = {};
+            mut_access.addr_bytes = 2_u64;
         }
 
-        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
-        set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_IO));
-
-        return vmexit_success_advance_ip_and_run;
+        return handle_vmexit_io(
+            mut_tls,
+            mut_sys,
+            page_pool,
+            intrinsic,
+            mut_pp_pool,
+            mut_vm_pool,
+            mut_vp_pool,
+            mut_vs_pool,
+            vsid,
+            mut_access);
     }
 }
 
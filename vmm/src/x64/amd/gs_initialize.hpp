@@ -27,12 +27,17 @@
 
 #include <alloc_bitmap.hpp>
 #include <bf_syscall_t.hpp>
+#include <get_xsave_size.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <is_avic_supported.hpp>
+#include <is_pause_filter_supported.hpp>
+#include <is_tsc_scaling_supported.hpp>
 #include <page_pool_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
@@ -56,40 +61,49 @@ namespace microv
         intrinsic_t const &intrinsic) noexcept -> bsl::errc_type
     {
         bsl::discard(page_pool);
-        bsl::discard(intrinsic);
-
-        mut_gs.root_iopm = alloc_bitmap(mut_sys, IOPM_SIZE, mut_gs.root_iopm_spa);
-        if (bsl::unlikely(mut_gs.root_iopm.is_invalid())) {
+        mut_gs.xsave_size = get_xsave_size(intrinsic);
+        if (bsl::unlikely(mut_gs.xsave_size.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        mut_gs.guest_iopm = alloc_bitmap(mut_sys, IOPM_SIZE, mut_gs.guest_iopm_spa);
-        if (bsl::unlikely(mut_gs.guest_iopm.is_invalid())) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
+        mut_gs.xsaveopt_supported = is_xsaveopt_supported(intrinsic);
+
+        /// NOTE:
+        /// - AVIC redirects accesses to the guest APIC BAR to each VS's
+        ///   backing page, but the BAR still has to be mapped in the
+        ///   nested page tables. What it is mapped to is never accessed,
+        ///   which is why a single page is shared by all guest VMs.
+        ///
+
+        mut_gs.avic_supported = is_avic_supported(intrinsic);
+        if (mut_gs.avic_supported) {
+            auto const *const page{
+                mut_sys.bf_mem_op_alloc_page<bsl::uint8>(mut_gs.apic_access_spa)};
+            if (bsl::unlikely(nullptr == page)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+        }
+        else {
+            bsl::touch();
         }
 
-        mut_gs.root_msrpm = alloc_bitmap(mut_sys, MSRPM_SIZE, mut_gs.root_msrpm_spa);
-        if (bsl::unlikely(mut_gs.root_msrpm.is_invalid())) {
+        mut_gs.pause_filter_supported = is_pause_filter_supported(intrinsic);
+        mut_gs.tsc_scaling_supported = is_tsc_scaling_supported(intrinsic);
+
+        mut_gs.root_iopm = alloc_bitmap(mut_sys, IOPM_SIZE, mut_gs.root_iopm_spa);
+        if (bsl::unlikely(mut_gs.root_iopm.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        mut_gs.guest_msrpm = alloc_bitmap(mut_sys, MSRPM_SIZE, mut_gs.guest_msrpm_spa);
-        if (bsl::unlikely(mut_gs.guest_msrpm.is_invalid())) {
+        mut_gs.root_msrpm = alloc_bitmap(mut_sys, MSRPM_SIZE, mut_gs.root_msrpm_spa);
+        if (bsl::unlikely(mut_gs.root_msrpm.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        for (auto &mut_elem : mut_gs.guest_iopm) {
-            mut_elem = bsl::safe_u8::max_value().get();
-        }
-
-        for (auto &mut_elem : mut_gs.guest_msrpm) {
-            mut_elem = bsl::safe_u8::max_value().get();
-        }
-
         return bsl::errc_success;
     }
 }
@@ -0,0 +1,67 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IS_PAUSE_FILTER_SUPPORTED_HPP
+#define IS_PAUSE_FILTER_SUPPORTED_HPP
+
+#include <intrinsic_t.hpp>
+#include <is_avic_supported.hpp>
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the PauseFilter bit in CPUID.8000000A.EDX
+    constexpr auto CPUID_SVM_FEATURES_PAUSE_FILTER{0x00000400_u64};
+    /// @brief defines the PauseFilterThreshold bit in CPUID.8000000A.EDX
+    constexpr auto CPUID_SVM_FEATURES_PAUSE_FILTER_THRESHOLD{0x00001000_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports the PAUSE filter along
+    ///     with its threshold, which together cause a VMExit when a guest
+    ///     spins in a PAUSE loop for longer than the filter count allows.
+    ///     These are CPUID.8000000A.EDX[10] and CPUID.8000000A.EDX[12].
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns true if the CPU supports the PAUSE filter and its
+    ///     threshold, false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_pause_filter_supported(intrinsic_t const &intrinsic) noexcept -> bool
+    {
+        constexpr auto mask{
+            CPUID_SVM_FEATURES_PAUSE_FILTER | CPUID_SVM_FEATURES_PAUSE_FILTER_THRESHOLD};
+
+        bsl::safe_u64 mut_rax{CPUID_SVM_FEATURES_LEAF};
+        bsl::safe_u64 mut_rbx{};
+        bsl::safe_u64 mut_rcx{};
+        bsl::safe_u64 mut_rdx{};
+        intrinsic.cpuid(mut_rax, mut_rbx, mut_rcx, mut_rdx);
+
+        return (mut_rdx & mask) == mask;
+    }
+}
+
+#endif
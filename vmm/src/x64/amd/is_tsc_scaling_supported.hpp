@@ -0,0 +1,67 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IS_TSC_SCALING_SUPPORTED_HPP
+#define IS_TSC_SCALING_SUPPORTED_HPP
+
+#include <intrinsic_t.hpp>
+#include <is_avic_supported.hpp>
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the TscRateMsr bit in CPUID.8000000A.EDX
+    constexpr auto CPUID_SVM_FEATURES_TSC_RATE_MSR{0x00000010_u64};
+    /// @brief defines the TSC_RATIO MSR
+    constexpr auto MSR_TSC_RATIO{0xC0000104_u64};
+    /// @brief defines the number of fractional bits in TSC_RATIO
+    constexpr auto MSR_TSC_RATIO_FRAC_BITS{32_u64};
+    /// @brief defines the value of TSC_RATIO that leaves the TSC unscaled
+    constexpr auto MSR_TSC_RATIO_ONE{0x0000000100000000_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports TSC scaling, which
+    ///     multiplies the TSC seen by the guest by the TSC_RATIO MSR
+    ///     before the TSC offset is added. This is CPUID.8000000A.EDX[4].
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns true if the CPU supports TSC scaling, false
+    ///     otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_tsc_scaling_supported(intrinsic_t const &intrinsic) noexcept -> bool
+    {
+        bsl::safe_u64 mut_rax{CPUID_SVM_FEATURES_LEAF};
+        bsl::safe_u64 mut_rbx{};
+        bsl::safe_u64 mut_rcx{};
+        bsl::safe_u64 mut_rdx{};
+        intrinsic.cpuid(mut_rax, mut_rbx, mut_rcx, mut_rdx);
+
+        return (mut_rdx & CPUID_SVM_FEATURES_TSC_RATE_MSR).is_pos();
+    }
+}
+
+#endif
@@ -0,0 +1,172 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MSR_TABLE_HPP
+#define MSR_TABLE_HPP
+
+#include <bf_syscall_t.hpp>
+#include <gs_t.hpp>
+#include <msr_desc_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// @brief defines the first MSR in the second range of the MSRPM
+    constexpr auto MSRPM_RANGE1_BASE{0xC0000000_u64};
+    /// @brief defines the first MSR in the third range of the MSRPM
+    constexpr auto MSRPM_RANGE2_BASE{0xC0010000_u64};
+    /// @brief defines the mask of the MSRs covered by each MSRPM range
+    constexpr auto MSRPM_RANGE_MASK{0x1FFF_u64};
+    /// @brief defines the number of bytes in each MSRPM range
+    constexpr auto MSRPM_RANGE_SIZE{0x800_u64};
+
+    /// @brief stores the total number of MSRs MicroV handles
+    constexpr auto MSR_TABLE_SIZE{21_umx};
+
+    /// NOTE:
+    /// - MSR_TABLE describes every MSR MicroV handles for a guest and must
+    ///   remain sorted by address. MSRs with a reg are stored in the VMCB,
+    ///   so they can be passed through. EFER is still trapped so that
+    ///   MicroV controls what the guest can enable, and PAT is trapped
+    ///   because with nested paging the guest's PAT lives in G_PAT,
+    ///   not in the PAT MSR. Everything else is emulated by MicroV.
+    ///
+
+    /// @brief stores the descriptor of every MSR MicroV handles
+    constexpr bsl::array<msr_desc_t, MSR_TABLE_SIZE.get()> MSR_TABLE{{
+        {MSR_APIC_BASE.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_BIOS_SIGN_ID.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_SYSENTER_CS.get(), syscall::bf_reg_t::bf_reg_t_sysenter_cs, true},
+        {MSR_SYSENTER_ESP.get(), syscall::bf_reg_t::bf_reg_t_sysenter_esp, true},
+        {MSR_SYSENTER_EIP.get(), syscall::bf_reg_t::bf_reg_t_sysenter_eip, true},
+        {MSR_MCG_CAP.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_MCG_STATUS.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_PAT.get(), syscall::bf_reg_t::bf_reg_t_pat, false},
+        {MSR_TSC_DEADLINE.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_WALL_CLOCK_NEW.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_SYSTEM_TIME_NEW.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_STEAL_TIME.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_PV_EOI_EN.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_EFER.get(), syscall::bf_reg_t::bf_reg_t_efer, false},
+        {MSR_STAR.get(), syscall::bf_reg_t::bf_reg_t_star, true},
+        {MSR_LSTAR.get(), syscall::bf_reg_t::bf_reg_t_lstar, true},
+        {MSR_CSTAR.get(), syscall::bf_reg_t::bf_reg_t_cstar, true},
+        {MSR_FMASK.get(), syscall::bf_reg_t::bf_reg_t_fmask, true},
+        {MSR_FS_BASE.get(), syscall::bf_reg_t::bf_reg_t_fs_base, true},
+        {MSR_GS_BASE.get(), syscall::bf_reg_t::bf_reg_t_gs_base, true},
+        {MSR_KERNEL_GS_BASE.get(), syscall::bf_reg_t::bf_reg_t_kernel_gs_base, true},
+    }};
+
+    static_assert(is_msr_table_sorted(MSR_TABLE));
+
+    /// <!-- description -->
+    ///   @brief Returns the descriptor of the requested MSR. If MicroV
+    ///     does not handle the MSR, a nullptr is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param msr the MSR to look up
+    ///   @return Returns the descriptor of the requested MSR. If MicroV
+    ///     does not handle the MSR, a nullptr is returned.
+    ///
+    [[nodiscard]] constexpr auto
+    msr_desc(bsl::safe_u64 const &msr) noexcept -> msr_desc_t const *
+    {
+        return find_msr_desc(MSR_TABLE, msr);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stops guest reads and writes of the requested MSR from
+    ///     exiting by clearing its bits in the provided MSRPM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_msrpm the MSRPM to modify
+    ///   @param msr the MSR to pass through
+    ///
+    constexpr void
+    msrpm_passthrough(bsl::span<bsl::uint8> &mut_msrpm, bsl::safe_u64 const &msr) noexcept
+    {
+        constexpr auto msrs_per_byte{4_u64};
+        constexpr auto bits_per_msr{2_u64};
+        constexpr auto rw_mask{3_u64};
+
+        bsl::safe_u64 mut_offset{};
+        if (msr >= MSRPM_RANGE2_BASE) {
+            mut_offset = MSRPM_RANGE_SIZE * 2_u64;
+        }
+        else if (msr >= MSRPM_RANGE1_BASE) {
+            mut_offset = MSRPM_RANGE_SIZE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        /// NOTE:
+        /// - Each MSR has two bits in the MSRPM, the low bit traps
+        ///   reads and the high bit traps writes.
+        ///
+
+        auto const idx{msr & MSRPM_RANGE_MASK};
+        auto const byte{(mut_offset + (idx / msrs_per_byte)).checked()};
+        auto const mask{~(rw_mask << ((idx % msrs_per_byte) * bits_per_msr))};
+
+        auto *const pmut_byte{mut_msrpm.at_if(bsl::to_idx(byte))};
+        bsl::expects(nullptr != pmut_byte);
+
+        *pmut_byte = bsl::to_u8_unsafe(bsl::to_u64(*pmut_byte) & mask).get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Initializes a guest MSRPM from MSR_TABLE. Every MSR
+    ///     exits unless its descriptor says it can be passed through.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_msrpm the MSRPM to initialize
+    ///
+    constexpr void
+    msrpm_init(bsl::span<bsl::uint8> &mut_msrpm) noexcept
+    {
+        bsl::expects(mut_msrpm.size() == MSRPM_SIZE);
+
+        for (auto &mut_elem : mut_msrpm) {
+            mut_elem = bsl::safe_u8::max_value().get();
+        }
+
+        for (auto const &desc : MSR_TABLE) {
+            if (desc.passthrough) {
+                msrpm_passthrough(mut_msrpm, bsl::to_u64(desc.msr));
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    }
+}
+
+#endif
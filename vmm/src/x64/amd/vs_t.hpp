@@ -35,21 +35,37 @@
 #include <emulated_lapic_t.hpp>
 #include <emulated_msr_t.hpp>
 #include <emulated_tlb_t.hpp>
+#include <exit_page_t.hpp>
 #include <gs_t.hpp>
+#include <halt_poll_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <is_avic_supported.hpp>
+#include <is_pause_filter_supported.hpp>
+#include <is_tsc_scaling_supported.hpp>
+#include <mmio_access_t.hpp>
+#include <msr_table.hpp>
+#include <mv_constants.hpp>
 #include <mv_exit_reason_t.hpp>
+#include <mv_lapic_state_t.hpp>
 #include <mv_mp_state_t.hpp>
 #include <mv_rdl_t.hpp>
 #include <mv_reg_t.hpp>
 #include <mv_run_t.hpp>
+#include <mv_stats_t.hpp>
 #include <mv_translation_t.hpp>
+#include <mv_vs_state_t.hpp>
 #include <page_4k_t.hpp>
 #include <page_pool_t.hpp>
 #include <pp_pool_t.hpp>
-#include <queue.hpp>
+#include <pvclock_vcpu_time_info_t.hpp>
+#include <reg_cache_t.hpp>
 #include <running_status_t.hpp>
+#include <stats_t.hpp>
 #include <tls_t.hpp>
+#include <tsc_helpers.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
@@ -61,33 +77,21 @@
 
 namespace microv
 {
-    /// @brief defines the PAT MSR
-    constexpr auto MSR_PAT{0x277_u32};
-    /// @brief defines the SYSENTER_CS MSR
-    constexpr auto MSR_SYSENTER_CS{0x174_u32};
-    /// @brief defines the SYSENTER_ESP MSR
-    constexpr auto MSR_SYSENTER_ESP{0x175_u32};
-    /// @brief defines the SYSENTER_EIP MSR
-    constexpr auto MSR_SYSENTER_EIP{0x176_u32};
-    /// @brief defines the EFER MSR
-    constexpr auto MSR_EFER{0xC0000080_u32};
-    /// @brief defines the STAR MSR
-    constexpr auto MSR_STAR{0xC0000081_u32};
-    /// @brief defines the LSTAR MSR
-    constexpr auto MSR_LSTAR{0xC0000082_u32};
-    /// @brief defines the CSTAR MSR
-    constexpr auto MSR_CSTAR{0xC0000083_u32};
-    /// @brief defines the FMASK MSR
-    constexpr auto MSR_FMASK{0xC0000084_u32};
-    /// @brief defines the FS_BASE MSR
-    constexpr auto MSR_FS_BASE{0xC0000100_u32};
-    /// @brief defines the GS_BASE MSR
-    constexpr auto MSR_GS_BASE{0xC0000101_u32};
-    /// @brief defines the KERNEL_GS_BASE MSR
-    constexpr auto MSR_KERNEL_GS_BASE{0xC0000102_u32};
-
-    /// @brief stores the APIC_BASE MSR address
-    constexpr auto MSR_APIC_BASE{0x0000001B_u32};
+    /// @brief defines the number of entries in an AVIC APIC ID table
+    constexpr auto AVIC_TABLE_ENTRIES{512_u64};
+    /// @brief defines the largest APIC ID that AVIC can accelerate
+    constexpr auto AVIC_MAX_APIC_ID{0xFE_u64};
+    /// @brief defines the valid bit of a physical APIC ID table entry
+    constexpr auto AVIC_PHYSICAL_VALID{0x8000000000000000_u64};
+    /// @brief defines the IsRunning bit of a physical APIC ID table entry
+    constexpr auto AVIC_PHYSICAL_RUNNING{0x4000000000000000_u64};
+    /// @brief defines the AVIC enable bit of the VINTR field of the VMCB
+    constexpr auto AVIC_VINTR_ENABLE{0x80000000_u64};
+    /// @brief defines the INTERRUPT_SHADOW bit of the VMCB (offset 0x68)
+    constexpr auto VMCB_INTERRUPT_SHADOW{0x1_u64};
+
+    /// @brief defines an AVIC APIC ID table
+    using avic_table_t = bsl::array<bsl::uint64, AVIC_TABLE_ENTRIES.get()>;
 
     /// @class microv::vs_t
     ///
@@ -127,14 +131,74 @@ namespace microv
         emulated_tlb_t m_emulated_tlb{};
 
         /// @brief stores the xsave region for this vs_t
-        page_4k_t *m_xsave{};
+        void *m_xsave{};
+        /// @brief stores the xsave region if it fits in a single page
+        page_4k_t *m_xsave_page{};
+        /// @brief stores the xsave region if it does not fit in a single page
+        bsl::span<bsl::uint8> m_xsave_huge{};
+        /// @brief stores true if XSAVEOPT should be used to save state
+        bool m_xsaveopt{};
+        /// @brief stores this vs_t's adaptive halt-polling state
+        halt_poll_t m_halt_poll{};
+        /// @brief stores this vs_t's statistics (see mv_debug_op_stats_get)
+        stats_t m_stats{};
+        /// @brief stores this vs_t's register cache
+        reg_cache_t m_reg_cache{};
+        /// @brief stores this vs_t's exit page
+        exit_page_t m_exit_page{};
         /// @brief stores multiprocessor state of this vs_t
         hypercall::mv_mp_state_t m_mp_state{};
         /// @brief stores the TSC frequency in KHz of this vs_t
         bsl::safe_u64 m_tsc_khz{};
-
-        /// @brief stores a queue of interrupts that need to be injected
-        queue<bsl::safe_u64, MICROV_INTERRUPT_QUEUE_SIZE.get()> m_interrupt_queue{};
+        /// @brief stores the TSC frequency in KHz of the PPs
+        bsl::safe_u64 m_host_tsc_khz{};
+        /// @brief stores the TSC_RATIO of this vs_t
+        bsl::safe_u64 m_tsc_ratio{};
+        /// @brief stores the TSC offset of this vs_t
+        bsl::safe_u64 m_tsc_offset{};
+        /// @brief stores the guest's TSC when this vs_t was last set inactive
+        bsl::safe_u64 m_tsc_last{};
+        /// @brief stores the ID of the PP m_tsc_last was read on
+        bsl::safe_u16 m_tsc_last_ppid{};
+        /// @brief stores the guest's MSR_KVM_SYSTEM_TIME_NEW
+        bsl::safe_u64 m_kvmclock_system_time{};
+        /// @brief stores the version last written to the guest's pvclock
+        bsl::safe_u64 m_kvmclock_version{};
+        /// @brief stores the VM's kvmclock generation the pvclock is from
+        bsl::safe_u64 m_kvmclock_gen{};
+        /// @brief stores true if the pvclock has to be written again
+        bool m_kvmclock_dirty{};
+        /// @brief stores true if PVCLOCK_GUEST_STOPPED has to be set
+        bool m_kvmclock_stopped{};
+        /// @brief stores true if the guest's PV EOI word was set on entry
+        bool m_pv_eoi_pending{};
+
+        /// @brief stores whether or not an ExtINT interrupt is pending
+        bool m_extint_pending{};
+        /// @brief stores the vector of the pending ExtINT interrupt
+        bsl::safe_u64 m_extint_vector{};
+
+        /// @brief stores true if the CPU has a PAUSE filter with a threshold
+        bool m_pause_filter_supported{};
+        /// @brief stores the PAUSE-loop gap last given to this vs_t
+        bsl::safe_u64 m_pause_gap{};
+        /// @brief stores the PAUSE-loop window last given to this vs_t
+        bsl::safe_u64 m_pause_window{};
+        /// @brief stores true if the CPU supports TSC scaling
+        bool m_tsc_scaling_supported{};
+
+        /// @brief stores true if the CPU supports AVIC
+        bool m_avic_supported{};
+        /// @brief stores true if the CPU delivers LAPIC interrupts itself
+        bool m_avic{};
+        /// @brief stores this vs_t's AVIC physical APIC ID table
+        avic_table_t *m_avic_physical{};
+        /// @brief stores the SPA of this vs_t's AVIC physical APIC ID table
+        bsl::safe_u64 m_avic_physical_spa{};
+        /// @brief stores this vs_t's AVIC logical APIC ID table
+        avic_table_t *m_avic_logical{};
+        /// @brief stores the SPA of this vs_t's AVIC logical APIC ID table
+        bsl::safe_u64 m_avic_logical_spa{};
 
         /// <!-- description -->
         ///   @brief Initializes the VS to start as a 16bit guest.
@@ -401,9 +465,57 @@ namespace microv
             bsl::expects(mut_sys.bf_vs_op_write(vsid, mk::bf_reg_t_efer, {}));
             bsl::expects(mut_sys.bf_vs_op_write(vsid, mk::bf_reg_t_fs_base, {}));
             bsl::expects(mut_sys.bf_vs_op_write(vsid, mk::bf_reg_t_gs_base, {}));
+        }
+
+        /// <!-- description -->
+        ///   @brief Requests a virtual interrupt if this vs_t has an
+        ///     interrupt that can be injected, and drops the request
+        ///     otherwise. The virtual interrupt causes a VINTR VMExit as
+        ///     soon as the guest can take an interrupt, even if nothing
+        ///     else would cause a VMExit, while no exit is taken for
+        ///     interrupts that are masked by the TPR or ISR. With AVIC,
+        ///     the CPU delivers LAPIC interrupts from the backing page on
+        ///     its own and ignores the virtual interrupt, so AVIC is
+        ///     simply left enabled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        update_interrupt_window(syscall::bf_syscall_t &mut_sys) const noexcept -> bsl::errc_type
+        {
+            constexpr auto vint_a_idx{syscall::bf_reg_t::bf_reg_t_virtual_interrupt_a};
+            if (m_avic) {
+                constexpr auto vint_a_val{0x01000000_u64};
+                return mut_sys.bf_vs_op_write(
+                    this->id(), vint_a_idx, vint_a_val | AVIC_VINTR_ENABLE);
+            }
+
+            if (this->interrupt_pending()) {
+                constexpr auto vint_a_val{0x000000FF010F0100_u64};
+                return mut_sys.bf_vs_op_write(this->id(), vint_a_idx, vint_a_val);
+            }
+
+            constexpr auto vint_a_val{0x01000000_u64};
+            return mut_sys.bf_vs_op_write(this->id(), vint_a_idx, vint_a_val);
+        }
 
-            constexpr auto apic_base{0xFEE00900_u64};
-            m_emulated_lapic.set_apic_base(apic_base);
+        /// <!-- description -->
+        ///   @brief Returns the value the guest's TSC had when the PP's TSC
+        ///     had the provided value. This is the same math the CPU uses
+        ///     when the guest executes RDTSC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the value of the PP's TSC
+        ///   @return Returns the value of the guest's TSC
+        ///
+        [[nodiscard]] constexpr auto
+        guest_tsc(bsl::safe_u64 const &tsc) const noexcept -> bsl::safe_u64
+        {
+            auto const scaled{tsc_scale(tsc, m_tsc_ratio, MSR_TSC_RATIO_FRAC_BITS)};
+            return tsc_add(scaled, m_tsc_offset);
         }
 
     public:
@@ -497,9 +609,14 @@ namespace microv
         ///   @param vmid the ID of the VM to assign the vs_t to
         ///   @param vpid the ID of the VP to assign the vs_t to
         ///   @param ppid the ID of the PP to assign the vs_t to
+        ///   @param apic_id the APIC ID of the vs_t's emulated LAPIC
         ///   @param tsc_khz the starting TSC frequency of the vs_t
         ///   @param slpt_spa the system physical address of the second level
         ///     page tables to use.
+        ///   @param msrpm_spa the system physical address of the MSR
+        ///     permissions map to use.
+        ///   @param iopm_spa the system physical address of the IO
+        ///     permissions map to use.
         ///   @return Returns ID of this vs_t
         ///
         [[maybe_unused]] constexpr auto
@@ -512,8 +629,11 @@ namespace microv
             bsl::safe_u16 const &vmid,
             bsl::safe_u16 const &vpid,
             bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &apic_id,
             bsl::safe_u64 const &tsc_khz,
-            bsl::safe_u64 const &slpt_spa) noexcept -> bsl::safe_u16
+            bsl::safe_u64 const &slpt_spa,
+            bsl::safe_u64 const &msrpm_spa,
+            bsl::safe_u64 const &iopm_spa) noexcept -> bsl::safe_u16
         {
             auto const vsid{this->id()};
 
@@ -527,21 +647,72 @@ namespace microv
             bsl::expects(vpid != syscall::BF_INVALID_ID);
             bsl::expects(ppid.is_valid_and_checked());
             bsl::expects(ppid != syscall::BF_INVALID_ID);
+            bsl::expects(apic_id.is_valid_and_checked());
             bsl::expects(tsc_khz.is_valid_and_checked());
             bsl::expects(tsc_khz.is_pos());
             bsl::expects(slpt_spa.is_valid_and_checked());
             bsl::expects(slpt_spa.is_pos());
+            bsl::expects(msrpm_spa.is_valid_and_checked());
+            bsl::expects(iopm_spa.is_valid_and_checked());
 
-            bsl::discard(gs);
-            bsl::discard(tls);
-            bsl::discard(intrinsic);
+            auto const lapic_ret{m_emulated_lapic.allocate(mut_sys)};
+            if (bsl::unlikely(!lapic_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u16::failure();
+            }
 
-            m_xsave = mut_page_pool.allocate<page_4k_t>(tls, mut_sys);
-            if (bsl::unlikely(nullptr == m_xsave)) {
+            auto const stats_ret{m_stats.allocate(mut_sys, true)};
+            if (bsl::unlikely(!stats_ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::safe_u16::failure();
             }
 
+            if (gs.xsave_size > HYPERVISOR_PAGE_SIZE) {
+
+                /// NOTE:
+                /// - Huge allocations cannot be freed, so once a vs_t
+                ///   has a huge xsave region, it keeps it and reuses it
+                ///   each time it is allocated.
+                ///
+
+                if (m_xsave_huge.empty()) {
+                    constexpr auto page_mask{0xFFF_u64};
+                    auto const size{((gs.xsave_size + page_mask) & ~page_mask).checked()};
+
+                    bsl::safe_u64 mut_spa{};
+                    auto *const pmut_huge{mut_sys.bf_mem_op_alloc_huge<bsl::uint8>(size, mut_spa)};
+                    if (bsl::unlikely(nullptr == pmut_huge)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::safe_u16::failure();
+                    }
+
+                    m_xsave_huge = {pmut_huge, size};
+                }
+                else {
+                    bsl::touch();
+                }
+
+                for (auto &mut_elem : m_xsave_huge) {
+                    mut_elem = {};
+                }
+
+                m_xsave = m_xsave_huge.data();
+            }
+            else {
+                m_xsave_page = mut_page_pool.allocate<page_4k_t>(tls, mut_sys);
+                if (bsl::unlikely(nullptr == m_xsave_page)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_u16::failure();
+                }
+
+                m_xsave = m_xsave_page;
+            }
+
+            m_xsaveopt = gs.xsaveopt_supported;
+            m_avic_supported = gs.avic_supported;
+            m_pause_filter_supported = gs.pause_filter_supported;
+            m_tsc_scaling_supported = gs.tsc_scaling_supported;
+
             auto const guest_asid_val{(bsl::to_u64(vmid) + bsl::safe_u64::magic_1()).checked()};
             constexpr auto guest_asid_idx{syscall::bf_reg_t::bf_reg_t_guest_asid};
             bsl::expects(mut_sys.bf_vs_op_write(vsid, guest_asid_idx, guest_asid_val));
@@ -581,7 +752,14 @@ namespace microv
                 constexpr auto intercept_drw_idx{syscall::bf_reg_t::bf_reg_t_intercept_dr_write};
                 bsl::expects(mut_sys.bf_vs_op_write(vsid, intercept_drw_idx, intercept_drw_val));
 
-                constexpr auto intercept1_val{0x9F24003B_u64};
+                /// NOTE:
+                /// - The selective CR0 write intercept (bit 5) is left
+                ///   off. Unlike Intel, AMD has no fixed CR0/CR4 bits and
+                ///   no VMXE-like bit in CR4, so the guest can own all of
+                ///   CR0/CR4 and writes to them never VMExit.
+                ///
+
+                constexpr auto intercept1_val{0x9F24001B_u64};
                 constexpr auto intercept1_idx{syscall::bf_reg_t::bf_reg_t_intercept_instruction1};
                 bsl::expects(mut_sys.bf_vs_op_write(vsid, intercept1_idx, intercept1_val));
 
@@ -601,18 +779,26 @@ namespace microv
                 bsl::expects(mut_sys.bf_vs_op_write(vsid, n_cr3_idx, slpt_spa));
 
                 constexpr auto iopm_base_pa_idx{syscall::bf_reg_t::bf_reg_t_iopm_base_pa};
-                bsl::expects(mut_sys.bf_vs_op_write(vsid, iopm_base_pa_idx, gs.guest_iopm_spa));
+                bsl::expects(mut_sys.bf_vs_op_write(vsid, iopm_base_pa_idx, iopm_spa));
 
                 constexpr auto msrpm_base_pa_idx{syscall::bf_reg_t::bf_reg_t_msrpm_base_pa};
-                bsl::expects(mut_sys.bf_vs_op_write(vsid, msrpm_base_pa_idx, gs.guest_msrpm_spa));
+                bsl::expects(mut_sys.bf_vs_op_write(vsid, msrpm_base_pa_idx, msrpm_spa));
+
+                constexpr auto tsc_offset_idx{syscall::bf_reg_t::bf_reg_t_tsc_offset};
+                bsl::expects(mut_sys.bf_vs_op_write(vsid, tsc_offset_idx, {}));
 
                 this->init_as_16bit_guest(mut_sys);
             }
 
+            m_emulated_lapic.reset(apic_id, tsc_khz);
+            m_emulated_msr.reset();
+
             m_assigned_vmid = ~vmid;
             m_assigned_vpid = ~vpid;
             m_assigned_ppid = ~ppid;
             m_tsc_khz = tsc_khz;
+            m_host_tsc_khz = tsc_khz;
+            m_tsc_ratio = MSR_TSC_RATIO_ONE;
             m_allocated = allocated_status_t::allocated;
 
             if (!mut_sys.is_vs_a_root_vs(vsid)) {
@@ -651,11 +837,38 @@ namespace microv
             bsl::expects(this->is_active().is_invalid());
 
             bsl::discard(gs);
-            bsl::discard(tls);
             bsl::discard(intrinsic);
 
-            mut_page_pool.deallocate(tls, m_xsave);
-
+            mut_page_pool.deallocate(tls, m_xsave_page);
+            m_xsave_page = {};
+            m_xsave = {};
+
+            m_halt_poll.reset();
+            m_reg_cache.invalidate();
+            m_xsaveopt = {};
+
+            m_avic = {};
+            m_avic_supported = {};
+
+            m_tsc_scaling_supported = {};
+            m_pause_window = {};
+            m_pause_gap = {};
+            m_pause_filter_supported = {};
+
+            m_extint_vector = {};
+            m_extint_pending = {};
+
+            m_pv_eoi_pending = {};
+            m_kvmclock_stopped = {};
+            m_kvmclock_dirty = {};
+            m_kvmclock_gen = {};
+            m_kvmclock_version = {};
+            m_kvmclock_system_time = {};
+            m_tsc_last_ppid = {};
+            m_tsc_last = {};
+            m_tsc_offset = {};
+            m_tsc_ratio = {};
+            m_host_tsc_khz = {};
             m_tsc_khz = {};
             m_mp_state = {};
             m_assigned_ppid = {};
@@ -701,41 +914,41 @@ namespace microv
         }
 
         /// <!-- description -->
-        ///   @brief Sets this vs_t as active.
+        ///   @brief Sets this vs_t as active. Note that this does not load
+        ///     this vs_t's extended state. This is done by the vs_pool_t
+        ///     using fpu_save() and fpu_restore().
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
-        ///   @param intrinsic the intrinsic_t to use
         ///
         constexpr void
-        set_active(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        set_active(tls_t &mut_tls) noexcept
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
             bsl::expects(running_status_t::running != m_status);
             bsl::expects(syscall::BF_INVALID_ID == mut_tls.active_vsid);
 
-            intrinsic.xrstr(m_xsave);
+            m_stats.add_fpu_switch();
 
             m_active_ppid = ~bsl::to_u16(mut_tls.ppid);
             mut_tls.active_vsid = this->id();
         }
 
         /// <!-- description -->
-        ///   @brief Sets this vs_t as inactive.
+        ///   @brief Sets this vs_t as inactive. Note that this does not save
+        ///     this vs_t's extended state. This is done by the vs_pool_t
+        ///     using fpu_save() and fpu_restore().
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
-        ///   @param intrinsic the intrinsic_t to use
         ///
         constexpr void
-        set_inactive(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        set_inactive(tls_t &mut_tls) noexcept
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
             bsl::expects(running_status_t::running != m_status);
             bsl::expects(this->id() == mut_tls.active_vsid);
 
-            intrinsic.xsave(m_xsave);
-
             m_active_ppid = {};
             mut_tls.active_vsid = syscall::BF_INVALID_ID;
         }
@@ -773,6 +986,81 @@ namespace microv
             return tls.ppid == ~m_active_ppid;
         }
 
+        /// <!-- description -->
+        ///   @brief Saves the CPU's extended state into this vs_t's xsave
+        ///     region. This vs_t must own the CPU's extended state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        fpu_save(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(this->id() == mut_tls.fpu_vsid);
+
+            auto const start{intrinsic.rdtsc()};
+
+            if (m_xsaveopt) {
+                intrinsic.xsaveopt(m_xsave);
+            }
+            else {
+                intrinsic.xsave(m_xsave);
+            }
+
+            m_stats.add_fpu(
+                hypercall::MV_STATS_FPU_SLOT_SAVE, (intrinsic.rdtsc() - start).checked());
+
+            mut_tls.fpu_vsid = syscall::BF_INVALID_ID;
+        }
+
+        /// <!-- description -->
+        ///   @brief Loads the CPU's extended state from this vs_t's xsave
+        ///     region. No vs_t can own the CPU's extended state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        fpu_restore(
+            tls_t &mut_tls, syscall::bf_syscall_t &mut_sys, intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(syscall::BF_INVALID_ID == mut_tls.fpu_vsid);
+
+            bsl::discard(mut_sys);
+
+            auto const start{intrinsic.rdtsc()};
+            intrinsic.xrstr(m_xsave);
+
+            m_stats.add_fpu(
+                hypercall::MV_STATS_FPU_SLOT_RESTORE, (intrinsic.rdtsc() - start).checked());
+
+            mut_tls.fpu_vsid = this->id();
+        }
+
+        /// <!-- description -->
+        ///   @brief Attempts to defer loading this vs_t's extended state
+        ///     until the guest actually uses it. On AMD, the guest reads
+        ///     CR0 directly, so CR0.TS cannot be used to trap the guest's
+        ///     use of the FPU without intercepting all CR0 accesses. The
+        ///     extended state is therefore always loaded eagerly.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns true if loading this vs_t's extended state was
+        ///     deferred, false if it must be loaded now.
+        ///
+        [[nodiscard]] static constexpr auto
+        fpu_try_lazy(syscall::bf_syscall_t &mut_sys) noexcept -> bool
+        {
+            bsl::discard(mut_sys);
+            return false;
+        }
+
         /// <!-- description -->
         ///   @brief Returns the ID of the VM this vs_t is assigned to. If
         ///     this vs_t is not assigned, syscall::BF_INVALID_ID is returned.
@@ -960,7 +1248,7 @@ namespace microv
                 return m_emulated_cpuid.get_root(mut_sys, intrinsic);
             }
 
-            return m_emulated_cpuid.get(mut_sys, intrinsic);
+            return m_emulated_cpuid.get(mut_sys, intrinsic, m_tsc_khz);
         }
 
         /// <!-- description -->
@@ -972,7 +1260,7 @@ namespace microv
         ///   @return Returns the value of the requested register
         ///
         [[nodiscard]] constexpr auto
-        reg_get(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &reg) const noexcept
+        reg_get(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &reg) noexcept
             -> bsl::safe_u64
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
@@ -990,203 +1278,203 @@ namespace microv
                 }
 
                 case mv::mv_reg_t_rax: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rax);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rax);
                 }
 
                 case mv::mv_reg_t_rbx: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rbx);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rbx);
                 }
 
                 case mv::mv_reg_t_rcx: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rcx);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rcx);
                 }
 
                 case mv::mv_reg_t_rdx: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rdx);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rdx);
                 }
 
                 case mv::mv_reg_t_rbp: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rbp);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rbp);
                 }
 
                 case mv::mv_reg_t_rsi: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rsi);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rsi);
                 }
 
                 case mv::mv_reg_t_rdi: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rdi);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rdi);
                 }
 
                 case mv::mv_reg_t_r8: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r8);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r8);
                 }
 
                 case mv::mv_reg_t_r9: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r9);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r9);
                 }
 
                 case mv::mv_reg_t_r10: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r10);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r10);
                 }
 
                 case mv::mv_reg_t_r11: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r11);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r11);
                 }
 
                 case mv::mv_reg_t_r12: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r12);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r12);
                 }
 
                 case mv::mv_reg_t_r13: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r13);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r13);
                 }
 
                 case mv::mv_reg_t_r14: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r14);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r14);
                 }
 
                 case mv::mv_reg_t_r15: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_r15);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_r15);
                 }
 
                 case mv::mv_reg_t_rsp: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rsp);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rsp);
                 }
 
                 case mv::mv_reg_t_rip: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rip);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rip);
                 }
 
                 case mv::mv_reg_t_rflags: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_rflags);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_rflags);
                 }
 
                 case mv::mv_reg_t_es_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_es_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_es_selector);
                 }
 
                 case mv::mv_reg_t_es_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_es_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_es_attrib);
                 }
 
                 case mv::mv_reg_t_es_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_es_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_es_limit);
                 }
 
                 case mv::mv_reg_t_es_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_es_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_es_base);
                 }
 
                 case mv::mv_reg_t_cs_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cs_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cs_selector);
                 }
 
                 case mv::mv_reg_t_cs_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cs_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cs_attrib);
                 }
 
                 case mv::mv_reg_t_cs_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cs_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cs_limit);
                 }
 
                 case mv::mv_reg_t_cs_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cs_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cs_base);
                 }
 
                 case mv::mv_reg_t_ss_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ss_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ss_selector);
                 }
 
                 case mv::mv_reg_t_ss_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ss_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ss_attrib);
                 }
 
                 case mv::mv_reg_t_ss_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ss_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ss_limit);
                 }
 
                 case mv::mv_reg_t_ss_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ss_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ss_base);
                 }
 
                 case mv::mv_reg_t_ds_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ds_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ds_selector);
                 }
 
                 case mv::mv_reg_t_ds_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ds_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ds_attrib);
                 }
 
                 case mv::mv_reg_t_ds_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ds_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ds_limit);
                 }
 
                 case mv::mv_reg_t_ds_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ds_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ds_base);
                 }
 
                 case mv::mv_reg_t_fs_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_fs_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_fs_selector);
                 }
 
                 case mv::mv_reg_t_fs_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_fs_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_fs_attrib);
                 }
 
                 case mv::mv_reg_t_fs_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_fs_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_fs_limit);
                 }
 
                 case mv::mv_reg_t_fs_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_fs_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_fs_base);
                 }
 
                 case mv::mv_reg_t_gs_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gs_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_gs_selector);
                 }
 
                 case mv::mv_reg_t_gs_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gs_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_gs_attrib);
                 }
 
                 case mv::mv_reg_t_gs_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gs_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_gs_limit);
                 }
 
                 case mv::mv_reg_t_gs_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gs_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_gs_base);
                 }
 
                 case mv::mv_reg_t_ldtr_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ldtr_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ldtr_selector);
                 }
 
                 case mv::mv_reg_t_ldtr_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ldtr_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ldtr_attrib);
                 }
 
                 case mv::mv_reg_t_ldtr_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ldtr_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ldtr_limit);
                 }
 
                 case mv::mv_reg_t_ldtr_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_ldtr_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_ldtr_base);
                 }
 
                 case mv::mv_reg_t_tr_selector: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_tr_selector);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_tr_selector);
                 }
 
                 case mv::mv_reg_t_tr_attrib: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_tr_attrib);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_tr_attrib);
                 }
 
                 case mv::mv_reg_t_tr_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_tr_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_tr_limit);
                 }
 
                 case mv::mv_reg_t_tr_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_tr_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_tr_base);
                 }
 
                 case mv::mv_reg_t_gdtr_selector: {
@@ -1198,11 +1486,11 @@ namespace microv
                 }
 
                 case mv::mv_reg_t_gdtr_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gdtr_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_gdtr_limit);
                 }
 
                 case mv::mv_reg_t_gdtr_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gdtr_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_gdtr_base);
                 }
 
                 case mv::mv_reg_t_idtr_selector: {
@@ -1214,59 +1502,59 @@ namespace microv
                 }
 
                 case mv::mv_reg_t_idtr_limit: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_idtr_limit);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_idtr_limit);
                 }
 
                 case mv::mv_reg_t_idtr_base: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_idtr_base);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_idtr_base);
                 }
 
                 case mv::mv_reg_t_dr0: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_dr0);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_dr0);
                 }
 
                 case mv::mv_reg_t_dr1: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_dr1);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_dr1);
                 }
 
                 case mv::mv_reg_t_dr2: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_dr2);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_dr2);
                 }
 
                 case mv::mv_reg_t_dr3: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_dr3);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_dr3);
                 }
 
                 case mv::mv_reg_t_dr6: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_dr6);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_dr6);
                 }
 
                 case mv::mv_reg_t_dr7: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_dr7);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_dr7);
                 }
 
                 case mv::mv_reg_t_cr0: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cr0);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cr0);
                 }
 
                 case mv::mv_reg_t_cr2: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cr2);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cr2);
                 }
 
                 case mv::mv_reg_t_cr3: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cr3);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cr3);
                 }
 
                 case mv::mv_reg_t_cr4: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cr4);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cr4);
                 }
 
                 case mv::mv_reg_t_cr8: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cr8);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_cr8);
                 }
 
                 case mv::mv_reg_t_xcr0: {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_xcr0);
+                    return m_reg_cache.read(sys, this->id(), mk::bf_reg_t_xcr0);
                     break;
                 }
 
@@ -1318,203 +1606,203 @@ namespace microv
                 }
 
                 case mv::mv_reg_t_rax: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rax, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rax, val);
                 }
 
                 case mv::mv_reg_t_rbx: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rbx, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rbx, val);
                 }
 
                 case mv::mv_reg_t_rcx: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rcx, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rcx, val);
                 }
 
                 case mv::mv_reg_t_rdx: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rdx, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rdx, val);
                 }
 
                 case mv::mv_reg_t_rbp: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rbp, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rbp, val);
                 }
 
                 case mv::mv_reg_t_rsi: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rsi, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rsi, val);
                 }
 
                 case mv::mv_reg_t_rdi: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rdi, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rdi, val);
                 }
 
                 case mv::mv_reg_t_r8: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r8, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r8, val);
                 }
 
                 case mv::mv_reg_t_r9: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r9, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r9, val);
                 }
 
                 case mv::mv_reg_t_r10: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r10, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r10, val);
                 }
 
                 case mv::mv_reg_t_r11: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r11, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r11, val);
                 }
 
                 case mv::mv_reg_t_r12: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r12, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r12, val);
                 }
 
                 case mv::mv_reg_t_r13: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r13, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r13, val);
                 }
 
                 case mv::mv_reg_t_r14: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r14, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r14, val);
                 }
 
                 case mv::mv_reg_t_r15: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_r15, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_r15, val);
                 }
 
                 case mv::mv_reg_t_rsp: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rsp, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rsp, val);
                 }
 
                 case mv::mv_reg_t_rip: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rip, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rip, val);
                 }
 
                 case mv::mv_reg_t_rflags: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_rflags, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_rflags, val);
                 }
 
                 case mv::mv_reg_t_es_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_es_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_es_selector, val);
                 }
 
                 case mv::mv_reg_t_es_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_es_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_es_attrib, val);
                 }
 
                 case mv::mv_reg_t_es_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_es_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_es_limit, val);
                 }
 
                 case mv::mv_reg_t_es_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_es_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_es_base, val);
                 }
 
                 case mv::mv_reg_t_cs_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cs_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cs_selector, val);
                 }
 
                 case mv::mv_reg_t_cs_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cs_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cs_attrib, val);
                 }
 
                 case mv::mv_reg_t_cs_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cs_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cs_limit, val);
                 }
 
                 case mv::mv_reg_t_cs_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cs_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cs_base, val);
                 }
 
                 case mv::mv_reg_t_ss_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ss_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ss_selector, val);
                 }
 
                 case mv::mv_reg_t_ss_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ss_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ss_attrib, val);
                 }
 
                 case mv::mv_reg_t_ss_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ss_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ss_limit, val);
                 }
 
                 case mv::mv_reg_t_ss_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ss_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ss_base, val);
                 }
 
                 case mv::mv_reg_t_ds_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ds_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ds_selector, val);
                 }
 
                 case mv::mv_reg_t_ds_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ds_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ds_attrib, val);
                 }
 
                 case mv::mv_reg_t_ds_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ds_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ds_limit, val);
                 }
 
                 case mv::mv_reg_t_ds_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ds_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ds_base, val);
                 }
 
                 case mv::mv_reg_t_fs_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_fs_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_fs_selector, val);
                 }
 
                 case mv::mv_reg_t_fs_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_fs_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_fs_attrib, val);
                 }
 
                 case mv::mv_reg_t_fs_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_fs_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_fs_limit, val);
                 }
 
                 case mv::mv_reg_t_fs_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_fs_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_fs_base, val);
                 }
 
                 case mv::mv_reg_t_gs_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gs_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_gs_selector, val);
                 }
 
                 case mv::mv_reg_t_gs_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gs_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_gs_attrib, val);
                 }
 
                 case mv::mv_reg_t_gs_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gs_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_gs_limit, val);
                 }
 
                 case mv::mv_reg_t_gs_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gs_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_gs_base, val);
                 }
 
                 case mv::mv_reg_t_ldtr_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ldtr_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ldtr_selector, val);
                 }
 
                 case mv::mv_reg_t_ldtr_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ldtr_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ldtr_attrib, val);
                 }
 
                 case mv::mv_reg_t_ldtr_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ldtr_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ldtr_limit, val);
                 }
 
                 case mv::mv_reg_t_ldtr_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_ldtr_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_ldtr_base, val);
                 }
 
                 case mv::mv_reg_t_tr_selector: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_tr_selector, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_tr_selector, val);
                 }
 
                 case mv::mv_reg_t_tr_attrib: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_tr_attrib, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_tr_attrib, val);
                 }
 
                 case mv::mv_reg_t_tr_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_tr_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_tr_limit, val);
                 }
 
                 case mv::mv_reg_t_tr_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_tr_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_tr_base, val);
                 }
 
                 case mv::mv_reg_t_gdtr_selector: {
@@ -1526,11 +1814,11 @@ namespace microv
                 }
 
                 case mv::mv_reg_t_gdtr_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gdtr_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_gdtr_limit, val);
                 }
 
                 case mv::mv_reg_t_gdtr_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gdtr_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_gdtr_base, val);
                 }
 
                 case mv::mv_reg_t_idtr_selector: {
@@ -1542,59 +1830,59 @@ namespace microv
                 }
 
                 case mv::mv_reg_t_idtr_limit: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_idtr_limit, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_idtr_limit, val);
                 }
 
                 case mv::mv_reg_t_idtr_base: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_idtr_base, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_idtr_base, val);
                 }
 
                 case mv::mv_reg_t_dr0: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_dr0, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_dr0, val);
                 }
 
                 case mv::mv_reg_t_dr1: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_dr1, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_dr1, val);
                 }
 
                 case mv::mv_reg_t_dr2: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_dr2, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_dr2, val);
                 }
 
                 case mv::mv_reg_t_dr3: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_dr3, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_dr3, val);
                 }
 
                 case mv::mv_reg_t_dr6: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_dr6, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_dr6, val);
                 }
 
                 case mv::mv_reg_t_dr7: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_dr7, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_dr7, val);
                 }
 
                 case mv::mv_reg_t_cr0: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cr0, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cr0, val);
                 }
 
                 case mv::mv_reg_t_cr2: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cr2, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cr2, val);
                 }
 
                 case mv::mv_reg_t_cr3: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cr3, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cr3, val);
                 }
 
                 case mv::mv_reg_t_cr4: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cr4, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cr4, val);
                 }
 
                 case mv::mv_reg_t_cr8: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cr8, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_cr8, val);
                 }
 
                 case mv::mv_reg_t_xcr0: {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_xcr0, val);
+                    return m_reg_cache.write(mut_sys, this->id(), mk::bf_reg_t_xcr0, val);
                     break;
                 }
 
@@ -1625,7 +1913,7 @@ namespace microv
         ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        reg_get_list(syscall::bf_syscall_t const &sys, hypercall::mv_rdl_t &mut_rdl) const noexcept
+        reg_get_list(syscall::bf_syscall_t const &sys, hypercall::mv_rdl_t &mut_rdl) noexcept
             -> bsl::errc_type
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
@@ -1936,7 +2224,7 @@ namespace microv
         ///   @return Returns the value of the requested MSR
         ///
         [[nodiscard]] constexpr auto
-        msr_get(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &msr) const noexcept
+        msr_get(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &msr) noexcept
             -> bsl::safe_u64
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
@@ -1945,53 +2233,39 @@ namespace microv
 
             bsl::expects(msr.is_valid_and_checked());
 
-            using mk = syscall::bf_reg_t;
-
             bsl::safe_u64 mut_ret{};
 
-            switch (bsl::to_u32_unsafe(msr).get()) {
-                case MSR_PAT.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_pat);
-                }
-                case MSR_SYSENTER_CS.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_sysenter_cs);
-                }
-                case MSR_SYSENTER_ESP.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_sysenter_esp);
-                }
-                case MSR_SYSENTER_EIP.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_sysenter_eip);
-                }
-                case MSR_EFER.get(): {
+            auto const *const desc{msr_desc(msr)};
+            if (bsl::unlikely(nullptr == desc)) {
+                bsl::error() << "MSR "                       // --
+                             << bsl::hex(msr)                // --
+                             << " is unsupported/invalid"    // --
+                             << bsl::endl                    // --
+                             << bsl::here();                 // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            if (syscall::bf_reg_t::bf_reg_t_unsupported != desc->reg) {
+                mut_ret = m_reg_cache.read(sys, this->id(), desc->reg);
+                if (MSR_EFER.get() == desc->msr) {
                     constexpr auto svme_mask{0x1000_u64};
-                    mut_ret = sys.bf_vs_op_read(this->id(), mk::bf_reg_t_efer);
                     return (mut_ret & ~(svme_mask));
                 }
-                case MSR_STAR.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_star);
-                }
-                case MSR_LSTAR.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_lstar);
-                }
-                case MSR_CSTAR.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_cstar);
-                }
-                case MSR_FMASK.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_fmask);
-                }
-                case MSR_FS_BASE.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_fs_base);
-                }
-                case MSR_GS_BASE.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_gs_base);
-                }
-                case MSR_KERNEL_GS_BASE.get(): {
-                    return sys.bf_vs_op_read(this->id(), mk::bf_reg_t_kernel_gs_base);
-                }
 
+                return mut_ret;
+            }
+
+            switch (desc->msr) {
                 case MSR_APIC_BASE.get(): {
                     return m_emulated_lapic.get_apic_base();
                 }
+                case MSR_TSC_DEADLINE.get(): {
+                    return m_emulated_lapic.tsc_deadline();
+                }
+                case MSR_KVM_SYSTEM_TIME_NEW.get(): {
+                    return m_kvmclock_system_time;
+                }
 
                 default: {
                     break;
@@ -2037,57 +2311,60 @@ namespace microv
             bsl::expects(msr.is_valid_and_checked());
             bsl::expects(val.is_valid_and_checked());
 
-            using mk = syscall::bf_reg_t;
-
             bsl::errc_type mut_ret{};
 
-            switch (bsl::to_u32_unsafe(msr).get()) {
-                case MSR_PAT.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_pat, val);
-                }
-                case MSR_SYSENTER_CS.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_sysenter_cs, val);
+            auto const *const desc{msr_desc(msr)};
+            if (bsl::unlikely(nullptr == desc)) {
+                bsl::error() << "MSR "                       // --
+                             << bsl::hex(msr)                // --
+                             << " is unsupported/invalid"    // --
+                             << bsl::endl                    // --
+                             << bsl::here();                 // --
+
+                return bsl::errc_failure;
+            }
+
+            if (MSR_EFER.get() == desc->msr) {
+                constexpr auto svme_mask{0x1000_u64};
+                if (bsl::unlikely((val & svme_mask).is_pos())) {
+                    bsl::error() << "MSR EFER: SVME should not be set"    // --
+                                 << bsl::endl                             // --
+                                 << bsl::here();                          // --
+                    return bsl::errc_failure;
                 }
-                case MSR_SYSENTER_ESP.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_sysenter_esp, val);
+
+                return m_reg_cache.write(mut_sys, this->id(), desc->reg, val | svme_mask);
+            }
+
+            if (syscall::bf_reg_t::bf_reg_t_unsupported != desc->reg) {
+                return m_reg_cache.write(mut_sys, this->id(), desc->reg, val);
+            }
+
+            switch (desc->msr) {
+                case MSR_APIC_BASE.get(): {
+                    m_emulated_lapic.set_apic_base(val);
+                    return bsl::errc_success;
                 }
-                case MSR_SYSENTER_EIP.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_sysenter_eip, val);
+                case MSR_TSC_DEADLINE.get(): {
+                    m_emulated_lapic.set_tsc_deadline(val);
+                    return bsl::errc_success;
                 }
-                case MSR_EFER.get(): {
-                    constexpr auto svme_mask{0x1000_u64};
-                    if (bsl::unlikely((val & svme_mask).is_pos())) {
-                        bsl::error() << "MSR EFER: SVME should not be set"    // --
-                                     << bsl::endl                             // --
-                                     << bsl::here();                          // --
+                case MSR_KVM_SYSTEM_TIME_NEW.get(): {
+                    constexpr auto offs_mask{0xFFF_u64};
+                    auto const offs{(val & offs_mask) & ~PVCLOCK_SYSTEM_TIME_ENABLE};
+                    auto const end{(offs + PVCLOCK_VCPU_TIME_INFO_SIZE).checked()};
+                    if (bsl::unlikely(end > HYPERVISOR_PAGE_SIZE)) {
+                        bsl::error() << "pvclock at "                    // --
+                                     << bsl::hex(val)                    // --
+                                     << " crosses a page boundary"       // --
+                                     << bsl::endl                        // --
+                                     << bsl::here();                     // --
+
                         return bsl::errc_failure;
                     }
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_efer, val | svme_mask);
-                }
-                case MSR_STAR.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_star, val);
-                }
-                case MSR_LSTAR.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_lstar, val);
-                }
-                case MSR_CSTAR.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_cstar, val);
-                }
-                case MSR_FMASK.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_fmask, val);
-                }
-                case MSR_FS_BASE.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_fs_base, val);
-                }
-                case MSR_GS_BASE.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_gs_base, val);
-                }
-                case MSR_KERNEL_GS_BASE.get(): {
-                    return mut_sys.bf_vs_op_write(this->id(), mk::bf_reg_t_kernel_gs_base, val);
-                }
 
-                case MSR_APIC_BASE.get(): {
-                    m_emulated_lapic.set_apic_base(val);
+                    m_kvmclock_system_time = val;
+                    m_kvmclock_dirty = true;
                     return bsl::errc_success;
                 }
 
@@ -2123,7 +2400,7 @@ namespace microv
         ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        msr_get_list(syscall::bf_syscall_t const &sys, hypercall::mv_rdl_t &mut_rdl) const noexcept
+        msr_get_list(syscall::bf_syscall_t const &sys, hypercall::mv_rdl_t &mut_rdl) noexcept
             -> bsl::errc_type
         {
             bsl::expects(allocated_status_t::allocated == m_allocated);
@@ -2388,9 +2665,13 @@ namespace microv
         }
 
         /// <!-- description -->
-        ///   @brief Queues an interrupt for injection when this vs_t is
-        ///     capable of injecting interrupts. If the queue is full, this
-        ///     function will fail.
+        ///   @brief Queues an ExtINT interrupt (i.e., an interrupt from the
+        ///     PIC, or one queued from userspace with KVM_INTERRUPT) for
+        ///     injection when this vs_t is capable of injecting interrupts.
+        ///     Like the INTR pin, there is only room for one such
+        ///     interrupt, so if one is already waiting, this function will
+        ///     fail. ExtINT interrupts bypass the LAPIC's IRR and are
+        ///     injected before any interrupt the LAPIC has pending.
         ///
         /// <!-- notes -->
         ///   @note You can only queue an interrupt for a vs_t that is assigned
@@ -2398,11 +2679,11 @@ namespace microv
         ///     interrupt for another vs_t. Instead, you need to IPI the other
         ///     PP, and queue the interrupt into the vs_t from the PP the vs_t
         ///     is assigned to. This is done to ensure that not only is there
-        ///     no need for a lock on the queue, but more importantly, on Intel
-        ///     you cannot actually do interrupt/exception queuing on a vs_t
-        ///     on a remote PP as such an action is undefined by Intel, and
-        ///     we should not be migrating a vs_t to our current PP every time
-        ///     that we need to inject an interrupt.
+        ///     no need for a lock on the LAPIC, but more importantly, on
+        ///     Intel you cannot actually do interrupt/exception queuing on a
+        ///     vs_t on a remote PP as such an action is undefined by Intel,
+        ///     and we should not be migrating a vs_t to our current PP every
+        ///     time that we need to inject an interrupt.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_sys the bf_syscall_t to use
@@ -2419,25 +2700,1551 @@ namespace microv
             bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
             bsl::expects(vector.is_valid_and_checked());
 
-            constexpr auto vint_a_val{0x000000FF010F0100_u64};
-            constexpr auto vint_a_idx{syscall::bf_reg_t::bf_reg_t_virtual_interrupt_a};
-            bsl::expects(mut_sys.bf_vs_op_write(this->id(), vint_a_idx, vint_a_val));
+            if (bsl::unlikely(m_extint_pending)) {
+                bsl::error() << "vs "                                         // --
+                             << bsl::hex(this->id())                          // --
+                             << " already has an ExtINT interrupt pending"    // --
+                             << bsl::endl                                     // --
+                             << bsl::here();                                  // --
+
+                return bsl::errc_failure;
+            }
+
+            m_extint_pending = true;
+            m_extint_vector = vector;
 
-            return m_interrupt_queue.push(vector);
+            return this->update_interrupt_window(mut_sys);
         }
 
         /// <!-- description -->
-        ///   @brief Returns this vs_t's TSC frequency in KHz.
+        ///   @brief Accepts a fixed interrupt into this vs_t's emulated
+        ///     LAPIC. The interrupt is injected in priority order once the
+        ///     guest can take it. If the vector is already pending, the two
+        ///     interrupts coalesce in the LAPIC's IRR.
+        ///
+        /// <!-- notes -->
+        ///   @note Like queue_interrupt, this can only be called on the PP
+        ///     this vs_t is assigned to.
         ///
         /// <!-- inputs/outputs -->
-        ///   @return Returns this vs_t's TSC frequency in KHz.
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param vector the vector to accept
+        ///   @param level true if the interrupt is level triggered
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
         ///
         [[nodiscard]] constexpr auto
-        tsc_khz_get() const noexcept -> bsl::safe_u64
+        queue_lapic_interrupt(
+            syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &vector, bool const level) noexcept
+            -> bsl::errc_type
         {
-            bsl::ensures(m_tsc_khz.is_valid_and_checked());
-            bsl::ensures(m_tsc_khz.is_pos());
-            return m_tsc_khz;
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+            bsl::expects(vector.is_valid_and_checked());
+
+            m_emulated_lapic.accept(vector, level);
+            return this->update_interrupt_window(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vs_t has an interrupt that can be
+        ///     injected, either an ExtINT or a LAPIC interrupt whose
+        ///     priority is above the LAPIC's PPR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this vs_t has an interrupt that can be
+        ///     injected.
+        ///
+        [[nodiscard]] constexpr auto
+        interrupt_pending() const noexcept -> bool
+        {
+            if (m_extint_pending) {
+                return true;
+            }
+
+            return m_emulated_lapic.interrupt_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vs_t is waiting on an ExtINT
+        ///     interrupt to be injected.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this vs_t is waiting on an ExtINT
+        ///     interrupt to be injected.
+        ///
+        [[nodiscard]] constexpr auto
+        extint_pending() const noexcept -> bool
+        {
+            return m_extint_pending;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vs_t's emulated LAPIC takes
+        ///     interrupts from the PIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this vs_t's emulated LAPIC takes
+        ///     interrupts from the PIC.
+        ///
+        [[nodiscard]] constexpr auto
+        accepts_extint() const noexcept -> bool
+        {
+            return m_emulated_lapic.accepts_extint();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an interrupt can be injected into this
+        ///     vs_t right now. This is the case when RFLAGS.IF is set, the
+        ///     guest is not in an STI/MOV SS interrupt shadow and no other
+        ///     event is already waiting to be injected. EVENTINJ does not
+        ///     honor the interrupt shadow, so injecting inside of one would
+        ///     deliver the interrupt early (e.g., between the STI and HLT
+        ///     of an idle loop). While the guest is in a shadow, the
+        ///     virtual interrupt requested by update_interrupt_window()
+        ///     delivers the interrupt once the shadow ends.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @return Returns true if an interrupt can be injected into this
+        ///     vs_t right now.
+        ///
+        [[nodiscard]] constexpr auto
+        interruptible(syscall::bf_syscall_t const &sys) noexcept -> bool
+        {
+            constexpr auto rflags_if{0x200_u64};
+            constexpr auto valid{0x80000000_u64};
+
+            constexpr auto rflags_idx{syscall::bf_reg_t::bf_reg_t_rflags};
+            constexpr auto shadow_idx{syscall::bf_reg_t::bf_reg_t_virtual_interrupt_b};
+            constexpr auto eventinj_idx{syscall::bf_reg_t::bf_reg_t_eventinj};
+
+            if ((m_reg_cache.read(sys, this->id(), rflags_idx) & rflags_if).is_zero()) {
+                return false;
+            }
+
+            if ((m_reg_cache.read(sys, this->id(), shadow_idx) & VMCB_INTERRUPT_SHADOW).is_pos()) {
+                return false;
+            }
+
+            return (m_reg_cache.read(sys, this->id(), eventinj_idx) & valid).is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the EXITINFO1 of this vs_t's last VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @return Returns the EXITINFO1 of this vs_t's last VMExit.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info(syscall::bf_syscall_t const &sys) const noexcept -> bsl::safe_u64
+        {
+            return sys.bf_vs_op_read(this->id(), syscall::bf_reg_t::bf_reg_t_exitinfo1);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vs_t's EVENTINJ field, which describes the event
+        ///     that will be injected on the next VMEntry (if bit 31 is set).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @return Returns this vs_t's EVENTINJ field.
+        ///
+        [[nodiscard]] constexpr auto
+        pending_event(syscall::bf_syscall_t const &sys) const noexcept -> bsl::safe_u64
+        {
+            return sys.bf_vs_op_read(this->id(), syscall::bf_reg_t::bf_reg_t_eventinj);
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores the events that are pending for this vs_t in
+        ///     the provided mv_vs_state_t. This includes the EVENTINJ
+        ///     field (which already contains the event's error code), and
+        ///     any ExtINT that is waiting for an interrupt window.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_state the mv_vs_state_t to store the events in
+        ///
+        constexpr void
+        events_get(
+            syscall::bf_syscall_t const &sys, hypercall::mv_vs_state_t &mut_state) const noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(sys.bf_tls_ppid() == this->assigned_pp());
+
+            mut_state.event = this->pending_event(sys).get();
+            mut_state.event_error_code = {};
+
+            if (m_extint_pending) {
+                mut_state.extint_pending = bsl::safe_u64::magic_1().get();
+            }
+            else {
+                mut_state.extint_pending = {};
+            }
+
+            mut_state.extint_vector = m_extint_vector.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the events that are pending for this vs_t from
+        ///     the provided mv_vs_state_t (see events_get).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param state the mv_vs_state_t to get the events from
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        events_set(syscall::bf_syscall_t &mut_sys, hypercall::mv_vs_state_t const &state) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            constexpr auto event_rsvd{0x7FFFF000_u64};
+            constexpr auto vector_mask{0xFF_u64};
+
+            auto const event{bsl::to_u64(state.event)};
+            auto const vector{bsl::to_u64(state.extint_vector)};
+
+            if (bsl::unlikely((event & event_rsvd).is_pos())) {
+                bsl::error() << "pending event "    // --
+                             << bsl::hex(event)     // --
+                             << " is invalid"       // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely((vector & ~vector_mask).is_pos())) {
+                bsl::error() << "ExtINT vector "    // --
+                             << bsl::hex(vector)    // --
+                             << " is invalid"       // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            constexpr auto idx{syscall::bf_reg_t::bf_reg_t_eventinj};
+
+            auto const ret{mut_sys.bf_vs_op_write(this->id(), idx, event)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            m_extint_pending = bsl::to_u64(state.extint_pending).is_pos();
+            m_extint_vector = vector;
+
+            return this->update_interrupt_window(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Injects the highest priority pending interrupt into
+        ///     this vs_t. A pending ExtINT is injected first, otherwise the
+        ///     highest vector in the LAPIC's IRR is moved to its ISR and
+        ///     injected.
+        ///
+        /// <!-- notes -->
+        ///   @note This is only called once the guest is known to be
+        ///     interruptible and its IP is about to be moved past the HLT,
+        ///     which ends any interrupt shadow, so the shadow is dropped
+        ///     here.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        inject_pending_interrupt(syscall::bf_syscall_t &mut_sys) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+            bsl::expects(this->interrupt_pending());
+
+            constexpr auto shadow_idx{syscall::bf_reg_t::bf_reg_t_virtual_interrupt_b};
+            auto const shadow{m_reg_cache.read(mut_sys, this->id(), shadow_idx)};
+            auto const shadow_val{shadow & ~VMCB_INTERRUPT_SHADOW};
+            bsl::expects(m_reg_cache.write(mut_sys, this->id(), shadow_idx, shadow_val));
+
+            /// NOTE:
+            /// - With AVIC, the CPU delivers the interrupt from the backing
+            ///   page on its own as soon as the guest can take it.
+            ///
+
+            if (m_avic && !m_extint_pending) {
+                return this->update_interrupt_window(mut_sys);
+            }
+
+            bsl::safe_u64 mut_vector{};
+            if (m_extint_pending) {
+                mut_vector = m_extint_vector;
+                m_extint_pending = false;
+                m_extint_vector = {};
+            }
+            else {
+                mut_vector = m_emulated_lapic.ack();
+            }
+
+            auto const ret{this->update_interrupt_window(mut_sys)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            constexpr auto valid{0x80000000_u64};
+            constexpr auto idx{syscall::bf_reg_t::bf_reg_t_eventinj};
+            return m_reg_cache.write(mut_sys, this->id(), idx, valid | mut_vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the APIC ID of this vs_t's emulated LAPIC
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the APIC ID of this vs_t's emulated LAPIC
+        ///
+        [[nodiscard]] constexpr auto
+        apic_id() const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_lapic.id();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided GPA is in the MMIO page of
+        ///     this vs_t's emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address to query
+        ///   @return Returns true if the provided GPA is in the MMIO page of
+        ///     this vs_t's emulated LAPIC.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_handles(bsl::safe_u64 const &gpa) const noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_lapic.handles(gpa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a read from this vs_t's emulated LAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address being read
+        ///   @param tsc the current value of the PP's TSC
+        ///   @return Returns the value that was read
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_read(bsl::safe_u64 const &gpa, bsl::safe_u64 const &tsc) const noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_lapic.read(gpa, this->guest_tsc(tsc));
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a write to this vs_t's emulated LAPIC. Since
+        ///     a write to the TPR or EOI register can unmask an interrupt
+        ///     (and a self IPI can raise one), the interrupt window is
+        ///     updated afterwards. Since a write to the timer registers can
+        ///     arm or disarm the timer, the timer is updated as well.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param gpa the guest physical address being written
+        ///   @param val the value being written
+        ///   @param tsc the current value of the PP's TSC
+        ///   @return Returns the vector to forward to the IOAPIC if the
+        ///     write was an EOI for a level triggered vector, or
+        ///     bsl::safe_u64::failure() otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_write(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &val,
+            bsl::safe_u64 const &tsc) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            auto const vector{m_emulated_lapic.write(gpa, val, this->guest_tsc(tsc))};
+            bsl::expects(this->update_interrupt_window(mut_sys));
+            bsl::expects(this->lapic_timer_update(mut_sys, tsc));
+
+            return vector;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the registers of this vs_t's emulated LAPIC
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_state where to store the LAPIC's registers
+        ///
+        constexpr void
+        lapic_get_all(
+            syscall::bf_syscall_t const &sys, hypercall::mv_lapic_state_t &mut_state) const noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(sys.bf_tls_ppid() == this->assigned_pp());
+
+            m_emulated_lapic.get_all(mut_state);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the registers of this vs_t's emulated LAPIC
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param state the registers to set the LAPIC to
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_set_all(
+            syscall::bf_syscall_t &mut_sys, hypercall::mv_lapic_state_t const &state) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            m_emulated_lapic.set_all(state);
+            return this->update_interrupt_window(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Switches this vs_t's emulated LAPIC over to AVIC if the
+        ///     CPU supports it. The LAPIC's page becomes the AVIC backing
+        ///     page, so that the guest can access its APIC, and take and
+        ///     EOI LAPIC interrupts, without a VMExit. Each vs_t has its
+        ///     own physical and logical APIC ID tables that only contain
+        ///     itself, which is why only self IPIs are accelerated. If the
+        ///     CPU does not support AVIC, the APIC ID or APIC base cannot
+        ///     be used with AVIC, or this vs_t was already switched over,
+        ///     this does nothing, and the emulated LAPIC is used as is.
+        ///
+        /// <!-- notes -->
+        ///   @note This must only be called once the VM's irqchip has been
+        ///     created, as that is when the APIC BAR is mapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_accelerate(syscall::bf_syscall_t &mut_sys) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            if (m_avic || !m_avic_supported) {
+                return bsl::errc_success;
+            }
+
+            auto const apic_id{m_emulated_lapic.id()};
+            if (apic_id > AVIC_MAX_APIC_ID) {
+                return bsl::errc_success;
+            }
+
+            if (this->lapic_base() != LAPIC_BASE_DEFAULT) {
+                return bsl::errc_success;
+            }
+
+            /// NOTE:
+            /// - Pages allocated from the microkernel cannot be freed, so
+            ///   once a vs_t has its APIC ID tables, it keeps them.
+            ///
+
+            if (nullptr == m_avic_physical) {
+                m_avic_physical = mut_sys.bf_mem_op_alloc_page<avic_table_t>(m_avic_physical_spa);
+                if (bsl::unlikely(nullptr == m_avic_physical)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                m_avic_logical = mut_sys.bf_mem_op_alloc_page<avic_table_t>(m_avic_logical_spa);
+                if (bsl::unlikely(nullptr == m_avic_logical)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const entry{m_emulated_lapic.spa() | AVIC_PHYSICAL_RUNNING | AVIC_PHYSICAL_VALID};
+
+            *m_avic_physical = {};
+            *m_avic_logical = {};
+            *m_avic_physical->at_if(bsl::to_idx(apic_id)) = entry.get();
+
+            using mk = syscall::bf_reg_t;
+            auto const vsid{this->id()};
+
+            bsl::expects(
+                mut_sys.bf_vs_op_write(vsid, mk::bf_reg_t_avic_apic_bar, LAPIC_BASE_DEFAULT));
+            bsl::expects(mut_sys.bf_vs_op_write(
+                vsid, mk::bf_reg_t_avic_apic_backing_page_ptr, m_emulated_lapic.spa()));
+            bsl::expects(mut_sys.bf_vs_op_write(
+                vsid, mk::bf_reg_t_avic_logical_table_ptr, m_avic_logical_spa));
+            bsl::expects(mut_sys.bf_vs_op_write(
+                vsid, mk::bf_reg_t_avic_physical_table_ptr, m_avic_physical_spa | apic_id));
+
+            m_avic = true;
+            return this->update_interrupt_window(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells this vs_t that the CPU changed its LAPIC's page
+        ///     on its own, which can unmask a pending interrupt.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_sync(syscall::bf_syscall_t &mut_sys) const noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            return this->update_interrupt_window(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of this vs_t's emulated LAPIC's MMIO
+        ///     page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the GPA of this vs_t's emulated LAPIC's MMIO
+        ///     page.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_base() const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_lapic.get_apic_base() & LAPIC_BASE_ADDR_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TPR of this vs_t's emulated LAPIC
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the TPR of this vs_t's emulated LAPIC
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_tpr() const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_lapic.tpr();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the TPR of this vs_t's emulated LAPIC. Since this
+        ///     can unmask an interrupt, the interrupt window is updated
+        ///     afterwards.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param val the value to set the TPR to
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_set_tpr(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &val) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            m_emulated_lapic.set_tpr(val);
+            return this->update_interrupt_window(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Checks this vs_t's LAPIC timer against the provided TSC
+        ///     value, accepting the timer's vector into the LAPIC if it has
+        ///     expired.
+        ///
+        /// <!-- notes -->
+        ///   @note SVM has no equivalent to the VMX-preemption timer, so
+        ///     an expired timer is only noticed the next time this is
+        ///     called (i.e., on the next run, HLT or VMExit that checks for
+        ///     interrupts). The host's own timer interrupts bound how late
+        ///     that can be. The LAPIC's deadline is in guest TSC ticks, so
+        ///     the PP's TSC is scaled and offset the same way the CPU does
+        ///     for the guest before the two are compared.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param tsc the current value of the PP's TSC
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_timer_update(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &tsc) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+            bsl::expects(tsc.is_valid_and_checked());
+
+            auto const vector{m_emulated_lapic.timer_expire(this->guest_tsc(tsc))};
+            if (vector.is_valid()) {
+                auto const ret{this->queue_lapic_interrupt(mut_sys, vector, false)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of nanoseconds until this vs_t's
+        ///     LAPIC timer fires, 0 if it already has, or
+        ///     bsl::safe_u64::max_value() if it is not armed (or fires so
+        ///     far in the future that it might as well not be).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current value of the PP's TSC
+        ///   @return Returns the number of nanoseconds until this vs_t's
+        ///     LAPIC timer fires.
+        ///
+        [[nodiscard]] constexpr auto
+        lapic_timer_ns(bsl::safe_u64 const &tsc) const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(tsc.is_valid_and_checked());
+
+            auto const deadline{m_emulated_lapic.timer_deadline()};
+            if (deadline.is_zero()) {
+                return bsl::safe_u64::max_value();
+            }
+
+            auto const guest_tsc{this->guest_tsc(tsc)};
+            if (deadline <= guest_tsc) {
+                return {};
+            }
+
+            auto const left{(deadline - guest_tsc).checked()};
+            auto const max_ms{(bsl::safe_u64::max_value() / HALT_POLL_NS_PER_MS).checked()};
+            if ((left / m_tsc_khz).checked() >= max_ms) {
+                return bsl::safe_u64::max_value();
+            }
+
+            return tsc_ticks_to_ns(left, m_tsc_khz);
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives this vs_t the PAUSE-loop exiting thresholds of
+        ///     its VM. PAUSE instructions that are no more than "gap"
+        ///     cycles apart are part of the same loop, and a loop that runs
+        ///     for more than "window" cycles causes a VMExit. If either
+        ///     threshold is 0, or the CPU does not have a PAUSE filter
+        ///     with a threshold, PAUSE never causes a VMExit. The VMCB is
+        ///     only written when the thresholds change.
+        ///
+        /// <!-- notes -->
+        ///   @note SVM counts PAUSEs instead of cycles. The gap becomes the
+        ///     PAUSE filter threshold, which resets the count when two
+        ///     PAUSEs are further apart, and the window becomes the number
+        ///     of PAUSEs that fit in it (window / gap). Both are limited to
+        ///     16 bits.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param gap the max number of cycles between two PAUSEs of a loop
+        ///   @param window the max number of cycles a loop can run for
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pause_exiting_update(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u64 const &gap,
+            bsl::safe_u64 const &window) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+            bsl::expects(gap.is_valid_and_checked());
+            bsl::expects(window.is_valid_and_checked());
+
+            if (!m_pause_filter_supported) {
+                return bsl::errc_success;
+            }
+
+            if (gap == m_pause_gap && window == m_pause_window) {
+                return bsl::errc_success;
+            }
+
+            m_pause_gap = gap;
+            m_pause_window = window;
+
+            using mk = syscall::bf_reg_t;
+            auto const vsid{this->id()};
+
+            constexpr auto intercept_pause{0x00800000_u64};
+            constexpr auto intercept1_idx{mk::bf_reg_t_intercept_instruction1};
+            auto const intercept1{mut_sys.bf_vs_op_read(vsid, intercept1_idx)};
+
+            /// NOTE:
+            /// - A PAUSE filter count of 0 means that every PAUSE exits,
+            ///   so when PAUSE-loop exiting is disabled, the PAUSE
+            ///   intercept itself must be turned off.
+            ///
+
+            if (gap.is_zero() || window.is_zero()) {
+                return mut_sys.bf_vs_op_write(vsid, intercept1_idx, intercept1 & ~intercept_pause);
+            }
+
+            constexpr auto filter_max{0xFFFF_u64};
+
+            auto mut_threshold{gap};
+            if (mut_threshold > filter_max) {
+                mut_threshold = filter_max;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto mut_count{(window / mut_threshold).checked()};
+            if (mut_count > filter_max) {
+                mut_count = filter_max;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_count.is_zero()) {
+                mut_count = bsl::safe_u64::magic_1();
+            }
+            else {
+                bsl::touch();
+            }
+
+            constexpr auto threshold_idx{mk::bf_reg_t_pause_filter_threshold};
+            bsl::expects(mut_sys.bf_vs_op_write(vsid, threshold_idx, mut_threshold));
+
+            constexpr auto count_idx{mk::bf_reg_t_pause_filter_count};
+            bsl::expects(mut_sys.bf_vs_op_write(vsid, count_idx, mut_count));
+
+            return mut_sys.bf_vs_op_write(vsid, intercept1_idx, intercept1 | intercept_pause);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of TSC ticks a HLT from this vs_t
+        ///     should be polled for before handing it to the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of TSC ticks a HLT from this vs_t
+        ///     should be polled for before handing it to the root VM.
+        ///
+        [[nodiscard]] constexpr auto
+        halt_poll_window() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_halt_poll.window();
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a HLT that was woken up while polling.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cycles the number of cycles spent polling
+        ///
+        constexpr void
+        halt_poll_hit(bsl::safe_u64 const &cycles) noexcept
+        {
+            m_stats.add_halt_poll(hypercall::MV_STATS_HALT_POLL_SLOT_HIT, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a HLT that is being handed to the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cycles the number of cycles spent polling
+        ///   @param tsc the current TSC
+        ///
+        constexpr void
+        halt_poll_miss(bsl::safe_u64 const &cycles, bsl::safe_u64 const &tsc) noexcept
+        {
+            m_halt_poll.miss(tsc);
+            m_stats.add_halt_poll(hypercall::MV_STATS_HALT_POLL_SLOT_MISS, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells this vs_t that it is about to run again, which
+        ///     adjusts its halt-poll window if it was halted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current TSC
+        ///   @param observable true if the wakeup could have been seen
+        ///     while polling
+        ///
+        constexpr void
+        halt_poll_wakeup(bsl::safe_u64 const &tsc, bool const observable) noexcept
+        {
+            auto const old_window{m_halt_poll.window()};
+            m_halt_poll.wakeup(tsc, m_host_tsc_khz, observable);
+
+            if (m_halt_poll.window() > old_window) {
+                m_stats.add_halt_poll_resize(hypercall::MV_STATS_HALT_POLL_SLOT_GROW);
+            }
+            else if (m_halt_poll.window() < old_window) {
+                m_stats.add_halt_poll_resize(hypercall::MV_STATS_HALT_POLL_SLOT_SHRINK);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a VMExit in this vs_t's statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles spent handling the VMExit
+        ///
+        constexpr void
+        stats_add_exit(bsl::safe_u64 const &reason, bsl::safe_u64 const &cycles) noexcept
+        {
+            m_stats.add_exit(reason, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hypercall in this vs_t's statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the hypercall
+        ///   @param cycles the number of cycles spent handling the hypercall
+        ///
+        constexpr void
+        stats_add_hypercall(bsl::safe_u64 const &slot, bsl::safe_u64 const &cycles) noexcept
+        {
+            m_stats.add_hypercall(slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vs_t's statistics of the provided type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type the MV_STATS_TYPE of the statistics to return
+        ///   @return Returns the requested statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats_get(bsl::safe_u64 const &type) const noexcept -> hypercall::mv_stats_t const *
+        {
+            return m_stats.get(type);
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes the registers that were set through this vs_t's
+        ///     register cache back to the microkernel. This must be called
+        ///     before this vs_t runs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reg_cache_flush(syscall::bf_syscall_t &mut_sys) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_reg_cache.flush(mut_sys, this->id());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the requested register of this
+        ///     vs_t using its register cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param reg the register to read
+        ///   @return Returns the value of the requested register, or
+        ///     bsl::safe_u64::failure() on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        reg_cache_read(syscall::bf_syscall_t const &sys, syscall::bf_reg_t const reg) noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_reg_cache.read(sys, this->id(), reg);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of the requested register of this vs_t
+        ///     using its register cache. The value is written back by
+        ///     reg_cache_flush().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param reg the register to write
+        ///   @param val the value to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        reg_cache_write(
+            syscall::bf_syscall_t &mut_sys,
+            syscall::bf_reg_t const reg,
+            bsl::safe_u64 const &val) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_reg_cache.write(mut_sys, this->id(), reg, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Drops this vs_t's cached registers. This must be called
+        ///     each time this vs_t VMExits, as its registers have changed.
+        ///
+        constexpr void
+        reg_cache_invalidate() noexcept
+        {
+            m_reg_cache.invalidate();
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the SPA of this vs_t's exit page. IO and MMIO
+        ///     exits are then reported using the shared page again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        clr_exit_page_spa(syscall::bf_syscall_t &mut_sys) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_exit_page.clr_spa(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the SPA of this vs_t's exit page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param spa the system physical address of the exit page
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_exit_page_spa(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &spa) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_exit_page.set_spa(mut_sys, spa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vs_t's exit page as a T *, or a nullptr
+        ///     if it does not have one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of exit record to return
+        ///   @return Returns this vs_t's exit page as a T *, or a nullptr
+        ///     if it does not have one.
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        exit_page() const noexcept -> T *
+        {
+            return m_exit_page.get<T>();
+        }
+
+        /// <!-- description -->
+        ///   @brief Decodes the instruction that generated an MMIO access
+        ///     using this vs_t's current execution mode.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param bytes the instruction bytes to decode
+        ///   @param num the total number of valid bytes in "bytes"
+        ///   @param mut_access where to store the results of the decode
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_decode(
+            syscall::bf_syscall_t const &sys,
+            instruction_bytes_t const &bytes,
+            bsl::safe_u64 const &num,
+            mmio_access_t &mut_access) const noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(sys.bf_tls_ppid() == this->assigned_pp());
+
+            constexpr auto efer_lma{0x400_u64};
+            constexpr auto cs_l{0x200_u64};
+            constexpr auto cs_d{0x400_u64};
+
+            auto const efer{sys.bf_vs_op_read(this->id(), syscall::bf_reg_t::bf_reg_t_efer)};
+            constexpr auto cs_attrib_idx{syscall::bf_reg_t::bf_reg_t_cs_attrib};
+            auto const cs_attrib{sys.bf_vs_op_read(this->id(), cs_attrib_idx)};
+
+            bool const long_mode{(efer & efer_lma).is_pos() && (cs_attrib & cs_l).is_pos()};
+            bool const default32{(cs_attrib & cs_d).is_pos()};
+
+            return emulated_decoder_t::decode(bytes, num, long_mode, default32, mut_access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the data that a decoded MMIO write from this
+        ///     vs_t will write to memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param access the decoded MMIO write
+        ///   @return Returns the data that a decoded MMIO write from this
+        ///     vs_t will write to memory, or bsl::safe_u64::failure() on
+        ///     error.
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_write_data(syscall::bf_syscall_t const &sys, mmio_access_t const &access) noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_decoder.write_data(sys, m_reg_cache, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a decoded MMIO read that must be completed
+        ///     the next time this vs_t is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param access the decoded MMIO read
+        ///
+        constexpr void
+        mmio_set_pending_read(mmio_access_t const &access) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_emulated_decoder.set_pending_read(access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vs_t has an MMIO read that is
+        ///     waiting for its data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this vs_t has an MMIO read that is
+        ///     waiting for its data.
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_read_pending() const noexcept -> bool
+        {
+            return m_emulated_decoder.is_read_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes this vs_t's pending MMIO read by writing
+        ///     the provided data to the destination register.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param data the data that was read from the MMIO region
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        mmio_complete_read(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &data) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            return m_emulated_decoder.complete_read(mut_sys, m_reg_cache, data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records an IN/INS access that must be completed the
+        ///     next time this vs_t is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param access the IN/INS access to record
+        ///
+        constexpr void
+        io_set_pending_in(io_access_t const &access) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_emulated_io.set_pending_in(access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vs_t has an IN/INS access that is
+        ///     waiting for its data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if this vs_t has an IN/INS access that is
+        ///     waiting for its data.
+        ///
+        [[nodiscard]] constexpr auto
+        io_in_pending() const noexcept -> bool
+        {
+            return m_emulated_io.is_in_pending();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the IN/INS access this vs_t is waiting on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the IN/INS access this vs_t is waiting on.
+        ///
+        [[nodiscard]] constexpr auto
+        io_pending_in() const noexcept -> io_access_t const &
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_io.pending_in();
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes this vs_t's pending IN/INS access. See
+        ///     emulated_io_t::complete_in for more details.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param data the data that was read from the port
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        io_complete_in(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &data) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+
+            return m_emulated_io.complete_in(mut_sys, m_reg_cache, data);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vs_t's TSC frequency in KHz.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns this vs_t's TSC frequency in KHz.
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_khz_get() const noexcept -> bsl::safe_u64
+        {
+            bsl::ensures(m_tsc_khz.is_valid_and_checked());
+            bsl::ensures(m_tsc_khz.is_pos());
+            return m_tsc_khz;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TSC frequency in KHz of the PPs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the TSC frequency in KHz of the PPs.
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_host_khz_get() const noexcept -> bsl::safe_u64
+        {
+            bsl::ensures(m_host_tsc_khz.is_valid_and_checked());
+            bsl::ensures(m_host_tsc_khz.is_pos());
+            return m_host_tsc_khz;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets this vs_t's TSC frequency in KHz. Unless the
+        ///     frequency is the same as the PP's, the CPU has to support
+        ///     TSC scaling. The emulated LAPIC's timer uses the new
+        ///     frequency from then on. TSC_RATIO is an MSR and not part of
+        ///     the VMCB, so it is only loaded by tsc_load().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param tsc_khz the TSC frequency in KHz to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_set_khz(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &tsc_khz) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+            bsl::expects(tsc_khz.is_valid_and_checked());
+            bsl::expects(tsc_khz.is_pos());
+
+            bsl::safe_u64 mut_ratio{MSR_TSC_RATIO_ONE};
+            if (tsc_khz != m_host_tsc_khz) {
+                if (bsl::unlikely(!m_tsc_scaling_supported)) {
+                    bsl::error() << "TSC scaling is not supported, so vs "    // --
+                                 << bsl::hex(this->id())                      // --
+                                 << " cannot run at "                         // --
+                                 << tsc_khz                                   // --
+                                 << " KHz"                                    // --
+                                 << bsl::endl                                 // --
+                                 << bsl::here();                              // --
+
+                    return bsl::errc_failure;
+                }
+
+                mut_ratio = tsc_ratio(tsc_khz, m_host_tsc_khz, MSR_TSC_RATIO_FRAC_BITS);
+                if (bsl::unlikely(mut_ratio.is_invalid())) {
+                    bsl::error() << "a TSC frequency of "         // --
+                                 << tsc_khz                       // --
+                                 << " KHz cannot be scaled to"    // --
+                                 << bsl::endl                     // --
+                                 << bsl::here();                  // --
+
+                    return bsl::errc_failure;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_tsc_ratio = mut_ratio;
+            m_tsc_khz = tsc_khz;
+            m_emulated_lapic.set_tsc_khz(tsc_khz);
+            m_kvmclock_dirty = true;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vs_t's TSC offset. The guest's TSC is the
+        ///     PP's TSC, scaled to this vs_t's frequency, plus this offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns this vs_t's TSC offset.
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_offset_get() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_tsc_offset.is_valid_and_checked());
+            return m_tsc_offset;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets this vs_t's TSC offset. The guest's TSC is the
+        ///     PP's TSC, scaled to this vs_t's frequency, plus this offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param offset the TSC offset to set
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_offset_set(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &offset) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+            bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_pp());
+            bsl::expects(offset.is_valid_and_checked());
+
+            constexpr auto tsc_offset_idx{syscall::bf_reg_t::bf_reg_t_tsc_offset};
+            auto const ret{mut_sys.bf_vs_op_write(this->id(), tsc_offset_idx, offset)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            m_tsc_offset = offset;
+            m_tsc_last_ppid = {};
+            m_kvmclock_dirty = true;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Loads this vs_t's TSC_RATIO and makes sure the guest's
+        ///     TSC does not go backwards when this vs_t is set active on a
+        ///     different PP than the one it was last set inactive on. PPs
+        ///     whose TSCs are not in sync would otherwise let the guest see
+        ///     time jump back after being migrated, in which case the TSC
+        ///     offset is moved forward by the difference.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        tsc_load(syscall::bf_syscall_t &mut_sys, intrinsic_t const &intrinsic) noexcept
+        {
+            if (m_tsc_ratio != MSR_TSC_RATIO_ONE) {
+                bsl::expects(mut_sys.bf_intrinsic_op_wrmsr(MSR_TSC_RATIO, m_tsc_ratio));
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const ppid{mut_sys.bf_tls_ppid()};
+            if (m_tsc_last_ppid.is_zero() || ppid == ~m_tsc_last_ppid) {
+                return;
+            }
+
+            auto const now{this->guest_tsc(intrinsic.rdtsc())};
+            if (now < m_tsc_last) {
+                auto const offset{tsc_add(m_tsc_offset, (m_tsc_last - now).checked())};
+                bsl::expects(this->tsc_offset_set(mut_sys, offset));
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_tsc_last_ppid = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Records the guest's TSC as this vs_t is set inactive,
+        ///     so that tsc_load() can tell if it went backwards. If this
+        ///     vs_t changed TSC_RATIO, it is put back so that no other vs_t
+        ///     is scaled by it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        tsc_save(syscall::bf_syscall_t &mut_sys, intrinsic_t const &intrinsic) noexcept
+        {
+            m_tsc_last = this->guest_tsc(intrinsic.rdtsc());
+            m_tsc_last_ppid = ~mut_sys.bf_tls_ppid();
+
+            if (m_tsc_ratio != MSR_TSC_RATIO_ONE) {
+                bsl::expects(mut_sys.bf_intrinsic_op_wrmsr(MSR_TSC_RATIO, MSR_TSC_RATIO_ONE));
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vs_t's pvclock has to be written
+        ///     before it runs. This is the case when the guest enabled
+        ///     kvmclock and either something the pvclock depends on
+        ///     changed (the pvclock's GPA, the TSC frequency or offset,
+        ///     or kvmclock_stop() was called), or the VM's kvmclock was
+        ///     set since the pvclock was last written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gen the VM's current kvmclock generation
+        ///   @return Returns true if this vs_t's pvclock has to be written
+        ///     before it runs.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_pending(bsl::safe_u64 const &gen) const noexcept -> bool
+        {
+            if ((m_kvmclock_system_time & PVCLOCK_SYSTEM_TIME_ENABLE).is_zero()) {
+                return false;
+            }
+
+            if (m_kvmclock_dirty) {
+                return true;
+            }
+
+            return gen != m_kvmclock_gen;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of this vs_t's pvclock, which is the
+        ///     value of MSR_KVM_SYSTEM_TIME_NEW without the enable bit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the GPA of this vs_t's pvclock
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_gpa() const noexcept -> bsl::safe_u64
+        {
+            return (m_kvmclock_system_time & ~PVCLOCK_SYSTEM_TIME_ENABLE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns what this vs_t's pvclock has to contain so
+        ///     that the guest reads the VM's kvmclock, given that the
+        ///     kvmclock was "ns" when the PP's TSC was "tsc". The version
+        ///     is advanced, and the pvclock is considered up to date for
+        ///     the provided generation from then on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the PP's TSC when the VM's kvmclock was set
+        ///   @param ns the VM's kvmclock in nanoseconds at "tsc"
+        ///   @param gen the VM's current kvmclock generation
+        ///   @return Returns the new contents of this vs_t's pvclock
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_update(
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u64 const &ns,
+            bsl::safe_u64 const &gen) noexcept -> pvclock_vcpu_time_info_t
+        {
+            constexpr auto version_inc{2_u64};
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+
+            pvclock_vcpu_time_info_t mut_info{};
+
+            m_kvmclock_version = (m_kvmclock_version + version_inc).checked();
+            mut_info.version = m_kvmclock_version;
+            mut_info.tsc_timestamp = this->guest_tsc(tsc);
+            mut_info.system_time = ns;
+            tsc_pvclock_scale(m_tsc_khz, mut_info.tsc_to_system_mul, mut_info.tsc_shift);
+
+            mut_info.flags = PVCLOCK_TSC_STABLE_BIT;
+            if (m_kvmclock_stopped) {
+                mut_info.flags |= PVCLOCK_GUEST_STOPPED;
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_kvmclock_gen = gen;
+            m_kvmclock_dirty = {};
+            m_kvmclock_stopped = {};
+
+            return mut_info;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets PVCLOCK_GUEST_STOPPED the next time this vs_t's
+        ///     pvclock is written, which tells the guest that it was
+        ///     paused and should not report a soft lockup. Fails if the
+        ///     guest has not enabled kvmclock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_stop() noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (bsl::unlikely((m_kvmclock_system_time & PVCLOCK_SYSTEM_TIME_ENABLE).is_zero())) {
+                bsl::error() << "vs "                             // --
+                             << bsl::hex(this->id())              // --
+                             << " has not enabled kvmclock"       // --
+                             << bsl::endl                         // --
+                             << bsl::here();                      // --
+
+                return bsl::errc_failure;
+            }
+
+            m_kvmclock_stopped = true;
+            m_kvmclock_dirty = true;
+
+            return bsl::errc_success;
+        }
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the guest's kvm_steal_time, or 0 if
+        ///     the guest has not enabled steal time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the GPA of the guest's kvm_steal_time, or 0 if
+        ///     the guest has not enabled steal time.
+        ///
+        [[nodiscard]] constexpr auto
+        kvm_steal_time_gpa() const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_msr.kvm_steal_time_gpa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the guest's PV EOI word, or 0 if the
+        ///     guest has not enabled PV EOI.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the GPA of the guest's PV EOI word, or 0 if the
+        ///     guest has not enabled PV EOI.
+        ///
+        [[nodiscard]] constexpr auto
+        kvm_pv_eoi_gpa() const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_msr.kvm_pv_eoi_gpa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the guest may skip the EOI of the
+        ///     vector its emulated LAPIC has in service, and if so, marks
+        ///     the PV EOI as pending. This is only the case when the
+        ///     guest enabled PV EOI, the CPU is not completing EOIs on its
+        ///     own (AVIC), and the LAPIC's EOI would have no side
+        ///     effects other than completing that vector.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the guest's PV EOI word must be set
+        ///     before this vs_t runs.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_eoi_arm() noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(running_status_t::running != m_status);
+
+            if (m_avic || m_pv_eoi_pending) {
+                return false;
+            }
+
+            if (this->kvm_pv_eoi_gpa().is_zero()) {
+                return false;
+            }
+
+            m_pv_eoi_pending = m_emulated_lapic.pv_eoi_ready();
+            return m_pv_eoi_pending;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the guest's PV EOI word was set the
+        ///     last time this vs_t was run, and has not been looked at
+        ///     since.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if a PV EOI is pending
+        ///
+        [[nodiscard]] constexpr auto
+        pv_eoi_pending() const noexcept -> bool
+        {
+            return m_pv_eoi_pending;
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes a pending PV EOI. If the guest cleared its PV
+        ///     EOI word, it skipped the EOI, and the vector its emulated
+        ///     LAPIC has in service is completed here instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param eoi true if the guest cleared its PV EOI word
+        ///
+        constexpr void
+        pv_eoi_complete(bool const eoi) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(m_pv_eoi_pending);
+
+            if (eoi) {
+                m_emulated_lapic.pv_eoi();
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_pv_eoi_pending = {};
         }
     };
 }
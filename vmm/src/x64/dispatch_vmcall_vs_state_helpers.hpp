@@ -0,0 +1,279 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMCALL_VS_STATE_HELPERS_HPP
+#define DISPATCH_VMCALL_VS_STATE_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_vmcall_helpers.hpp>
+#include <msr_table.hpp>
+#include <mv_mp_state_t.hpp>
+#include <mv_reg_t.hpp>
+#include <mv_vs_state_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    static_assert(bsl::to_u64(hypercall::MV_MAX_REG_T) <= hypercall::MV_VS_STATE_MAX_REGS);
+    static_assert(MSR_TABLE.size() <= hypercall::MV_VS_STATE_MAX_MSRS);
+
+    /// <!-- description -->
+    ///   @brief Returns true if "reg" is an mv_reg_t that is part of a
+    ///     VS's state. The GDTR and IDTR have no selector or attributes,
+    ///     so those are the only mv_reg_t values that are left out.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the mv_reg_t to query
+    ///   @return Returns true if "reg" is an mv_reg_t that is part of a
+    ///     VS's state.
+    ///
+    [[nodiscard]] constexpr auto
+    is_vs_state_reg(bsl::safe_u64 const &reg) noexcept -> bool
+    {
+        using mv = hypercall::mv_reg_t;
+
+        if (reg.is_zero() || reg >= bsl::to_u64(hypercall::MV_MAX_REG_T)) {
+            return false;
+        }
+
+        switch (hypercall::to_mv_reg_t(reg)) {
+            case mv::mv_reg_t_gdtr_selector:
+            case mv::mv_reg_t_gdtr_attrib:
+            case mv::mv_reg_t_idtr_selector:
+            case mv::mv_reg_t_idtr_attrib: {
+                return false;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores MV_VS_STATE_CHUNK_CPU of a VS in "mut_state". The
+    ///     registers are every mv_reg_t that is_vs_state_reg accepts,
+    ///     and the MSRs are every MSR in MSR_TABLE.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to save
+    ///   @param mut_state the mv_vs_state_t to store the VS's state in
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    vs_state_get_cpu(
+        syscall::bf_syscall_t const &sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        hypercall::mv_vs_state_t &mut_state) noexcept -> bsl::errc_type
+    {
+        mut_state = {};
+
+        mut_state.version = hypercall::MV_VS_STATE_VERSION.get();
+        mut_state.num_chunks = bsl::to_u32(hypercall::MV_VS_STATE_NUM_CHUNKS).get();
+        mut_state.mp_state = hypercall::to_u64(mut_vs_pool.mp_state_get(vsid)).get();
+        mut_state.tsc_offset = mut_vs_pool.tsc_offset_get(vsid).get();
+        mut_vs_pool.events_get(sys, mut_state, vsid);
+
+        bsl::safe_u64 mut_num{};
+        auto const max_reg{bsl::to_u64(hypercall::MV_MAX_REG_T)};
+        for (auto mut_reg{bsl::safe_u64::magic_1()}; mut_reg < max_reg; ++mut_reg) {
+            if (!is_vs_state_reg(mut_reg)) {
+                continue;
+            }
+
+            auto const val{mut_vs_pool.reg_get(sys, mut_reg, vsid)};
+            if (bsl::unlikely(val.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto *const pmut_entry{mut_state.regs.at_if(bsl::to_idx(mut_num))};
+            pmut_entry->reg = mut_reg.get();
+            pmut_entry->val = val.get();
+
+            ++mut_num;
+        }
+
+        mut_state.num_regs = mut_num.get();
+
+        mut_num = {};
+        for (auto const &desc : MSR_TABLE) {
+            auto const msr{bsl::to_u64(desc.msr)};
+            auto const val{mut_vs_pool.msr_get(sys, msr, vsid)};
+            if (bsl::unlikely(val.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto *const pmut_entry{mut_state.msrs.at_if(bsl::to_idx(mut_num))};
+            pmut_entry->reg = msr.get();
+            pmut_entry->val = val.get();
+
+            ++mut_num;
+        }
+
+        mut_state.num_msrs = mut_num.get();
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Restores MV_VS_STATE_CHUNK_CPU of a VS from "state". The
+    ///     MP state is restored first as moving a VS into INIT resets
+    ///     its registers. MSRs that already have the requested value
+    ///     are skipped, which keeps read-only MSRs like MCG_CAP from
+    ///     failing the restore.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to restore
+    ///   @param state the mv_vs_state_t to restore the VS's state from
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    vs_state_set_cpu(
+        syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        hypercall::mv_vs_state_t const &state) noexcept -> bsl::errc_type
+    {
+        bsl::errc_type mut_ret{};
+
+        if (bsl::unlikely(hypercall::MV_VS_STATE_VERSION != state.version)) {
+            bsl::error() << "VS state version "           // --
+                         << bsl::to_u32(state.version)    // --
+                         << " is unsupported"             // --
+                         << bsl::endl                     // --
+                         << bsl::here();                  // --
+
+            return bsl::errc_failure;
+        }
+
+        if (bsl::unlikely(hypercall::MV_VS_STATE_NUM_CHUNKS != state.num_chunks)) {
+            bsl::error() << "VS state with "                 // --
+                         << bsl::to_u32(state.num_chunks)    // --
+                         << " chunks is unsupported"         // --
+                         << bsl::endl                        // --
+                         << bsl::here();                     // --
+
+            return bsl::errc_failure;
+        }
+
+        if (bsl::unlikely(state.num_regs > hypercall::MV_VS_STATE_MAX_REGS)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        if (bsl::unlikely(state.num_msrs > hypercall::MV_VS_STATE_MAX_MSRS)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto const mp_state{get_mp_state(bsl::to_u64(state.mp_state))};
+        if (bsl::unlikely(mp_state == hypercall::mv_mp_state_t::mv_mp_state_t_invalid)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        if (mut_vs_pool.mp_state_get(vsid) != mp_state) {
+            mut_ret = mut_vs_pool.mp_state_set(mut_sys, mp_state, vsid);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        for (bsl::safe_idx mut_i{}; mut_i < state.num_regs; ++mut_i) {
+            auto const *const entry{state.regs.at_if(mut_i)};
+            auto const reg{bsl::to_u64(entry->reg)};
+
+            if (bsl::unlikely(!is_vs_state_reg(reg))) {
+                bsl::error() << "VS state register "    // --
+                             << bsl::hex(reg)           // --
+                             << " is unsupported"       // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return bsl::errc_failure;
+            }
+
+            mut_ret = mut_vs_pool.reg_set(mut_sys, reg, bsl::to_u64(entry->val), vsid);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+        }
+
+        for (bsl::safe_idx mut_i{}; mut_i < state.num_msrs; ++mut_i) {
+            auto const *const entry{state.msrs.at_if(mut_i)};
+            auto const msr{bsl::to_u64(entry->reg)};
+            auto const val{bsl::to_u64(entry->val)};
+
+            auto const cur{mut_vs_pool.msr_get(mut_sys, msr, vsid)};
+            if (bsl::unlikely(cur.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (cur == val) {
+                continue;
+            }
+
+            mut_ret = mut_vs_pool.msr_set(mut_sys, msr, val, vsid);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return mut_ret;
+            }
+        }
+
+        mut_ret = mut_vs_pool.tsc_offset_set(mut_sys, bsl::to_u64(state.tsc_offset), vsid);
+        if (bsl::unlikely(!mut_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return mut_ret;
+        }
+
+        return mut_vs_pool.events_set(mut_sys, state, vsid);
+    }
+}
+
+#endif
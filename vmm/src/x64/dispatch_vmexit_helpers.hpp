@@ -0,0 +1,163 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_HELPERS_HPP
+#define DISPATCH_VMEXIT_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <mv_bit_size_t.hpp>
+#include <mv_constants.hpp>
+#include <mv_translation_t.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the type used to access a page of guest memory
+    using guest_page_t = bsl::array<bsl::uint8, HYPERVISOR_PAGE_SIZE.get()>;
+
+    /// <!-- description -->
+    ///   @brief Translates a GLA from the requested VS to a SPA that can
+    ///     be mapped using the pp_pool_t. If paging is disabled, the GLA
+    ///     is used as the GPA. The active VS must be the requested VS.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS the GLA belongs to
+    ///   @param gla the GLA to translate
+    ///   @return Returns the resulting SPA (including the page offset of
+    ///     "gla"), or bsl::safe_u64::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    guest_gla_to_spa(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &gla) noexcept -> bsl::safe_u64
+    {
+        constexpr auto cr0_pg{0x80000000_u64};
+        constexpr auto offs_mask{0xFFF_u64};
+        constexpr auto mask_1g{0x3FFFF000_u64};
+        constexpr auto mask_2m{0x001FF000_u64};
+
+        auto const gla_page{hypercall::mv_page_aligned(gla)};
+        auto const cr0{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_cr0)};
+
+        bsl::safe_u64 mut_gpa_page{gla_page};
+        if ((cr0 & cr0_pg).is_pos()) {
+            auto const xlate{vs_pool.gla_to_gpa(mut_sys, mut_pp_pool, gla_page, vsid)};
+            if (bsl::unlikely(!xlate.is_valid)) {
+                bsl::error() << "failed to translate gla "    // --
+                             << bsl::hex(gla)                 // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            /// NOTE:
+            /// - Large pages only report the base of the large page,
+            ///   so we have to add back the 4k page we are actually
+            ///   interested in.
+            ///
+
+            bsl::safe_u64 mut_large_mask{};
+            if ((xlate.flags & hypercall::MV_MAP_FLAG_1G_PAGE).is_pos()) {
+                mut_large_mask = mask_1g;
+            }
+            else if ((xlate.flags & hypercall::MV_MAP_FLAG_2M_PAGE).is_pos()) {
+                mut_large_mask = mask_2m;
+            }
+            else {
+                bsl::touch();
+            }
+
+            mut_gpa_page = (xlate.paddr & ~mut_large_mask) | (gla_page & mut_large_mask);
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const vmid{vs_pool.assigned_vm(vsid)};
+        auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, mut_gpa_page, vmid)};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::safe_u64::failure();
+        }
+
+        return (spa | (gla & offs_mask)).checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the mv_bit_size_t associated with the provided
+    ///     number of bytes.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param bytes the number of bytes to convert (1, 2, 4 or 8)
+    ///   @return Returns the mv_bit_size_t associated with the provided
+    ///     number of bytes.
+    ///
+    [[nodiscard]] constexpr auto
+    bytes_to_bit_size(bsl::safe_u64 const &bytes) noexcept -> hypercall::mv_bit_size_t
+    {
+        constexpr auto bytes2{2_u64};
+        constexpr auto bytes4{4_u64};
+        constexpr auto bytes8{8_u64};
+
+        if (bytes8 == bytes) {
+            return hypercall::mv_bit_size_t::mv_bit_size_t_64;
+        }
+
+        if (bytes4 == bytes) {
+            return hypercall::mv_bit_size_t::mv_bit_size_t_32;
+        }
+
+        if (bytes2 == bytes) {
+            return hypercall::mv_bit_size_t::mv_bit_size_t_16;
+        }
+
+        return hypercall::mv_bit_size_t::mv_bit_size_t_8;
+    }
+}
+
+#endif
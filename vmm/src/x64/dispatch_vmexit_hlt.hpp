@@ -26,9 +26,17 @@
 #define DISPATCH_VMEXIT_HLT_HPP
 
 #include <bf_syscall_t.hpp>
+#include <dispatch_abi_helpers.hpp>
+#include <dispatch_vmcall_helpers.hpp>
+#include <dispatch_vmexit_io_helpers.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <mv_exit_reason_t.hpp>
+#include <mv_run_t.hpp>
 #include <page_pool_t.hpp>
+#include <pause.hpp>
 #include <pp_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
@@ -39,22 +47,37 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the RFLAGS.IF bit
+    constexpr auto HLT_RFLAGS_IF{0x200_u64};
+
     /// <!-- description -->
-    ///   @brief Dispatches HLT VMExits.
+    ///   @brief Dispatches HLT VMExits. If the guest can be woken up by an
+    ///     interrupt, the HLT is polled for in MicroV for up to the VS's
+    ///     adaptive halt-poll window. If an interrupt becomes pending in
+    ///     that time, it is injected and the guest is resumed without
+    ///     ever leaving MicroV. A KVM_HC_KICK_CPU from another VS ends
+    ///     the poll the same way. Otherwise, the HLT is handed to the root
+    ///     VM which can block the VS until it is needed again, or until
+    ///     the time in mv_run_t.hlt_timeout_ns has passed. Before
+    ///     any of this, bytes still buffered by the emulated UART are
+    ///     handed to the root VM so that console output is not held back
+    ///     while the guest is idle.
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
-    ///   @param tls the tls_t to use
+    ///   @param mut_tls the tls_t to use
     ///   @param mut_sys the bf_syscall_t to use
     ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
-    ///   @param pp_pool the pp_pool_t to use
-    ///   @param vm_pool the vm_pool_t to use
-    ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
@@ -62,29 +85,160 @@ namespace microv
     [[nodiscard]] constexpr auto
     dispatch_vmexit_hlt(
         gs_t const &gs,
-        tls_t const &tls,
+        tls_t &mut_tls,
         syscall::bf_syscall_t &mut_sys,
         page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
-        pp_pool_t const &pp_pool,
-        vm_pool_t const &vm_pool,
-        vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
         bsl::discard(gs);
-        bsl::discard(tls);
-        bsl::discard(mut_sys);
         bsl::discard(page_pool);
-        bsl::discard(intrinsic);
-        bsl::discard(pp_pool);
-        bsl::discard(vm_pool);
-        bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
-        bsl::discard(vsid);
-
-        bsl::error() << "dispatch_vmexit_hlt not implemented\n" << bsl::here();
-        return bsl::errc_failure;
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        if constexpr (MICROV_EMULATED_UART) {
+            auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+            if (mut_vm_pool.uart_tx_pending(mut_tls, vmid)) {
+                return flush_vmexit_uart(
+                    mut_tls,
+                    mut_sys,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+            }
+
+            bsl::touch();
+        }
+
+        /// NOTE:
+        /// - With RFLAGS.IF clear, an external interrupt cannot wake the
+        ///   guest up, but a KVM_HC_KICK_CPU or a PV NMI from another VS
+        ///   in the same VM can (this is how PV spinlocks wait), so the
+        ///   HLT is still polled for, just without injecting anything.
+        /// - While polling, interrupts are disabled on this PP, which
+        ///   means that the root VM's interrupts are delayed by up to the
+        ///   poll window. This is why the window is bounded by
+        ///   MICROV_HALT_POLL_NS and shrinks when polling is not paying
+        ///   off.
+        ///
+
+        auto const start{intrinsic.rdtsc()};
+        auto mut_now{start};
+
+        constexpr auto rflags_idx{syscall::bf_reg_t::bf_reg_t_rflags};
+        auto const rflags{mut_vs_pool.reg_cache_read(mut_sys, rflags_idx, vsid)};
+        bool const intr{(rflags & HLT_RFLAGS_IF).is_pos()};
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        auto const apic_id{mut_vs_pool.apic_id(vsid)};
+        auto const window{mut_vs_pool.halt_poll_window(vsid)};
+
+        while (true) {
+            if constexpr (MICROV_EMULATED_IRQCHIP) {
+                auto const ret{queue_vm_interrupt(
+                    mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vs_pool, vsid)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+            }
+
+            if (intr && mut_vs_pool.interrupt_pending(vsid)) {
+                mut_vs_pool.halt_poll_hit((mut_now - start).checked(), vsid);
+
+                auto const ret{mut_vs_pool.inject_pending_interrupt(mut_sys, vsid)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            if (mut_vm_pool.pv_kick_ack(mut_tls, apic_id, vmid)) {
+                mut_vs_pool.halt_poll_hit((mut_now - start).checked(), vsid);
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            if ((mut_now - start).checked() >= window) {
+                break;
+            }
+
+            pause();
+            mut_now = intrinsic.rdtsc();
+        }
+
+        mut_vs_pool.halt_poll_miss((mut_now - start).checked(), mut_now, vsid);
+
+        /// NOTE:
+        /// - MicroV only checks the VS's timers on the way into the guest,
+        ///   so the root VM is told how long it can block the VS for.
+        /// - IPIs, NMIs and kicks from other VSs only go to the VM's
+        ///   mailbox, which the root VM cannot see, so the VS is marked as
+        ///   halted, and a VS that posts to it from now on returns to the
+        ///   root VM so that it can be woken up. If something was posted
+        ///   since the poll ended, the VS does not halt at all.
+        ///
+
+        /// NOTE:
+        /// - A timer that is not armed reports bsl::safe_u64::max_value(),
+        ///   which is the same as MV_RUN_HLT_NO_TIMEOUT.
+        ///
+
+        auto mut_timeout{hypercall::MV_RUN_HLT_NO_TIMEOUT};
+        if constexpr (MICROV_EMULATED_IRQCHIP) {
+            if (mut_vm_pool.irqchip_enabled(vmid)) {
+                if (!mut_vm_pool.pv_halt(mut_tls, apic_id, vmid)) {
+                    return vmexit_success_advance_ip_and_run;
+                }
+
+                mut_timeout = mut_vs_pool.lapic_timer_ns(mut_now, vsid);
+
+                if constexpr (MICROV_EMULATED_PIT) {
+                    auto const tsc_khz{mut_vs_pool.tsc_host_khz_get(vsid)};
+                    auto const pit{mut_vm_pool.pit_irq_ns(mut_tls, tsc_khz, mut_now, vmid)};
+                    if (pit < mut_timeout) {
+                        mut_timeout = pit;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        auto mut_run{mut_pp_pool.shared_page<hypercall::mv_run_t>(mut_sys)};
+        if (bsl::unlikely(mut_run.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        mut_run->hlt_timeout_ns = mut_timeout.get();
+
+        // ---------------------------------------------------------------------
+        // Context: Change To Root VM
+        // ---------------------------------------------------------------------
+
+        switch_to_root(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, true);
+
+        // ---------------------------------------------------------------------
+        // Context: Root VM
+        // ---------------------------------------------------------------------
+
+        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+        set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_HLT));
+
+        return vmexit_success_advance_ip_and_run;
     }
 }
 
@@ -26,6 +26,7 @@
 #define DISPATCH_VMEXIT_EXTERNAL_INTERRUPT_WINDOW_HPP
 
 #include <bf_syscall_t.hpp>
+#include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
@@ -39,11 +40,16 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
     /// <!-- description -->
-    ///   @brief Dispatches external interrupt window VMExits.
+    ///   @brief Dispatches external interrupt window VMExits. These are
+    ///     requested when an interrupt is queued for a VS, and occur once
+    ///     the guest is able to take it, at which point the oldest queued
+    ///     interrupt is injected.
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
@@ -54,7 +60,7 @@ namespace microv
     ///   @param pp_pool the pp_pool_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
@@ -69,23 +75,32 @@ namespace microv
         pp_pool_t const &pp_pool,
         vm_pool_t const &vm_pool,
         vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
         bsl::discard(gs);
         bsl::discard(tls);
-        bsl::discard(mut_sys);
         bsl::discard(page_pool);
         bsl::discard(intrinsic);
         bsl::discard(pp_pool);
         bsl::discard(vm_pool);
         bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
-        bsl::discard(vsid);
 
-        bsl::error() << "dispatch_vmexit_external_interrupt_window not implemented\n"
-                     << bsl::here();
-        return bsl::errc_failure;
+        /// NOTE:
+        /// - The window is re-evaluated every time the LAPIC's IRR, ISR
+        ///   or TPR changes and is closed once nothing deliverable is
+        ///   left, so there is always something to inject.
+        ///
+
+        bsl::expects(mut_vs_pool.interrupt_pending(vsid));
+
+        auto const ret{mut_vs_pool.inject_pending_interrupt(mut_sys, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        return vmexit_success_run;
     }
 }
 
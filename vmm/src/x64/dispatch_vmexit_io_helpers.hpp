@@ -0,0 +1,876 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_IO_HELPERS_HPP
+#define DISPATCH_VMEXIT_IO_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_abi_helpers.hpp>
+#include <dispatch_vmcall_helpers.hpp>
+#include <dispatch_vmexit_helpers.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_pit_helpers.hpp>
+#include <emulated_pit_t.hpp>
+#include <emulated_uart_t.hpp>
+#include <errc_types.hpp>
+#include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <mv_constants.hpp>
+#include <mv_exit_io_t.hpp>
+#include <mv_exit_page_io_t.hpp>
+#include <mv_exit_reason_t.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Returns the default address size (in bytes) of the
+    ///     requested VS given its current execution mode. This is used
+    ///     when hardware does not report the address size of a string
+    ///     instruction.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param vsid the ID of the VS to query
+    ///   @return Returns the default address size (in bytes) of the
+    ///     requested VS.
+    ///
+    [[nodiscard]] constexpr auto
+    io_default_addr_bytes(syscall::bf_syscall_t const &sys, bsl::safe_u16 const &vsid) noexcept
+        -> bsl::safe_u64
+    {
+        constexpr auto efer_lma{0x400_u64};
+        constexpr auto cs_l{0x200_u64};
+        constexpr auto cs_d{0x400_u64};
+
+        auto const efer{sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_efer)};
+        auto const cs_attrib{sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_cs_attrib)};
+
+        if ((efer & efer_lma).is_pos() && (cs_attrib & cs_l).is_pos()) {
+            return 8_u64;
+        }
+
+        if ((cs_attrib & cs_d).is_pos()) {
+            return 4_u64;
+        }
+
+        return 2_u64;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the result of writing "val" to a register that is
+    ///     currently set to "reg" using the provided address size. 16bit
+    ///     writes preserve the upper bits of the register while 32bit
+    ///     writes zero extend, the same as hardware.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the current value of the register
+    ///   @param val the value to write to the register
+    ///   @param addr_bytes the address size in bytes (2, 4 or 8)
+    ///   @return Returns the resulting value of the register
+    ///
+    [[nodiscard]] constexpr auto
+    io_merge_reg(
+        bsl::safe_u64 const &reg,
+        bsl::safe_u64 const &val,
+        bsl::safe_u64 const &addr_bytes) noexcept -> bsl::safe_u64
+    {
+        constexpr auto bytes2{2_u64};
+        constexpr auto bytes4{4_u64};
+        constexpr auto mask2{0x000000000000FFFF_u64};
+        constexpr auto mask4{0x00000000FFFFFFFF_u64};
+
+        if (bytes2 == addr_bytes) {
+            return (reg & ~mask2) | (val & mask2);
+        }
+
+        if (bytes4 == addr_bytes) {
+            return val & mask4;
+        }
+
+        return val;
+    }
+
+    /// <!-- description -->
+    ///   @brief Prepares a batch of a string IO instruction (INS/OUTS).
+    ///     The batch is limited by the remaining count (RCX for REP, 1
+    ///     otherwise), the end of the guest page that RSI/RDI points to and
+    ///     the size of mv_exit_io_t.buf. On success, mut_access.count and
+    ///     mut_access.spa describe the batch and RSI/RDI and RCX have
+    ///     been updated to reflect the elements in the batch. A count of
+    ///     0 means that there is nothing to do (i.e., REP with RCX == 0).
+    ///     The active VS must be the VS that generated the VMExit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param mut_access the string IO access to prepare
+    ///   @return Returns the number of elements that remain after this
+    ///     batch, or bsl::safe_u64::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    io_prepare_string(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        io_access_t &mut_access) noexcept -> bsl::safe_u64
+    {
+        constexpr auto rflags_df{0x400_u64};
+        constexpr auto offs_mask{0xFFF_u64};
+
+        /// NOTE:
+        /// - Merging all 1s into 0 yields the mask for the address size
+        ///
+
+        auto const addr_mask{io_merge_reg({}, bsl::safe_u64::max_value(), mut_access.addr_bytes)};
+
+        syscall::bf_reg_t mut_ptr_idx{syscall::bf_reg_t::bf_reg_t_rsi};
+        syscall::bf_reg_t mut_seg_idx{syscall::bf_reg_t::bf_reg_t_ds_base};
+        if (mut_access.in) {
+            mut_ptr_idx = syscall::bf_reg_t::bf_reg_t_rdi;
+            mut_seg_idx = syscall::bf_reg_t::bf_reg_t_es_base;
+        }
+        else {
+            bsl::touch();
+        }
+
+        constexpr auto rflags_idx{syscall::bf_reg_t::bf_reg_t_rflags};
+        constexpr auto rcx_idx{syscall::bf_reg_t::bf_reg_t_rcx};
+
+        auto const rflags{mut_vs_pool.reg_cache_read(mut_sys, rflags_idx, vsid)};
+        auto const rcx{mut_vs_pool.reg_cache_read(mut_sys, rcx_idx, vsid)};
+        auto const ptr{mut_vs_pool.reg_cache_read(mut_sys, mut_ptr_idx, vsid)};
+        auto const seg{mut_vs_pool.reg_cache_read(mut_sys, mut_seg_idx, vsid)};
+
+        mut_access.down = (rflags & rflags_df).is_pos();
+
+        bsl::safe_u64 mut_todo{1_u64};
+        if (mut_access.rep) {
+            mut_todo = rcx & addr_mask;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (mut_todo.is_zero()) {
+            mut_access.count = {};
+            return {};
+        }
+
+        auto const gla{(seg + (ptr & addr_mask)).checked()};
+        auto const offs{gla & offs_mask};
+
+        /// NOTE:
+        /// - Each exit only ever touches a single guest page. Elements
+        ///   that straddle a page boundary are rare enough (they require
+        ///   a misaligned buffer) that we do not support them.
+        ///
+
+        bsl::safe_u64 mut_fit{};
+        if (mut_access.down) {
+            if ((offs + mut_access.bytes) <= HYPERVISOR_PAGE_SIZE) {
+                mut_fit = (offs / mut_access.bytes) + 1_u64;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+        else {
+            mut_fit = (HYPERVISOR_PAGE_SIZE - offs) / mut_access.bytes;
+        }
+
+        if (bsl::unlikely(mut_fit.is_zero())) {
+            bsl::error() << "string io that crosses a page boundary is not supported: "    // --
+                         << bsl::hex(gla)                                                   // --
+                         << bsl::endl                                                       // --
+                         << bsl::here();                                                    // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        auto const max{hypercall::MV_EXIT_IO_MAX_BUF_SIZE / mut_access.bytes};
+
+        mut_access.count = mut_todo;
+        if (mut_access.count > mut_fit) {
+            mut_access.count = mut_fit;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (mut_access.count > max) {
+            mut_access.count = max;
+        }
+        else {
+            bsl::touch();
+        }
+
+        mut_access.spa =
+            guest_gla_to_spa(tls, mut_sys, page_pool, mut_pp_pool, vm_pool, mut_vs_pool, vsid, gla);
+        if (bsl::unlikely(mut_access.spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::safe_u64::failure();
+        }
+
+        auto const delta{(mut_access.count * mut_access.bytes).checked()};
+
+        bsl::safe_u64 mut_next{};
+        if (mut_access.down) {
+            mut_next = (ptr & addr_mask) - delta;
+        }
+        else {
+            mut_next = (ptr & addr_mask) + delta;
+        }
+
+        if (bsl::unlikely(mut_next.is_invalid())) {
+            bsl::error() << "string io wrapped the address space\n" << bsl::here();
+            return bsl::safe_u64::failure();
+        }
+
+        auto const next_ptr{io_merge_reg(ptr, mut_next & addr_mask, mut_access.addr_bytes)};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, mut_ptr_idx, next_ptr, vsid));
+
+        if (!mut_access.rep) {
+            return {};
+        }
+
+        auto const remaining{(mut_todo - mut_access.count).checked()};
+        auto const next_rcx{io_merge_reg(rcx, remaining, mut_access.addr_bytes)};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, rcx_idx, next_rcx, vsid));
+
+        return remaining;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the page offset of the idx'th element of a string
+    ///     IO access given the page offset of the first element.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param access the string IO access
+    ///   @param offs the page offset of the first element
+    ///   @param idx the index of the element
+    ///   @return Returns the page offset of the idx'th element
+    ///
+    [[nodiscard]] constexpr auto
+    io_element_offset(
+        io_access_t const &access, bsl::safe_u64 const &offs, bsl::safe_u64 const &idx) noexcept
+        -> bsl::safe_u64
+    {
+        if (access.down) {
+            return (offs - (idx * access.bytes)).checked();
+        }
+
+        return (offs + (idx * access.bytes)).checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Hands the bytes buffered by the VM's emulated UART to the
+    ///     root VM as a byte sized string OUT. The guest's IP is left
+    ///     alone so that the instruction that caused the VMExit is
+    ///     executed again once the root VM has drained the buffer.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    flush_vmexit_uart(
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+
+        // ---------------------------------------------------------------------
+        // Context: Change To Root VM
+        // ---------------------------------------------------------------------
+
+        switch_to_root(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, false);
+
+        // ---------------------------------------------------------------------
+        // Context: Root VM
+        // ---------------------------------------------------------------------
+
+        auto mut_exit_io{mut_pp_pool.shared_page<hypercall::mv_exit_io_t>(mut_sys)};
+        bsl::expects(mut_exit_io.is_valid());
+
+        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+
+        /// NOTE:
+        /// - Another VS of the same VM might have flushed the buffer
+        ///   between the check that got us here and now. In that case
+        ///   there is nothing to hand over, and the root VM is simply
+        ///   asked to run the VS again.
+        ///
+
+        auto const flushed{mut_vm_pool.uart_flush(mut_tls, *mut_exit_io, vmid)};
+        if (flushed.is_zero()) {
+            set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_INTERRUPT));
+        }
+        else {
+            set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_IO));
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Emulates a port IO access to the VM's emulated UART
+    ///     without leaving MicroV if possible. Returns
+    ///     vmexit_success_advance_ip_and_run if the access was emulated,
+    ///     bsl::errc_success if the access has to be handed to the root VM
+    ///     and bsl::errc_failure on error. If the access has to be handed
+    ///     to the root VM while the UART is still buffering bytes, the
+    ///     buffer is flushed first so that the root VM sees the accesses
+    ///     in order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param access the port IO access reported by hardware
+    ///   @return Returns vmexit_success_advance_ip_and_run if the access
+    ///     was handled, bsl::errc_success if the access still needs to be
+    ///     handed to the root VM, bsl::errc_failure and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    emulate_vmexit_uart(
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        io_access_t const &access) noexcept -> bsl::errc_type
+    {
+        constexpr auto mask1{0x00000000000000FF_u64};
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        auto const rax{mut_sys.bf_tls_rax()};
+
+        if (access.in) {
+            auto const val{mut_vm_pool.uart_read(mut_tls, access, vmid)};
+            if (val.is_valid()) {
+                mut_sys.bf_tls_set_rax((rax & ~mask1) | (val & mask1));
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            bsl::touch();
+        }
+        else {
+            if (mut_vm_pool.uart_write(mut_tls, access, rax, vmid)) {
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            bsl::touch();
+        }
+
+        if (!mut_vm_pool.uart_tx_pending(mut_tls, vmid)) {
+            return bsl::errc_success;
+        }
+
+        return flush_vmexit_uart(
+            mut_tls, mut_sys, intrinsic, mut_pp_pool, mut_vm_pool, mut_vp_pool, mut_vs_pool, vsid);
+    }
+
+    /// <!-- description -->
+    ///   @brief Emulates an access to a port that the root VM marked as
+    ///     MV_IO_PERM_EMULATE. These ports have nothing behind them, so
+    ///     they behave the same as an empty ISA bus: IN returns all ones
+    ///     and OUT is dropped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param access the port IO access reported by hardware
+    ///   @return Returns vmexit_success_advance_ip_and_run
+    ///
+    [[nodiscard]] constexpr auto
+    emulate_vmexit_io_unclaimed(syscall::bf_syscall_t &mut_sys, io_access_t const &access) noexcept
+        -> bsl::errc_type
+    {
+        bsl::expects(!access.string);
+
+        if (access.in) {
+            constexpr auto bytes1{1_u64};
+            constexpr auto bytes2{2_u64};
+            constexpr auto mask1{0x00000000000000FF_u64};
+            constexpr auto mask2{0x000000000000FFFF_u64};
+            constexpr auto mask4{0x00000000FFFFFFFF_u64};
+
+            auto const rax{mut_sys.bf_tls_rax()};
+            if (bytes1 == access.bytes) {
+                mut_sys.bf_tls_set_rax(rax | mask1);
+            }
+            else if (bytes2 == access.bytes) {
+                mut_sys.bf_tls_set_rax(rax | mask2);
+            }
+            else {
+                mut_sys.bf_tls_set_rax(mask4);
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes a non-string port IO access into a VS's exit page
+    ///     (see mv_vs_op_set_exit_page_gpa). The data is stored in data8,
+    ///     data16 or data32 depending on the size of the access, and
+    ///     data_offset tells software which one that is.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_exit_page the exit page to write the access to
+    ///   @param access the port IO access to write
+    ///   @param rax the guest's RAX at the time of the access
+    ///
+    constexpr void
+    io_write_exit_page(
+        hypercall::mv_exit_page_io_t *const pmut_exit_page,
+        io_access_t const &access,
+        bsl::safe_u64 const &rax) noexcept
+    {
+        constexpr auto bytes1{1_u64};
+        constexpr auto bytes2{2_u64};
+        constexpr auto mask1{0x00000000000000FF_u64};
+        constexpr auto mask2{0x000000000000FFFF_u64};
+        constexpr auto mask4{0x00000000FFFFFFFF_u64};
+
+        bsl::safe_u64 mut_data{};
+        if (access.in) {
+            pmut_exit_page->direction = hypercall::MV_EXIT_PAGE_IO_IN.get();
+        }
+        else {
+            pmut_exit_page->direction = hypercall::MV_EXIT_PAGE_IO_OUT.get();
+            mut_data = rax;
+        }
+
+        pmut_exit_page->size = bsl::to_u8_unsafe(access.bytes).get();
+        pmut_exit_page->port = access.port.get();
+        pmut_exit_page->count = bsl::safe_u32::magic_1().get();
+
+        if (bytes1 == access.bytes) {
+            pmut_exit_page->data_offset = hypercall::MV_EXIT_PAGE_IO_DATA8_OFFSET.get();
+            pmut_exit_page->data8 = bsl::to_u8_unsafe(mut_data & mask1).get();
+        }
+        else if (bytes2 == access.bytes) {
+            pmut_exit_page->data_offset = hypercall::MV_EXIT_PAGE_IO_DATA16_OFFSET.get();
+            pmut_exit_page->data16 = bsl::to_u16_unsafe(mut_data & mask2).get();
+        }
+        else {
+            pmut_exit_page->data_offset = hypercall::MV_EXIT_PAGE_IO_DATA32_OFFSET.get();
+            pmut_exit_page->data32 = bsl::to_u32_unsafe(mut_data & mask4).get();
+        }
+
+        pmut_exit_page->exit_reason = hypercall::MV_EXIT_PAGE_REASON_IO.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the data that software placed in a VS's exit page
+    ///     for a non-string IN access (see io_write_exit_page).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param exit_page the exit page to read the data from
+    ///   @param access the pending IN access
+    ///   @return Returns the data that software placed in a VS's exit page
+    ///
+    [[nodiscard]] constexpr auto
+    io_read_exit_page(
+        hypercall::mv_exit_page_io_t const *const exit_page, io_access_t const &access) noexcept
+        -> bsl::safe_u64
+    {
+        constexpr auto bytes1{1_u64};
+        constexpr auto bytes2{2_u64};
+
+        if (bytes1 == access.bytes) {
+            return bsl::to_u64(exit_page->data8);
+        }
+
+        if (bytes2 == access.bytes) {
+            return bsl::to_u64(exit_page->data16);
+        }
+
+        return bsl::to_u64(exit_page->data32);
+    }
+
+    /// <!-- description -->
+    ///   @brief Handles a port IO access from a guest VM. OUT provides
+    ///     the data being written while IN is recorded in the VS and
+    ///     completed the next time the root VM executes mv_vs_op_run.
+    ///     String instructions are handed to the root VM in batches (see
+    ///     io_prepare_string), and REP instructions are continued by
+    ///     leaving the IP alone until RCX reaches 0. Accesses to the
+    ///     emulated UART and PIT are handled in MicroV when possible, as
+    ///     are non-string accesses to ports marked as MV_IO_PERM_EMULATE.
+    ///     If the VS has an exit page, non-string accesses are written to
+    ///     it instead of the shared page and the root VM is told so with
+    ///     EXIT_REASON_EXIT_PAGE.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param access the port IO access reported by hardware
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_vmexit_io(
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        io_access_t const &access) noexcept -> bsl::errc_type
+    {
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        // ---------------------------------------------------------------------
+        // Context: Guest VM
+        // ---------------------------------------------------------------------
+
+        if constexpr (MICROV_EMULATED_UART) {
+            if (emulated_uart_t::handles(access.port)) {
+                auto const ret{emulate_vmexit_uart(
+                    mut_tls,
+                    mut_sys,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid,
+                    access)};
+
+                if (bsl::errc_success != ret) {
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        if constexpr (MICROV_EMULATED_IRQCHIP) {
+            if (emulated_pic_t::handles(access.port)) {
+                if (emulate_vmexit_pic(mut_tls, mut_sys, mut_vm_pool, mut_vs_pool, vsid, access)) {
+                    return vmexit_success_advance_ip_and_run;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        if constexpr (MICROV_EMULATED_PIT) {
+            if (emulated_pit_t::handles(access.port)) {
+                if (emulate_vmexit_pit(
+                        mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vs_pool, vsid, access)) {
+                    return vmexit_success_advance_ip_and_run;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        if (!access.string) {
+            auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+            if (mut_vm_pool.io_emulated(access.port, vmid)) {
+                return emulate_vmexit_io_unclaimed(mut_sys, access);
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        io_access_t mut_access{access};
+        mut_access.count = 1_u64;
+
+        bool mut_advance_ip{true};
+        if (mut_access.string) {
+            auto const remaining{io_prepare_string(
+                mut_tls,
+                mut_sys,
+                page_pool,
+                mut_pp_pool,
+                mut_vm_pool,
+                mut_vs_pool,
+                vsid,
+                mut_access)};
+            if (bsl::unlikely(remaining.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (mut_access.count.is_zero()) {
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            mut_advance_ip = remaining.is_zero();
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const rax{mut_sys.bf_tls_rax()};
+        if (mut_access.in) {
+            mut_vs_pool.io_set_pending_in(mut_access, vsid);
+        }
+        else {
+            bsl::touch();
+        }
+
+        // ---------------------------------------------------------------------
+        // Context: Change To Root VM
+        // ---------------------------------------------------------------------
+
+        switch_to_root(
+            mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, mut_advance_ip);
+
+        // ---------------------------------------------------------------------
+        // Context: Root VM
+        // ---------------------------------------------------------------------
+
+        if (!mut_access.string) {
+            auto *const pmut_exit_page{mut_vs_pool.exit_page<hypercall::mv_exit_page_io_t>(vsid)};
+            if (nullptr != pmut_exit_page) {
+                io_write_exit_page(pmut_exit_page, mut_access, rax);
+                set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+                set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_EXIT_PAGE));
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto mut_exit_io{mut_pp_pool.shared_page<hypercall::mv_exit_io_t>(mut_sys)};
+        bsl::expects(mut_exit_io.is_valid());
+
+        mut_exit_io->addr = mut_access.port.get();
+        mut_exit_io->size = bytes_to_bit_size(mut_access.bytes);
+
+        if (mut_access.in) {
+            mut_exit_io->type = hypercall::MV_EXIT_IO_IN.get();
+            mut_exit_io->data = {};
+        }
+        else {
+            constexpr auto bytes1{1_u64};
+            constexpr auto bytes2{2_u64};
+            constexpr auto mask1{0x00000000000000FF_u64};
+            constexpr auto mask2{0x000000000000FFFF_u64};
+            constexpr auto mask4{0x00000000FFFFFFFF_u64};
+
+            mut_exit_io->type = hypercall::MV_EXIT_IO_OUT.get();
+            if (bytes1 == mut_access.bytes) {
+                mut_exit_io->data = (rax & mask1).get();
+            }
+            else if (bytes2 == mut_access.bytes) {
+                mut_exit_io->data = (rax & mask2).get();
+            }
+            else {
+                mut_exit_io->data = (rax & mask4).get();
+            }
+        }
+
+        if (!mut_access.string) {
+            mut_exit_io->reps = {};
+            set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+            set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_IO));
+            return vmexit_success_advance_ip_and_run;
+        }
+
+        mut_exit_io->reps = mut_access.count.get();
+        if (!mut_access.in) {
+            auto const page{mut_pp_pool.map<guest_page_t const>(
+                mut_sys, hypercall::mv_page_aligned(mut_access.spa))};
+            if (bsl::unlikely(page.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            constexpr auto offs_mask{0xFFF_u64};
+            auto const offs{mut_access.spa & offs_mask};
+
+            bsl::safe_u64 mut_dst{};
+            for (bsl::safe_u64 mut_i{}; mut_i < mut_access.count; ++mut_i) {
+                auto const src{io_element_offset(mut_access, offs, mut_i)};
+                for (bsl::safe_u64 mut_j{}; mut_j < mut_access.bytes; ++mut_j) {
+                    *mut_exit_io->buf.at_if(bsl::to_idx(mut_dst)) =
+                        *page->at_if(bsl::to_idx(src + mut_j));
+                    ++mut_dst;
+                }
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+        set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_IO));
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Completes any IN/INS access that the requested VS is
+    ///     waiting on using the data that the root VM placed in
+    ///     mv_exit_io_t (or the VS's exit page for an IN). For INS, the
+    ///     elements are copied into the guest's buffer. This must be
+    ///     called before the VS is made active.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is about to run
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    complete_vmexit_io(
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        if (!mut_vs_pool.io_in_pending(vsid)) {
+            return bsl::errc_success;
+        }
+
+        auto const access{mut_vs_pool.io_pending_in(vsid)};
+        if (!access.string) {
+            auto const *const exit_page{mut_vs_pool.exit_page<hypercall::mv_exit_page_io_t>(vsid)};
+            if (nullptr != exit_page) {
+                auto const data{io_read_exit_page(exit_page, access)};
+                return mut_vs_pool.io_complete_in(mut_sys, data, vsid);
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const exit_io{mut_pp_pool.shared_page<hypercall::mv_exit_io_t>(mut_sys)};
+        if (bsl::unlikely(exit_io.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        if (access.string) {
+            auto mut_page{
+                mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(access.spa))};
+            if (bsl::unlikely(mut_page.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            constexpr auto offs_mask{0xFFF_u64};
+            auto const offs{access.spa & offs_mask};
+
+            bsl::safe_u64 mut_src{};
+            for (bsl::safe_u64 mut_i{}; mut_i < access.count; ++mut_i) {
+                auto const dst{io_element_offset(access, offs, mut_i)};
+                for (bsl::safe_u64 mut_j{}; mut_j < access.bytes; ++mut_j) {
+                    *mut_page->at_if(bsl::to_idx(dst + mut_j)) =
+                        *exit_io->buf.at_if(bsl::to_idx(mut_src));
+                    ++mut_src;
+                }
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_vs_pool.io_complete_in(mut_sys, bsl::to_u64(exit_io->data), vsid);
+    }
+}
+
+#endif
@@ -0,0 +1,599 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_IRQCHIP_HELPERS_HPP
+#define DISPATCH_VMEXIT_IRQCHIP_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_abi_helpers.hpp>
+#include <dispatch_vmcall_helpers.hpp>
+#include <dispatch_vmexit_helpers.hpp>
+#include <emulated_ioapic_t.hpp>
+#include <emulated_pic_t.hpp>
+#include <errc_types.hpp>
+#include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <mmio_access_t.hpp>
+#include <mv_exit_reason_t.hpp>
+#include <mv_run_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the GSI the PIT drives
+    constexpr auto PIT_GSI{0_u64};
+
+    /// <!-- description -->
+    ///   @brief Emulates a port IO access to the VM's emulated PIC. Returns
+    ///     true if the access was emulated, in which case the guest can
+    ///     simply be resumed, or false if it has to be handed to the root
+    ///     VM (i.e., the VM's irqchip was never created).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param access the port IO access reported by hardware
+    ///   @return Returns true if the access was emulated, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    emulate_vmexit_pic(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid,
+        io_access_t const &access) noexcept -> bool
+    {
+        constexpr auto mask1{0x00000000000000FF_u64};
+
+        auto const vmid{vs_pool.assigned_vm(vsid)};
+        if (!mut_vm_pool.irqchip_enabled(vmid)) {
+            return false;
+        }
+
+        auto const rax{mut_sys.bf_tls_rax()};
+        if (!access.in) {
+            return mut_vm_pool.pic_write(tls, access, rax, vmid);
+        }
+
+        auto const val{mut_vm_pool.pic_read(tls, access, vmid)};
+        if (val.is_invalid()) {
+            return false;
+        }
+
+        mut_sys.bf_tls_set_rax((rax & ~mask1) | (val & mask1));
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Emulates a decoded MMIO access to the VM's emulated IOAPIC
+    ///     and advances the guest past the instruction. Reads are
+    ///     completed right away, so unlike other MMIO accesses, the root
+    ///     VM never sees them.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param gpa the guest physical address that was accessed
+    ///   @param access the decoded MMIO access
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    emulate_vmexit_ioapic(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &gpa,
+        mmio_access_t const &access) noexcept -> bsl::errc_type
+    {
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+
+        if (access.write) {
+            auto const data{mut_vs_pool.mmio_write_data(mut_sys, access, vsid)};
+            if (bsl::unlikely(data.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            mut_vm_pool.ioapic_write(tls, gpa, access.bytes, data, vmid);
+        }
+        else {
+            mut_vs_pool.mmio_set_pending_read(access, vsid);
+
+            auto const data{mut_vm_pool.ioapic_read(tls, gpa, access.bytes, vmid)};
+            auto const ret{mut_vs_pool.mmio_complete_read(mut_sys, data, vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            bsl::touch();
+        }
+
+        constexpr auto rip_idx{syscall::bf_reg_t::bf_reg_t_rip};
+        auto const rip{mut_vs_pool.reg_cache_read(mut_sys, rip_idx, vsid)};
+        auto const next_rip{(rip + access.len).checked()};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, rip_idx, next_rip, vsid));
+
+        return vmexit_success_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Emulates a decoded MMIO access to the VS's emulated LAPIC
+    ///     and advances the guest past the instruction. An EOI of a level
+    ///     triggered vector is forwarded to the VM's emulated IOAPIC so
+    ///     that it can clear remote IRR.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param gpa the guest physical address that was accessed
+    ///   @param access the decoded MMIO access
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    emulate_vmexit_lapic(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &gpa,
+        mmio_access_t const &access) noexcept -> bsl::errc_type
+    {
+        if (access.write) {
+            auto const data{mut_vs_pool.mmio_write_data(mut_sys, access, vsid)};
+            if (bsl::unlikely(data.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto const tsc{intrinsic.rdtsc()};
+            auto const vector{mut_vs_pool.lapic_write(mut_sys, gpa, data, tsc, vsid)};
+            if (vector.is_valid()) {
+                mut_vm_pool.ioapic_eoi(tls, vector, mut_vs_pool.assigned_vm(vsid));
+            }
+            else {
+                bsl::touch();
+            }
+        }
+        else {
+            mut_vs_pool.mmio_set_pending_read(access, vsid);
+
+            auto const data{mut_vs_pool.lapic_read(gpa, intrinsic.rdtsc(), vsid)};
+            auto const ret{mut_vs_pool.mmio_complete_read(mut_sys, data, vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            bsl::touch();
+        }
+
+        constexpr auto rip_idx{syscall::bf_reg_t::bf_reg_t_rip};
+        auto const rip{mut_vs_pool.reg_cache_read(mut_sys, rip_idx, vsid)};
+        auto const next_rip{(rip + access.len).checked()};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, rip_idx, next_rip, vsid));
+
+        return vmexit_success_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Replays a guest write to the VS's emulated LAPIC that the
+    ///     CPU has already stored in the LAPIC's register page (i.e., a
+    ///     trap-like APIC write VMExit from APICv or AVIC), so that the
+    ///     side effects of the write (e.g., sending a self IPI or
+    ///     forwarding an EOI to the IOAPIC) take place. The CPU has
+    ///     already advanced the guest past the instruction.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param offset the offset of the LAPIC register that was written
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    replay_vmexit_lapic_write(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &offset) noexcept -> bsl::errc_type
+    {
+        auto const tsc{intrinsic.rdtsc()};
+        auto const gpa{mut_vs_pool.lapic_base(vsid) | offset};
+        auto const data{mut_vs_pool.lapic_read(gpa, tsc, vsid)};
+
+        auto const vector{mut_vs_pool.lapic_write(mut_sys, gpa, data, tsc, vsid)};
+        if (vector.is_valid()) {
+            mut_vm_pool.ioapic_eoi(tls, vector, mut_vs_pool.assigned_vm(vsid));
+        }
+        else {
+            bsl::touch();
+        }
+
+        return vmexit_success_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Moves the IPIs that other VSs of the VM sent to the
+    ///     requested VS with KVM_HC_SEND_IPI into the IRR of its emulated
+    ///     LAPIC, and injects an NMI if one was sent. The VS must be
+    ///     assigned to the current PP and must not be running.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to queue IPIs for
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    queue_kvm_pv_interrupt(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        auto const apic_id{mut_vs_pool.apic_id(vsid)};
+
+        if (mut_vm_pool.pv_nmi_ack(tls, apic_id, vmid)) {
+            auto const ret{mut_vs_pool.inject_nmi(mut_sys, vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        /// NOTE:
+        /// - Each vector can only be posted once before it is acked, so
+        ///   the mailbox is drained in at most LAPIC_NUM_VECTORS acks.
+        ///
+
+        bool mut_more{true};
+        for (bsl::safe_u64 mut_i{}; mut_more && (mut_i < LAPIC_NUM_VECTORS); ++mut_i) {
+            auto const vector{mut_vm_pool.pv_ipi_ack(tls, apic_id, vmid)};
+            if (vector.is_invalid()) {
+                mut_more = false;
+            }
+            else {
+                auto const queued{mut_vs_pool.queue_lapic_interrupt(mut_sys, vector, false, vsid)};
+                if (bsl::unlikely(!queued)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return queued;
+                }
+
+                bsl::touch();
+            }
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Pulses IRQ0 if the VM's emulated PIT has produced a tick,
+    ///     delivers the VS's LAPIC timer interrupt if its timer has
+    ///     expired, and then moves the interrupts the VM's emulated IOAPIC has sent
+    ///     to the requested VS, and the IPIs other VSs sent it with
+    ///     KVM_HC_SEND_IPI, into the IRR of its emulated LAPIC, where
+    ///     repeated interrupts coalesce. The BSP also takes the next
+    ///     interrupt from the VM's emulated PIC if its LAPIC accepts
+    ///     ExtINT and it does not already have one waiting, which leaves
+    ///     the interrupt in the IRR of the PIC, the same as a CPU that
+    ///     has not yet acknowledged INTR. The first time this is called
+    ///     for a VS, the CPU is also told to accelerate its emulated
+    ///     LAPIC if it can. The VS must be assigned to the current PP
+    ///     and must not be running.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to queue an interrupt for
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    queue_vm_interrupt(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        if (!mut_vm_pool.irqchip_enabled(vmid)) {
+            return bsl::errc_success;
+        }
+
+        auto const ret{mut_vs_pool.lapic_accelerate(mut_sys, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        auto const tsc{intrinsic.rdtsc()};
+
+        if constexpr (MICROV_EMULATED_PIT) {
+            auto const tsc_khz{mut_vs_pool.tsc_host_khz_get(vsid)};
+            if (mut_vm_pool.pit_ack_irq(tls, tsc_khz, tsc, vmid)) {
+                bsl::expects(mut_vm_pool.irq_line(tls, PIT_GSI, true, vmid));
+                bsl::expects(mut_vm_pool.irq_line(tls, PIT_GSI, false, vmid));
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        auto const timer_ret{mut_vs_pool.lapic_timer_update(mut_sys, tsc, vsid)};
+        if (bsl::unlikely(!timer_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return timer_ret;
+        }
+
+        /// NOTE:
+        /// - Each pin can only have one interrupt in flight, so the
+        ///   IOAPIC is drained in at most IOAPIC_NUM_PINS acks.
+        ///
+
+        auto const apic_id{mut_vs_pool.apic_id(vsid)};
+
+        bool mut_more{true};
+        for (bsl::safe_u64 mut_i{}; mut_more && (mut_i < IOAPIC_NUM_PINS); ++mut_i) {
+            auto const irq{mut_vm_pool.ioapic_ack(tls, apic_id, vmid)};
+            if (irq.is_invalid()) {
+                mut_more = false;
+            }
+            else {
+                auto const vector{irq & IOAPIC_RTE_VECTOR};
+                bool const level{(irq & IOAPIC_RTE_LEVEL).is_pos()};
+
+                auto const queued{mut_vs_pool.queue_lapic_interrupt(mut_sys, vector, level, vsid)};
+                if (bsl::unlikely(!queued)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return queued;
+                }
+
+                bsl::touch();
+            }
+        }
+
+        auto const pv_ret{queue_kvm_pv_interrupt(tls, mut_sys, mut_vm_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!pv_ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return pv_ret;
+        }
+
+        if (!apic_id.is_zero()) {
+            return bsl::errc_success;
+        }
+
+        if (mut_vs_pool.extint_pending(vsid) || !mut_vs_pool.accepts_extint(vsid)) {
+            return bsl::errc_success;
+        }
+
+        auto const vector{mut_vm_pool.pic_ack(tls, vmid)};
+        if (vector.is_invalid()) {
+            return bsl::errc_success;
+        }
+
+        auto const injected{mut_vs_pool.queue_interrupt(mut_sys, vector, vsid)};
+        if (bsl::unlikely(!injected)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return injected;
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns to the root VM with EXIT_REASON_INTERRUPT instead
+    ///     of resuming the guest if a resampled GSI of the guest's VM was
+    ///     EOI'd (see mv_vm_op_irq_resample), or if the guest sent an IPI,
+    ///     NMI or kick to a VS of its VM that is halted in the root VM, so
+    ///     that the root VM learns about it right away. Otherwise "errc"
+    ///     is returned as is. This must be called with the result of a
+    ///     VMExit handler, before irq_resampled_to_root() and
+    ///     pv_wakeup_to_root().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param errc the result of the VMExit handler
+    ///   @return Returns the result of the VMExit
+    ///
+    [[nodiscard]] constexpr auto
+    return_vmexit_irq_resampled(
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::errc_type const &errc) noexcept -> bsl::errc_type
+    {
+        bool const advance_ip{vmexit_success_advance_ip_and_run == errc};
+        if (!advance_ip && (vmexit_success_run != errc)) {
+            return errc;
+        }
+
+        if (mut_sys.is_the_active_vm_the_root_vm()) {
+            return errc;
+        }
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        bool const resampled{mut_vm_pool.irq_resampled_pending(mut_tls, vmid)};
+        if (!resampled && !mut_vm_pool.pv_wakeup_pending(mut_tls, vmid)) {
+            return errc;
+        }
+
+        // ---------------------------------------------------------------------
+        // Context: Change To Root VM
+        // ---------------------------------------------------------------------
+
+        switch_to_root(
+            mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, advance_ip);
+
+        // ---------------------------------------------------------------------
+        // Context: Root VM
+        // ---------------------------------------------------------------------
+
+        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+        set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_INTERRUPT));
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores the resampled GSIs of the requested VS's VM that
+    ///     were EOI'd since they were last collected in the shared page's
+    ///     mv_run_t. This must be called each time a guest VS returns to
+    ///     the root VM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that returned to the root VM
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    irq_resampled_to_root(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto mut_run{mut_pp_pool.shared_page<hypercall::mv_run_t>(mut_sys)};
+        if (bsl::unlikely(mut_run.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        mut_run->resampled = mut_vm_pool.irq_resampled_take(tls, vmid).get();
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Stores whether an IPI, NMI or kick was sent to a VS of the
+    ///     requested VS's VM that is halted in the root VM since this was
+    ///     last called in the shared page's mv_run_t, so that the root VM
+    ///     can wake it up. This must be called each time a guest VS
+    ///     returns to the root VM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that returned to the root VM
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    pv_wakeup_to_root(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto mut_run{mut_pp_pool.shared_page<hypercall::mv_run_t>(mut_sys)};
+        if (bsl::unlikely(mut_run.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto const vmid{vs_pool.assigned_vm(vsid)};
+        if (mut_vm_pool.pv_wakeup_take(tls, vmid)) {
+            mut_run->wakeup = bsl::safe_u64::magic_1().get();
+        }
+        else {
+            mut_run->wakeup = {};
+        }
+
+        return bsl::errc_success;
+    }
+}
+
+#endif
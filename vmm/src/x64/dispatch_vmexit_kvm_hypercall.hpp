@@ -0,0 +1,290 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_KVM_HYPERCALL_HPP
+#define DISPATCH_VMEXIT_KVM_HYPERCALL_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <errc_types.hpp>
+#include <gs_t.hpp>
+#include <intrinsic_t.hpp>
+#include <kvm_para.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the DPL bits of a segment's attributes
+    constexpr auto KVM_HC_ATTRIB_DPL{0x60_u64};
+    /// @brief defines the L (64bit code) bit of a segment's attributes
+    constexpr auto KVM_HC_ATTRIB_L{0x200_u64};
+    /// @brief defines EFER.LMA
+    constexpr auto KVM_HC_EFER_LMA{0x400_u64};
+    /// @brief defines the mask of a hypercall argument outside of 64bit mode
+    constexpr auto KVM_HC_ARG32_MASK{0xFFFFFFFF_u64};
+    /// @brief defines the vector bits of KVM_HC_SEND_IPI's ICR
+    constexpr auto KVM_HC_ICR_VECTOR{0x000000FF_u64};
+    /// @brief defines the delivery mode bits of KVM_HC_SEND_IPI's ICR
+    constexpr auto KVM_HC_ICR_DELIVERY_MODE{0x00000700_u64};
+    /// @brief defines the fixed delivery mode of KVM_HC_SEND_IPI's ICR
+    constexpr auto KVM_HC_ICR_DELIVERY_FIXED{0x00000000_u64};
+    /// @brief defines the NMI delivery mode of KVM_HC_SEND_IPI's ICR
+    constexpr auto KVM_HC_ICR_DELIVERY_NMI{0x00000400_u64};
+
+    /// <!-- description -->
+    ///   @brief Sends an IPI to each APIC ID in "bitmap", where bit 0 is
+    ///     "first". An IPI to the sending VS is queued right away, as it
+    ///     is on the current PP. An IPI to any other VS is posted to the
+    ///     VM's KVM PV mailbox, where the target picks it up the next
+    ///     time it looks for interrupts (on its next VMExit, while it
+    ///     polls a HLT, or when it is run again).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS sending the IPI
+    ///   @param bitmap the bitmap of APIC IDs to send the IPI to
+    ///   @param first the APIC ID of bit 0 of "bitmap"
+    ///   @param icr the ICR that describes the IPI
+    ///   @return Returns the number of VSs the IPI was sent to, or
+    ///     bsl::safe_u64::failure() on failure.
+    ///
+    [[nodiscard]] constexpr auto
+    kvm_hc_send_ipi_bitmap(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &bitmap,
+        bsl::safe_u64 const &first,
+        bsl::safe_u64 const &icr) noexcept -> bsl::safe_u64
+    {
+        constexpr auto bits{64_u64};
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        auto const self{mut_vs_pool.apic_id(vsid)};
+        auto const vector{icr & KVM_HC_ICR_VECTOR};
+        bool const nmi{KVM_HC_ICR_DELIVERY_NMI == (icr & KVM_HC_ICR_DELIVERY_MODE)};
+
+        bsl::safe_u64 mut_count{};
+        if (first >= HYPERVISOR_MAX_VSS) {
+            return mut_count;
+        }
+
+        for (bsl::safe_u64 mut_i{}; mut_i < bits; ++mut_i) {
+            if ((bitmap & (1_u64 << mut_i)).is_zero()) {
+                continue;
+            }
+
+            auto const apic_id{(first + mut_i).checked()};
+            if (!mut_vs_pool.has_apic_id(tls, vmid, apic_id)) {
+                continue;
+            }
+
+            if (apic_id != self) {
+                if (nmi) {
+                    bsl::expects(mut_vm_pool.pv_nmi_send(tls, apic_id, vmid));
+                }
+                else {
+                    bsl::expects(mut_vm_pool.pv_ipi_send(tls, apic_id, vector, vmid));
+                }
+            }
+            else {
+                bsl::errc_type mut_ret{};
+                if (nmi) {
+                    mut_ret = mut_vs_pool.inject_nmi(mut_sys, vsid);
+                }
+                else {
+                    mut_ret = mut_vs_pool.queue_lapic_interrupt(mut_sys, vector, false, vsid);
+                }
+
+                if (bsl::unlikely(!mut_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_u64::failure();
+                }
+
+                bsl::touch();
+            }
+
+            ++mut_count;
+        }
+
+        return mut_count.checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches a VMCALL from a guest VS, which is a KVM
+    ///     paravirtual hypercall. The hypercall number is in RAX and its
+    ///     arguments are in RBX, RCX, RDX and RSI, with the result
+    ///     returned in RAX. MicroV handles KVM_HC_KICK_CPU (PV
+    ///     spinlocks) and KVM_HC_SEND_IPI (PV IPIs) itself, which means
+    ///     neither ever leaves MicroV. Any other hypercall returns
+    ///     -KVM_ENOSYS, the same as KVM does for a feature it does not
+    ///     advertise, and hypercalls from outside of ring 0 return
+    ///     -KVM_EPERM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_kvm_hypercall(
+        gs_t const &gs,
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t const &vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+        bsl::discard(page_pool);
+        bsl::discard(intrinsic);
+        bsl::discard(pp_pool);
+        bsl::discard(vp_pool);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        auto const ss_attrib{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_ss_attrib)};
+        if ((ss_attrib & KVM_HC_ATTRIB_DPL).is_pos()) {
+            mut_sys.bf_tls_set_rax(KVM_HC_EPERM);
+            return vmexit_success_advance_ip_and_run;
+        }
+
+        /// NOTE:
+        /// - Outside of 64bit mode, only the lower 32 bits of each
+        ///   argument are used, and the bitmaps of KVM_HC_SEND_IPI cover
+        ///   32 APIC IDs each instead of 64.
+        ///
+
+        auto const efer{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_efer)};
+        auto const cs_attrib{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_cs_attrib)};
+        bool const op_64_bit{
+            (efer & KVM_HC_EFER_LMA).is_pos() && (cs_attrib & KVM_HC_ATTRIB_L).is_pos()};
+
+        auto mut_mask{bsl::safe_u64::max_value()};
+        auto mut_cluster{(KVM_HC_SEND_IPI_BITS >> 1_u64).checked()};
+        if (!op_64_bit) {
+            mut_mask = KVM_HC_ARG32_MASK;
+            mut_cluster >>= 1_u64;
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const nr{mut_sys.bf_tls_rax() & mut_mask};
+        auto const a0{mut_sys.bf_tls_rbx() & mut_mask};
+        auto const a1{mut_sys.bf_tls_rcx() & mut_mask};
+        auto const a2{mut_sys.bf_tls_rdx() & mut_mask};
+        auto const a3{mut_sys.bf_tls_rsi() & mut_mask};
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+
+        switch (nr.get()) {
+            case KVM_HC_KICK_CPU.get(): {
+                if (mut_vs_pool.has_apic_id(mut_tls, vmid, a1)) {
+                    bsl::expects(mut_vm_pool.pv_kick(mut_tls, a1, vmid));
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_sys.bf_tls_set_rax({});
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            case KVM_HC_SEND_IPI.get(): {
+                if constexpr (!MICROV_EMULATED_IRQCHIP) {
+                    break;
+                }
+
+                if (!mut_vm_pool.irqchip_enabled(vmid)) {
+                    break;
+                }
+
+                if (a2 >= HYPERVISOR_MAX_VSS) {
+                    mut_sys.bf_tls_set_rax({});
+                    return vmexit_success_advance_ip_and_run;
+                }
+
+                auto const mode{a3 & KVM_HC_ICR_DELIVERY_MODE};
+                if ((KVM_HC_ICR_DELIVERY_FIXED != mode) && (KVM_HC_ICR_DELIVERY_NMI != mode)) {
+                    mut_sys.bf_tls_set_rax(KVM_HC_EINVAL);
+                    return vmexit_success_advance_ip_and_run;
+                }
+
+                auto const low{kvm_hc_send_ipi_bitmap(
+                    mut_tls, mut_sys, mut_vm_pool, mut_vs_pool, vsid, a0, a2, a3)};
+                auto const high{kvm_hc_send_ipi_bitmap(
+                    mut_tls, mut_sys, mut_vm_pool, mut_vs_pool, vsid, a1, a2 + mut_cluster, a3)};
+
+                if (bsl::unlikely(low.is_invalid() || high.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_sys.bf_tls_set_rax((low + high).checked());
+                return vmexit_success_advance_ip_and_run;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        mut_sys.bf_tls_set_rax(KVM_HC_ENOSYS);
+        return vmexit_success_advance_ip_and_run;
+    }
+}
+
+#endif
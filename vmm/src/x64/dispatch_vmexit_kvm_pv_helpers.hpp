@@ -0,0 +1,328 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_KVM_PV_HELPERS_HPP
+#define DISPATCH_VMEXIT_KVM_PV_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_helpers.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_kvmclock_helpers.hpp>
+#include <intrinsic_t.hpp>
+#include <kvm_para.hpp>
+#include <mv_constants.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Looks at the guest's PV EOI word if it was set the last
+    ///     time the requested VS was run. If the guest cleared it, the
+    ///     guest skipped the EOI of the vector its LAPIC had in service,
+    ///     which is completed here. Otherwise the word is cleared so that
+    ///     the guest performs the EOI itself. This must be called at the
+    ///     start of every VMExit of a guest VS, before anything looks at
+    ///     its emulated LAPIC.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    kvm_pv_eoi_sync_from_guest(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        constexpr auto offs_mask{0xFFF_u64};
+
+        if (!mut_vs_pool.pv_eoi_pending(vsid)) {
+            return bsl::errc_success;
+        }
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        auto const gpa{mut_vs_pool.kvm_pv_eoi_gpa(vsid)};
+        auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, gpa, vmid)};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto mut_page{mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(spa))};
+        if (bsl::unlikely(mut_page.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        /// NOTE:
+        /// - The guest clears the word with a locked bit test and reset
+        ///   from the VS that generated this VMExit, which is not running,
+        ///   so a plain read and write is enough here.
+        ///
+
+        auto const offs{spa & offs_mask};
+        auto const word{kvmclock_read(*mut_page, offs, KVM_PV_EOI_SIZE)};
+        bool const eoi{(word & KVM_PV_EOI_PENDING).is_zero()};
+        if (!eoi) {
+            kvmclock_write(*mut_page, offs, word & ~KVM_PV_EOI_PENDING, KVM_PV_EOI_SIZE);
+        }
+        else {
+            bsl::touch();
+        }
+
+        mut_vs_pool.pv_eoi_complete(eoi, vsid);
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Tells the guest that the requested VS is not running by
+    ///     setting KVM_VCPU_PREEMPTED in its kvm_steal_time. While this is
+    ///     set, the guest does not send TLB shootdown IPIs to the VS, and
+    ///     sets KVM_VCPU_FLUSH_TLB instead, which kvm_pv_sync_to_guest()
+    ///     acts on before the VS runs again. This must be called when a
+    ///     guest VS hands a VMExit to the root VM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is no longer running
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    kvm_pv_set_preempted(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        constexpr auto offs_mask{0xFFF_u64};
+        constexpr auto u8_bytes{1_u64};
+
+        auto const gpa{vs_pool.kvm_steal_time_gpa(vsid)};
+        if (gpa.is_zero()) {
+            return bsl::errc_success;
+        }
+
+        auto const vmid{vs_pool.assigned_vm(vsid)};
+        auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, gpa, vmid)};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto mut_page{mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(spa))};
+        if (bsl::unlikely(mut_page.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        /// NOTE:
+        /// - The guest only ever adds KVM_VCPU_FLUSH_TLB to a VS that is
+        ///   already marked as preempted, so nothing else can be writing
+        ///   this byte while it goes from 0 to KVM_VCPU_PREEMPTED.
+        ///
+
+        auto const offs{((spa & offs_mask) + KVM_STEAL_TIME_PREEMPTED_OFFSET).checked()};
+        kvmclock_write(*mut_page, offs, KVM_VCPU_PREEMPTED, u8_bytes);
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Brings the requested VS's KVM paravirtual state in guest
+    ///     memory up to date before it runs. The VS is marked as running
+    ///     in its kvm_steal_time, and if another VS asked for its TLB to
+    ///     be flushed while it was preempted, the flush is done here.
+    ///     Then, if the guest may skip the EOI of the vector in service,
+    ///     its PV EOI word is set. This must be called right before the
+    ///     VS is run, after any interrupt was injected.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is about to run
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    kvm_pv_sync_to_guest(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        constexpr auto offs_mask{0xFFF_u64};
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+
+        auto const steal_gpa{mut_vs_pool.kvm_steal_time_gpa(vsid)};
+        if (!steal_gpa.is_zero()) {
+            auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, steal_gpa, vmid)};
+            if (bsl::unlikely(spa.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto mut_page{mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(spa))};
+            if (bsl::unlikely(mut_page.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - Other VSs of the guest can set KVM_VCPU_FLUSH_TLB up to
+            ///   the moment KVM_VCPU_PREEMPTED is cleared, which is why
+            ///   this has to be a single atomic exchange.
+            ///
+
+            auto const offs{((spa & offs_mask) + KVM_STEAL_TIME_PREEMPTED_OFFSET).checked()};
+            auto const preempted{
+                intrinsic.xchg8(mut_page->at_if(bsl::to_idx(offs)), bsl::safe_u8::magic_0())};
+
+            if ((bsl::to_u64(preempted) & KVM_VCPU_FLUSH_TLB).is_pos()) {
+                auto const ret{mut_sys.bf_vm_op_tlb_flush(vmid)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (!mut_vs_pool.pv_eoi_arm(vsid)) {
+            return bsl::errc_success;
+        }
+
+        auto const eoi_gpa{mut_vs_pool.kvm_pv_eoi_gpa(vsid)};
+        auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, eoi_gpa, vmid)};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            mut_vs_pool.pv_eoi_complete(false, vsid);
+            return bsl::errc_failure;
+        }
+
+        auto mut_page{mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(spa))};
+        if (bsl::unlikely(mut_page.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            mut_vs_pool.pv_eoi_complete(false, vsid);
+            return bsl::errc_failure;
+        }
+
+        kvmclock_write(*mut_page, (spa & offs_mask), KVM_PV_EOI_PENDING, KVM_PV_EOI_SIZE);
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Brings the requested VS's KVM paravirtual state up to date
+    ///     at the start of a VMExit, before the VMExit is handled. A
+    ///     pending PV EOI is completed, and the IPIs that other VSs sent
+    ///     with KVM_HC_SEND_IPI are queued, which saves them from having
+    ///     to wait until the VS is run again by the root VM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    kvm_pv_sync_from_guest(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto const ret{kvm_pv_eoi_sync_from_guest(
+            tls, mut_sys, page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        if constexpr (MICROV_EMULATED_IRQCHIP) {
+            if (mut_vm_pool.irqchip_enabled(mut_vs_pool.assigned_vm(vsid))) {
+                return queue_kvm_pv_interrupt(tls, mut_sys, mut_vm_pool, mut_vs_pool, vsid);
+            }
+
+            bsl::touch();
+        }
+
+        return bsl::errc_success;
+    }
+}
+
+#endif
@@ -0,0 +1,267 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_KVMCLOCK_HELPERS_HPP
+#define DISPATCH_VMEXIT_KVMCLOCK_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_helpers.hpp>
+#include <mv_constants.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <pvclock_vcpu_time_info_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Writes the lower "bytes" bytes of "val" to "mut_page"
+    ///     at "offs" in little endian order, which is the layout the
+    ///     guest expects for the pvclock structures.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_page the guest page to write to
+    ///   @param offs the offset in the page to write to
+    ///   @param val the value to write
+    ///   @param bytes the number of bytes to write
+    ///
+    constexpr void
+    kvmclock_write(
+        guest_page_t &mut_page,
+        bsl::safe_u64 const &offs,
+        bsl::safe_u64 const &val,
+        bsl::safe_u64 const &bytes) noexcept
+    {
+        constexpr auto bits_per_byte{8_u64};
+        constexpr auto byte_mask{0xFF_u64};
+
+        for (bsl::safe_u64 mut_i{}; mut_i < bytes; ++mut_i) {
+            auto const byte{(val >> (mut_i * bits_per_byte).checked()) & byte_mask};
+            *mut_page.at_if(bsl::to_idx(offs + mut_i)) = bsl::to_u8_unsafe(byte).get();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the "bytes" bytes found in "page" at "offs",
+    ///     read in little endian order.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param page the guest page to read from
+    ///   @param offs the offset in the page to read from
+    ///   @param bytes the number of bytes to read
+    ///   @return Returns the "bytes" bytes found in "page" at "offs"
+    ///
+    [[nodiscard]] constexpr auto
+    kvmclock_read(
+        guest_page_t const &page,
+        bsl::safe_u64 const &offs,
+        bsl::safe_u64 const &bytes) noexcept -> bsl::safe_u64
+    {
+        constexpr auto bits_per_byte{8_u64};
+
+        bsl::safe_u64 mut_val{};
+        for (bsl::safe_u64 mut_i{}; mut_i < bytes; ++mut_i) {
+            auto const byte{bsl::to_u64(*page.at_if(bsl::to_idx(offs + mut_i)))};
+            mut_val |= (byte << (mut_i * bits_per_byte).checked());
+        }
+
+        return mut_val;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes the requested VS's pvclock_vcpu_time_info if the
+    ///     guest enabled kvmclock and the pvclock is out of date. This
+    ///     must be called before the VS is run, as the guest only reads
+    ///     the pvclock of the VS it is running on.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is about to run
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    update_kvmclock(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        constexpr auto offs_mask{0xFFF_u64};
+        constexpr auto u8_bytes{1_u64};
+        constexpr auto u32_bytes{4_u64};
+        constexpr auto u64_bytes{8_u64};
+
+        auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+        auto const gen{vm_pool.kvmclock_gen(vmid)};
+        if (!mut_vs_pool.kvmclock_pending(gen, vsid)) {
+            return bsl::errc_success;
+        }
+
+        auto const gpa{mut_vs_pool.kvmclock_gpa(vsid)};
+        auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, gpa, vmid)};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto mut_page{mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(spa))};
+        if (bsl::unlikely(mut_page.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto const info{mut_vs_pool.kvmclock_update(
+            vm_pool.kvmclock_tsc(vmid), vm_pool.kvmclock_ns(vmid), gen, vsid)};
+
+        /// NOTE:
+        /// - The guest retries its read if the version is odd or changes
+        ///   while it reads, so the version is made odd before anything
+        ///   else is written and only made even again once the rest of
+        ///   the pvclock is up to date.
+        ///
+
+        auto const offs{spa & offs_mask};
+        auto const odd{(info.version - bsl::safe_u64::magic_1()).checked()};
+        kvmclock_write(*mut_page, (offs + PVCLOCK_VERSION_OFFSET).checked(), odd, u32_bytes);
+
+        kvmclock_write(
+            *mut_page,
+            (offs + PVCLOCK_TSC_TIMESTAMP_OFFSET).checked(),
+            info.tsc_timestamp,
+            u64_bytes);
+        kvmclock_write(
+            *mut_page, (offs + PVCLOCK_SYSTEM_TIME_OFFSET).checked(), info.system_time, u64_bytes);
+        kvmclock_write(
+            *mut_page,
+            (offs + PVCLOCK_TSC_TO_SYSTEM_MUL_OFFSET).checked(),
+            info.tsc_to_system_mul,
+            u32_bytes);
+        kvmclock_write(
+            *mut_page, (offs + PVCLOCK_TSC_SHIFT_OFFSET).checked(), info.tsc_shift, u8_bytes);
+        kvmclock_write(*mut_page, (offs + PVCLOCK_FLAGS_OFFSET).checked(), info.flags, u8_bytes);
+
+        kvmclock_write(
+            *mut_page, (offs + PVCLOCK_VERSION_OFFSET).checked(), info.version, u32_bytes);
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes the pvclock_wall_clock that the guest asked for
+    ///     by writing "gpa" to MSR_KVM_WALL_CLOCK_NEW. The wall clock is
+    ///     the time at which the VM's kvmclock was 0, which the guest
+    ///     adds its kvmclock to in order to get the current time.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vmid the ID of the VM the guest belongs to
+    ///   @param gpa the GPA of the guest's pvclock_wall_clock
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    write_kvmclock_wall_clock(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        bsl::safe_u16 const &vmid,
+        bsl::safe_u64 const &gpa) noexcept -> bsl::errc_type
+    {
+        constexpr auto offs_mask{0xFFF_u64};
+        constexpr auto u32_bytes{4_u64};
+        constexpr auto u32_mask{0xFFFFFFFF_u64};
+        constexpr auto ns_per_sec{1000000000_u64};
+
+        auto const offs{gpa & offs_mask};
+        if (bsl::unlikely((offs + PVCLOCK_WALL_CLOCK_SIZE).checked() > HYPERVISOR_PAGE_SIZE)) {
+            bsl::error() << "pvclock wall clock at "    // --
+                         << bsl::hex(gpa)               // --
+                         << " crosses a page boundary"  // --
+                         << bsl::endl                   // --
+                         << bsl::here();                // --
+
+            return bsl::errc_failure;
+        }
+
+        auto const spa{vm_pool.translate_gpa(tls, mut_sys, page_pool, gpa, vmid)};
+        if (bsl::unlikely(spa.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto mut_page{mut_pp_pool.map<guest_page_t>(mut_sys, hypercall::mv_page_aligned(spa))};
+        if (bsl::unlikely(mut_page.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto const boot_ns{vm_pool.kvmclock_boot_ns(vmid)};
+        auto const version_offs{(offs + PVCLOCK_WALL_VERSION_OFFSET).checked()};
+
+        auto mut_version{kvmclock_read(*mut_page, version_offs, u32_bytes)};
+        mut_version = ((mut_version + bsl::safe_u64::magic_1()) & u32_mask).checked();
+        kvmclock_write(*mut_page, version_offs, mut_version, u32_bytes);
+
+        kvmclock_write(
+            *mut_page,
+            (offs + PVCLOCK_WALL_SEC_OFFSET).checked(),
+            (boot_ns / ns_per_sec).checked(),
+            u32_bytes);
+        kvmclock_write(
+            *mut_page,
+            (offs + PVCLOCK_WALL_NSEC_OFFSET).checked(),
+            (boot_ns % ns_per_sec).checked(),
+            u32_bytes);
+
+        mut_version = ((mut_version + bsl::safe_u64::magic_1()) & u32_mask).checked();
+        kvmclock_write(*mut_page, version_offs, mut_version, u32_bytes);
+
+        return bsl::errc_success;
+    }
+}
+
+#endif
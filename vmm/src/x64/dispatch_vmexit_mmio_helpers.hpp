@@ -0,0 +1,309 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_MMIO_HELPERS_HPP
+#define DISPATCH_VMEXIT_MMIO_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_abi_helpers.hpp>
+#include <dispatch_vmcall_helpers.hpp>
+#include <dispatch_vmexit_helpers.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <emulated_decoder_t.hpp>
+#include <errc_types.hpp>
+#include <intrinsic_t.hpp>
+#include <mmio_access_t.hpp>
+#include <mv_constants.hpp>
+#include <mv_exit_mmio_t.hpp>
+#include <mv_exit_page_mmio_t.hpp>
+#include <mv_exit_reason_t.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Reads up to MAX_INSTRUCTION_LEN bytes from the instruction
+    ///     stream of the requested VS starting at CS.base + RIP. If the
+    ///     instruction crosses a page boundary, both pages are read. The
+    ///     active VS must be the VS that generated the VMExit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to read the instruction from
+    ///   @param mut_bytes where to store the instruction bytes
+    ///   @return Returns the number of bytes read into "mut_bytes", or
+    ///     bsl::safe_u64::failure() on error.
+    ///
+    [[nodiscard]] constexpr auto
+    fetch_instruction(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t const &vm_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid,
+        instruction_bytes_t &mut_bytes) noexcept -> bsl::safe_u64
+    {
+        constexpr auto offs_mask{0xFFF_u64};
+
+        auto const rip{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_rip)};
+        auto const cs_base{mut_sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_cs_base)};
+
+        bsl::safe_u64 mut_num{};
+        while (mut_num < MAX_INSTRUCTION_LEN) {
+            auto const gla{(cs_base + rip + mut_num).checked()};
+            auto const spa{guest_gla_to_spa(
+                tls, mut_sys, page_pool, mut_pp_pool, vm_pool, vs_pool, vsid, gla)};
+            if (bsl::unlikely(spa.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            auto const page{
+                mut_pp_pool.map<guest_page_t const>(mut_sys, hypercall::mv_page_aligned(spa))};
+            if (bsl::unlikely(page.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            for (auto mut_i{gla & offs_mask}; mut_i < HYPERVISOR_PAGE_SIZE; ++mut_i) {
+                if (mut_num >= MAX_INSTRUCTION_LEN) {
+                    break;
+                }
+
+                *mut_bytes.at_if(bsl::to_idx(mut_num)) = *page->at_if(bsl::to_idx(mut_i));
+                ++mut_num;
+            }
+        }
+
+        return mut_num;
+    }
+
+    /// <!-- description -->
+    ///   @brief Handles an MMIO access to a GPA that is not mapped into
+    ///     the guest. The instruction that generated the access is
+    ///     decoded, the guest's IP is advanced past it and the access is
+    ///     handed to the root VM using mv_exit_mmio_t. Writes provide the
+    ///     data being written. Reads are recorded in the VS and completed
+    ///     the next time the root VM executes mv_vs_op_run. If the VS has
+    ///     an exit page, the access is written to it instead of the shared
+    ///     page and the root VM is told so with EXIT_REASON_EXIT_PAGE.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param gpa the GPA of the MMIO access
+    ///   @param flags the MV_EXIT_MMIO flags reported by hardware
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_vmexit_mmio(
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &gpa,
+        bsl::safe_u64 const &flags) noexcept -> bsl::errc_type
+    {
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        // ---------------------------------------------------------------------
+        // Context: Guest VM
+        // ---------------------------------------------------------------------
+
+        instruction_bytes_t mut_bytes{};
+        auto const num{fetch_instruction(
+            mut_tls, mut_sys, page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid, mut_bytes)};
+        if (bsl::unlikely(num.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        mmio_access_t mut_access{};
+        auto const ret{mut_vs_pool.mmio_decode(mut_sys, mut_bytes, num, mut_access, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::error() << "failed to decode the MMIO access to "    // --
+                         << bsl::hex(gpa)                              // --
+                         << bsl::endl                                  // --
+                         << bsl::here();                               // --
+
+            return ret;
+        }
+
+        if constexpr (MICROV_EMULATED_IRQCHIP) {
+            auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+            if (mut_vm_pool.irqchip_enabled(vmid) && emulated_ioapic_t::handles(gpa)) {
+                return emulate_vmexit_ioapic(
+                    mut_tls, mut_sys, mut_vm_pool, mut_vs_pool, vsid, gpa, mut_access);
+            }
+
+            if (mut_vm_pool.irqchip_enabled(vmid) && mut_vs_pool.lapic_handles(gpa, vsid)) {
+                return emulate_vmexit_lapic(
+                    mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vs_pool, vsid, gpa, mut_access);
+            }
+
+            bsl::touch();
+        }
+
+        bsl::safe_u64 mut_data{};
+        if (mut_access.write) {
+            mut_data = mut_vs_pool.mmio_write_data(mut_sys, mut_access, vsid);
+            if (bsl::unlikely(mut_data.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            bsl::touch();
+        }
+        else {
+            mut_vs_pool.mmio_set_pending_read(mut_access, vsid);
+        }
+
+        /// NOTE:
+        /// - Hardware does not report an instruction length for EPT/NPT
+        ///   violations, so the IP is advanced here using the decoded
+        ///   length instead of asking switch_to_root to do it.
+        ///
+
+        constexpr auto rip_idx{syscall::bf_reg_t::bf_reg_t_rip};
+        auto const rip{mut_vs_pool.reg_cache_read(mut_sys, rip_idx, vsid)};
+        auto const next_rip{(rip + mut_access.len).checked()};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, rip_idx, next_rip, vsid));
+
+        // ---------------------------------------------------------------------
+        // Context: Change To Root VM
+        // ---------------------------------------------------------------------
+
+        switch_to_root(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, false);
+
+        // ---------------------------------------------------------------------
+        // Context: Root VM
+        // ---------------------------------------------------------------------
+
+        auto *const pmut_exit_page{mut_vs_pool.exit_page<hypercall::mv_exit_page_mmio_t>(vsid)};
+        if (nullptr != pmut_exit_page) {
+            pmut_exit_page->phys_addr = gpa.get();
+            pmut_exit_page->data = mut_data.get();
+            pmut_exit_page->len = bsl::to_u32_unsafe(mut_access.bytes).get();
+            if (mut_access.write) {
+                pmut_exit_page->is_write = bsl::safe_u8::magic_1().get();
+            }
+            else {
+                pmut_exit_page->is_write = {};
+            }
+
+            pmut_exit_page->exit_reason = hypercall::MV_EXIT_PAGE_REASON_MMIO.get();
+
+            set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+            set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_EXIT_PAGE));
+
+            return vmexit_success_advance_ip_and_run;
+        }
+
+        auto mut_exit_mmio{mut_pp_pool.shared_page<hypercall::mv_exit_mmio_t>(mut_sys)};
+        bsl::expects(mut_exit_mmio.is_valid());
+
+        mut_exit_mmio->gpa = gpa.get();
+        mut_exit_mmio->flags = flags.get();
+        mut_exit_mmio->data = mut_data.get();
+        mut_exit_mmio->size = bytes_to_bit_size(mut_access.bytes);
+
+        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
+        set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_MMIO));
+
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Completes any MMIO read that the requested VS is waiting
+    ///     on using the data that the root VM placed in mv_exit_mmio_t
+    ///     (or the VS's exit page). This must be called before the VS is
+    ///     made active.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is about to run
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    complete_vmexit_mmio(
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        if (!mut_vs_pool.mmio_read_pending(vsid)) {
+            return bsl::errc_success;
+        }
+
+        auto const *const exit_page{mut_vs_pool.exit_page<hypercall::mv_exit_page_mmio_t>(vsid)};
+        if (nullptr != exit_page) {
+            return mut_vs_pool.mmio_complete_read(mut_sys, bsl::to_u64(exit_page->data), vsid);
+        }
+
+        auto const exit_mmio{mut_pp_pool.shared_page<hypercall::mv_exit_mmio_t>(mut_sys)};
+        if (bsl::unlikely(exit_mmio.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        return mut_vs_pool.mmio_complete_read(mut_sys, bsl::to_u64(exit_mmio->data), vsid);
+    }
+}
+
+#endif
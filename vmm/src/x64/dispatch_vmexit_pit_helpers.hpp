@@ -0,0 +1,94 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_PIT_HELPERS_HPP
+#define DISPATCH_VMEXIT_PIT_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <emulated_pit_t.hpp>
+#include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Emulates a port IO access to the VM's emulated PIT. Returns
+    ///     true if the access was emulated, in which case the guest can
+    ///     simply be resumed, or false if it has to be handed to the root
+    ///     VM. The PIT is only emulated once the VM's irqchip has been
+    ///     created, as it needs the emulated PIC and IOAPIC to deliver
+    ///     IRQ0.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param access the port IO access reported by hardware
+    ///   @return Returns true if the access was emulated, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    emulate_vmexit_pit(
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vm_pool_t &mut_vm_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid,
+        io_access_t const &access) noexcept -> bool
+    {
+        constexpr auto mask1{0x00000000000000FF_u64};
+
+        auto const vmid{vs_pool.assigned_vm(vsid)};
+        if (!mut_vm_pool.irqchip_enabled(vmid)) {
+            return false;
+        }
+
+        auto const tsc_khz{vs_pool.tsc_host_khz_get(vsid)};
+        auto const tsc{intrinsic.rdtsc()};
+        auto const rax{mut_sys.bf_tls_rax()};
+
+        if (!access.in) {
+            return mut_vm_pool.pit_write(tls, tsc_khz, tsc, access, rax, vmid);
+        }
+
+        auto const val{mut_vm_pool.pit_read(tls, tsc_khz, tsc, access, vmid)};
+        if (val.is_invalid()) {
+            return false;
+        }
+
+        mut_sys.bf_tls_set_rax((rax & ~mask1) | (val & mask1));
+        return true;
+    }
+}
+
+#endif
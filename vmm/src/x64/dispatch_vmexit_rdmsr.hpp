@@ -26,6 +26,7 @@
 #define DISPATCH_VMEXIT_RDMSR_HPP
 
 #include <bf_syscall_t.hpp>
+#include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
@@ -39,11 +40,17 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
     /// <!-- description -->
-    ///   @brief Dispatches RDMSR VMExits.
+    ///   @brief Dispatches RDMSR VMExits. The MSR in ECX is read from the
+    ///     VS's emulated MSRs and returned in EDX:EAX. MSRs that MicroV
+    ///     does not emulate inject a #GP, the same as a CPU that does not
+    ///     implement the MSR, which is what a guest probing for an MSR
+    ///     with a fault handler in place expects.
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
@@ -54,7 +61,7 @@ namespace microv
     ///   @param pp_pool the pp_pool_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
@@ -69,22 +76,38 @@ namespace microv
         pp_pool_t const &pp_pool,
         vm_pool_t const &vm_pool,
         vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
         bsl::discard(gs);
         bsl::discard(tls);
-        bsl::discard(mut_sys);
         bsl::discard(page_pool);
         bsl::discard(intrinsic);
         bsl::discard(pp_pool);
         bsl::discard(vm_pool);
         bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
-        bsl::discard(vsid);
 
-        bsl::error() << "dispatch_vmexit_rdmsr not implemented\n" << bsl::here();
-        return bsl::errc_failure;
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto mask32{0xFFFFFFFF_u64};
+        constexpr auto shift32{32_u64};
+
+        auto const msr{mut_sys.bf_tls_rcx() & mask32};
+        auto const val{mut_vs_pool.msr_get(mut_sys, msr, vsid)};
+        if (val.is_invalid()) {
+            auto const ret{mut_vs_pool.inject_gpf(mut_sys, vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            return vmexit_success_run;
+        }
+
+        mut_sys.bf_tls_set_rax(val & mask32);
+        mut_sys.bf_tls_set_rdx(val >> shift32);
+
+        return vmexit_success_advance_ip_and_run;
     }
 }
 
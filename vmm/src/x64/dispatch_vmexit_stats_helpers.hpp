@@ -0,0 +1,126 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_STATS_HELPERS_HPP
+#define DISPATCH_VMEXIT_STATS_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <intrinsic_t.hpp>
+#include <mv_constants.hpp>
+#include <mv_stats_t.hpp>
+#include <pp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Returns the statistics slot of the hypercall the active VS
+    ///     is making (see mv_debug_op_stats_get). This must be called
+    ///     before the hypercall is handled as the handlers overwrite RAX
+    ///     with their return value. If the hypercall does not have a
+    ///     slot, MV_STATS_NUM_SLOTS is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @return Returns the statistics slot of the hypercall the active
+    ///     VS is making.
+    ///
+    [[nodiscard]] constexpr auto
+    stats_hypercall_slot(syscall::bf_syscall_t const &sys) noexcept -> bsl::safe_u64
+    {
+        constexpr auto opcode_shift{16_u64};
+        constexpr auto max_opcode{
+            (hypercall::MV_VS_OP_VAL & hypercall::MV_HYPERCALL_OPCODE_NOSIG_MASK) >> opcode_shift};
+        constexpr auto max_index{(1_u64 << hypercall::MV_STATS_HYPERCALL_OPCODE_SHIFT)};
+
+        auto const rax{sys.bf_tls_rax()};
+        if (!sys.is_the_active_vm_the_root_vm()) {
+            return rax;
+        }
+
+        auto const opcode{(hypercall::mv_hypercall_opcode_nosig(rax) >> opcode_shift).checked()};
+        auto const index{hypercall::mv_hypercall_index(rax)};
+
+        if (opcode > max_opcode.checked()) {
+            return hypercall::MV_STATS_NUM_SLOTS;
+        }
+
+        if (index >= max_index.checked()) {
+            return hypercall::MV_STATS_NUM_SLOTS;
+        }
+
+        return ((opcode << hypercall::MV_STATS_HYPERCALL_OPCODE_SHIFT) | index).checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Counts a VMExit, and the hypercall it made if it was a
+    ///     hypercall, in the statistics of the VS that generated it and
+    ///     the PP that handled it, using the TSC at the start of the
+    ///     VMExit to work out how long MicroV spent handling it. This
+    ///     must be called before returning from the VMExit.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param exit_reason the exit reason associated with the VMExit
+    ///   @param is_hypercall true if the VMExit was a hypercall
+    ///   @param slot the value stats_hypercall_slot returned at the start
+    ///     of the VMExit. Ignored if "is_hypercall" is false.
+    ///   @param start the TSC at the start of the VMExit
+    ///
+    constexpr void
+    stats_add_vmexit(
+        syscall::bf_syscall_t const &sys,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &exit_reason,
+        bool const is_hypercall,
+        bsl::safe_u64 const &slot,
+        bsl::safe_u64 const &start) noexcept
+    {
+        auto const cycles{(intrinsic.rdtsc() - start).checked()};
+
+        mut_vs_pool.stats_add_exit(exit_reason, cycles, vsid);
+        mut_pp_pool.stats_add_exit(sys, exit_reason, cycles);
+
+        if (is_hypercall) {
+            mut_vs_pool.stats_add_hypercall(slot, cycles, vsid);
+            mut_pp_pool.stats_add_hypercall(sys, slot, cycles);
+        }
+        else {
+            bsl::touch();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,317 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_SYNC_REGS_HELPERS_HPP
+#define DISPATCH_VMEXIT_SYNC_REGS_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <msr_desc_t.hpp>
+#include <mv_reg_t.hpp>
+#include <mv_run_t.hpp>
+#include <mv_sync_regs_t.hpp>
+#include <pp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @struct microv::sync_reg_t
+    ///
+    /// <!-- description -->
+    ///   @brief Maps a register to its field in mv_sync_regs_t
+    ///
+    struct sync_reg_t final
+    {
+        /// @brief stores the register
+        hypercall::mv_reg_t reg;
+        /// @brief stores the field of the register in mv_sync_regs_t
+        bsl::uint64 hypercall::mv_sync_regs_t::*field;
+    };
+
+    /// @brief defines the number of registers in MV_SYNC_REGS_GPRS
+    constexpr auto SYNC_REGS_NUM_GPRS{18_umx};
+    /// @brief defines the number of registers in MV_SYNC_REGS_CRS (without EFER)
+    constexpr auto SYNC_REGS_NUM_CRS{5_umx};
+
+    /// @brief stores the registers of MV_SYNC_REGS_GPRS
+    constexpr bsl::array<sync_reg_t, SYNC_REGS_NUM_GPRS.get()> SYNC_REGS_GPRS{{
+        {hypercall::mv_reg_t::mv_reg_t_rax, &hypercall::mv_sync_regs_t::rax},
+        {hypercall::mv_reg_t::mv_reg_t_rbx, &hypercall::mv_sync_regs_t::rbx},
+        {hypercall::mv_reg_t::mv_reg_t_rcx, &hypercall::mv_sync_regs_t::rcx},
+        {hypercall::mv_reg_t::mv_reg_t_rdx, &hypercall::mv_sync_regs_t::rdx},
+        {hypercall::mv_reg_t::mv_reg_t_rsi, &hypercall::mv_sync_regs_t::rsi},
+        {hypercall::mv_reg_t::mv_reg_t_rdi, &hypercall::mv_sync_regs_t::rdi},
+        {hypercall::mv_reg_t::mv_reg_t_rsp, &hypercall::mv_sync_regs_t::rsp},
+        {hypercall::mv_reg_t::mv_reg_t_rbp, &hypercall::mv_sync_regs_t::rbp},
+        {hypercall::mv_reg_t::mv_reg_t_r8, &hypercall::mv_sync_regs_t::r8},
+        {hypercall::mv_reg_t::mv_reg_t_r9, &hypercall::mv_sync_regs_t::r9},
+        {hypercall::mv_reg_t::mv_reg_t_r10, &hypercall::mv_sync_regs_t::r10},
+        {hypercall::mv_reg_t::mv_reg_t_r11, &hypercall::mv_sync_regs_t::r11},
+        {hypercall::mv_reg_t::mv_reg_t_r12, &hypercall::mv_sync_regs_t::r12},
+        {hypercall::mv_reg_t::mv_reg_t_r13, &hypercall::mv_sync_regs_t::r13},
+        {hypercall::mv_reg_t::mv_reg_t_r14, &hypercall::mv_sync_regs_t::r14},
+        {hypercall::mv_reg_t::mv_reg_t_r15, &hypercall::mv_sync_regs_t::r15},
+        {hypercall::mv_reg_t::mv_reg_t_rip, &hypercall::mv_sync_regs_t::rip},
+        {hypercall::mv_reg_t::mv_reg_t_rflags, &hypercall::mv_sync_regs_t::rflags},
+    }};
+
+    /// @brief stores the registers of MV_SYNC_REGS_CRS (EFER is an MSR)
+    constexpr bsl::array<sync_reg_t, SYNC_REGS_NUM_CRS.get()> SYNC_REGS_CRS{{
+        {hypercall::mv_reg_t::mv_reg_t_cr0, &hypercall::mv_sync_regs_t::cr0},
+        {hypercall::mv_reg_t::mv_reg_t_cr2, &hypercall::mv_sync_regs_t::cr2},
+        {hypercall::mv_reg_t::mv_reg_t_cr3, &hypercall::mv_sync_regs_t::cr3},
+        {hypercall::mv_reg_t::mv_reg_t_cr4, &hypercall::mv_sync_regs_t::cr4},
+        {hypercall::mv_reg_t::mv_reg_t_cr8, &hypercall::mv_sync_regs_t::cr8},
+    }};
+
+    /// <!-- description -->
+    ///   @brief Copies the requested registers of a VS into "mut_regs".
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the number of registers in "regs"
+    ///   @param sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to read the registers from
+    ///   @param regs the registers to read
+    ///   @param mut_regs the mv_sync_regs_t to store the registers in
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    template<bsl::uintmx N>
+    [[nodiscard]] constexpr auto
+    sync_regs_get(
+        syscall::bf_syscall_t const &sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::array<sync_reg_t, N> const &regs,
+        hypercall::mv_sync_regs_t &mut_regs) noexcept -> bsl::errc_type
+    {
+        for (auto const &elem : regs) {
+            auto const val{mut_vs_pool.reg_get(sys, hypercall::to_u64(elem.reg), vsid)};
+            if (bsl::unlikely(val.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            mut_regs.*elem.field = val.get();
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes the requested registers of a VS using "regs".
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the number of registers in "sregs"
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to write the registers to
+    ///   @param sregs the registers to write
+    ///   @param regs the mv_sync_regs_t to get the registers from
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    template<bsl::uintmx N>
+    [[nodiscard]] constexpr auto
+    sync_regs_set(
+        syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::array<sync_reg_t, N> const &sregs,
+        hypercall::mv_sync_regs_t const &regs) noexcept -> bsl::errc_type
+    {
+        for (auto const &elem : sregs) {
+            auto const val{bsl::to_u64(regs.*elem.field)};
+            auto const ret{mut_vs_pool.reg_set(mut_sys, hypercall::to_u64(elem.reg), val, vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            bsl::touch();
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Fills in the MV_SYNC_REGS_ groups the root VM asked for
+    ///     in the shared page's mv_run_t with the registers of the
+    ///     requested VS. This must be called each time a guest VS returns
+    ///     to the root VM.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that returned to the root VM
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    sync_regs_to_root(
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto mut_run{mut_pp_pool.shared_page<hypercall::mv_run_t>(mut_sys)};
+        if (bsl::unlikely(mut_run.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto &mut_regs{mut_run->sync_regs};
+        auto const valid{bsl::to_u64(mut_regs.valid)};
+
+        if ((valid & hypercall::MV_SYNC_REGS_GPRS).is_pos()) {
+            auto const ret{sync_regs_get(mut_sys, mut_vs_pool, vsid, SYNC_REGS_GPRS, mut_regs)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        if ((valid & hypercall::MV_SYNC_REGS_CRS).is_pos()) {
+            auto const ret{sync_regs_get(mut_sys, mut_vs_pool, vsid, SYNC_REGS_CRS, mut_regs)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            auto const efer{mut_vs_pool.msr_get(mut_sys, bsl::to_u64(MSR_EFER), vsid)};
+            if (bsl::unlikely(efer.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            mut_regs.efer = efer.get();
+        }
+        else {
+            bsl::touch();
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes the MV_SYNC_REGS_ groups the root VM marked dirty
+    ///     in the shared page's mv_run_t to the requested VS and clears
+    ///     them. The registers are written back right away so that
+    ///     anything that completes the VS's last exit (e.g., the register
+    ///     of an MMIO read) is applied on top of them, the same way KVM
+    ///     orders KVM_SYNC_X86_REGS and the completion of userspace IO.
+    ///     This must be called before the VS's last exit is completed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is about to run
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    sync_regs_from_root(
+        syscall::bf_syscall_t &mut_sys,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto mut_run{mut_pp_pool.shared_page<hypercall::mv_run_t>(mut_sys)};
+        if (bsl::unlikely(mut_run.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        auto &mut_regs{mut_run->sync_regs};
+        auto const dirty{bsl::to_u64(mut_regs.dirty)};
+
+        if (dirty.is_zero()) {
+            return bsl::errc_success;
+        }
+
+        if (bsl::unlikely((dirty & ~hypercall::MV_SYNC_REGS_ALL).is_pos())) {
+            bsl::error() << "mv_sync_regs_t.dirty "    // --
+                         << bsl::hex(dirty)            // --
+                         << " is invalid"              // --
+                         << bsl::endl                  // --
+                         << bsl::here();               // --
+
+            return bsl::errc_failure;
+        }
+
+        mut_regs.dirty = {};
+
+        if ((dirty & hypercall::MV_SYNC_REGS_GPRS).is_pos()) {
+            auto const ret{sync_regs_set(mut_sys, mut_vs_pool, vsid, SYNC_REGS_GPRS, mut_regs)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        if ((dirty & hypercall::MV_SYNC_REGS_CRS).is_pos()) {
+            auto const ret{sync_regs_set(mut_sys, mut_vs_pool, vsid, SYNC_REGS_CRS, mut_regs)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            auto const efer_ret{mut_vs_pool.msr_set(
+                mut_sys, bsl::to_u64(MSR_EFER), bsl::to_u64(mut_regs.efer), vsid)};
+            if (bsl::unlikely(!efer_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return efer_ret;
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_vs_pool.reg_cache_flush(mut_sys, vsid);
+    }
+}
+
+#endif
@@ -0,0 +1,134 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_TRACE_HELPERS_HPP
+#define DISPATCH_VMEXIT_TRACE_HELPERS_HPP
+
+#include <bf_syscall_t.hpp>
+#include <intrinsic_t.hpp>
+#include <mv_trace_t.hpp>
+#include <pp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the valid bit of a pending event (Intel and AMD)
+    constexpr auto TRACE_EVENT_VALID{0x80000000_u64};
+
+    /// <!-- description -->
+    ///   @brief Adds an entry for a VMExit to the trace ring of the PP
+    ///     that is handling it. Hypercalls are recorded with their RAX,
+    ///     all other VMExits with their exit qualification (Intel) or
+    ///     EXITINFO1 (AMD). This must be called before the VMExit is
+    ///     handled as the handlers overwrite RAX with their return value.
+    ///     If tracing is disabled on this PP, this does nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param exit_reason the exit reason associated with the VMExit
+    ///   @param is_hypercall true if the VMExit was a hypercall
+    ///
+    constexpr void
+    trace_vmexit(
+        syscall::bf_syscall_t const &sys,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &exit_reason,
+        bool const is_hypercall) noexcept
+    {
+        if (!mut_pp_pool.trace_enabled(sys)) {
+            return;
+        }
+
+        hypercall::mv_trace_entry_t mut_entry{};
+        mut_entry.tsc = intrinsic.rdtsc().get();
+        mut_entry.rip = sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_rip).get();
+        mut_entry.vsid = vsid.get();
+        mut_entry.ppid = sys.bf_tls_ppid().get();
+        mut_entry.reason = bsl::to_u16_unsafe(exit_reason).get();
+
+        if (is_hypercall) {
+            mut_entry.type = hypercall::MV_TRACE_TYPE_HYPERCALL.get();
+            mut_entry.info = sys.bf_tls_rax().get();
+        }
+        else {
+            mut_entry.type = hypercall::MV_TRACE_TYPE_EXIT.get();
+            mut_entry.info = vs_pool.exit_info(sys, vsid).get();
+        }
+
+        mut_pp_pool.trace_add(sys, intrinsic, mut_entry);
+    }
+
+    /// <!-- description -->
+    ///   @brief Adds an entry to the trace ring of the PP that is about
+    ///     to run the requested VS if an event will be injected into it
+    ///     on its next VMEntry. If tracing is disabled on this PP, or no
+    ///     event is pending, this does nothing.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that is about to run
+    ///
+    constexpr void
+    trace_inject(
+        syscall::bf_syscall_t const &sys,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid) noexcept
+    {
+        if (!mut_pp_pool.trace_enabled(sys)) {
+            return;
+        }
+
+        auto const event{vs_pool.pending_event(sys, vsid)};
+        if ((event & TRACE_EVENT_VALID).is_zero()) {
+            return;
+        }
+
+        hypercall::mv_trace_entry_t mut_entry{};
+        mut_entry.tsc = intrinsic.rdtsc().get();
+        mut_entry.rip = sys.bf_vs_op_read(vsid, syscall::bf_reg_t::bf_reg_t_rip).get();
+        mut_entry.info = event.get();
+        mut_entry.type = hypercall::MV_TRACE_TYPE_INJECT.get();
+        mut_entry.vsid = vsid.get();
+        mut_entry.ppid = sys.bf_tls_ppid().get();
+
+        mut_pp_pool.trace_add(sys, intrinsic, mut_entry);
+    }
+}
+
+#endif
@@ -26,6 +26,8 @@
 #define DISPATCH_VMEXIT_WRMSR_HPP
 
 #include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_kvmclock_helpers.hpp>
+#include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
@@ -39,11 +41,20 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
     /// <!-- description -->
-    ///   @brief Dispatches WRMSR VMExits.
+    ///   @brief Dispatches WRMSR VMExits. EDX:EAX is written to the MSR
+    ///     in ECX in the VS's emulated MSRs, and MSRs that MicroV does not
+    ///     emulate (or values they do not accept) inject a #GP. A write
+    ///     to MSR_TSC_DEADLINE is handled here without going to userspace,
+    ///     and re-arms the VS's LAPIC timer right away. A write to
+    ///     MSR_KVM_WALL_CLOCK_NEW writes the VM's wall clock into guest
+    ///     memory at the address that was written.
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
@@ -51,10 +62,10 @@ namespace microv
     ///   @param mut_sys the bf_syscall_t to use
     ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
-    ///   @param pp_pool the pp_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
@@ -66,25 +77,65 @@ namespace microv
         syscall::bf_syscall_t &mut_sys,
         page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
-        pp_pool_t const &pp_pool,
+        pp_pool_t &mut_pp_pool,
         vm_pool_t const &vm_pool,
         vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
         bsl::discard(gs);
-        bsl::discard(tls);
-        bsl::discard(mut_sys);
-        bsl::discard(page_pool);
-        bsl::discard(intrinsic);
-        bsl::discard(pp_pool);
-        bsl::discard(vm_pool);
         bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
-        bsl::discard(vsid);
 
-        bsl::error() << "dispatch_vmexit_wrmsr not implemented\n" << bsl::here();
-        return bsl::errc_failure;
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto mask32{0xFFFFFFFF_u64};
+        constexpr auto shift32{32_u64};
+
+        auto const msr{mut_sys.bf_tls_rcx() & mask32};
+        auto const hi{(mut_sys.bf_tls_rdx() & mask32) << shift32};
+        auto const val{hi | (mut_sys.bf_tls_rax() & mask32)};
+
+        auto const ret{mut_vs_pool.msr_set(mut_sys, msr, val, vsid)};
+        if (!ret) {
+            auto const gpf_ret{mut_vs_pool.inject_gpf(mut_sys, vsid)};
+            if (bsl::unlikely(!gpf_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return gpf_ret;
+            }
+
+            return vmexit_success_run;
+        }
+
+        if (bsl::to_u64(MSR_TSC_DEADLINE) == msr) {
+            auto const timer_ret{mut_vs_pool.lapic_timer_update(mut_sys, intrinsic.rdtsc(), vsid)};
+            if (bsl::unlikely(!timer_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return timer_ret;
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::to_u64(MSR_KVM_WALL_CLOCK_NEW) == msr) {
+            auto const vmid{mut_vs_pool.assigned_vm(vsid)};
+            auto const wall_ret{write_kvmclock_wall_clock(
+                tls, mut_sys, page_pool, mut_pp_pool, vm_pool, vmid, val)};
+            if (!wall_ret) {
+                auto const gpf_ret{mut_vs_pool.inject_gpf(mut_sys, vsid)};
+                if (bsl::unlikely(!gpf_ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return gpf_ret;
+                }
+
+                return vmexit_success_run;
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        return vmexit_success_advance_ip_and_run;
     }
 }
 
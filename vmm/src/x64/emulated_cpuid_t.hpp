@@ -26,7 +26,9 @@
 #define EMULATED_CPUID_T_HPP
 
 #include <bf_syscall_t.hpp>
+#include <cpuid.hpp>
 #include <cpuid_commands.hpp>
+#include <emulated_lapic_t.hpp>
 #include <errc_types.hpp>
 #include <gs_t.hpp>
 #include <page_pool_t.hpp>
@@ -52,6 +54,61 @@ namespace microv
         /// @brief stores the ID of the VS associated with this emulated_cpuid_t
         bsl::safe_u16 m_assigned_vsid{};
 
+        /// <!-- description -->
+        ///   @brief Emulates the hypervisor CPUID leaves (0x40000000 to
+        ///     0x40000010). MicroV identifies itself as KVM here so that
+        ///     guests use their KVM paravirtual drivers (kvmclock, steal
+        ///     time for PV TLB flushes, PV EOI, PV IPIs and PV spinlock
+        ///     kicks). Leaf 0x40000010 reports the TSC frequency of the
+        ///     VS and the frequency of the LAPIC's bus, which saves the
+        ///     guest from calibrating them against the PIT. Leaves in
+        ///     between that MicroV does not use read as 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param fn the CPUID function being read
+        ///   @param tsc_khz the TSC frequency of the VS in KHz
+        ///
+        static constexpr void
+        get_hypervisor(
+            syscall::bf_syscall_t &mut_sys,
+            bsl::safe_u32 const &fn,
+            bsl::safe_u64 const &tsc_khz) noexcept
+        {
+            bsl::safe_u64 mut_rax{};
+            bsl::safe_u64 mut_rbx{};
+            bsl::safe_u64 mut_rcx{};
+            bsl::safe_u64 mut_rdx{};
+
+            if (CPUID_FN4000_0000 == fn) {
+                mut_rax = bsl::to_u64(CPUID_FN4000_0010);
+                mut_rbx = CPUID_FN4000_0000_EBX_KVM;
+                mut_rcx = CPUID_FN4000_0000_ECX_KVM;
+                mut_rdx = CPUID_FN4000_0000_EDX_KVM;
+            }
+            else if (CPUID_FN4000_0001 == fn) {
+                mut_rax = CPUID_FN4000_0001_EAX_CLOCKSOURCE2;
+                mut_rax |= CPUID_FN4000_0001_EAX_STEAL_TIME;
+                mut_rax |= CPUID_FN4000_0001_EAX_PV_EOI;
+                mut_rax |= CPUID_FN4000_0001_EAX_PV_UNHALT;
+                mut_rax |= CPUID_FN4000_0001_EAX_PV_TLB_FLUSH;
+                mut_rax |= CPUID_FN4000_0001_EAX_PV_SEND_IPI;
+                mut_rax |= CPUID_FN4000_0001_EAX_CLOCKSOURCE_STABLE;
+            }
+            else if (CPUID_FN4000_0010 == fn) {
+                mut_rax = tsc_khz;
+                mut_rbx = LAPIC_BUS_KHZ;
+            }
+            else {
+                bsl::touch();
+            }
+
+            mut_sys.bf_tls_set_rax(mut_rax);
+            mut_sys.bf_tls_set_rbx(mut_rbx);
+            mut_sys.bf_tls_set_rcx(mut_rcx);
+            mut_sys.bf_tls_set_rdx(mut_rdx);
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this emulated_cpuid_t.
@@ -219,19 +276,26 @@ namespace microv
         ///     syscall layer and stores the results in the same registers.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_sys the bf_syscall_t to use
         ///   @param intrinsic the intrinsic_t to use
+        ///   @param tsc_khz the TSC frequency of the VS in KHz
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise. If the PP was asked to promote the VS,
         ///     vmexit_success_promote is returned.
         ///
         [[nodiscard]] static constexpr auto
-        get(syscall::bf_syscall_t const &sys, intrinsic_t const &intrinsic) noexcept
-            -> bsl::errc_type
+        get(syscall::bf_syscall_t &mut_sys,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &tsc_khz) noexcept -> bsl::errc_type
         {
-            bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            auto const fn{bsl::to_u32_unsafe(mut_sys.bf_tls_rax())};
+            if (fn >= CPUID_FN4000_0000 && fn <= CPUID_FN4000_0010) {
+                get_hypervisor(mut_sys, fn, tsc_khz);
+                return bsl::errc_success;
+            }
+
             /// NOTE:
             /// - Create an array: mv_cpuid_leaf_t[max_functions][max_indexes].
             ///   The reason that this is 2-d is that some require
@@ -28,15 +28,26 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <mmio_access_t.hpp>
+#include <reg_cache_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the max number of bytes in an x86 instruction
+    constexpr auto MAX_INSTRUCTION_LEN{15_u64};
+    /// @brief defines the type used to store an instruction's bytes
+    using instruction_bytes_t = bsl::array<bsl::uint8, MAX_INSTRUCTION_LEN.get()>;
+
     /// @class microv::emulated_decoder_t
     ///
     /// <!-- description -->
@@ -94,6 +105,281 @@ namespace microv
     {
         /// @brief stores the ID of the VS associated with this emulated_cpuid_t
         bsl::safe_u16 m_assigned_vsid{};
+        /// @brief stores the MMIO read that is waiting for its data
+        mmio_access_t m_pending_read{};
+        /// @brief stores true if m_pending_read needs to be completed
+        bool m_pending_read_valid{};
+
+        /// <!-- description -->
+        ///   @brief Returns the instruction byte located at "idx", or
+        ///     bsl::safe_u64::failure() if "idx" is out of bounds.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bytes the instruction bytes to read from
+        ///   @param num the total number of valid bytes in "bytes"
+        ///   @param idx the index of the byte to return
+        ///   @return Returns the instruction byte located at "idx", or
+        ///     bsl::safe_u64::failure() if "idx" is out of bounds.
+        ///
+        [[nodiscard]] static constexpr auto
+        byte_at(
+            instruction_bytes_t const &bytes,
+            bsl::safe_u64 const &num,
+            bsl::safe_u64 const &idx) noexcept -> bsl::safe_u64
+        {
+            if (bsl::unlikely(idx >= num)) {
+                bsl::error() << "instruction decode ran out of bytes at "    // --
+                             << idx                                          // --
+                             << bsl::endl                                    // --
+                             << bsl::here();                                 // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            return bsl::to_u64(*bytes.at_if(bsl::to_idx(idx)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided byte is a legacy prefix
+        ///     that has no effect on how an MMIO access is emulated
+        ///     (i.e., LOCK, REP and segment overrides).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param byte the byte to check
+        ///   @return Returns true if the provided byte is a legacy prefix
+        ///     that can be skipped.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_ignored_prefix(bsl::safe_u64 const &byte) noexcept -> bool
+        {
+            switch (byte.get()) {
+                case (0xF0_u64).get():
+                case (0xF2_u64).get():
+                case (0xF3_u64).get():
+                case (0x26_u64).get():
+                case (0x2E_u64).get():
+                case (0x36_u64).get():
+                case (0x3E_u64).get():
+                case (0x64_u64).get():
+                case (0x65_u64).get(): {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of a GPR given its x86 encoding.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_reg_cache the register cache of the VS
+        ///   @param reg the x86 encoding of the GPR to read
+        ///   @return Returns the value of the GPR, or
+        ///     bsl::safe_u64::failure() on error.
+        ///
+        [[nodiscard]] constexpr auto
+        gpr_read(
+            syscall::bf_syscall_t const &sys,
+            reg_cache_t &mut_reg_cache,
+            bsl::safe_u64 const &reg) const noexcept -> bsl::safe_u64
+        {
+            using mk = syscall::bf_reg_t;
+            auto const vsid{this->assigned_vsid()};
+
+            switch (reg.get()) {
+                case (0_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rax);
+                }
+
+                case (1_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rcx);
+                }
+
+                case (2_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rdx);
+                }
+
+                case (3_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rbx);
+                }
+
+                case (4_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rsp);
+                }
+
+                case (5_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rbp);
+                }
+
+                case (6_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rsi);
+                }
+
+                case (7_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_rdi);
+                }
+
+                case (8_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r8);
+                }
+
+                case (9_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r9);
+                }
+
+                case (10_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r10);
+                }
+
+                case (11_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r11);
+                }
+
+                case (12_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r12);
+                }
+
+                case (13_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r13);
+                }
+
+                case (14_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r14);
+                }
+
+                case (15_u64).get(): {
+                    return mut_reg_cache.read(sys, vsid, mk::bf_reg_t_r15);
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            bsl::error() << "unsupported gpr " << reg << bsl::endl << bsl::here();
+            return bsl::safe_u64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value of a GPR given its x86 encoding. The
+        ///     write is made through the VS's register cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param mut_reg_cache the register cache of the VS
+        ///   @param reg the x86 encoding of the GPR to write
+        ///   @param val the value to write to the GPR
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        gpr_write(
+            syscall::bf_syscall_t &mut_sys,
+            reg_cache_t &mut_reg_cache,
+            bsl::safe_u64 const &reg,
+            bsl::safe_u64 const &val) const noexcept -> bsl::errc_type
+        {
+            using mk = syscall::bf_reg_t;
+            auto const vsid{this->assigned_vsid()};
+
+            switch (reg.get()) {
+                case (0_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rax, val);
+                }
+
+                case (1_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rcx, val);
+                }
+
+                case (2_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rdx, val);
+                }
+
+                case (3_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rbx, val);
+                }
+
+                case (4_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rsp, val);
+                }
+
+                case (5_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rbp, val);
+                }
+
+                case (6_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rsi, val);
+                }
+
+                case (7_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_rdi, val);
+                }
+
+                case (8_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r8, val);
+                }
+
+                case (9_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r9, val);
+                }
+
+                case (10_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r10, val);
+                }
+
+                case (11_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r11, val);
+                }
+
+                case (12_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r12, val);
+                }
+
+                case (13_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r13, val);
+                }
+
+                case (14_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r14, val);
+                }
+
+                case (15_u64).get(): {
+                    return mut_reg_cache.write(mut_sys, vsid, mk::bf_reg_t_r15, val);
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            bsl::error() << "unsupported gpr " << reg << bsl::endl << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a mask that covers "bytes" bytes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bytes the number of bytes to cover (1, 2, 4 or 8)
+        ///   @return Returns a mask that covers "bytes" bytes.
+        ///
+        [[nodiscard]] static constexpr auto
+        bytes_to_mask(bsl::safe_u64 const &bytes) noexcept -> bsl::safe_u64
+        {
+            constexpr auto bits_per_byte{8_u64};
+
+            if (bytes >= bsl::to_u64(sizeof(bsl::uint64))) {
+                return bsl::safe_u64::max_value();
+            }
+
+            return ((1_u64 << (bytes * bits_per_byte)) - 1_u64).checked();
+        }
 
     public:
         /// <!-- description -->
@@ -145,6 +431,8 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            m_pending_read = {};
+            m_pending_read_valid = {};
             m_assigned_vsid = {};
         }
 
@@ -162,6 +450,520 @@ namespace microv
             bsl::ensures(m_assigned_vsid.is_valid_and_checked());
             return ~m_assigned_vsid;
         }
+
+        /// <!-- description -->
+        ///   @brief Decodes an instruction that generated an MMIO access.
+        ///     Only MOV (88, 89, 8A, 8B, C6 /0, C7 /0), MOVZX (0F B6/B7)
+        ///     and MOVSX (0F BE/BF) with a memory operand are supported.
+        ///     Anything else returns an error.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bytes the instruction bytes to decode
+        ///   @param num the total number of valid bytes in "bytes"
+        ///   @param long_mode true if the VS is executing in 64bit mode
+        ///   @param default32 true if CS.D is set (ignored in 64bit mode)
+        ///   @param mut_access where to store the results of the decode
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        decode(
+            instruction_bytes_t const &bytes,
+            bsl::safe_u64 const &num,
+            bool const long_mode,
+            bool const default32,
+            mmio_access_t &mut_access) noexcept -> bsl::errc_type
+        {
+            constexpr auto prefix_opsize{0x66_u64};
+            constexpr auto prefix_addrsize{0x67_u64};
+            constexpr auto rex_mask{0xF0_u64};
+            constexpr auto rex_val{0x40_u64};
+            constexpr auto rex_w{0x08_u64};
+            constexpr auto rex_r{0x04_u64};
+            constexpr auto rex_r_shft{1_u64};
+            constexpr auto two_byte{0x0F_u64};
+            constexpr auto two_byte_flag{0x0F00_u64};
+
+            constexpr auto bytes1{1_u64};
+            constexpr auto bytes2{2_u64};
+            constexpr auto bytes4{4_u64};
+            constexpr auto bytes8{8_u64};
+
+            bool mut_opsize_prefix{};
+            bool mut_addrsize_prefix{};
+            bsl::safe_u64 mut_rex{};
+            bsl::safe_u64 mut_idx{};
+            bsl::safe_u64 mut_op{};
+
+            mut_access = {};
+
+            // -----------------------------------------------------------------
+            // Prefixes
+            // -----------------------------------------------------------------
+
+            while (mut_idx < MAX_INSTRUCTION_LEN) {
+                mut_op = byte_at(bytes, num, mut_idx);
+                if (bsl::unlikely(mut_op.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                if (prefix_opsize == mut_op) {
+                    mut_opsize_prefix = true;
+                }
+                else if (prefix_addrsize == mut_op) {
+                    mut_addrsize_prefix = true;
+                }
+                else if (!is_ignored_prefix(mut_op)) {
+                    break;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                ++mut_idx;
+            }
+
+            if (long_mode && (rex_val == (mut_op & rex_mask))) {
+                mut_rex = mut_op;
+                ++mut_idx;
+
+                mut_op = byte_at(bytes, num, mut_idx);
+                if (bsl::unlikely(mut_op.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            // -----------------------------------------------------------------
+            // Operand/Address Size
+            // -----------------------------------------------------------------
+
+            bsl::safe_u64 mut_opsize{};
+            if (long_mode) {
+                if ((mut_rex & rex_w).is_pos()) {
+                    mut_opsize = bytes8;
+                }
+                else if (mut_opsize_prefix) {
+                    mut_opsize = bytes2;
+                }
+                else {
+                    mut_opsize = bytes4;
+                }
+            }
+            else {
+                if (default32 != mut_opsize_prefix) {
+                    mut_opsize = bytes4;
+                }
+                else {
+                    mut_opsize = bytes2;
+                }
+            }
+
+            bool const addr16{!long_mode && (default32 == mut_addrsize_prefix)};
+
+            // -----------------------------------------------------------------
+            // Opcode
+            // -----------------------------------------------------------------
+
+            ++mut_idx;
+            if (two_byte == mut_op) {
+                mut_op = byte_at(bytes, num, mut_idx);
+                if (bsl::unlikely(mut_op.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_op |= two_byte_flag;
+                ++mut_idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            bool mut_byte_reg{};
+            bsl::safe_u64 mut_imm_len{};
+
+            switch (mut_op.get()) {
+                case (0x88_u64).get(): {
+                    mut_access.write = true;
+                    mut_access.bytes = bytes1;
+                    mut_byte_reg = true;
+                    break;
+                }
+
+                case (0x89_u64).get(): {
+                    mut_access.write = true;
+                    mut_access.bytes = mut_opsize;
+                    break;
+                }
+
+                case (0x8A_u64).get(): {
+                    mut_access.bytes = bytes1;
+                    mut_access.reg_bytes = bytes1;
+                    mut_byte_reg = true;
+                    break;
+                }
+
+                case (0x8B_u64).get(): {
+                    mut_access.bytes = mut_opsize;
+                    mut_access.reg_bytes = mut_opsize;
+                    break;
+                }
+
+                case (0xC6_u64).get(): {
+                    mut_access.write = true;
+                    mut_access.has_imm = true;
+                    mut_access.bytes = bytes1;
+                    mut_imm_len = bytes1;
+                    break;
+                }
+
+                case (0xC7_u64).get(): {
+                    mut_access.write = true;
+                    mut_access.has_imm = true;
+                    mut_access.bytes = mut_opsize;
+
+                    if (bytes2 == mut_opsize) {
+                        mut_imm_len = bytes2;
+                    }
+                    else {
+                        mut_imm_len = bytes4;
+                    }
+
+                    break;
+                }
+
+                case (0x0FB6_u64).get(): {
+                    mut_access.bytes = bytes1;
+                    mut_access.reg_bytes = mut_opsize;
+                    break;
+                }
+
+                case (0x0FB7_u64).get(): {
+                    mut_access.bytes = bytes2;
+                    mut_access.reg_bytes = mut_opsize;
+                    break;
+                }
+
+                case (0x0FBE_u64).get(): {
+                    mut_access.bytes = bytes1;
+                    mut_access.reg_bytes = mut_opsize;
+                    mut_access.sign_extend = true;
+                    break;
+                }
+
+                case (0x0FBF_u64).get(): {
+                    mut_access.bytes = bytes2;
+                    mut_access.reg_bytes = mut_opsize;
+                    mut_access.sign_extend = true;
+                    break;
+                }
+
+                default: {
+                    bsl::error() << "unsupported MMIO instruction with opcode "    // --
+                                 << bsl::hex(mut_op)                               // --
+                                 << bsl::endl                                      // --
+                                 << bsl::here();                                   // --
+
+                    return bsl::errc_failure;
+                }
+            }
+
+            // -----------------------------------------------------------------
+            // ModRM/SIB/Displacement
+            // -----------------------------------------------------------------
+
+            constexpr auto mod_shft{6_u64};
+            constexpr auto reg_shft{3_u64};
+            constexpr auto field_mask{0x7_u64};
+            constexpr auto mod_reg{3_u64};
+            constexpr auto mod_disp8{1_u64};
+            constexpr auto mod_disp{2_u64};
+            constexpr auto rm_sib{4_u64};
+            constexpr auto rm_disp32{5_u64};
+            constexpr auto rm_disp16{6_u64};
+            constexpr auto high8_first{4_u64};
+
+            auto const modrm{byte_at(bytes, num, mut_idx)};
+            if (bsl::unlikely(modrm.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            ++mut_idx;
+
+            auto const mod{modrm >> mod_shft};
+            auto const rm{modrm & field_mask};
+            auto const reg{(modrm >> reg_shft) & field_mask};
+
+            if (bsl::unlikely(mod_reg == mod)) {
+                bsl::error() << "MMIO instruction "                          // --
+                             << bsl::hex(mut_op)                             // --
+                             << " does not have a memory operand"            // --
+                             << bsl::endl                                    // --
+                             << bsl::here();                                 // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(mut_access.has_imm && reg.is_pos())) {
+                bsl::error() << "unsupported MMIO instruction "    // --
+                             << bsl::hex(mut_op)                   // --
+                             << " /"                               // --
+                             << reg                                // --
+                             << bsl::endl                          // --
+                             << bsl::here();                       // --
+
+                return bsl::errc_failure;
+            }
+
+            mut_access.reg = (reg | ((mut_rex & rex_r) << rex_r_shft)).checked();
+            if (mut_byte_reg && mut_rex.is_zero() && (mut_access.reg >= high8_first)) {
+                mut_access.reg -= high8_first;
+                mut_access.reg_high8 = true;
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::safe_u64 mut_disp_len{};
+            if (addr16) {
+                if (mod_disp8 == mod) {
+                    mut_disp_len = bytes1;
+                }
+                else if ((mod_disp == mod) || (mod.is_zero() && (rm_disp16 == rm))) {
+                    mut_disp_len = bytes2;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                if (rm_sib == rm) {
+                    auto const sib{byte_at(bytes, num, mut_idx)};
+                    if (bsl::unlikely(sib.is_invalid())) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
+                    ++mut_idx;
+                    if (mod.is_zero() && (rm_disp32 == (sib & field_mask))) {
+                        mut_disp_len = bytes4;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (mod_disp8 == mod) {
+                    mut_disp_len = bytes1;
+                }
+                else if ((mod_disp == mod) || (mod.is_zero() && (rm_disp32 == rm))) {
+                    mut_disp_len = bytes4;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            mut_idx += mut_disp_len;
+
+            // -----------------------------------------------------------------
+            // Immediate
+            // -----------------------------------------------------------------
+
+            constexpr auto bits_per_byte{8_u64};
+            for (bsl::safe_u64 mut_i{}; mut_i < mut_imm_len; ++mut_i) {
+                auto const byte{byte_at(bytes, num, (mut_idx + mut_i).checked())};
+                if (bsl::unlikely(byte.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_access.imm |= (byte << (mut_i * bits_per_byte)).checked();
+            }
+
+            mut_idx += mut_imm_len;
+
+            constexpr auto imm32_sign{0x0000000080000000_u64};
+            constexpr auto imm32_ext{0xFFFFFFFF00000000_u64};
+
+            if ((bytes8 == mut_access.bytes) && (mut_access.imm & imm32_sign).is_pos()) {
+                mut_access.imm |= imm32_ext;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(mut_idx > num)) {
+                bsl::error() << "MMIO instruction "             // --
+                             << bsl::hex(mut_op)                // --
+                             << " is truncated at "             // --
+                             << num                             // --
+                             << " bytes"                        // --
+                             << bsl::endl                       // --
+                             << bsl::here();                    // --
+
+                return bsl::errc_failure;
+            }
+
+            mut_access.len = mut_idx.checked();
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the data that the decoded MMIO write instruction
+        ///     will write to memory, truncated to the size of the access.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_reg_cache the register cache of the VS
+        ///   @param access the decoded MMIO write
+        ///   @return Returns the data that the decoded MMIO write
+        ///     instruction will write to memory, or
+        ///     bsl::safe_u64::failure() on error.
+        ///
+        [[nodiscard]] constexpr auto
+        write_data(
+            syscall::bf_syscall_t const &sys,
+            reg_cache_t &mut_reg_cache,
+            mmio_access_t const &access) const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(access.write);
+
+            if (access.has_imm) {
+                return access.imm & bytes_to_mask(access.bytes);
+            }
+
+            auto mut_val{this->gpr_read(sys, mut_reg_cache, access.reg)};
+            if (bsl::unlikely(mut_val.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u64::failure();
+            }
+
+            constexpr auto high8_shft{8_u64};
+            if (access.reg_high8) {
+                mut_val >>= high8_shft;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_val & bytes_to_mask(access.bytes);
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores a decoded MMIO read so that its register
+        ///     writeback can be completed by complete_read once the
+        ///     data is provided by the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param access the decoded MMIO read to store
+        ///
+        constexpr void
+        set_pending_read(mmio_access_t const &access) noexcept
+        {
+            bsl::expects(!access.write);
+
+            m_pending_read = access;
+            m_pending_read_valid = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an MMIO read is waiting for its data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if an MMIO read is waiting for its data.
+        ///
+        [[nodiscard]] constexpr auto
+        is_read_pending() const noexcept -> bool
+        {
+            return m_pending_read_valid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes a pending MMIO read by writing the provided
+        ///     data to the destination register, merging, zero extending
+        ///     or sign extending as the decoded instruction requires.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param mut_reg_cache the register cache of the VS
+        ///   @param data the data that was read from the MMIO region
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        complete_read(
+            syscall::bf_syscall_t &mut_sys,
+            reg_cache_t &mut_reg_cache,
+            bsl::safe_u64 const &data) noexcept -> bsl::errc_type
+        {
+            bsl::expects(m_pending_read_valid);
+            bsl::expects(data.is_valid_and_checked());
+
+            auto const access{m_pending_read};
+            m_pending_read = {};
+            m_pending_read_valid = {};
+
+            constexpr auto bits_per_byte{8_u64};
+            constexpr auto high8_shft{8_u64};
+            constexpr auto bytes4{4_u64};
+
+            auto mut_val{data & bytes_to_mask(access.bytes)};
+            if (access.sign_extend) {
+                auto const sign{1_u64 << ((access.bytes * bits_per_byte) - 1_u64)};
+                if ((mut_val & sign).is_pos()) {
+                    mut_val |= ~bytes_to_mask(access.bytes);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - 32bit destinations zero extend into the upper half of the
+            ///   register, while 8bit and 16bit destinations leave the rest
+            ///   of the register untouched, which means that we have to
+            ///   merge with the current value.
+            ///
+
+            if (bytes4 <= access.reg_bytes) {
+                return this->gpr_write(
+                    mut_sys, mut_reg_cache, access.reg, mut_val & bytes_to_mask(access.reg_bytes));
+            }
+
+            auto const cur{this->gpr_read(mut_sys, mut_reg_cache, access.reg)};
+            if (bsl::unlikely(cur.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto mut_mask{bytes_to_mask(access.reg_bytes)};
+            mut_val &= mut_mask;
+
+            if (access.reg_high8) {
+                mut_mask <<= high8_shft;
+                mut_val <<= high8_shft;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return this->gpr_write(mut_sys, mut_reg_cache, access.reg, (cur & ~mut_mask) | mut_val);
+        }
     };
 }
 
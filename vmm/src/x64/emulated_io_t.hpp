@@ -28,11 +28,14 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <reg_cache_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
@@ -51,6 +54,11 @@ namespace microv
         /// @brief stores the ID of the VS associated with this emulated_io_t
         bsl::safe_u16 m_assigned_vsid{};
 
+        /// @brief stores the IN/INS access that is waiting for its data
+        io_access_t m_pending_in{};
+        /// @brief stores true if m_pending_in is waiting for its data
+        bool m_pending_in_valid{};
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this emulated_io_t.
@@ -109,6 +117,8 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            m_pending_in = {};
+            m_pending_in_valid = {};
             m_assigned_vsid = {};
         }
 
@@ -126,6 +136,109 @@ namespace microv
             bsl::ensures(m_assigned_vsid.is_valid_and_checked());
             return ~m_assigned_vsid;
         }
+
+        /// <!-- description -->
+        ///   @brief Records an IN/INS access that must be completed the
+        ///     next time the VS is run, once the root VM has provided the
+        ///     data that was read.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param access the IN/INS access to record
+        ///
+        constexpr void
+        set_pending_in(io_access_t const &access) noexcept
+        {
+            bsl::expects(access.in);
+            bsl::expects(access.count.is_pos());
+
+            m_pending_in = access;
+            m_pending_in_valid = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an IN/INS access is waiting for its
+        ///     data.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if an IN/INS access is waiting for its
+        ///     data.
+        ///
+        [[nodiscard]] constexpr auto
+        is_in_pending() const noexcept -> bool
+        {
+            return m_pending_in_valid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the IN/INS access that is waiting for its data.
+        ///     Only valid if is_in_pending() returns true.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the IN/INS access that is waiting for its data.
+        ///
+        [[nodiscard]] constexpr auto
+        pending_in() const noexcept -> io_access_t const &
+        {
+            bsl::expects(m_pending_in_valid);
+            return m_pending_in;
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes the pending IN/INS access. For IN, "data" is
+        ///     merged into AL/AX/EAX the same way hardware would have (a
+        ///     32bit IN zero extends into RAX). INS writes to guest memory
+        ///     and not a register, so the caller is expected to have
+        ///     already copied the data into the guest, in which case "data"
+        ///     is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param mut_reg_cache the register cache of the VS
+        ///   @param data the data that was read from the port
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        complete_in(
+            syscall::bf_syscall_t &mut_sys,
+            reg_cache_t &mut_reg_cache,
+            bsl::safe_u64 const &data) noexcept -> bsl::errc_type
+        {
+            bsl::expects(m_pending_in_valid);
+            m_pending_in_valid = false;
+
+            if (m_pending_in.string) {
+                return bsl::errc_success;
+            }
+
+            constexpr auto bytes1{1_u64};
+            constexpr auto bytes2{2_u64};
+            constexpr auto mask1{0x00000000000000FF_u64};
+            constexpr auto mask2{0x000000000000FFFF_u64};
+            constexpr auto mask4{0x00000000FFFFFFFF_u64};
+
+            constexpr auto rax_idx{syscall::bf_reg_t::bf_reg_t_rax};
+            auto const vsid{this->assigned_vsid()};
+
+            bsl::safe_u64 mut_rax{};
+            if (bytes1 == m_pending_in.bytes) {
+                mut_rax = (mut_reg_cache.read(mut_sys, vsid, rax_idx) & ~mask1) | (data & mask1);
+            }
+            else if (bytes2 == m_pending_in.bytes) {
+                mut_rax = (mut_reg_cache.read(mut_sys, vsid, rax_idx) & ~mask2) | (data & mask2);
+            }
+            else {
+                mut_rax = data & mask4;
+            }
+
+            auto const ret{mut_reg_cache.write(mut_sys, vsid, rax_idx, mut_rax)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            return ret;
+        }
     };
 }
 
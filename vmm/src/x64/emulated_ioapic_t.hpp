@@ -28,19 +28,101 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <lock_guard_t.hpp>
+#include <spinlock_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the guest physical address of the IOAPIC
+    constexpr auto IOAPIC_GPA{0xFEC00000_u64};
+    /// @brief defines the size of the IOAPIC's MMIO region
+    constexpr auto IOAPIC_SIZE{0x100_u64};
+    /// @brief defines the number of pins (redirection entries) of the IOAPIC
+    constexpr auto IOAPIC_NUM_PINS{24_u64};
+
+    /// @brief defines the offset of the register select register
+    constexpr auto IOAPIC_IOREGSEL{0x00_u64};
+    /// @brief defines the offset of the register window
+    constexpr auto IOAPIC_IOWIN{0x10_u64};
+    /// @brief defines the offset of the EOI register (version 0x20)
+    constexpr auto IOAPIC_EOI{0x40_u64};
+
+    /// @brief defines the index of the ID register
+    constexpr auto IOAPIC_REG_ID{0x00_u64};
+    /// @brief defines the index of the version register
+    constexpr auto IOAPIC_REG_VERSION{0x01_u64};
+    /// @brief defines the index of the arbitration register
+    constexpr auto IOAPIC_REG_ARB{0x02_u64};
+    /// @brief defines the index of the first redirection table register
+    constexpr auto IOAPIC_REG_REDTBL{0x10_u64};
+    /// @brief defines the value of the version register (24 pins, v0x20)
+    constexpr auto IOAPIC_VERSION{0x00170020_u64};
+
+    /// @brief defines the shift of the ID in the ID register
+    constexpr auto IOAPIC_ID_SHIFT{24_u64};
+    /// @brief defines the mask of the ID (after shifting)
+    constexpr auto IOAPIC_ID_MASK{0xF_u64};
+    /// @brief defines the mask of a register index/vector
+    constexpr auto IOAPIC_BYTE_MASK{0xFF_u64};
+    /// @brief defines the mask of a 32bit register
+    constexpr auto IOAPIC_DWORD_MASK{0xFFFFFFFF_u64};
+    /// @brief defines the number of bits in a 32bit register
+    constexpr auto IOAPIC_DWORD_SHIFT{32_u64};
+
+    /// @brief defines the redirection entry's vector bits
+    constexpr auto IOAPIC_RTE_VECTOR{0x00000000000000FF_u64};
+    /// @brief defines the redirection entry's delivery mode bits
+    constexpr auto IOAPIC_RTE_DELIVERY_MODE{0x0000000000000700_u64};
+    /// @brief defines the redirection entry's lowest priority delivery mode
+    constexpr auto IOAPIC_RTE_DELIVERY_LOWEST{0x0000000000000100_u64};
+    /// @brief defines the redirection entry's logical destination mode bit
+    constexpr auto IOAPIC_RTE_DEST_LOGICAL{0x0000000000000800_u64};
+    /// @brief defines the redirection entry's delivery status bit
+    constexpr auto IOAPIC_RTE_DELIVERY_STATUS{0x0000000000001000_u64};
+    /// @brief defines the redirection entry's remote IRR bit
+    constexpr auto IOAPIC_RTE_REMOTE_IRR{0x0000000000004000_u64};
+    /// @brief defines the redirection entry's level triggered bit
+    constexpr auto IOAPIC_RTE_LEVEL{0x0000000000008000_u64};
+    /// @brief defines the redirection entry's mask bit
+    constexpr auto IOAPIC_RTE_MASKED{0x0000000000010000_u64};
+    /// @brief defines the redirection entry's read-only bits
+    constexpr auto IOAPIC_RTE_RO{0x0000000000005000_u64};
+    /// @brief defines the shift of the redirection entry's destination
+    constexpr auto IOAPIC_RTE_DEST_SHIFT{56_u64};
+    /// @brief defines the physical destination that means "all"
+    constexpr auto IOAPIC_DEST_BROADCAST{0xFF_u64};
+    /// @brief defines the number of logical (flat) destinations
+    constexpr auto IOAPIC_NUM_LOGICAL_DESTS{8_u64};
+
     /// @class microv::emulated_ioapic_t
     ///
     /// <!-- description -->
-    ///   @brief Defines MicroV's emulated IOAPIC handler.
+    ///   @brief Defines MicroV's emulated IOAPIC handler. This is a 24 pin
+    ///     IOAPIC (version 0x20) at 0xFEC00000. Pins are driven by
+    ///     MicroV's own devices and by guest software through
+    ///     mv_vm_op_irq_line. An interrupt that is sent is recorded until
+    ///     the VS it is destined to acknowledges it, which keeps the
+    ///     IOAPIC usable from any PP without having to touch another PP's
+    ///     VS. Only fixed and lowest priority delivery is supported, and a
+    ///     logical destination is always delivered to the lowest APIC ID
+    ///     in the destination set. Level triggered pins set remote IRR
+    ///     when they are sent, which is cleared by an EOI for the pin's
+    ///     vector. A level triggered pin that is resampled (see
+    ///     mv_vm_op_irq_resample) is lowered by that EOI instead of being
+    ///     resent, and is recorded until the root VM collects it.
     ///
     ///   @note IMPORTANT: This class is a per-VM class. Any IO/MMIO accesses
     ///     to the IOAPIC must come through here. This may/may not be needed
@@ -52,6 +134,241 @@ namespace microv
     {
         /// @brief stores the ID of the VM associated with this emulated_ioapic_t
         bsl::safe_u16 m_assigned_vmid{};
+        /// @brief safe guards the IOAPIC's state.
+        mutable spinlock_t m_lock{};
+
+        /// @brief stores the redirection table
+        bsl::array<bsl::safe_u64, IOAPIC_NUM_PINS.get()> m_redtbl{};
+        /// @brief stores the IOAPIC's ID
+        bsl::safe_u64 m_id{};
+        /// @brief stores the register selected by IOREGSEL
+        bsl::safe_u64 m_select{};
+        /// @brief stores the asserted (level) or latched (edge) pins
+        bsl::safe_u64 m_irr{};
+        /// @brief stores the pins that were sent and not yet acknowledged
+        bsl::safe_u64 m_sent{};
+        /// @brief stores the pins that are lowered and recorded on EOI
+        bsl::safe_u64 m_resample{};
+        /// @brief stores the resampled pins the root VM has not collected
+        bsl::safe_u64 m_resampled{};
+
+        /// <!-- description -->
+        ///   @brief Sends the interrupt of the provided pin if its
+        ///     redirection entry allows it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pin the pin to service
+        ///
+        constexpr void
+        service(bsl::safe_u64 const &pin) noexcept
+        {
+            auto const mask{1_u64 << pin};
+            auto *const pmut_rte{m_redtbl.at_if(bsl::to_idx(pin))};
+
+            if ((*pmut_rte & IOAPIC_RTE_MASKED).is_pos()) {
+                return;
+            }
+
+            if ((*pmut_rte & IOAPIC_RTE_DELIVERY_MODE) > IOAPIC_RTE_DELIVERY_LOWEST) {
+                bsl::debug<bsl::V>() << "ioapic: unsupported delivery mode for pin "    // --
+                                     << bsl::hex(pin)                               // --
+                                     << bsl::endl;
+                return;
+            }
+
+            if ((*pmut_rte & IOAPIC_RTE_LEVEL).is_pos()) {
+                if ((*pmut_rte & IOAPIC_RTE_REMOTE_IRR).is_pos()) {
+                    return;
+                }
+
+                *pmut_rte |= IOAPIC_RTE_REMOTE_IRR;
+            }
+            else {
+                m_irr &= ~mask;
+            }
+
+            m_sent |= mask;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided redirection entry targets
+        ///     the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rte the redirection entry to query
+        ///   @param apic_id the APIC ID to compare against
+        ///   @return Returns true if the provided redirection entry targets
+        ///     the provided APIC ID.
+        ///
+        [[nodiscard]] static constexpr auto
+        targets(bsl::safe_u64 const &rte, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            auto const dest{rte >> IOAPIC_RTE_DEST_SHIFT};
+
+            if ((rte & IOAPIC_RTE_DEST_LOGICAL).is_zero()) {
+                if (IOAPIC_DEST_BROADCAST == dest) {
+                    return apic_id.is_zero();
+                }
+
+                return dest == apic_id;
+            }
+
+            for (bsl::safe_u64 mut_i{}; mut_i < IOAPIC_NUM_LOGICAL_DESTS; ++mut_i) {
+                if ((dest & (1_u64 << mut_i)).is_pos()) {
+                    return mut_i == apic_id;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes to the register selected by IOREGSEL.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value being written
+        ///
+        constexpr void
+        write_window(bsl::safe_u64 const &val) noexcept
+        {
+            if (IOAPIC_REG_ID == m_select) {
+                m_id = (val >> IOAPIC_ID_SHIFT) & IOAPIC_ID_MASK;
+                return;
+            }
+
+            if (m_select < IOAPIC_REG_REDTBL) {
+                return;
+            }
+
+            auto const pin{(m_select - IOAPIC_REG_REDTBL) >> 1_u64};
+            if (pin >= IOAPIC_NUM_PINS) {
+                return;
+            }
+
+            auto *const pmut_rte{m_redtbl.at_if(bsl::to_idx(pin))};
+            if ((m_select & 1_u64).is_pos()) {
+                *pmut_rte = (*pmut_rte & IOAPIC_DWORD_MASK) | (val << IOAPIC_DWORD_SHIFT);
+                return;
+            }
+
+            auto mut_rte{(*pmut_rte & ~IOAPIC_DWORD_MASK) | (val & ~IOAPIC_RTE_RO)};
+            mut_rte |= (*pmut_rte & IOAPIC_RTE_RO);
+
+            if ((mut_rte & IOAPIC_RTE_LEVEL).is_zero()) {
+                mut_rte &= ~IOAPIC_RTE_REMOTE_IRR;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *pmut_rte = mut_rte;
+
+            /// NOTE:
+            /// - A level triggered pin that is still asserted is sent as
+            ///   soon as it is unmasked. Edges that arrived while masked
+            ///   are lost, the same as with KVM.
+            ///
+
+            if (((mut_rte & IOAPIC_RTE_LEVEL).is_pos()) && ((m_irr & (1_u64 << pin)).is_pos())) {
+                this->service(pin);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads from the register selected by IOREGSEL.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the selected register
+        ///
+        [[nodiscard]] constexpr auto
+        read_window() const noexcept -> bsl::safe_u64
+        {
+            if ((IOAPIC_REG_ID == m_select) || (IOAPIC_REG_ARB == m_select)) {
+                return m_id << IOAPIC_ID_SHIFT;
+            }
+
+            if (IOAPIC_REG_VERSION == m_select) {
+                return IOAPIC_VERSION;
+            }
+
+            if (m_select < IOAPIC_REG_REDTBL) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            auto const pin{(m_select - IOAPIC_REG_REDTBL) >> 1_u64};
+            if (pin >= IOAPIC_NUM_PINS) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            auto const rte{*m_redtbl.at_if(bsl::to_idx(pin))};
+            if ((m_select & 1_u64).is_pos()) {
+                return rte >> IOAPIC_DWORD_SHIFT;
+            }
+
+            return rte & IOAPIC_DWORD_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears remote IRR of every level triggered pin using
+        ///     the provided vector, resending the pins that are still
+        ///     asserted. Resampled pins are lowered and recorded instead,
+        ///     as it is up to the root VM to raise them again if the
+        ///     device behind them still needs service.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vector the vector that was EOI'd
+        ///
+        constexpr void
+        eoi_locked(bsl::safe_u64 const &vector) noexcept
+        {
+            for (bsl::safe_u64 mut_pin{}; mut_pin < IOAPIC_NUM_PINS; ++mut_pin) {
+                auto *const pmut_rte{m_redtbl.at_if(bsl::to_idx(mut_pin))};
+                auto const mask{1_u64 << mut_pin};
+
+                bool const match{(*pmut_rte & IOAPIC_RTE_VECTOR) == vector};
+                if (!match || (*pmut_rte & IOAPIC_RTE_LEVEL).is_zero()) {
+                    bsl::touch();
+                }
+                else if ((m_resample & mask).is_pos()) {
+                    *pmut_rte &= ~IOAPIC_RTE_REMOTE_IRR;
+                    m_irr &= ~mask;
+                    m_resampled |= mask;
+                }
+                else {
+                    *pmut_rte &= ~IOAPIC_RTE_REMOTE_IRR;
+                    if ((m_irr & mask).is_pos()) {
+                        this->service(mut_pin);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the IOAPIC to its power on state (every pin
+        ///     masked).
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            for (auto &mut_rte : m_redtbl) {
+                mut_rte = IOAPIC_RTE_MASKED;
+            }
+
+            m_id = {};
+            m_select = {};
+            m_irr = {};
+            m_sent = {};
+            m_resample = {};
+            m_resampled = {};
+        }
 
     public:
         /// <!-- description -->
@@ -79,6 +396,7 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vmid = ~vmid;
         }
 
@@ -103,9 +421,25 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vmid = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the IOAPIC to its power on state. This is
+        ///     called when the VM it belongs to is destroyed so that the
+        ///     next VM does not inherit it's state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///
+        constexpr void
+        deallocate(tls_t const &tls) noexcept
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            this->reset();
+        }
+
         /// <!-- description -->
         ///   @brief Returns the ID of the PP associated with this
         ///     emulated_ioapic_t
@@ -120,6 +454,272 @@ namespace microv
             bsl::ensures(m_assigned_vmid.is_valid_and_checked());
             return ~m_assigned_vmid;
         }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided guest physical address
+        ///     belongs to this emulated_ioapic_t, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address to query
+        ///   @return Returns true if the provided guest physical address
+        ///     belongs to this emulated_ioapic_t, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        handles(bsl::safe_u64 const &gpa) noexcept -> bool
+        {
+            if (gpa < IOAPIC_GPA) {
+                return false;
+            }
+
+            return (gpa - IOAPIC_GPA) < IOAPIC_SIZE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an MMIO write to the IOAPIC. Only 32bit
+        ///     accesses to IOREGSEL, IOWIN and the EOI register do
+        ///     anything, everything else is ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gpa the guest physical address being written
+        ///   @param bytes the number of bytes being written
+        ///   @param val the value being written
+        ///
+        constexpr void
+        write(
+            tls_t const &tls,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &val) noexcept
+        {
+            constexpr auto bytes4{4_u64};
+            bsl::expects(handles(gpa));
+
+            if (bytes4 != bytes) {
+                return;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const offset{(gpa - IOAPIC_GPA).checked()};
+            if (IOAPIC_IOREGSEL == offset) {
+                m_select = val & IOAPIC_BYTE_MASK;
+            }
+            else if (IOAPIC_IOWIN == offset) {
+                this->write_window(val & IOAPIC_DWORD_MASK);
+            }
+            else if (IOAPIC_EOI == offset) {
+                this->eoi_locked(val & IOAPIC_BYTE_MASK);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an MMIO read from the IOAPIC. Anything other
+        ///     than a 32bit read of IOREGSEL or IOWIN reads as 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gpa the guest physical address being read
+        ///   @param bytes the number of bytes being read
+        ///   @return Returns the value read
+        ///
+        [[nodiscard]] constexpr auto
+        read(tls_t const &tls, bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) const noexcept
+            -> bsl::safe_u64
+        {
+            constexpr auto bytes4{4_u64};
+            bsl::expects(handles(gpa));
+
+            if (bytes4 != bytes) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const offset{(gpa - IOAPIC_GPA).checked()};
+            if (IOAPIC_IOREGSEL == offset) {
+                return m_select;
+            }
+
+            if (IOAPIC_IOWIN == offset) {
+                return this->read_window();
+            }
+
+            return bsl::safe_u64::magic_0();
+        }
+
+        /// <!-- description -->
+        ///   @brief Drives one of the IOAPIC's pins. Polarity is ignored,
+        ///     meaning level is the logical state of the pin.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param pin the pin to drive
+        ///   @param level the new level of the pin
+        ///
+        constexpr void
+        set_irq(tls_t const &tls, bsl::safe_u64 const &pin, bool const level) noexcept
+        {
+            bsl::expects(pin < IOAPIC_NUM_PINS);
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const mask{1_u64 << pin};
+            if (!level) {
+                m_irr &= ~mask;
+                return;
+            }
+
+            /// NOTE:
+            /// - An edge that arrives before the previous one on the same
+            ///   pin could be sent (i.e., while the pin is masked) is
+            ///   coalesced into it.
+            ///
+
+            bool const edge{(*m_redtbl.at_if(bsl::to_idx(pin)) & IOAPIC_RTE_LEVEL).is_zero()};
+            if (edge && (m_irr & mask).is_pos()) {
+                return;
+            }
+
+            m_irr |= mask;
+            this->service(pin);
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles an EOI for the provided vector. This clears
+        ///     remote IRR of every level triggered pin using the vector
+        ///     and resends the pins that are still asserted, unless they
+        ///     are resampled, in which case they are lowered and recorded
+        ///     for take_resampled().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vector the vector that was EOI'd
+        ///
+        constexpr void
+        eoi(tls_t const &tls, bsl::safe_u64 const &vector) noexcept
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            this->eoi_locked(vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Turns resampling of the provided pin on or off. See
+        ///     eoi() for more details.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param pin the pin to resample
+        ///   @param enable true to turn resampling on, false to turn it off
+        ///
+        constexpr void
+        set_resample(tls_t const &tls, bsl::safe_u64 const &pin, bool const enable) noexcept
+        {
+            bsl::expects(pin < IOAPIC_NUM_PINS);
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const mask{1_u64 << pin};
+            if (enable) {
+                m_resample |= mask;
+            }
+            else {
+                m_resample &= ~mask;
+                m_resampled &= ~mask;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a resampled pin was EOI'd and has not
+        ///     been collected using take_resampled() yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if a resampled pin was EOI'd and has not
+        ///     been collected using take_resampled() yet.
+        ///
+        [[nodiscard]] constexpr auto
+        resampled_pending(tls_t const &tls) const noexcept -> bool
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            return m_resampled.is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the resampled pins that were EOI'd since the
+        ///     last call (bit n is pin n), and forgets them.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns the resampled pins that were EOI'd since the
+        ///     last call
+        ///
+        [[nodiscard]] constexpr auto
+        take_resampled(tls_t const &tls) noexcept -> bsl::safe_u64
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const resampled{m_resampled};
+            m_resampled = {};
+
+            return resampled;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector that was sent to the
+        ///     provided APIC ID and has not been acknowledged yet, and
+        ///     marks it as acknowledged. If there is no such vector,
+        ///     bsl::safe_u64::failure() is returned. The returned value
+        ///     also carries IOAPIC_RTE_LEVEL so that the LAPIC can record
+        ///     the trigger mode in its TMR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns the vector to deliver (with IOAPIC_RTE_LEVEL
+        ///     set if it is level triggered), or bsl::safe_u64::failure()
+        ///     if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        ack(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bsl::safe_u64
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            if (m_sent.is_zero()) {
+                return bsl::safe_u64::failure();
+            }
+
+            auto mut_vector{bsl::safe_u64::failure()};
+            auto mut_pin{bsl::safe_u64::failure()};
+            for (bsl::safe_u64 mut_i{}; mut_i < IOAPIC_NUM_PINS; ++mut_i) {
+                auto const rte{*m_redtbl.at_if(bsl::to_idx(mut_i))};
+                bool const sent{(m_sent & (1_u64 << mut_i)).is_pos()};
+
+                if (sent && targets(rte, apic_id)) {
+                    auto const vector{rte & IOAPIC_RTE_VECTOR};
+                    if (mut_vector.is_invalid() || (vector > (mut_vector & IOAPIC_RTE_VECTOR))) {
+                        mut_vector = rte & (IOAPIC_RTE_VECTOR | IOAPIC_RTE_LEVEL);
+                        mut_pin = mut_i;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (mut_pin.is_invalid()) {
+                return bsl::safe_u64::failure();
+            }
+
+            m_sent &= ~(1_u64 << mut_pin);
+            return mut_vector;
+        }
     };
 }
 
@@ -22,25 +22,202 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 /// SOFTWARE.
 
+
 #ifndef EMULATED_LAPIC_T_HPP
 #define EMULATED_LAPIC_T_HPP
 
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <mv_lapic_state_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the offset of the LAPIC's ID register
+    constexpr auto LAPIC_REG_ID{0x020_u64};
+    /// @brief defines the offset of the LAPIC's version register
+    constexpr auto LAPIC_REG_VERSION{0x030_u64};
+    /// @brief defines the offset of the LAPIC's task priority register
+    constexpr auto LAPIC_REG_TPR{0x080_u64};
+    /// @brief defines the offset of the LAPIC's processor priority register
+    constexpr auto LAPIC_REG_PPR{0x0A0_u64};
+    /// @brief defines the offset of the LAPIC's EOI register
+    constexpr auto LAPIC_REG_EOI{0x0B0_u64};
+    /// @brief defines the offset of the LAPIC's logical destination register
+    constexpr auto LAPIC_REG_LDR{0x0D0_u64};
+    /// @brief defines the offset of the LAPIC's destination format register
+    constexpr auto LAPIC_REG_DFR{0x0E0_u64};
+    /// @brief defines the offset of the LAPIC's spurious vector register
+    constexpr auto LAPIC_REG_SVR{0x0F0_u64};
+    /// @brief defines the offset of the LAPIC's in-service register
+    constexpr auto LAPIC_REG_ISR{0x100_u64};
+    /// @brief defines the offset of the LAPIC's trigger mode register
+    constexpr auto LAPIC_REG_TMR{0x180_u64};
+    /// @brief defines the offset of the LAPIC's interrupt request register
+    constexpr auto LAPIC_REG_IRR{0x200_u64};
+    /// @brief defines the offset of the LAPIC's error status register
+    constexpr auto LAPIC_REG_ESR{0x280_u64};
+    /// @brief defines the offset of the low half of the LAPIC's ICR
+    constexpr auto LAPIC_REG_ICR_LO{0x300_u64};
+    /// @brief defines the offset of the high half of the LAPIC's ICR
+    constexpr auto LAPIC_REG_ICR_HI{0x310_u64};
+    /// @brief defines the offset of the LAPIC's LVT timer register
+    constexpr auto LAPIC_REG_LVT_TIMER{0x320_u64};
+    /// @brief defines the offset of the LAPIC's LVT thermal register
+    constexpr auto LAPIC_REG_LVT_THERMAL{0x330_u64};
+    /// @brief defines the offset of the LAPIC's LVT performance counter register
+    constexpr auto LAPIC_REG_LVT_PMC{0x340_u64};
+    /// @brief defines the offset of the LAPIC's LVT LINT0 register
+    constexpr auto LAPIC_REG_LVT_LINT0{0x350_u64};
+    /// @brief defines the offset of the LAPIC's LVT LINT1 register
+    constexpr auto LAPIC_REG_LVT_LINT1{0x360_u64};
+    /// @brief defines the offset of the LAPIC's LVT error register
+    constexpr auto LAPIC_REG_LVT_ERROR{0x370_u64};
+    /// @brief defines the offset of the LAPIC's timer initial count register
+    constexpr auto LAPIC_REG_TIMER_ICR{0x380_u64};
+    /// @brief defines the offset of the LAPIC's timer current count register
+    constexpr auto LAPIC_REG_TIMER_CCR{0x390_u64};
+    /// @brief defines the offset of the LAPIC's timer divide register
+    constexpr auto LAPIC_REG_TIMER_DCR{0x3E0_u64};
+    /// @brief defines the size of the LAPIC's register page
+    constexpr auto LAPIC_REGS_SIZE{0x400_u64};
+
+    /// @brief defines the version register (version 0x14, 6 LVT entries)
+    constexpr auto LAPIC_VERSION{0x00050014_u64};
+    /// @brief defines the shift of the APIC ID in the ID register
+    constexpr auto LAPIC_ID_SHIFT{24_u64};
+    /// @brief defines the bits of the ID, LDR and ICR high registers
+    constexpr auto LAPIC_DEST_MASK{0xFF000000_u64};
+    /// @brief defines the reserved bits of the DFR that read as 1
+    constexpr auto LAPIC_DFR_RSVD{0x0FFFFFFF_u64};
+    /// @brief defines the writable bits of the SVR
+    constexpr auto LAPIC_SVR_MASK{0x000003FF_u64};
+    /// @brief defines the SVR's APIC software enable bit
+    constexpr auto LAPIC_SVR_ENABLED{0x00000100_u64};
+    /// @brief defines the reset value of the SVR
+    constexpr auto LAPIC_SVR_RESET{0x000000FF_u64};
+    /// @brief defines the bits of a vector
+    constexpr auto LAPIC_VECTOR_MASK{0x000000FF_u64};
+    /// @brief defines the priority class bits of a vector
+    constexpr auto LAPIC_PRIORITY_CLASS{0x000000F0_u64};
+    /// @brief defines the shift that turns a priority class into CR8
+    constexpr auto LAPIC_PRIORITY_SHIFT{4_u64};
+    /// @brief defines the lowest vector that can be delivered as a fixed interrupt
+    constexpr auto LAPIC_MIN_VECTOR{0x10_u64};
+    /// @brief defines the ESR's "received illegal vector" bit
+    constexpr auto LAPIC_ESR_RECV_ILLEGAL{0x00000040_u64};
+    /// @brief defines the ESR's "send illegal vector" bit
+    constexpr auto LAPIC_ESR_SEND_ILLEGAL{0x00000020_u64};
+    /// @brief defines the delivery mode bits of the ICR and LVT entries
+    constexpr auto LAPIC_DELIVERY_MODE{0x00000700_u64};
+    /// @brief defines the fixed delivery mode
+    constexpr auto LAPIC_DELIVERY_FIXED{0x00000000_u64};
+    /// @brief defines the ExtINT delivery mode
+    constexpr auto LAPIC_DELIVERY_EXTINT{0x00000700_u64};
+    /// @brief defines the delivery status bit of the ICR and LVT entries
+    constexpr auto LAPIC_DELIVERY_STATUS{0x00001000_u64};
+    /// @brief defines the logical destination mode bit of the ICR
+    constexpr auto LAPIC_ICR_DEST_LOGICAL{0x00000800_u64};
+    /// @brief defines the destination shorthand bits of the ICR
+    constexpr auto LAPIC_ICR_SHORTHAND{0x000C0000_u64};
+    /// @brief defines the "no shorthand" destination shorthand
+    constexpr auto LAPIC_ICR_SHORTHAND_NONE{0x00000000_u64};
+    /// @brief defines the "self" destination shorthand
+    constexpr auto LAPIC_ICR_SHORTHAND_SELF{0x00040000_u64};
+    /// @brief defines the "all including self" destination shorthand
+    constexpr auto LAPIC_ICR_SHORTHAND_ALL{0x00080000_u64};
+    /// @brief defines the mask bit of an LVT entry
+    constexpr auto LAPIC_LVT_MASKED{0x00010000_u64};
+    /// @brief defines the writable bits of the LVT timer entry
+    constexpr auto LAPIC_LVT_TIMER_MASK{0x000700FF_u64};
+    /// @brief defines the writable bits of the LVT thermal and PMC entries
+    constexpr auto LAPIC_LVT_NMI_MASK{0x000107FF_u64};
+    /// @brief defines the writable bits of the LVT LINT0/1 entries
+    constexpr auto LAPIC_LVT_LINT_MASK{0x0001A7FF_u64};
+    /// @brief defines the writable bits of the LVT error entry
+    constexpr auto LAPIC_LVT_ERROR_MASK{0x000100FF_u64};
+    /// @brief defines the writable bits of the timer divide register
+    constexpr auto LAPIC_TIMER_DCR_MASK{0x0000000B_u64};
+    /// @brief defines the low divide bits of the timer's DCR
+    constexpr auto LAPIC_TIMER_DCR_LO{0x00000003_u64};
+    /// @brief defines the high divide bit of the timer's DCR
+    constexpr auto LAPIC_TIMER_DCR_HI{0x00000008_u64};
+    /// @brief defines the (compacted) DCR encoding for divide by 1
+    constexpr auto LAPIC_TIMER_DCR_DIV1{0x00000007_u64};
+    /// @brief defines the mode bits of the LVT timer register
+    constexpr auto LAPIC_LVT_TIMER_MODE{0x00060000_u64};
+    /// @brief defines the LVT timer's periodic mode
+    constexpr auto LAPIC_TIMER_PERIODIC{0x00020000_u64};
+    /// @brief defines the LVT timer's TSC-deadline mode
+    constexpr auto LAPIC_TIMER_TSC_DEADLINE{0x00040000_u64};
+    /// @brief defines the frequency of the LAPIC's bus clock in kHz (1 GHz, like KVM)
+    constexpr auto LAPIC_BUS_KHZ{1000000_u64};
+    /// @brief defines the maximum value of the timer's initial count
+    constexpr auto LAPIC_TIMER_COUNT_MASK{0xFFFFFFFF_u64};
+
+    /// @brief defines MSR_APIC_BASE's BSP bit
+    constexpr auto LAPIC_BASE_BSP{0x0000000000000100_u64};
+    /// @brief defines MSR_APIC_BASE's global enable bit
+    constexpr auto LAPIC_BASE_ENABLED{0x0000000000000800_u64};
+    /// @brief defines the default physical address of the LAPIC
+    constexpr auto LAPIC_BASE_DEFAULT{0x00000000FEE00000_u64};
+    /// @brief defines the bits of MSR_APIC_BASE that hold the address
+    constexpr auto LAPIC_BASE_ADDR_MASK{0x000FFFFFFFFFF000_u64};
+    /// @brief defines the bits of a GPA that are an offset into the LAPIC
+    constexpr auto LAPIC_PAGE_MASK{0x0000000000000FFF_u64};
+
+    /// @brief defines the number of vectors tracked by the IRR/ISR/TMR
+    constexpr auto LAPIC_NUM_VECTORS{256_u64};
+    /// @brief defines the number of vectors stored per IRR/ISR/TMR register
+    constexpr auto LAPIC_VECTORS_PER_REG{32_u64};
+    /// @brief defines the shift that turns a vector into its register index
+    constexpr auto LAPIC_VECTOR_REG_SHIFT{5_u64};
+    /// @brief defines the shift that turns a register index into its offset
+    constexpr auto LAPIC_REG_INDEX_SHIFT{4_u64};
+    /// @brief defines the shift that turns an offset into a word index
+    constexpr auto LAPIC_WORD_SHIFT{2_u64};
+    /// @brief defines the bits of an offset that select a 16 byte register
+    constexpr auto LAPIC_REG_ALIGN_MASK{0x0000000F_u64};
+
     /// @class microv::emulated_lapic_t
     ///
     /// <!-- description -->
-    ///   @brief Defines MicroV's emulated LAPIC handler.
+    ///   @brief Defines MicroV's emulated LAPIC handler. This is an xAPIC
+    ///     whose registers are stored in the same layout as the first 1k
+    ///     of its MMIO page, which is also the layout used by
+    ///     mv_vs_op_lapic_get_all/set_all (and KVM_GET/SET_LAPIC).
+    ///     Interrupts are accepted into the IRR, so a vector that is
+    ///     raised again before it is injected coalesces instead of taking
+    ///     up another slot, and they are injected in priority order with
+    ///     respect to the ISR and TPR. An EOI of a level triggered vector
+    ///     is reported back to the caller so that the IOAPIC can clear
+    ///     remote IRR. Only fixed IPIs to self are supported.
+    ///
+    ///   @note The timer supports one-shot, periodic and TSC-deadline
+    ///     mode. It is not driven by a host timer. Instead, it remembers
+    ///     the TSC value at which it expires next, and the owning vs_t
+    ///     checks it with timer_expire() on its way into the guest (and
+    ///     arms a hardware timer, when it has one, so that the guest
+    ///     exits when it expires). The bus clock runs at 1 GHz, so the
+    ///     initial count is in nanoseconds times the divide value.
+    ///
+    ///   @note The registers live in a full page so that, when the CPU
+    ///     supports it, the same page can be handed to hardware as the
+    ///     virtual-APIC page (Intel) or AVIC backing page (AMD). When that
+    ///     is the case, the CPU updates the IRR, ISR and TPR on its own,
+    ///     which is why the PPR is always computed instead of trusted.
     ///
     ///   @note IMPORTANT: This class is a per-VS class, and all MMIO/MSR
     ///     accesses from a guest VS must come from this class. There is no
@@ -54,6 +231,390 @@ namespace microv
 
         /// @brief stores the value of MSR_APIC_BASE;
         bsl::safe_u64 m_apic_base{};
+        /// @brief stores the LAPIC's register page
+        hypercall::mv_lapic_state_t *m_regs{};
+        /// @brief stores the SPA of the LAPIC's register page
+        bsl::safe_u64 m_regs_spa{};
+
+        /// @brief stores the frequency of the TSC in kHz
+        bsl::safe_u64 m_tsc_khz{};
+        /// @brief stores the TSC value the timer expires at next (0 if disarmed)
+        bsl::safe_u64 m_timer_deadline{};
+        /// @brief stores the period of the timer in TSC ticks (periodic mode only)
+        bsl::safe_u64 m_timer_period{};
+        /// @brief stores the mode the timer is currently in
+        bsl::safe_u64 m_timer_mode{};
+        /// @brief stores the value of MSR_TSC_DEADLINE
+        bsl::safe_u64 m_tsc_deadline{};
+        /// @brief stores whether or not the timer needs to be restarted
+        bool m_timer_restart{};
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the register at the provided
+        ///     offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param offset the offset of the register to read
+        ///   @return Returns the value of the register at the provided
+        ///     offset.
+        ///
+        [[nodiscard]] constexpr auto
+        reg(bsl::safe_u64 const &offset) const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(nullptr != m_regs);
+
+            auto const *const reg{m_regs->regs.at_if(bsl::to_idx(offset >> LAPIC_WORD_SHIFT))};
+            bsl::expects(nullptr != reg);
+
+            return bsl::to_u64(*reg);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the register at the provided offset.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param offset the offset of the register to write
+        ///   @param val the value to write
+        ///
+        constexpr void
+        set_reg(bsl::safe_u64 const &offset, bsl::safe_u64 const &val) noexcept
+        {
+            bsl::expects(nullptr != m_regs);
+
+            auto *const pmut_reg{m_regs->regs.at_if(bsl::to_idx(offset >> LAPIC_WORD_SHIFT))};
+            bsl::expects(nullptr != pmut_reg);
+
+            *pmut_reg = bsl::to_u32_unsafe(val).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the offset of the IRR/ISR/TMR register that
+        ///     holds the provided vector.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param base the offset of the IRR, ISR or TMR
+        ///   @param vector the vector to locate
+        ///   @return Returns the offset of the register holding the vector
+        ///
+        [[nodiscard]] static constexpr auto
+        vector_reg(bsl::safe_u64 const &base, bsl::safe_u64 const &vector) noexcept
+            -> bsl::safe_u64
+        {
+            return (base + ((vector >> LAPIC_VECTOR_REG_SHIFT) << LAPIC_REG_INDEX_SHIFT)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bit that represents the provided vector in
+        ///     its IRR/ISR/TMR register.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vector the vector to locate
+        ///   @return Returns the bit that represents the provided vector
+        ///
+        [[nodiscard]] static constexpr auto
+        vector_bit(bsl::safe_u64 const &vector) noexcept -> bsl::safe_u64
+        {
+            return 1_u64 << (vector & (LAPIC_VECTORS_PER_REG - 1_u64));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided vector is set in the
+        ///     provided IRR/ISR/TMR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param base the offset of the IRR, ISR or TMR
+        ///   @param vector the vector to test
+        ///   @return Returns true if the provided vector is set
+        ///
+        [[nodiscard]] constexpr auto
+        test_vector(bsl::safe_u64 const &base, bsl::safe_u64 const &vector) const noexcept
+            -> bool
+        {
+            return (this->reg(vector_reg(base, vector)) & vector_bit(vector)).is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets or clears the provided vector in the provided
+        ///     IRR/ISR/TMR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param base the offset of the IRR, ISR or TMR
+        ///   @param vector the vector to set or clear
+        ///   @param set true to set the vector, false to clear it
+        ///
+        constexpr void
+        assign_vector(
+            bsl::safe_u64 const &base, bsl::safe_u64 const &vector, bool const set) noexcept
+        {
+            auto const offset{vector_reg(base, vector)};
+            if (set) {
+                this->set_reg(offset, this->reg(offset) | vector_bit(vector));
+            }
+            else {
+                this->set_reg(offset, this->reg(offset) & ~vector_bit(vector));
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector set in the provided
+        ///     IRR/ISR/TMR, or bsl::safe_u64::failure() if none are set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param base the offset of the IRR, ISR or TMR
+        ///   @return Returns the highest vector set, or
+        ///     bsl::safe_u64::failure() if none are set.
+        ///
+        [[nodiscard]] constexpr auto
+        highest_vector(bsl::safe_u64 const &base) const noexcept -> bsl::safe_u64
+        {
+            constexpr auto num_regs{LAPIC_NUM_VECTORS >> LAPIC_VECTOR_REG_SHIFT};
+
+            for (auto mut_i{num_regs}; mut_i.is_pos(); --mut_i) {
+                auto const idx{mut_i - 1_u64};
+                auto const val{this->reg(base + (idx << LAPIC_REG_INDEX_SHIFT))};
+
+                if (val.is_pos()) {
+                    for (auto mut_bit{LAPIC_VECTORS_PER_REG}; mut_bit.is_pos(); --mut_bit) {
+                        if ((val & (1_u64 << (mut_bit - 1_u64))).is_pos()) {
+                            return ((idx << LAPIC_VECTOR_REG_SHIFT) + (mut_bit - 1_u64)).checked();
+                        }
+
+                        bsl::touch();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return bsl::safe_u64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PPR, computed from the TPR and the highest
+        ///     vector that is in service.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the PPR
+        ///
+        [[nodiscard]] constexpr auto
+        ppr() const noexcept -> bsl::safe_u64
+        {
+            auto const tpr{this->tpr()};
+            auto const isrv{this->highest_vector(LAPIC_REG_ISR)};
+
+            if (isrv.is_invalid()) {
+                return tpr;
+            }
+
+            if ((tpr & LAPIC_PRIORITY_CLASS) >= (isrv & LAPIC_PRIORITY_CLASS)) {
+                return tpr;
+            }
+
+            return isrv & LAPIC_PRIORITY_CLASS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Recomputes the PPR register from the TPR and the
+        ///     highest vector that is in service.
+        ///
+        constexpr void
+        update_ppr() noexcept
+        {
+            this->set_reg(LAPIC_REG_PPR, this->ppr());
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes the highest vector that is in service.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the vector if it was level triggered, in which
+        ///     case the EOI must be forwarded to the IOAPIC, or
+        ///     bsl::safe_u64::failure() otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        eoi() noexcept -> bsl::safe_u64
+        {
+            auto const isrv{this->highest_vector(LAPIC_REG_ISR)};
+            if (isrv.is_invalid()) {
+                return bsl::safe_u64::failure();
+            }
+
+            this->assign_vector(LAPIC_REG_ISR, isrv, false);
+            this->update_ppr();
+
+            if (this->test_vector(LAPIC_REG_TMR, isrv)) {
+                return isrv;
+            }
+
+            return bsl::safe_u64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a write to the low half of the ICR, which
+        ///     sends an IPI.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value being written
+        ///
+        constexpr void
+        icr_write(bsl::safe_u64 const &val) noexcept
+        {
+            this->set_reg(LAPIC_REG_ICR_LO, val & ~LAPIC_DELIVERY_STATUS);
+
+            auto const shorthand{val & LAPIC_ICR_SHORTHAND};
+            auto const dest{this->reg(LAPIC_REG_ICR_HI) >> LAPIC_ID_SHIFT};
+
+            bool mut_self{LAPIC_ICR_SHORTHAND_SELF == shorthand};
+            if (LAPIC_ICR_SHORTHAND_NONE == shorthand) {
+                mut_self = ((val & LAPIC_ICR_DEST_LOGICAL).is_zero()) && (dest == this->id());
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!mut_self || ((val & LAPIC_DELIVERY_MODE) != LAPIC_DELIVERY_FIXED)) {
+                bsl::debug<bsl::V>() << "lapic: unsupported IPI "    // --
+                                     << bsl::hex(val)                // --
+                                     << " to "                       // --
+                                     << bsl::hex(dest)               // --
+                                     << bsl::endl;
+                return;
+            }
+
+            auto const vector{val & LAPIC_VECTOR_MASK};
+            if (vector < LAPIC_MIN_VECTOR) {
+                this->set_reg(LAPIC_REG_ESR, this->reg(LAPIC_REG_ESR) | LAPIC_ESR_SEND_ILLEGAL);
+                return;
+            }
+
+            this->accept(vector, false);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the mode the LVT timer register is set to
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the mode the LVT timer register is set to
+        ///
+        [[nodiscard]] constexpr auto
+        timer_mode() const noexcept -> bsl::safe_u64
+        {
+            return this->reg(LAPIC_REG_LVT_TIMER) & LAPIC_LVT_TIMER_MODE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value the timer's DCR divides the bus
+        ///     clock by.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value the timer's DCR divides the bus
+        ///     clock by.
+        ///
+        [[nodiscard]] constexpr auto
+        timer_divide() const noexcept -> bsl::safe_u64
+        {
+            auto const dcr{this->reg(LAPIC_REG_TIMER_DCR)};
+            auto const div{(dcr & LAPIC_TIMER_DCR_LO) | ((dcr & LAPIC_TIMER_DCR_HI) >> 1_u64)};
+
+            if (LAPIC_TIMER_DCR_DIV1 == div) {
+                return 1_u64;
+            }
+
+            return 1_u64 << (div + 1_u64);
+        }
+
+        /// <!-- description -->
+        ///   @brief Starts (or stops) the timer using the current initial
+        ///     count, DCR and mode, or the current value of
+        ///     MSR_TSC_DEADLINE when in TSC-deadline mode.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current value of the TSC
+        ///
+        constexpr void
+        timer_start(bsl::safe_u64 const &tsc) noexcept
+        {
+            m_timer_mode = this->timer_mode();
+            m_timer_period = {};
+            m_timer_restart = false;
+
+            if (LAPIC_TIMER_TSC_DEADLINE == m_timer_mode) {
+                m_timer_deadline = m_tsc_deadline;
+                return;
+            }
+
+            auto const count{this->reg(LAPIC_REG_TIMER_ICR)};
+            if (count.is_zero()) {
+                m_timer_deadline = {};
+                return;
+            }
+
+            auto mut_ticks{((count * this->timer_divide() * m_tsc_khz) / LAPIC_BUS_KHZ).checked()};
+            if (mut_ticks.is_zero()) {
+                mut_ticks = 1_u64;
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_timer_deadline = (tsc + mut_ticks).checked();
+            if (LAPIC_TIMER_PERIODIC == m_timer_mode) {
+                m_timer_period = mut_ticks;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the timer's current count
+        ///     register, which is what is left of the initial count.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current value of the TSC
+        ///   @return Returns the value of the timer's current count
+        ///     register
+        ///
+        [[nodiscard]] constexpr auto
+        timer_ccr(bsl::safe_u64 const &tsc) const noexcept -> bsl::safe_u64
+        {
+            if (LAPIC_TIMER_TSC_DEADLINE == m_timer_mode) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            if (m_timer_deadline.is_zero() || (tsc >= m_timer_deadline)) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            auto const left{(m_timer_deadline - tsc).checked()};
+            auto const ticks_per_count{(m_tsc_khz * this->timer_divide()).checked()};
+
+            return ((left * LAPIC_BUS_KHZ) / ticks_per_count).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes an LVT entry, keeping it masked while the LAPIC
+        ///     is software disabled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param offset the offset of the LVT entry
+        ///   @param val the value being written
+        ///   @param mask the writable bits of the LVT entry
+        ///
+        constexpr void
+        lvt_write(
+            bsl::safe_u64 const &offset,
+            bsl::safe_u64 const &val,
+            bsl::safe_u64 const &mask) noexcept
+        {
+            if ((this->reg(LAPIC_REG_SVR) & LAPIC_SVR_ENABLED).is_zero()) {
+                this->set_reg(offset, (val & mask) | LAPIC_LVT_MASKED);
+            }
+            else {
+                this->set_reg(offset, val & mask);
+            }
+        }
 
     public:
         /// <!-- description -->
@@ -105,10 +666,58 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            /// NOTE:
+            /// - The register page is not released as pages allocated
+            ///   from the microkernel cannot be freed. It is simply reused
+            ///   the next time this emulated_lapic_t is allocated.
+            ///
+
             m_apic_base = {};
             m_assigned_vsid = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Allocates the page that stores the LAPIC's registers.
+        ///     Pages allocated from the microkernel cannot be freed, so
+        ///     once this emulated_lapic_t has a page, it keeps it and
+        ///     reuses it each time it is allocated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        allocate(syscall::bf_syscall_t &mut_sys) noexcept -> bsl::errc_type
+        {
+            if (nullptr != m_regs) {
+                return bsl::errc_success;
+            }
+
+            m_regs = mut_sys.bf_mem_op_alloc_page<hypercall::mv_lapic_state_t>(m_regs_spa);
+            if (bsl::unlikely(nullptr == m_regs)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the SPA of the page that stores the LAPIC's
+        ///     registers.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the SPA of the page that stores the LAPIC's
+        ///     registers.
+        ///
+        [[nodiscard]] constexpr auto
+        spa() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_regs_spa.is_valid_and_checked());
+            return m_regs_spa;
+        }
+
         /// <!-- description -->
         ///   @brief Returns the ID of the PP associated with this
         ///     emulated_lapic_t
@@ -124,6 +733,141 @@ namespace microv
             return ~m_assigned_vsid;
         }
 
+        /// <!-- description -->
+        ///   @brief Puts the emulated_lapic_t in its power-on state. The
+        ///     LAPIC with APIC ID 0 is the BSP, and like with KVM, its
+        ///     LINT0 is set up for ExtINT so that the PIC works without
+        ///     the guest having to program the LAPIC first.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param apic_id the APIC ID of the LAPIC
+        ///   @param tsc_khz the frequency of the TSC in kHz
+        ///
+        constexpr void
+        reset(bsl::safe_u64 const &apic_id, bsl::safe_u64 const &tsc_khz) noexcept
+        {
+            bsl::expects(apic_id.is_valid_and_checked());
+            bsl::expects(tsc_khz.is_valid_and_checked());
+            bsl::expects(tsc_khz.is_pos());
+            bsl::expects(nullptr != m_regs);
+
+            m_tsc_khz = tsc_khz;
+            m_timer_deadline = {};
+            m_timer_period = {};
+            m_timer_mode = {};
+            m_tsc_deadline = {};
+            m_timer_restart = false;
+
+            *m_regs = {};
+            this->set_reg(LAPIC_REG_ID, apic_id << LAPIC_ID_SHIFT);
+            this->set_reg(LAPIC_REG_VERSION, LAPIC_VERSION);
+            this->set_reg(LAPIC_REG_DFR, LAPIC_DEST_MASK | LAPIC_DFR_RSVD);
+            this->set_reg(LAPIC_REG_SVR, LAPIC_SVR_RESET);
+            this->set_reg(LAPIC_REG_LVT_TIMER, LAPIC_LVT_MASKED);
+            this->set_reg(LAPIC_REG_LVT_THERMAL, LAPIC_LVT_MASKED);
+            this->set_reg(LAPIC_REG_LVT_PMC, LAPIC_LVT_MASKED);
+            this->set_reg(LAPIC_REG_LVT_LINT1, LAPIC_LVT_MASKED);
+            this->set_reg(LAPIC_REG_LVT_ERROR, LAPIC_LVT_MASKED);
+
+            if (apic_id.is_zero()) {
+                this->set_reg(LAPIC_REG_LVT_LINT0, LAPIC_DELIVERY_EXTINT);
+                m_apic_base = LAPIC_BASE_DEFAULT | LAPIC_BASE_ENABLED | LAPIC_BASE_BSP;
+            }
+            else {
+                this->set_reg(LAPIC_REG_LVT_LINT0, LAPIC_LVT_MASKED);
+                m_apic_base = LAPIC_BASE_DEFAULT | LAPIC_BASE_ENABLED;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the APIC ID stored in the ID register
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the APIC ID stored in the ID register
+        ///
+        [[nodiscard]] constexpr auto
+        id() const noexcept -> bsl::safe_u64
+        {
+            return this->reg(LAPIC_REG_ID) >> LAPIC_ID_SHIFT;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TPR
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the TPR
+        ///
+        [[nodiscard]] constexpr auto
+        tpr() const noexcept -> bsl::safe_u64
+        {
+            return this->reg(LAPIC_REG_TPR) & LAPIC_VECTOR_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector in the IRR, or
+        ///     bsl::safe_u64::failure() if the IRR is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the highest vector in the IRR, or
+        ///     bsl::safe_u64::failure() if the IRR is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        irr_vector() const noexcept -> bsl::safe_u64
+        {
+            return this->highest_vector(LAPIC_REG_IRR);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector in the ISR, or
+        ///     bsl::safe_u64::failure() if the ISR is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the highest vector in the ISR, or
+        ///     bsl::safe_u64::failure() if the ISR is empty.
+        ///
+        [[nodiscard]] constexpr auto
+        isr_vector() const noexcept -> bsl::safe_u64
+        {
+            return this->highest_vector(LAPIC_REG_ISR);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided vector is marked as level
+        ///     triggered in the TMR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vector the vector to query
+        ///   @return Returns true if the provided vector is marked as level
+        ///     triggered in the TMR.
+        ///
+        [[nodiscard]] constexpr auto
+        level_triggered(bsl::safe_u64 const &vector) const noexcept -> bool
+        {
+            return this->test_vector(LAPIC_REG_TMR, vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns 64 bits of the TMR, starting with vector
+        ///     idx * 64, which is the layout of Intel's EOI-exit bitmaps.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx which group of 64 vectors to return
+        ///   @return Returns 64 bits of the TMR, starting with vector
+        ///     idx * 64.
+        ///
+        [[nodiscard]] constexpr auto
+        level_vectors(bsl::safe_u64 const &idx) const noexcept -> bsl::safe_u64
+        {
+            constexpr auto regs_per_idx{2_u64};
+            constexpr auto hi_shift{32_u64};
+
+            auto const lo{
+                (LAPIC_REG_TMR + ((idx * regs_per_idx) << LAPIC_REG_INDEX_SHIFT)).checked()};
+            auto const hi{(lo + (1_u64 << LAPIC_REG_INDEX_SHIFT)).checked()};
+
+            return this->reg(lo) | (this->reg(hi) << hi_shift);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the emulated value of MSR_APIC_BASE
         ///
@@ -149,6 +893,489 @@ namespace microv
             bsl::expects(val.is_valid_and_checked());
             m_apic_base = val;
         }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided GPA is in this LAPIC's
+        ///     MMIO page and the LAPIC is globally enabled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address to query
+        ///   @return Returns true if the provided GPA belongs to this LAPIC
+        ///
+        [[nodiscard]] constexpr auto
+        handles(bsl::safe_u64 const &gpa) const noexcept -> bool
+        {
+            if ((m_apic_base & LAPIC_BASE_ENABLED).is_zero()) {
+                return false;
+            }
+
+            return (gpa & ~LAPIC_PAGE_MASK) == (m_apic_base & LAPIC_BASE_ADDR_MASK);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a read from the LAPIC's MMIO page. Only the
+        ///     first 4 bytes of each 16 byte register can be read, the
+        ///     rest of the page reads as 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address being read
+        ///   @param tsc the current value of the TSC
+        ///   @return Returns the value that was read
+        ///
+        [[nodiscard]] constexpr auto
+        read(bsl::safe_u64 const &gpa, bsl::safe_u64 const &tsc) const noexcept -> bsl::safe_u64
+        {
+            auto const offset{gpa & LAPIC_PAGE_MASK};
+            if ((offset >= LAPIC_REGS_SIZE) || (offset & LAPIC_REG_ALIGN_MASK).is_pos()) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            if (LAPIC_REG_PPR == offset) {
+                return this->ppr();
+            }
+
+            if (LAPIC_REG_TIMER_CCR == offset) {
+                return this->timer_ccr(tsc);
+            }
+
+            return this->reg(offset);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a 4 byte write to the LAPIC's MMIO page.
+        ///     Writes to read-only and reserved registers are ignored.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gpa the guest physical address being written
+        ///   @param val the value being written
+        ///   @param tsc the current value of the TSC
+        ///   @return Returns the vector to forward to the IOAPIC if the
+        ///     write was an EOI for a level triggered vector, or
+        ///     bsl::safe_u64::failure() otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        write(
+            bsl::safe_u64 const &gpa, bsl::safe_u64 const &val, bsl::safe_u64 const &tsc) noexcept
+            -> bsl::safe_u64
+        {
+            auto const offset{gpa & LAPIC_PAGE_MASK};
+            if ((offset >= LAPIC_REGS_SIZE) || (offset & LAPIC_REG_ALIGN_MASK).is_pos()) {
+                return bsl::safe_u64::failure();
+            }
+
+            switch (offset.get()) {
+                case LAPIC_REG_ID.get(): {
+                    this->set_reg(offset, val & LAPIC_DEST_MASK);
+                    break;
+                }
+
+                case LAPIC_REG_TPR.get(): {
+                    this->set_reg(offset, val & LAPIC_VECTOR_MASK);
+                    this->update_ppr();
+                    break;
+                }
+
+                case LAPIC_REG_EOI.get(): {
+                    return this->eoi();
+                }
+
+                case LAPIC_REG_LDR.get(): {
+                    this->set_reg(offset, val & LAPIC_DEST_MASK);
+                    break;
+                }
+
+                case LAPIC_REG_DFR.get(): {
+                    this->set_reg(offset, val | LAPIC_DFR_RSVD);
+                    break;
+                }
+
+                case LAPIC_REG_SVR.get(): {
+                    this->set_reg(offset, val & LAPIC_SVR_MASK);
+                    if ((val & LAPIC_SVR_ENABLED).is_zero()) {
+                        for (auto mut_lvt{LAPIC_REG_LVT_TIMER}; mut_lvt <= LAPIC_REG_LVT_ERROR;
+                             mut_lvt += (1_u64 << LAPIC_REG_INDEX_SHIFT)) {
+                            this->set_reg(mut_lvt, this->reg(mut_lvt) | LAPIC_LVT_MASKED);
+                        }
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                    break;
+                }
+
+                case LAPIC_REG_ESR.get(): {
+                    this->set_reg(offset, {});
+                    break;
+                }
+
+                case LAPIC_REG_ICR_LO.get(): {
+                    this->icr_write(val);
+                    break;
+                }
+
+                case LAPIC_REG_ICR_HI.get(): {
+                    this->set_reg(offset, val & LAPIC_DEST_MASK);
+                    break;
+                }
+
+                case LAPIC_REG_LVT_TIMER.get(): {
+                    this->lvt_write(offset, val, LAPIC_LVT_TIMER_MASK);
+
+                    /// NOTE:
+                    /// - Like KVM, switching modes disarms the timer and
+                    ///   clears both the initial count and the deadline.
+                    ///
+
+                    if (this->timer_mode() != m_timer_mode) {
+                        this->set_reg(LAPIC_REG_TIMER_ICR, {});
+                        m_tsc_deadline = {};
+                        this->timer_start(tsc);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                    break;
+                }
+
+                case LAPIC_REG_LVT_THERMAL.get():
+                case LAPIC_REG_LVT_PMC.get(): {
+                    this->lvt_write(offset, val, LAPIC_LVT_NMI_MASK);
+                    break;
+                }
+
+                case LAPIC_REG_LVT_LINT0.get():
+                case LAPIC_REG_LVT_LINT1.get(): {
+                    this->lvt_write(offset, val, LAPIC_LVT_LINT_MASK);
+                    break;
+                }
+
+                case LAPIC_REG_LVT_ERROR.get(): {
+                    this->lvt_write(offset, val, LAPIC_LVT_ERROR_MASK);
+                    break;
+                }
+
+                case LAPIC_REG_TIMER_ICR.get(): {
+                    if (LAPIC_TIMER_TSC_DEADLINE == this->timer_mode()) {
+                        break;
+                    }
+
+                    this->set_reg(offset, val & LAPIC_TIMER_COUNT_MASK);
+                    this->timer_start(tsc);
+                    break;
+                }
+
+                case LAPIC_REG_TIMER_DCR.get(): {
+                    this->set_reg(offset, val & LAPIC_TIMER_DCR_MASK);
+                    break;
+                }
+
+                default: {
+                    bsl::debug<bsl::V>() << "lapic: ignoring write to "    // --
+                                         << bsl::hex(offset)               // --
+                                         << bsl::endl;
+                    break;
+                }
+            }
+
+            return bsl::safe_u64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the TPR. This is the same as a write to the TPR
+        ///     register, and is used for MOV to CR8.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the TPR to
+        ///
+        constexpr void
+        set_tpr(bsl::safe_u64 const &val) noexcept
+        {
+            this->set_reg(LAPIC_REG_TPR, val & LAPIC_VECTOR_MASK);
+            this->update_ppr();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of MSR_TSC_DEADLINE, which is 0
+        ///     unless the timer is armed in TSC-deadline mode.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of MSR_TSC_DEADLINE
+        ///
+        [[nodiscard]] constexpr auto
+        tsc_deadline() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_tsc_deadline.is_valid_and_checked());
+            return m_tsc_deadline;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets MSR_TSC_DEADLINE, which arms the timer when it
+        ///     is in TSC-deadline mode (or disarms it when val is 0).
+        ///     Like a real LAPIC, the write is ignored in any other mode.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set MSR_TSC_DEADLINE to
+        ///
+        constexpr void
+        set_tsc_deadline(bsl::safe_u64 const &val) noexcept
+        {
+            bsl::expects(val.is_valid_and_checked());
+
+            if (LAPIC_TIMER_TSC_DEADLINE != this->timer_mode()) {
+                return;
+            }
+
+            m_tsc_deadline = val;
+            m_timer_deadline = val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the frequency of the TSC the timer counts in. A
+        ///     timer that is already armed keeps its current deadline, and
+        ///     only the timers started after this use the new frequency.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc_khz the frequency of the TSC in kHz
+        ///
+        constexpr void
+        set_tsc_khz(bsl::safe_u64 const &tsc_khz) noexcept
+        {
+            bsl::expects(tsc_khz.is_valid_and_checked());
+            bsl::expects(tsc_khz.is_pos());
+
+            m_tsc_khz = tsc_khz;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TSC value at which the timer expires next,
+        ///     or 0 if the timer is not armed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the TSC value at which the timer expires next,
+        ///     or 0 if the timer is not armed.
+        ///
+        [[nodiscard]] constexpr auto
+        timer_deadline() const noexcept -> bsl::safe_u64 const &
+        {
+            bsl::ensures(m_timer_deadline.is_valid_and_checked());
+            return m_timer_deadline;
+        }
+
+        /// <!-- description -->
+        ///   @brief Checks the timer against the provided TSC value. If it
+        ///     has expired, a periodic timer is re-armed for its next
+        ///     period (periods that were missed coalesce into a single
+        ///     interrupt), and any other timer is disarmed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current value of the TSC
+        ///   @return Returns the vector in the LVT timer register if the
+        ///     timer expired and the LVT is not masked, or
+        ///     bsl::safe_u64::failure() otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        timer_expire(bsl::safe_u64 const &tsc) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(tsc.is_valid_and_checked());
+
+            if (m_timer_restart) {
+                this->timer_start(tsc);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (m_timer_deadline.is_zero() || (tsc < m_timer_deadline)) {
+                return bsl::safe_u64::failure();
+            }
+
+            if (LAPIC_TIMER_PERIODIC == m_timer_mode) {
+                auto const missed{((tsc - m_timer_deadline) / m_timer_period).checked()};
+                auto const next{((missed + 1_u64) * m_timer_period).checked()};
+                m_timer_deadline = (m_timer_deadline + next).checked();
+            }
+            else {
+                m_timer_deadline = {};
+                m_tsc_deadline = {};
+            }
+
+            auto const lvt{this->reg(LAPIC_REG_LVT_TIMER)};
+            if ((lvt & LAPIC_LVT_MASKED).is_pos()) {
+                return bsl::safe_u64::failure();
+            }
+
+            return lvt & LAPIC_VECTOR_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Accepts a fixed interrupt into the IRR. If the vector
+        ///     is already pending, the two interrupts coalesce, the same
+        ///     as with a real LAPIC. Interrupts are dropped while the
+        ///     LAPIC is software disabled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vector the vector to accept
+        ///   @param level true if the interrupt is level triggered
+        ///
+        constexpr void
+        accept(bsl::safe_u64 const &vector, bool const level) noexcept
+        {
+            bsl::expects(vector < LAPIC_NUM_VECTORS);
+
+            if (vector < LAPIC_MIN_VECTOR) {
+                this->set_reg(LAPIC_REG_ESR, this->reg(LAPIC_REG_ESR) | LAPIC_ESR_RECV_ILLEGAL);
+                return;
+            }
+
+            if ((this->reg(LAPIC_REG_SVR) & LAPIC_SVR_ENABLED).is_zero()) {
+                return;
+            }
+
+            this->assign_vector(LAPIC_REG_TMR, vector, level);
+            this->assign_vector(LAPIC_REG_IRR, vector, true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the IRR holds a vector whose priority
+        ///     class is above the PPR, meaning it can be injected once the
+        ///     guest opens its interrupt window.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if an interrupt can be injected
+        ///
+        [[nodiscard]] constexpr auto
+        interrupt_pending() const noexcept -> bool
+        {
+            auto const irrv{this->highest_vector(LAPIC_REG_IRR)};
+            if (irrv.is_invalid()) {
+                return false;
+            }
+
+            return (irrv & LAPIC_PRIORITY_CLASS) > (this->ppr() & LAPIC_PRIORITY_CLASS);
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves the highest vector from the IRR to the ISR, which
+        ///     is what the CPU does when it takes the interrupt. Must only
+        ///     be called when interrupt_pending() returns true.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the vector to inject
+        ///
+        [[nodiscard]] constexpr auto
+        ack() noexcept -> bsl::safe_u64
+        {
+            auto const irrv{this->highest_vector(LAPIC_REG_IRR)};
+            bsl::expects(irrv.is_valid());
+
+            this->assign_vector(LAPIC_REG_IRR, irrv, false);
+            this->assign_vector(LAPIC_REG_ISR, irrv, true);
+            this->update_ppr();
+
+            return irrv;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the guest can be told to skip the EOI
+        ///     of the highest vector in service (KVM's PV EOI). This is
+        ///     only the case when nothing is waiting in the IRR, as the
+        ///     EOI could unblock it, and when the vector is edge
+        ///     triggered, as the EOI of a level triggered vector has to
+        ///     reach the IOAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the guest can skip the next EOI
+        ///
+        [[nodiscard]] constexpr auto
+        pv_eoi_ready() const noexcept -> bool
+        {
+            if (this->highest_vector(LAPIC_REG_IRR).is_valid()) {
+                return false;
+            }
+
+            auto const isrv{this->highest_vector(LAPIC_REG_ISR)};
+            if (isrv.is_invalid()) {
+                return false;
+            }
+
+            return !this->test_vector(LAPIC_REG_TMR, isrv);
+        }
+
+        /// <!-- description -->
+        ///   @brief Completes the highest vector in service on behalf of a
+        ///     guest that skipped its EOI. Must only follow a call to
+        ///     pv_eoi_ready() that returned true.
+        ///
+        constexpr void
+        pv_eoi() noexcept
+        {
+            bsl::discard(this->eoi());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if interrupts from the PIC reach this
+        ///     LAPIC, which is the case when it is globally disabled or
+        ///     when LINT0 is unmasked and programmed for ExtINT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if interrupts from the PIC are accepted
+        ///
+        [[nodiscard]] constexpr auto
+        accepts_extint() const noexcept -> bool
+        {
+            if ((m_apic_base & LAPIC_BASE_ENABLED).is_zero()) {
+                return true;
+            }
+
+            auto const lint0{this->reg(LAPIC_REG_LVT_LINT0)};
+            if ((lint0 & LAPIC_LVT_MASKED).is_pos()) {
+                return false;
+            }
+
+            return (lint0 & LAPIC_DELIVERY_MODE) == LAPIC_DELIVERY_EXTINT;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the LAPIC's registers
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_state where to store the LAPIC's registers
+        ///
+        constexpr void
+        get_all(hypercall::mv_lapic_state_t &mut_state) const noexcept
+        {
+            bsl::expects(nullptr != m_regs);
+            mut_state = *m_regs;
+
+            auto *const pmut_ppr{
+                mut_state.regs.at_if(bsl::to_idx(LAPIC_REG_PPR >> LAPIC_WORD_SHIFT))};
+            bsl::expects(nullptr != pmut_ppr);
+
+            *pmut_ppr = bsl::to_u32_unsafe(this->ppr()).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the LAPIC's registers. The version is read-only
+        ///     and the PPR is recomputed from the new TPR and ISR. The
+        ///     timer is restarted from the new registers the next time it
+        ///     is checked with timer_expire().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param state the registers to set the LAPIC to
+        ///
+        constexpr void
+        set_all(hypercall::mv_lapic_state_t const &state) noexcept
+        {
+            bsl::expects(nullptr != m_regs);
+            *m_regs = state;
+
+            this->set_reg(LAPIC_REG_VERSION, LAPIC_VERSION);
+            this->update_ppr();
+
+            m_timer_mode = this->timer_mode();
+            m_timer_deadline = {};
+            m_timer_restart = true;
+        }
     };
 }
 
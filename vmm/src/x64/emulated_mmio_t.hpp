@@ -30,9 +30,11 @@
 #include <intrinsic_t.hpp>
 #include <l1e_t.hpp>
 #include <map_page_flags.hpp>
+#include <mv_constants.hpp>
 #include <mv_mdl_t.hpp>
 #include <mv_translation_t.hpp>
 #include <page_2m_t.hpp>
+#include <page_pool_t.hpp>
 #include <second_level_page_table_t.hpp>
 #include <tls_t.hpp>
 
@@ -284,6 +286,45 @@ namespace microv
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Maps a single page of MicroV's own memory into this VM.
+        ///     Unlike map(), the SPA is used as is instead of being
+        ///     translated from a root VM GPA.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param gpa the GPA to map the page to
+        ///   @param spa the SPA of the page to map
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        map_page(
+            tls_t const &tls,
+            syscall::bf_syscall_t &mut_sys,
+            page_pool_t &mut_page_pool,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &spa) noexcept -> bsl::errc_type
+        {
+            bsl::expects(!mut_sys.is_vm_the_root_vm(this->assigned_vmid()));
+
+            auto const ret{m_slpt.map(tls, mut_page_pool, gpa, spa, MAP_PAGE_RWE, false, mut_sys)};
+            if (bsl::unlikely(!ret)) {
+                bsl::error() << "failed to map "      // --
+                             << bsl::hex(spa)         // --
+                             << " to "                // --
+                             << bsl::hex(gpa)         // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return ret;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Unmaps memory from this VM using instructions from the
         ///     provided MDL.
@@ -434,6 +475,55 @@ namespace microv
 
             return gpa;
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the system physical address that a guest
+        ///     physical address owned by this VM is mapped to. Unlike
+        ///     gpa_to_spa, this walks this VM's second level page tables
+        ///     for guest VMs, which is what is needed to read guest memory
+        ///     (e.g., instruction bytes) while handling a VMExit. The root
+        ///     VM is identity mapped, so its GPAs are returned as is.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param sys the bf_syscall_t to use
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the GPA to translate to a SPA
+        ///   @return Returns the resulting SPA, or bsl::safe_u64::failure()
+        ///     if the GPA is not mapped into this VM.
+        ///
+        [[nodiscard]] constexpr auto
+        translate_gpa(
+            tls_t const &tls,
+            syscall::bf_syscall_t const &sys,
+            page_pool_t const &page_pool,
+            bsl::safe_u64 const &gpa) const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(this->assigned_vmid() != syscall::BF_INVALID_ID);
+            bsl::expects(gpa.is_valid_and_checked());
+
+            if (sys.is_vm_the_root_vm(this->assigned_vmid())) {
+                return gpa;
+            }
+
+            auto const entries{m_slpt.entries(tls, page_pool, hypercall::mv_page_aligned(gpa))};
+            if (bsl::unlikely(nullptr == entries.l0e)) {
+                bsl::error() << "gpa "                                // --
+                             << bsl::hex(gpa)                         // --
+                             << " is not mapped into vm "             // --
+                             << bsl::hex(this->assigned_vmid())       // --
+                             << bsl::endl                             // --
+                             << bsl::here();                          // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            constexpr auto phys_shft{12_u64};
+            constexpr auto offs_mask{0xFFF_u64};
+
+            auto const spa{bsl::to_u64(entries.l0e->phys) << phys_shft};
+            return (spa | (gpa & offs_mask)).checked();
+        }
     };
 }
 
@@ -28,15 +28,21 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <kvm_para.hpp>
+#include <msr_desc_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the reset value of MISC_ENABLE (BTS/PEBS unavailable)
+    constexpr auto MISC_ENABLE_DEFAULT{0x1800_u64};
+
     /// @class microv::emulated_msr_t
     ///
     /// <!-- description -->
@@ -52,6 +58,17 @@ namespace microv
         /// @brief stores the ID of the VS associated with this emulated_msr_t
         bsl::safe_u16 m_assigned_vsid{};
 
+        /// @brief stores the guest's MCG_STATUS
+        bsl::safe_u64 m_mcg_status{};
+        /// @brief stores the guest's MISC_ENABLE
+        bsl::safe_u64 m_misc_enable{MISC_ENABLE_DEFAULT};
+        /// @brief stores the guest's MSR_KVM_WALL_CLOCK_NEW
+        bsl::safe_u64 m_kvm_wall_clock{};
+        /// @brief stores the guest's MSR_KVM_STEAL_TIME
+        bsl::safe_u64 m_kvm_steal_time{};
+        /// @brief stores the guest's MSR_KVM_PV_EOI_EN
+        bsl::safe_u64 m_kvm_pv_eoi{};
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this emulated_msr_t.
@@ -79,11 +96,9 @@ namespace microv
             bsl::discard(intrinsic);
 
             /// NOTE:
-            /// - Since the MSR permissions map is a global resource due to
-            ///   the limited amount of physically contiguous memory that
-            ///   is required, the initialization of the MSR permission maps
-            ///   is done in gs_initialize. Any MSR ports that need to be
-            ///   trapped, or passed through should be done there.
+            /// - The MSR permissions maps are owned by each vm_t and are
+            ///   generated from MSR_TABLE. Any MSR that needs to be
+            ///   trapped, or passed through should be changed there.
             ///
 
             m_assigned_vsid = ~vsid;
@@ -110,6 +125,7 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vsid = {};
         }
 
@@ -128,6 +144,55 @@ namespace microv
             return ~m_assigned_vsid;
         }
 
+        /// <!-- description -->
+        ///   @brief Resets the emulated MSRs to their power-on values.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_mcg_status = {};
+            m_misc_enable = MISC_ENABLE_DEFAULT;
+            m_kvm_wall_clock = {};
+            m_kvm_steal_time = {};
+            m_kvm_pv_eoi = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the guest's kvm_steal_time, or 0 if
+        ///     the guest has not enabled steal time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the GPA of the guest's kvm_steal_time, or 0 if
+        ///     the guest has not enabled steal time.
+        ///
+        [[nodiscard]] constexpr auto
+        kvm_steal_time_gpa() const noexcept -> bsl::safe_u64
+        {
+            if ((m_kvm_steal_time & KVM_STEAL_TIME_ENABLE).is_zero()) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            return m_kvm_steal_time & ~KVM_STEAL_TIME_ALIGN_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the GPA of the guest's PV EOI word, or 0 if
+        ///     the guest has not enabled PV EOI.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the GPA of the guest's PV EOI word, or 0 if
+        ///     the guest has not enabled PV EOI.
+        ///
+        [[nodiscard]] constexpr auto
+        kvm_pv_eoi_gpa() const noexcept -> bsl::safe_u64
+        {
+            if ((m_kvm_pv_eoi & KVM_PV_EOI_ENABLE).is_zero()) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            return m_kvm_pv_eoi & ~KVM_PV_EOI_ALIGN_MASK;
+        }
+
         /// <!-- description -->
         ///   @brief Get an emulated MSR
         ///
@@ -137,11 +202,39 @@ namespace microv
         ///   @return Returns the value of the emulated MSR. If the MSR isn't
         ///    emulated bsl::safe_u64::failure() is returned instead.
         ///
-        [[nodiscard]] static constexpr auto
-        get(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &msr) noexcept -> bsl::safe_u64
+        [[nodiscard]] constexpr auto
+        get(syscall::bf_syscall_t const &sys, bsl::safe_u64 const &msr) const noexcept
+            -> bsl::safe_u64
         {
             bsl::discard(sys);
-            bsl::discard(msr);
+
+            switch (bsl::to_u32_unsafe(msr).get()) {
+                case MSR_BIOS_SIGN_ID.get(): {
+                    return bsl::safe_u64::magic_0();
+                }
+                case MSR_MCG_CAP.get(): {
+                    return bsl::safe_u64::magic_0();
+                }
+                case MSR_MCG_STATUS.get(): {
+                    return m_mcg_status;
+                }
+                case MSR_MISC_ENABLE.get(): {
+                    return m_misc_enable;
+                }
+                case MSR_KVM_WALL_CLOCK_NEW.get(): {
+                    return m_kvm_wall_clock;
+                }
+                case MSR_KVM_STEAL_TIME.get(): {
+                    return m_kvm_steal_time;
+                }
+                case MSR_KVM_PV_EOI_EN.get(): {
+                    return m_kvm_pv_eoi;
+                }
+
+                default: {
+                    break;
+                }
+            }
 
             return bsl::safe_u64::failure();
         }
@@ -156,14 +249,67 @@ namespace microv
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
-        [[nodiscard]] static constexpr auto
+        [[nodiscard]] constexpr auto
         set(syscall::bf_syscall_t const &sys,
             bsl::safe_u64 const &msr,
             bsl::safe_u64 const &val) noexcept -> bsl::errc_type
         {
             bsl::discard(sys);
-            bsl::discard(msr);
-            bsl::discard(val);
+
+            /// NOTE:
+            /// - Writes to BIOS_SIGN_ID are how a guest asks for the
+            ///   microcode revision to be latched, so they are ignored.
+            ///   MCG_CAP is read-only, and will #GP like it would on
+            ///   hardware with no machine check banks.
+            /// - MSR_KVM_WALL_CLOCK_NEW only holds the GPA the guest
+            ///   asked for. Writing the wall clock itself is done by
+            ///   dispatch_vmexit_wrmsr, which can map guest memory.
+            /// - MSR_KVM_STEAL_TIME and MSR_KVM_PV_EOI_EN also only hold
+            ///   a GPA. The guest memory they point to is read and written
+            ///   by dispatch_vmexit_kvm_pv_helpers on each VMExit/VMEntry.
+            ///   Both structures are naturally aligned, so neither can
+            ///   cross a page boundary once the reserved bits are checked.
+            ///
+
+            switch (bsl::to_u32_unsafe(msr).get()) {
+                case MSR_BIOS_SIGN_ID.get(): {
+                    return bsl::errc_success;
+                }
+                case MSR_MCG_STATUS.get(): {
+                    m_mcg_status = val;
+                    return bsl::errc_success;
+                }
+                case MSR_MISC_ENABLE.get(): {
+                    m_misc_enable = val;
+                    return bsl::errc_success;
+                }
+                case MSR_KVM_WALL_CLOCK_NEW.get(): {
+                    m_kvm_wall_clock = val;
+                    return bsl::errc_success;
+                }
+                case MSR_KVM_STEAL_TIME.get(): {
+                    if (bsl::unlikely((val & KVM_STEAL_TIME_RSVD).is_pos())) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
+                    m_kvm_steal_time = val;
+                    return bsl::errc_success;
+                }
+                case MSR_KVM_PV_EOI_EN.get(): {
+                    if (bsl::unlikely((val & KVM_PV_EOI_RSVD).is_pos())) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
+                    m_kvm_pv_eoi = val;
+                    return bsl::errc_success;
+                }
+
+                default: {
+                    break;
+                }
+            }
 
             return bsl::errc_failure;
         }
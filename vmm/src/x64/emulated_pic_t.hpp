@@ -28,39 +28,565 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <lock_guard_t.hpp>
+#include <spinlock_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the command port of the master PIC
+    constexpr auto PIC_PORT_MASTER_CMD{0x20_u64};
+    /// @brief defines the data port of the master PIC
+    constexpr auto PIC_PORT_MASTER_DATA{0x21_u64};
+    /// @brief defines the command port of the slave PIC
+    constexpr auto PIC_PORT_SLAVE_CMD{0xA0_u64};
+    /// @brief defines the data port of the slave PIC
+    constexpr auto PIC_PORT_SLAVE_DATA{0xA1_u64};
+    /// @brief defines the edge/level control register of the master PIC
+    constexpr auto PIC_PORT_MASTER_ELCR{0x4D0_u64};
+    /// @brief defines the edge/level control register of the slave PIC
+    constexpr auto PIC_PORT_SLAVE_ELCR{0x4D1_u64};
+
+    /// @brief defines the number of pins (and priorities) of a single PIC
+    constexpr auto PIC_NUM_PINS{8_u64};
+    /// @brief defines the number of IRQs provided by the PIC pair
+    constexpr auto PIC_NUM_IRQS{16_u64};
+    /// @brief defines the mask used to wrap a pin/priority
+    constexpr auto PIC_PIN_MASK{0x7_u64};
+    /// @brief defines the master pin the slave is cascaded on
+    constexpr auto PIC_CASCADE_PIN{2_u64};
+    /// @brief defines the mask of a register
+    constexpr auto PIC_REG_MASK{0xFF_u64};
+    /// @brief defines the bits of ICW2 that provide the vector base
+    constexpr auto PIC_VECTOR_BASE_MASK{0xF8_u64};
+    /// @brief defines the ELCR bits of the master that are writable
+    constexpr auto PIC_MASTER_ELCR_MASK{0xF8_u64};
+    /// @brief defines the ELCR bits of the slave that are writable
+    constexpr auto PIC_SLAVE_ELCR_MASK{0xDE_u64};
+
+    /// @brief defines the command bit that identifies ICW1
+    constexpr auto PIC_ICW1{0x10_u64};
+    /// @brief defines the ICW1 bit that states ICW4 will follow
+    constexpr auto PIC_ICW1_ICW4{0x01_u64};
+    /// @brief defines the ICW4 automatic EOI bit
+    constexpr auto PIC_ICW4_AEOI{0x02_u64};
+    /// @brief defines the ICW4 special fully nested mode bit
+    constexpr auto PIC_ICW4_SFNM{0x10_u64};
+    /// @brief defines the command bit that identifies OCW3
+    constexpr auto PIC_OCW3{0x08_u64};
+    /// @brief defines the OCW3 poll command bit
+    constexpr auto PIC_OCW3_POLL{0x04_u64};
+    /// @brief defines the OCW3 read register command bit
+    constexpr auto PIC_OCW3_RR{0x02_u64};
+    /// @brief defines the OCW3 bit that selects the ISR for reads
+    constexpr auto PIC_OCW3_RIS{0x01_u64};
+    /// @brief defines the OCW3 enable special mask mode bit
+    constexpr auto PIC_OCW3_ESMM{0x40_u64};
+    /// @brief defines the OCW3 special mask mode bit
+    constexpr auto PIC_OCW3_SMM{0x20_u64};
+    /// @brief defines the shift of the OCW2 command bits
+    constexpr auto PIC_OCW2_SHIFT{5_u64};
+    /// @brief defines the bit a poll read sets when an IRQ is pending
+    constexpr auto PIC_POLL_IRQ{0x80_u64};
+
+    /// @brief defines the OCW2 rotate in automatic EOI mode (clear) command
+    constexpr auto PIC_OCW2_AEOI_ROTATE_CLEAR{0_u64};
+    /// @brief defines the OCW2 non-specific EOI command
+    constexpr auto PIC_OCW2_EOI{1_u64};
+    /// @brief defines the OCW2 specific EOI command
+    constexpr auto PIC_OCW2_SPECIFIC_EOI{3_u64};
+    /// @brief defines the OCW2 rotate in automatic EOI mode (set) command
+    constexpr auto PIC_OCW2_AEOI_ROTATE_SET{4_u64};
+    /// @brief defines the OCW2 rotate on non-specific EOI command
+    constexpr auto PIC_OCW2_ROTATE_EOI{5_u64};
+    /// @brief defines the OCW2 set priority command
+    constexpr auto PIC_OCW2_SET_PRIORITY{6_u64};
+    /// @brief defines the OCW2 rotate on specific EOI command
+    constexpr auto PIC_OCW2_ROTATE_SPECIFIC_EOI{7_u64};
+
+    /// @brief defines the init state that expects OCW1 (i.e., initialized)
+    constexpr auto PIC_INIT_DONE{0_u64};
+    /// @brief defines the init state that expects ICW2
+    constexpr auto PIC_INIT_ICW2{1_u64};
+    /// @brief defines the init state that expects ICW3
+    constexpr auto PIC_INIT_ICW3{2_u64};
+    /// @brief defines the init state that expects ICW4
+    constexpr auto PIC_INIT_ICW4{3_u64};
+
+    /// @class microv::pic_chip_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the state of a single 8259.
+    ///
+    struct pic_chip_t final
+    {
+        /// @brief stores the interrupt request register
+        bsl::safe_u64 irr;
+        /// @brief stores the interrupt mask register
+        bsl::safe_u64 imr;
+        /// @brief stores the in-service register
+        bsl::safe_u64 isr;
+        /// @brief stores the current level of each pin (edge detection)
+        bsl::safe_u64 last_irr;
+        /// @brief stores the edge/level control register
+        bsl::safe_u64 elcr;
+        /// @brief stores the bits of the ELCR that are writable
+        bsl::safe_u64 elcr_mask;
+        /// @brief stores the vector of pin 0 (from ICW2)
+        bsl::safe_u64 irq_base;
+        /// @brief stores the pin that has the highest priority
+        bsl::safe_u64 priority_add;
+        /// @brief stores which ICW is expected next (PIC_INIT_xxx)
+        bsl::safe_u64 init_state;
+        /// @brief stores whether ICW4 was requested by ICW1
+        bool init4;
+        /// @brief stores whether automatic EOI mode is enabled
+        bool auto_eoi;
+        /// @brief stores whether automatic EOI rotates priorities
+        bool rotate_on_auto_eoi;
+        /// @brief stores whether special fully nested mode is enabled
+        bool special_fully_nested;
+        /// @brief stores whether special mask mode is enabled
+        bool special_mask;
+        /// @brief stores whether reads from the command port return the ISR
+        bool read_isr;
+        /// @brief stores whether the next read is a poll
+        bool poll;
+    };
+
     /// @class microv::emulated_pic_t
     ///
     /// <!-- description -->
-    ///   @brief Defines MicroV's emulated PIC handler.
+    ///   @brief Defines MicroV's emulated PIC handler. This is the
+    ///     master/slave 8259 pair found on a PC (ports 0x20-0x21 and
+    ///     0xA0-0xA1) together with the ELCR (ports 0x4D0-0x4D1). Pins are
+    ///     driven by MicroV's own devices and by guest software through
+    ///     mv_vm_op_irq_line, and the INTR output of the master is
+    ///     acknowledged by the VS that takes the interrupt (the BSP).
     ///
     ///   @note IMPORTANT: This class is a per-VM class. Any IO/MMIO accesses
     ///     to the PIC must come through here. This is only needed by for
-    ///     guest VMs.
+    ///     guest VMs. Since any VS in the VM can use it from any PP, every
+    ///     access is serialized.
     ///
     class emulated_pic_t final
     {
-        /// @brief stores the ID of the VM associated with this emulated_cpuid_t
+        /// @brief stores the ID of the VM associated with this emulated_pic_t
         bsl::safe_u16 m_assigned_vmid{};
+        /// @brief safe guards the PIC's state.
+        mutable spinlock_t m_lock{};
+
+        /// @brief stores the master PIC (IRQ 0-7)
+        pic_chip_t m_master{};
+        /// @brief stores the slave PIC (IRQ 8-15)
+        pic_chip_t m_slave{};
+        /// @brief stores the state of the master's INTR output
+        bool m_output{};
+
+        /// <!-- description -->
+        ///   @brief Drives one of the provided PIC's pins. Edge triggered
+        ///     pins only latch a request on a rising edge while level
+        ///     triggered pins follow the level.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_chip the PIC to drive
+        ///   @param pin the pin to drive
+        ///   @param level the new level of the pin
+        ///
+        static constexpr void
+        set_pin(pic_chip_t &mut_chip, bsl::safe_u64 const &pin, bool const level) noexcept
+        {
+            auto const mask{1_u64 << pin};
+
+            if ((mut_chip.elcr & mask).is_pos()) {
+                if (level) {
+                    mut_chip.irr |= mask;
+                    mut_chip.last_irr |= mask;
+                }
+                else {
+                    mut_chip.irr &= ~mask;
+                    mut_chip.last_irr &= ~mask;
+                }
+
+                return;
+            }
+
+            if (level) {
+                if ((mut_chip.last_irr & mask).is_zero()) {
+                    mut_chip.irr |= mask;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_chip.last_irr |= mask;
+            }
+            else {
+                mut_chip.last_irr &= ~mask;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the priority (0 being the highest) of the
+        ///     highest priority bit set in mask, or PIC_NUM_PINS if no bit
+        ///     is set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param chip the PIC to query
+        ///   @param mask the bits to search
+        ///   @return Returns the priority of the highest priority bit set
+        ///     in mask, or PIC_NUM_PINS if no bit is set.
+        ///
+        [[nodiscard]] static constexpr auto
+        priority(pic_chip_t const &chip, bsl::safe_u64 const &mask) noexcept -> bsl::safe_u64
+        {
+            if (mask.is_zero()) {
+                return PIC_NUM_PINS;
+            }
+
+            bsl::safe_u64 mut_priority{};
+            while ((mask & (1_u64 << ((mut_priority + chip.priority_add) & PIC_PIN_MASK)))
+                       .is_zero()) {
+                ++mut_priority;
+            }
+
+            return mut_priority;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the pin the provided PIC would interrupt the
+        ///     CPU (or the master) with, or bsl::safe_u64::failure() if it
+        ///     has nothing to deliver or the request does not have a
+        ///     higher priority than what is already in service.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param chip the PIC to query
+        ///   @param master true if chip is the master PIC
+        ///   @return Returns the pin the provided PIC would interrupt with,
+        ///     or bsl::safe_u64::failure() if it would not interrupt.
+        ///
+        [[nodiscard]] static constexpr auto
+        get_irq(pic_chip_t const &chip, bool const master) noexcept -> bsl::safe_u64
+        {
+            auto const requested{priority(chip, chip.irr & ~chip.imr)};
+            if (PIC_NUM_PINS == requested) {
+                return bsl::safe_u64::failure();
+            }
+
+            auto mut_isr{chip.isr};
+            if (chip.special_mask) {
+                mut_isr &= ~chip.imr;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (master && chip.special_fully_nested) {
+                mut_isr &= ~(1_u64 << PIC_CASCADE_PIN);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (requested < priority(chip, mut_isr)) {
+                return (requested + chip.priority_add) & PIC_PIN_MASK;
+            }
+
+            return bsl::safe_u64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Performs the part of an interrupt acknowledge cycle
+        ///     that belongs to the provided PIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_chip the PIC to acknowledge
+        ///   @param pin the pin being acknowledged
+        ///
+        static constexpr void
+        intack(pic_chip_t &mut_chip, bsl::safe_u64 const &pin) noexcept
+        {
+            auto const mask{1_u64 << pin};
+
+            if (mut_chip.auto_eoi) {
+                if (mut_chip.rotate_on_auto_eoi) {
+                    mut_chip.priority_add = (pin + 1_u64) & PIC_PIN_MASK;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                mut_chip.isr |= mask;
+            }
+
+            if ((mut_chip.elcr & mask).is_zero()) {
+                mut_chip.irr &= ~mask;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Propagates the slave's output to the master's cascade
+        ///     pin and recomputes the master's INTR output. This must be
+        ///     called after anything that changes the state of a PIC.
+        ///
+        constexpr void
+        update() noexcept
+        {
+            if (get_irq(m_slave, false).is_valid()) {
+                set_pin(m_master, PIC_CASCADE_PIN, true);
+                set_pin(m_master, PIC_CASCADE_PIN, false);
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_output = get_irq(m_master, true).is_valid();
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a write to a PIC's command port (ICW1, OCW2
+        ///     and OCW3).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_chip the PIC to write to
+        ///   @param val the value being written
+        ///
+        static constexpr void
+        write_cmd(pic_chip_t &mut_chip, bsl::safe_u64 const &val) noexcept
+        {
+            if ((val & PIC_ICW1).is_pos()) {
+                mut_chip.init4 = (val & PIC_ICW1_ICW4).is_pos();
+                mut_chip.last_irr = {};
+                mut_chip.irr &= mut_chip.elcr;
+                mut_chip.imr = {};
+                mut_chip.isr = {};
+                mut_chip.priority_add = {};
+                mut_chip.special_mask = {};
+                mut_chip.read_isr = {};
+                mut_chip.poll = {};
+
+                if (!mut_chip.init4) {
+                    mut_chip.special_fully_nested = {};
+                    mut_chip.auto_eoi = {};
+                }
+                else {
+                    bsl::touch();
+                }
+
+                mut_chip.init_state = PIC_INIT_ICW2;
+                return;
+            }
+
+            if ((val & PIC_OCW3).is_pos()) {
+                if ((val & PIC_OCW3_POLL).is_pos()) {
+                    mut_chip.poll = true;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if ((val & PIC_OCW3_RR).is_pos()) {
+                    mut_chip.read_isr = (val & PIC_OCW3_RIS).is_pos();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if ((val & PIC_OCW3_ESMM).is_pos()) {
+                    mut_chip.special_mask = (val & PIC_OCW3_SMM).is_pos();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return;
+            }
+
+            auto const cmd{val >> PIC_OCW2_SHIFT};
+            switch (cmd.get()) {
+                case PIC_OCW2_AEOI_ROTATE_CLEAR.get(): {
+                    mut_chip.rotate_on_auto_eoi = false;
+                    break;
+                }
+
+                case PIC_OCW2_AEOI_ROTATE_SET.get(): {
+                    mut_chip.rotate_on_auto_eoi = true;
+                    break;
+                }
+
+                case PIC_OCW2_EOI.get():
+                case PIC_OCW2_ROTATE_EOI.get(): {
+                    auto const pri{priority(mut_chip, mut_chip.isr)};
+                    if (PIC_NUM_PINS == pri) {
+                        break;
+                    }
+
+                    auto const pin{(pri + mut_chip.priority_add) & PIC_PIN_MASK};
+                    mut_chip.isr &= ~(1_u64 << pin);
+
+                    if (PIC_OCW2_ROTATE_EOI == cmd) {
+                        mut_chip.priority_add = (pin + 1_u64) & PIC_PIN_MASK;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    break;
+                }
+
+                case PIC_OCW2_SPECIFIC_EOI.get(): {
+                    mut_chip.isr &= ~(1_u64 << (val & PIC_PIN_MASK));
+                    break;
+                }
+
+                case PIC_OCW2_SET_PRIORITY.get(): {
+                    mut_chip.priority_add = (val + 1_u64) & PIC_PIN_MASK;
+                    break;
+                }
+
+                case PIC_OCW2_ROTATE_SPECIFIC_EOI.get(): {
+                    auto const pin{val & PIC_PIN_MASK};
+                    mut_chip.isr &= ~(1_u64 << pin);
+                    mut_chip.priority_add = (pin + 1_u64) & PIC_PIN_MASK;
+                    break;
+                }
+
+                default: {
+                    bsl::touch();
+                    break;
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a write to a PIC's data port (OCW1, ICW2, ICW3
+        ///     and ICW4). ICW3 is accepted but ignored as the cascade is
+        ///     fixed to pin 2 of the master.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_chip the PIC to write to
+        ///   @param val the value being written
+        ///
+        static constexpr void
+        write_data(pic_chip_t &mut_chip, bsl::safe_u64 const &val) noexcept
+        {
+            switch (mut_chip.init_state.get()) {
+                case PIC_INIT_ICW2.get(): {
+                    mut_chip.irq_base = val & PIC_VECTOR_BASE_MASK;
+                    mut_chip.init_state = PIC_INIT_ICW3;
+                    break;
+                }
+
+                case PIC_INIT_ICW3.get(): {
+                    if (mut_chip.init4) {
+                        mut_chip.init_state = PIC_INIT_ICW4;
+                    }
+                    else {
+                        mut_chip.init_state = PIC_INIT_DONE;
+                    }
+
+                    break;
+                }
+
+                case PIC_INIT_ICW4.get(): {
+                    mut_chip.special_fully_nested = (val & PIC_ICW4_SFNM).is_pos();
+                    mut_chip.auto_eoi = (val & PIC_ICW4_AEOI).is_pos();
+                    mut_chip.init_state = PIC_INIT_DONE;
+                    break;
+                }
+
+                default: {
+                    mut_chip.imr = val;
+                    break;
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a read from a PIC's command or data port,
+        ///     including the poll command.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_chip the PIC to read from
+        ///   @param master true if mut_chip is the master PIC
+        ///   @param data true if the data port is being read
+        ///   @return Returns the value read
+        ///
+        [[nodiscard]] constexpr auto
+        read_chip(pic_chip_t &mut_chip, bool const master, bool const data) noexcept
+            -> bsl::safe_u64
+        {
+            if (mut_chip.poll) {
+                mut_chip.poll = false;
+
+                auto const pin{get_irq(mut_chip, master)};
+                if (pin.is_invalid()) {
+                    return PIC_PIN_MASK;
+                }
+
+                auto const mask{1_u64 << pin};
+                mut_chip.irr &= ~mask;
+                mut_chip.isr &= ~mask;
+
+                if (!master) {
+                    m_master.irr &= ~(1_u64 << PIC_CASCADE_PIN);
+                    m_master.isr &= ~(1_u64 << PIC_CASCADE_PIN);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return pin | PIC_POLL_IRQ;
+            }
+
+            if (data) {
+                return mut_chip.imr;
+            }
+
+            if (mut_chip.read_isr) {
+                return mut_chip.isr;
+            }
+
+            return mut_chip.irr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PIC pair to its power on state.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_master = {};
+            m_master.elcr_mask = PIC_MASTER_ELCR_MASK;
+            m_slave = {};
+            m_slave.elcr_mask = PIC_SLAVE_ELCR_MASK;
+            m_output = {};
+        }
 
     public:
         /// <!-- description -->
-        ///   @brief Initializes this emulated_cpuid_t.
+        ///   @brief Initializes this emulated_pic_t.
         ///
         /// <!-- inputs/outputs -->
         ///   @param gs the gs_t to use
         ///   @param tls the tls_t to use
         ///   @param sys the bf_syscall_t to use
         ///   @param intrinsic the intrinsic_t to use
-        ///   @param vmid the ID of the VM associated with this emulated_cpuid_t
+        ///   @param vmid the ID of the VM associated with this emulated_pic_t
         ///
         constexpr void
         initialize(
@@ -77,11 +603,12 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vmid = ~vmid;
         }
 
         /// <!-- description -->
-        ///   @brief Release the emulated_cpuid_t.
+        ///   @brief Release the emulated_pic_t.
         ///
         /// <!-- inputs/outputs -->
         ///   @param gs the gs_t to use
@@ -101,16 +628,32 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vmid = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the PIC pair to its power on state. This is
+        ///     called when the VM it belongs to is destroyed so that the
+        ///     next VM does not inherit it's state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///
+        constexpr void
+        deallocate(tls_t const &tls) noexcept
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            this->reset();
+        }
+
         /// <!-- description -->
         ///   @brief Returns the ID of the PP associated with this
-        ///     emulated_cpuid_t
+        ///     emulated_pic_t
         ///
         /// <!-- inputs/outputs -->
         ///   @return Returns the ID of the PP associated with this
-        ///     emulated_cpuid_t
+        ///     emulated_pic_t
         ///
         [[nodiscard]] constexpr auto
         assigned_vmid() const noexcept -> bsl::safe_u16
@@ -118,6 +661,230 @@ namespace microv
             bsl::ensures(m_assigned_vmid.is_valid_and_checked());
             return ~m_assigned_vmid;
         }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided port belongs to this
+        ///     emulated_pic_t, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port to query
+        ///   @return Returns true if the provided port belongs to this
+        ///     emulated_pic_t, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        handles(bsl::safe_u64 const &port) noexcept -> bool
+        {
+            switch (port.get()) {
+                case PIC_PORT_MASTER_CMD.get():
+                case PIC_PORT_MASTER_DATA.get():
+                case PIC_PORT_SLAVE_CMD.get():
+                case PIC_PORT_SLAVE_DATA.get():
+                case PIC_PORT_MASTER_ELCR.get():
+                case PIC_PORT_SLAVE_ELCR.get(): {
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to one of the PIC's ports. Returns
+        ///     false if the access could not be emulated (i.e., it is not
+        ///     a single byte), in which case it has to be handed to the
+        ///     root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write(tls_t const &tls, io_access_t const &access, bsl::safe_u64 const &val) noexcept
+            -> bool
+        {
+            bsl::expects(!access.in);
+            bsl::expects(handles(access.port));
+
+            if (access.string || (1_u64 != access.bytes)) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const byte{val & PIC_REG_MASK};
+            switch (access.port.get()) {
+                case PIC_PORT_MASTER_CMD.get(): {
+                    write_cmd(m_master, byte);
+                    break;
+                }
+
+                case PIC_PORT_MASTER_DATA.get(): {
+                    write_data(m_master, byte);
+                    break;
+                }
+
+                case PIC_PORT_SLAVE_CMD.get(): {
+                    write_cmd(m_slave, byte);
+                    break;
+                }
+
+                case PIC_PORT_SLAVE_DATA.get(): {
+                    write_data(m_slave, byte);
+                    break;
+                }
+
+                case PIC_PORT_MASTER_ELCR.get(): {
+                    m_master.elcr = byte & m_master.elcr_mask;
+                    break;
+                }
+
+                default: {
+                    m_slave.elcr = byte & m_slave.elcr_mask;
+                    break;
+                }
+            }
+
+            this->update();
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from one of the PIC's ports. Returns
+        ///     bsl::safe_u64::failure() if the access could not be
+        ///     emulated (i.e., it is not a single byte), in which case it
+        ///     has to be handed to the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        read(tls_t const &tls, io_access_t const &access) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(access.in);
+            bsl::expects(handles(access.port));
+
+            if (access.string || (1_u64 != access.bytes)) {
+                return bsl::safe_u64::failure();
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            bsl::safe_u64 mut_val{};
+            switch (access.port.get()) {
+                case PIC_PORT_MASTER_CMD.get(): {
+                    mut_val = this->read_chip(m_master, true, false);
+                    break;
+                }
+
+                case PIC_PORT_MASTER_DATA.get(): {
+                    mut_val = this->read_chip(m_master, true, true);
+                    break;
+                }
+
+                case PIC_PORT_SLAVE_CMD.get(): {
+                    mut_val = this->read_chip(m_slave, false, false);
+                    break;
+                }
+
+                case PIC_PORT_SLAVE_DATA.get(): {
+                    mut_val = this->read_chip(m_slave, false, true);
+                    break;
+                }
+
+                case PIC_PORT_MASTER_ELCR.get(): {
+                    mut_val = m_master.elcr;
+                    break;
+                }
+
+                default: {
+                    mut_val = m_slave.elcr;
+                    break;
+                }
+            }
+
+            this->update();
+            return mut_val;
+        }
+
+        /// <!-- description -->
+        ///   @brief Drives one of the PIC pair's IRQ lines (0-15). IRQ 2
+        ///     is the cascade and cannot be driven.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param irq the IRQ line to drive
+        ///   @param level the new level of the IRQ line
+        ///
+        constexpr void
+        set_irq(tls_t const &tls, bsl::safe_u64 const &irq, bool const level) noexcept
+        {
+            bsl::expects(irq < PIC_NUM_IRQS);
+            bsl::expects(irq != PIC_CASCADE_PIN);
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            if (irq < PIC_NUM_PINS) {
+                set_pin(m_master, irq, level);
+            }
+            else {
+                set_pin(m_slave, irq - PIC_NUM_PINS, level);
+            }
+
+            this->update();
+        }
+
+        /// <!-- description -->
+        ///   @brief Performs an interrupt acknowledge cycle and returns the
+        ///     vector the CPU should take. If the PIC pair has nothing to
+        ///     deliver, bsl::safe_u64::failure() is returned. If the slave
+        ///     withdrew its request after the master latched the cascade,
+        ///     the slave's spurious vector (IRQ 15) is returned, the same
+        ///     as real hardware would.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns the vector to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        ack(tls_t const &tls) noexcept -> bsl::safe_u64
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const pin{get_irq(m_master, true)};
+            if (pin.is_invalid()) {
+                return bsl::safe_u64::failure();
+            }
+
+            intack(m_master, pin);
+
+            bsl::safe_u64 mut_vector{};
+            if (PIC_CASCADE_PIN == pin) {
+                auto const slave_pin{get_irq(m_slave, false)};
+                if (slave_pin.is_valid()) {
+                    intack(m_slave, slave_pin);
+                    mut_vector = m_slave.irq_base + slave_pin;
+                }
+                else {
+                    mut_vector = m_slave.irq_base + PIC_PIN_MASK;
+                }
+            }
+            else {
+                mut_vector = m_master.irq_base + pin;
+            }
+
+            this->update();
+            return mut_vector.checked();
+        }
     };
 }
 
@@ -28,28 +28,574 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <lock_guard_t.hpp>
+#include <spinlock_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/ensures.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
 {
+    /// @brief defines the port of the PIT's channel 0
+    constexpr auto PIT_PORT_CH0{0x40_u64};
+    /// @brief defines the port of the PIT's channel 2
+    constexpr auto PIT_PORT_CH2{0x42_u64};
+    /// @brief defines the port of the PIT's mode/command register
+    constexpr auto PIT_PORT_CMD{0x43_u64};
+    /// @brief defines the port of system control port B (speaker/gate 2)
+    constexpr auto PIT_PORT_61{0x61_u64};
+
+    /// @brief defines the frequency of the PIT's input clock in Hz
+    constexpr auto PIT_FREQ_HZ{1193182_u64};
+    /// @brief defines the number of Hz in a KHz
+    constexpr auto PIT_HZ_PER_KHZ{1000_u64};
+    /// @brief defines the number of channels the PIT has
+    constexpr auto PIT_NUM_CHANNELS{3_u64};
+    /// @brief defines the value a count of 0 stands for
+    constexpr auto PIT_MAX_COUNT{0x10000_u64};
+    /// @brief defines the mask of a 16bit count
+    constexpr auto PIT_COUNT_MASK{0xFFFF_u64};
+    /// @brief defines the mask of a byte
+    constexpr auto PIT_BYTE_MASK{0xFF_u64};
+    /// @brief defines the number of bits in a byte
+    constexpr auto PIT_BYTE_SHIFT{8_u64};
+
+    /// @brief defines the access mode that latches the count
+    constexpr auto PIT_ACCESS_LATCH{0_u64};
+    /// @brief defines the access mode that only uses the low byte
+    constexpr auto PIT_ACCESS_LO{1_u64};
+    /// @brief defines the access mode that only uses the high byte
+    constexpr auto PIT_ACCESS_HI{2_u64};
+    /// @brief defines the access mode that uses the low, then high byte
+    constexpr auto PIT_ACCESS_LOHI{3_u64};
+
+    /// @brief defines mode 0 (interrupt on terminal count)
+    constexpr auto PIT_MODE_0{0_u64};
+    /// @brief defines mode 2 (rate generator)
+    constexpr auto PIT_MODE_2{2_u64};
+    /// @brief defines mode 3 (square wave generator)
+    constexpr auto PIT_MODE_3{3_u64};
+
+    /// @brief defines the channel select value of the read-back command
+    constexpr auto PIT_READ_BACK{3_u64};
+
+    /// @brief defines the port 0x61 gate 2 bit
+    constexpr auto PIT_61_GATE2{0x01_u64};
+    /// @brief defines the port 0x61 bits that are read/write
+    constexpr auto PIT_61_RW_MASK{0x0F_u64};
+    /// @brief defines the port 0x61 refresh toggle bit
+    constexpr auto PIT_61_REFRESH{0x10_u64};
+    /// @brief defines the port 0x61 OUT2 bit
+    constexpr auto PIT_61_OUT2{0x20_u64};
+
+    /// @class microv::pit_channel_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the state of a single 8254 channel. The count is
+    ///     never stored. Instead, it is derived from the TSC at which the
+    ///     channel was last (re)loaded.
+    ///
+    struct pit_channel_t final
+    {
+        /// @brief stores the reload value (0 means 0x10000)
+        bsl::safe_u64 reload;
+        /// @brief stores the channel's mode (0-5)
+        bsl::safe_u64 mode;
+        /// @brief stores the channel's access mode (PIT_ACCESS_xxx)
+        bsl::safe_u64 access;
+        /// @brief stores the TSC at which counting started
+        bsl::safe_u64 load_tsc;
+        /// @brief stores the latched count
+        bsl::safe_u64 latch;
+        /// @brief stores the latched status
+        bsl::safe_u64 status;
+        /// @brief stores the low byte of a pending low/high write
+        bsl::safe_u64 write_lo;
+        /// @brief stores the number of interrupts already delivered
+        bsl::safe_u64 irqs;
+        /// @brief stores whether the channel has been given a count
+        bool armed;
+        /// @brief stores whether a count is latched
+        bool latched;
+        /// @brief stores whether the latched count's high byte is next
+        bool latch_hi;
+        /// @brief stores whether a status is latched
+        bool status_latched;
+        /// @brief stores whether the next low/high read is the high byte
+        bool read_hi;
+        /// @brief stores whether the next low/high write is the high byte
+        bool write_hi;
+    };
+
     /// @class microv::emulated_pit_t
     ///
     /// <!-- description -->
-    ///   @brief Defines MicroV's emulated PIC handler.
+    ///   @brief Defines MicroV's emulated PIT handler. This is an 8254
+    ///     with three channels (ports 0x40-0x43) and the channel 2 gate
+    ///     and output found on port 0x61. Counts are derived from the TSC
+    ///     so that reading a counter never has to leave MicroV, and
+    ///     channel 0 reports when it owes the guest an interrupt (IRQ0).
+    ///     BCD counting is not supported.
     ///
     ///   @note IMPORTANT: This class is a per-VM class. Any IO/MMIO accesses
-    ///     to the PIC must come through here. This is only needed by for
-    ///     guest VMs.
+    ///     to the PIT must come through here. This is only needed by for
+    ///     guest VMs. Since any VS in the VM can use it from any PP, every
+    ///     access is serialized.
     ///
     class emulated_pit_t final
     {
         /// @brief stores the ID of the VM associated with this emulated_pit_t
         bsl::safe_u16 m_assigned_vmid{};
+        /// @brief safe guards the PIT's state.
+        mutable spinlock_t m_lock{};
+
+        /// @brief stores the PIT's channels
+        bsl::array<pit_channel_t, PIT_NUM_CHANNELS.get()> m_channels{};
+        /// @brief stores the read/write bits of port 0x61
+        bsl::safe_u64 m_port61{};
+        /// @brief stores the refresh toggle reported by port 0x61
+        bsl::safe_u64 m_refresh{};
+
+        /// <!-- description -->
+        ///   @brief Returns the number of PIT clocks that have elapsed since
+        ///     the provided channel was loaded.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the channel to query
+        ///   @param tsc_khz the TSC frequency in KHz
+        ///   @param tsc the current TSC
+        ///   @return Returns the number of PIT clocks that have elapsed
+        ///     since the provided channel was loaded.
+        ///
+        [[nodiscard]] static constexpr auto
+        elapsed(
+            pit_channel_t const &ch,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc) noexcept -> bsl::safe_u64
+        {
+            if (tsc <= ch.load_tsc) {
+                return {};
+            }
+
+            /// NOTE:
+            /// - The division is split in two so that the multiplication
+            ///   cannot overflow no matter how long the channel has been
+            ///   running.
+            ///
+
+            auto const delta{(tsc - ch.load_tsc).checked()};
+            auto const whole{((delta / tsc_khz) * PIT_FREQ_HZ).checked()};
+            auto const part{(((delta % tsc_khz) * PIT_FREQ_HZ) / tsc_khz).checked()};
+
+            return ((whole + part) / PIT_HZ_PER_KHZ).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of PIT clocks in one period of the
+        ///     provided channel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the channel to query
+        ///   @return Returns the number of PIT clocks in one period of the
+        ///     provided channel.
+        ///
+        [[nodiscard]] static constexpr auto
+        period(pit_channel_t const &ch) noexcept -> bsl::safe_u64
+        {
+            if (ch.reload.is_zero()) {
+                return PIT_MAX_COUNT;
+            }
+
+            return ch.reload;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided channel runs periodically
+        ///     (modes 2 and 3), false if it is a one shot.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the channel to query
+        ///   @return Returns true if the provided channel runs periodically
+        ///
+        [[nodiscard]] static constexpr auto
+        periodic(pit_channel_t const &ch) noexcept -> bool
+        {
+            return (PIT_MODE_2 == ch.mode) || (PIT_MODE_3 == ch.mode);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided channel is counting.
+        ///     Channel 2 only counts while its gate (port 0x61) is high.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ch the channel to query
+        ///   @param idx the index of the channel
+        ///   @return Returns true if the provided channel is counting.
+        ///
+        [[nodiscard]] constexpr auto
+        counting(pit_channel_t const &ch, bsl::safe_idx const &idx) const noexcept -> bool
+        {
+            constexpr auto ch2{2_idx};
+            if (!ch.armed) {
+                return false;
+            }
+
+            if (ch2 == idx) {
+                return (m_port61 & PIT_61_GATE2).is_pos();
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the current count of the provided channel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the channel
+        ///   @param tsc_khz the TSC frequency in KHz
+        ///   @param tsc the current TSC
+        ///   @return Returns the current count of the provided channel.
+        ///
+        [[nodiscard]] constexpr auto
+        count(
+            bsl::safe_idx const &idx,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc) const noexcept -> bsl::safe_u64
+        {
+            auto const *const ch{m_channels.at_if(idx)};
+            if (!this->counting(*ch, idx)) {
+                return ch->reload;
+            }
+
+            auto const n{period(*ch)};
+            auto const t{elapsed(*ch, tsc_khz, tsc)};
+
+            if (PIT_MODE_3 == ch->mode) {
+                return ((n - ((t * 2_u64) % n)).checked() & PIT_COUNT_MASK);
+            }
+
+            if (PIT_MODE_2 == ch->mode) {
+                return ((n - (t % n)).checked() & PIT_COUNT_MASK);
+            }
+
+            /// NOTE:
+            /// - One shot modes keep counting down (and wrap) after they
+            ///   reach their terminal count.
+            ///
+
+            return ((n + PIT_MAX_COUNT) - (t % PIT_MAX_COUNT)).checked() & PIT_COUNT_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the output pin of the provided channel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the channel
+        ///   @param tsc_khz the TSC frequency in KHz
+        ///   @param tsc the current TSC
+        ///   @return Returns the output pin of the provided channel.
+        ///
+        [[nodiscard]] constexpr auto
+        out(bsl::safe_idx const &idx,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc) const noexcept -> bool
+        {
+            auto const *const ch{m_channels.at_if(idx)};
+            if (!this->counting(*ch, idx)) {
+                return PIT_MODE_0 != ch->mode;
+            }
+
+            auto const n{period(*ch)};
+            auto const t{elapsed(*ch, tsc_khz, tsc)};
+
+            if (PIT_MODE_3 == ch->mode) {
+                return (t % n) < ((n + 1_u64) / 2_u64);
+            }
+
+            if (PIT_MODE_2 == ch->mode) {
+                return (t % n) != (n - 1_u64);
+            }
+
+            if (PIT_MODE_0 == ch->mode) {
+                return t >= n;
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief (Re)starts counting on the provided channel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_ch the channel to load
+        ///   @param reload the new reload value
+        ///   @param tsc the current TSC
+        ///
+        static constexpr void
+        load(pit_channel_t &mut_ch, bsl::safe_u64 const &reload, bsl::safe_u64 const &tsc) noexcept
+        {
+            mut_ch.reload = reload & PIT_COUNT_MASK;
+            mut_ch.load_tsc = tsc;
+            mut_ch.irqs = {};
+            mut_ch.armed = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a write to the mode/command register.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value being written
+        ///   @param tsc_khz the TSC frequency in KHz
+        ///   @param tsc the current TSC
+        ///
+        constexpr void
+        write_cmd(
+            bsl::safe_u64 const &val,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc) noexcept
+        {
+            constexpr auto sel_shift{6_u64};
+            constexpr auto access_shift{4_u64};
+            constexpr auto access_mask{0x3_u64};
+            constexpr auto mode_shift{1_u64};
+            constexpr auto mode_mask{0x7_u64};
+            constexpr auto mode_max{0x5_u64};
+            constexpr auto mode_mirror{0x3_u64};
+
+            auto const sel{(val >> sel_shift) & access_mask};
+            auto const access{(val >> access_shift) & access_mask};
+
+            if (PIT_READ_BACK == sel) {
+                this->read_back(val, tsc_khz, tsc);
+                return;
+            }
+
+            auto *const pmut_ch{m_channels.at_if(bsl::to_idx(sel))};
+            if (PIT_ACCESS_LATCH == access) {
+                if (!pmut_ch->latched) {
+                    pmut_ch->latch = this->count(bsl::to_idx(sel), tsc_khz, tsc);
+                    pmut_ch->latched = true;
+                    pmut_ch->latch_hi = false;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return;
+            }
+
+            /// NOTE:
+            /// - Modes 6 and 7 are aliases of modes 2 and 3.
+            ///
+
+            auto mut_mode{(val >> mode_shift) & mode_mask};
+            if (mut_mode > mode_max) {
+                mut_mode &= mode_mirror;
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_ch->mode = mut_mode;
+            pmut_ch->access = access;
+            pmut_ch->armed = false;
+            pmut_ch->latched = false;
+            pmut_ch->status_latched = false;
+            pmut_ch->read_hi = false;
+            pmut_ch->write_hi = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles the read-back command.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value being written
+        ///   @param tsc_khz the TSC frequency in KHz
+        ///   @param tsc the current TSC
+        ///
+        constexpr void
+        read_back(
+            bsl::safe_u64 const &val,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc) noexcept
+        {
+            constexpr auto no_count{0x20_u64};
+            constexpr auto no_status{0x10_u64};
+            constexpr auto status_out{0x80_u64};
+            constexpr auto status_null{0x40_u64};
+            constexpr auto access_shift{4_u64};
+            constexpr auto mode_shift{1_u64};
+
+            bsl::safe_u64 mut_select{0x2_u64};
+            for (bsl::safe_idx mut_i{}; mut_i < m_channels.size(); ++mut_i) {
+                auto const selected{(val & mut_select).is_pos()};
+                mut_select <<= 1_u64;
+
+                if (!selected) {
+                    continue;
+                }
+
+                auto *const pmut_ch{m_channels.at_if(mut_i)};
+                if ((val & no_count).is_zero() && !pmut_ch->latched) {
+                    pmut_ch->latch = this->count(mut_i, tsc_khz, tsc);
+                    pmut_ch->latched = true;
+                    pmut_ch->latch_hi = false;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if ((val & no_status).is_zero() && !pmut_ch->status_latched) {
+                    bsl::safe_u64 mut_status{
+                        (pmut_ch->access << access_shift) | (pmut_ch->mode << mode_shift)};
+
+                    if (this->out(mut_i, tsc_khz, tsc)) {
+                        mut_status |= status_out;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    if (!pmut_ch->armed) {
+                        mut_status |= status_null;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    pmut_ch->status = mut_status;
+                    pmut_ch->status_latched = true;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a read from one of the channel ports.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the channel
+        ///   @param tsc_khz the TSC frequency in KHz
+        ///   @param tsc the current TSC
+        ///   @return Returns the value read
+        ///
+        [[nodiscard]] constexpr auto
+        read_channel(
+            bsl::safe_idx const &idx,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc) noexcept -> bsl::safe_u64
+        {
+            auto *const pmut_ch{m_channels.at_if(idx)};
+
+            if (pmut_ch->status_latched) {
+                pmut_ch->status_latched = false;
+                return pmut_ch->status;
+            }
+
+            bsl::safe_u64 mut_count{};
+            if (pmut_ch->latched) {
+                mut_count = pmut_ch->latch;
+            }
+            else {
+                mut_count = this->count(idx, tsc_khz, tsc);
+            }
+
+            bool mut_hi{};
+            bool mut_done{true};
+            if (PIT_ACCESS_HI == pmut_ch->access) {
+                mut_hi = true;
+            }
+            else if (PIT_ACCESS_LOHI == pmut_ch->access) {
+                if (pmut_ch->latched) {
+                    mut_hi = pmut_ch->latch_hi;
+                    mut_done = mut_hi;
+                    pmut_ch->latch_hi = !mut_hi;
+                }
+                else {
+                    mut_hi = pmut_ch->read_hi;
+                    pmut_ch->read_hi = !mut_hi;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (pmut_ch->latched && mut_done) {
+                pmut_ch->latched = false;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_hi) {
+                return (mut_count >> PIT_BYTE_SHIFT) & PIT_BYTE_MASK;
+            }
+
+            return mut_count & PIT_BYTE_MASK;
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles a write to one of the channel ports.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the channel
+        ///   @param val the value being written
+        ///   @param tsc the current TSC
+        ///
+        constexpr void
+        write_channel(
+            bsl::safe_idx const &idx, bsl::safe_u64 const &val, bsl::safe_u64 const &tsc) noexcept
+        {
+            auto *const pmut_ch{m_channels.at_if(idx)};
+            auto const byte{val & PIT_BYTE_MASK};
+
+            if (PIT_ACCESS_LO == pmut_ch->access) {
+                load(*pmut_ch, byte, tsc);
+                return;
+            }
+
+            if (PIT_ACCESS_HI == pmut_ch->access) {
+                load(*pmut_ch, byte << PIT_BYTE_SHIFT, tsc);
+                return;
+            }
+
+            if (!pmut_ch->write_hi) {
+                pmut_ch->write_lo = byte;
+                pmut_ch->write_hi = true;
+                return;
+            }
+
+            pmut_ch->write_hi = false;
+            load(*pmut_ch, pmut_ch->write_lo | (byte << PIT_BYTE_SHIFT), tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PIT to its power on state.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            for (auto &mut_ch : m_channels) {
+                mut_ch = {};
+                mut_ch.access = PIT_ACCESS_LOHI;
+            }
+
+            m_port61 = {};
+            m_refresh = {};
+        }
 
     public:
         /// <!-- description -->
@@ -77,6 +623,7 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vmid = ~vmid;
         }
 
@@ -101,9 +648,25 @@ namespace microv
             bsl::discard(sys);
             bsl::discard(intrinsic);
 
+            this->reset();
             m_assigned_vmid = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the PIT to its power on state. This is called
+        ///     when the VM it belongs to is destroyed so that the next VM
+        ///     does not inherit it's state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///
+        constexpr void
+        deallocate(tls_t const &tls) noexcept
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            this->reset();
+        }
+
         /// <!-- description -->
         ///   @brief Returns the ID of the PP associated with this
         ///     emulated_pit_t
@@ -118,6 +681,239 @@ namespace microv
             bsl::ensures(m_assigned_vmid.is_valid_and_checked());
             return ~m_assigned_vmid;
         }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided port belongs to this
+        ///     emulated_pit_t, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port to query
+        ///   @return Returns true if the provided port belongs to this
+        ///     emulated_pit_t, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        handles(bsl::safe_u64 const &port) noexcept -> bool
+        {
+            if (PIT_PORT_61 == port) {
+                return true;
+            }
+
+            return (port >= PIT_PORT_CH0) && (port <= PIT_PORT_CMD);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to one of the PIT's ports. Returns
+        ///     false if the access could not be emulated (i.e., it is not
+        ///     a single byte), in which case it has to be handed to the
+        ///     root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            io_access_t const &access,
+            bsl::safe_u64 const &val) noexcept -> bool
+        {
+            bsl::expects(!access.in);
+            bsl::expects(handles(access.port));
+            bsl::expects(tsc_khz.is_pos());
+
+            if (access.string || (1_u64 != access.bytes)) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            if (PIT_PORT_61 == access.port) {
+                auto const gate{(val & PIT_61_GATE2).is_pos()};
+                auto const was{(m_port61 & PIT_61_GATE2).is_pos()};
+
+                /// NOTE:
+                /// - A rising edge on the gate restarts channel 2. For
+                ///   mode 0 and 4 this should resume the count instead,
+                ///   which no software that we know of relies on.
+                ///
+
+                if (gate && !was) {
+                    m_channels.at_if(2_idx)->load_tsc = tsc;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                m_port61 = val & PIT_61_RW_MASK;
+                return true;
+            }
+
+            if (PIT_PORT_CMD == access.port) {
+                this->write_cmd(val, tsc_khz, tsc);
+                return true;
+            }
+
+            this->write_channel(bsl::to_idx(access.port - PIT_PORT_CH0), val, tsc);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from one of the PIT's ports. Returns
+        ///     bsl::safe_u64::failure() if the access could not be
+        ///     emulated (i.e., it is not a single byte), in which case it
+        ///     has to be handed to the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param access the port IO access to emulate
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        read(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            io_access_t const &access) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(access.in);
+            bsl::expects(handles(access.port));
+            bsl::expects(tsc_khz.is_pos());
+
+            if (access.string || (1_u64 != access.bytes)) {
+                return bsl::safe_u64::failure();
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            if (PIT_PORT_61 == access.port) {
+                m_refresh ^= PIT_61_REFRESH;
+
+                bsl::safe_u64 mut_val{m_port61 | m_refresh};
+                if (this->out(2_idx, tsc_khz, tsc)) {
+                    mut_val |= PIT_61_OUT2;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return mut_val;
+            }
+
+            if (PIT_PORT_CMD == access.port) {
+                return PIT_BYTE_MASK;
+            }
+
+            return this->read_channel(bsl::to_idx(access.port - PIT_PORT_CH0), tsc_khz, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if channel 0 has produced a tick (an edge
+        ///     on IRQ0) that has not been acknowledged yet and marks it as
+        ///     acknowledged. Periodic ticks that were missed are coalesced
+        ///     into a single edge, the same as a real PIC would do.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @return Returns true if IRQ0 should be pulsed, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        ack_irq(
+            tls_t const &tls, bsl::safe_u64 const &tsc_khz, bsl::safe_u64 const &tsc) noexcept
+            -> bool
+        {
+            bsl::expects(tsc_khz.is_pos());
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto *const pmut_ch{m_channels.at_if(0_idx)};
+            if (!pmut_ch->armed) {
+                return false;
+            }
+
+            auto const t{elapsed(*pmut_ch, tsc_khz, tsc)};
+
+            bsl::safe_u64 mut_irqs{};
+            if (periodic(*pmut_ch)) {
+                mut_irqs = t / period(*pmut_ch);
+            }
+            else if (t >= period(*pmut_ch)) {
+                mut_irqs = 1_u64;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_irqs <= pmut_ch->irqs) {
+                return false;
+            }
+
+            pmut_ch->irqs = mut_irqs;
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of nanoseconds until channel 0
+        ///     produces its next tick on IRQ0, 0 if it has produced one
+        ///     that has not been acknowledged yet, or
+        ///     bsl::safe_u64::max_value() if it will not produce one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @return Returns the number of nanoseconds until channel 0
+        ///     produces its next tick on IRQ0.
+        ///
+        [[nodiscard]] constexpr auto
+        irq_ns(
+            tls_t const &tls, bsl::safe_u64 const &tsc_khz, bsl::safe_u64 const &tsc) const noexcept
+            -> bsl::safe_u64
+        {
+            constexpr auto ns_per_s{1000000000_u64};
+            bsl::expects(tsc_khz.is_pos());
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const *const ch{m_channels.at_if(0_idx)};
+            if (!ch->armed) {
+                return bsl::safe_u64::max_value();
+            }
+
+            auto const n{period(*ch)};
+            auto const t{elapsed(*ch, tsc_khz, tsc)};
+
+            bsl::safe_u64 mut_next{n};
+            if (periodic(*ch)) {
+                auto const irqs{(t / n).checked()};
+                if (irqs > ch->irqs) {
+                    return {};
+                }
+
+                mut_next = ((irqs + 1_u64) * n).checked();
+            }
+            else if (!ch->irqs.is_zero()) {
+                return bsl::safe_u64::max_value();
+            }
+            else if (t >= n) {
+                return {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            return (((mut_next - t) * ns_per_s) / PIT_FREQ_HZ).checked();
+        }
     };
 }
 
@@ -0,0 +1,587 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef EMULATED_UART_T_HPP
+#define EMULATED_UART_T_HPP
+
+#include <bf_syscall_t.hpp>
+#include <gs_t.hpp>
+#include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <lock_guard_t.hpp>
+#include <mv_exit_io_t.hpp>
+#include <spinlock_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/ensures.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// @brief defines the base port of the emulated UART (COM1)
+    constexpr auto UART_PORT_BASE{0x3F8_u64};
+    /// @brief defines the last port of the emulated UART (COM1)
+    constexpr auto UART_PORT_LAST{0x3FF_u64};
+    /// @brief defines the Bochs/QEMU debug console port
+    constexpr auto UART_PORT_E9{0xE9_u64};
+
+    /// @brief defines the RBR/THR/DLL register offset
+    constexpr auto UART_REG_DATA{0x0_u64};
+    /// @brief defines the IER/DLM register offset
+    constexpr auto UART_REG_IER{0x1_u64};
+    /// @brief defines the IIR/FCR register offset
+    constexpr auto UART_REG_IIR{0x2_u64};
+    /// @brief defines the LCR register offset
+    constexpr auto UART_REG_LCR{0x3_u64};
+    /// @brief defines the MCR register offset
+    constexpr auto UART_REG_MCR{0x4_u64};
+    /// @brief defines the LSR register offset
+    constexpr auto UART_REG_LSR{0x5_u64};
+    /// @brief defines the MSR register offset
+    constexpr auto UART_REG_MSR{0x6_u64};
+    /// @brief defines the SCR register offset
+    constexpr auto UART_REG_SCR{0x7_u64};
+
+    /// @brief defines the IER bits that are implemented
+    constexpr auto UART_IER_MASK{0x0F_u8};
+    /// @brief defines the IER "THR empty" interrupt enable bit
+    constexpr auto UART_IER_ETBEI{0x02_u8};
+    /// @brief defines the IIR value when no interrupt is pending
+    constexpr auto UART_IIR_NO_INT{0x01_u8};
+    /// @brief defines the IIR value for a "THR empty" interrupt
+    constexpr auto UART_IIR_THRI{0x02_u8};
+    /// @brief defines the IIR bits reporting that the FIFOs are enabled
+    constexpr auto UART_IIR_FIFO{0xC0_u8};
+    /// @brief defines the FCR FIFO enable bit
+    constexpr auto UART_FCR_ENABLE{0x01_u8};
+    /// @brief defines the LCR divisor latch access bit
+    constexpr auto UART_LCR_DLAB{0x80_u8};
+    /// @brief defines the MCR bits that are implemented
+    constexpr auto UART_MCR_MASK{0x1F_u8};
+    /// @brief defines the MCR loopback bit
+    constexpr auto UART_MCR_LOOP{0x10_u8};
+    /// @brief defines the LSR value of an idle transmitter (THRE | TEMT)
+    constexpr auto UART_LSR_IDLE{0x60_u8};
+    /// @brief defines the MSR value of a connected line (DCD | DSR | CTS)
+    constexpr auto UART_MSR_CONNECTED{0xB0_u8};
+    /// @brief defines the value returned when port 0xE9 is read
+    constexpr auto UART_E9_READBACK{0xE9_u8};
+
+    /// @class microv::emulated_uart_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines MicroV's emulated 16550 UART (COM1) and debug port
+    ///     (0xE9) handler. Transmitted bytes are buffered and handed to the
+    ///     root VM in a single string OUT once the buffer is full, or
+    ///     before any access that only the root VM can complete (i.e.,
+    ///     reading the receive buffer). Everything else (IER, IIR, LCR,
+    ///     MCR, LSR, MSR, SCR and the divisor latch) is emulated here.
+    ///
+    ///   @note IMPORTANT: This class is a per-VM class and can be used by
+    ///     any VS assigned to the VM, from any PP, which is why every
+    ///     access is serialized.
+    ///
+    class emulated_uart_t final
+    {
+        /// @brief stores the ID of the VM associated with this emulated_uart_t
+        bsl::safe_u16 m_assigned_vmid{};
+        /// @brief safe guards the UART's state.
+        mutable spinlock_t m_lock{};
+
+        /// @brief stores the transmitted bytes that have not been flushed
+        bsl::array<bsl::uint8, hypercall::MV_EXIT_IO_MAX_BUF_SIZE.get()> m_tx{};
+        /// @brief stores the number of bytes in m_tx
+        bsl::safe_u64 m_tx_size{};
+        /// @brief stores the port the bytes in m_tx were written to
+        bsl::safe_u64 m_tx_port{};
+
+        /// @brief stores the divisor latch (low byte)
+        bsl::safe_u8 m_dll{};
+        /// @brief stores the divisor latch (high byte)
+        bsl::safe_u8 m_dlm{};
+        /// @brief stores the interrupt enable register
+        bsl::safe_u8 m_ier{};
+        /// @brief stores the FIFO control register
+        bsl::safe_u8 m_fcr{};
+        /// @brief stores the line control register
+        bsl::safe_u8 m_lcr{};
+        /// @brief stores the modem control register
+        bsl::safe_u8 m_mcr{};
+        /// @brief stores the scratch register
+        bsl::safe_u8 m_scr{};
+        /// @brief stores whether a "THR empty" interrupt is latched
+        bool m_thri{};
+
+        /// <!-- description -->
+        ///   @brief Returns true if the divisor latch is being accessed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the divisor latch is being accessed.
+        ///
+        [[nodiscard]] constexpr auto
+        dlab() const noexcept -> bool
+        {
+            return (m_lcr & UART_LCR_DLAB).is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a byte to the transmit buffer. Returns false if
+        ///     the buffer is full, or holds bytes for a different port,
+        ///     in which case it has to be flushed first.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port the byte was written to
+        ///   @param val the byte to add
+        ///   @return Returns true if the byte was buffered, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        tx_push(bsl::safe_u64 const &port, bsl::safe_u64 const &val) noexcept -> bool
+        {
+            if (m_tx_size.is_zero()) {
+                m_tx_port = port;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (m_tx_port != port) {
+                return false;
+            }
+
+            if (m_tx_size >= m_tx.size()) {
+                return false;
+            }
+
+            *m_tx.at_if(bsl::to_idx(m_tx_size)) = bsl::to_u8_unsafe(val);
+            ++m_tx_size;
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the current value of the IIR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current value of the IIR.
+        ///
+        [[nodiscard]] constexpr auto
+        iir() const noexcept -> bsl::safe_u8
+        {
+            bsl::safe_u8 mut_iir{UART_IIR_NO_INT};
+            if (m_thri && (m_ier & UART_IER_ETBEI).is_pos()) {
+                mut_iir = UART_IIR_THRI;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if ((m_fcr & UART_FCR_ENABLE).is_pos()) {
+                mut_iir |= UART_IIR_FIFO;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_iir;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the current value of the MSR.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current value of the MSR.
+        ///
+        [[nodiscard]] constexpr auto
+        msr() const noexcept -> bsl::safe_u8
+        {
+            constexpr auto shift{4_u8};
+            constexpr auto modem_bits{0x0F_u8};
+
+            /// NOTE:
+            /// - In loopback mode, DTR/RTS/OUT1/OUT2 are wired to
+            ///   DSR/CTS/RI/DCD (which happens to be a simple shift).
+            ///
+
+            if ((m_mcr & UART_MCR_LOOP).is_pos()) {
+                return ((m_mcr & modem_bits) << shift).checked();
+            }
+
+            return UART_MSR_CONNECTED;
+        }
+
+        /// <!-- description -->
+        ///   @brief Resets the UART's registers and drops any buffered
+        ///     bytes.
+        ///
+        constexpr void
+        reset() noexcept
+        {
+            m_tx_size = {};
+            m_tx_port = {};
+            m_dll = {};
+            m_dlm = {};
+            m_ier = {};
+            m_fcr = {};
+            m_lcr = {};
+            m_mcr = {};
+            m_scr = {};
+            m_thri = true;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Initializes this emulated_uart_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gs the gs_t to use
+        ///   @param tls the tls_t to use
+        ///   @param sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM associated with this emulated_uart_t
+        ///
+        constexpr void
+        initialize(
+            gs_t const &gs,
+            tls_t const &tls,
+            syscall::bf_syscall_t const &sys,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vmid) noexcept
+        {
+            bsl::expects(this->assigned_vmid() == syscall::BF_INVALID_ID);
+
+            bsl::discard(gs);
+            bsl::discard(tls);
+            bsl::discard(sys);
+            bsl::discard(intrinsic);
+
+            this->reset();
+            m_assigned_vmid = ~vmid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Release the emulated_uart_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gs the gs_t to use
+        ///   @param tls the tls_t to use
+        ///   @param sys the bf_syscall_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        release(
+            gs_t const &gs,
+            tls_t const &tls,
+            syscall::bf_syscall_t const &sys,
+            intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::discard(gs);
+            bsl::discard(tls);
+            bsl::discard(sys);
+            bsl::discard(intrinsic);
+
+            this->reset();
+            m_assigned_vmid = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the UART to its power on state. This is called
+        ///     when the VM it belongs to is destroyed so that the next VM
+        ///     does not inherit it's state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///
+        constexpr void
+        deallocate(tls_t const &tls) noexcept
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            this->reset();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the ID of the PP associated with this
+        ///     emulated_uart_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the ID of the PP associated with this
+        ///     emulated_uart_t
+        ///
+        [[nodiscard]] constexpr auto
+        assigned_vmid() const noexcept -> bsl::safe_u16
+        {
+            bsl::ensures(m_assigned_vmid.is_valid_and_checked());
+            return ~m_assigned_vmid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided port belongs to this
+        ///     emulated_uart_t, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port to query
+        ///   @return Returns true if the provided port belongs to this
+        ///     emulated_uart_t, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        handles(bsl::safe_u64 const &port) noexcept -> bool
+        {
+            if (UART_PORT_E9 == port) {
+                return true;
+            }
+
+            return (port >= UART_PORT_BASE) && (port <= UART_PORT_LAST);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to one of the UART's ports. Returns
+        ///     false if the write could not be emulated without the root
+        ///     VM (i.e., the transmit buffer needs to be flushed first, or
+        ///     the access is not a single byte), in which case the state of
+        ///     the UART is left untouched.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write(tls_t const &tls, io_access_t const &access, bsl::safe_u64 const &val) noexcept
+            -> bool
+        {
+            bsl::expects(!access.in);
+            bsl::expects(handles(access.port));
+
+            if (access.string || (1_u64 != access.bytes)) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            if (UART_PORT_E9 == access.port) {
+                return this->tx_push(access.port, val);
+            }
+
+            auto const reg{(access.port - UART_PORT_BASE).checked()};
+            auto const byte{bsl::to_u8_unsafe(val)};
+
+            if (UART_REG_DATA == reg) {
+                if (this->dlab()) {
+                    m_dll = byte;
+                    return true;
+                }
+
+                if (!this->tx_push(UART_PORT_BASE, val)) {
+                    return false;
+                }
+
+                /// NOTE:
+                /// - The byte is handed off right away, so from the guest's
+                ///   point of view, the THR is empty again.
+                ///
+
+                m_thri = true;
+                return true;
+            }
+
+            if (UART_REG_IER == reg) {
+                if (this->dlab()) {
+                    m_dlm = byte;
+                    return true;
+                }
+
+                if ((byte & ~m_ier & UART_IER_ETBEI).is_pos()) {
+                    m_thri = true;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                m_ier = byte & UART_IER_MASK;
+                return true;
+            }
+
+            if (UART_REG_IIR == reg) {
+                m_fcr = byte;
+                return true;
+            }
+
+            if (UART_REG_LCR == reg) {
+                m_lcr = byte;
+                return true;
+            }
+
+            if (UART_REG_MCR == reg) {
+                m_mcr = byte & UART_MCR_MASK;
+                return true;
+            }
+
+            if (UART_REG_SCR == reg) {
+                m_scr = byte;
+                return true;
+            }
+
+            /// NOTE:
+            /// - Writes to the LSR and MSR are undefined on a real 16550
+            ///   and are ignored.
+            ///
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from one of the UART's ports. Returns
+        ///     bsl::safe_u64::failure() if the read can only be completed
+        ///     by the root VM (i.e., the receive side), in which case the
+        ///     state of the UART is left untouched.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        read(tls_t const &tls, io_access_t const &access) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(access.in);
+            bsl::expects(handles(access.port));
+
+            if (access.string || (1_u64 != access.bytes)) {
+                return bsl::safe_u64::failure();
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            if (UART_PORT_E9 == access.port) {
+                return bsl::to_u64(UART_E9_READBACK);
+            }
+
+            auto const reg{(access.port - UART_PORT_BASE).checked()};
+
+            if (UART_REG_DATA == reg) {
+                if (this->dlab()) {
+                    return bsl::to_u64(m_dll);
+                }
+
+                return bsl::safe_u64::failure();
+            }
+
+            if (UART_REG_IER == reg) {
+                if (this->dlab()) {
+                    return bsl::to_u64(m_dlm);
+                }
+
+                return bsl::to_u64(m_ier);
+            }
+
+            if (UART_REG_IIR == reg) {
+                auto const iir{this->iir()};
+                if ((iir & ~UART_IIR_FIFO) == UART_IIR_THRI) {
+                    m_thri = false;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return bsl::to_u64(iir);
+            }
+
+            if (UART_REG_LCR == reg) {
+                return bsl::to_u64(m_lcr);
+            }
+
+            if (UART_REG_MCR == reg) {
+                return bsl::to_u64(m_mcr);
+            }
+
+            if (UART_REG_LSR == reg) {
+                return bsl::to_u64(UART_LSR_IDLE);
+            }
+
+            if (UART_REG_MSR == reg) {
+                return bsl::to_u64(this->msr());
+            }
+
+            return bsl::to_u64(m_scr);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if there are transmitted bytes that have
+        ///     not yet been handed to the root VM, false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if there are transmitted bytes that have
+        ///     not yet been handed to the root VM, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        tx_pending(tls_t const &tls) const noexcept -> bool
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            return m_tx_size.is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves all of the buffered bytes into the provided
+        ///     mv_exit_io_t as a byte sized string OUT to the port they
+        ///     were written to and empties the buffer. Returns the number
+        ///     of bytes that were moved, which can be 0 if another VS
+        ///     flushed the buffer first.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param mut_exit_io the mv_exit_io_t to fill in
+        ///   @return Returns the number of bytes that were moved
+        ///
+        [[nodiscard]] constexpr auto
+        flush(tls_t const &tls, hypercall::mv_exit_io_t &mut_exit_io) noexcept -> bsl::safe_u64
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const size{m_tx_size};
+            for (bsl::safe_idx mut_i{}; mut_i < size; ++mut_i) {
+                *mut_exit_io.buf.at_if(mut_i) = *m_tx.at_if(mut_i);
+            }
+
+            mut_exit_io.addr = m_tx_port.get();
+            mut_exit_io.data = {};
+            mut_exit_io.reps = size.get();
+            mut_exit_io.type = hypercall::MV_EXIT_IO_OUT.get();
+            mut_exit_io.size = hypercall::mv_bit_size_t::mv_bit_size_t_8;
+
+            m_tx_size = {};
+            return size;
+        }
+    };
+}
+
+#endif
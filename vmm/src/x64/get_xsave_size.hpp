@@ -0,0 +1,100 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef GET_XSAVE_SIZE_HPP
+#define GET_XSAVE_SIZE_HPP
+
+#include <intrinsic_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the CPUID leaf that reports XSAVE information
+    constexpr auto CPUID_XSAVE_LEAF{0x0000000D_u64};
+    /// @brief defines the size of the legacy region + the xsave header
+    constexpr auto XSAVE_MIN_SIZE{0x240_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns the number of bytes needed to store the extended
+    ///     state of a VS. This is CPUID.(EAX=0xD,ECX=0).ECX, which is the
+    ///     size needed for every state component the CPU supports, and not
+    ///     just the ones currently enabled in XCR0. This ensures that
+    ///     a guest cannot overflow its xsave region by enabling features
+    ///     like AVX-512 or AMX with XSETBV.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns the number of bytes needed to store the extended
+    ///     state of a VS on success. Returns bsl::safe_u64::failure() on
+    ///     failure.
+    ///
+    [[nodiscard]] constexpr auto
+    get_xsave_size(intrinsic_t const &intrinsic) noexcept -> bsl::safe_u64
+    {
+        bsl::safe_u64 mut_rax{CPUID_XSAVE_LEAF};
+        bsl::safe_u64 mut_rbx{};
+        bsl::safe_u64 mut_rcx{};
+        bsl::safe_u64 mut_rdx{};
+        intrinsic.cpuid(mut_rax, mut_rbx, mut_rcx, mut_rdx);
+
+        if (bsl::unlikely(mut_rcx < XSAVE_MIN_SIZE)) {
+            bsl::error() << "CPUID reported an invalid xsave size: "    // --
+                         << bsl::hex(mut_rcx)                           // --
+                         << bsl::endl                                   // --
+                         << bsl::here();                                // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return mut_rcx;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports XSAVEOPT, false otherwise.
+    ///     This is CPUID.(EAX=0xD,ECX=1).EAX[0].
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns true if the CPU supports XSAVEOPT, false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_xsaveopt_supported(intrinsic_t const &intrinsic) noexcept -> bool
+    {
+        constexpr auto xsaveopt_bit{0x00000001_u64};
+
+        bsl::safe_u64 mut_rax{CPUID_XSAVE_LEAF};
+        bsl::safe_u64 mut_rbx{};
+        bsl::safe_u64 mut_rcx{bsl::safe_u64::magic_1()};
+        bsl::safe_u64 mut_rdx{};
+        intrinsic.cpuid(mut_rax, mut_rbx, mut_rcx, mut_rdx);
+
+        return (mut_rax & xsaveopt_bit).is_pos();
+    }
+}
+
+#endif
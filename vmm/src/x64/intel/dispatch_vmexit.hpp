@@ -27,6 +27,7 @@
 
 #include <bf_debug_ops.hpp>
 #include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_apic.hpp>
 #include <dispatch_vmexit_cpuid.hpp>
 #include <dispatch_vmexit_cr.hpp>
 #include <dispatch_vmexit_dr.hpp>
@@ -35,11 +36,19 @@
 #include <dispatch_vmexit_intr.hpp>
 #include <dispatch_vmexit_intr_window.hpp>
 #include <dispatch_vmexit_io.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_kvm_pv_helpers.hpp>
 #include <dispatch_vmexit_mmio.hpp>
+#include <dispatch_vmexit_nm.hpp>
 #include <dispatch_vmexit_nmi.hpp>
 #include <dispatch_vmexit_nmi_window.hpp>
+#include <dispatch_vmexit_pause.hpp>
+#include <dispatch_vmexit_preemption_timer.hpp>
 #include <dispatch_vmexit_rdmsr.hpp>
 #include <dispatch_vmexit_sipi.hpp>
+#include <dispatch_vmexit_stats_helpers.hpp>
+#include <dispatch_vmexit_sync_regs_helpers.hpp>
+#include <dispatch_vmexit_trace_helpers.hpp>
 #include <dispatch_vmexit_triple_fault.hpp>
 #include <dispatch_vmexit_unknown.hpp>
 #include <dispatch_vmexit_vmcall.hpp>
@@ -65,14 +74,36 @@ namespace microv
     constexpr auto EXIT_REASON_NMI_WINDOW{8_u64};
     /// @brief defines the INTR exit reason code
     constexpr auto EXIT_REASON_INTR{1_u64};
+    /// @brief defines the interrupt window exit reason code
+    constexpr auto EXIT_REASON_INTR_WINDOW{7_u64};
     /// @brief defines the CPUID exit reason code
     constexpr auto EXIT_REASON_CPUID{10_u64};
+    /// @brief defines the HLT exit reason code
+    constexpr auto EXIT_REASON_HLT{12_u64};
     /// @brief defines the VMCALL exit reason code
     constexpr auto EXIT_REASON_VMCALL{18_u64};
     /// @brief defines the CR exit reason code
     constexpr auto EXIT_REASON_CR{28_u64};
     /// @brief defines the IO exit reason code
     constexpr auto EXIT_REASON_IO{30_u64};
+    /// @brief defines the RDMSR exit reason code
+    constexpr auto EXIT_REASON_RDMSR{31_u64};
+    /// @brief defines the WRMSR exit reason code
+    constexpr auto EXIT_REASON_WRMSR{32_u64};
+    /// @brief defines the PAUSE exit reason code
+    constexpr auto EXIT_REASON_PAUSE{40_u64};
+    /// @brief defines the TPR below threshold exit reason code
+    constexpr auto EXIT_REASON_TPR_BELOW_THRESHOLD{43_u64};
+    /// @brief defines the APIC access exit reason code
+    constexpr auto EXIT_REASON_APIC_ACCESS{44_u64};
+    /// @brief defines the virtualized EOI exit reason code
+    constexpr auto EXIT_REASON_VIRTUALIZED_EOI{45_u64};
+    /// @brief defines the EPT violation exit reason code
+    constexpr auto EXIT_REASON_EPT_VIOLATION{48_u64};
+    /// @brief defines the VMX-preemption timer exit reason code
+    constexpr auto EXIT_REASON_PREEMPTION_TIMER{52_u64};
+    /// @brief defines the APIC write exit reason code
+    constexpr auto EXIT_REASON_APIC_WRITE{56_u64};
 
     /// <!-- description -->
     ///   @brief Dispatches the VMExit.
@@ -106,7 +137,43 @@ namespace microv
         bsl::safe_u16 const &vsid,
         bsl::safe_u64 const &exit_reason) noexcept -> bsl::errc_type
     {
+        auto const start{intrinsic.rdtsc()};
+        bool const is_hypercall{EXIT_REASON_VMCALL == exit_reason};
+        auto const slot{stats_hypercall_slot(mut_sys)};
+
+        /// NOTE:
+        /// - The VS's registers changed while it was running, so anything
+        ///   in its register cache is out of date.
+        ///
+
+        mut_vs_pool.reg_cache_invalidate(vsid);
+
+        trace_vmexit(mut_sys, intrinsic, mut_pp_pool, mut_vs_pool, vsid, exit_reason, is_hypercall);
+
         bsl::errc_type mut_ret{};
+        bool const guest{!mut_sys.is_the_active_vm_the_root_vm()};
+
+        if (guest) {
+            mut_ret = kvm_pv_sync_from_guest(
+                mut_tls, mut_sys, mut_page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid);
+            if (bsl::unlikely(!mut_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return return_from_vmexit(
+                    mut_tls,
+                    mut_sys,
+                    intrinsic,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid,
+                    mut_ret);
+            }
+
+            bsl::touch();
+        }
+        else {
+            bsl::touch();
+        }
 
         switch (exit_reason.get()) {
             case EXIT_REASON_INTR.get(): {
@@ -124,7 +191,37 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_INTR_WINDOW.get(): {
+                mut_ret = dispatch_vmexit_external_interrupt_window(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             case EXIT_REASON_NMI.get(): {
+                if (is_vmexit_nm(mut_sys, vsid)) {
+                    mut_ret = dispatch_vmexit_nm(
+                        gs,
+                        mut_tls,
+                        mut_sys,
+                        mut_page_pool,
+                        intrinsic,
+                        mut_pp_pool,
+                        mut_vm_pool,
+                        mut_vp_pool,
+                        mut_vs_pool,
+                        vsid);
+                    break;
+                }
+
                 mut_ret = dispatch_vmexit_nmi(
                     gs,
                     mut_tls,
@@ -169,6 +266,36 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_HLT.get(): {
+                mut_ret = dispatch_vmexit_hlt(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_PAUSE.get(): {
+                mut_ret = dispatch_vmexit_pause(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             case EXIT_REASON_CR.get(): {
                 mut_ret = dispatch_vmexit_cr(
                     gs,
@@ -199,6 +326,36 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_RDMSR.get(): {
+                mut_ret = dispatch_vmexit_rdmsr(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_WRMSR.get(): {
+                mut_ret = dispatch_vmexit_wrmsr(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             case EXIT_REASON_VMCALL.get(): {
                 mut_ret = dispatch_vmexit_vmcall(
                     gs,
@@ -214,6 +371,96 @@ namespace microv
                 break;
             }
 
+            case EXIT_REASON_TPR_BELOW_THRESHOLD.get(): {
+                mut_ret = dispatch_vmexit_tpr_below_threshold(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_APIC_ACCESS.get(): {
+                mut_ret = dispatch_vmexit_apic_access(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_VIRTUALIZED_EOI.get(): {
+                mut_ret = dispatch_vmexit_virtualized_eoi(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_EPT_VIOLATION.get(): {
+                mut_ret = dispatch_vmexit_mmio(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_PREEMPTION_TIMER.get(): {
+                mut_ret = dispatch_vmexit_preemption_timer(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
+            case EXIT_REASON_APIC_WRITE.get(): {
+                mut_ret = dispatch_vmexit_apic_write(
+                    gs,
+                    mut_tls,
+                    mut_sys,
+                    mut_page_pool,
+                    intrinsic,
+                    mut_pp_pool,
+                    mut_vm_pool,
+                    mut_vp_pool,
+                    mut_vs_pool,
+                    vsid);
+                break;
+            }
+
             default: {
                 mut_ret = dispatch_vmexit_unknown(
                     gs,
@@ -231,6 +478,67 @@ namespace microv
             }
         }
 
+        mut_ret = return_vmexit_irq_resampled(
+            mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, vsid, mut_ret);
+
+        if (guest && mut_sys.is_the_active_vm_the_root_vm()) {
+            auto const pv_ret{kvm_pv_set_preempted(
+                mut_tls, mut_sys, mut_page_pool, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!pv_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const sync_ret{sync_regs_to_root(mut_sys, mut_pp_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!sync_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const irq_ret{irq_resampled_to_root(
+                mut_tls, mut_sys, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!irq_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const wakeup_ret{
+                pv_wakeup_to_root(mut_tls, mut_sys, mut_pp_pool, mut_vm_pool, mut_vs_pool, vsid)};
+            if (bsl::unlikely(!wakeup_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+            }
+            else {
+                bsl::touch();
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (!mut_sys.is_the_active_vm_the_root_vm()) {
+            trace_inject(mut_sys, intrinsic, mut_pp_pool, mut_vs_pool, vsid);
+        }
+        else {
+            bsl::touch();
+        }
+
+        stats_add_vmexit(
+            mut_sys,
+            intrinsic,
+            mut_pp_pool,
+            mut_vs_pool,
+            vsid,
+            exit_reason,
+            is_hypercall,
+            slot,
+            start);
+
         return return_from_vmexit(
             mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, vsid, mut_ret);
     }
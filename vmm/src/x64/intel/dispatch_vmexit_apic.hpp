@@ -0,0 +1,300 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_APIC_HPP
+#define DISPATCH_VMEXIT_APIC_HPP
+
+#include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_irqchip_helpers.hpp>
+#include <dispatch_vmexit_mmio_helpers.hpp>
+#include <errc_types.hpp>
+#include <gs_t.hpp>
+#include <intrinsic_t.hpp>
+#include <mv_exit_mmio_t.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace microv
+{
+    /// @brief defines the bits of the exit qualification holding the offset
+    constexpr auto APIC_EXITQUAL_OFFSET{0x0000000000000FFF_u64};
+    /// @brief defines the bits of the exit qualification holding the vector
+    constexpr auto APIC_EXITQUAL_VECTOR{0x00000000000000FF_u64};
+    /// @brief defines the bits of the exit qualification holding the type
+    constexpr auto APIC_EXITQUAL_TYPE{0x000000000000F000_u64};
+    /// @brief defines the access type of a linear read of the APIC page
+    constexpr auto APIC_EXITQUAL_TYPE_READ{0x0000000000000000_u64};
+    /// @brief defines the access type of a linear write of the APIC page
+    constexpr auto APIC_EXITQUAL_TYPE_WRITE{0x0000000000001000_u64};
+
+    /// <!-- description -->
+    ///   @brief Dispatches TPR below threshold VMExits. These occur when
+    ///     the guest lowers its TPR (through CR8 or the virtual-APIC page)
+    ///     below the priority class of an interrupt that is pending in the
+    ///     IRR of the emulated LAPIC, which is now deliverable.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vp_pool the vp_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_tpr_below_threshold(
+        gs_t const &gs,
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t const &vm_pool,
+        vp_pool_t const &vp_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+        bsl::discard(tls);
+        bsl::discard(page_pool);
+        bsl::discard(intrinsic);
+        bsl::discard(pp_pool);
+        bsl::discard(vm_pool);
+        bsl::discard(vp_pool);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        auto const ret{vs_pool.lapic_sync(mut_sys, vsid)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        return vmexit_success_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches APIC access VMExits. These are fault-like
+    ///     accesses to the APIC-access page that the CPU could not
+    ///     virtualize using the virtual-APIC page, and are emulated the
+    ///     same way as any other MMIO access to the emulated LAPIC.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_apic_access(
+        gs_t const &gs,
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto exitqual_idx{syscall::bf_reg_t::bf_reg_t_exit_qualification};
+        auto const exitqual{mut_sys.bf_vs_op_read(vsid, exitqual_idx)};
+
+        auto const type{exitqual & APIC_EXITQUAL_TYPE};
+        auto const gpa{mut_vs_pool.lapic_base(vsid) | (exitqual & APIC_EXITQUAL_OFFSET)};
+
+        bsl::safe_u64 mut_flags{};
+        if (APIC_EXITQUAL_TYPE_READ == type) {
+            mut_flags = hypercall::MV_EXIT_MMIO_READ;
+        }
+        else if (APIC_EXITQUAL_TYPE_WRITE == type) {
+            mut_flags = hypercall::MV_EXIT_MMIO_READ | hypercall::MV_EXIT_MMIO_WRITE;
+        }
+        else {
+            bsl::error() << "unsupported APIC access type "    // --
+                         << bsl::hex(type)                       // --
+                         << bsl::endl                            // --
+                         << bsl::here();                         // --
+
+            return bsl::errc_failure;
+        }
+
+        auto const ret{handle_vmexit_mmio(
+            mut_tls,
+            mut_sys,
+            page_pool,
+            intrinsic,
+            mut_pp_pool,
+            mut_vm_pool,
+            mut_vp_pool,
+            mut_vs_pool,
+            vsid,
+            gpa,
+            mut_flags)};
+
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        return ret;
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches virtualized EOI VMExits. The CPU has already
+    ///     retired the vector from the ISR of the virtual-APIC page, and
+    ///     only exits for level triggered vectors (i.e., the ones set in
+    ///     the EOI-exit bitmaps), which still need to be forwarded to the
+    ///     VM's emulated IOAPIC so that it can clear remote IRR.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param vp_pool the vp_pool_t to use
+    ///   @param vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_virtualized_eoi(
+        gs_t const &gs,
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t const &vp_pool,
+        vs_pool_t const &vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+        bsl::discard(page_pool);
+        bsl::discard(intrinsic);
+        bsl::discard(pp_pool);
+        bsl::discard(vp_pool);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto exitqual_idx{syscall::bf_reg_t::bf_reg_t_exit_qualification};
+        auto const exitqual{mut_sys.bf_vs_op_read(vsid, exitqual_idx)};
+
+        auto const vector{exitqual & APIC_EXITQUAL_VECTOR};
+        mut_vm_pool.ioapic_eoi(tls, vector, vs_pool.assigned_vm(vsid));
+
+        return vmexit_success_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches APIC write VMExits. These are trap-like, meaning
+    ///     the CPU has already stored the guest's write in the virtual-APIC
+    ///     page (which is the emulated LAPIC's register page) and advanced
+    ///     the guest past the instruction, so the write only needs to be
+    ///     replayed to get its side effects.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_apic_write(
+        gs_t const &gs,
+        tls_t const &tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t const &vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+        bsl::discard(page_pool);
+        bsl::discard(pp_pool);
+        bsl::discard(vp_pool);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        constexpr auto exitqual_idx{syscall::bf_reg_t::bf_reg_t_exit_qualification};
+        auto const exitqual{mut_sys.bf_vs_op_read(vsid, exitqual_idx)};
+
+        return replay_vmexit_lapic_write(
+            tls,
+            mut_sys,
+            intrinsic,
+            mut_vm_pool,
+            mut_vs_pool,
+            vsid,
+            exitqual & APIC_EXITQUAL_OFFSET);
+    }
+}
+
+#endif
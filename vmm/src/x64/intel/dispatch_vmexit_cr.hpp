@@ -41,6 +41,7 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/touch.hpp>
 
 namespace microv
 {
@@ -59,12 +60,17 @@ namespace microv
     ///   only the bits set in the mask. All writes go directly to CR0/CR4
     ///   if the mask is clear, or trap when the mask bit is 1.
     ///
-    /// - So, what we do here is just set all of the bits to 1 in the mask.
-    ///   If this ends up being a performance issue in the future, we can
-    ///   always get a bit more fancy with this. By setting all of the mask
-    ///   bits to 0, all writes to CR0/CR4 that change a bit will trap, and
-    ///   all bits read will always come from the shadow, making life a ton
-    ///   easier here.
+    /// - So, the mask only contains the bits that MicroV must own, which
+    ///   are PE, NE and PG in CR0, VMXE in CR4, and all of the reserved
+    ///   bits (see CR0_GUEST_HOST_MASK and CR4_GUEST_HOST_MASK). Bits
+    ///   like CR0.TS or CR4.PGE, which guests toggle on every context
+    ///   switch or TLB flush, are owned by the guest and never trap. The
+    ///   only exception is CR0.TS, which is added to the mask while the
+    ///   guest's extended state is being lazily loaded (see
+    ///   vs_t::fpu_try_lazy()). When a write does trap, the guest is
+    ///   trying to change a bit that we own, and since the guest reads
+    ///   these bits from the shadow, the shadow is always given the full
+    ///   value that the guest wrote.
     ///
     /// - Unlike AMD as well, Intel requires that certain CRO/CR4 bits are
     ///   always enabled, or always disabled. AMD does not have this same
@@ -76,15 +82,16 @@ namespace microv
     ///   of this for us. So MicroV has it pretty easy here.
     ///
     /// - MicroV requires EPT and unrestricted mode, so these are always
-    ///   turned on. And, the Microkernel handles the rest. So, any write
-    ///   from CR0/CR4, we simply write to CR0/CR4 in the VMCS. The Microkernel
-    ///   will make sure that the bits that must be on/off are handled. All
-    ///   we need to do next is also write CR0/CR4 to the read shadow. This
-    ///   way, what the guest reads from CR0/CR4 is what it wrote. Just know
-    ///   that if you see the output of a VS, CR0/CR4 might not match what
-    ///   the guest wrote. This is because the Microkernel is adding bits
-    ///   based on what Intel requires. But the read shadow should always
-    ///   match what the guest wrote.
+    ///   turned on. And, the Microkernel handles the rest. So, for any
+    ///   write to CR0/CR4 that traps, we simply write to CR0/CR4 in the
+    ///   VMCS. The Microkernel will make sure that the bits that must be
+    ///   on/off are handled. All we need to do next is also write CR0/CR4
+    ///   to the read shadow. This way, what the guest reads from the bits
+    ///   that we own is what it wrote. Just know that if you see the
+    ///   output of a VS, CR0/CR4 might not match what the guest wrote.
+    ///   This is because the Microkernel is adding bits based on what
+    ///   Intel requires. But the read shadow should always match what the
+    ///   guest wrote for the bits that we own.
     ///
     /// - Sadly, this story is not over for Intel. For god knows what reason,
     ///   Intel has this thing called the ia32e_mode in the entry controls.
@@ -102,12 +109,84 @@ namespace microv
     ///   - CR4.PGE, CR4.PAE, CR4.PSE
     ///   - EFER.NXE, EFER.LMA, EFER.LME
     ///
+    ///   Writes to the guest owned bits in this list do not trap, but they
+    ///   are executed by the CPU, which flushes the guest's TLB entries
+    ///   just like it would without virtualization.
+    ///
+
+    /// <!-- description -->
+    ///   @brief Sets the guest's CR0 to the provided value. The read
+    ///     shadow is given the value the guest wrote, while CR0 itself
+    ///     keeps CR0.TS set if the guest's use of the FPU is being
+    ///     trapped (i.e. #NM is intercepted), as CR0.TS must stay set
+    ///     until the guest's extended state is loaded. See
+    ///     vs_t::fpu_try_lazy().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to set CR0 for
+    ///   @param val the value of CR0 as seen by the guest
+    ///
+    constexpr void
+    set_guest_cr0(
+        syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &val) noexcept
+    {
+        constexpr auto cr0_shadow_idx{syscall::bf_reg_t::bf_reg_t_cr0_read_shadow};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, cr0_shadow_idx, val, vsid));
+
+        auto mut_cr0_val{val};
+
+        constexpr auto bitmap_idx{syscall::bf_reg_t::bf_reg_t_exception_bitmap};
+        auto const bitmap{mut_vs_pool.reg_cache_read(mut_sys, bitmap_idx, vsid)};
+        if ((bitmap & EXCEPTION_BITMAP_NM).is_pos()) {
+            mut_cr0_val |= CR0_TS;
+        }
+        else {
+            bsl::touch();
+        }
+
+        constexpr auto cr0_idx{syscall::bf_reg_t::bf_reg_t_cr0};
+        bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, cr0_idx, mut_cr0_val, vsid));
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the guest's CR0 as seen by the guest. Bits that
+    ///     are set in the CR0 guest/host mask come from the read shadow,
+    ///     while the rest come from CR0 itself.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to get CR0 from
+    ///   @return Returns the guest's CR0 as seen by the guest
+    ///
+    [[nodiscard]] constexpr auto
+    get_guest_cr0(
+        syscall::bf_syscall_t const &sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::safe_u64
+    {
+        constexpr auto cr0_idx{syscall::bf_reg_t::bf_reg_t_cr0};
+        constexpr auto cr0_shadow_idx{syscall::bf_reg_t::bf_reg_t_cr0_read_shadow};
+        constexpr auto cr0_mask_idx{syscall::bf_reg_t::bf_reg_t_cr0_guest_host_mask};
+
+        auto const cr0{mut_vs_pool.reg_cache_read(sys, cr0_idx, vsid)};
+        auto const shadow{mut_vs_pool.reg_cache_read(sys, cr0_shadow_idx, vsid)};
+        auto const mask{mut_vs_pool.reg_cache_read(sys, cr0_mask_idx, vsid)};
+
+        return (cr0 & ~mask) | (shadow & mask);
+    }
 
     /// <!-- description -->
     ///   @brief Handles CR0 VMExits
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @param type 1 = read, 0 = write
     ///   @param rnum which GPR to read/write from
@@ -117,19 +196,14 @@ namespace microv
     [[nodiscard]] constexpr auto
     handle_vmexit_cr0(
         syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid,
         bsl::safe_u64 const &type,
         bsl::safe_u64 const &rnum) noexcept -> bsl::errc_type
     {
         constexpr auto type_write{0_u64};
         if (type == type_write) {
-            auto const cr0_val{get_gpr(mut_sys, vsid, rnum)};
-            auto const cr0_idx{syscall::bf_reg_t::bf_reg_t_cr0};
-            bsl::expects(mut_sys.bf_vs_op_write(vsid, cr0_idx, cr0_val));
-
-            constexpr auto cr0_shadow_idx{syscall::bf_reg_t::bf_reg_t_cr0_read_shadow};
-            bsl::expects(mut_sys.bf_vs_op_write(vsid, cr0_shadow_idx, cr0_val));
-
+            set_guest_cr0(mut_sys, mut_vs_pool, vsid, get_gpr(mut_sys, vsid, rnum));
             return vmexit_success_advance_ip_and_run;
         }
 
@@ -138,10 +212,71 @@ namespace microv
     }
 
     /// <!-- description -->
-    ///   @brief Handles CR4 VMExits
+    ///   @brief Handles CLTS VMExits. CLTS only traps when CR0.TS is owned
+    ///     by MicroV and set in the read shadow, which only happens while
+    ///     the guest's extended state is being lazily loaded. The guest
+    ///     sees CR0.TS cleared, while the real CR0.TS stays set until the
+    ///     guest's extended state is loaded.
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_vmexit_clts(
+        syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        auto const cr0_val{get_guest_cr0(mut_sys, mut_vs_pool, vsid) & ~CR0_TS};
+        set_guest_cr0(mut_sys, mut_vs_pool, vsid, cr0_val);
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Handles LMSW VMExits. LMSW loads CR0 bits 3:0, but it
+    ///     can only set CR0.PE, never clear it.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @param exitqual the exit qualification of the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    handle_vmexit_lmsw(
+        syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        bsl::safe_u64 const &exitqual) noexcept -> bsl::errc_type
+    {
+        constexpr auto msw_mask{0x000F0000_u64};
+        constexpr auto msw_shft{16_u64};
+        constexpr auto msw_keep{0x0000000E_u64};
+
+        auto const msw{(exitqual & msw_mask) >> msw_shft};
+        auto const cr0_val{(get_guest_cr0(mut_sys, mut_vs_pool, vsid) & ~msw_keep) | msw};
+
+        set_guest_cr0(mut_sys, mut_vs_pool, vsid, cr0_val);
+        return vmexit_success_advance_ip_and_run;
+    }
+
+    /// <!-- description -->
+    ///   @brief Handles CR4 VMExits. If the guest enables CR4.PKE while
+    ///     its extended state is being lazily loaded, it is loaded now, as
+    ///     the guest's PKRU must be live before it can use protection keys
+    ///     (see vs_t::fpu_try_lazy()).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @param type 1 = read, 0 = write
     ///   @param rnum which GPR to read/write from
@@ -150,7 +285,10 @@ namespace microv
     ///
     [[nodiscard]] constexpr auto
     handle_vmexit_cr4(
+        tls_t &mut_tls,
         syscall::bf_syscall_t &mut_sys,
+        intrinsic_t const &intrinsic,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid,
         bsl::safe_u64 const &type,
         bsl::safe_u64 const &rnum) noexcept -> bsl::errc_type
@@ -159,10 +297,17 @@ namespace microv
         if (type == type_write) {
             auto const cr4_val{get_gpr(mut_sys, vsid, rnum)};
             auto const cr4_idx{syscall::bf_reg_t::bf_reg_t_cr4};
-            bsl::expects(mut_sys.bf_vs_op_write(vsid, cr4_idx, cr4_val));
+            bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, cr4_idx, cr4_val, vsid));
 
             constexpr auto cr4_shadow_idx{syscall::bf_reg_t::bf_reg_t_cr4_read_shadow};
-            bsl::expects(mut_sys.bf_vs_op_write(vsid, cr4_shadow_idx, cr4_val));
+            bsl::expects(mut_vs_pool.reg_cache_write(mut_sys, cr4_shadow_idx, cr4_val, vsid));
+
+            if ((cr4_val & CR4_PKE).is_pos()) {
+                mut_vs_pool.fpu_load(mut_tls, mut_sys, intrinsic, vsid);
+            }
+            else {
+                bsl::touch();
+            }
 
             return vmexit_success_advance_ip_and_run;
         }
@@ -172,10 +317,16 @@ namespace microv
     }
 
     /// <!-- description -->
-    ///   @brief Handles CR8 VMExits
+    ///   @brief Handles CR8 VMExits. CR8 is the priority class of the
+    ///     TPR of the VS's emulated LAPIC, so that the guest sees the same
+    ///     TPR through both CR8 and MMIO, and so that a write to CR8
+    ///     properly masks and unmasks interrupts. These VMExits only
+    ///     happen when the CPU cannot shadow the TPR, as otherwise CR8
+    ///     accesses are handled by the CPU using the virtual-APIC page.
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_sys the bf_syscall_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @param type 1 = read, 0 = write
     ///   @param rnum which GPR to read/write from
@@ -185,21 +336,16 @@ namespace microv
     [[nodiscard]] constexpr auto
     handle_vmexit_cr8(
         syscall::bf_syscall_t &mut_sys,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid,
         bsl::safe_u64 const &type,
         bsl::safe_u64 const &rnum) noexcept -> bsl::errc_type
     {
-        /// TODO:
-        /// - CR8 (also called the TPR) should be written to the emulated
-        ///   LAPIC code so that it has it, as the TPR will be needed to
-        ///   determine which interrupts take priority. Just make a get/set
-        ///   TPR function in the vs_t/vs_pool_t and get/set it's value
-        ///
+        constexpr auto cr8_mask{0xF_u64};
 
         constexpr auto type_read{1_u64};
         if (type == type_read) {
-            auto const cr8_idx{syscall::bf_reg_t::bf_reg_t_cr8};
-            auto const cr8_val{mut_sys.bf_vs_op_read(vsid, cr8_idx)};
+            auto const cr8_val{mut_vs_pool.lapic_tpr(vsid) >> LAPIC_PRIORITY_SHIFT};
             bsl::expects(set_gpr(mut_sys, vsid, rnum, cr8_val));
 
             return vmexit_success_advance_ip_and_run;
@@ -207,9 +353,13 @@ namespace microv
 
         constexpr auto type_write{0_u64};
         if (type == type_write) {
-            auto const cr8_val{get_gpr(mut_sys, vsid, rnum)};
-            auto const cr8_idx{syscall::bf_reg_t::bf_reg_t_cr8};
-            bsl::expects(mut_sys.bf_vs_op_write(vsid, cr8_idx, cr8_val));
+            auto const cr8_val{get_gpr(mut_sys, vsid, rnum) & cr8_mask};
+            auto const ret{
+                mut_vs_pool.lapic_set_tpr(mut_sys, cr8_val << LAPIC_PRIORITY_SHIFT, vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
 
             return vmexit_success_advance_ip_and_run;
         }
@@ -223,14 +373,14 @@ namespace microv
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
-    ///   @param tls the tls_t to use
+    ///   @param mut_tls the tls_t to use
     ///   @param mut_sys the bf_syscall_t to use
     ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
     ///   @param pp_pool the pp_pool_t to use
     ///   @param vm_pool the vm_pool_t to use
     ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
@@ -238,28 +388,21 @@ namespace microv
     [[nodiscard]] constexpr auto
     dispatch_vmexit_cr(
         gs_t const &gs,
-        tls_t const &tls,
+        tls_t &mut_tls,
         syscall::bf_syscall_t &mut_sys,
         page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
         pp_pool_t const &pp_pool,
         vm_pool_t const &vm_pool,
         vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
-        /// TODO:
-        /// - Need to properly handle CLTS and LMSW
-        ///
-
         bsl::discard(gs);
-        bsl::discard(tls);
         bsl::discard(page_pool);
-        bsl::discard(intrinsic);
         bsl::discard(pp_pool);
         bsl::discard(vm_pool);
         bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
 
         bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
 
@@ -270,7 +413,7 @@ namespace microv
         constexpr auto cnum_shft{0_u64};
         constexpr auto type_mask{0x00000030_u64};
         constexpr auto type_shft{4_u64};
-        constexpr auto rnum_mask{0x00000700_u64};
+        constexpr auto rnum_mask{0x00000F00_u64};
         constexpr auto rnum_shft{8_u64};
 
         auto const cnum{((exitqual & cnum_mask) >> cnum_shft)};
@@ -278,15 +421,13 @@ namespace microv
         auto const rnum{((exitqual & rnum_mask) >> rnum_shft)};
 
         constexpr auto type_clts{2_u64};
-        if (bsl::unlikely(type_clts == type)) {
-            bsl::error() << "support for CLTS is currently not implemented\n" << bsl::here();
-            return bsl::errc_failure;
+        if (type_clts == type) {
+            return handle_vmexit_clts(mut_sys, mut_vs_pool, vsid);
         }
 
-        constexpr auto type_lmsw{2_u64};
-        if (bsl::unlikely(type_lmsw == type)) {
-            bsl::error() << "support for LMSW is currently not implemented\n" << bsl::here();
-            return bsl::errc_failure;
+        constexpr auto type_lmsw{3_u64};
+        if (type_lmsw == type) {
+            return handle_vmexit_lmsw(mut_sys, mut_vs_pool, vsid, exitqual);
         }
 
         constexpr auto cnum_cr0{0_u64};
@@ -295,15 +436,16 @@ namespace microv
 
         switch (cnum.get()) {
             case cnum_cr0.get(): {
-                return handle_vmexit_cr0(mut_sys, vsid, type, rnum);
+                return handle_vmexit_cr0(mut_sys, mut_vs_pool, vsid, type, rnum);
             }
 
             case cnum_cr4.get(): {
-                return handle_vmexit_cr4(mut_sys, vsid, type, rnum);
+                return handle_vmexit_cr4(
+                    mut_tls, mut_sys, intrinsic, mut_vs_pool, vsid, type, rnum);
             }
 
             case cnum_cr8.get(): {
-                return handle_vmexit_cr8(mut_sys, vsid, type, rnum);
+                return handle_vmexit_cr8(mut_sys, mut_vs_pool, vsid, type, rnum);
             }
 
             default: {
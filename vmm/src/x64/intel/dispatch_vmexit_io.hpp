@@ -26,10 +26,10 @@
 #define DISPATCH_VMEXIT_IO_HPP
 
 #include <bf_syscall_t.hpp>
-#include <dispatch_abi_helpers.hpp>
+#include <dispatch_vmexit_io_helpers.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
-#include <mv_exit_io_t.hpp>
+#include <io_access_t.hpp>
 #include <pp_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
@@ -40,6 +40,7 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/touch.hpp>
 
 namespace microv
 {
@@ -73,45 +74,19 @@ namespace microv
         vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
-        /// TODO:
-        /// - Need to properly handle string instructions (INS/OUTS)
-        /// - Need to properly handle IN instructions
-        ///
-
         bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
-
         bsl::discard(gs);
-        bsl::discard(page_pool);
-        bsl::discard(vsid);
-
-        // ---------------------------------------------------------------------
-        // Context: Guest VM
-        // ---------------------------------------------------------------------
 
         constexpr auto exitqual_idx{syscall::bf_reg_t::bf_reg_t_exit_qualification};
         auto const exitqual{mut_sys.bf_vs_op_read(vsid, exitqual_idx)};
-
-        auto const rax{mut_sys.bf_tls_rax()};
-        auto const rcx{mut_sys.bf_tls_rcx()};
-        auto const rdx{mut_sys.bf_tls_rdx()};
-
-        // ---------------------------------------------------------------------
-        // Context: Change To Root VM
-        // ---------------------------------------------------------------------
-
-        switch_to_root(mut_tls, mut_sys, intrinsic, mut_vm_pool, mut_vp_pool, mut_vs_pool, true);
-
-        // ---------------------------------------------------------------------
-        // Context: Root VM
-        // ---------------------------------------------------------------------
-
-        auto mut_exit_io{mut_pp_pool.shared_page<hypercall::mv_exit_io_t>(mut_sys)};
-        bsl::expects(mut_exit_io.is_valid());
+        bsl::expects(exitqual.is_valid());
 
         constexpr auto size_mask{0x00000007_u64};
         constexpr auto size_shft{0_u64};
         constexpr auto type_mask{0x00000008_u64};
         constexpr auto type_shft{3_u64};
+        constexpr auto strn_mask{0x00000010_u64};
+        constexpr auto strn_shft{4_u64};
         constexpr auto reps_mask{0x00000020_u64};
         constexpr auto reps_shft{5_u64};
         constexpr auto oper_mask{0x00000040_u64};
@@ -119,64 +94,50 @@ namespace microv
         constexpr auto port_mask{0xFFFF0000_u64};
         constexpr auto port_shft{16_u64};
 
+        io_access_t mut_access{};
+
         if (((exitqual & oper_mask) >> oper_shft).is_zero()) {
             constexpr auto addr_mask{0x000000000000FFFF_u64};
-            mut_exit_io->addr = (addr_mask & rdx).get();
+            mut_access.port = addr_mask & mut_sys.bf_tls_rdx();
         }
         else {
-            mut_exit_io->addr = ((exitqual & port_mask) >> port_shft).get();
+            mut_access.port = (exitqual & port_mask) >> port_shft;
         }
 
-        if (((exitqual & type_mask) >> type_shft).is_zero()) {
-            mut_exit_io->type = hypercall::MV_EXIT_IO_OUT.get();
-        }
-        else {
-            bsl::error() << "MV_EXIT_IO_IN not implemented\n" << bsl::here();
-            return bsl::errc_failure;
-        }
+        /// NOTE:
+        /// - The size field encodes the number of bytes minus 1 (i.e.,
+        ///   0, 1 or 3), so adding 1 gives us the size in bytes.
+        ///
 
-        constexpr auto bytes1{0_u64};
-        constexpr auto bytes2{1_u64};
-        constexpr auto bytes4{3_u64};
+        mut_access.bytes = ((exitqual & size_mask) >> size_shft) + 1_u64;
+        mut_access.in = ((exitqual & type_mask) >> type_shft).is_pos();
+        mut_access.string = ((exitqual & strn_mask) >> strn_shft).is_pos();
+        mut_access.rep = ((exitqual & reps_mask) >> reps_shft).is_pos();
 
-        if (bytes4 == ((exitqual & size_mask) >> size_shft)) {
-            constexpr auto data_mask{0x00000000FFFFFFFF_u64};
-            mut_exit_io->size = hypercall::mv_bit_size_t::mv_bit_size_t_32;
-            mut_exit_io->data = (data_mask & rax).get();
-        }
-        else {
-            bsl::touch();
-        }
-
-        if (bytes2 == ((exitqual & size_mask) >> size_shft)) {
-            constexpr auto data_mask{0x000000000000FFFF_u64};
-            mut_exit_io->size = hypercall::mv_bit_size_t::mv_bit_size_t_16;
-            mut_exit_io->data = (data_mask & rax).get();
-        }
-        else {
-            bsl::touch();
-        }
+        /// NOTE:
+        /// - The exit qualification does not report the address size of
+        ///   a string instruction, so we use the default for the current
+        ///   mode. An address size override prefix is not honored.
+        ///
 
-        if (bytes1 == ((exitqual & size_mask) >> size_shft)) {
-            constexpr auto data_mask{0x00000000000000FF_u64};
-            mut_exit_io->size = hypercall::mv_bit_size_t::mv_bit_size_t_8;
-            mut_exit_io->data = (data_mask & rax).get();
+        if (mut_access.string) {
+            mut_access.addr_bytes = io_default_addr_bytes(mut_sys, vsid);
         }
         else {
             bsl::touch();
         }
 
-        if (((exitqual & reps_mask) >> reps_shft).is_pos()) {
-            mut_exit_io->reps = rcx.get();
-        }
-        else {
-            mut_exit_io->reps = {};
-        }
-
-        set_reg_return(mut_sys, hypercall::MV_STATUS_SUCCESS);
-        set_reg0(mut_sys, bsl::to_u64(hypercall::EXIT_REASON_IO));
-
-        return vmexit_success_advance_ip_and_run;
+        return handle_vmexit_io(
+            mut_tls,
+            mut_sys,
+            page_pool,
+            intrinsic,
+            mut_pp_pool,
+            mut_vm_pool,
+            mut_vp_pool,
+            mut_vs_pool,
+            vsid,
+            mut_access);
     }
 }
 
@@ -26,8 +26,10 @@
 #define DISPATCH_VMEXIT_MMIO_HPP
 
 #include <bf_syscall_t.hpp>
+#include <dispatch_vmexit_mmio_helpers.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <mv_exit_mmio_t.hpp>
 #include <page_pool_t.hpp>
 #include <pp_pool_t.hpp>
 #include <tls_t.hpp>
@@ -39,22 +41,26 @@
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
     /// <!-- description -->
-    ///   @brief Dispatches MMIO VMExits.
+    ///   @brief Dispatches MMIO VMExits. On Intel, these are EPT violations
+    ///     caused by a guest accessing a GPA that has not been mapped into
+    ///     its VM. The GPA is provided by the VMCS and the RWE bits of the
+    ///     exit qualification line up with the MV_EXIT_MMIO flags.
     ///
     /// <!-- inputs/outputs -->
     ///   @param gs the gs_t to use
-    ///   @param tls the tls_t to use
+    ///   @param mut_tls the tls_t to use
     ///   @param mut_sys the bf_syscall_t to use
     ///   @param page_pool the page_pool_t to use
     ///   @param intrinsic the intrinsic_t to use
-    ///   @param pp_pool the pp_pool_t to use
-    ///   @param vm_pool the vm_pool_t to use
-    ///   @param vp_pool the vp_pool_t to use
-    ///   @param vs_pool the vs_pool_t to use
+    ///   @param mut_pp_pool the pp_pool_t to use
+    ///   @param mut_vm_pool the vm_pool_t to use
+    ///   @param mut_vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
     ///   @param vsid the ID of the VS that generated the VMExit
     ///   @return Returns bsl::errc_success on success, bsl::errc_failure
     ///     and friends otherwise
@@ -62,29 +68,51 @@ namespace microv
     [[nodiscard]] constexpr auto
     dispatch_vmexit_mmio(
         gs_t const &gs,
-        tls_t const &tls,
+        tls_t &mut_tls,
         syscall::bf_syscall_t &mut_sys,
         page_pool_t const &page_pool,
         intrinsic_t const &intrinsic,
-        pp_pool_t const &pp_pool,
-        vm_pool_t const &vm_pool,
-        vp_pool_t const &vp_pool,
-        vs_pool_t const &vs_pool,
+        pp_pool_t &mut_pp_pool,
+        vm_pool_t &mut_vm_pool,
+        vp_pool_t &mut_vp_pool,
+        vs_pool_t &mut_vs_pool,
         bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
     {
         bsl::discard(gs);
-        bsl::discard(tls);
-        bsl::discard(mut_sys);
-        bsl::discard(page_pool);
-        bsl::discard(intrinsic);
-        bsl::discard(pp_pool);
-        bsl::discard(vm_pool);
-        bsl::discard(vp_pool);
-        bsl::discard(vs_pool);
-        bsl::discard(vsid);
 
-        bsl::error() << "dispatch_vmexit_mmio not implemented\n" << bsl::here();
-        return bsl::errc_failure;
+        if (bsl::unlikely(mut_sys.is_the_active_vm_the_root_vm())) {
+            bsl::error() << "the root VM should never generate an MMIO VMExit\n" << bsl::here();
+            return bsl::errc_failure;
+        }
+
+        constexpr auto gpa_idx{syscall::bf_reg_t::bf_reg_t_guest_physical_address};
+        auto const gpa{mut_sys.bf_vs_op_read(vsid, gpa_idx)};
+
+        constexpr auto exitqual_idx{syscall::bf_reg_t::bf_reg_t_exit_qualification};
+        auto const exitqual{mut_sys.bf_vs_op_read(vsid, exitqual_idx)};
+
+        constexpr auto rwe_mask{0x7_u64};
+        auto const flags{exitqual & rwe_mask};
+
+        auto const ret{handle_vmexit_mmio(
+            mut_tls,
+            mut_sys,
+            page_pool,
+            intrinsic,
+            mut_pp_pool,
+            mut_vm_pool,
+            mut_vp_pool,
+            mut_vs_pool,
+            vsid,
+            gpa,
+            flags)};
+
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return ret;
+        }
+
+        return ret;
     }
 }
 
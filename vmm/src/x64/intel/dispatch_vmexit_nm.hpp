@@ -0,0 +1,118 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_VMEXIT_NM_HPP
+#define DISPATCH_VMEXIT_NM_HPP
+
+#include <bf_syscall_t.hpp>
+#include <errc_types.hpp>
+#include <gs_t.hpp>
+#include <intrinsic_t.hpp>
+#include <page_pool_t.hpp>
+#include <pp_pool_t.hpp>
+#include <tls_t.hpp>
+#include <vm_pool_t.hpp>
+#include <vp_pool_t.hpp>
+#include <vs_pool_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+
+namespace microv
+{
+    /// <!-- description -->
+    ///   @brief Returns true if an exception or NMI VMExit was caused by
+    ///     a device-not-available exception (#NM), false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param sys the bf_syscall_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns true if an exception or NMI VMExit was caused by
+    ///     a device-not-available exception (#NM), false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_vmexit_nm(syscall::bf_syscall_t const &sys, bsl::safe_u16 const &vsid) noexcept -> bool
+    {
+        constexpr auto info_idx{syscall::bf_reg_t::bf_reg_t_vmexit_interruption_information};
+        auto const info{sys.bf_vs_op_read(vsid, info_idx)};
+
+        /// NOTE:
+        /// - Valid (bit 31), hardware exception (type 3), vector 7.
+        ///
+
+        constexpr auto info_mask{0x800007FF_u64};
+        constexpr auto info_nm{0x80000307_u64};
+        return info_nm == (info & info_mask);
+    }
+
+    /// <!-- description -->
+    ///   @brief Dispatches #NM VMExits. A guest VS only traps #NM when
+    ///     its extended state was not loaded when it was set active
+    ///     (see vs_t::fpu_try_lazy). The guest just tried to use its
+    ///     extended state, so we load it now, which also removes the
+    ///     trap, and then rerun the faulting instruction.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gs the gs_t to use
+    ///   @param mut_tls the tls_t to use
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @param page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param pp_pool the pp_pool_t to use
+    ///   @param vm_pool the vm_pool_t to use
+    ///   @param vp_pool the vp_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS that generated the VMExit
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     and friends otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    dispatch_vmexit_nm(
+        gs_t const &gs,
+        tls_t &mut_tls,
+        syscall::bf_syscall_t &mut_sys,
+        page_pool_t const &page_pool,
+        intrinsic_t const &intrinsic,
+        pp_pool_t const &pp_pool,
+        vm_pool_t const &vm_pool,
+        vp_pool_t const &vp_pool,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid) noexcept -> bsl::errc_type
+    {
+        bsl::discard(gs);
+        bsl::discard(page_pool);
+        bsl::discard(pp_pool);
+        bsl::discard(vm_pool);
+        bsl::discard(vp_pool);
+
+        bsl::expects(!mut_sys.is_the_active_vm_the_root_vm());
+
+        mut_vs_pool.fpu_load(mut_tls, mut_sys, intrinsic, vsid);
+        return vmexit_success_run;
+    }
+}
+
+#endif
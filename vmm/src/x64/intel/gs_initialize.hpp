@@ -27,14 +27,20 @@
 
 #include <alloc_bitmap.hpp>
 #include <bf_syscall_t.hpp>
+#include <get_xsave_size.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <is_apicv_supported.hpp>
+#include <is_ple_supported.hpp>
+#include <is_preemption_timer_supported.hpp>
+#include <is_tsc_scaling_supported.hpp>
 #include <page_4k_t.hpp>
 #include <page_pool_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace microv
@@ -58,56 +64,68 @@ namespace microv
         intrinsic_t const &intrinsic) noexcept -> bsl::errc_type
     {
         bsl::discard(page_pool);
-        bsl::discard(intrinsic);
-
-        mut_gs.root_iopm_a = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.root_iopm_a_spa);
-        if (bsl::unlikely(mut_gs.root_iopm_a.is_invalid())) {
+        mut_gs.xsave_size = get_xsave_size(intrinsic);
+        if (bsl::unlikely(mut_gs.xsave_size.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        mut_gs.root_iopm_b = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.root_iopm_b_spa);
-        if (bsl::unlikely(mut_gs.root_iopm_b.is_invalid())) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
+        mut_gs.xsaveopt_supported = is_xsaveopt_supported(intrinsic);
+
+        /// NOTE:
+        /// - The APIC-access page is never read or written by the CPU. It
+        ///   only needs an SPA that is mapped at each guest's APIC base so
+        ///   that accesses to it can be virtualized, which is why a single
+        ///   page is shared by all guest VMs.
+        ///
+
+        mut_gs.tpr_shadow_supported = is_tpr_shadow_supported(mut_sys);
+        mut_gs.apicv_supported = is_apicv_supported(mut_sys);
+
+        if (mut_gs.apicv_supported) {
+            auto const *const page{mut_sys.bf_mem_op_alloc_page<page_4k_t>(mut_gs.apic_access_spa)};
+            if (bsl::unlikely(nullptr == page)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+        }
+        else {
+            bsl::touch();
         }
 
-        mut_gs.guest_iopm_a = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.guest_iopm_a_spa);
-        if (bsl::unlikely(mut_gs.guest_iopm_a.is_invalid())) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
+        mut_gs.preemption_timer_supported = is_preemption_timer_supported(mut_sys);
+        if (mut_gs.preemption_timer_supported) {
+            mut_gs.preemption_timer_rate = get_preemption_timer_rate(mut_sys);
+            if (bsl::unlikely(mut_gs.preemption_timer_rate.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+        }
+        else {
+            bsl::touch();
         }
 
-        mut_gs.guest_iopm_b = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.guest_iopm_b_spa);
-        if (bsl::unlikely(mut_gs.guest_iopm_b.is_invalid())) {
+        mut_gs.ple_supported = is_ple_supported(mut_sys);
+        mut_gs.tsc_scaling_supported = is_tsc_scaling_supported(mut_sys);
+
+        mut_gs.root_iopm_a = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.root_iopm_a_spa);
+        if (bsl::unlikely(mut_gs.root_iopm_a.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        mut_gs.root_msrpm = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.root_msrpm_spa);
-        if (bsl::unlikely(mut_gs.root_msrpm.is_invalid())) {
+        mut_gs.root_iopm_b = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.root_iopm_b_spa);
+        if (bsl::unlikely(mut_gs.root_iopm_b.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        mut_gs.guest_msrpm = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.guest_msrpm_spa);
-        if (bsl::unlikely(mut_gs.guest_msrpm.is_invalid())) {
+        mut_gs.root_msrpm = alloc_bitmap(mut_sys, HYPERVISOR_PAGE_SIZE, mut_gs.root_msrpm_spa);
+        if (bsl::unlikely(mut_gs.root_msrpm.is_invalid())) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        for (auto &mut_elem : mut_gs.guest_iopm_a) {
-            mut_elem = bsl::safe_u8::max_value().get();
-        }
-
-        for (auto &mut_elem : mut_gs.guest_iopm_b) {
-            mut_elem = bsl::safe_u8::max_value().get();
-        }
-
-        for (auto &mut_elem : mut_gs.guest_msrpm) {
-            mut_elem = bsl::safe_u8::max_value().get();
-        }
-
         return bsl::errc_success;
     }
 }
@@ -0,0 +1,103 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IS_APICV_SUPPORTED_HPP
+#define IS_APICV_SUPPORTED_HPP
+
+#include <bf_syscall_t.hpp>
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the IA32_VMX_TRUE_PROCBASED_CTLS MSR
+    constexpr auto IA32_VMX_TRUE_PROCBASED_CTLS{0x0000048E_u32};
+    /// @brief defines the IA32_VMX_PROCBASED_CTLS2 MSR
+    constexpr auto IA32_VMX_PROCBASED_CTLS2{0x0000048B_u32};
+    /// @brief defines the shift of the allowed-1 settings in a VMX control MSR
+    constexpr auto VMX_CTLS_ALLOWED1_SHIFT{32_u64};
+
+    /// @brief defines the "use TPR shadow" primary processor-based control
+    constexpr auto VMX_PROC_USE_TPR_SHADOW{0x00200000_u64};
+    /// @brief defines the "virtualize APIC accesses" secondary control
+    constexpr auto VMX_PROC2_VIRTUALIZE_APIC_ACCESSES{0x00000001_u64};
+    /// @brief defines the "APIC-register virtualization" secondary control
+    constexpr auto VMX_PROC2_APIC_REGISTER_VIRTUALIZATION{0x00000100_u64};
+    /// @brief defines the "virtual-interrupt delivery" secondary control
+    constexpr auto VMX_PROC2_VIRTUAL_INTERRUPT_DELIVERY{0x00000200_u64};
+    /// @brief defines all of the secondary controls APICv needs
+    constexpr auto VMX_PROC2_APICV{
+        VMX_PROC2_VIRTUALIZE_APIC_ACCESSES | VMX_PROC2_APIC_REGISTER_VIRTUALIZATION |
+        VMX_PROC2_VIRTUAL_INTERRUPT_DELIVERY};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU can shadow a guest's TPR in a
+    ///     virtual-APIC page, which lets the guest access CR8 without a
+    ///     VMExit. This is the allowed-1 setting of "use TPR shadow" in
+    ///     IA32_VMX_TRUE_PROCBASED_CTLS.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @return Returns true if the CPU supports the TPR shadow, false
+    ///     otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_tpr_shadow_supported(syscall::bf_syscall_t &mut_sys) noexcept -> bool
+    {
+        auto const ctls{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_TRUE_PROCBASED_CTLS)};
+        if (ctls.is_invalid()) {
+            return false;
+        }
+
+        return ((ctls >> VMX_CTLS_ALLOWED1_SHIFT) & VMX_PROC_USE_TPR_SHADOW).is_pos();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports APICv, meaning that it can
+    ///     virtualize APIC accesses and APIC registers, and deliver
+    ///     virtual interrupts from the virtual-APIC page on its own. This
+    ///     requires the TPR shadow as well as the allowed-1 settings of
+    ///     all three controls in IA32_VMX_PROCBASED_CTLS2.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @return Returns true if the CPU supports APICv, false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_apicv_supported(syscall::bf_syscall_t &mut_sys) noexcept -> bool
+    {
+        if (!is_tpr_shadow_supported(mut_sys)) {
+            return false;
+        }
+
+        auto const ctls2{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_PROCBASED_CTLS2)};
+        if (ctls2.is_invalid()) {
+            return false;
+        }
+
+        return ((ctls2 >> VMX_CTLS_ALLOWED1_SHIFT) & VMX_PROC2_APICV) == VMX_PROC2_APICV;
+    }
+}
+
+#endif
@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IS_PLE_SUPPORTED_HPP
+#define IS_PLE_SUPPORTED_HPP
+
+#include <bf_syscall_t.hpp>
+#include <is_apicv_supported.hpp>
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the "PAUSE-loop exiting" secondary control
+    constexpr auto VMX_PROC2_PAUSE_LOOP_EXITING{0x00000400_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports PAUSE-loop exiting, which
+    ///     causes a VMExit when a guest spins in a PAUSE loop for longer
+    ///     than the PLE_Window. This is the allowed-1 setting of
+    ///     "PAUSE-loop exiting" in IA32_VMX_PROCBASED_CTLS2.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @return Returns true if the CPU supports PAUSE-loop exiting,
+    ///     false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_ple_supported(syscall::bf_syscall_t &mut_sys) noexcept -> bool
+    {
+        auto const ctls2{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_PROCBASED_CTLS2)};
+        if (ctls2.is_invalid()) {
+            return false;
+        }
+
+        return ((ctls2 >> VMX_CTLS_ALLOWED1_SHIFT) & VMX_PROC2_PAUSE_LOOP_EXITING).is_pos();
+    }
+}
+
+#endif
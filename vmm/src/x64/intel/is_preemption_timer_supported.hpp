@@ -0,0 +1,105 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IS_PREEMPTION_TIMER_SUPPORTED_HPP
+#define IS_PREEMPTION_TIMER_SUPPORTED_HPP
+
+#include <bf_syscall_t.hpp>
+#include <is_apicv_supported.hpp>
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the IA32_VMX_MISC MSR
+    constexpr auto IA32_VMX_MISC{0x00000485_u32};
+    /// @brief defines the IA32_VMX_TRUE_PINBASED_CTLS MSR
+    constexpr auto IA32_VMX_TRUE_PINBASED_CTLS{0x0000048D_u32};
+    /// @brief defines the IA32_VMX_TRUE_EXIT_CTLS MSR
+    constexpr auto IA32_VMX_TRUE_EXIT_CTLS{0x0000048F_u32};
+
+    /// @brief defines the "activate VMX-preemption timer" pin-based control
+    constexpr auto VMX_PIN_PREEMPTION_TIMER{0x00000040_u64};
+    /// @brief defines the "save VMX-preemption timer value" exit control
+    constexpr auto VMX_EXIT_SAVE_PREEMPTION_TIMER{0x00400000_u64};
+    /// @brief defines the bits of IA32_VMX_MISC that store the timer's rate
+    constexpr auto VMX_MISC_PREEMPTION_TIMER_RATE{0x0000001F_u64};
+    /// @brief defines the largest value the VMX-preemption timer can hold
+    constexpr auto VMX_PREEMPTION_TIMER_MAX{0xFFFFFFFF_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports the VMX-preemption timer,
+    ///     along with saving its value on VMExit so that it keeps counting
+    ///     down across VMExits that go straight back to the guest. These
+    ///     are the allowed-1 settings of "activate VMX-preemption timer"
+    ///     in IA32_VMX_TRUE_PINBASED_CTLS and of "save VMX-preemption
+    ///     timer value" in IA32_VMX_TRUE_EXIT_CTLS.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @return Returns true if the CPU supports the VMX-preemption
+    ///     timer, false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_preemption_timer_supported(syscall::bf_syscall_t &mut_sys) noexcept -> bool
+    {
+        auto const pin_ctls{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_TRUE_PINBASED_CTLS)};
+        if (pin_ctls.is_invalid()) {
+            return false;
+        }
+
+        if (((pin_ctls >> VMX_CTLS_ALLOWED1_SHIFT) & VMX_PIN_PREEMPTION_TIMER).is_zero()) {
+            return false;
+        }
+
+        auto const exit_ctls{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_TRUE_EXIT_CTLS)};
+        if (exit_ctls.is_invalid()) {
+            return false;
+        }
+
+        return ((exit_ctls >> VMX_CTLS_ALLOWED1_SHIFT) & VMX_EXIT_SAVE_PREEMPTION_TIMER).is_pos();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the rate of the VMX-preemption timer, which
+    ///     counts down by 1 each time bit "rate" of the TSC changes.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @return Returns the rate of the VMX-preemption timer, or
+    ///     bsl::safe_u64::failure() on failure.
+    ///
+    [[nodiscard]] constexpr auto
+    get_preemption_timer_rate(syscall::bf_syscall_t &mut_sys) noexcept -> bsl::safe_u64
+    {
+        auto const misc{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_MISC)};
+        if (misc.is_invalid()) {
+            return bsl::safe_u64::failure();
+        }
+
+        return misc & VMX_MISC_PREEMPTION_TIMER_RATE;
+    }
+}
+
+#endif
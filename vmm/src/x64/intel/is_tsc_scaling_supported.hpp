@@ -0,0 +1,69 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IS_TSC_SCALING_SUPPORTED_HPP
+#define IS_TSC_SCALING_SUPPORTED_HPP
+
+#include <bf_syscall_t.hpp>
+#include <is_apicv_supported.hpp>
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the "use TSC offsetting" primary control
+    constexpr auto VMX_PROC_USE_TSC_OFFSETTING{0x00000008_u64};
+    /// @brief defines the "enable RDTSCP" secondary control
+    constexpr auto VMX_PROC2_ENABLE_RDTSCP{0x00000008_u64};
+    /// @brief defines the "use TSC scaling" secondary control
+    constexpr auto VMX_PROC2_USE_TSC_SCALING{0x02000000_u64};
+    /// @brief defines the number of fractional bits in the TSC multiplier
+    constexpr auto VMX_TSC_MULTIPLIER_FRAC_BITS{48_u64};
+    /// @brief defines the TSC multiplier that leaves the TSC unscaled
+    constexpr auto VMX_TSC_MULTIPLIER_ONE{0x0001000000000000_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns true if the CPU supports TSC scaling, which
+    ///     multiplies the TSC seen by the guest by the TSC multiplier
+    ///     before the TSC offset is added. This is the allowed-1 setting
+    ///     of "use TSC scaling" in IA32_VMX_PROCBASED_CTLS2.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_sys the bf_syscall_t to use
+    ///   @return Returns true if the CPU supports TSC scaling, false
+    ///     otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_tsc_scaling_supported(syscall::bf_syscall_t &mut_sys) noexcept -> bool
+    {
+        auto const ctls2{mut_sys.bf_intrinsic_op_rdmsr(IA32_VMX_PROCBASED_CTLS2)};
+        if (ctls2.is_invalid()) {
+            return false;
+        }
+
+        return ((ctls2 >> VMX_CTLS_ALLOWED1_SHIFT) & VMX_PROC2_USE_TSC_SCALING).is_pos();
+    }
+}
+
+#endif
@@ -0,0 +1,168 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MSR_TABLE_HPP
+#define MSR_TABLE_HPP
+
+#include <bf_syscall_t.hpp>
+#include <msr_desc_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// @brief defines the size of an MSR bitmap
+    constexpr auto MSRPM_SIZE{0x1000_umx};
+    /// @brief defines the first MSR in the high range of an MSR bitmap
+    constexpr auto MSRPM_HIGH_BASE{0xC0000000_u64};
+    /// @brief defines the last MSR covered by each range of an MSR bitmap
+    constexpr auto MSRPM_RANGE_MASK{0x1FFF_u64};
+    /// @brief defines the offset of the read bitmap for the high range
+    constexpr auto MSRPM_READ_HIGH{0x400_u64};
+    /// @brief defines the offset of the write bitmaps from the read bitmaps
+    constexpr auto MSRPM_WRITE{0x800_u64};
+
+    /// @brief stores the total number of MSRs MicroV handles
+    constexpr auto MSR_TABLE_SIZE{22_umx};
+
+    /// NOTE:
+    /// - MSR_TABLE describes every MSR MicroV handles for a guest and must
+    ///   remain sorted by address. MSRs with a reg are stored in the VMCS
+    ///   (or swapped by the microkernel on every exit), so they can be
+    ///   passed through. EFER is stored in the VMCS too, but it is still
+    ///   trapped so that MicroV controls what the guest can enable.
+    ///   Everything else is emulated by MicroV.
+    ///
+
+    /// @brief stores the descriptor of every MSR MicroV handles
+    constexpr bsl::array<msr_desc_t, MSR_TABLE_SIZE.get()> MSR_TABLE{{
+        {MSR_APIC_BASE.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_BIOS_SIGN_ID.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_SYSENTER_CS.get(), syscall::bf_reg_t::bf_reg_t_sysenter_cs, true},
+        {MSR_SYSENTER_ESP.get(), syscall::bf_reg_t::bf_reg_t_sysenter_esp, true},
+        {MSR_SYSENTER_EIP.get(), syscall::bf_reg_t::bf_reg_t_sysenter_eip, true},
+        {MSR_MCG_CAP.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_MCG_STATUS.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_MISC_ENABLE.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_PAT.get(), syscall::bf_reg_t::bf_reg_t_pat, true},
+        {MSR_TSC_DEADLINE.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_WALL_CLOCK_NEW.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_SYSTEM_TIME_NEW.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_STEAL_TIME.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_KVM_PV_EOI_EN.get(), syscall::bf_reg_t::bf_reg_t_unsupported, false},
+        {MSR_EFER.get(), syscall::bf_reg_t::bf_reg_t_efer, false},
+        {MSR_STAR.get(), syscall::bf_reg_t::bf_reg_t_star, true},
+        {MSR_LSTAR.get(), syscall::bf_reg_t::bf_reg_t_lstar, true},
+        {MSR_CSTAR.get(), syscall::bf_reg_t::bf_reg_t_cstar, true},
+        {MSR_FMASK.get(), syscall::bf_reg_t::bf_reg_t_fmask, true},
+        {MSR_FS_BASE.get(), syscall::bf_reg_t::bf_reg_t_fs_base, true},
+        {MSR_GS_BASE.get(), syscall::bf_reg_t::bf_reg_t_gs_base, true},
+        {MSR_KERNEL_GS_BASE.get(), syscall::bf_reg_t::bf_reg_t_kernel_gs_base, true},
+    }};
+
+    static_assert(is_msr_table_sorted(MSR_TABLE));
+
+    /// <!-- description -->
+    ///   @brief Returns the descriptor of the requested MSR. If MicroV
+    ///     does not handle the MSR, a nullptr is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param msr the MSR to look up
+    ///   @return Returns the descriptor of the requested MSR. If MicroV
+    ///     does not handle the MSR, a nullptr is returned.
+    ///
+    [[nodiscard]] constexpr auto
+    msr_desc(bsl::safe_u64 const &msr) noexcept -> msr_desc_t const *
+    {
+        return find_msr_desc(MSR_TABLE, msr);
+    }
+
+    /// <!-- description -->
+    ///   @brief Stops guest reads and writes of the requested MSR from
+    ///     exiting by clearing its bits in the provided MSR bitmap.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_msrpm the MSR bitmap to modify
+    ///   @param msr the MSR to pass through
+    ///
+    constexpr void
+    msrpm_passthrough(bsl::span<bsl::uint8> &mut_msrpm, bsl::safe_u64 const &msr) noexcept
+    {
+        constexpr auto bits_per_byte{8_u64};
+
+        bsl::safe_u64 mut_offset{};
+        if (msr >= MSRPM_HIGH_BASE) {
+            mut_offset = MSRPM_READ_HIGH;
+        }
+        else {
+            bsl::touch();
+        }
+
+        auto const idx{msr & MSRPM_RANGE_MASK};
+        auto const rd{(mut_offset + (idx / bits_per_byte)).checked()};
+        auto const wr{(rd + MSRPM_WRITE).checked()};
+        auto const mask{~(1_u64 << (idx % bits_per_byte))};
+
+        auto *const pmut_rd{mut_msrpm.at_if(bsl::to_idx(rd))};
+        auto *const pmut_wr{mut_msrpm.at_if(bsl::to_idx(wr))};
+        bsl::expects(nullptr != pmut_rd);
+        bsl::expects(nullptr != pmut_wr);
+
+        *pmut_rd = bsl::to_u8_unsafe(bsl::to_u64(*pmut_rd) & mask).get();
+        *pmut_wr = bsl::to_u8_unsafe(bsl::to_u64(*pmut_wr) & mask).get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Initializes a guest MSR bitmap from MSR_TABLE. Every MSR
+    ///     exits unless its descriptor says it can be passed through.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_msrpm the MSR bitmap to initialize
+    ///
+    constexpr void
+    msrpm_init(bsl::span<bsl::uint8> &mut_msrpm) noexcept
+    {
+        bsl::expects(mut_msrpm.size() == MSRPM_SIZE);
+
+        for (auto &mut_elem : mut_msrpm) {
+            mut_elem = bsl::safe_u8::max_value().get();
+        }
+
+        for (auto const &desc : MSR_TABLE) {
+            if (desc.passthrough) {
+                msrpm_passthrough(mut_msrpm, bsl::to_u64(desc.msr));
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    }
+}
+
+#endif
@@ -29,18 +29,24 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <mv_stats_t.hpp>
+#include <mv_trace_t.hpp>
 #include <pp_cpuid_t.hpp>
 #include <pp_lapic_t.hpp>
 #include <pp_mmio_t.hpp>
 #include <pp_msr_t.hpp>
 #include <pp_mtrrs_t.hpp>
 #include <pp_reg_t.hpp>
+#include <stats_t.hpp>
 #include <tls_t.hpp>
+#include <trace_t.hpp>
 
+#include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace microv
 {
@@ -66,6 +72,10 @@ namespace microv
         pp_mtrrs_t m_pp_mtrrs{};
         /// @brief stores this pp_t's pp_reg_t
         pp_reg_t m_pp_reg{};
+        /// @brief stores this pp_t's VMExit and hypercall statistics
+        stats_t m_stats{};
+        /// @brief stores this pp_t's trace ring
+        trace_t m_trace{};
 
         /// @brief stores the TSC frequency in KHz of this pp_t
         bsl::safe_u64 m_tsc_khz{};
@@ -117,6 +127,7 @@ namespace microv
             syscall::bf_syscall_t &mut_sys,
             intrinsic_t const &intrinsic) noexcept
         {
+            m_trace.clr_spa(mut_sys);
             m_pp_reg.release(gs, tls, mut_sys, intrinsic);
             m_pp_mtrrs.release(gs, tls, mut_sys, intrinsic);
             m_pp_msr.release(gs, tls, mut_sys, intrinsic);
@@ -147,27 +158,33 @@ namespace microv
         /// <!-- inputs/outputs -->
         ///   @param gs the gs_t to use
         ///   @param tls the tls_t to use
-        ///   @param sys the bf_syscall_t to use
+        ///   @param mut_sys the bf_syscall_t to use
         ///   @param page_pool the page_pool_t to use
         ///   @param intrinsic the intrinsic_t to use
-        ///   @return Returns ID of this pp_t
+        ///   @return Returns ID of this pp_t, or bsl::safe_u16::failure()
+        ///     on failure.
         ///
         [[nodiscard]] constexpr auto
         allocate(
             gs_t const &gs,
             tls_t const &tls,
-            syscall::bf_syscall_t const &sys,
+            syscall::bf_syscall_t &mut_sys,
             page_pool_t const &page_pool,
-            intrinsic_t const &intrinsic) const noexcept -> bsl::safe_u16
+            intrinsic_t const &intrinsic) noexcept -> bsl::safe_u16
         {
             bsl::expects(this->id() != syscall::BF_INVALID_ID);
 
             bsl::discard(gs);
             bsl::discard(tls);
-            bsl::discard(sys);
             bsl::discard(page_pool);
             bsl::discard(intrinsic);
 
+            auto const stats_ret{m_stats.allocate(mut_sys, false)};
+            if (bsl::unlikely(!stats_ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_u16::failure();
+            }
+
             /// TODO:
             /// - We need to detect all of the features that we need
             ///   support for here and error out if the CPU does not
@@ -212,6 +229,85 @@ namespace microv
             return m_pp_mmio.set_shared_page_spa(mut_sys, spa);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided SPA is already mapped by
+        ///     this pp_t as either its shared page or its trace ring. An
+        ///     SPA can only be mapped once per PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param spa the system physical address to check
+        ///   @return Returns true if the provided SPA is already mapped by
+        ///     this pp_t as either its shared page or its trace ring.
+        ///
+        [[nodiscard]] constexpr auto
+        is_spa_mapped(bsl::safe_u64 const &spa) const noexcept -> bool
+        {
+            bsl::expects(this->id() != syscall::BF_INVALID_ID);
+
+            if (spa == m_pp_mmio.shared_page_spa()) {
+                return true;
+            }
+
+            return spa == m_trace.spa();
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the SPA of the trace ring associated with
+        ///     this pp_t, disabling tracing on this pp_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///
+        constexpr void
+        clr_trace_spa(syscall::bf_syscall_t &mut_sys) noexcept
+        {
+            bsl::expects(this->id() != syscall::BF_INVALID_ID);
+            m_trace.clr_spa(mut_sys);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the SPA of the trace ring associated with
+        ///     this pp_t, enabling tracing on this pp_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param spa the system physical address of the trace ring
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_trace_spa(syscall::bf_syscall_t &mut_sys, bsl::safe_u64 const &spa) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(this->id() != syscall::BF_INVALID_ID);
+            return m_trace.set_spa(mut_sys, spa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if tracing is enabled on this pp_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if tracing is enabled on this pp_t.
+        ///
+        [[nodiscard]] constexpr auto
+        trace_enabled() const noexcept -> bool
+        {
+            return m_trace.is_enabled();
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds an entry to this pp_t's trace ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param entry the entry to add
+        ///
+        constexpr void
+        trace_add(intrinsic_t const &intrinsic, hypercall::mv_trace_entry_t const &entry) noexcept
+        {
+            m_trace.add(intrinsic, entry);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the pp_t's TSC frequency in KHz.
         ///
@@ -247,6 +343,45 @@ namespace microv
             m_tsc_khz = tsc_khz;
         }
 
+        /// <!-- description -->
+        ///   @brief Counts a VMExit in this pp_t's statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles spent handling the VMExit
+        ///
+        constexpr void
+        stats_add_exit(bsl::safe_u64 const &reason, bsl::safe_u64 const &cycles) noexcept
+        {
+            m_stats.add_exit(reason, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Counts a hypercall in this pp_t's statistics.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the slot of the hypercall
+        ///   @param cycles the number of cycles spent handling the hypercall
+        ///
+        constexpr void
+        stats_add_hypercall(bsl::safe_u64 const &slot, bsl::safe_u64 const &cycles) noexcept
+        {
+            m_stats.add_hypercall(slot, cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this pp_t's statistics of the provided type.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type the MV_STATS_TYPE of the statistics to return
+        ///   @return Returns the requested statistics
+        ///
+        [[nodiscard]] constexpr auto
+        stats_get(bsl::safe_u64 const &type) const noexcept -> hypercall::mv_stats_t const *
+        {
+            return m_stats.get(type);
+        }
+
         /// <!-- description -->
         ///   @brief Returns a pp_unique_map_t<T> given an SPA to map. If an
         ///     error occurs, an invalid pp_unique_map_t<T> is returned.
@@ -27,12 +27,17 @@
 
 #include <gs_t.hpp>
 #include <intrinsic_cpuid_impl.hpp>
+#include <intrinsic_rdtsc_impl.hpp>
+#include <intrinsic_store64_impl.hpp>
+#include <intrinsic_xchg8_impl.hpp>
 #include <intrinsic_xrstr_impl.hpp>
 #include <intrinsic_xsave_impl.hpp>
+#include <intrinsic_xsaveopt_impl.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
 
 namespace microv
@@ -78,6 +83,21 @@ namespace microv
             intrinsic_xsave_impl(pmut_xsave);
         }
 
+        /// <!-- description -->
+        ///   @brief Executes the XSAVEOPT instruction given the provided
+        ///     address to the xsave region. Unlike XSAVE, XSAVEOPT skips
+        ///     state components that are in their init state, or that have
+        ///     not been modified since the last XRSTOR from the same region.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_xsave a pointer to the xsave region to use
+        ///
+        static constexpr void
+        xsaveopt(void *const pmut_xsave) noexcept
+        {
+            intrinsic_xsaveopt_impl(pmut_xsave);
+        }
+
         /// <!-- description -->
         ///   @brief Executes the XRSTOR instruction given the provided address
         ///     to the xsave region.
@@ -90,6 +110,55 @@ namespace microv
         {
             intrinsic_xrstr_impl(pmut_xsave);
         }
+
+        /// <!-- description -->
+        ///   @brief Executes the RDTSC instruction and returns the result.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current value of the TSC
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_u64
+        {
+            return bsl::safe_u64{intrinsic_rdtsc_impl()};
+        }
+
+        /// <!-- description -->
+        ///   @brief Atomically exchanges the byte at the provided address
+        ///     with the provided value, and returns the byte's old value.
+        ///     This is used for bytes in guest memory that a guest VS
+        ///     running on another PP can change at the same time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_byte a pointer to the byte to exchange
+        ///   @param val the value to store in the byte
+        ///   @return Returns the value the byte had before the exchange
+        ///
+        [[nodiscard]] static constexpr auto
+        xchg8(bsl::uint8 *const pmut_byte, bsl::safe_u8 const &val) noexcept -> bsl::safe_u8
+        {
+            bsl::expects(nullptr != pmut_byte);
+            return bsl::safe_u8{intrinsic_xchg8_impl(pmut_byte, val.get())};
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores the provided value to the qword at the provided
+        ///     address. This is used to publish a value to memory that is
+        ///     shared with the root VM after everything the value refers to
+        ///     has been written. x86 does not reorder stores with other
+        ///     stores, and since the store is out-of-line, neither can the
+        ///     compiler.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_qword a pointer to the qword to store to
+        ///   @param val the value to store in the qword
+        ///
+        static constexpr void
+        store64(bsl::uint64 *const pmut_qword, bsl::safe_u64 const &val) noexcept
+        {
+            bsl::expects(nullptr != pmut_qword);
+            intrinsic_store64_impl(pmut_qword, val.get());
+        }
     };
 }
 
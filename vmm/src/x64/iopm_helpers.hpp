@@ -0,0 +1,122 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef IOPM_HELPERS_HPP
+#define IOPM_HELPERS_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
+
+namespace microv
+{
+    /// @brief defines the total number of IO ports
+    constexpr auto IO_NUM_PORTS{0x10000_u64};
+    /// @brief defines the number of bytes needed to store one bit per IO port
+    constexpr auto IO_BITMAP_SIZE{0x2000_umx};
+
+    /// NOTE:
+    /// - Intel's IO bitmaps A and B and AMD's IOPM both store one bit
+    ///   per port, starting with port 0, with a set bit causing an exit.
+    ///   As long as bitmaps A and B are allocated next to each other,
+    ///   the first IO_BITMAP_SIZE bytes of an IO permissions map look
+    ///   the same on both, which is what the following operates on.
+    ///
+
+    /// <!-- description -->
+    ///   @brief Sets or clears the bit for the requested port in the
+    ///     provided IO bitmap.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of IO bitmap to modify (span or array)
+    ///   @param mut_bitmap the IO bitmap to modify
+    ///   @param port the port whose bit is being set or cleared
+    ///   @param set true to set the bit, false to clear it
+    ///
+    template<typename T>
+    constexpr void
+    io_bitmap_set(T &mut_bitmap, bsl::safe_u64 const &port, bool const set) noexcept
+    {
+        constexpr auto bits_per_byte{8_u64};
+
+        bsl::expects(port < IO_NUM_PORTS);
+
+        auto const bit{1_u64 << (port % bits_per_byte)};
+        auto *const pmut_byte{mut_bitmap.at_if(bsl::to_idx(port / bits_per_byte))};
+        bsl::expects(nullptr != pmut_byte);
+
+        if (set) {
+            *pmut_byte = bsl::to_u8_unsafe(bsl::to_u64(*pmut_byte) | bit).get();
+        }
+        else {
+            *pmut_byte = bsl::to_u8_unsafe(bsl::to_u64(*pmut_byte) & ~bit).get();
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the bit for the requested port is set in
+    ///     the provided IO bitmap, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam T the type of IO bitmap to read (span or array)
+    ///   @param bitmap the IO bitmap to read
+    ///   @param port the port whose bit is being read
+    ///   @return Returns true if the bit for the requested port is set in
+    ///     the provided IO bitmap, false otherwise.
+    ///
+    template<typename T>
+    [[nodiscard]] constexpr auto
+    io_bitmap_test(T const &bitmap, bsl::safe_u64 const &port) noexcept -> bool
+    {
+        constexpr auto bits_per_byte{8_u64};
+
+        bsl::expects(port < IO_NUM_PORTS);
+
+        auto const bit{1_u64 << (port % bits_per_byte)};
+        auto const *const byte{bitmap.at_if(bsl::to_idx(port / bits_per_byte))};
+        bsl::expects(nullptr != byte);
+
+        return (bsl::to_u64(*byte) & bit).is_pos();
+    }
+
+    /// <!-- description -->
+    ///   @brief Initializes an IO permissions map so that every port
+    ///     exits.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_iopm the IO permissions map to initialize
+    ///
+    constexpr void
+    iopm_init(bsl::span<bsl::uint8> &mut_iopm) noexcept
+    {
+        bsl::expects(mut_iopm.size() >= IO_BITMAP_SIZE);
+
+        for (auto &mut_elem : mut_iopm) {
+            mut_elem = bsl::safe_u8::max_value().get();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,404 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef KVM_PV_MAILBOX_T_HPP
+#define KVM_PV_MAILBOX_T_HPP
+
+#include <lock_guard_t.hpp>
+#include <spinlock_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// @brief defines the number of vectors a VS can be sent
+    constexpr auto KVM_PV_MAILBOX_NUM_VECTORS{256_u64};
+    /// @brief defines the number of vectors stored in each mailbox word
+    constexpr auto KVM_PV_MAILBOX_VECTORS_PER_WORD{64_u64};
+    /// @brief defines the shift that turns a vector into a mailbox word
+    constexpr auto KVM_PV_MAILBOX_WORD_SHIFT{6_u64};
+    /// @brief defines the number of mailbox words each VS has
+    constexpr auto KVM_PV_MAILBOX_WORDS{4_u64};
+
+    /// @class microv::kvm_pv_mailbox_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the per-VM mailboxes that KVM's paravirtual
+    ///     hypercalls (KVM_HC_SEND_IPI and KVM_HC_KICK_CPU) post to. A VS
+    ///     can only be touched from the PP it is assigned to, so a VS
+    ///     sending an IPI or kick records it here under the target's
+    ///     APIC ID, and the target picks it up the next time it looks for
+    ///     interrupts, the same as it does for the IOAPIC. Fixed IPIs
+    ///     coalesce per vector, the same as they would in the target's
+    ///     IRR. A target that is halted in the root VM (see halt()) only
+    ///     looks again once it is run, so posting to it also records
+    ///     that the root VM has to wake it up (see take_wakeup()).
+    ///
+    class kvm_pv_mailbox_t final
+    {
+        /// @brief safe guards the mailboxes
+        mutable spinlock_t m_lock{};
+
+        /// @brief stores the fixed vectors sent to each APIC ID
+        bsl::array<bsl::safe_u64, (HYPERVISOR_MAX_VSS * KVM_PV_MAILBOX_WORDS).checked().get()>
+            m_vectors{};
+        /// @brief stores whether an NMI was sent to each APIC ID
+        bsl::array<bool, HYPERVISOR_MAX_VSS.get()> m_nmi{};
+        /// @brief stores whether each APIC ID was kicked (KVM_HC_KICK_CPU)
+        bsl::array<bool, HYPERVISOR_MAX_VSS.get()> m_kicked{};
+        /// @brief stores whether each APIC ID is halted in the root VM
+        bsl::array<bool, HYPERVISOR_MAX_VSS.get()> m_halted{};
+        /// @brief stores whether a halted APIC ID was posted to
+        bool m_wakeup{};
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the mailbox word that holds the
+        ///     provided vector for the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param apic_id the APIC ID to query
+        ///   @param vector the vector to query
+        ///   @return Returns the index of the mailbox word that holds the
+        ///     provided vector for the provided APIC ID.
+        ///
+        [[nodiscard]] static constexpr auto
+        word(bsl::safe_u64 const &apic_id, bsl::safe_u64 const &vector) noexcept -> bsl::safe_idx
+        {
+            auto const first{(apic_id * KVM_PV_MAILBOX_WORDS).checked()};
+            return bsl::to_idx((first + (vector >> KVM_PV_MAILBOX_WORD_SHIFT)).checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Records that the root VM has to wake up the provided
+        ///     APIC ID if it is halted. The lock must be held.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param apic_id the APIC ID that was posted to
+        ///
+        constexpr void
+        posted(bsl::safe_u64 const &apic_id) noexcept
+        {
+            if (*m_halted.at_if(bsl::to_idx(apic_id))) {
+                m_wakeup = true;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Empties all of the mailboxes. This is called when the
+        ///     VM they belong to is destroyed so that the next VM does not
+        ///     inherit IPIs that were never delivered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///
+        constexpr void
+        deallocate(tls_t const &tls) noexcept
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            m_vectors = {};
+            m_nmi = {};
+            m_kicked = {};
+            m_halted = {};
+            m_wakeup = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Posts a fixed IPI to the provided APIC ID. Returns
+        ///     false if no VS can have the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to send the IPI to
+        ///   @param vector the vector of the IPI
+        ///   @return Returns true if the IPI was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        send(tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u64 const &vector) noexcept
+            -> bool
+        {
+            if ((apic_id >= HYPERVISOR_MAX_VSS) || (vector >= KVM_PV_MAILBOX_NUM_VECTORS)) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto *const pmut_word{m_vectors.at_if(word(apic_id, vector))};
+            *pmut_word |= (1_u64 << (vector & (KVM_PV_MAILBOX_VECTORS_PER_WORD - 1_u64)));
+
+            this->posted(apic_id);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Posts an NMI to the provided APIC ID. Returns false if
+        ///     no VS can have the provided APIC ID. Like a kick, an NMI
+        ///     wakes the VS up from a HLT, so the APIC ID is kicked too.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to send the NMI to
+        ///   @return Returns true if the NMI was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        send_nmi(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            *m_nmi.at_if(bsl::to_idx(apic_id)) = true;
+            *m_kicked.at_if(bsl::to_idx(apic_id)) = true;
+
+            this->posted(apic_id);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Kicks the provided APIC ID, which wakes it up from a
+        ///     HLT, even one executed with interrupts disabled. Returns
+        ///     false if no VS can have the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to kick
+        ///   @return Returns true if the kick was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        kick(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            *m_kicked.at_if(bsl::to_idx(apic_id)) = true;
+
+            this->posted(apic_id);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the provided APIC ID as halted in the root VM,
+        ///     so that posting to it from now on records a wakeup. Returns
+        ///     false without marking it if something was already posted
+        ///     to it, in which case it should not halt at all.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS halting
+        ///   @return Returns true if the APIC ID was marked as halted,
+        ///     false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        halt(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const idx{bsl::to_idx(apic_id)};
+            if (*m_nmi.at_if(idx) || *m_kicked.at_if(idx)) {
+                return false;
+            }
+
+            for (bsl::safe_u64 mut_i{}; mut_i < KVM_PV_MAILBOX_WORDS; ++mut_i) {
+                auto const first{(mut_i << KVM_PV_MAILBOX_WORD_SHIFT).checked()};
+                if (m_vectors.at_if(word(apic_id, first))->is_pos()) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            *m_halted.at_if(idx) = true;
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the provided APIC ID as no longer halted. This
+        ///     is called each time its VS is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS being run
+        ///
+        constexpr void
+        unhalt(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+            *m_halted.at_if(bsl::to_idx(apic_id)) = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if something was posted to a halted APIC
+        ///     ID that has not been collected using take_wakeup() yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if a wakeup is pending, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        wakeup_pending(tls_t const &tls) const noexcept -> bool
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            return m_wakeup;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if something was posted to a halted APIC
+        ///     ID since this was last called, and consumes the wakeup.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if the root VM has to wake up the
+        ///     VM's halted VSs, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        take_wakeup(tls_t const &tls) noexcept -> bool
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            bool const wakeup{m_wakeup};
+            m_wakeup = false;
+
+            return wakeup;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector posted to the provided APIC
+        ///     ID and removes it from its mailbox. If there is nothing to
+        ///     deliver, bsl::safe_u64::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns the vector to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        ack(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bsl::safe_u64
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return bsl::safe_u64::failure();
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            for (auto mut_i{KVM_PV_MAILBOX_WORDS}; mut_i.is_pos(); --mut_i) {
+                auto const idx{(mut_i - 1_u64).checked()};
+                auto const first{(idx << KVM_PV_MAILBOX_WORD_SHIFT).checked()};
+                auto *const pmut_word{m_vectors.at_if(word(apic_id, first))};
+
+                if (pmut_word->is_zero()) {
+                    continue;
+                }
+
+                for (auto mut_bit{KVM_PV_MAILBOX_VECTORS_PER_WORD}; mut_bit.is_pos(); --mut_bit) {
+                    auto const mask{1_u64 << (mut_bit - 1_u64).checked()};
+                    if ((*pmut_word & mask).is_pos()) {
+                        *pmut_word &= ~mask;
+                        return (first + (mut_bit - 1_u64)).checked();
+                    }
+
+                    bsl::touch();
+                }
+            }
+
+            return bsl::safe_u64::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an NMI was posted to the provided APIC
+        ///     ID, and removes it from its mailbox.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns true if an NMI was posted to the provided APIC
+        ///     ID, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        ack_nmi(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto *const pmut_nmi{m_nmi.at_if(bsl::to_idx(apic_id))};
+            bool const nmi{*pmut_nmi};
+            *pmut_nmi = false;
+
+            return nmi;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided APIC ID was kicked, and
+        ///     consumes the kick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns true if the provided APIC ID was kicked,
+        ///     false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        ack_kick(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            if (apic_id >= HYPERVISOR_MAX_VSS) {
+                return false;
+            }
+
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto *const pmut_kicked{m_kicked.at_if(bsl::to_idx(apic_id))};
+            bool const kicked{*pmut_kicked};
+            *pmut_kicked = false;
+
+            return kicked;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,180 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MSR_DESC_T_HPP
+#define MSR_DESC_T_HPP
+
+#include <bf_syscall_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace microv
+{
+    /// @brief defines the APIC_BASE MSR
+    constexpr auto MSR_APIC_BASE{0x0000001B_u32};
+    /// @brief defines the BIOS_SIGN_ID (microcode revision) MSR
+    constexpr auto MSR_BIOS_SIGN_ID{0x0000008B_u32};
+    /// @brief defines the SYSENTER_CS MSR
+    constexpr auto MSR_SYSENTER_CS{0x174_u32};
+    /// @brief defines the SYSENTER_ESP MSR
+    constexpr auto MSR_SYSENTER_ESP{0x175_u32};
+    /// @brief defines the SYSENTER_EIP MSR
+    constexpr auto MSR_SYSENTER_EIP{0x176_u32};
+    /// @brief defines the MCG_CAP MSR
+    constexpr auto MSR_MCG_CAP{0x179_u32};
+    /// @brief defines the MCG_STATUS MSR
+    constexpr auto MSR_MCG_STATUS{0x17A_u32};
+    /// @brief defines the MISC_ENABLE MSR
+    constexpr auto MSR_MISC_ENABLE{0x1A0_u32};
+    /// @brief defines the PAT MSR
+    constexpr auto MSR_PAT{0x277_u32};
+    /// @brief defines the TSC_DEADLINE MSR
+    constexpr auto MSR_TSC_DEADLINE{0x000006E0_u32};
+    /// @brief defines the MSR_KVM_WALL_CLOCK_NEW MSR
+    constexpr auto MSR_KVM_WALL_CLOCK_NEW{0x4B564D00_u32};
+    /// @brief defines the MSR_KVM_SYSTEM_TIME_NEW MSR
+    constexpr auto MSR_KVM_SYSTEM_TIME_NEW{0x4B564D01_u32};
+    /// @brief defines the MSR_KVM_STEAL_TIME MSR
+    constexpr auto MSR_KVM_STEAL_TIME{0x4B564D03_u32};
+    /// @brief defines the MSR_KVM_PV_EOI_EN MSR
+    constexpr auto MSR_KVM_PV_EOI_EN{0x4B564D04_u32};
+    /// @brief defines the EFER MSR
+    constexpr auto MSR_EFER{0xC0000080_u32};
+    /// @brief defines the STAR MSR
+    constexpr auto MSR_STAR{0xC0000081_u32};
+    /// @brief defines the LSTAR MSR
+    constexpr auto MSR_LSTAR{0xC0000082_u32};
+    /// @brief defines the CSTAR MSR
+    constexpr auto MSR_CSTAR{0xC0000083_u32};
+    /// @brief defines the FMASK MSR
+    constexpr auto MSR_FMASK{0xC0000084_u32};
+    /// @brief defines the FS_BASE MSR
+    constexpr auto MSR_FS_BASE{0xC0000100_u32};
+    /// @brief defines the GS_BASE MSR
+    constexpr auto MSR_GS_BASE{0xC0000101_u32};
+    /// @brief defines the KERNEL_GS_BASE MSR
+    constexpr auto MSR_KERNEL_GS_BASE{0xC0000102_u32};
+
+    /// @class microv::msr_desc_t
+    ///
+    /// <!-- description -->
+    ///   @brief Describes how MicroV handles a single MSR. The arch
+    ///     specific MSR_TABLE is made up of these descriptors and drives
+    ///     the guest MSR bitmaps, the vs_t MSR handlers and the list of
+    ///     MSRs reported as supported.
+    ///
+    struct msr_desc_t final
+    {
+        /// @brief stores the address of the MSR
+        bsl::uint32 msr;
+        /// @brief stores the register that holds the guest's copy of the
+        ///   MSR, or bf_reg_t_unsupported if MicroV emulates the MSR
+        syscall::bf_reg_t reg;
+        /// @brief stores true if guest accesses to the MSR do not exit
+        bool passthrough;
+    };
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided MSR table is sorted by MSR
+    ///     address with no duplicates, false otherwise.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the total number of entries in the table
+    ///   @param table the MSR table to check
+    ///   @return Returns true if the provided MSR table is sorted by MSR
+    ///     address with no duplicates, false otherwise.
+    ///
+    template<bsl::uintmx N>
+    [[nodiscard]] constexpr auto
+    is_msr_table_sorted(bsl::array<msr_desc_t, N> const &table) noexcept -> bool
+    {
+        msr_desc_t const *pmut_prev{};
+
+        for (auto const &desc : table) {
+            if (nullptr != pmut_prev) {
+                if (pmut_prev->msr >= desc.msr) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_prev = &desc;
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the descriptor of the requested MSR from the
+    ///     provided (sorted) MSR table. If the MSR is not in the table,
+    ///     a nullptr is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam N the total number of entries in the table
+    ///   @param table the MSR table to search
+    ///   @param msr the MSR to look up
+    ///   @return Returns the descriptor of the requested MSR from the
+    ///     provided (sorted) MSR table. If the MSR is not in the table,
+    ///     a nullptr is returned.
+    ///
+    template<bsl::uintmx N>
+    [[nodiscard]] constexpr auto
+    find_msr_desc(bsl::array<msr_desc_t, N> const &table, bsl::safe_u64 const &msr) noexcept
+        -> msr_desc_t const *
+    {
+        bsl::expects(msr.is_valid_and_checked());
+
+        bsl::safe_umx mut_lo{};
+        bsl::safe_umx mut_hi{table.size()};
+
+        while (mut_lo < mut_hi) {
+            auto const mid{((mut_lo + mut_hi) / 2_umx).checked()};
+            auto const *const desc{table.at_if(bsl::to_idx(mid))};
+
+            if (bsl::to_u64(desc->msr) == msr) {
+                return desc;
+            }
+
+            if (bsl::to_u64(desc->msr) < msr) {
+                mut_lo = (mid + 1_umx).checked();
+            }
+            else {
+                mut_hi = mid;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+#endif
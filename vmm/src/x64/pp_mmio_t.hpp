@@ -120,6 +120,8 @@ namespace microv
         bsl::safe_u16 m_assigned_ppid{};
         /// @brief stores the shared page associated with this pp_mmio_t
         page_4k_t *m_shared_page{};
+        /// @brief stores the SPA of the shared page, or 0 if it is not set
+        bsl::safe_u64 m_shared_page_spa{};
         /// @brief stores whether or not the shared page is in use.
         bool m_shared_page_in_use{};
         /// @brief stores the SPAs that have been mapped.
@@ -281,6 +283,7 @@ namespace microv
             if (nullptr != m_shared_page) {
                 bsl::expects(mut_sys.bf_vm_op_unmap_direct(vmid, m_shared_page));
                 m_shared_page = {};
+                m_shared_page_spa = {};
                 m_shared_page_in_use = {};
 
                 bsl::debug<bsl::V>()                                              // --
@@ -294,6 +297,20 @@ namespace microv
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the SPA of the shared page, or 0 if the shared
+        ///     page is not set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the SPA of the shared page, or 0 if the shared
+        ///     page is not set.
+        ///
+        [[nodiscard]] constexpr auto
+        shared_page_spa() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_shared_page_spa;
+        }
+
         /// <!-- description -->
         ///   @brief Sets the SPA of the shared page.
         ///
@@ -333,6 +350,8 @@ namespace microv
                 return bsl::errc_failure;
             }
 
+            m_shared_page_spa = spa;
+
             bsl::debug<bsl::V>()                                              // --
                 << "shared page for pp "                                      // --
                 << bsl::cyn << bsl::hex(this->assigned_ppid()) << bsl::rst    // --
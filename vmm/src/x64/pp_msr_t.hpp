@@ -28,10 +28,10 @@
 #include <bf_syscall_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <msr_table.hpp>
 #include <mv_rdl_t.hpp>
 #include <tls_t.hpp>
 
-#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
@@ -50,27 +50,6 @@ namespace microv
     {
         /// @brief stores the ID of the PP associated with this pp_msr_t
         bsl::safe_u16 m_assigned_ppid{};
-        /// @brief stores the total number of supported msrs
-        static constexpr auto num_supported_msrs{13_umx};
-        /// @brief stores the supported msrs
-        static constexpr const bsl::array<hypercall::mv_rdl_entry_t, num_supported_msrs.get()>
-            supported_msrs{{
-                {.reg = 0xC0000081UL, .val = 1UL},    // star
-                {.reg = 0xC0000082UL, .val = 1UL},    // lstar
-                {.reg = 0xC0000083UL, .val = 1UL},    // cstar
-                {.reg = 0xC0000084UL, .val = 1UL},    // fmask
-                {.reg = 0xC0000102UL, .val = 1UL},    // kernel_gs_base
-
-                {.reg = 0xC0000080UL, .val = 1UL},    // efer
-                {.reg = 0xC0000100UL, .val = 1UL},    // fs_base
-                {.reg = 0xC0000101UL, .val = 1UL},    // gs_base
-                {.reg = 0x00000174UL, .val = 1UL},    // sysenter_cs
-                {.reg = 0x00000175UL, .val = 1UL},    // sysenter_esp
-                {.reg = 0x00000176UL, .val = 1UL},    // sysenter_eip
-                {.reg = 0x00000277UL, .val = 1UL},    // pat
-
-                {.reg = 0x0000001BUL, .val = 1UL},    // apic_base
-            }};
 
     public:
         /// <!-- description -->
@@ -156,9 +135,9 @@ namespace microv
         ///   to 1 when the MSR is supported, and a read() does not report
         ///   a failure.
         ///
-        ///   For now, the only MSRs that should be reported as supported
-        ///   are MSRs that are in AMD's VMCB, and the APIC BASE. We can add
-        ///   more later as needed.
+        ///   The supported MSRs are the ones described by MSR_TABLE, which
+        ///   also drives the guest MSR permissions maps and the vs_t MSR
+        ///   handlers, so adding an MSR to the table is all that is needed.
         ///
 
         /// NOTE:
@@ -200,11 +179,9 @@ namespace microv
             -> hypercall::mv_rdl_entry_t
         {
             bsl::discard(sys);
-            for (auto const &entry : supported_msrs) {
-                if (entry.reg == bsl::to_u64(msr).get()) {
-                    return entry;
-                }
-                bsl::touch();
+
+            if (nullptr != msr_desc(bsl::to_u64(msr))) {
+                return {.reg = bsl::to_u64(msr).get(), .val = 1UL};
             }
 
             return {.reg = bsl::to_u64(msr).get(), .val = 0UL};
@@ -226,11 +203,11 @@ namespace microv
             bsl::expects(mut_sys.bf_tls_ppid() == this->assigned_ppid());
             auto const reg0_mask = ~(hypercall::MV_RDL_FLAG_ALL);
             bsl::expects((mut_rdl.reg0 & reg0_mask) == 0_u64);
-            if (bsl::unlikely(mut_rdl.reg1 >= supported_msrs.size())) {
+            if (bsl::unlikely(mut_rdl.reg1 >= MSR_TABLE.size())) {
                 bsl::error() << "rdl.reg1 "                                   // --
                              << mut_rdl.reg1                                  // --
                              << " >= "                                        // --
-                             << supported_msrs.size()                         // --
+                             << MSR_TABLE.size()                              // --
                              << ". The resume index in reg1 is too large."    // --
                              << bsl::endl                                     // --
                              << bsl::here();                                  // --
@@ -239,7 +216,7 @@ namespace microv
             }
 
             if ((mut_rdl.reg0 & hypercall::MV_RDL_FLAG_ALL).is_pos()) {
-                auto mut_num_entries{(supported_msrs.size() - mut_rdl.reg1).checked()};
+                auto mut_num_entries{(MSR_TABLE.size() - mut_rdl.reg1).checked()};
                 if (mut_num_entries >= hypercall::MV_RDL_MAX_ENTRIES) {
                     mut_num_entries = hypercall::MV_RDL_MAX_ENTRIES;
                 }
@@ -248,11 +225,15 @@ namespace microv
                     mut_num_entries = mut_num_entries.checked();
                 }
                 for (bsl::safe_idx mut_i{}; mut_i < mut_num_entries; ++mut_i) {
-                    *mut_rdl.entries.at_if(mut_i) = *supported_msrs.at_if(mut_i + mut_rdl.reg1);
+                    auto const *const desc{MSR_TABLE.at_if(mut_i + mut_rdl.reg1)};
+                    auto *const pmut_entry{mut_rdl.entries.at_if(mut_i)};
+
+                    pmut_entry->reg = bsl::to_u64(desc->msr).get();
+                    pmut_entry->val = 1UL;
                 }
                 mut_rdl.num_entries = mut_num_entries.get();
                 mut_rdl.reg1 =
-                    (supported_msrs.size() - (mut_rdl.reg1 + mut_num_entries)).checked().get();
+                    (MSR_TABLE.size() - (mut_rdl.reg1 + mut_num_entries)).checked().get();
             }
             else {
                 for (auto &mut_entry : mut_rdl.entries) {
@@ -0,0 +1,257 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TSC_HELPERS_HPP
+#define TSC_HELPERS_HPP
+
+#include <bsl/safe_integral.hpp>
+
+namespace microv
+{
+    /// @brief defines the number of bits computed per step of tsc_ratio
+    constexpr auto TSC_RATIO_STEP_BITS{16_u64};
+
+    /// <!-- description -->
+    ///   @brief Returns guest_khz / host_khz as a fixed point number with
+    ///     frac_bits fractional bits, which is the format the CPU expects
+    ///     for its TSC multiplier. The quotient is computed a few bits at a
+    ///     time so that nothing overflows, which also means frac_bits must
+    ///     be a multiple of TSC_RATIO_STEP_BITS. If the integer part of
+    ///     the ratio does not fit in the bits left over, or the ratio
+    ///     would be 0, bsl::safe_u64::failure() is returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param guest_khz the TSC frequency the guest should see in KHz
+    ///   @param host_khz the TSC frequency of the PP in KHz
+    ///   @param frac_bits the number of fractional bits in the ratio
+    ///   @return Returns guest_khz / host_khz as a fixed point number, or
+    ///     bsl::safe_u64::failure() if it cannot be represented.
+    ///
+    [[nodiscard]] constexpr auto
+    tsc_ratio(
+        bsl::safe_u64 const &guest_khz,
+        bsl::safe_u64 const &host_khz,
+        bsl::safe_u64 const &frac_bits) noexcept -> bsl::safe_u64
+    {
+        constexpr auto u64_bits{64_u64};
+        bsl::expects(guest_khz.is_pos());
+        bsl::expects(host_khz.is_pos());
+        bsl::expects(frac_bits < u64_bits);
+        bsl::expects((frac_bits % TSC_RATIO_STEP_BITS).is_zero());
+
+        auto mut_ratio{(guest_khz / host_khz).checked()};
+        auto mut_rem{(guest_khz % host_khz).checked()};
+        if ((mut_ratio >> (u64_bits - frac_bits).checked()).is_pos()) {
+            return bsl::safe_u64::failure();
+        }
+
+        auto const step_mask{((bsl::safe_u64::magic_1() << TSC_RATIO_STEP_BITS) - 1_u64).checked()};
+        for (bsl::safe_u64 mut_i{}; mut_i < frac_bits; mut_i += TSC_RATIO_STEP_BITS) {
+            mut_rem = (mut_rem << TSC_RATIO_STEP_BITS).checked();
+            mut_ratio = (mut_ratio << TSC_RATIO_STEP_BITS) | ((mut_rem / host_khz) & step_mask);
+            mut_rem = (mut_rem % host_khz).checked();
+        }
+
+        if (mut_ratio.is_zero()) {
+            return bsl::safe_u64::failure();
+        }
+
+        return mut_ratio.checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns (tsc * ratio) >> frac_bits, computed with the full
+    ///     128 bit product the same way the CPU scales the TSC of a guest.
+    ///     Like the TSC, the result wraps.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tsc the TSC value to scale
+    ///   @param ratio the fixed point ratio returned by tsc_ratio()
+    ///   @param frac_bits the number of fractional bits in the ratio
+    ///   @return Returns (tsc * ratio) >> frac_bits
+    ///
+    [[nodiscard]] constexpr auto
+    tsc_scale(
+        bsl::safe_u64 const &tsc,
+        bsl::safe_u64 const &ratio,
+        bsl::safe_u64 const &frac_bits) noexcept -> bsl::safe_u64
+    {
+        constexpr auto u64_bits{64_u64};
+        constexpr auto half_bits{32_u64};
+        constexpr auto half_mask{0x00000000FFFFFFFF_u64};
+        bsl::expects(frac_bits.is_pos());
+        bsl::expects(frac_bits < u64_bits);
+
+        auto const tsc_lo{tsc & half_mask};
+        auto const tsc_hi{tsc >> half_bits};
+        auto const ratio_lo{ratio & half_mask};
+        auto const ratio_hi{ratio >> half_bits};
+
+        auto const lo{(tsc_lo * ratio_lo).checked()};
+        auto const mid1{(tsc_hi * ratio_lo).checked()};
+        auto const mid2{(tsc_lo * ratio_hi).checked()};
+        auto const hi{(tsc_hi * ratio_hi).checked()};
+
+        auto const mid{((lo >> half_bits) + (mid1 & half_mask) + (mid2 & half_mask)).checked()};
+        auto const low64{((mid & half_mask) << half_bits) | (lo & half_mask)};
+        auto const high64{(hi + (mid1 >> half_bits) + (mid2 >> half_bits) + (mid >> half_bits))};
+
+        return (high64.checked() << (u64_bits - frac_bits).checked()) | (low64 >> frac_bits);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns lhs + rhs, wrapping the same way the CPU does when
+    ///     it adds the TSC offset to the TSC of a guest.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param lhs the left hand side of the addition
+    ///   @param rhs the right hand side of the addition
+    ///   @return Returns lhs + rhs modulo 2^64
+    ///
+    [[nodiscard]] constexpr auto
+    tsc_add(bsl::safe_u64 const &lhs, bsl::safe_u64 const &rhs) noexcept -> bsl::safe_u64
+    {
+        auto const room{(bsl::safe_u64::max_value() - lhs).checked()};
+        if (rhs > room) {
+            return ((rhs - room) - bsl::safe_u64::magic_1()).checked();
+        }
+
+        return (lhs + rhs).checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts a number of ticks of a guest's TSC into the
+    ///     number of ticks of the PP's TSC that take the same amount of
+    ///     time. If the result does not fit, it saturates.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ticks the number of guest TSC ticks to convert
+    ///   @param guest_khz the TSC frequency the guest sees in KHz
+    ///   @param host_khz the TSC frequency of the PP in KHz
+    ///   @return Returns the number of PP TSC ticks that take as long as
+    ///     the provided number of guest TSC ticks.
+    ///
+    [[nodiscard]] constexpr auto
+    tsc_ticks_to_host(
+        bsl::safe_u64 const &ticks,
+        bsl::safe_u64 const &guest_khz,
+        bsl::safe_u64 const &host_khz) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(guest_khz.is_pos());
+        bsl::expects(host_khz.is_pos());
+
+        if (guest_khz == host_khz) {
+            return ticks;
+        }
+
+        auto const whole{(ticks / guest_khz).checked()};
+        auto const part{(ticks % guest_khz).checked()};
+        if (whole >= (bsl::safe_u64::max_value() / host_khz).checked()) {
+            return bsl::safe_u64::max_value();
+        }
+
+        return ((whole * host_khz) + ((part * host_khz) / guest_khz)).checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Converts a number of ticks of a TSC running at tsc_khz
+    ///     into nanoseconds.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ticks the number of TSC ticks to convert
+    ///   @param tsc_khz the frequency of the TSC in KHz
+    ///   @return Returns the number of nanoseconds the provided number
+    ///     of TSC ticks take.
+    ///
+    [[nodiscard]] constexpr auto
+    tsc_ticks_to_ns(bsl::safe_u64 const &ticks, bsl::safe_u64 const &tsc_khz) noexcept
+        -> bsl::safe_u64
+    {
+        constexpr auto ns_per_ms{1000000_u64};
+        bsl::expects(tsc_khz.is_pos());
+
+        auto const whole{(ticks / tsc_khz).checked()};
+        auto const part{(ticks % tsc_khz).checked()};
+
+        return ((whole * ns_per_ms) + ((part * ns_per_ms) / tsc_khz)).checked();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the multiplier and shift a pvclock_vcpu_time_info
+    ///     uses to turn TSC ticks into nanoseconds, which the guest
+    ///     applies as ((ticks << shift) * mul) >> 32 (shifting right for
+    ///     a negative shift). This is the same math as KVM's
+    ///     kvm_get_time_scale(), so that the guest sees the same values
+    ///     it would under KVM. The shift is returned as the 8 bit two's
+    ///     complement value that is stored in the pvclock.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tsc_khz the TSC frequency the guest sees in KHz
+    ///   @param mut_mul returns the 32 bit multiplier
+    ///   @param mut_shift returns the 8 bit shift
+    ///
+    constexpr void
+    tsc_pvclock_scale(
+        bsl::safe_u64 const &tsc_khz, bsl::safe_u64 &mut_mul, bsl::safe_u64 &mut_shift) noexcept
+    {
+        constexpr auto hz_per_khz{1000_u64};
+        constexpr auto ns_per_sec{1000000000_u64};
+        constexpr auto high_mask{0xFFFFFFFF00000000_u64};
+        constexpr auto bit31{0x0000000080000000_u64};
+        constexpr auto u32_bits{32_u64};
+        constexpr auto u8_range{0x100_u64};
+        bsl::expects(tsc_khz.is_pos());
+
+        auto mut_tps{(tsc_khz * hz_per_khz).checked()};
+        auto mut_scaled{ns_per_sec};
+        bsl::safe_u64 mut_right{};
+        bsl::safe_u64 mut_left{};
+
+        while (mut_tps > (mut_scaled << 1_u64) || (mut_tps & high_mask).is_pos()) {
+            mut_tps >>= 1_u64;
+            ++mut_right;
+        }
+
+        while (mut_tps <= mut_scaled || (mut_scaled & high_mask).is_pos()) {
+            if ((mut_scaled & high_mask).is_pos() || (mut_tps & bit31).is_pos()) {
+                mut_scaled >>= 1_u64;
+            }
+            else {
+                mut_tps <<= 1_u64;
+            }
+
+            ++mut_left;
+        }
+
+        mut_mul = ((mut_scaled << u32_bits) / mut_tps).checked();
+        if (mut_right > mut_left) {
+            mut_shift = (u8_range - (mut_right - mut_left)).checked();
+        }
+        else {
+            mut_shift = (mut_left - mut_right).checked();
+        }
+    }
+}
+
+#endif
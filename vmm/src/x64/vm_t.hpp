@@ -25,22 +25,33 @@
 #ifndef VM_T_HPP
 #define VM_T_HPP
 
+#include <alloc_bitmap.hpp>
 #include <allocated_status_t.hpp>
 #include <bf_syscall_t.hpp>
 #include <emulated_ioapic_t.hpp>
+#include <emulated_lapic_t.hpp>
 #include <emulated_mmio_t.hpp>
 #include <emulated_pic_t.hpp>
 #include <emulated_pit_t.hpp>
+#include <emulated_uart_t.hpp>
 #include <gs_t.hpp>
 #include <intrinsic_t.hpp>
+#include <io_access_t.hpp>
+#include <iopm_helpers.hpp>
+#include <kvm_pv_mailbox_t.hpp>
+#include <msr_table.hpp>
+#include <mv_constants.hpp>
+#include <mv_exit_io_t.hpp>
 #include <mv_translation_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
+#include <tsc_helpers.hpp>
 
 #include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 
 namespace microv
 {
@@ -66,6 +77,80 @@ namespace microv
         emulated_pic_t m_emulated_pic{};
         /// @brief stores this vs_t's emulated_pit_t
         emulated_pit_t m_emulated_pit{};
+        /// @brief stores this vs_t's emulated_uart_t
+        emulated_uart_t m_emulated_uart{};
+        /// @brief stores whether the PIC, IOAPIC and PIT are emulated
+        bool m_irqchip{};
+        /// @brief stores the GSIs that are resampled (bit n is GSI n)
+        bsl::safe_u64 m_irq_resample{};
+        /// @brief stores the IPIs and kicks sent with KVM's PV hypercalls
+        kvm_pv_mailbox_t m_kvm_pv_mailbox{};
+
+        /// @brief stores this vm_t's MSR permissions map
+        bsl::span<bsl::uint8> m_msrpm{};
+        /// @brief stores the SPA of this vm_t's MSR permissions map
+        bsl::safe_u64 m_msrpm_spa{};
+
+        /// @brief stores this vm_t's IO permissions map
+        bsl::span<bsl::uint8> m_iopm{};
+        /// @brief stores the SPA of this vm_t's IO permissions map
+        bsl::safe_u64 m_iopm_spa{};
+        /// @brief stores which ports MicroV handles when nothing emulates them
+        bsl::array<bsl::uint8, IO_BITMAP_SIZE.get()> m_io_emulated{};
+
+        /// @brief stores the max number of cycles between PAUSEs of a loop
+        bsl::safe_u64 m_pause_gap{};
+        /// @brief stores the number of cycles a VS can spin before yielding
+        bsl::safe_u64 m_pause_window{};
+
+        /// @brief stores the PP's TSC when the kvmclock was last set
+        bsl::safe_u64 m_kvmclock_tsc{};
+        /// @brief stores the kvmclock in nanoseconds at m_kvmclock_tsc
+        bsl::safe_u64 m_kvmclock_ns{};
+        /// @brief stores the wall clock time in nanoseconds at kvmclock 0
+        bsl::safe_u64 m_kvmclock_boot_ns{};
+        /// @brief stores the number of times the kvmclock was set
+        bsl::safe_u64 m_kvmclock_gen{};
+
+        /// <!-- description -->
+        ///   @brief Returns true if the requested port is emulated by one
+        ///     of MicroV's device models, false otherwise. These ports
+        ///     must always exit, so they cannot be passed through.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port to query
+        ///   @return Returns true if the requested port is emulated by one
+        ///     of MicroV's device models, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_port_emulated(bsl::safe_u64 const &port) noexcept -> bool
+        {
+            if constexpr (MICROV_EMULATED_UART) {
+                if (emulated_uart_t::handles(port)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            if constexpr (MICROV_EMULATED_IRQCHIP) {
+                if (emulated_pic_t::handles(port)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            if constexpr (MICROV_EMULATED_PIT) {
+                if (emulated_pit_t::handles(port)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
 
     public:
         /// <!-- description -->
@@ -95,6 +180,7 @@ namespace microv
             m_emulated_mmio.initialize(gs, tls, sys, intrinsic, i);
             m_emulated_pic.initialize(gs, tls, sys, intrinsic, i);
             m_emulated_pit.initialize(gs, tls, sys, intrinsic, i);
+            m_emulated_uart.initialize(gs, tls, sys, intrinsic, i);
 
             m_id = ~i;
         }
@@ -119,6 +205,7 @@ namespace microv
         {
             this->deallocate(gs, tls, sys, mut_page_pool, intrinsic);
 
+            m_emulated_uart.release(gs, tls, sys, intrinsic);
             m_emulated_pit.release(gs, tls, sys, intrinsic);
             m_emulated_pic.release(gs, tls, sys, intrinsic);
             m_emulated_mmio.release(gs, tls, sys, intrinsic);
@@ -168,6 +255,56 @@ namespace microv
                 return bsl::safe_u16::failure();
             }
 
+            if (!mut_sys.is_vm_the_root_vm(this->id())) {
+
+                /// NOTE:
+                /// - Bitmap allocations cannot be freed, so once a vm_t
+                ///   has MSR and IO permissions maps, it keeps them and
+                ///   reuses them each time it is allocated. The root VM
+                ///   uses the root_msrpm and root_iopm from the gs_t
+                ///   instead.
+                ///
+
+                if (m_msrpm.empty()) {
+                    m_msrpm = alloc_bitmap(mut_sys, MSRPM_SIZE, m_msrpm_spa);
+                    if (bsl::unlikely(m_msrpm.is_invalid())) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        m_emulated_mmio.deallocate(gs, tls, mut_sys, mut_page_pool, intrinsic);
+                        return bsl::safe_u16::failure();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (m_iopm.empty()) {
+                    m_iopm = alloc_bitmap(mut_sys, IOPM_SIZE, m_iopm_spa);
+                    if (bsl::unlikely(m_iopm.is_invalid())) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        m_emulated_mmio.deallocate(gs, tls, mut_sys, mut_page_pool, intrinsic);
+                        return bsl::safe_u16::failure();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+
+                msrpm_init(m_msrpm);
+                iopm_init(m_iopm);
+                m_io_emulated = {};
+
+                m_pause_gap = hypercall::MV_PAUSE_EXITING_DEFAULT_GAP;
+                m_pause_window = hypercall::MV_PAUSE_EXITING_DEFAULT_WINDOW;
+
+                m_kvmclock_tsc = intrinsic.rdtsc();
+                m_kvmclock_ns = {};
+                m_kvmclock_boot_ns = {};
+                m_kvmclock_gen = bsl::safe_u64::magic_1();
+            }
+            else {
+                bsl::touch();
+            }
+
             m_allocated = allocated_status_t::allocated;
 
             if (!mut_sys.is_vm_the_root_vm(this->id())) {
@@ -204,7 +341,14 @@ namespace microv
         {
             bsl::expects(this->is_active(tls).is_invalid());
 
+            m_emulated_uart.deallocate(tls);
+            m_emulated_pit.deallocate(tls);
+            m_emulated_pic.deallocate(tls);
             m_emulated_mmio.deallocate(gs, tls, sys, mut_page_pool, intrinsic);
+            m_emulated_ioapic.deallocate(tls);
+            m_kvm_pv_mailbox.deallocate(tls);
+            m_irqchip = {};
+            m_irq_resample = {};
             m_allocated = allocated_status_t::deallocated;
 
             if (!sys.is_vm_the_root_vm(this->id())) {
@@ -339,6 +483,287 @@ namespace microv
             return m_emulated_mmio.slpt_spa();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the system physical address of the MSR
+        ///     permissions map used by this vm_t. The root VM does not
+        ///     have one, and 0 is returned instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the system physical address of the MSR
+        ///     permissions map used by this vm_t.
+        ///
+        [[nodiscard]] constexpr auto
+        msrpm_spa() const noexcept -> bsl::safe_u64
+        {
+            return m_msrpm_spa;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the system physical address of the IO
+        ///     permissions map used by this vm_t. The root VM does not
+        ///     have one, and 0 is returned instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the system physical address of the IO
+        ///     permissions map used by this vm_t.
+        ///
+        [[nodiscard]] constexpr auto
+        iopm_spa() const noexcept -> bsl::safe_u64
+        {
+            return m_iopm_spa;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets how this vm_t's accesses to a range of ports are
+        ///     handled. MV_IO_PERM_EXIT hands them to the root VM,
+        ///     MV_IO_PERM_PASSTHROUGH gives the VM direct access to the
+        ///     ports and MV_IO_PERM_EMULATE has MicroV handle them (see
+        ///     io_emulated). Ports emulated by one of MicroV's device
+        ///     models cannot be passed through.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the first port in the range
+        ///   @param num the number of ports in the range
+        ///   @param type MV_IO_PERM_EXIT, MV_IO_PERM_PASSTHROUGH or
+        ///     MV_IO_PERM_EMULATE
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        io_permission(
+            bsl::safe_u64 const &port,
+            bsl::safe_u64 const &num,
+            bsl::safe_u64 const &type) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(!m_iopm.empty());
+
+            bsl::expects(port.is_valid_and_checked());
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num.is_pos());
+
+            auto const end{(port + num).checked()};
+            bsl::expects(end <= IO_NUM_PORTS);
+
+            bool const passthrough{hypercall::MV_IO_PERM_PASSTHROUGH == type};
+            bool const emulate{hypercall::MV_IO_PERM_EMULATE == type};
+
+            if (passthrough) {
+                for (bsl::safe_u64 mut_i{port}; mut_i < end; ++mut_i) {
+                    if (bsl::unlikely(is_port_emulated(mut_i))) {
+                        bsl::error() << "port "                                   // --
+                                     << bsl::hex(mut_i)                           // --
+                                     << " is emulated by MicroV and cannot be"    // --
+                                     << " passed through"                         // --
+                                     << bsl::endl                                 // --
+                                     << bsl::here();                              // --
+
+                        return bsl::errc_failure;
+                    }
+
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            for (bsl::safe_u64 mut_i{port}; mut_i < end; ++mut_i) {
+                io_bitmap_set(m_iopm, mut_i, !passthrough);
+                io_bitmap_set(m_io_emulated, mut_i, emulate);
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if accesses to the requested port were
+        ///     marked as MV_IO_PERM_EMULATE, in which case MicroV handles
+        ///     them when none of its device models do (reads return all
+        ///     ones and writes are dropped), false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param port the port to query
+        ///   @return Returns true if accesses to the requested port were
+        ///     marked as MV_IO_PERM_EMULATE, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        io_emulated(bsl::safe_u64 const &port) const noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return io_bitmap_test(m_io_emulated, port);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets this vm_t's PAUSE-loop exiting thresholds. A gap
+        ///     or window of 0 disables PAUSE-loop exiting. The thresholds
+        ///     are picked up by each of this vm_t's VSs the next time they
+        ///     are run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gap the max number of cycles between PAUSEs of a loop
+        ///   @param window the number of cycles a VS can spin before yielding
+        ///
+        constexpr void
+        set_pause_exiting(bsl::safe_u64 const &gap, bsl::safe_u64 const &window) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(gap <= hypercall::MV_PAUSE_EXITING_MAX);
+            bsl::expects(window <= hypercall::MV_PAUSE_EXITING_MAX);
+
+            m_pause_gap = gap;
+            m_pause_window = window;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of cycles between two PAUSEs
+        ///     of a loop for this vm_t's VSs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of cycles between two PAUSEs
+        ///     of a loop for this vm_t's VSs.
+        ///
+        [[nodiscard]] constexpr auto
+        pause_gap() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_pause_gap;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of cycles this vm_t's VSs can spin
+        ///     before yielding.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of cycles this vm_t's VSs can spin
+        ///     before yielding.
+        ///
+        [[nodiscard]] constexpr auto
+        pause_window() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_pause_window;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vm_t's kvmclock in nanoseconds given the
+        ///     PP's current TSC and the PP's TSC frequency in KHz. The
+        ///     kvmclock starts at 0 when the vm_t is created and counts
+        ///     at the rate of the TSC from then on, unless it is set
+        ///     using kvmclock_set().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the PP's current TSC
+        ///   @param tsc_khz the PP's TSC frequency in KHz
+        ///   @return Returns this vm_t's kvmclock in nanoseconds
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_get(bsl::safe_u64 const &tsc, bsl::safe_u64 const &tsc_khz) const noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (tsc < m_kvmclock_tsc) {
+                return m_kvmclock_ns;
+            }
+
+            auto const elapsed{(tsc - m_kvmclock_tsc).checked()};
+            return (m_kvmclock_ns + tsc_ticks_to_ns(elapsed, tsc_khz)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets this vm_t's kvmclock to "ns" at the PP's TSC
+        ///     "tsc". If "realtime" is not 0, it is the wall clock time
+        ///     in nanoseconds at that same point, which is what the
+        ///     guest sees in MSR_KVM_WALL_CLOCK_NEW. Each of this vm_t's
+        ///     VSs rewrites its pvclock the next time it is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the PP's current TSC
+        ///   @param ns the kvmclock in nanoseconds at "tsc"
+        ///   @param realtime the wall clock time in nanoseconds at "tsc"
+        ///     or 0 to keep the current wall clock time
+        ///
+        constexpr void
+        kvmclock_set(
+            bsl::safe_u64 const &tsc,
+            bsl::safe_u64 const &ns,
+            bsl::safe_u64 const &realtime) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            m_kvmclock_tsc = tsc;
+            m_kvmclock_ns = ns;
+
+            if (realtime.is_pos()) {
+                if (realtime > ns) {
+                    m_kvmclock_boot_ns = (realtime - ns).checked();
+                }
+                else {
+                    m_kvmclock_boot_ns = {};
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            ++m_kvmclock_gen;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PP's TSC when this vm_t's kvmclock was
+        ///     last set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the PP's TSC when this vm_t's kvmclock was
+        ///     last set.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_tsc() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_kvmclock_tsc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns this vm_t's kvmclock in nanoseconds when it
+        ///     was last set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns this vm_t's kvmclock in nanoseconds when it
+        ///     was last set.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_ns() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_kvmclock_ns;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the wall clock time in nanoseconds at which
+        ///     this vm_t's kvmclock was 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the wall clock time in nanoseconds at which
+        ///     this vm_t's kvmclock was 0.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_boot_ns() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_kvmclock_boot_ns;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of times this vm_t's kvmclock was
+        ///     set, which the VSs use to tell if their pvclock is stale.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of times this vm_t's kvmclock was
+        ///     set.
+        ///
+        [[nodiscard]] constexpr auto
+        kvmclock_gen() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_kvmclock_gen;
+        }
+
         /// <!-- description -->
         ///   @brief Maps memory into this vm_t using instructions from the
         ///     provided MDL.
@@ -402,6 +827,744 @@ namespace microv
             bsl::expects(allocated_status_t::allocated == m_allocated);
             return m_emulated_mmio.gpa_to_spa(sys, gpa);
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the system physical address that a guest
+        ///     physical address owned by this vm_t is mapped to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param sys the bf_syscall_t to use
+        ///   @param page_pool the page_pool_t to use
+        ///   @param gpa the GPA to translate to a SPA
+        ///   @return Returns the resulting SPA, or bsl::safe_u64::failure()
+        ///     if the GPA is not mapped into this vm_t.
+        ///
+        [[nodiscard]] constexpr auto
+        translate_gpa(
+            tls_t const &tls,
+            syscall::bf_syscall_t const &sys,
+            page_pool_t const &page_pool,
+            bsl::safe_u64 const &gpa) const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_mmio.translate_gpa(tls, sys, page_pool, gpa);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to this vm_t's PIT. Returns false if
+        ///     the write has to be handed to the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pit_write(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            io_access_t const &access,
+            bsl::safe_u64 const &val) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_pit.write(tls, tsc_khz, tsc, access, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from this vm_t's PIT. Returns
+        ///     bsl::safe_u64::failure() if the read has to be handed to
+        ///     the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @param access the port IO access to emulate
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        pit_read(
+            tls_t const &tls,
+            bsl::safe_u64 const &tsc_khz,
+            bsl::safe_u64 const &tsc,
+            io_access_t const &access) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_pit.read(tls, tsc_khz, tsc, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vm_t's PIT has produced a tick
+        ///     on IRQ0 that has not been acknowledged yet and marks it as
+        ///     acknowledged.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @return Returns true if IRQ0 should be pulsed, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        pit_ack_irq(
+            tls_t const &tls, bsl::safe_u64 const &tsc_khz, bsl::safe_u64 const &tsc) noexcept
+            -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_pit.ack_irq(tls, tsc_khz, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of nanoseconds until this vm_t's PIT
+        ///     produces its next tick on IRQ0, 0 if it has produced one
+        ///     that has not been acknowledged yet, or
+        ///     bsl::safe_u64::max_value() if it will not produce one.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param tsc_khz the TSC frequency in KHz of the VS
+        ///   @param tsc the current TSC
+        ///   @return Returns the number of nanoseconds until this vm_t's
+        ///     PIT produces its next tick on IRQ0.
+        ///
+        [[nodiscard]] constexpr auto
+        pit_irq_ns(
+            tls_t const &tls, bsl::safe_u64 const &tsc_khz, bsl::safe_u64 const &tsc) const noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_pit.irq_ns(tls, tsc_khz, tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells MicroV to emulate this vm_t's PIC, IOAPIC and
+        ///     PIT instead of handing accesses to them to the root VM. If
+        ///     the CPU can virtualize the LAPIC, the APIC-access page is
+        ///     also mapped at the default LAPIC base so that each VS can
+        ///     switch to hardware LAPIC virtualization when it next runs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param gs the gs_t to use
+        ///   @param tls the tls_t to use
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        irqchip_create(
+            gs_t const &gs,
+            tls_t const &tls,
+            syscall::bf_syscall_t &mut_sys,
+            page_pool_t &mut_page_pool) noexcept -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (bsl::unlikely(m_irqchip)) {
+                bsl::error() << "the irqchip of vm "    // --
+                             << bsl::hex(this->id())    // --
+                             << " was already created"  // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return bsl::errc_failure;
+            }
+
+            if (gs.apic_access_spa.is_pos()) {
+                auto const ret{m_emulated_mmio.map_page(
+                    tls, mut_sys, mut_page_pool, LAPIC_BASE_DEFAULT, gs.apic_access_spa)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_irqchip = true;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if MicroV emulates this vm_t's PIC, IOAPIC
+        ///     and PIT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if MicroV emulates this vm_t's PIC, IOAPIC
+        ///     and PIT.
+        ///
+        [[nodiscard]] constexpr auto
+        irqchip_enabled() const noexcept -> bool
+        {
+            return m_irqchip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to this vm_t's PIC. Returns false if
+        ///     the write has to be handed to the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pic_write(tls_t const &tls, io_access_t const &access, bsl::safe_u64 const &val) noexcept
+            -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_pic.write(tls, access, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from this vm_t's PIC. Returns
+        ///     bsl::safe_u64::failure() if the read has to be handed to
+        ///     the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        pic_read(tls_t const &tls, io_access_t const &access) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_pic.read(tls, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an MMIO write to this vm_t's IOAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gpa the guest physical address being written
+        ///   @param bytes the number of bytes being written
+        ///   @param val the value being written
+        ///
+        constexpr void
+        ioapic_write(
+            tls_t const &tls,
+            bsl::safe_u64 const &gpa,
+            bsl::safe_u64 const &bytes,
+            bsl::safe_u64 const &val) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_emulated_ioapic.write(tls, gpa, bytes, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an MMIO read from this vm_t's IOAPIC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gpa the guest physical address being read
+        ///   @param bytes the number of bytes being read
+        ///   @return Returns the value read
+        ///
+        [[nodiscard]] constexpr auto
+        ioapic_read(
+            tls_t const &tls, bsl::safe_u64 const &gpa, bsl::safe_u64 const &bytes) const noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_ioapic.read(tls, gpa, bytes);
+        }
+
+        /// <!-- description -->
+        ///   @brief Handles an EOI for the provided vector, which clears
+        ///     remote IRR of any level triggered IOAPIC pin using it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param vector the vector that was EOI'd
+        ///
+        constexpr void
+        ioapic_eoi(tls_t const &tls, bsl::safe_u64 const &vector) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_emulated_ioapic.eoi(tls, vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Drives the provided GSI of this vm_t. GSIs are routed
+        ///     the same way QEMU routes them with KVM. GSI 0-15 drive PIC
+        ///     IRQ 0-15 and IOAPIC pins 0-15, except that GSI 0 drives
+        ///     IOAPIC pin 2 (the IRQ0 override every PC firmware reports)
+        ///     and GSI 2 only drives IOAPIC pin 2 (IRQ 2 is the PIC's
+        ///     cascade). GSI 16-23 only drive IOAPIC pins 16-23.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gsi the GSI to drive
+        ///   @param level the new level of the GSI
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        irq_line(tls_t const &tls, bsl::safe_u64 const &gsi, bool const level) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (bsl::unlikely(!m_irqchip)) {
+                bsl::error() << "the irqchip of vm "    // --
+                             << bsl::hex(this->id())    // --
+                             << " was never created"    // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(gsi >= IOAPIC_NUM_PINS)) {
+                bsl::error() << "gsi "                      // --
+                             << bsl::hex(gsi)               // --
+                             << " is out of range"          // --
+                             << bsl::endl                   // --
+                             << bsl::here();                // --
+
+                return bsl::errc_failure;
+            }
+
+            if ((gsi < PIC_NUM_IRQS) && (gsi != PIC_CASCADE_PIN)) {
+                m_emulated_pic.set_irq(tls, gsi, level);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (gsi.is_zero()) {
+                m_emulated_ioapic.set_irq(tls, PIC_CASCADE_PIN, level);
+            }
+            else {
+                m_emulated_ioapic.set_irq(tls, gsi, level);
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Turns resampling of the provided GSI of this vm_t on
+        ///     or off. While a GSI is resampled, an EOI of its IOAPIC pin
+        ///     lowers it and records it until irq_resampled_take() is
+        ///     called. GSI 0 and 2 share IOAPIC pin 2 with the PIT, and
+        ///     cannot be resampled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param gsi the GSI to resample
+        ///   @param enable true to turn resampling on, false to turn it off
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        irq_resample(tls_t const &tls, bsl::safe_u64 const &gsi, bool const enable) noexcept
+            -> bsl::errc_type
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (bsl::unlikely(!m_irqchip)) {
+                bsl::error() << "the irqchip of vm "    // --
+                             << bsl::hex(this->id())    // --
+                             << " was never created"    // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(gsi >= IOAPIC_NUM_PINS)) {
+                bsl::error() << "gsi "                      // --
+                             << bsl::hex(gsi)               // --
+                             << " is out of range"          // --
+                             << bsl::endl                   // --
+                             << bsl::here();                // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(gsi.is_zero() || (PIC_CASCADE_PIN == gsi))) {
+                bsl::error() << "gsi "                      // --
+                             << bsl::hex(gsi)               // --
+                             << " cannot be resampled"      // --
+                             << bsl::endl                   // --
+                             << bsl::here();                // --
+
+                return bsl::errc_failure;
+            }
+
+            m_emulated_ioapic.set_resample(tls, gsi, enable);
+
+            if (enable) {
+                m_irq_resample |= (1_u64 << gsi);
+            }
+            else {
+                m_irq_resample &= ~(1_u64 << gsi);
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if a resampled GSI of this vm_t was EOI'd
+        ///     and has not been collected using irq_resampled_take() yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if a resampled GSI of this vm_t was EOI'd
+        ///     and has not been collected yet.
+        ///
+        [[nodiscard]] constexpr auto
+        irq_resampled_pending(tls_t const &tls) const noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            /// NOTE:
+            /// - This is asked on every VMExit that resumes the guest, so
+            ///   the IOAPIC's lock is only taken by VMs that actually
+            ///   resample a GSI. Like m_irqchip, m_irq_resample is only
+            ///   changed by the root VM.
+            ///
+
+            if (m_irq_resample.is_zero()) {
+                return false;
+            }
+
+            return m_emulated_ioapic.resampled_pending(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the resampled GSIs of this vm_t that were EOI'd
+        ///     since the last call (bit n is GSI n), and forgets them. The
+        ///     PIC inputs of these GSIs are lowered as well so that the
+        ///     GSIs are fully lowered by the time the root VM sees them.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns the resampled GSIs of this vm_t that were
+        ///     EOI'd since the last call
+        ///
+        [[nodiscard]] constexpr auto
+        irq_resampled_take(tls_t const &tls) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (m_irq_resample.is_zero()) {
+                return bsl::safe_u64::magic_0();
+            }
+
+            auto const resampled{m_emulated_ioapic.take_resampled(tls)};
+            for (bsl::safe_u64 mut_gsi{}; mut_gsi < PIC_NUM_IRQS; ++mut_gsi) {
+                if ((resampled & (1_u64 << mut_gsi)).is_pos()) {
+                    m_emulated_pic.set_irq(tls, mut_gsi, false);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return resampled;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the next interrupt this vm_t's IOAPIC has for
+        ///     the VS with the provided APIC ID and marks it as
+        ///     acknowledged. The value returned is the vector, with
+        ///     IOAPIC_RTE_LEVEL set if it is level triggered. If there is
+        ///     nothing to deliver, bsl::safe_u64::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns the interrupt to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        ioapic_ack(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (!m_irqchip) {
+                return bsl::safe_u64::failure();
+            }
+
+            return m_emulated_ioapic.ack(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Posts a fixed IPI sent with KVM_HC_SEND_IPI to the VS
+        ///     with the provided APIC ID. Returns false if no VS can have
+        ///     the provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to send the IPI to
+        ///   @param vector the vector of the IPI
+        ///   @return Returns true if the IPI was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_ipi_send(
+            tls_t const &tls, bsl::safe_u64 const &apic_id, bsl::safe_u64 const &vector) noexcept
+            -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.send(tls, apic_id, vector);
+        }
+
+        /// <!-- description -->
+        ///   @brief Posts an NMI sent with KVM_HC_SEND_IPI to the VS with
+        ///     the provided APIC ID. Returns false if no VS can have the
+        ///     provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to send the NMI to
+        ///   @return Returns true if the NMI was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_nmi_send(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.send_nmi(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Kicks the VS with the provided APIC ID out of a HLT
+        ///     (KVM_HC_KICK_CPU). Returns false if no VS can have the
+        ///     provided APIC ID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID to kick
+        ///   @return Returns true if the kick was posted, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_kick(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.kick(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the highest vector sent with KVM_HC_SEND_IPI to
+        ///     the VS with the provided APIC ID and marks it as delivered.
+        ///     If there is nothing to deliver, bsl::safe_u64::failure() is
+        ///     returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns the vector to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_ipi_ack(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.ack(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an NMI was sent with KVM_HC_SEND_IPI to
+        ///     the VS with the provided APIC ID, and marks it as delivered.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns true if an NMI has to be delivered
+        ///
+        [[nodiscard]] constexpr auto
+        pv_nmi_ack(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.ack_nmi(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the VS with the provided APIC ID was
+        ///     kicked with KVM_HC_KICK_CPU, and consumes the kick.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS acknowledging
+        ///   @return Returns true if the VS was kicked
+        ///
+        [[nodiscard]] constexpr auto
+        pv_kick_ack(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.ack_kick(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the VS with the provided APIC ID as halted in the
+        ///     root VM, so that IPIs, NMIs and kicks sent to it from now on
+        ///     record a wakeup (see pv_wakeup_take). Returns false without
+        ///     marking it if one was already sent to it, in which case it
+        ///     should not halt at all.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS halting
+        ///   @return Returns true if the VS was marked as halted, false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_halt(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.halt(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the VS with the provided APIC ID as no longer
+        ///     halted. This is called each time the VS is run.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param apic_id the APIC ID of the VS being run
+        ///
+        constexpr void
+        pv_unhalt(tls_t const &tls, bsl::safe_u64 const &apic_id) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_kvm_pv_mailbox.unhalt(tls, apic_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an IPI, NMI or kick was sent to a VS of
+        ///     this vm_t that is halted in the root VM, and has not been
+        ///     collected using pv_wakeup_take() yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if a wakeup is pending, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        pv_wakeup_pending(tls_t const &tls) const noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.wakeup_pending(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if an IPI, NMI or kick was sent to a VS of
+        ///     this vm_t that is halted in the root VM since this was last
+        ///     called, and consumes the wakeup.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if the root VM has to wake up this
+        ///     vm_t's halted VSs, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        pv_wakeup_take(tls_t const &tls) noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_kvm_pv_mailbox.take_wakeup(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the vector of the next interrupt this vm_t's
+        ///     PIC has and marks it as acknowledged. The PIC's output is
+        ///     wired to LINT0 of the BSP, so only the BSP should call this,
+        ///     and only when its LAPIC accepts ExtINT. If there is nothing
+        ///     to deliver, bsl::safe_u64::failure() is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns the vector to deliver, or
+        ///     bsl::safe_u64::failure() if there is nothing to deliver.
+        ///
+        [[nodiscard]] constexpr auto
+        pic_ack(tls_t const &tls) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+
+            if (!m_irqchip) {
+                return bsl::safe_u64::failure();
+            }
+
+            return m_emulated_pic.ack(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an OUT to this vm_t's UART. Returns false if
+        ///     the write has to be handed to the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @param val the value being written
+        ///   @return Returns true if the write was emulated, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        uart_write(tls_t const &tls, io_access_t const &access, bsl::safe_u64 const &val) noexcept
+            -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_uart.write(tls, access, val);
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates an IN from this vm_t's UART. Returns
+        ///     bsl::safe_u64::failure() if the read has to be handed to
+        ///     the root VM instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param access the port IO access to emulate
+        ///   @return Returns the value read, or bsl::safe_u64::failure()
+        ///     if the read was not emulated.
+        ///
+        [[nodiscard]] constexpr auto
+        uart_read(tls_t const &tls, io_access_t const &access) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_uart.read(tls, access);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if this vm_t's UART has transmitted bytes
+        ///     that have not yet been handed to the root VM.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @return Returns true if this vm_t's UART has transmitted bytes
+        ///     that have not yet been handed to the root VM.
+        ///
+        [[nodiscard]] constexpr auto
+        uart_tx_pending(tls_t const &tls) const noexcept -> bool
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_uart.tx_pending(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves this vm_t's buffered UART bytes into the provided
+        ///     mv_exit_io_t and returns the number of bytes moved.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the tls_t to use
+        ///   @param mut_exit_io the mv_exit_io_t to fill in
+        ///   @return Returns the number of bytes moved
+        ///
+        [[nodiscard]] constexpr auto
+        uart_flush(tls_t const &tls, hypercall::mv_exit_io_t &mut_exit_io) noexcept
+            -> bsl::safe_u64
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            return m_emulated_uart.flush(tls, mut_exit_io);
+        }
     };
 }
 